@@ -18,6 +18,7 @@
  */
 
 #include <err.h>
+#include <signal.h>
 #include <stdio.h>
 #include <stdlib.h>
 
@@ -40,8 +41,18 @@ unsigned _native_retval = EXIT_SUCCESS;
 
 static void _native_sleep(void)
 {
+    sigset_t all, prev;
+
     _native_in_syscall++; /* no switching here */
-    real_pause();
+    /* A signal caught while in a syscall is only marked pending. Block the
+     * signals while checking for that, sigsuspend() unblocks them atomically
+     * and a signal between the check and the sleep cannot be missed. */
+    sigfillset(&all);
+    sigprocmask(SIG_SETMASK, &all, &prev);
+    if (_native_sigpend == 0) {
+        sigsuspend(&prev);
+    }
+    sigprocmask(SIG_SETMASK, &prev, NULL);
     _native_in_syscall--;
 
     if (_native_sigpend > 0) {
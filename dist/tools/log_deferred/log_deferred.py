@@ -0,0 +1,219 @@
+#! /usr/bin/env python3
+#
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+#
+# @author   agent <agent@local>
+
+"""
+Decoder for the output of the `log_deferred` module.
+
+Log messages arrive as binary frames that contain the address of the format
+string and the arguments. The format strings are read from the ELF file of the
+application. Other output passes unchanged.
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+FRAME_START = 0x1e
+FRAME_RECORD = ord('L')
+FRAME_DROPPED = ord('D')
+RECORD_HDR_LEN = 5
+
+PT_LOAD = 1
+PF_W = 0x2
+
+LEVELS = {
+    1: "ERROR",
+    2: "WARNING",
+    3: "INFO",
+    4: "DEBUG",
+    5: "ALL",
+}
+
+CONVERSION = re.compile(
+    r"%([-+ #0]*)(\*|\d+)?(?:\.(\*|\d*))?(hh|h|ll|l|j|z|t|L)?([diouxXcspfFeEgGn%])"
+)
+
+
+class Elf:
+    """Reads strings from the read-only loadable segments of an ELF file"""
+
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self.data = f.read()
+        if self.data[:4] != b"\x7fELF":
+            raise ValueError("{} is not an ELF file".format(path))
+        self.wordsize = 4 if self.data[4] == 1 else 8
+        self.endian = "<" if self.data[5] == 1 else ">"
+        if self.wordsize == 4:
+            phoff, = struct.unpack_from(self.endian + "I", self.data, 28)
+            phentsize, phnum = struct.unpack_from(self.endian + "HH", self.data, 42)
+            phdr = "IIIIIII"
+        else:
+            phoff, = struct.unpack_from(self.endian + "Q", self.data, 32)
+            phentsize, phnum = struct.unpack_from(self.endian + "HH", self.data, 54)
+            phdr = "IIQQQQ"
+        self.segments = []
+        for i in range(phnum):
+            fields = struct.unpack_from(self.endian + phdr, self.data,
+                                        phoff + i * phentsize)
+            if self.wordsize == 4:
+                p_type, p_offset, p_vaddr, _, p_filesz, _, p_flags = fields
+            else:
+                p_type, p_flags, p_offset, p_vaddr, _, p_filesz = fields
+            # format strings are constant, the file contents of writable
+            # segments are only the initial values of the data
+            if p_type == PT_LOAD and p_filesz and not p_flags & PF_W:
+                self.segments.append((p_vaddr, p_filesz, p_offset))
+
+    def string(self, addr):
+        """Returns the string at addr or None if it is not in the ELF file"""
+        for vaddr, size, offset in self.segments:
+            if vaddr <= addr < vaddr + size:
+                start = offset + addr - vaddr
+                end = self.data.find(b"\0", start, offset + size)
+                if end < 0:
+                    return None
+                return self.data[start:end].decode("utf-8", errors="replace")
+        return None
+
+
+class Decoder:
+    """Splits the stdio stream into text and log frames"""
+
+    def __init__(self, elf, out, verbose=False):
+        self.elf = elf
+        self.out = out
+        self.verbose = verbose
+        self.buf = b""
+        self.word = self.elf.endian + ("I" if self.elf.wordsize == 4 else "Q")
+
+    def _signed(self, value, bits):
+        value &= (1 << bits) - 1
+        if value & (1 << (bits - 1)):
+            value -= 1 << bits
+        return value
+
+    def _convert(self, match, args):
+        flags, width, prec, length, spec = match.groups()
+        if spec == "%":
+            return "%"
+        if width == "*":
+            width = str(self._signed(args.pop(0) if args else 0, 32))
+        if prec == "*":
+            prec = str(self._signed(args.pop(0) if args else 0, 32))
+        arg = args.pop(0) if args else 0
+        wordbits = self.elf.wordsize * 8
+        bits = min({"hh": 8, "h": 16, "l": wordbits, "ll": 64, "j": 64,
+                    "z": wordbits, "t": wordbits}.get(length, 32), wordbits)
+        if spec in "di":
+            value, spec = self._signed(arg, bits), "d"
+        elif spec in "ouxX":
+            value = arg & ((1 << bits) - 1)
+            spec = "d" if spec == "u" else spec
+        elif spec == "c":
+            value = chr(arg & 0xff)
+        elif spec == "s":
+            value = self.elf.string(arg)
+            if value is None:
+                value = "<0x{:x}>".format(arg)
+        elif spec == "p":
+            value, spec = "0x{:x}".format(arg), "s"
+        elif spec == "n":
+            return ""
+        else:
+            # floating point values are stored truncated to integers
+            value = float(self._signed(arg, wordbits))
+        conversion = "%" + flags + (width or "")
+        if prec is not None:
+            conversion += "." + prec
+        return (conversion + spec) % value
+
+    def format(self, fmt_addr, args):
+        fmt = self.elf.string(fmt_addr)
+        if fmt is None:
+            return "<unknown format 0x{:x}> {}\n".format(
+                fmt_addr, " ".join("0x{:x}".format(a) for a in args))
+        args = list(args)
+        return CONVERSION.sub(lambda m: self._convert(m, args), fmt)
+
+    def _frame(self):
+        """Decodes the frame at the start of the buffer
+
+        Returns the length of the frame, 0 if incomplete or -1 if invalid.
+        """
+        word = self.elf.wordsize
+        if len(self.buf) < 2:
+            return 0
+        if self.buf[1] == FRAME_DROPPED:
+            if len(self.buf) < 2 + word:
+                return 0
+            dropped, = struct.unpack_from(self.word, self.buf, 2)
+            self.out.write("<{} log messages dropped>\n".format(dropped))
+            return 2 + word
+        if self.buf[1] != FRAME_RECORD:
+            return -1
+        if len(self.buf) < RECORD_HDR_LEN:
+            return 0
+        level, pid, nargs = self.buf[2], self.buf[3], self.buf[4]
+        length = RECORD_HDR_LEN + (nargs + 1) * word
+        if len(self.buf) < length:
+            return 0
+        words = struct.unpack_from(self.elf.endian + self.word[1] * (nargs + 1),
+                                   self.buf, RECORD_HDR_LEN)
+        if self.verbose:
+            self.out.write("[{} {}] ".format(LEVELS.get(level, level),
+                                             "isr" if pid == 0 else pid))
+        self.out.write(self.format(words[0], words[1:]))
+        return length
+
+    def feed(self, data):
+        self.buf += data
+        while self.buf:
+            start = self.buf.find(bytes([FRAME_START]))
+            if start != 0:
+                text = self.buf if start < 0 else self.buf[:start]
+                self.out.write(text.decode("utf-8", errors="replace"))
+                self.buf = self.buf[len(text):]
+                continue
+            length = self._frame()
+            if length == 0:
+                break
+            if length < 0:
+                # not a frame, pass the byte on as text
+                self.out.write(chr(FRAME_START))
+                length = 1
+            self.buf = self.buf[length:]
+        self.out.flush()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("elf", help="ELF file of the application")
+    parser.add_argument("input", nargs="?", default=None,
+                        help="File with the stdio output, read from stdin if "
+                             "not given")
+    parser.add_argument("-v", "--verbose", action="store_true",
+                        help="Prefix messages with log level and PID")
+    args = parser.parse_args()
+
+    decoder = Decoder(Elf(args.elf), sys.stdout, args.verbose)
+    fd = sys.stdin.fileno() if args.input is None else os.open(args.input,
+                                                               os.O_RDONLY)
+    while True:
+        data = os.read(fd, 4096)
+        if not data:
+            break
+        decoder.feed(data)
+
+
+if __name__ == "__main__":
+    main()
@@ -314,6 +314,34 @@ struct mtd_desc {
      */
     int (*power)(mtd_dev_t *dev, enum mtd_power_state power);
 
+    /**
+     * @brief   Write back data buffered by the Memory Technology Device (MTD)
+     *
+     * Only needs to be implemented by drivers that defer writes.
+     *
+     * @param[in] dev       Pointer to the selected driver
+     *
+     * @retval 0 on success
+     * @retval <0 value on error
+     */
+    int (*flush)(mtd_dev_t *dev);
+
+    /**
+     * @brief   Get the address of a page in the CPU address space
+     *
+     * Only implemented by drivers for memory mapped storage, which must map
+     * the whole device linearly, so that the data of the following pages
+     * directly follows @p page.
+     *
+     * @param[in]  dev      Pointer to the selected driver
+     * @param[in]  page     Page number
+     * @param[out] addr     Address of @p page
+     *
+     * @retval 0 on success
+     * @retval <0 value on error
+     */
+    int (*mmap)(mtd_dev_t *dev, uint32_t page, const void **addr);
+
     /**
      * @brief   Properties of the MTD driver
      */
@@ -524,6 +552,44 @@ int mtd_write_sector(mtd_dev_t *mtd, const void *src, uint32_t sector, uint32_t
  */
 int mtd_power(mtd_dev_t *mtd, enum mtd_power_state power);
 
+/**
+ * @brief   Write back all data buffered by a MTD device
+ *
+ * Devices that don't buffer writes (most do not) return immediately.
+ *
+ * @param      mtd   the device to flush
+ *
+ * @retval 0 on success
+ * @retval <0 if an error occurred
+ * @retval -ENODEV if @p mtd is not a valid device
+ * @retval -EIO if I/O error occurred
+ */
+int mtd_flush(mtd_dev_t *mtd);
+
+/**
+ * @brief   Get a pointer to data of a memory mapped MTD device
+ *
+ * Allows to use data stored on e.g. internal flash (execute in place) without
+ * reading it into RAM first. The data may only be read through the pointer,
+ * and changes to the underlying region by writing or erasing it are visible
+ * through the pointer immediately.
+ *
+ * @param      mtd      the device to access
+ * @param[in]  page     Page number of the data
+ * @param[in]  offset   offset from the start of the page (in bytes)
+ * @param[in]  size     number of bytes that will be accessed
+ * @param[out] addr     pointer to the data
+ *
+ * @retval 0 on success
+ * @retval <0 value on error
+ * @retval -ENODEV if @p mtd is not a valid device
+ * @retval -ENOTSUP if @p mtd is not memory mapped
+ * @retval -EOVERFLOW if @p page, @p offset or @p size are not valid, i.e.
+ *                    outside memory
+ */
+int mtd_mmap(mtd_dev_t *mtd, uint32_t page, uint32_t offset, uint32_t size,
+             const void **addr);
+
 /**
  * @brief   Get an MTD device by index
  *
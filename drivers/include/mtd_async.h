@@ -0,0 +1,260 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    drivers_mtd_async  Asynchronous MTD requests
+ * @ingroup     drivers_storage
+ * @brief       Non-blocking, queued access to MTD devices
+ *
+ * All `mtd_read*()`, `mtd_write*()` and `mtd_erase*()` functions block the
+ * calling thread until the device finished the operation. Sector erases of
+ * NOR flash chips take tens of milliseconds, which stalls e.g. a file server
+ * thread for that time.
+ *
+ * This module provides a request queue that is processed by a dedicated
+ * worker thread using the regular MTD driver interface, so it works with
+ * every MTD driver (e.g. `mtd_spi_nor`, `mtd_sdcard` and `mtd_emulated`).
+ * A request is submitted with @ref mtd_async_submit and the submitting
+ * thread continues immediately. Completion is signalled either by posting
+ * an event to an event queue or, if no event is given, by setting
+ * @ref MTD_ASYNC_THREAD_FLAG on the submitting thread
+ * (see @ref mtd_async_wait).
+ *
+ * The worker thread
+ *  - merges queued requests of the same type that access consecutive
+ *    memory of the same device (and, for reads and writes, use consecutive
+ *    buffers) into a single device access. Sector erases of consecutive
+ *    sectors are merged into a single multi sector erase.
+ *  - schedules reads ahead of queued writes and erases, as long as the read
+ *    does not overlap with any of them. This keeps reads responsive while
+ *    long lasting erases are pending.
+ *
+ * ## Usage
+ *
+ * ```
+ * USEMODULE += mtd_async
+ * ```
+ *
+ * ```
+ * mtd_async_req_t req;
+ *
+ * mtd_async_erase_sector(&req, dev, sector, 1);
+ * mtd_async_submit(&req);
+ * ... do something else ...
+ * int res = mtd_async_wait(&req);
+ * ```
+ *
+ * @warning The request and the buffer it refers to must not be modified or go
+ *          out of scope until the request completed.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Interface definitions for asynchronous MTD requests
+ *
+ * @author      agent <agent@local>
+ */
+
+#ifndef MTD_ASYNC_H
+#define MTD_ASYNC_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "event.h"
+#include "mtd.h"
+#include "thread.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup drivers_mtd_async_config     Asynchronous MTD compile configurations
+ * @ingroup config_drivers_storage
+ * @{
+ */
+/**
+ * @brief   Priority of the MTD worker thread
+ */
+#ifndef CONFIG_MTD_ASYNC_THREAD_PRIO
+#define CONFIG_MTD_ASYNC_THREAD_PRIO    (THREAD_PRIORITY_MAIN - 1)
+#endif
+
+/**
+ * @brief   Stack size of the MTD worker thread
+ */
+#ifndef CONFIG_MTD_ASYNC_THREAD_STACKSIZE
+#define CONFIG_MTD_ASYNC_THREAD_STACKSIZE   (THREAD_STACKSIZE_DEFAULT)
+#endif
+
+/**
+ * @brief   Thread flag set on the submitting thread when a request without
+ *          completion event finished
+ */
+#ifndef MTD_ASYNC_THREAD_FLAG
+#define MTD_ASYNC_THREAD_FLAG           (1U << 11)
+#endif
+/** @} */
+
+/**
+ * @brief   Type of an asynchronous MTD request
+ */
+typedef enum {
+    MTD_ASYNC_OP_READ,          /**< read, see @ref mtd_read_page */
+    MTD_ASYNC_OP_WRITE,         /**< write, see @ref mtd_write_page_raw */
+    MTD_ASYNC_OP_ERASE,         /**< erase, see @ref mtd_erase_sector */
+} mtd_async_op_t;
+
+/**
+ * @brief   State of an asynchronous MTD request
+ */
+typedef enum {
+    MTD_ASYNC_STATE_IDLE,       /**< request was not submitted yet */
+    MTD_ASYNC_STATE_QUEUED,     /**< request is waiting to be processed */
+    MTD_ASYNC_STATE_BUSY,       /**< request is being processed */
+    MTD_ASYNC_STATE_DONE,       /**< request completed, result is valid */
+} mtd_async_state_t;
+
+/**
+ * @brief   Asynchronous MTD request
+ */
+typedef struct mtd_async_req {
+    struct mtd_async_req *next; /**< next request in queue (internal) */
+    mtd_dev_t *dev;             /**< device to access */
+    void *buf;                  /**< data buffer of read and write requests */
+    uint32_t page;              /**< first page, or first sector for erase */
+    uint32_t offset;            /**< byte offset into @p page */
+    uint32_t count;             /**< number of bytes, or sectors for erase */
+    event_queue_t *queue;       /**< queue to post @p event to on completion */
+    event_t *event;             /**< completion event, may be NULL */
+    thread_t *owner;            /**< submitting thread (internal) */
+    int res;                    /**< result of the operation */
+    uint8_t op;                 /**< operation, see @ref mtd_async_op_t */
+    volatile uint8_t state;     /**< state, see @ref mtd_async_state_t */
+} mtd_async_req_t;
+
+/**
+ * @brief   Prepare an asynchronous read request
+ *
+ * @param[out] req      request to prepare
+ * @param[in]  dev      device to read from
+ * @param[out] dest     buffer to read into
+ * @param[in]  page     page number to start reading from
+ * @param[in]  offset   offset from the start of the page (in bytes)
+ * @param[in]  count    number of bytes to read
+ */
+static inline void mtd_async_read_page(mtd_async_req_t *req, mtd_dev_t *dev,
+                                       void *dest, uint32_t page,
+                                       uint32_t offset, uint32_t count)
+{
+    *req = (mtd_async_req_t) {
+        .dev = dev, .buf = dest, .page = page, .offset = offset,
+        .count = count, .op = MTD_ASYNC_OP_READ,
+    };
+}
+
+/**
+ * @brief   Prepare an asynchronous write request
+ *
+ * The write has the semantics of @ref mtd_write_page_raw, the target memory
+ * must be erased before.
+ *
+ * @param[out] req      request to prepare
+ * @param[in]  dev      device to write to
+ * @param[in]  src      data to write
+ * @param[in]  page     page number to start writing to
+ * @param[in]  offset   offset from the start of the page (in bytes)
+ * @param[in]  count    number of bytes to write
+ */
+static inline void mtd_async_write_page(mtd_async_req_t *req, mtd_dev_t *dev,
+                                        const void *src, uint32_t page,
+                                        uint32_t offset, uint32_t count)
+{
+    *req = (mtd_async_req_t) {
+        .dev = dev, .buf = (void *)src, .page = page, .offset = offset,
+        .count = count, .op = MTD_ASYNC_OP_WRITE,
+    };
+}
+
+/**
+ * @brief   Prepare an asynchronous sector erase request
+ *
+ * @param[out] req      request to prepare
+ * @param[in]  dev      device to erase
+ * @param[in]  sector   first sector to erase
+ * @param[in]  count    number of sectors to erase
+ */
+static inline void mtd_async_erase_sector(mtd_async_req_t *req, mtd_dev_t *dev,
+                                          uint32_t sector, uint32_t count)
+{
+    *req = (mtd_async_req_t) {
+        .dev = dev, .page = sector, .count = count, .op = MTD_ASYNC_OP_ERASE,
+    };
+}
+
+/**
+ * @brief   Signal completion of a request by posting an event
+ *
+ * If not set, completion is signalled by @ref MTD_ASYNC_THREAD_FLAG.
+ *
+ * @param[in,out] req   prepared request
+ * @param[in]     queue event queue to post @p event to
+ * @param[in]     event event to post on completion
+ */
+static inline void mtd_async_set_event(mtd_async_req_t *req,
+                                       event_queue_t *queue, event_t *event)
+{
+    req->queue = queue;
+    req->event = event;
+}
+
+/**
+ * @brief   Start the MTD worker thread
+ *
+ * Called by auto_init.
+ */
+void mtd_async_init(void);
+
+/**
+ * @brief   Submit a prepared request
+ *
+ * @param[in,out] req   request to submit
+ */
+void mtd_async_submit(mtd_async_req_t *req);
+
+/**
+ * @brief   Check if a request completed
+ *
+ * @param[in]  req      request to check
+ *
+ * @return  true if the request completed and its result is available
+ */
+static inline bool mtd_async_done(const mtd_async_req_t *req)
+{
+    return req->state == MTD_ASYNC_STATE_DONE;
+}
+
+/**
+ * @brief   Block until a request completed
+ *
+ * Must only be called by the thread that submitted @p req and only for
+ * requests without completion event.
+ *
+ * @param[in]  req      request to wait for
+ *
+ * @return  result of the operation, see the respective blocking MTD function
+ */
+int mtd_async_wait(mtd_async_req_t *req);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MTD_ASYNC_H */
+/** @} */
@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    drivers_mtd_cache  MTD write-back sector cache
+ * @ingroup     drivers_storage
+ * @brief       Write-back cache for sectors of a flash device
+ *
+ * This MTD module keeps a configurable number of sectors of a backing MTD
+ * device in RAM. Writes only modify the cached copy of a sector, so multiple
+ * small writes to the same sector are coalesced into a single
+ * erase-and-write cycle of the backing device. Dirty sectors are written
+ * back when they get evicted (least recently used first), when
+ * @ref mtd_flush is called on the cache device or before the device is
+ * powered down.
+ *
+ * As partial writes are handled by the cache, the cache device behaves like
+ * a device with @ref MTD_DRIVER_FLAG_DIRECT_WRITE: an explicit erase is not
+ * required before writing.
+ *
+ * ## Usage
+ *
+ * To use this module include it in your makefile:
+ *
+ * ```
+ * USEMODULE += mtd_cache
+ * ```
+ *
+ * A cache on top of an existing MTD device is defined with
+ *
+ * ```
+ * static uint8_t cache_buf[MTD_CACHE_BUF_SIZE(SECTOR_SIZE)];
+ * mtd_cache_t cache = MTD_CACHE_INIT(MTD_0, cache_buf);
+ *
+ * mtd_dev_t *dev = &cache.mtd;
+ * ```
+ *
+ * where `SECTOR_SIZE` is the sector size of the backing device in bytes.
+ *
+ * The geometry of the cache device is inherited from the backing device on
+ * @ref mtd_init. The backing device is initialized by the cache and must not
+ * be initialized or accessed otherwise.
+ *
+ * @warning Data written to the cache device is only persisted after a call to
+ *          @ref mtd_flush, dirty sectors are lost otherwise. spiffs only
+ *          flushes on `fsync`, FatFs and littlefs2 on `fsync` and `close`.
+ *          No file system flushes on unmount, so call @ref mtd_flush on the
+ *          cache device after unmounting it.
+ *
+ * @{
+ *
+ * @brief       Interface definitions for the MTD sector cache
+ *
+ * @author      agent <agent@local>
+ */
+
+#ifndef MTD_CACHE_H
+#define MTD_CACHE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "mtd.h"
+#include "mutex.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup drivers_mtd_cache_config     MTD sector cache compile configurations
+ * @ingroup config_drivers_storage
+ * @{
+ */
+/**
+ * @brief   Number of sectors held in the cache
+ */
+#ifndef CONFIG_MTD_CACHE_SECTORS
+#define CONFIG_MTD_CACHE_SECTORS    (2U)
+#endif
+/** @} */
+
+/**
+ * @brief   Marker for an unused cache line
+ */
+#define MTD_CACHE_SECTOR_INVALID    UINT32_MAX
+
+/**
+ * @brief   Size of the sector buffer needed for sectors of @p sector_size
+ *          bytes
+ */
+#define MTD_CACHE_BUF_SIZE(sector_size) (CONFIG_MTD_CACHE_SECTORS * (sector_size))
+
+/**
+ * @brief Shortcut macro for initializing the members of an
+ *        @ref mtd_cache_t struct
+ *
+ * @param   _parent     Backing MTD device
+ * @param   _buf        Array of at least @ref MTD_CACHE_BUF_SIZE bytes for
+ *                      the cached sectors
+ */
+#define MTD_CACHE_INIT(_parent, _buf) \
+{ \
+    .mtd = { \
+        .driver = &mtd_cache_driver, \
+    }, \
+    .parent = _parent, \
+    .lock = MUTEX_INIT, \
+    .buf = _buf, \
+    .buf_size = sizeof(_buf), \
+}
+
+/**
+ * @brief   A single cached sector
+ */
+typedef struct {
+    uint32_t sector;    /**< cached sector or @ref MTD_CACHE_SECTOR_INVALID */
+    uint32_t last_use;  /**< access time stamp for LRU eviction */
+    bool dirty;         /**< sector was modified since it was loaded */
+} mtd_cache_line_t;
+
+/**
+ * @brief   Cache statistics
+ */
+typedef struct {
+    uint32_t hits;          /**< accesses served from the cache */
+    uint32_t misses;        /**< accesses that required loading a sector */
+    uint32_t writebacks;    /**< sectors written back to the backing device */
+} mtd_cache_stats_t;
+
+/**
+ * @brief   MTD sector cache device
+ */
+typedef struct {
+    mtd_dev_t mtd;          /**< MTD context */
+    mtd_dev_t *parent;      /**< Backing MTD device */
+    mutex_t lock;           /**< Mutex guarding the cache and backing device */
+    uint8_t *buf;           /**< Sector buffers */
+    size_t buf_size;        /**< Size of @ref mtd_cache_t::buf in bytes */
+    mtd_cache_line_t lines[CONFIG_MTD_CACHE_SECTORS]; /**< Cached sectors */
+    uint32_t clock;         /**< LRU clock */
+    mtd_cache_stats_t stats; /**< Cache statistics */
+} mtd_cache_t;
+
+/**
+ * @brief Sector cache MTD device operations table
+ */
+extern const mtd_desc_t mtd_cache_driver;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MTD_CACHE_H */
+/** @} */
@@ -334,6 +334,7 @@ typedef enum {
     NETDEV_CDC_ECM,
     NETDEV_TINYUSB,
     NETDEV_W5500,
+    NETDEV_CDC_NCM,
     /* add more if needed */
 } netdev_type_t;
 /** @} */
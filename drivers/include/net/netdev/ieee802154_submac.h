@@ -53,6 +53,14 @@ typedef struct {
     int8_t retrans;                     /**< number of frame retransmissions of the last TX */
     bool dispatch;                      /**< whether an event should be dispatched or not */
     netdev_event_t ev;                  /**< event to be dispatched */
+#if CONFIG_IEEE802154_SUBMAC_TX_QUEUE_SIZE || defined(DOXYGEN)
+    /**
+     * @brief   TX events of queued frames that were done before
+     *          netdev_ieee802154_submac_t::ev, oldest first
+     */
+    netdev_event_t tx_ev[CONFIG_IEEE802154_SUBMAC_TX_QUEUE_SIZE];
+    uint8_t tx_ev_num;                  /**< number of events in netdev_ieee802154_submac_t::tx_ev */
+#endif
 } netdev_ieee802154_submac_t;
 
 /**
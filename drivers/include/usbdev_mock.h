@@ -25,8 +25,16 @@ extern "C" {
 
 /**
  * @brief Number of IN and OUT endpoints available in the mock usbdev device
+ *
+ * Endpoint 0 is the control endpoint, the others can be used as bulk or
+ * interrupt endpoints.
+ */
+#define USBDEV_MOCK_NUM_EP      (4)
+
+/**
+ * @brief Buffer size of the endpoints other than endpoint 0
  */
-#define USBDEV_MOCK_NUM_EP      (1)
+#define USBDEV_MOCK_EP_BUF_SIZE (64)
 
 /**
  * @name usbdev mock device endpoint states
@@ -413,4 +413,42 @@ int mtd_power(mtd_dev_t *mtd, enum mtd_power_state power)
     }
 }
 
+int mtd_mmap(mtd_dev_t *mtd, uint32_t page, uint32_t offset, uint32_t size,
+             const void **addr)
+{
+    if (!mtd || !mtd->driver) {
+        return -ENODEV;
+    }
+
+    if (out_of_bounds(mtd, page, offset, size ? size : 1)) {
+        return -EOVERFLOW;
+    }
+
+    if (mtd->driver->mmap == NULL) {
+        return -ENOTSUP;
+    }
+
+    const void *base;
+    int res = mtd->driver->mmap(mtd, page, &base);
+    if (res < 0) {
+        return res;
+    }
+
+    *addr = (const uint8_t *)base + offset;
+    return 0;
+}
+
+int mtd_flush(mtd_dev_t *mtd)
+{
+    if (!mtd || !mtd->driver) {
+        return -ENODEV;
+    }
+
+    if (mtd->driver->flush) {
+        return mtd->driver->flush(mtd);
+    }
+
+    return 0;
+}
+
 /** @} */
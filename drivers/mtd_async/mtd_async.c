@@ -0,0 +1,274 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     drivers_mtd_async
+ * @{
+ *
+ * @file
+ * @brief       Request queue and worker thread for asynchronous MTD access
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "atomic_utils.h"
+#include "event.h"
+#include "mtd.h"
+#include "mtd_async.h"
+#include "mutex.h"
+#include "thread.h"
+#include "thread_flags.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/* wakes up the worker thread */
+#define WORKER_THREAD_FLAG      (1U << 0)
+
+static char _stack[CONFIG_MTD_ASYNC_THREAD_STACKSIZE];
+static kernel_pid_t _pid = KERNEL_PID_UNDEF;
+
+static mutex_t _lock = MUTEX_INIT;
+static mtd_async_req_t *_head;
+static mtd_async_req_t *_tail;
+
+/* start address of a request in bytes, or sectors for erases */
+static uint64_t _start(const mtd_async_req_t *req)
+{
+    if (req->op == MTD_ASYNC_OP_ERASE) {
+        return req->page;
+    }
+    return (uint64_t)req->page * req->dev->page_size + req->offset;
+}
+
+static uint64_t _end(const mtd_async_req_t *req)
+{
+    return _start(req) + req->count;
+}
+
+static bool _overlaps(const mtd_async_req_t *read, const mtd_async_req_t *other)
+{
+    if (read->dev != other->dev) {
+        return false;
+    }
+
+    uint64_t start = _start(other);
+    uint64_t end = _end(other);
+
+    if (other->op == MTD_ASYNC_OP_ERASE) {
+        const uint32_t sector_size = other->dev->pages_per_sector
+                                   * other->dev->page_size;
+        start *= sector_size;
+        end *= sector_size;
+    }
+
+    return (_start(read) < end) && (start < _end(read));
+}
+
+/* can @p next be processed as a continuation of @p req? */
+static bool _mergeable(const mtd_async_req_t *req, const mtd_async_req_t *next)
+{
+    if ((next->dev != req->dev) || (next->op != req->op) ||
+        (_start(next) != _end(req))) {
+        return false;
+    }
+
+    if (req->op == MTD_ASYNC_OP_ERASE) {
+        return true;
+    }
+
+    return (uint8_t *)next->buf == (uint8_t *)req->buf + req->count;
+}
+
+/* Pick the next request to process: the first read that does not overlap a
+ * preceding write or erase, the head of the queue otherwise */
+static mtd_async_req_t *_pick(mtd_async_req_t **prev_out)
+{
+    mtd_async_req_t *prev = NULL;
+
+    for (mtd_async_req_t *req = _head; req; prev = req, req = req->next) {
+        if (req->op != MTD_ASYNC_OP_READ) {
+            continue;
+        }
+
+        bool blocked = false;
+        for (mtd_async_req_t *cur = _head; cur != req; cur = cur->next) {
+            if ((cur->op != MTD_ASYNC_OP_READ) && _overlaps(req, cur)) {
+                blocked = true;
+                break;
+            }
+        }
+        if (!blocked) {
+            *prev_out = prev;
+            return req;
+        }
+    }
+
+    *prev_out = NULL;
+    return _head;
+}
+
+/* Dequeue the next request and all requests merged with it. Returns the
+ * first request, the merged ones are linked via the next pointer. */
+static mtd_async_req_t *_dequeue(uint32_t *count)
+{
+    mtd_async_req_t *prev;
+
+    mutex_lock(&_lock);
+    mtd_async_req_t *first = _pick(&prev);
+    mtd_async_req_t *last = first;
+
+    if (first) {
+        *count = first->count;
+        /* merging is only done at the queue head, so that merged requests
+         * never bypass writes or erases queued before them */
+        if (prev == NULL) {
+            while (last->next && _mergeable(last, last->next)) {
+                last = last->next;
+                *count += last->count;
+            }
+        }
+
+        /* unlink first..last */
+        if (prev) {
+            prev->next = last->next;
+        }
+        else {
+            _head = last->next;
+        }
+        if (_tail == last) {
+            _tail = prev;
+        }
+        last->next = NULL;
+
+        for (mtd_async_req_t *req = first; req; req = req->next) {
+            req->state = MTD_ASYNC_STATE_BUSY;
+        }
+    }
+    mutex_unlock(&_lock);
+
+    return first;
+}
+
+static int _execute(const mtd_async_req_t *req, uint32_t count)
+{
+    DEBUG("mtd_async: op %u page %" PRIu32 " count %" PRIu32 "\n",
+          req->op, req->page, count);
+
+    switch (req->op) {
+    case MTD_ASYNC_OP_READ:
+        return mtd_read_page(req->dev, req->buf, req->page, req->offset, count);
+    case MTD_ASYNC_OP_WRITE:
+        return mtd_write_page_raw(req->dev, req->buf, req->page, req->offset,
+                                  count);
+    case MTD_ASYNC_OP_ERASE:
+        return mtd_erase_sector(req->dev, req->page, count);
+    default:
+        return -EINVAL;
+    }
+}
+
+static void _complete(mtd_async_req_t *req, int res)
+{
+    /* the owner may reuse or free the request as soon as it is done, so
+     * read everything needed for signalling before publishing the state */
+    event_t *event = req->event;
+    event_queue_t *queue = req->queue;
+    thread_t *owner = req->owner;
+
+    req->res = res;
+    atomic_store_u8(&req->state, MTD_ASYNC_STATE_DONE);
+
+    if (event) {
+        event_post(queue, event);
+    }
+    else {
+        thread_flags_set(owner, MTD_ASYNC_THREAD_FLAG);
+    }
+}
+
+static void *_worker(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        uint32_t count;
+        mtd_async_req_t *req = _dequeue(&count);
+
+        if (req == NULL) {
+            thread_flags_wait_any(WORKER_THREAD_FLAG);
+            continue;
+        }
+
+        int res = _execute(req, count);
+
+        while (req) {
+            /* the request may be reused right after completion */
+            mtd_async_req_t *next = req->next;
+            _complete(req, res);
+            req = next;
+        }
+    }
+
+    return NULL;
+}
+
+void mtd_async_init(void)
+{
+    if (_pid != KERNEL_PID_UNDEF) {
+        return;
+    }
+
+    _pid = thread_create(_stack, sizeof(_stack), CONFIG_MTD_ASYNC_THREAD_PRIO,
+                         THREAD_CREATE_STACKTEST, _worker, NULL, "mtd_async");
+    assert(_pid > 0);
+}
+
+void mtd_async_submit(mtd_async_req_t *req)
+{
+    assert(_pid != KERNEL_PID_UNDEF);
+    assert(req->state != MTD_ASYNC_STATE_QUEUED &&
+           req->state != MTD_ASYNC_STATE_BUSY);
+    assert(!req->event || req->queue);
+
+    req->owner = thread_get_active();
+    req->next = NULL;
+    req->state = MTD_ASYNC_STATE_QUEUED;
+
+    mutex_lock(&_lock);
+    if (_tail) {
+        _tail->next = req;
+    }
+    else {
+        _head = req;
+    }
+    _tail = req;
+    mutex_unlock(&_lock);
+
+    thread_flags_set(thread_get(_pid), WORKER_THREAD_FLAG);
+}
+
+int mtd_async_wait(mtd_async_req_t *req)
+{
+    assert(!req->event);
+    assert(req->owner == thread_get_active());
+
+    while (!mtd_async_done(req)) {
+        thread_flags_wait_any(MTD_ASYNC_THREAD_FLAG);
+    }
+
+    return req->res;
+}
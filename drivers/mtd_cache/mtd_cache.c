@@ -0,0 +1,298 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     drivers_mtd_cache
+ * @{
+ *
+ * @file
+ * @brief       Write-back sector cache for MTD devices
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "kernel_defines.h"
+#include "macros/utils.h"
+#include "mtd.h"
+#include "mtd_cache.h"
+#include "mutex.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static uint32_t _sector_size(const mtd_cache_t *cache)
+{
+    return cache->mtd.pages_per_sector * cache->mtd.page_size;
+}
+
+static uint8_t *_line_buf(const mtd_cache_t *cache, const mtd_cache_line_t *line)
+{
+    return cache->buf + (line - cache->lines) * _sector_size(cache);
+}
+
+static mtd_cache_line_t *_find(mtd_cache_t *cache, uint32_t sector)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(cache->lines); i++) {
+        if (cache->lines[i].sector == sector) {
+            return &cache->lines[i];
+        }
+    }
+    return NULL;
+}
+
+static int _writeback(mtd_cache_t *cache, mtd_cache_line_t *line)
+{
+    if (!line->dirty) {
+        return 0;
+    }
+
+    DEBUG("mtd_cache: write back sector %" PRIu32 "\n", line->sector);
+
+    int res = mtd_write_sector(cache->parent, _line_buf(cache, line),
+                               line->sector, 1);
+    if (res < 0) {
+        return res;
+    }
+
+    line->dirty = false;
+    cache->stats.writebacks++;
+    return 0;
+}
+
+/* Get the cache line of @p sector, evicting the least recently used line on a
+ * miss. The sector content is only loaded if @p load is set. */
+static int _get(mtd_cache_t *cache, uint32_t sector, bool load,
+                mtd_cache_line_t **out)
+{
+    mtd_cache_line_t *line = _find(cache, sector);
+
+    if (line) {
+        cache->stats.hits++;
+        goto out;
+    }
+
+    cache->stats.misses++;
+
+    /* pick a free line or the least recently used one */
+    line = &cache->lines[0];
+    for (unsigned i = 0; i < ARRAY_SIZE(cache->lines); i++) {
+        mtd_cache_line_t *cur = &cache->lines[i];
+        if (cur->sector == MTD_CACHE_SECTOR_INVALID) {
+            line = cur;
+            break;
+        }
+        if (cur->last_use < line->last_use) {
+            line = cur;
+        }
+    }
+
+    int res = _writeback(cache, line);
+    if (res < 0) {
+        return res;
+    }
+
+    line->sector = MTD_CACHE_SECTOR_INVALID;
+    if (load) {
+        res = mtd_read_page(cache->parent, _line_buf(cache, line),
+                            sector * cache->mtd.pages_per_sector, 0,
+                            _sector_size(cache));
+        if (res < 0) {
+            return res;
+        }
+    }
+    line->sector = sector;
+
+out:
+    line->last_use = ++cache->clock;
+    *out = line;
+    return 0;
+}
+
+static int _flush_locked(mtd_cache_t *cache)
+{
+    /* write back in ascending sector order to keep accesses sequential */
+    while (1) {
+        mtd_cache_line_t *next = NULL;
+
+        for (unsigned i = 0; i < ARRAY_SIZE(cache->lines); i++) {
+            mtd_cache_line_t *cur = &cache->lines[i];
+            if (cur->dirty && (!next || (cur->sector < next->sector))) {
+                next = cur;
+            }
+        }
+
+        if (!next) {
+            break;
+        }
+
+        int res = _writeback(cache, next);
+        if (res < 0) {
+            return res;
+        }
+    }
+
+    return mtd_flush(cache->parent);
+}
+
+static int _init(mtd_dev_t *mtd)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    mtd_dev_t *backing_mtd = cache->parent;
+
+    int res = mtd_init(backing_mtd);
+    if (res < 0) {
+        return res;
+    }
+
+    /* inherit physical properties, writes of any size are buffered */
+    mtd->sector_count = backing_mtd->sector_count;
+    mtd->pages_per_sector = backing_mtd->pages_per_sector;
+    mtd->page_size = backing_mtd->page_size;
+    mtd->write_size = 1;
+
+    if (cache->buf_size < MTD_CACHE_BUF_SIZE(_sector_size(cache))) {
+        DEBUG("mtd_cache: buffer too small for %u sectors\n",
+              CONFIG_MTD_CACHE_SECTORS);
+        return -ENOMEM;
+    }
+
+    for (unsigned i = 0; i < ARRAY_SIZE(cache->lines); i++) {
+        cache->lines[i].sector = MTD_CACHE_SECTOR_INVALID;
+        cache->lines[i].dirty = false;
+    }
+    cache->clock = 0;
+    memset(&cache->stats, 0, sizeof(cache->stats));
+
+    return 0;
+}
+
+static int _read_page(mtd_dev_t *mtd, void *dest, uint32_t page,
+                      uint32_t offset, uint32_t count)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    const uint32_t sector = page / mtd->pages_per_sector;
+    const uint32_t sector_offset = (page % mtd->pages_per_sector) * mtd->page_size
+                                 + offset;
+    int res = 0;
+
+    /* stay within the sector */
+    count = MIN(count, _sector_size(cache) - sector_offset);
+
+    mutex_lock(&cache->lock);
+    mtd_cache_line_t *line = _find(cache, sector);
+    if (line) {
+        /* reads don't update the LRU state, so streaming reads don't evict
+         * sectors that are being written to */
+        cache->stats.hits++;
+        memcpy(dest, _line_buf(cache, line) + sector_offset, count);
+    }
+    else {
+        res = mtd_read_page(cache->parent, dest, page, offset, count);
+    }
+    mutex_unlock(&cache->lock);
+
+    if (res < 0) {
+        return res;
+    }
+
+    return count;
+}
+
+static int _write_page(mtd_dev_t *mtd, const void *src, uint32_t page,
+                       uint32_t offset, uint32_t count)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    const uint32_t sector = page / mtd->pages_per_sector;
+    const uint32_t sector_offset = (page % mtd->pages_per_sector) * mtd->page_size
+                                 + offset;
+    mtd_cache_line_t *line;
+
+    /* stay within the sector */
+    count = MIN(count, _sector_size(cache) - sector_offset);
+
+    mutex_lock(&cache->lock);
+    /* no need to load the sector if it gets overwritten completely */
+    int res = _get(cache, sector, count < _sector_size(cache), &line);
+    if (res == 0) {
+        memcpy(_line_buf(cache, line) + sector_offset, src, count);
+        line->dirty = true;
+    }
+    mutex_unlock(&cache->lock);
+
+    if (res < 0) {
+        return res;
+    }
+
+    return count;
+}
+
+static int _erase_sector(mtd_dev_t *mtd, uint32_t sector, uint32_t count)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+
+    mutex_lock(&cache->lock);
+    /* pending writes to erased sectors are obsolete */
+    for (unsigned i = 0; i < ARRAY_SIZE(cache->lines); i++) {
+        mtd_cache_line_t *line = &cache->lines[i];
+        if ((line->sector != MTD_CACHE_SECTOR_INVALID) &&
+            (line->sector >= sector) && (line->sector - sector < count)) {
+            line->sector = MTD_CACHE_SECTOR_INVALID;
+            line->dirty = false;
+        }
+    }
+    int res = mtd_erase_sector(cache->parent, sector, count);
+    mutex_unlock(&cache->lock);
+
+    return res;
+}
+
+static int _flush(mtd_dev_t *mtd)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+
+    mutex_lock(&cache->lock);
+    int res = _flush_locked(cache);
+    mutex_unlock(&cache->lock);
+
+    return res;
+}
+
+static int _power(mtd_dev_t *mtd, enum mtd_power_state power)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    int res = 0;
+
+    mutex_lock(&cache->lock);
+    if (power == MTD_POWER_DOWN) {
+        res = _flush_locked(cache);
+    }
+    if (res == 0) {
+        res = mtd_power(cache->parent, power);
+    }
+    mutex_unlock(&cache->lock);
+
+    return res;
+}
+
+const mtd_desc_t mtd_cache_driver = {
+    .init = _init,
+    .read_page = _read_page,
+    .write_page = _write_page,
+    .erase_sector = _erase_sector,
+    .flush = _flush,
+    .power = _power,
+    .flags = MTD_DRIVER_FLAG_DIRECT_WRITE,
+};
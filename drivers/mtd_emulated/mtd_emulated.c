@@ -205,6 +205,14 @@ static int _power(mtd_dev_t *dev, enum mtd_power_state power)
     return 0;
 }
 
+static int _mmap(mtd_dev_t *dev, uint32_t page, const void **addr)
+{
+    mtd_emulated_t *mtd = (mtd_emulated_t *)dev;
+
+    *addr = mtd->memory + page * mtd->base.page_size;
+    return 0;
+}
+
 const mtd_desc_t _mtd_emulated_driver = {
     .init = _init,
     .read = _read,
@@ -213,4 +221,5 @@ const mtd_desc_t _mtd_emulated_driver = {
     .erase = _erase,
     .erase_sector = _erase_sector,
     .power = _power,
+    .mmap = _mmap,
 };
@@ -154,11 +154,24 @@ static int _erase_sector(mtd_dev_t *dev, uint32_t sector, uint32_t count)
     return 0;
 }
 
+static int _mmap(mtd_dev_t *dev, uint32_t page, const void **addr)
+{
+    mtd_flashpage_t *super = container_of(dev, mtd_flashpage_t, base);
+
+    page += super->offset;
+
+    /* flash pages are mapped linearly into the CPU address space */
+    *addr = (uint8_t *)flashpage_addr(page / dev->pages_per_sector)
+          + (page % dev->pages_per_sector) * dev->page_size;
+    return 0;
+}
+
 const mtd_desc_t mtd_flashpage_driver = {
     .init = _init,
     .read_page = _read_page,
     .write_page = _write_page,
     .erase_sector = _erase_sector,
+    .mmap = _mmap,
 };
 
 #if CONFIG_SLOT_AUX_LEN
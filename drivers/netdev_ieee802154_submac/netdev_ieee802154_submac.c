@@ -228,8 +228,19 @@ static void _isr(netdev_t *netdev)
             return;
         }
         netdev_submac->dispatch = false;
+#if CONFIG_IEEE802154_SUBMAC_TX_QUEUE_SIZE
+        netdev_event_t ev = netdev_submac->ev;
+
+        for (unsigned i = 0; i < netdev_submac->tx_ev_num; i++) {
+            netdev->event_callback(netdev, netdev_submac->tx_ev[i]);
+        }
+        netdev_submac->tx_ev_num = 0;
+        /* the callbacks may have marked a transmission in netdev_submac->ev */
+        netdev->event_callback(netdev, ev);
+#else
         /* TODO: Prevent race condition when state goes to PREPARE */
         netdev->event_callback(netdev, netdev_submac->ev);
+#endif
         /* HACK: the TX_STARTED event is used to indicate a frame was
          * sent during the event callback.
          * If no frame was sent go back to RX */
@@ -275,6 +286,20 @@ static void submac_tx_done(ieee802154_submac_t *submac, int status,
     netdev_ieee802154_submac_t *netdev_submac = container_of(submac,
                                                              netdev_ieee802154_submac_t,
                                                              submac);
+
+#if CONFIG_IEEE802154_SUBMAC_TX_QUEUE_SIZE
+    netdev_t *netdev = &netdev_submac->dev.netdev;
+
+    /* With the SubMAC TX queue, the next frame may be done before the event
+     * of the previous one was dispatched. Keep that event for _isr(), which
+     * dispatches it before the new one. */
+    if (netdev_submac->dispatch) {
+        assert(netdev_submac->tx_ev_num < CONFIG_IEEE802154_SUBMAC_TX_QUEUE_SIZE);
+        netdev_submac->tx_ev[netdev_submac->tx_ev_num++] = netdev_submac->ev;
+        netdev->event_callback(netdev, NETDEV_EVENT_ISR);
+    }
+#endif
+
     if (info) {
         netdev_submac->retrans = info->retrans;
     }
@@ -391,6 +416,9 @@ int netdev_ieee802154_submac_init(netdev_ieee802154_submac_t *netdev_submac)
 
     netdev_submac->ack_timer.callback = _ack_timeout;
     netdev_submac->ack_timer.arg = netdev_submac;
+#if CONFIG_IEEE802154_SUBMAC_TX_QUEUE_SIZE
+    netdev_submac->tx_ev_num = 0;
+#endif
 
     return 0;
 }
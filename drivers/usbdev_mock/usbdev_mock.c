@@ -28,6 +28,8 @@
 static usbdev_mock_t _usbdev_mock;
 static uint8_t _in_buf[256];    /* "host" in */
 static uint8_t _out_buf[64];    /* "host" out */
+/* other endpoints, in and out */
+static uint8_t _ep_buf[2][USBDEV_MOCK_NUM_EP - 1][USBDEV_MOCK_EP_BUF_SIZE];
 
 static const usbdev_driver_t testdriver;
 
@@ -84,6 +86,18 @@ usbdev_ep_t *_new_ep(usbdev_t *dev, usb_ep_type_t type, usb_ep_dir_t dir,
             res->buf = _in_buf;
         }
     }
+    else if (buf_len <= USBDEV_MOCK_EP_BUF_SIZE) {
+        usbdev_mock_ep_t *eps = (dir == USB_EP_DIR_OUT) ? testdev->out
+                                                        : testdev->in;
+        for (unsigned i = 1; i < USBDEV_MOCK_NUM_EP; i++) {
+            if (eps[i].ep.dev == NULL) {
+                res = &eps[i];
+                res->ep.num = i;
+                res->buf = _ep_buf[dir == USB_EP_DIR_OUT][i - 1];
+                break;
+            }
+        }
+    }
     if (res) {
         res->state = EP_STATE_READY;
         res->available = 0;
@@ -100,10 +114,17 @@ int _get(usbdev_t *usbdev, usbopt_t opt,
          void *value, size_t max_len)
 {
     (void)usbdev;
-    (void)opt;
-    (void)value;
     (void)max_len;
-    DEBUG("[mock]: Unhandled get call: 0x%x\n", opt);
+
+    switch (opt) {
+    case USBOPT_MAX_SPEED:
+        expect(max_len == sizeof(usb_speed_t));
+        *(usb_speed_t *)value = USB_SPEED_FULL;
+        return sizeof(usb_speed_t);
+    default:
+        DEBUG("[mock]: Unhandled get call: 0x%x\n", opt);
+        break;
+    }
     return -ENOTSUP;
 }
 
@@ -194,8 +215,9 @@ void _ep_esr(usbdev_ep_t *ep)
         memcpy(mock_ep->target_buf, mock_ep->buf, mock_ep->available);
     }
     if (mock_ep->state == EP_STATE_DATA_AVAILABLE) {
-        dev->ep_esr_cb(dev, mock_ep);
+        /* The callback may ready the endpoint again */
         mock_ep->state = EP_STATE_READY;
+        dev->ep_esr_cb(dev, mock_ep);
     }
 }
 
@@ -203,18 +225,27 @@ int _xmit(usbdev_ep_t *ep, uint8_t *buf, size_t len)
 {
     DEBUG("[mock]: Readying EP %u, dir %s, len %" PRIuSIZE "\n",
           ep->num, ep->dir == USB_EP_DIR_OUT ? "out" : "in", len);
+    usbdev_mock_t *usbdev_mock = _ep2dev(ep);
+    usbdev_mock_ep_t *mock_ep = (usbdev_mock_ep_t *)ep;
+
+    mock_ep->target_buf = buf;
     if (ep->num == 0) {
-        usbdev_mock_t *usbdev_mock = _ep2dev(ep);
-        usbdev_mock_ep_t *mock_ep = (usbdev_mock_ep_t *)ep;
-        mock_ep->target_buf = buf;
         if (ep->dir == USB_EP_DIR_IN) {
             memcpy(mock_ep->buf + mock_ep->available, mock_ep->target_buf, len);
             mock_ep->available = len;
         }
         mock_ep->state = EP_STATE_DATA_AVAILABLE;
-
-        usbdev_mock->ready_cb(usbdev_mock, (usbdev_mock_ep_t *)ep, len);
     }
+    else if (ep->dir == USB_EP_DIR_IN) {
+        /* The "host" reads the data from the endpoint buffer */
+        expect(len <= USBDEV_MOCK_EP_BUF_SIZE);
+        memcpy(mock_ep->buf, buf, len);
+        mock_ep->available = len;
+        mock_ep->state = EP_STATE_DATA_AVAILABLE;
+    }
+    /* For OUT endpoints other than 0, the "host" writes to the endpoint
+     * buffer and sets the state to EP_STATE_DATA_AVAILABLE */
+    usbdev_mock->ready_cb(usbdev_mock, mock_ep, len);
     return 0;
 }
 
@@ -70,6 +70,7 @@ PSEUDOMODULES += dhcpv6_client_ia_na
 PSEUDOMODULES += dhcpv6_client_mud_url
 PSEUDOMODULES += dhcpv6_relay
 PSEUDOMODULES += dns_cache
+PSEUDOMODULES += dns_cache_stats
 PSEUDOMODULES += dns_msg
 PSEUDOMODULES += ecc_%
 PSEUDOMODULES += ethos_stdio
@@ -252,9 +253,36 @@ PSEUDOMODULES += gnrc_sixlowpan_nd_border_router
 PSEUDOMODULES += gnrc_sixlowpan_router_default
 PSEUDOMODULES += gnrc_sock_async
 PSEUDOMODULES += gnrc_sock_check_reuse
+## @defgroup net_gnrc_sock_udp_portmap gnrc_sock_udp_portmap: Bitmap of used dynamic UDP ports
+## @ingroup net_gnrc_sock
+## @{
+## @brief Track the dynamic UDP ports used by socks in a bitmap
+##
+## Ephemeral ports are then allocated in constant time regardless of the
+## number of open socks, at the cost of 2 KiB of RAM for the bitmap.
+## Implies `gnrc_sock_check_reuse`.
+PSEUDOMODULES += gnrc_sock_udp_portmap
+## @}
+##
+## @addtogroup net_gnrc_tcp_congure
+## @{
+##
+PSEUDOMODULES += gnrc_tcp_congure
+## @defgroup net_gnrc_tcp_congure_reno gnrc_tcp_congure_reno: TCP Reno
+## @brief  Congestion control for GNRC TCP using the [TCP Reno congestion control algorithm](@ref sys_congure_reno)
+## @{
+PSEUDOMODULES += gnrc_tcp_congure_reno
+## @}
+## @defgroup net_gnrc_tcp_congure_quic gnrc_tcp_congure_quic: QUIC CC
+## @brief  Congestion control for GNRC TCP using the [congestion control algorithm of QUIC](@ref sys_congure_quic)
+## @{
+PSEUDOMODULES += gnrc_tcp_congure_quic
+## @}
+## @}
 PSEUDOMODULES += gnrc_txtsnd
 PSEUDOMODULES += ieee802154_security
 PSEUDOMODULES += ieee802154_submac
+PSEUDOMODULES += ieee802154_submac_stats
 PSEUDOMODULES += ipv4
 PSEUDOMODULES += ipv6
 PSEUDOMODULES += l2filter_blacklist
@@ -469,6 +497,7 @@ PSEUDOMODULES += sock_aux_local
 PSEUDOMODULES += sock_aux_rssi
 PSEUDOMODULES += sock_aux_timestamp
 PSEUDOMODULES += sock_aux_ttl
+PSEUDOMODULES += sock_dns_refresh
 PSEUDOMODULES += sock_dtls
 PSEUDOMODULES += sock_dtls_verify_public_key
 PSEUDOMODULES += sock_ip
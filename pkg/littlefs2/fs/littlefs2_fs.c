@@ -99,9 +99,10 @@ static int _dev_erase(const struct lfs_config *c, lfs_block_t block)
 
 static int _dev_sync(const struct lfs_config *c)
 {
-    (void)c;
+    littlefs2_desc_t *fs = c->context;
+    mtd_dev_t *mtd = fs->dev;
 
-    return 0;
+    return mtd_flush(mtd);
 }
 
 static int prepare(littlefs2_desc_t *fs)
@@ -500,6 +500,55 @@ ssize_t sock_udp_recv_buf_aux(sock_udp_t *sock, void **data, void **buf_ctx,
     return pkt->l4_length;
 }
 
+int sock_udp_recv_many(sock_udp_t *sock, sock_udp_mmsg_t *msgs, unsigned num,
+                       uint32_t timeout)
+{
+    unsigned i = 0;
+
+    assert((sock != NULL) && (msgs != NULL) && (num > 0));
+    while (i < num) {
+        sock_udp_mmsg_t *msg = &msgs[i];
+        void *data, *pkt = NULL;
+        ssize_t res = sock_udp_recv_buf_aux(sock, &data, &pkt, timeout,
+                                            &msg->remote, &msg->aux.rx);
+
+        if ((res == -EPROTO) && (i > 0)) {
+            /* packet from wrong remote was dropped, try next */
+            continue;
+        }
+        if (res < 0) {
+            return (i > 0) ? (int)i : res;
+        }
+        msg->truncated = ((size_t)res > msg->len);
+        if (!msg->truncated) {
+            msg->len = res;
+        }
+        memcpy(msg->data, data, msg->len);
+        openqueue_freePacketBuffer(pkt);
+        /* only wait for the first datagram */
+        timeout = 0;
+        i++;
+    }
+    return i;
+}
+
+int sock_udp_send_many(sock_udp_t *sock, sock_udp_mmsg_t *msgs, unsigned num)
+{
+    ssize_t res = 0;
+    unsigned i;
+
+    assert((msgs != NULL) && (num > 0));
+    for (i = 0; i < num; i++) {
+        res = sock_udp_send_aux(sock, msgs[i].data, msgs[i].len,
+                                (msgs[i].remote.port != 0) ? &msgs[i].remote : NULL,
+                                &msgs[i].aux.tx);
+        if (res < 0) {
+            break;
+        }
+    }
+    return (i > 0) ? (int)i : res;
+}
+
 #ifdef SOCK_HAS_ASYNC
 void sock_udp_set_cb(sock_udp_t *sock, sock_udp_cb_t cb, void *cb_arg)
 {
@@ -75,6 +75,11 @@ extern void dummy_thread_create(void);
 AUTO_INIT(dummy_thread_create,
           AUTO_INIT_PRIO_MOD_DUMMY_THREAD);
 #endif
+#if IS_USED(MODULE_AUTO_INIT_LOG_DEFERRED)
+extern void log_deferred_init(void);
+AUTO_INIT(log_deferred_init,
+          AUTO_INIT_PRIO_MOD_LOG_DEFERRED);
+#endif
 #if IS_USED(MODULE_EVENT_THREAD)
 extern void auto_init_event_thread(void);
 AUTO_INIT(auto_init_event_thread,
@@ -169,6 +174,11 @@ extern void auto_init_devfs(void);
 AUTO_INIT(auto_init_devfs,
           AUTO_INIT_PRIO_MOD_DEVFS);
 #endif
+#if IS_USED(MODULE_MTD_ASYNC)
+extern void mtd_async_init(void);
+AUTO_INIT(mtd_async_init,
+          AUTO_INIT_PRIO_MOD_MTD_ASYNC);
+#endif
 #if IS_USED(MODULE_VFS_AUTO_MOUNT)
 extern void auto_init_vfs(void);
 AUTO_INIT(auto_init_vfs,
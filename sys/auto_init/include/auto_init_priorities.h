@@ -71,6 +71,12 @@ extern "C" {
  */
 #define AUTO_INIT_PRIO_MOD_DUMMY_THREAD                 1070
 #endif
+#ifndef AUTO_INIT_PRIO_MOD_LOG_DEFERRED
+/**
+ * @brief   deferred log output thread priority
+ */
+#define AUTO_INIT_PRIO_MOD_LOG_DEFERRED                 1075
+#endif
 #ifndef AUTO_INIT_PRIO_MOD_EVENT_THREAD
 /**
  * @brief   event thread priority
@@ -191,6 +197,12 @@ extern "C" {
  */
 #define AUTO_INIT_PRIO_MOD_DEVFS                        1250
 #endif
+#ifndef AUTO_INIT_PRIO_MOD_MTD_ASYNC
+/**
+ * @brief   MTD async worker thread priority
+ */
+#define AUTO_INIT_PRIO_MOD_MTD_ASYNC                    1255
+#endif
 #ifndef AUTO_INIT_PRIO_MOD_VFS
 /**
  * @brief   VFS priority
@@ -33,6 +33,10 @@
 #include "usb/usbus/cdc/ecm.h"
 usbus_cdcecm_device_t cdcecm;
 #endif
+#ifdef MODULE_USBUS_CDC_NCM
+#include "usb/usbus/cdc/ncm.h"
+usbus_cdcncm_device_t cdcncm;
+#endif
 #ifdef MODULE_USBUS_CDC_ACM
 #include "usb/usbus/cdc/acm.h"
 #endif
@@ -58,6 +62,11 @@ static usbus_msc_device_t msc;
 #define USBUS_CDC_ECM_EP_OUT_REQUIRED_NUMOF 0
 #endif
 
+#ifndef MODULE_USBUS_CDC_NCM
+#define USBUS_CDC_NCM_EP_IN_REQUIRED_NUMOF  0
+#define USBUS_CDC_NCM_EP_OUT_REQUIRED_NUMOF 0
+#endif
+
 #ifndef MODULE_USBUS_HID
 #define USBUS_HID_EP_IN_REQUIRED_NUMOF      0
 #define USBUS_HID_EP_OUT_REQUIRED_NUMOF     0
@@ -71,12 +80,14 @@ static usbus_msc_device_t msc;
 #define USBUS_EP_IN_REQUIRED_NUMOF  (USBUS_CONTROL_EP_IN_REQUIRED_NUMOF + \
                                      USBUS_CDC_ACM_EP_IN_REQUIRED_NUMOF + \
                                      USBUS_CDC_ECM_EP_IN_REQUIRED_NUMOF + \
+                                     USBUS_CDC_NCM_EP_IN_REQUIRED_NUMOF + \
                                      USBUS_HID_EP_IN_REQUIRED_NUMOF + \
                                      USBUS_MSC_EP_IN_REQUIRED_NUMOF)
 
 #define USBUS_EP_OUT_REQUIRED_NUMOF (USBUS_CONTROL_EP_OUT_REQUIRED_NUMOF + \
                                      USBUS_CDC_ACM_EP_OUT_REQUIRED_NUMOF + \
                                      USBUS_CDC_ECM_EP_OUT_REQUIRED_NUMOF + \
+                                     USBUS_CDC_NCM_EP_OUT_REQUIRED_NUMOF + \
                                      USBUS_HID_EP_OUT_REQUIRED_NUMOF + \
                                      USBUS_MSC_EP_OUT_REQUIRED_NUMOF)
 
@@ -108,6 +119,10 @@ void auto_init_usb(void)
     usbus_cdcecm_init(&usbus, &cdcecm);
 #endif
 
+#ifdef MODULE_USBUS_CDC_NCM
+    usbus_cdcncm_init(&usbus, &cdcncm);
+#endif
+
 #ifdef MODULE_USBUS_DFU
     usbus_dfu_init(&usbus, &dfu, USB_DFU_PROTOCOL_RUNTIME_MODE);
 #endif
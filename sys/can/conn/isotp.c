@@ -218,31 +218,13 @@ static void _rx_timeout(void *arg)
     try_put_msg(conn, &msg);
 }
 
-int conn_can_isotp_recv(conn_can_isotp_t *conn, void *buf, size_t size, uint32_t timeout)
+static int _recv(conn_can_isotp_t *conn, can_rx_data_t **rx, uint32_t timeout)
 {
-    assert(conn != NULL);
-    assert(buf != NULL);
-
-    int ret = 0;
-    gnrc_pktsnip_t *snip;
-
-    if (!conn->bound) {
-        return -ENOTCONN;
-    }
-
 #ifdef MODULE_CONN_CAN_ISOTP_MULTI
     if (conn->rx) {
-        snip = conn->rx->data.iov_base;
-        if (snip->size <= size) {
-            memcpy(buf, snip->data, snip->size);
-            ret = snip->size;
-        }
-        else {
-            ret = -EOVERFLOW;
-        }
-        isotp_free_rx(conn->rx);
+        *rx = conn->rx;
         conn->rx = NULL;
-        return ret;
+        return 0;
     }
 #endif
 
@@ -254,17 +236,16 @@ int conn_can_isotp_recv(conn_can_isotp_t *conn, void *buf, size_t size, uint32_t
     }
 
     msg_t msg;
-    can_rx_data_t *rx;
+    int ret;
 
     while (1) {
         get_msg(conn, &msg);
         switch (msg.type) {
         case CAN_MSG_RX_INDICATION:
             DEBUG("conn_can_isotp_recv: CAN_MSG_RX_INDICATION\n");
-            rx = msg.content.ptr;
-            snip = rx->data.iov_base;
+            *rx = msg.content.ptr;
 #ifdef MODULE_CONN_CAN_ISOTP_MULTI
-            if (rx->arg != conn) {
+            if ((*rx)->arg != conn) {
                 mbox_put(&conn->master->mbox, &msg);
                 break;
             }
@@ -272,15 +253,7 @@ int conn_can_isotp_recv(conn_can_isotp_t *conn, void *buf, size_t size, uint32_t
             if (timeout != 0) {
                 ztimer_remove(ZTIMER_USEC, &timer);
             }
-            if (snip->size <= size) {
-                memcpy(buf, snip->data, snip->size);
-                ret = snip->size;
-            }
-            else {
-                ret = -EOVERFLOW;
-            }
-            isotp_free_rx(rx);
-            return ret;
+            return 0;
         case _TIMEOUT_RX_MSG_TYPE:
             DEBUG("conn_can_isotp_recv: _TIMEOUT_RX_MSG_TYPE\n");
             if (msg.content.value == _TIMEOUT_MSG_VALUE) {
@@ -312,10 +285,73 @@ int conn_can_isotp_recv(conn_can_isotp_t *conn, void *buf, size_t size, uint32_t
             return ret;
         }
     }
+}
+
+int conn_can_isotp_recv(conn_can_isotp_t *conn, void *buf, size_t size, uint32_t timeout)
+{
+    assert(conn != NULL);
+    assert(buf != NULL);
+
+    int ret;
+    can_rx_data_t *rx;
+    gnrc_pktsnip_t *snip;
+
+    if (!conn->bound) {
+        return -ENOTCONN;
+    }
+
+    ret = _recv(conn, &rx, timeout);
+    if (ret < 0) {
+        return ret;
+    }
+
+    snip = rx->data.iov_base;
+    if (snip->size <= size) {
+        memcpy(buf, snip->data, snip->size);
+        ret = snip->size;
+    }
+    else {
+        ret = -EOVERFLOW;
+    }
+    isotp_free_rx(rx);
 
     return ret;
 }
 
+int conn_can_isotp_recv_buf(conn_can_isotp_t *conn, void **data, void **buf_ctx,
+                            uint32_t timeout)
+{
+    assert(conn != NULL);
+    assert(data != NULL);
+    assert(buf_ctx != NULL);
+
+    int ret;
+    can_rx_data_t *rx;
+    gnrc_pktsnip_t *snip;
+
+    if (*buf_ctx != NULL) {
+        isotp_free_rx(*buf_ctx);
+        *buf_ctx = NULL;
+        *data = NULL;
+        return 0;
+    }
+
+    if (!conn->bound) {
+        return -ENOTCONN;
+    }
+
+    ret = _recv(conn, &rx, timeout);
+    if (ret < 0) {
+        return ret;
+    }
+
+    snip = rx->data.iov_base;
+    *data = snip->data;
+    *buf_ctx = rx;
+
+    return snip->size;
+}
+
 int conn_can_isotp_close(conn_can_isotp_t *conn)
 {
     assert(conn != NULL);
@@ -18,6 +18,7 @@
 
 #include <assert.h>
 #include <errno.h>
+#include <stdbool.h>
 #include <string.h>
 
 #include "can/common.h"
@@ -91,6 +92,7 @@ static mutex_t lock = MUTEX_INIT;
 static void _rx_timeout(void *arg);
 static int _isotp_send_fc(struct isotp *isotp, int ae, uint8_t status);
 static int _isotp_tx_send(struct isotp *isotp, struct can_frame *frame);
+static void _isotp_send_cfs(struct isotp *isotp);
 
 static int _send_msg(msg_t *msg, can_reg_entry_t *entry)
 {
@@ -137,10 +139,32 @@ static int _isotp_dispatch_rx(struct isotp *isotp)
     return ret;
 }
 
+/* take handle out of the frames waiting for TX confirmation */
+static bool _isotp_tx_handle_take(struct isotp *isotp, int handle)
+{
+    for (unsigned i = 0; i < isotp->tx.pending; i++) {
+        if (isotp->tx_handles[i] == handle) {
+            isotp->tx_handles[i] = isotp->tx_handles[--isotp->tx.pending];
+            return true;
+        }
+    }
+    return false;
+}
+
+static void _isotp_tx_abort(struct isotp *isotp)
+{
+    while (isotp->tx.pending) {
+        raw_can_abort(isotp->entry.ifnum, isotp->tx_handles[--isotp->tx.pending]);
+    }
+}
+
 static int _isotp_dispatch_tx(struct isotp *isotp, int err)
 {
     msg_t msg;
 
+    /* frames still waiting for TX confirmation when the transfer failed */
+    _isotp_tx_abort(isotp);
+
     gnrc_pktbuf_release(isotp->tx.snip);
     isotp->tx.snip = NULL;
 
@@ -228,8 +252,19 @@ static int _isotp_rcv_fc(struct isotp *isotp, struct can_frame *frame, int ae)
     case ISOTP_FC_CTS:
         isotp->tx_wft = 0;
         isotp->tx.bs = 0;
-        isotp->tx.state = ISOTP_SENDING_NEXT_CF;
-        ztimer_set(ZTIMER_USEC, &isotp->tx_timer, isotp->tx_gap);
+        if (isotp->tx_gap && isotp->tx.pending) {
+            /* the FC arrived before the TX confirmation of the last block,
+             * keep N_As running, STmin starts with the confirmation */
+            isotp->tx.state = ISOTP_SENDING_CF;
+            ztimer_set(ZTIMER_USEC, &isotp->tx_timer, CAN_ISOTP_TIMEOUT_N_As);
+        }
+        else if (isotp->tx_gap) {
+            isotp->tx.state = ISOTP_SENDING_NEXT_CF;
+            ztimer_set(ZTIMER_USEC, &isotp->tx_timer, isotp->tx_gap);
+        }
+        else {
+            _isotp_send_cfs(isotp);
+        }
         break;
 
     case ISOTP_FC_WT:
@@ -270,10 +305,8 @@ static int _isotp_rcv_sf(struct isotp *isotp, struct can_frame *frame, int ae)
     }
     isotp->rx.snip = snip;
 
-    isotp->rx.idx = 0;
-    for (size_t i = SF_PCI_SZ + ae; i < isotp->rx.snip->size + ae + SF_PCI_SZ; i++) {
-        ((uint8_t *)isotp->rx.snip->data)[isotp->rx.idx++] = frame->data[i];
-    }
+    memcpy(snip->data, &frame->data[SF_PCI_SZ + ae], len);
+    isotp->rx.idx = len;
 
     return _isotp_dispatch_rx(isotp);
 }
@@ -306,10 +339,10 @@ static int _isotp_rcv_ff(struct isotp *isotp, struct can_frame *frame, int ae)
     }
     isotp->rx.snip = snip;
 
-    isotp->rx.idx = 0;
-    for (int i = ae + FF_PCI_SZ; i < frame->can_dlc; i++) {
-        ((uint8_t *)isotp->rx.snip->data)[isotp->rx.idx++] = frame->data[i];
-    }
+    /* the data is reassembled in place, in the buffer handed to the upper
+     * layer */
+    isotp->rx.idx = MIN(len, MAX(frame->can_dlc - (ae + FF_PCI_SZ), 0));
+    memcpy(snip->data, &frame->data[ae + FF_PCI_SZ], isotp->rx.idx);
 
     if (IS_ACTIVE(ENABLE_DEBUG)) {
         DEBUG("_isotp_rcv_ff: rx.buf=");
@@ -336,9 +369,11 @@ static int _isotp_rcv_cf(struct isotp *isotp, struct can_frame *frame, int ae)
 {
     DEBUG("_isotp_rcv_cf: state=%d\n", isotp->rx.state);
 
-    if (isotp->rx.state != ISOTP_WAIT_CF) {
+    /* the sender may react to the FC before its TX confirmation reached us */
+    if ((isotp->rx.state != ISOTP_WAIT_CF) && (isotp->rx.state != ISOTP_SENDING_FC)) {
         return 1;
     }
+    isotp->rx.state = ISOTP_WAIT_CF;
 
     ztimer_remove(ZTIMER_USEC, &isotp->rx_timer);
 
@@ -352,12 +387,11 @@ static int _isotp_rcv_cf(struct isotp *isotp, struct can_frame *frame, int ae)
     isotp->rx.sn++;
     isotp->rx.sn %= 16;
 
-    for (int i = ae + N_PCI_SZ; i < frame->can_dlc; i++) {
-        ((uint8_t *)isotp->rx.snip->data)[isotp->rx.idx++] = frame->data[i];
-        if (isotp->rx.idx >= isotp->rx.snip->size) {
-            break;
-        }
-    }
+    size_t num_bytes = MIN(isotp->rx.snip->size - isotp->rx.idx,
+                           (size_t)MAX(frame->can_dlc - (ae + N_PCI_SZ), 0));
+    memcpy((uint8_t *)isotp->rx.snip->data + isotp->rx.idx,
+           &frame->data[ae + N_PCI_SZ], num_bytes);
+    isotp->rx.idx += num_bytes;
 
     if (IS_ACTIVE(ENABLE_DEBUG)) {
         DEBUG("_isotp_rcv_cf: rx.buf=");
@@ -517,11 +551,54 @@ static void _isotp_fill_dataframe(struct isotp *isotp, struct can_frame *frame,
 
 }
 
-static void _isotp_tx_timeout_task(struct isotp *isotp)
+/* Send the next consecutive frames. With STmin = 0, up to
+ * CAN_ISOTP_TX_WINDOW frames are passed to the device without waiting for
+ * the TX confirmation of the previous one. If the window is full, e.g. when
+ * the FC arrives before the TX confirmation of the previous block, sending
+ * resumes with the next TX confirmation */
+static void _isotp_send_cfs(struct isotp *isotp)
 {
     int ae = (isotp->opt.flags & CAN_ISOTP_EXTEND_ADDR) ? 1 : 0;
     struct can_frame frame;
 
+    isotp->tx.state = ISOTP_SENDING_CF;
+    if (isotp->tx.pending >= CAN_ISOTP_TX_WINDOW) {
+        /* N_As of the frames in the window */
+        ztimer_set(ZTIMER_USEC, &isotp->tx_timer, CAN_ISOTP_TIMEOUT_N_As);
+        return;
+    }
+
+    while ((isotp->tx.pending < CAN_ISOTP_TX_WINDOW) &&
+           (isotp->tx.idx < isotp->tx.snip->size)) {
+        _isotp_fill_dataframe(isotp, &frame, ae);
+        frame.data[ae] = N_PCI_CF | isotp->tx.sn++;
+        isotp->tx.sn %= 16;
+        isotp->tx.bs++;
+
+        _isotp_tx_send(isotp, &frame);
+        if (isotp->tx.state != ISOTP_SENDING_CF) {
+            /* sending failed */
+            return;
+        }
+
+        if ((isotp->tx.idx < isotp->tx.snip->size) &&
+                isotp->txfc.bs && (isotp->tx.bs >= isotp->txfc.bs)) {
+            /* end of the block, the FC may arrive before the TX
+             * confirmation of the last frames */
+            isotp->tx.state = ISOTP_WAIT_FC;
+            ztimer_set(ZTIMER_USEC, &isotp->tx_timer, CAN_ISOTP_TIMEOUT_N_Bs);
+            return;
+        }
+
+        if (isotp->tx_gap) {
+            /* the next frame follows the TX confirmation and STmin */
+            return;
+        }
+    }
+}
+
+static void _isotp_tx_timeout_task(struct isotp *isotp)
+{
     DEBUG("_isotp_tx_timeout_task: state=%d\n", isotp->tx.state);
 
     switch (isotp->tx.state) {
@@ -533,13 +610,7 @@ static void _isotp_tx_timeout_task(struct isotp *isotp)
 
     case ISOTP_SENDING_NEXT_CF:
         DEBUG("_isotp_tx_timeout_task: sending next CF\n");
-        _isotp_fill_dataframe(isotp, &frame, ae);
-        frame.data[ae] = N_PCI_CF | isotp->tx.sn++;
-        isotp->tx.sn %= 16;
-        isotp->tx.bs++;
-
-        isotp->tx.state = ISOTP_SENDING_CF;
-        _isotp_tx_send(isotp, &frame);
+        _isotp_send_cfs(isotp);
         break;
 
     case ISOTP_SENDING_CF:
@@ -547,7 +618,6 @@ static void _isotp_tx_timeout_task(struct isotp *isotp)
     case ISOTP_SENDING_SF:
         DEBUG("_isotp_tx_timeout_task: timeout on DLL\n");
         isotp->tx.state = ISOTP_IDLE;
-        raw_can_abort(isotp->entry.ifnum, isotp->tx.tx_handle);
         _isotp_dispatch_tx(isotp, ETIMEDOUT);
         break;
     }
@@ -555,13 +625,11 @@ static void _isotp_tx_timeout_task(struct isotp *isotp)
 
 static void _isotp_tx_tx_conf(struct isotp *isotp)
 {
-    ztimer_remove(ZTIMER_USEC, &isotp->tx_timer);
-    isotp->tx.tx_handle = 0;
-
     DEBUG("_isotp_tx_tx_conf: state=%d\n", isotp->tx.state);
 
     switch (isotp->tx.state) {
     case ISOTP_SENDING_SF:
+        ztimer_remove(ZTIMER_USEC, &isotp->tx_timer);
         isotp->tx.state = ISOTP_IDLE;
         _isotp_dispatch_tx(isotp, 0);
         break;
@@ -572,22 +640,34 @@ static void _isotp_tx_tx_conf(struct isotp *isotp)
         break;
 
     case ISOTP_SENDING_CF:
+        if (isotp->tx.pending) {
+            /* restart N_As for the frames still waiting for confirmation */
+            ztimer_set(ZTIMER_USEC, &isotp->tx_timer, CAN_ISOTP_TIMEOUT_N_As);
+        }
+        else {
+            ztimer_remove(ZTIMER_USEC, &isotp->tx_timer);
+        }
+
         if (isotp->tx.idx >= isotp->tx.snip->size) {
-            /* Finished */
-            isotp->tx.state = ISOTP_IDLE;
-            _isotp_dispatch_tx(isotp, 0);
+            if (!isotp->tx.pending) {
+                /* Finished */
+                isotp->tx.state = ISOTP_IDLE;
+                _isotp_dispatch_tx(isotp, 0);
+            }
             break;
         }
 
-        if (isotp->txfc.bs && (isotp->tx.bs >= isotp->txfc.bs)) {
-            /* wait for FC */
-            isotp->tx.state = ISOTP_WAIT_FC;
-            ztimer_set(ZTIMER_USEC, &isotp->tx_timer, CAN_ISOTP_TIMEOUT_N_Bs);
+        if (isotp->tx_gap) {
+            /* tx_timer is either N_As or STmin, so the STmin timer only
+             * starts when no frame is waiting for confirmation */
+            if (!isotp->tx.pending) {
+                isotp->tx.state = ISOTP_SENDING_NEXT_CF;
+                ztimer_set(ZTIMER_USEC, &isotp->tx_timer, isotp->tx_gap);
+            }
             break;
         }
 
-        isotp->tx.state = ISOTP_SENDING_NEXT_CF;
-        ztimer_set(ZTIMER_USEC, &isotp->tx_timer, isotp->tx_gap);
+        _isotp_send_cfs(isotp);
         break;
     }
 }
@@ -611,11 +691,11 @@ static void _isotp_rx_timeout_task(struct isotp *isotp)
 
 static void _isotp_rx_tx_conf(struct isotp *isotp)
 {
-    ztimer_remove(ZTIMER_USEC, &isotp->rx_timer);
     isotp->rx.tx_handle = 0;
 
     DEBUG("_isotp_rx_tx_conf: state=%d\n", isotp->rx.state);
 
+    /* CFs may already be received, then N_Cr is running */
     switch (isotp->rx.state) {
     case ISOTP_SENDING_FC:
         isotp->rx.state = ISOTP_WAIT_CF;
@@ -626,6 +706,8 @@ static void _isotp_rx_tx_conf(struct isotp *isotp)
 
 static int _isotp_tx_send(struct isotp *isotp, struct can_frame *frame)
 {
+    assert(isotp->tx.pending < CAN_ISOTP_TX_WINDOW);
+
     ztimer_set(ZTIMER_USEC, &isotp->tx_timer, CAN_ISOTP_TIMEOUT_N_As);
     isotp->tx.tx_handle = raw_can_send(isotp->entry.ifnum, frame, isotp_pid);
     DEBUG("isotp_send: FF/SF/CF sent handle=%d\n", isotp->tx.tx_handle);
@@ -634,6 +716,7 @@ static int _isotp_tx_send(struct isotp *isotp, struct can_frame *frame)
         isotp->tx.state = ISOTP_IDLE;
         return _isotp_dispatch_tx(isotp, isotp->tx.tx_handle);
     }
+    isotp->tx_handles[isotp->tx.pending++] = isotp->tx.tx_handle;
 
     return 0;
 }
@@ -694,7 +777,7 @@ static void *_isotp_thread(void *args)
             DEBUG("_isotp_thread: CAN_MSG_TX_CONFIRMATION, handle=%d\n", (int)msg.content.value);
             mutex_lock(&lock);
             LL_FOREACH(isotp_list, isotp) {
-                if (isotp->tx.tx_handle == (int)msg.content.value) {
+                if (_isotp_tx_handle_take(isotp, (int)msg.content.value)) {
                     mutex_unlock(&lock);
                     _isotp_tx_tx_conf(isotp);
                     break;
@@ -884,6 +967,7 @@ int isotp_release(struct isotp *isotp)
     LL_DELETE(isotp_list, isotp);
     mutex_unlock(&lock);
 
+    _isotp_tx_abort(isotp);
     if (isotp->tx.snip) {
         DEBUG("isotp_release: freeing rx buf\n");
         gnrc_pktbuf_release(isotp->tx.snip);
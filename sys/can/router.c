@@ -17,6 +17,7 @@
  * @}
  */
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <errno.h>
 #include <inttypes.h>
@@ -46,14 +47,32 @@ typedef struct filter_el {
     void *data;              /**< Private data */
 } filter_el_t;
 
+#ifndef CAN_ROUTER_MAX_FILTER
+#define CAN_ROUTER_MAX_FILTER   64
+#endif
+
+/**
+ * Number of hash buckets per interface for filters matching a single CAN ID,
+ * must be a power of 2
+ */
+#ifndef CAN_ROUTER_HASH_SIZE
+#define CAN_ROUTER_HASH_SIZE    16
+#endif
+
+static_assert((CAN_ROUTER_HASH_SIZE & (CAN_ROUTER_HASH_SIZE - 1)) == 0,
+              "CAN_ROUTER_HASH_SIZE must be a power of 2");
+
 /**
- * This table contains @p CAN_ROUTER_APP_MAX lists of CAN IDs per interface
+ * This table contains the lists of filters with a mask not covering all
+ * CAN ID bits, per interface
  */
 static can_reg_entry_t *table[CAN_DLL_NUMOF];
 
-#ifndef CAN_ROUTER_MAX_FILTER
-#define CAN_ROUTER_MAX_FILTER   64
-#endif
+/**
+ * This table contains the filters with a mask covering all CAN ID bits,
+ * hashed by CAN ID, per interface
+ */
+static can_reg_entry_t *hash_table[CAN_DLL_NUMOF][CAN_ROUTER_HASH_SIZE];
 
 static filter_el_t _filter_buf[CAN_ROUTER_MAX_FILTER];
 static memarray_t _filter_array;
@@ -65,17 +84,46 @@ static void _insert_to_list(can_reg_entry_t **list, filter_el_t *el);
 static filter_el_t *_find_filter_el(can_reg_entry_t *list, can_reg_entry_t *entry, canid_t can_id, canid_t mask, void *data);
 static int _filter_is_used(unsigned int ifnum, canid_t can_id, canid_t mask);
 
+/* a frame matching such a filter has the filter's CAN ID */
+static inline bool _is_single_id(canid_t mask)
+{
+    return (mask & CAN_EFF_MASK) == CAN_EFF_MASK;
+}
+
+static inline unsigned _hash(canid_t can_id)
+{
+    can_id &= CAN_EFF_MASK;
+    return (can_id ^ (can_id >> 11) ^ (can_id >> 22)) & (CAN_ROUTER_HASH_SIZE - 1);
+}
+
+/* list a filter is kept in */
+static can_reg_entry_t **_get_list(unsigned int ifnum, canid_t can_id, canid_t mask)
+{
+    if (_is_single_id(mask)) {
+        return &hash_table[ifnum][_hash(can_id)];
+    }
+    return &table[ifnum];
+}
+
 #if IS_ACTIVE(ENABLE_DEBUG)
+static void _print_list(can_reg_entry_t *list)
+{
+    can_reg_entry_t *entry;
+    LL_FOREACH(list, entry) {
+        filter_el_t *el = container_of(entry, filter_el_t, entry);
+        DEBUG("App pid=%" PRIkernel_pid ", el=%p, can_id=0x%" PRIx32 ", mask=0x%" PRIx32 ", data=%p\n",
+              el->entry.target.pid, (void*)el, el->can_id, el->mask, el->data);
+    }
+}
+
 static void _print_filters(void)
 {
     for (int i = 0; i < (int)CAN_DLL_NUMOF; i++) {
         DEBUG("--- Ifnum: %d ---\n", i);
-        can_reg_entry_t *entry;
-        LL_FOREACH(table[i], entry) {
-            filter_el_t *el = container_of(entry, filter_el_t, entry);
-            DEBUG("App pid=%" PRIkernel_pid ", el=%p, can_id=0x%" PRIx32 ", mask=0x%" PRIx32 ", data=%p\n",
-                  el->entry.target.pid, (void*)el, el->can_id, el->mask, el->data);
+        for (unsigned j = 0; j < CAN_ROUTER_HASH_SIZE; j++) {
+            _print_list(hash_table[i][j]);
         }
+        _print_list(table[i]);
     }
 }
 #define PRINT_FILTERS() _print_filters()
@@ -182,7 +230,7 @@ static filter_el_t *_find_filter_el(can_reg_entry_t *list, can_reg_entry_t *entr
 
 static int _filter_is_used(unsigned int ifnum, canid_t can_id, canid_t mask)
 {
-    filter_el_t *el = container_of(table[ifnum], filter_el_t, entry);
+    filter_el_t *el = container_of(*_get_list(ifnum, can_id, mask), filter_el_t, entry);
     if (!el) {
         DEBUG("_filter_is_used: empty list\n");
         return 0;
@@ -243,7 +291,7 @@ int can_router_register(can_reg_entry_t *entry, canid_t can_id, canid_t mask, vo
     filter->entry.target.pid = entry->target.pid;
 #endif
     filter->entry.ifnum = entry->ifnum;
-    _insert_to_list(&table[entry->ifnum], filter);
+    _insert_to_list(_get_list(entry->ifnum, can_id, mask), filter);
     mutex_unlock(&lock);
 
     PRINT_FILTERS();
@@ -255,6 +303,7 @@ int can_router_register(can_reg_entry_t *entry, canid_t can_id, canid_t mask, vo
 int can_router_unregister(can_reg_entry_t *entry, canid_t can_id,
                           canid_t mask, void *param)
 {
+    can_reg_entry_t **list;
     filter_el_t *el;
     int ret;
 
@@ -271,12 +320,13 @@ int can_router_unregister(can_reg_entry_t *entry, canid_t can_id,
 #endif
 
     mutex_lock(&lock);
-    el = _find_filter_el(table[entry->ifnum], entry, can_id, mask, param);
+    list = _get_list(entry->ifnum, can_id, mask);
+    el = _find_filter_el(*list, entry, can_id, mask, param);
     if (!el) {
         mutex_unlock(&lock);
         return -EINVAL;
     }
-    LL_DELETE(table[entry->ifnum], &el->entry);
+    LL_DELETE(*list, &el->entry);
     _free_filter_el(el);
     ret = _filter_is_used(entry->ifnum, can_id, mask);
     mutex_unlock(&lock);
@@ -303,26 +353,15 @@ static int _send_msg(msg_t *msg, can_reg_entry_t *entry)
 #endif
 }
 
-/* send received pkt to all interested users */
-int can_router_dispatch_rx_indic(can_pkt_t *pkt)
+/* send received pkt to the interested users in list, returns the number of
+ * messages sent or -EBUSY */
+static int _dispatch_list(can_pkt_t *pkt, can_reg_entry_t *list, msg_t *msg)
 {
-    if (!pkt) {
-        DEBUG("can_router_dispatch_rx_indic: invalid pkt\n");
-        return -EINVAL;
-    }
-
-    int res = 0;
-    msg_t msg;
-    msg.type = CAN_MSG_RX_INDICATION;
-    int msg_cnt = 0;
-
-    DEBUG("can_router_dispatch_rx_indic: pkt=%p, ifnum=%d, can_id=%" PRIx32 "\n",
-          (void *)pkt, pkt->entry.ifnum, pkt->frame.can_id);
-
-    mutex_lock(&lock);
     can_reg_entry_t *entry = NULL;
     filter_el_t *el;
-    LL_FOREACH(table[pkt->entry.ifnum], entry) {
+    int msg_cnt = 0;
+
+    LL_FOREACH(list, entry) {
         el = container_of(entry, filter_el_t, entry);
         if ((pkt->frame.can_id & el->mask) == el->can_id) {
             DEBUG("can_router_dispatch_rx_indic: found el=%p, data=%p\n",
@@ -330,25 +369,53 @@ int can_router_dispatch_rx_indic(can_pkt_t *pkt)
             DEBUG("can_router_dispatch_rx_indic: rx_ind to pid: %"
                   PRIkernel_pid "\n", entry->target.pid);
             atomic_fetch_add(&pkt->ref_count, 1);
-            msg.content.ptr = can_pkt_alloc_rx_data(&pkt->frame, sizeof(pkt->frame), el->data);
-
-            if (IS_ACTIVE(ENABLE_DEBUG)) {
-                msg_cnt++;
-            }
+            msg->content.ptr = can_pkt_alloc_rx_data(&pkt->frame, sizeof(pkt->frame), el->data);
 
-            if (!msg.content.ptr || (_send_msg(&msg, entry) <= 0)) {
-                can_pkt_free_rx_data(msg.content.ptr);
+            if (!msg->content.ptr || (_send_msg(msg, entry) <= 0)) {
+                can_pkt_free_rx_data(msg->content.ptr);
                 atomic_fetch_sub(&pkt->ref_count, 1);
                 DEBUG("can_router_dispatch_rx_indic: failed to send msg to "
                       "pid=%" PRIkernel_pid "\n", entry->target.pid);
-                res = -EBUSY;
-                break;
+                return -EBUSY;
             }
+            msg_cnt++;
         }
     }
+
+    return msg_cnt;
+}
+
+/* send received pkt to all interested users */
+int can_router_dispatch_rx_indic(can_pkt_t *pkt)
+{
+    if (!pkt) {
+        DEBUG("can_router_dispatch_rx_indic: invalid pkt\n");
+        return -EINVAL;
+    }
+
+    int res;
+    msg_t msg;
+    msg.type = CAN_MSG_RX_INDICATION;
+    int msg_cnt = 0;
+
+    DEBUG("can_router_dispatch_rx_indic: pkt=%p, ifnum=%d, can_id=%" PRIx32 "\n",
+          (void *)pkt, pkt->entry.ifnum, pkt->frame.can_id);
+
+    mutex_lock(&lock);
+    /* filters for a single CAN ID, then filters with a mask */
+    res = _dispatch_list(pkt, hash_table[pkt->entry.ifnum][_hash(pkt->frame.can_id)], &msg);
+    if (res >= 0) {
+        msg_cnt = res;
+        res = _dispatch_list(pkt, table[pkt->entry.ifnum], &msg);
+    }
+    if (res >= 0) {
+        msg_cnt += res;
+        res = 0;
+    }
     mutex_unlock(&lock);
 
     DEBUG("can_router_dispatch_rx: msg send to %d threads\n", msg_cnt);
+    (void)msg_cnt;
 
     if (atomic_load(&pkt->ref_count) == 0) {
         can_pkt_free(pkt);
@@ -19,6 +19,7 @@
  * @}
  */
 
+#include <assert.h>
 #include <stdlib.h>
 #include <stdint.h>
 #include <string.h>
@@ -43,111 +44,238 @@ static const uint32_t constant[] = {0x61707865,
 /* Padding to add to the poly1305 authentication tag */
 static const uint8_t padding[15] = {0};
 
-/* Single round */
-static void _r(uint32_t *a, uint32_t *b, uint32_t *d, unsigned c)
+#define ROTL32(v, c) (((v) << (c)) | ((v) >> (32 - (c))))
+
+#define QUARTERROUND(a, b, c, d)                \
+    do {                                        \
+        a += b; d = ROTL32(d ^ a, 16);          \
+        c += d; b = ROTL32(b ^ c, 12);          \
+        a += b; d = ROTL32(d ^ a,  8);          \
+        c += d; b = ROTL32(b ^ c,  7);          \
+    } while (0)
+
+#define DOUBLEROUND(x)                                  \
+    do {                                                \
+        QUARTERROUND(x[0], x[4], x[ 8], x[12]);         \
+        QUARTERROUND(x[1], x[5], x[ 9], x[13]);         \
+        QUARTERROUND(x[2], x[6], x[10], x[14]);         \
+        QUARTERROUND(x[3], x[7], x[11], x[15]);         \
+        QUARTERROUND(x[0], x[5], x[10], x[15]);         \
+        QUARTERROUND(x[1], x[6], x[11], x[12]);         \
+        QUARTERROUND(x[2], x[7], x[ 8], x[13]);         \
+        QUARTERROUND(x[3], x[4], x[ 9], x[14]);         \
+    } while (0)
+
+/* Index of the block counter in the ChaCha20 input block */
+#define CTR_IDX     (12U)
+
+/* Compute a single 64 byte keystream block. The fully unrolled rounds on
+ * local copies keep the state in registers on 32 bit cores with 16 or more
+ * general purpose registers (e.g. Cortex-M) */
+static void _block(const uint32_t *input, uint32_t *out)
 {
-    *a += *b;
-    uint32_t tmp = *a ^ *d;
-    *d = (tmp << c) | (tmp >> (32 - c));
+    uint32_t x[16];
+
+    memcpy(x, input, sizeof(x));
+    for (unsigned i = 0; i < 10; i++) {
+        DOUBLEROUND(x);
+    }
+    for (unsigned i = 0; i < 16; i++) {
+        out[i] = x[i] + input[i];
+    }
 }
 
-static void _add_initial(chacha20poly1305_ctx_t *ctx, const uint8_t *key,
-                         const uint8_t *nonce, uint32_t blk)
+#if defined(__AVX2__)
+#  define CHACHA20_LANES    (8U)
+#elif defined(__SSE2__) || defined(__ARM_NEON)
+#  define CHACHA20_LANES    (4U)
+#endif
+
+#ifdef CHACHA20_LANES
+typedef uint32_t _lanes_t __attribute__((vector_size(4 * CHACHA20_LANES)));
+
+/* Compute CHACHA20_LANES consecutive keystream blocks in parallel, each
+ * vector lane holding the same state word of a different block */
+static void _block_multi(const uint32_t *input, uint32_t *out)
 {
-    for (unsigned i = 0; i < 4; i++) {
-        ctx->state[i] += constant[i];
+    _lanes_t x[16];
+    _lanes_t ctr;
+
+    for (unsigned i = 0; i < 16; i++) {
+        /* broadcast input word into all lanes */
+        x[i] = (_lanes_t){ 0 } + input[i];
     }
-    for (unsigned i = 0; i < 8; i++) {
-        ctx->state[i+4] += unaligned_get_u32(key + 4*i);
+    for (unsigned j = 0; j < CHACHA20_LANES; j++) {
+        ctr[j] = input[CTR_IDX] + j;
+    }
+    x[CTR_IDX] = ctr;
+    for (unsigned i = 0; i < 10; i++) {
+        DOUBLEROUND(x);
+    }
+    for (unsigned i = 0; i < 16; i++) {
+        x[i] += (i == CTR_IDX) ? ctr : (_lanes_t){ 0 } + input[i];
+    }
+    for (unsigned j = 0; j < CHACHA20_LANES; j++) {
+        for (unsigned i = 0; i < 16; i++) {
+            out[16 * j + i] = x[i][j];
+        }
     }
-    ctx->state[12] += unaligned_get_u32((uint8_t*)&blk);
-    ctx->state[13] += unaligned_get_u32(nonce);
-    ctx->state[14] += unaligned_get_u32(nonce+4);
-    ctx->state[15] += unaligned_get_u32(nonce+8);
 }
+#endif /* CHACHA20_LANES */
 
-static void _keystream(chacha20poly1305_ctx_t *ctx, const uint8_t *key,
-                       const uint8_t *nonce, uint32_t blk)
+static void _xor_block(uint8_t *out, const uint8_t *in,
+                       const uint32_t *ks, size_t len)
 {
-    /* Initialize block state */
-    memset(ctx->state, 0, sizeof(ctx->state));
-    _add_initial(ctx, key, nonce, blk);
-
-    /* perform rounds */
-    for (unsigned i = 0; i < 80; ++i) {
-        uint32_t *a = &ctx->state[((i                    ) & 3)          ];
-        uint32_t *b = &ctx->state[((i + ((i & 4) ? 1 : 0)) & 3) + (4 * 1)];
-        uint32_t *c = &ctx->state[((i + ((i & 4) ? 2 : 0)) & 3) + (4 * 2)];
-        uint32_t *d = &ctx->state[((i + ((i & 4) ? 3 : 0)) & 3) + (4 * 3)];
-        _r(a, b, d, 16);
-        _r(c, d, b, 12);
-        _r(a, b, d, 8);
-        _r(c, d, b, 7);
-    }
-    /* add initial state */
-    _add_initial(ctx, key, nonce, blk);
+    size_t i = 0;
+
+    for (; i + 4 <= len; i += 4) {
+        uint32_t word = unaligned_get_u32(in + i) ^ ks[i / 4];
+        memcpy(out + i, &word, sizeof(word));
+    }
+    for (; i < len; i++) {
+        out[i] = in[i] ^ ((const uint8_t *)ks)[i];
+    }
 }
 
-static void _xcrypt(chacha20poly1305_ctx_t *ctx, const uint8_t *key,
-                    const uint8_t *nonce, const uint8_t *in, uint8_t *out, size_t len)
+static void _xcrypt(chacha20poly1305_stream_ctx_t *ctx,
+                    uint8_t *out, const uint8_t *in, size_t len)
 {
-    /* Number of full 64 byte blocks */
-    const size_t num_blocks = len >> 6;
-    size_t pos = 0;
-    /* xcrypt full blocks */
-    for (size_t i = 0; i < num_blocks; i++, pos += 64) {
-        _keystream(ctx, key, nonce, i+1);
-        for (size_t j = 0; j < 64; j++) {
-            out[pos+j] = in[pos+j] ^ ((uint8_t*)ctx->state)[j];
-        }
+    /* use up left over keystream of a previous call first */
+    while (len && (ctx->ks_pos < sizeof(ctx->keystream))) {
+        *out++ = *in++ ^ ((uint8_t *)ctx->keystream)[ctx->ks_pos++];
+        len--;
     }
-    /* xcrypt remaining bytes */
-    if (len - pos) {
-        _keystream(ctx, key, nonce, num_blocks+1);
-        for (size_t j = 0; j < len - pos; j++) {
-            out[pos+j] = in[pos+j] ^ ((uint8_t*)ctx->state)[j];
-        }
+#ifdef CHACHA20_LANES
+    uint32_t ks[16 * CHACHA20_LANES];
+    while (len >= sizeof(ks)) {
+        _block_multi(ctx->input, ks);
+        ctx->input[CTR_IDX] += CHACHA20_LANES;
+        _xor_block(out, in, ks, sizeof(ks));
+        out += sizeof(ks);
+        in += sizeof(ks);
+        len -= sizeof(ks);
+    }
+    crypto_secure_wipe(ks, sizeof(ks));
+#endif
+    while (len >= sizeof(ctx->keystream)) {
+        _block(ctx->input, ctx->keystream);
+        ctx->input[CTR_IDX]++;
+        _xor_block(out, in, ctx->keystream, sizeof(ctx->keystream));
+        out += sizeof(ctx->keystream);
+        in += sizeof(ctx->keystream);
+        len -= sizeof(ctx->keystream);
+    }
+    if (len) {
+        _block(ctx->input, ctx->keystream);
+        ctx->input[CTR_IDX]++;
+        _xor_block(out, in, ctx->keystream, len);
+        ctx->ks_pos = len;
     }
 }
 
-static void _poly1305_padded(poly1305_ctx_t *pctx, const uint8_t *data, size_t len)
+static void _pad16(poly1305_ctx_t *pctx)
 {
-    poly1305_update(pctx, data, len);
-    const size_t padlen = (16 - len) & 0xF;
+    const size_t padlen = (16 - pctx->c_idx) & 0xF;
     poly1305_update(pctx, padding, padlen);
 }
 
-/* Generate a poly1305 tag */
-static void _poly1305_gentag(uint8_t *mac, const uint8_t *key, const uint8_t *nonce,
-                             const uint8_t *cipher, size_t cipherlen,
-                             const uint8_t *aad, size_t aadlen)
+/* Authenticate ciphertext, switching from the AAD to the ciphertext phase
+ * on the first call */
+static void _mac(chacha20poly1305_stream_ctx_t *ctx, const uint8_t *cipher,
+                 size_t len)
 {
-    chacha20poly1305_ctx_t ctx;
-    /* generate one time key */
-    _keystream(&ctx, key, nonce, 0);
-    poly1305_init(&ctx.poly, (uint8_t*)ctx.state);
-    /* Add aad */
-    _poly1305_padded(&ctx.poly, aad, aadlen);
-    /* Add ciphertext */
-    _poly1305_padded(&ctx.poly, cipher, cipherlen);
-    /* Add aad length */
-    const uint64_t lengths[2] = {aadlen, cipherlen};
-    poly1305_update(&ctx.poly, (uint8_t*)lengths, sizeof(lengths));
-    poly1305_finish(&ctx.poly, mac);
-    crypto_secure_wipe(&ctx, sizeof(ctx));
+    if (!ctx->msglen) {
+        _pad16(&ctx->poly);
+    }
+    poly1305_update(&ctx->poly, cipher, len);
+    ctx->msglen += len;
+}
+
+static void _tag(chacha20poly1305_stream_ctx_t *ctx, uint8_t *mac)
+{
+    /* pads either the ciphertext or, if there was none, the aad */
+    _pad16(&ctx->poly);
+    /* Add aad and ciphertext length */
+    const uint64_t lengths[2] = { ctx->aadlen, ctx->msglen };
+    poly1305_update(&ctx->poly, (uint8_t *)lengths, sizeof(lengths));
+    poly1305_finish(&ctx->poly, mac);
+}
+
+void chacha20poly1305_stream_init(chacha20poly1305_stream_ctx_t *ctx,
+                                  const uint8_t *key, const uint8_t *nonce)
+{
+    for (unsigned i = 0; i < 4; i++) {
+        ctx->input[i] = constant[i];
+    }
+    for (unsigned i = 0; i < 8; i++) {
+        ctx->input[i + 4] = unaligned_get_u32(key + 4 * i);
+    }
+    ctx->input[CTR_IDX] = 0;
+    for (unsigned i = 0; i < 3; i++) {
+        ctx->input[i + 13] = unaligned_get_u32(nonce + 4 * i);
+    }
+    /* generate one time key from the first block */
+    _block(ctx->input, ctx->keystream);
+    ctx->input[CTR_IDX]++;
+    poly1305_init(&ctx->poly, (uint8_t *)ctx->keystream);
+    ctx->ks_pos = sizeof(ctx->keystream);
+    ctx->aadlen = 0;
+    ctx->msglen = 0;
+}
+
+void chacha20poly1305_stream_aad(chacha20poly1305_stream_ctx_t *ctx,
+                                 const uint8_t *aad, size_t aadlen)
+{
+    assert(ctx->msglen == 0);
+    poly1305_update(&ctx->poly, aad, aadlen);
+    ctx->aadlen += aadlen;
+}
+
+void chacha20poly1305_stream_encrypt(chacha20poly1305_stream_ctx_t *ctx,
+                                     uint8_t *cipher, const uint8_t *msg,
+                                     size_t len)
+{
+    _xcrypt(ctx, cipher, msg, len);
+    _mac(ctx, cipher, len);
+}
+
+void chacha20poly1305_stream_decrypt(chacha20poly1305_stream_ctx_t *ctx,
+                                     uint8_t *msg, const uint8_t *cipher,
+                                     size_t len)
+{
+    _mac(ctx, cipher, len);
+    _xcrypt(ctx, msg, cipher, len);
+}
+
+void chacha20poly1305_stream_finish(chacha20poly1305_stream_ctx_t *ctx,
+                                    uint8_t *mac)
+{
+    _tag(ctx, mac);
+    crypto_secure_wipe(ctx, sizeof(*ctx));
+}
+
+int chacha20poly1305_stream_verify(chacha20poly1305_stream_ctx_t *ctx,
+                                   const uint8_t *mac)
+{
+    uint8_t expected[CHACHA20POLY1305_TAG_BYTES];
+
+    chacha20poly1305_stream_finish(ctx, expected);
+    int res = crypto_equals(mac, expected, sizeof(expected));
+    crypto_secure_wipe(expected, sizeof(expected));
+    return res;
 }
 
 void chacha20poly1305_encrypt(uint8_t *cipher, const uint8_t *msg,
                               size_t msglen, const uint8_t *aad, size_t aadlen,
                               const uint8_t *key, const uint8_t *nonce)
 {
-    chacha20poly1305_ctx_t ctx;
-    _xcrypt(&ctx, key, nonce, msg, cipher, msglen);
-    crypto_secure_wipe(&ctx, sizeof(ctx));
-    /* Generate tag */
-    _poly1305_gentag(&cipher[msglen], key, nonce,
-                    cipher, msglen, aad, aadlen);
-    /* Wipe structures */
+    chacha20poly1305_stream_ctx_t ctx;
+
+    chacha20poly1305_stream_init(&ctx, key, nonce);
+    chacha20poly1305_stream_aad(&ctx, aad, aadlen);
+    chacha20poly1305_stream_encrypt(&ctx, cipher, msg, msglen);
+    /* Generate tag and wipe structures */
+    chacha20poly1305_stream_finish(&ctx, &cipher[msglen]);
 }
 
 int chacha20poly1305_decrypt(const uint8_t *cipher, size_t cipherlen,
@@ -155,15 +283,20 @@ int chacha20poly1305_decrypt(const uint8_t *cipher, size_t cipherlen,
                              const uint8_t *aad, size_t aadlen,
                              const uint8_t *key, const uint8_t *nonce)
 {
+    chacha20poly1305_stream_ctx_t ctx;
+    uint8_t mac[CHACHA20POLY1305_TAG_BYTES];
+
     *msglen = cipherlen - CHACHA20POLY1305_TAG_BYTES;
-    uint8_t mac[16];
-    _poly1305_gentag(mac, key, nonce, cipher,
-                     cipherlen - CHACHA20POLY1305_TAG_BYTES, aad, aadlen);
-    if (crypto_equals(cipher+*msglen, mac, CHACHA20POLY1305_TAG_BYTES) == 0) {
+    chacha20poly1305_stream_init(&ctx, key, nonce);
+    chacha20poly1305_stream_aad(&ctx, aad, aadlen);
+    /* Verify the tag before decrypting anything */
+    _mac(&ctx, cipher, *msglen);
+    _tag(&ctx, mac);
+    if (crypto_equals(cipher + *msglen, mac, CHACHA20POLY1305_TAG_BYTES) == 0) {
+        crypto_secure_wipe(&ctx, sizeof(ctx));
         return 0;
     }
-    chacha20poly1305_ctx_t ctx;
-    /* Number of full blocks */
-    _xcrypt(&ctx, key, nonce, cipher, msg, *msglen);
+    _xcrypt(&ctx, msg, cipher, *msglen);
+    crypto_secure_wipe(&ctx, sizeof(ctx));
     return 1;
 }
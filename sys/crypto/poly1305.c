@@ -103,7 +103,27 @@ static void _take_input(poly1305_ctx_t *ctx, uint8_t input)
 
 void poly1305_update(poly1305_ctx_t *ctx, const uint8_t *data, size_t len)
 {
-    for (size_t i = 0; i < len; i++) {
+    size_t i = 0;
+
+    /* complete a partially filled chunk first */
+    for (; (i < len) && ctx->c_idx; i++) {
+        _take_input(ctx, data[i]);
+        if (ctx->c_idx == 16) {
+            poly1305_block(ctx, 1);
+            _clear_c(ctx);
+        }
+    }
+    /* process full blocks directly from the input, word by word */
+    for (; len - i >= POLY1305_BLOCK_SIZE; i += POLY1305_BLOCK_SIZE) {
+        for (size_t j = 0; j < 4; j++) {
+            ctx->c[j] = u8to32(&data[i + 4 * j]);
+        }
+        poly1305_block(ctx, 1);
+    }
+    if (ctx->c_idx == 0) {
+        _clear_c(ctx);
+    }
+    for (; i < len; i++) {
         _take_input(ctx, data[i]);
         if (ctx->c_idx == 16) {
             poly1305_block(ctx, 1);
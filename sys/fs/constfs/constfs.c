@@ -42,6 +42,8 @@ static int constfs_fstat(vfs_file_t *filp, struct stat *buf);
 static off_t constfs_lseek(vfs_file_t *filp, off_t off, int whence);
 static int constfs_open(vfs_file_t *filp, const char *name, int flags, mode_t mode);
 static ssize_t constfs_read(vfs_file_t *filp, void *dest, size_t nbytes);
+static ssize_t constfs_read_iol(vfs_file_t *filp, iolist_t *iol, size_t nbytes);
+static ssize_t constfs_mmap(vfs_file_t *filp, off_t off, size_t len, const void **addr);
 
 /* Directory operations */
 static int constfs_opendir(vfs_DIR *dirp, const char *dirname);
@@ -57,6 +59,8 @@ static const vfs_file_ops_t constfs_file_ops = {
     .lseek = constfs_lseek,
     .open  = constfs_open,
     .read  = constfs_read,
+    .read_iol = constfs_read_iol,
+    .mmap = constfs_mmap,
 };
 
 static const vfs_dir_ops_t constfs_dir_ops = {
@@ -203,6 +207,39 @@ static ssize_t constfs_read(vfs_file_t *filp, void *dest, size_t nbytes)
     return nbytes;
 }
 
+static ssize_t constfs_read_iol(vfs_file_t *filp, iolist_t *iol, size_t nbytes)
+{
+    constfs_file_t *fp = filp->private_data.ptr;
+    DEBUG("constfs_read_iol: %p, %p, %" PRIuSIZE "\n", (void *)filp, (void *)iol, nbytes);
+    if ((size_t)filp->pos >= fp->size) {
+        /* Current offset is at or beyond end of file */
+        nbytes = 0;
+    }
+    else if (nbytes > (fp->size - filp->pos)) {
+        nbytes = fp->size - filp->pos;
+    }
+    iol->iol_base = (uint8_t *)fp->data + filp->pos;
+    iol->iol_len = nbytes;
+    filp->pos += nbytes;
+    return nbytes;
+}
+
+static ssize_t constfs_mmap(vfs_file_t *filp, off_t off, size_t len, const void **addr)
+{
+    constfs_file_t *fp = filp->private_data.ptr;
+    DEBUG("constfs_mmap: %p, %ld, %" PRIuSIZE "\n", (void *)filp, (long)off, len);
+    if ((size_t)off >= fp->size) {
+        /* offset is at or beyond end of file */
+        off = fp->size;
+        len = 0;
+    }
+    else if (len > (fp->size - off)) {
+        len = fp->size - off;
+    }
+    *addr = (const uint8_t *)fp->data + off;
+    return len;
+}
+
 static int constfs_opendir(vfs_DIR *dirp, const char *dirname)
 {
     DEBUG("constfs_opendir: %p, \"%s\"\n", (void *)dirp, dirname);
@@ -167,6 +167,24 @@ int conn_can_isotp_close(conn_can_isotp_t *conn);
  */
 int conn_can_isotp_recv(conn_can_isotp_t *conn, void *buf, size_t size, uint32_t timeout);
 
+/**
+ * @brief  Receive isotp data without copying it
+ *
+ * The received data stays in the buffer it was reassembled in. Call this
+ * function again with the same @p buf_ctx to release the buffer.
+ *
+ * @param[in] conn          ISO-TP connection
+ * @param[out] data         pointer to the received data
+ * @param[in,out] buf_ctx   buffer context, must point to NULL to receive data
+ * @param[in] timeout       timeout in us, 0 for infinite
+ *
+ * @return the number of bytes received
+ * @return 0 if the buffer in @p buf_ctx was released
+ * @return any other negative number in case of an error
+ */
+int conn_can_isotp_recv_buf(conn_can_isotp_t *conn, void **data, void **buf_ctx,
+                            uint32_t timeout);
+
 /**
  * @brief  Generic can send
  *
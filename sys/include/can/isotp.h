@@ -52,6 +52,18 @@ extern "C" {
 #define CAN_ISOTP_WFTMAX    (1)
 #endif
 
+#ifndef CAN_ISOTP_TX_WINDOW
+/**
+ * @brief   Maximum number of consecutive frames passed to the CAN device
+ *          before their TX confirmation
+ *
+ * Only used when the receiver requests a STmin of 0, otherwise each
+ * consecutive frame is sent after the confirmation of the previous one and
+ * STmin.
+ */
+#define CAN_ISOTP_TX_WINDOW (4)
+#endif
+
 /**
  * @brief The isotp_fc_options struct
  *
@@ -94,6 +106,7 @@ struct tpcon {
     uint8_t state;        /**< the protocol state */
     uint8_t bs;           /**< block size */
     uint8_t sn;           /**< current sequence number */
+    uint8_t pending;      /**< number of frames waiting for TX confirmation */
     int tx_handle;        /**< handle of the last sent frame */
     gnrc_pktsnip_t *snip; /**< allocated snip containing data buffer */
 };
@@ -115,6 +128,8 @@ struct isotp {
     can_reg_entry_t entry;         /**< entry containing ifnum and upper layer msg system */
     uint32_t tx_gap;               /**< transmit gap from fc (in us) */
     uint8_t tx_wft;                /**< transmit wait counter */
+    int tx_handles[CAN_ISOTP_TX_WINDOW]; /**< handles of the frames waiting
+                                          *   for TX confirmation */
     void *arg;                     /**< upper layer private arg */
 };
 
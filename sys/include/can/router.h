@@ -35,6 +35,10 @@ void can_router_init(void);
 /**
  * @brief Register a user @p entry to receive a frame @p can_id
  *
+ * Filters with a @p mask covering all bits of @ref CAN_EFF_MASK match a single
+ * CAN ID and are looked up in a hash table when a frame is received, other
+ * filters are compared to every received frame.
+ *
  * @param[in] entry   the entry containing ifnum and user info
  * @param[in] can_id  the CAN ID of the frame to receive
  * @param[in] mask    the mask of the frame to receive
@@ -17,6 +17,19 @@
  * Nonces must be unique per message for a single key. They are allowed to be
  * predictable, e.g. a message counter and are allowed to be visible during
  * transmission.
+ *
+ * Next to the single-shot @ref chacha20poly1305_encrypt and
+ * @ref chacha20poly1305_decrypt functions, an incremental interface is
+ * provided for messages that are not available in a single buffer. A message
+ * is processed by calling @ref chacha20poly1305_stream_init, any number of
+ * @ref chacha20poly1305_stream_aad calls, followed by any number of
+ * @ref chacha20poly1305_stream_encrypt (or
+ * @ref chacha20poly1305_stream_decrypt) calls and finally
+ * @ref chacha20poly1305_stream_finish (or
+ * @ref chacha20poly1305_stream_verify).
+ *
+ * On platforms with SIMD support (SSE2, AVX2 or NEON), multiple keystream
+ * blocks are generated in parallel.
  * @{
  *
  * @file
@@ -50,6 +63,18 @@ typedef union {
     poly1305_ctx_t poly;    /**< Poly1305 state for the MAC */
 } chacha20poly1305_ctx_t;
 
+/**
+ * @brief Chacha20poly1305 incremental encryption/decryption context
+ */
+typedef struct {
+    poly1305_ctx_t poly;    /**< Poly1305 state for the MAC */
+    uint32_t input[16];     /**< ChaCha20 input block incl. block counter */
+    uint32_t keystream[16]; /**< Last generated keystream block */
+    uint64_t aadlen;        /**< Number of additional data bytes processed */
+    uint64_t msglen;        /**< Number of ciphertext bytes processed */
+    uint8_t ks_pos;         /**< Number of used bytes in @p keystream */
+} chacha20poly1305_stream_ctx_t;
+
 /**
  * @brief Encrypt a plaintext to ciphertext and append a tag to protect the
  * ciphertext and additional data.
@@ -96,6 +121,87 @@ int chacha20poly1305_decrypt(const uint8_t *cipher, size_t cipherlen,
                              const uint8_t *aad, size_t aadlen,
                              const uint8_t *key, const uint8_t *nonce);
 
+/**
+ * @brief Initialize a context for incremental encryption or decryption
+ *
+ * @param[out]  ctx         context to initialize
+ * @param[in]   key         key to use, must be CHACHA20POLY1305_KEY_BYTES long
+ * @param[in]   nonce       Nonce to use. Must be CHACHA20POLY1305_NONCE_BYTES
+ *                          long
+ */
+void chacha20poly1305_stream_init(chacha20poly1305_stream_ctx_t *ctx,
+                                  const uint8_t *key, const uint8_t *nonce);
+
+/**
+ * @brief Add additional authenticated data to the message
+ *
+ * Must be called before the first call to
+ * @ref chacha20poly1305_stream_encrypt or @ref chacha20poly1305_stream_decrypt.
+ *
+ * @param[in,out]   ctx     context
+ * @param[in]       aad     additional authenticated data to protect
+ * @param[in]       aadlen  length of the additional authenticated data
+ */
+void chacha20poly1305_stream_aad(chacha20poly1305_stream_ctx_t *ctx,
+                                 const uint8_t *aad, size_t aadlen);
+
+/**
+ * @brief Encrypt the next chunk of a message
+ *
+ * It is allowed to have cipher == msg.
+ *
+ * @param[in,out]   ctx     context
+ * @param[out]      cipher  resulting ciphertext, @p len bytes
+ * @param[in]       msg     message chunk to encrypt
+ * @param[in]       len     length in bytes of the message chunk
+ */
+void chacha20poly1305_stream_encrypt(chacha20poly1305_stream_ctx_t *ctx,
+                                     uint8_t *cipher, const uint8_t *msg,
+                                     size_t len);
+
+/**
+ * @brief Decrypt the next chunk of a ciphertext
+ *
+ * It is allowed to have msg == cipher.
+ *
+ * @warning The resulting plaintext is not authenticated before
+ *          @ref chacha20poly1305_stream_verify succeeded and must not be
+ *          acted upon before.
+ *
+ * @param[in,out]   ctx     context
+ * @param[out]      msg     resulting plaintext, @p len bytes
+ * @param[in]       cipher  ciphertext chunk to decrypt
+ * @param[in]       len     length in bytes of the ciphertext chunk
+ */
+void chacha20poly1305_stream_decrypt(chacha20poly1305_stream_ctx_t *ctx,
+                                     uint8_t *msg, const uint8_t *cipher,
+                                     size_t len);
+
+/**
+ * @brief Finish an incremental encryption and generate the tag
+ *
+ * The context is wiped afterwards.
+ *
+ * @param[in,out]   ctx     context
+ * @param[out]      mac     authentication tag, CHACHA20POLY1305_TAG_BYTES long
+ */
+void chacha20poly1305_stream_finish(chacha20poly1305_stream_ctx_t *ctx,
+                                    uint8_t *mac);
+
+/**
+ * @brief Finish an incremental decryption and verify the tag
+ *
+ * The context is wiped afterwards.
+ *
+ * @param[in,out]   ctx     context
+ * @param[in]       mac     received tag, CHACHA20POLY1305_TAG_BYTES long
+ *
+ * @return  1 if the tag is valid
+ * @return  0 if the tag does not match
+ */
+int chacha20poly1305_stream_verify(chacha20poly1305_stream_ctx_t *ctx,
+                                   const uint8_t *mac);
+
 #ifdef __cplusplus
 }
 #endif
@@ -36,6 +36,8 @@ extern "C" {
 #define DNS_TYPE_A              (1)
 #define DNS_TYPE_AAAA           (28)
 #define DNS_CLASS_IN            (1)
+#define DNS_RCODE_MASK          (0x000f)    /**< response code in header flags */
+#define DNS_RCODE_NXDOMAIN      (3)         /**< name does not exist */
 /** @} */
 
 /**
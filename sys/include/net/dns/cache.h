@@ -19,13 +19,17 @@
  *
  * This implements a simple DNS cache for A and AAAA entries.
  *
- * The cache eviction strategy is based on the remaining time to live
- * of the cache entries, so the first entry to expire will be evicted.
+ * When the cache is full, the least recently used entry is evicted.
  *
- * This is fine if there are only few cache entries and cache eviction
- * is unlikely.
- * If there is communication to many different hosts, the addition of a
- * least-recently used counter could likely improve the behavior.
+ * Names that do not exist (NXDOMAIN) can be cached as negative entries,
+ * see @ref dns_cache_add_negative().
+ *
+ * With @ref CONFIG_DNS_CACHE_STALE_TTL, expired addresses are still handed
+ * out by @ref dns_cache_query_stale() for a while, so a resolver can answer
+ * immediately and refresh the entry afterwards.
+ *
+ * The module `dns_cache_stats` counts cache hits and misses, see
+ * @ref dns_cache_stats_get().
  *
  * @author  Benjamin Valentin <benjamin.valentin@ml-pa.com>
  */
@@ -33,6 +37,7 @@
 #ifndef NET_DNS_CACHE_H
 #define NET_DNS_CACHE_H
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #include "modules.h"
@@ -62,6 +67,36 @@ extern "C" {
 #define CONFIG_DNS_CACHE_AAAA   IS_USED(MODULE_IPV6)
 #endif
 
+/**
+ * @brief   Maximum lifetime of negative entries in seconds
+ *
+ * Lifetimes passed to @ref dns_cache_add_negative() are capped to this value.
+ */
+#ifndef CONFIG_DNS_CACHE_NEGATIVE_TTL
+#define CONFIG_DNS_CACHE_NEGATIVE_TTL   60
+#endif
+
+/**
+ * @brief   Time in seconds an expired address may still be served
+ *
+ * Only @ref dns_cache_query_stale() returns such stale addresses. 0 disables
+ * serving stale addresses.
+ */
+#ifndef CONFIG_DNS_CACHE_STALE_TTL
+#define CONFIG_DNS_CACHE_STALE_TTL      0
+#endif
+
+/**
+ * @brief   DNS cache statistics
+ */
+typedef struct {
+    uint32_t hits;          /**< addresses found */
+    uint32_t stale_hits;    /**< expired addresses served */
+    uint32_t negative_hits; /**< names found to not exist */
+    uint32_t misses;        /**< names not found */
+    uint32_t evictions;     /**< entries evicted to make room */
+} dns_cache_stats_t;
+
 #if IS_USED(MODULE_DNS_CACHE) || DOXYGEN
 /**
  * @brief Get IP address for a DNS name from the DNS cache
@@ -71,10 +106,32 @@ extern "C" {
  * @param[in]   family          Either AF_INET, AF_INET6 or AF_UNSPEC
  *
  * @return      the size of the resolved address on success
- * @return      <= 0 otherwise
+ * @return      -ENOENT if the name is cached as not existing
+ * @return      0 otherwise
  */
 int dns_cache_query(const char *domain_name, void *addr_out, int family);
 
+/**
+ * @brief Get IP address for a DNS name, including expired addresses
+ *
+ * Like @ref dns_cache_query(), but addresses that expired less than
+ * @ref CONFIG_DNS_CACHE_STALE_TTL seconds ago are returned as well.
+ *
+ * @param[in]   domain_name     DNS name to resolve into address
+ * @param[out]  addr_out        buffer to write result into
+ * @param[in]   family          Either AF_INET, AF_INET6 or AF_UNSPEC
+ * @param[out]  stale           set to true for the first caller that gets an
+ *                              expired address, which should then resolve
+ *                              @p domain_name again and call
+ *                              @ref dns_cache_refresh_done() afterwards
+ *
+ * @return      the size of the resolved address on success
+ * @return      -ENOENT if the name is cached as not existing
+ * @return      0 otherwise
+ */
+int dns_cache_query_stale(const char *domain_name, void *addr_out, int family,
+                          bool *stale);
+
 /**
  * @brief Add an IP address for a DNS name to the DNS cache
  *
@@ -84,6 +141,38 @@ int dns_cache_query(const char *domain_name, void *addr_out, int family);
  * @param[in]   ttl             lifetime of the entry in seconds
  */
 void dns_cache_add(const char *domain_name, const void *addr, int addr_len, uint32_t ttl);
+
+/**
+ * @brief Add a DNS name that does not exist to the DNS cache
+ *
+ * Replaces all addresses of @p domain_name in the cache.
+ *
+ * @param[in]   domain_name     DNS name that does not exist
+ * @param[in]   ttl             lifetime of the entry in seconds, capped to
+ *                              @ref CONFIG_DNS_CACHE_NEGATIVE_TTL
+ */
+void dns_cache_add_negative(const char *domain_name, uint32_t ttl);
+
+/**
+ * @brief Finish the refresh of a DNS name
+ *
+ * Must be called by the caller that was told to refresh @p domain_name by
+ * @ref dns_cache_query_stale(), whether the refresh succeeded, failed or was
+ * not started. If the addresses of @p domain_name are still stale, the next
+ * stale query asks for a refresh again.
+ *
+ * @param[in]   domain_name     DNS name that was refreshed
+ */
+void dns_cache_refresh_done(const char *domain_name);
+
+/**
+ * @brief Get the DNS cache statistics
+ *
+ * @note    Only available with module `dns_cache_stats`
+ *
+ * @param[out]  stats   the statistics
+ */
+void dns_cache_stats_get(dns_cache_stats_t *stats);
 #else
 static inline int dns_cache_query(const char *domain_name, void *addr_out, int family)
 {
@@ -93,6 +182,18 @@ static inline int dns_cache_query(const char *domain_name, void *addr_out, int f
     return 0;
 }
 
+static inline int dns_cache_query_stale(const char *domain_name, void *addr_out,
+                                        int family, bool *stale)
+{
+    (void)domain_name;
+    (void)addr_out;
+    (void)family;
+    if (stale) {
+        *stale = false;
+    }
+    return 0;
+}
+
 static inline void dns_cache_add(const char *domain_name, const void *addr,
                                  int addr_len, uint32_t ttl)
 {
@@ -101,6 +202,17 @@ static inline void dns_cache_add(const char *domain_name, const void *addr,
     (void)addr_len;
     (void)ttl;
 }
+
+static inline void dns_cache_add_negative(const char *domain_name, uint32_t ttl)
+{
+    (void)domain_name;
+    (void)ttl;
+}
+
+static inline void dns_cache_refresh_done(const char *domain_name)
+{
+    (void)domain_name;
+}
 #endif
 
 #ifdef __cplusplus
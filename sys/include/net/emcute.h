@@ -59,6 +59,8 @@
  * - updating will message
  * - sending out periodic PINGREQ messages
  * - handling re-transmits
+ * - multiple QoS 1 publications in flight (see @ref CONFIG_EMCUTE_PUB_WINDOW)
+ * - registering multiple topic names at once
  *
  * The following features are however still missing (but planned):
  * @todo        Gateway discovery (so far there is no support for handling
@@ -171,6 +173,25 @@ extern "C" {
 #ifndef CONFIG_EMCUTE_N_RETRY
 #define CONFIG_EMCUTE_N_RETRY               (3U)
 #endif
+
+/**
+ * @brief   Maximum number of QoS 1 PUBLISH messages in flight
+ *
+ * With the default of 1, emcute_pub() waits for the PUBACK of a QoS 1 message
+ * before it returns. With a larger window, emcute_pub() returns as soon as the
+ * message is sent and only blocks while this many messages are waiting for
+ * their PUBACK, so the publish rate is no longer bound by the round trip time
+ * to the gateway. Use emcute_pub_wait() to wait for the PUBACKs and learn
+ * about failed publications.
+ *
+ * Every message in flight keeps a copy of @ref CONFIG_EMCUTE_BUFSIZE bytes for
+ * retransmissions. These are sent by the emCute thread between
+ * @ref CONFIG_EMCUTE_T_RETRY and twice that time after the previous
+ * transmission.
+ */
+#ifndef CONFIG_EMCUTE_PUB_WINDOW
+#define CONFIG_EMCUTE_PUB_WINDOW            (1U)
+#endif
 /** @} */
 
 /**
@@ -283,6 +304,25 @@ int emcute_discon(void);
  */
 int emcute_reg(emcute_topic_t *topic);
 
+/**
+ * @brief   Get topic IDs for multiple topic names from the gateway
+ *
+ * Up to 32 REGISTER messages are sent back to back and their REGACKs are
+ * collected, instead of waiting for each REGACK before sending the next
+ * REGISTER as done by emcute_reg().
+ *
+ * @param[in,out] topics    topics to register, the names **must not** be NULL
+ * @param[in] num           number of elements in @p topics
+ *
+ * @return  EMCUTE_OK on success
+ * @return  EMCUTE_NOGW if not connected to a gateway
+ * @return  EMCUTE_OVERFLOW if length of a topic name exceeds
+ *          @ref CONFIG_EMCUTE_TOPIC_MAXLEN
+ * @return  EMCUTE_REJECT if the gateway rejected a topic, its ID stays 0
+ * @return  EMCUTE_TIMEOUT on connection timeout
+ */
+int emcute_reg_many(emcute_topic_t *topics, size_t num);
+
 /**
  * @brief   Publish data on the given topic
  *
@@ -292,6 +332,10 @@ int emcute_reg(emcute_topic_t *topic);
  * @param[in] len       length of @p data in bytes
  * @param[in] flags     flags used for publication, allowed are QoS and retain
  *
+ * @note    With @ref CONFIG_EMCUTE_PUB_WINDOW > 1, QoS 1 messages are not
+ *          acknowledged yet when this function returns. Rejections and
+ *          timeouts are reported by emcute_pub_wait() instead.
+ *
  * @return  EMCUTE_OK on success
  * @return  EMCUTE_NOGW if not connected to a gateway
  * @return  EMCUTE_REJECT if publish message was rejected (QoS > 0 only)
@@ -302,6 +346,19 @@ int emcute_reg(emcute_topic_t *topic);
 int emcute_pub(emcute_topic_t *topic, const void *buf, size_t len,
                unsigned flags);
 
+/**
+ * @brief   Wait until all QoS 1 messages in flight are acknowledged
+ *
+ * Only blocks with @ref CONFIG_EMCUTE_PUB_WINDOW > 1.
+ *
+ * @return  EMCUTE_OK if all messages published since the last call were
+ *          acknowledged
+ * @return  EMCUTE_REJECT if a message was rejected by the gateway
+ * @return  EMCUTE_TIMEOUT if a message was not acknowledged in time
+ * @return  EMCUTE_NOGW if messages were dropped by emcute_discon()
+ */
+int emcute_pub_wait(void);
+
 /**
  * @brief   Subscribe to the given topic
  *
@@ -47,6 +47,14 @@
  * threads of neighboring layers for packets that traverse the network stack up
  * or down.
  *
+ * The kernel schedules all threads on a single core, also on MCUs that have
+ * more than one (e.g. @ref cpu_rpx0xx or @ref cpu_esp32), so the threads of
+ * the network stack never run in parallel. Since network interfaces of the
+ * same priority do not preempt each other, an interface that must not be
+ * delayed by a burst of packets received on another one needs a higher
+ * priority, see the `priority` parameter of the `gnrc_netif_*_create()`
+ * functions.
+ *
  * Due to the design of @ref net_gnrc "GNRC" and the nature of inter-process
  * communication, it is crucial for a new module that introduces a new thread
  * to follow a certain programming construct if it desires to interact with
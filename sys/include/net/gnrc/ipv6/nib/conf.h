@@ -291,6 +291,21 @@ extern "C" {
 #define CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF              (8)
 #endif
 
+/**
+ * @brief   Number of entries in the forwarding cache
+ *
+ * The forwarding cache maps recently used destinations to their next hop, so
+ * that packets of established flows skip the longest-prefix match and the
+ * neighbor cache look-up. Only next hops that are reachable (or not managed
+ * by neighbor unreachability detection) are cached and the whole cache is
+ * invalidated on every change to the NIB.
+ *
+ * Set to 0 to disable the forwarding cache.
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_FWD_CACHE_SIZE
+#define CONFIG_GNRC_IPV6_NIB_FWD_CACHE_SIZE          (0)
+#endif
+
 #if CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C || defined(DOXYGEN)
 /**
  * @brief   Number of authoritative border router entries in NIB
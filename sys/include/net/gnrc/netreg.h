@@ -79,6 +79,23 @@ typedef enum {
  */
 #define GNRC_NETREG_DEMUX_CTX_ALL   (0xffff0000)
 
+/**
+ * @defgroup net_gnrc_netreg_conf  GNRC netreg compile configurations
+ * @ingroup  net_gnrc_conf
+ * @{
+ */
+/**
+ * @brief   Number of hash buckets per protocol type (must be a power of 2)
+ *
+ * Entries are hashed by their @ref gnrc_netreg_entry_t::demux_ctx, so a
+ * lookup only walks the entries in one bucket. Increase this if many entries
+ * are registered for a single type, e.g. a large number of UDP socks.
+ */
+#ifndef CONFIG_GNRC_NETREG_BUCKETS
+#define CONFIG_GNRC_NETREG_BUCKETS  (1U)
+#endif
+/** @} */
+
 /**
  * @name    Static entry initialization macros
  * @anchor  net_gnrc_netreg_init_static
@@ -57,6 +57,19 @@ extern "C" {
 #define CONFIG_GNRC_SIXLOWPAN_MSG_QUEUE_SIZE_EXP   (3U)
 #endif
 
+/**
+ * @brief   Number of flows for which the IPHC address compression is cached
+ *
+ * For each cached flow (source and destination address, interface and
+ * link-layer destination), the chosen address compression and context IDs
+ * are kept, so the compression contexts do not need to be looked up again for
+ * every packet of the flow. Cached entries are invalidated when a context
+ * changes. Set to 0 to disable the cache.
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE
+#define CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE       (0U)
+#endif
+
 /**
  * @brief   Number of datagrams that can be fragmented simultaneously
  *
@@ -84,6 +97,20 @@ extern "C" {
 #define CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE       (4U)
 #endif
 
+/**
+ * @brief   Number of buckets for the look-up of reassembly buffer entries
+ *
+ * @note    Only applicable with
+ *          [gnrc_sixlowpan_frag_rb](@ref net_gnrc_sixlowpan_frag_rb) module
+ *
+ * Entries are hashed by link-layer source address and datagram tag, so that
+ * a fragment only needs to be compared against the entries in its bucket.
+ * Must be a power of 2.
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_BUCKETS
+#define CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_BUCKETS    (4U)
+#endif
+
 /**
  * @brief   Timeout for reassembly buffer entries in microseconds
  *
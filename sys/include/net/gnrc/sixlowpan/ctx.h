@@ -115,6 +115,27 @@ gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_update(uint8_t id, const ipv6_addr_t *p
                                                 uint8_t prefix_len, uint16_t ltime,
                                                 bool comp);
 
+/**
+ * @brief   Gets the current version of the context buffer.
+ *
+ * The version changes whenever a context is updated or removed and, as
+ * context lifetimes are counted in minutes, at least once per minute. Results
+ * derived from context lookups can be reused as long as the version did not
+ * change.
+ *
+ * @return  The current version of the context buffer.
+ */
+uint32_t gnrc_sixlowpan_ctx_version(void);
+
+/**
+ * @brief   Marks the context buffer as changed.
+ *
+ * May be called from interrupt context.
+ *
+ * @internal
+ */
+void gnrc_sixlowpan_ctx_changed(void);
+
 /**
  * @brief   Removes context.
  *
@@ -124,6 +145,7 @@ static inline void gnrc_sixlowpan_ctx_remove(uint8_t id)
 {
     if (IS_USED(MODULE_GNRC_SIXLOWPAN_CTX)) {
         gnrc_sixlowpan_ctx_lookup_id(id)->prefix_len = 0;
+        gnrc_sixlowpan_ctx_changed();
     }
 }
 
@@ -44,6 +44,10 @@ extern "C" {
 /**
  * @brief   Fragment intervals to identify limits of fragments and duplicates.
  *
+ * The reassembly buffer merges the intervals of adjacent fragments, so an
+ * interval may span more than one fragment. A fragment that lies completely
+ * within an interval is considered a duplicate.
+ *
  * @note    Fragments MUST NOT overlap and overlapping fragments are to be
  *          discarded
  *
@@ -58,6 +62,13 @@ typedef struct gnrc_sixlowpan_frag_rb_int {
     struct gnrc_sixlowpan_frag_rb_int *next;
     uint16_t start;             /**< start byte of the fragment interval */
     uint16_t end;               /**< end byte of the fragment interval */
+    /**
+     * @brief   size of the fragments merged into the interval
+     *
+     * The fragments start every `frag_size` bytes from @ref start, only the
+     * last one may be shorter.
+     */
+    uint16_t frag_size;
 } gnrc_sixlowpan_frag_rb_int_t;
 
 /**
@@ -101,6 +112,25 @@ typedef struct {
      * @brief   The reassembled packet in the packet buffer
      */
     gnrc_pktsnip_t *pkt;
+    /**
+     * @brief   Index + 1 of the next entry in the same look-up bucket, 0 if
+     *          this is the last entry of the bucket
+     */
+    uint8_t bucket_next;
+    /**
+     * @brief   Index + 1 of the look-up bucket the entry is linked into, 0 if
+     *          it was never linked
+     */
+    uint8_t bucket;
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_STATS) || defined(DOXYGEN)
+    /**
+     * @brief   Number of fragments added to the entry
+     *
+     * @note    Only available with module `gnrc_sixlowpan_frag_stats`
+     *          compiled in.
+     */
+    uint8_t fragments;
+#endif /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_STATS) */
 #if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) || defined(DOXYGEN)
     /**
      * @brief   Bitmap for received fragments
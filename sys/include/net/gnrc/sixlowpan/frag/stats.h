@@ -36,6 +36,15 @@ typedef struct {
                              *   no @ref gnrc_sixlowpan_frag_fb_t available */
     unsigned datagrams;     /**< reassembled datagrams */
     unsigned fragments;     /**< total fragments of reassembled fragments */
+    unsigned ints_full;     /**< counts the number of events where no fragment
+                             *   interval was available */
+    unsigned overlaps;      /**< counts the number of received fragments
+                             *   that partially overlapped already received
+                             *   ones */
+    unsigned duplicates;    /**< counts the number of dropped duplicate
+                             *   fragments */
+    unsigned rbuf_timeouts; /**< counts the number of reassembly buffer
+                             *   entries that timed out */
 #if defined(MODULE_GNRC_SIXLOWPAN_FRAG_VRB) || DOXYGEN
     unsigned vrb_full;      /**< counts the number of events where the virtual
                              *   reassembly buffer is full */
@@ -108,6 +108,40 @@ extern "C" {
 #define GNRC_TCP_RCV_BUF_SIZE (CONFIG_GNRC_TCP_DEFAULT_WINDOW)
 #endif
 
+/**
+ * @brief Maximum number of unacknowledged data segments in flight.
+ *
+ * Every segment in flight is kept in the packet buffer until it is
+ * acknowledged. With the default of one, a connection sends one segment per
+ * round trip. Raise it (up to 31) for higher throughput on links with a large
+ * bandwidth-delay product.
+ */
+#ifndef CONFIG_GNRC_TCP_SND_QUEUE_SIZE
+#define CONFIG_GNRC_TCP_SND_QUEUE_SIZE (1U)
+#endif
+
+/**
+ * @brief Number of segments received out of order kept for reassembly.
+ *
+ * Segments arriving ahead of a missing one are kept in the packet buffer
+ * until the gap is filled, instead of being dropped. Zero disables
+ * out-of-order reassembly.
+ */
+#ifndef CONFIG_GNRC_TCP_OOO_QUEUE_SIZE
+#define CONFIG_GNRC_TCP_OOO_QUEUE_SIZE (0U)
+#endif
+
+/**
+ * @brief Enable selective acknowledgments (SACK, see RFC 2018).
+ *
+ * Announces SACK support on connection setup. If the peer supports it too,
+ * out-of-order segments are reported to it and segments it reported are not
+ * retransmitted.
+ */
+#ifndef CONFIG_GNRC_TCP_SACK_EN
+#define CONFIG_GNRC_TCP_SACK_EN 0
+#endif
+
 /**
  * @brief Lower bound for RTO in milliseconds. Default is 1 sec (see RFC 6298)
  *
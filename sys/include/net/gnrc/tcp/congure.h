@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup net_gnrc_tcp_congure Congestion control for GNRC TCP
+ * @ingroup net_gnrc_tcp
+ *
+ * @brief Congestion control for GNRC TCP using the @ref sys_congure
+ *
+ * When included, the number of bytes a connection has in flight is limited by
+ * the congestion window in addition to the window advertised by the peer. The
+ * flavor of congestion control is selected using the following sub-modules:
+ *
+ * - @ref net_gnrc_tcp_congure_reno (the default)
+ * - @ref net_gnrc_tcp_congure_quic
+ *
+ * Congestion control only has an effect if more than one segment may be in
+ * flight, see @ref CONFIG_GNRC_TCP_SND_QUEUE_SIZE.
+ * @{
+ *
+ * @file
+ * @brief   Congure definitions for @ref net_gnrc_tcp
+ *
+ * @author  agent <agent@local>
+ */
+#ifndef NET_GNRC_TCP_CONGURE_H
+#define NET_GNRC_TCP_CONGURE_H
+
+#include "modules.h"
+
+#if IS_USED(MODULE_GNRC_TCP_CONGURE_QUIC)
+#include "congure/quic.h"
+#elif IS_USED(MODULE_GNRC_TCP_CONGURE_RENO)
+#include "congure/reno.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if IS_USED(MODULE_GNRC_TCP_CONGURE_QUIC) || defined(DOXYGEN)
+/**
+ * @brief   Congestion control state of a connection
+ *
+ * Depends on the selected sub-module.
+ */
+typedef congure_quic_snd_t gnrc_tcp_congure_snd_t;
+#elif IS_USED(MODULE_GNRC_TCP_CONGURE_RENO)
+typedef congure_reno_snd_t gnrc_tcp_congure_snd_t;
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_TCP_CONGURE_H */
+/** @} */
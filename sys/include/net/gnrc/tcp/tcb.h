@@ -20,6 +20,7 @@
 #ifndef NET_GNRC_TCP_TCB_H
 #define NET_GNRC_TCP_TCB_H
 
+#include <assert.h>
 #include <stdint.h>
 #include "ringbuffer.h"
 #include "mutex.h"
@@ -28,6 +29,7 @@
 #include "msg.h"
 #include "mbox.h"
 #include "net/gnrc/pkt.h"
+#include "net/gnrc/tcp/congure.h"
 #include "config.h"
 
 #ifdef MODULE_GNRC_IPV6
@@ -38,6 +40,18 @@
 extern "C" {
 #endif
 
+/**
+ * @brief Length of the retransmission queue of a TCB.
+ *
+ * Holds up to @ref CONFIG_GNRC_TCP_SND_QUEUE_SIZE data segments, and one more
+ * slot for a SYN or FIN sent while the data segments are unacknowledged.
+ */
+#define GNRC_TCP_RTX_QUEUE_LEN (CONFIG_GNRC_TCP_SND_QUEUE_SIZE + 1)
+
+/* slots of the retransmission queue are tracked in 32 bit bitmaps */
+static_assert(GNRC_TCP_RTX_QUEUE_LEN <= 32,
+              "CONFIG_GNRC_TCP_SND_QUEUE_SIZE must not exceed 31");
+
 /**
  * @brief Transmission control block of GNRC TCP.
  */
@@ -62,15 +76,33 @@ typedef struct sock_tcp {
     uint32_t iss;          /**< Initial sequence sumber */
     uint32_t irs;          /**< Initial received sequence number */
     uint16_t mss;          /**< The peers MSS */
-    uint32_t rtt_start;    /**< Timer value for rtt estimation */
     int32_t rtt_var;       /**< Round trip time variance */
     int32_t srtt;          /**< Smoothed round trip time */
     int32_t rto;           /**< Retransmission timeout duration */
-    uint8_t retries;       /**< Number of retransmissions */
+    uint8_t retries;       /**< Number of retransmissions after a timeout */
+    uint8_t dup_acks;      /**< Number of duplicate ACKs received */
+    uint8_t rtx_len;       /**< Number of segments in rtx_queue */
+    uint32_t rtx_resent;   /**< Bitmap of retransmitted segments in rtx_queue */
+    uint32_t rtx_sacked;   /**< Bitmap of selectively acknowledged segments in rtx_queue */
     evtimer_msg_event_t event_retransmit; /**< Retransmission event */
     evtimer_msg_event_t event_timeout;    /**< Timeout event */
     evtimer_mbox_event_t event_misc;      /**< General purpose event */
-    gnrc_pktsnip_t *pkt_retransmit;       /**< Pointer to packet in "retransmit queue" */
+    /**
+     * @brief Unacknowledged segments, ordered by sequence number
+     */
+    gnrc_pktsnip_t *rtx_queue[GNRC_TCP_RTX_QUEUE_LEN];
+    uint32_t rtx_sent[GNRC_TCP_RTX_QUEUE_LEN]; /**< Send times of rtx_queue in ms */
+#if CONFIG_GNRC_TCP_OOO_QUEUE_SIZE
+    /**
+     * @brief Segments received out of order, ordered by sequence number
+     */
+    gnrc_pktsnip_t *ooo_queue[CONFIG_GNRC_TCP_OOO_QUEUE_SIZE];
+    uint32_t ooo_last_seq;   /**< Sequence number of the latest segment in ooo_queue */
+    uint8_t ooo_len;         /**< Number of segments in ooo_queue */
+#endif
+#if IS_USED(MODULE_GNRC_TCP_CONGURE)
+    gnrc_tcp_congure_snd_t congure;  /**< Congestion control state */
+#endif
     mbox_t *mbox;            /**< TCB mbox for synchronization */
     uint8_t *rcv_buf_raw;    /**< Pointer to the receive buffer */
     ringbuffer_t rcv_buf;    /**< Receive buffer data structure */
@@ -92,6 +92,19 @@
  *
  * Unexpected events will be reported and asserted.
  *
+ * If @ref CONFIG_IEEE802154_SUBMAC_TX_QUEUE_SIZE is not 0, frames passed to
+ * @ref ieee802154_send while the SubMAC is transmitting are copied into a TX
+ * queue. When the current transmission finishes, the SubMAC calls
+ * @ref ieee802154_submac_cb_t::tx_done and then writes the next queued frame
+ * to the radio and goes to PREPARE instead of IDLE, so queued frames are sent
+ * back-to-back without a round trip through the upper layer. The radio has a
+ * single framebuffer that is needed for retransmissions (and, if the SubMAC
+ * handles ACKs, for receiving the ACK), so the next frame is only written
+ * after the current one is done.
+ *
+ * With the `ieee802154_submac_stats` module, the SubMAC accounts the time
+ * spent in each state in @ref ieee802154_submac_t::stats.
+ *
  * The upper layer needs to implement the following callbacks:
  *
  * - @ref ieee802154_submac_cb_t::rx_done.
@@ -115,9 +128,20 @@ extern "C" {
 #include <string.h>
 #include "assert.h"
 
+#include "kernel_defines.h"
 #include "net/ieee802154.h"
 #include "net/ieee802154/radio.h"
 
+/**
+ * @brief Number of frames the SubMAC queues while it is transmitting
+ *
+ * Each queue slot takes @ref IEEE802154_FRAME_LEN_MAX - 1 bytes (the PSDU
+ * without FCS and its length). Set to 0 to disable the TX queue.
+ */
+#ifndef CONFIG_IEEE802154_SUBMAC_TX_QUEUE_SIZE
+#define CONFIG_IEEE802154_SUBMAC_TX_QUEUE_SIZE  0
+#endif
+
 /**
  * @brief IEEE 802.15.4 SubMAC forward declaration
  */
@@ -185,6 +209,28 @@ typedef enum {
     IEEE802154_FSM_EV_NUMOF,                /**< Number of SubMAC FSM events */
 } ieee802154_fsm_ev_t;
 
+/**
+ * @brief Frame in the SubMAC TX queue
+ */
+typedef struct {
+    uint8_t len;                        /**< length of the PSDU (without FCS) */
+    uint8_t psdu[IEEE802154_FRAME_LEN_MAX - IEEE802154_FCS_LEN]; /**< the PSDU */
+} ieee802154_submac_tx_frame_t;
+
+/**
+ * @brief SubMAC statistics
+ */
+typedef struct {
+    /**
+     * @brief Time spent in each state in microseconds
+     *
+     * The time spent in the current state is added when the state is left.
+     */
+    uint32_t state_time[IEEE802154_FSM_STATE_NUMOF];
+    uint32_t state_since;               /**< time the current state was entered */
+    uint32_t tx_queued;                 /**< frames sent from the TX queue */
+} ieee802154_submac_stats_t;
+
 /**
  * @brief IEEE 802.15.4 SubMAC descriptor
  */
@@ -206,6 +252,17 @@ struct ieee802154_submac {
     ieee802154_fsm_state_t fsm_state;    /**< State of the SubMAC */
     ieee802154_phy_mode_t phy_mode;     /**< IEEE 802.15.4 PHY mode */
     const iolist_t *psdu;               /**< stores the current PSDU */
+#if CONFIG_IEEE802154_SUBMAC_TX_QUEUE_SIZE || defined(DOXYGEN)
+    /**
+     * @brief Frames waiting for transmission
+     */
+    ieee802154_submac_tx_frame_t tx_queue[CONFIG_IEEE802154_SUBMAC_TX_QUEUE_SIZE];
+    uint8_t tx_queue_head;              /**< index of the next queued frame */
+    uint8_t tx_queue_len;               /**< number of queued frames */
+#endif
+#if IS_USED(MODULE_IEEE802154_SUBMAC_STATS) || defined(DOXYGEN)
+    ieee802154_submac_stats_t stats;    /**< SubMAC statistics */
+#endif
 };
 
 /**
@@ -215,13 +272,18 @@ struct ieee802154_submac {
  * retransmissions (if ACK Request bit is set).  When the transmission finishes
  * an @ref ieee802154_submac_cb_t::tx_done event is issued.
  *
+ * If the SubMAC is transmitting and @ref CONFIG_IEEE802154_SUBMAC_TX_QUEUE_SIZE
+ * is not 0, the frame is copied into the TX queue and sent after the frames
+ * before it. @ref ieee802154_submac_cb_t::tx_done is called for each frame.
+ *
  * @param[in] submac pointer to the SubMAC descriptor
  * @param[in] iolist pointer to the PSDU frame (without FCS)
  *
  * @return 0 on success
- * @return -EBUSY if the SubMAC is not in RX or IDLE state or if called inside
+ * @return -EBUSY if the SubMAC is not in RX or IDLE state (or if called inside
  *         @ref ieee802154_submac_cb_t::rx_done or
- *         @ref ieee802154_submac_cb_t::tx_done
+ *         @ref ieee802154_submac_cb_t::tx_done) and the frame could not be
+ *         queued
  */
 int ieee802154_send(ieee802154_submac_t *submac, const iolist_t *iolist);
 
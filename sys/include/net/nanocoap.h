@@ -350,6 +350,17 @@ struct _coap_request_ctx {
      */
     uint32_t tl_type;
 #endif
+    /**
+     * @brief   payload sent behind the response buffer (optional)
+     *
+     * Set by servers that can send a response from more than one buffer,
+     * NULL otherwise. The server resets the element to an empty one before
+     * calling the handler. A handler may point it at (the rest of) the
+     * response payload, which must stay valid until the handler of the next
+     * request is called. The handler's return value only counts the bytes in
+     * the response buffer then.
+     */
+    iolist_t *payload_iol;
 };
 
 /**
@@ -19,6 +19,7 @@
  */
 
 #include <stdint.h>
+#include "atomic_utils.h"
 #include "cib.h"
 #include "net/l2util.h"
 #include "mutex.h"
@@ -56,6 +57,9 @@ extern "C" {
 
 /**
  * @brief       Global statistics struct
+ *
+ * @note        @ref netstats_get and @ref netstats_reset rely on all members
+ *              being `uint32_t` counters.
  */
 typedef struct {
     uint32_t tx_unicast_count;  /**< packets sent via unicast */
@@ -128,6 +132,105 @@ typedef struct {
     mutex_t lock;
 } netstats_nb_table_t;
 
+/**
+ * @brief   Reasons for dropped packets, counted with module `netstats_drop`
+ */
+typedef enum {
+    NETSTATS_DROP_NO_BUF,       /**< packet buffer full
+                                     (@ref net_gnrc_pktbuf "gnrc_pktbuf_static") */
+    NETSTATS_DROP_QUEUE_FULL,   /**< message queue or mbox of the receiving
+                                     thread full */
+    NETSTATS_DROP_INVALID,      /**< malformed IPv6 header */
+    NETSTATS_DROP_HOP_LIMIT,    /**< IPv6 hop limit reached 0 */
+    NETSTATS_DROP_NO_ROUTE,     /**< no IPv6 next hop */
+    NETSTATS_DROP_FILTERED,     /**< source address not allowed by the IPv6
+                                     whitelist or blacklist */
+    NETSTATS_DROP_NUMOF,        /**< number of drop reasons */
+} netstats_drop_t;
+
+/**
+ * @brief   Dropped packets by reason
+ *
+ * @internal    Use @ref netstats_drop_get and @ref netstats_drop_reset
+ */
+extern uint32_t netstats_drops[NETSTATS_DROP_NUMOF];
+
+/**
+ * @brief   Add to a statistics counter
+ *
+ * Counters that are read or reset from a different thread than they are
+ * updated in use this instead of a critical section, together with
+ * @ref netstats_get and @ref netstats_reset.
+ *
+ * @param[in,out] counter   counter in a @ref netstats_t
+ * @param[in]     val       value to add
+ */
+static inline void netstats_add(uint32_t *counter, uint32_t val)
+{
+    atomic_fetch_add_u32(counter, val);
+}
+
+/**
+ * @brief   Copy statistics updated with @ref netstats_add
+ *
+ * Each counter is read atomically, but the copy is not a snapshot of all
+ * counters at the same time.
+ *
+ * @param[out] dst  copy of the statistics
+ * @param[in]  src  statistics
+ */
+static inline void netstats_get(netstats_t *dst, const netstats_t *src)
+{
+    const uint32_t *in = (const uint32_t *)src;
+    uint32_t *out = (uint32_t *)dst;
+
+    for (unsigned i = 0; i < sizeof(netstats_t) / sizeof(uint32_t); i++) {
+        out[i] = atomic_load_u32(&in[i]);
+    }
+}
+
+/**
+ * @brief   Reset statistics updated with @ref netstats_add
+ *
+ * @param[out] stats    statistics
+ */
+static inline void netstats_reset(netstats_t *stats)
+{
+    uint32_t *out = (uint32_t *)stats;
+
+    for (unsigned i = 0; i < sizeof(netstats_t) / sizeof(uint32_t); i++) {
+        atomic_store_u32(&out[i], 0);
+    }
+}
+
+/**
+ * @brief   Count a dropped packet
+ *
+ * Does nothing if module `netstats_drop` is not used. Can be called from any
+ * thread.
+ *
+ * @param[in] reason    why the packet was dropped
+ */
+static inline void netstats_drop(netstats_drop_t reason)
+{
+    if (IS_USED(MODULE_NETSTATS_DROP)) {
+        netstats_add(&netstats_drops[reason], 1);
+    }
+}
+
+/**
+ * @brief   Get the number of dropped packets
+ *
+ * @param[out] drops    number of dropped packets, indexed by
+ *                      @ref netstats_drop_t
+ */
+void netstats_drop_get(uint32_t drops[NETSTATS_DROP_NUMOF]);
+
+/**
+ * @brief   Reset the number of dropped packets
+ */
+void netstats_drop_reset(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -12,6 +12,14 @@
  *
  * @brief       Sock DNS client
  *
+ * Answers are stored in the @ref net_dns_cache, if the module `dns_cache` is
+ * used. With @ref CONFIG_DNS_CACHE_STALE_TTL set, an expired address is
+ * refreshed when it is queried. Without module `sock_dns_refresh`, the query
+ * waits for the refresh and only returns the expired address if the DNS
+ * server does not answer. With module `sock_dns_refresh`, the expired address
+ * is returned right away and refreshed in the background by a dedicated
+ * thread, so that the blocking query does not hold up other events.
+ *
  * @{
  *
  * @file
@@ -81,6 +89,22 @@ extern "C" {
 #define SOCK_DNS_MAX_NAME_LEN   (CONFIG_DNS_MSG_LEN - sizeof(dns_hdr_t) - 4)
 /** @} */
 
+#if defined(MODULE_SOCK_DNS_REFRESH) || defined(DOXYGEN)
+/**
+ * @brief Stack size of the thread refreshing stale addresses
+ */
+#ifndef SOCK_DNS_REFRESH_STACKSIZE
+#define SOCK_DNS_REFRESH_STACKSIZE  (THREAD_STACKSIZE_DEFAULT)
+#endif
+
+/**
+ * @brief Priority of the thread refreshing stale addresses
+ */
+#ifndef SOCK_DNS_REFRESH_PRIO
+#define SOCK_DNS_REFRESH_PRIO       (THREAD_PRIORITY_IDLE - 1)
+#endif
+#endif /* MODULE_SOCK_DNS_REFRESH */
+
 /**
  * @brief Get IP address for DNS name
  *
@@ -373,6 +373,36 @@ typedef struct {
     sock_aux_flags_t flags; /**< Flags used request information */
 } sock_udp_aux_tx_t;
 
+/**
+ * @brief   Datagram descriptor for @ref sock_udp_recv_many() and
+ *          @ref sock_udp_send_many()
+ */
+typedef struct {
+    void *data;                 /**< Buffer for, resp. payload of the datagram */
+    /**
+     * @brief   Size of sock_udp_mmsg_t::data
+     *
+     * Set to the number of bytes stored by @ref sock_udp_recv_many().
+     */
+    size_t len;
+    /**
+     * @brief   Remote end point of the datagram
+     *
+     * For @ref sock_udp_send_many(), sock_udp_ep_t::port may be 0 to send to
+     * the remote end point of the sock object.
+     */
+    sock_udp_ep_t remote;
+    union {
+        sock_udp_aux_rx_t rx;   /**< Auxiliary data for @ref sock_udp_recv_many() */
+        sock_udp_aux_tx_t tx;   /**< Auxiliary data for @ref sock_udp_send_many() */
+    } aux;                      /**< Auxiliary data of the datagram */
+    /**
+     * @brief   Set by @ref sock_udp_recv_many() if the datagram did not fit
+     *          into sock_udp_mmsg_t::data and was cut
+     */
+    bool truncated;
+} sock_udp_mmsg_t;
+
 /**
  * @brief   Creates a new UDP sock object
  *
@@ -797,6 +827,76 @@ static inline ssize_t sock_udp_sendv(sock_udp_t *sock,
     return sock_udp_sendv_aux(sock, snips, remote, NULL);
 }
 
+/**
+ * @brief   Receives multiple UDP messages from remote end points
+ *
+ * Waits up to @p timeout for the first datagram and then takes all further
+ * datagrams already queued at @p sock, up to @p num, without blocking. This
+ * allows handling a burst of datagrams within a single wake-up.
+ *
+ * @pre `(sock != NULL) && (msgs != NULL) && (num > 0)`
+ *
+ * @param[in] sock      A UDP sock object.
+ * @param[in,out] msgs  Datagram descriptors. sock_udp_mmsg_t::data and
+ *                      sock_udp_mmsg_t::len give the buffers to store the
+ *                      datagrams into, sock_udp_mmsg_t::aux.rx the auxiliary
+ *                      data to request. On return, sock_udp_mmsg_t::len,
+ *                      sock_udp_mmsg_t::remote and
+ *                      sock_udp_mmsg_t::truncated describe the received
+ *                      datagrams.
+ * @param[in] num       Number of descriptors in @p msgs.
+ * @param[in] timeout   Timeout for the first datagram in microseconds.
+ *                      If 0 and no data is available, the function returns
+ *                      immediately.
+ *                      May be @ref SOCK_NO_TIMEOUT for no timeout (wait until
+ *                      data is available).
+ *
+ * @experimental    This function is quite new, not implemented for all stacks
+ *                  yet, and may be subject to sudden API changes. Do not use in
+ *                  production if this is unacceptable.
+ *
+ * @note    Only implemented by GNRC and OpenWSN, not by lwIP.
+ *
+ * @return  The number of datagrams received on success.
+ * @return  -EADDRNOTAVAIL, if local of @p sock is not given.
+ * @return  -EAGAIN, if @p timeout is `0` and no data is available.
+ * @return  -EINVAL, if @p sock is not properly initialized (or closed while
+ *          sock_udp_recv_many() blocks).
+ * @return  -ENOMEM, if no memory was available to receive a datagram.
+ * @return  -EPROTO, if source address of the first received packet did not
+ *          equal the remote of @p sock.
+ * @return  -ETIMEDOUT, if @p timeout expired.
+ */
+int sock_udp_recv_many(sock_udp_t *sock, sock_udp_mmsg_t *msgs, unsigned num,
+                       uint32_t timeout);
+
+/**
+ * @brief   Sends multiple UDP messages
+ *
+ * Sending stops at the first datagram that fails.
+ *
+ * @pre `(msgs != NULL) && (num > 0)`
+ *
+ * @param[in] sock      A UDP sock object. May be `NULL`.
+ *                      A sensible local end point should be selected by the
+ *                      implementation in that case.
+ * @param[in,out] msgs  Datagram descriptors: payload, remote end point (see
+ *                      sock_udp_mmsg_t::remote) and auxiliary data
+ *                      (sock_udp_mmsg_t::aux.tx) of the datagrams.
+ * @param[in] num       Number of descriptors in @p msgs.
+ *
+ * @experimental    This function is quite new, not implemented for all stacks
+ *                  yet, and may be subject to sudden API changes. Do not use in
+ *                  production if this is unacceptable.
+ *
+ * @note    Only implemented by GNRC and OpenWSN, not by lwIP.
+ *
+ * @return  The number of datagrams sent on success.
+ * @return  The errors of @ref sock_udp_sendv_aux(), if the first datagram
+ *          could not be sent.
+ */
+int sock_udp_send_many(sock_udp_t *sock, sock_udp_mmsg_t *msgs, unsigned num);
+
 /**
  * @brief   Checks if the IP address of an endpoint is multicast
  *
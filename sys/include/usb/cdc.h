@@ -72,6 +72,14 @@ extern "C" {
 #define USB_CDC_PROTOCOL_VENDOR        0xFF /**< Vendor-specific */
 /** @} */
 
+/**
+ * @name USB CDC data interface protocol types
+ * @{
+ */
+#define USB_CDC_DATA_PROTOCOL_NONE     0x00 /**< No protocol required */
+#define USB_CDC_DATA_PROTOCOL_NTB      0x01 /**< Network Transfer Block (NCM) */
+/** @} */
+
 /**
  * @name USB CDC descriptor subtypes
  * @{
@@ -84,6 +92,8 @@ extern "C" {
                                                       management descriptor */
 #define USB_CDC_DESCR_SUBTYPE_UNION         0x06 /**< Union descriptor */
 #define USB_CDC_DESCR_SUBTYPE_ETH_NET       0x0f /**< Ethernet descriptor */
+#define USB_CDC_DESCR_SUBTYPE_NCM           0x1a /**< NCM functional
+                                                      descriptor */
 /** @} */
 
 /**
@@ -130,6 +140,31 @@ extern "C" {
  * @brief Get ethernet statistics
  */
 #define USB_CDC_MGNT_REQUEST_GET_ETH_STATISTICS         0x44
+
+/**
+ * @brief Get the NTB parameters of the NCM function
+ */
+#define USB_CDC_MGNT_REQUEST_GET_NTB_PARAMETERS         0x80
+
+/**
+ * @brief Get the current NTB format
+ */
+#define USB_CDC_MGNT_REQUEST_GET_NTB_FORMAT             0x83
+
+/**
+ * @brief Select the NTB format (16 or 32 bit)
+ */
+#define USB_CDC_MGNT_REQUEST_SET_NTB_FORMAT             0x84
+
+/**
+ * @brief Get the maximum size of IN NTBs
+ */
+#define USB_CDC_MGNT_REQUEST_GET_NTB_INPUT_SIZE         0x85
+
+/**
+ * @brief Set the maximum size of IN NTBs
+ */
+#define USB_CDC_MGNT_REQUEST_SET_NTB_INPUT_SIZE         0x86
 /** @} */
 
 /**
@@ -270,6 +305,86 @@ typedef struct __attribute__((packed)) {
     uint32_t up;        /**< Uplink bit rate */
 } usb_desc_cdcecm_speed_t;
 
+/**
+ * @brief USB CDC NCM functional descriptor
+ *
+ * @see USB CDC NCM 1.0 spec table 5-2
+ */
+typedef struct __attribute__((packed)) {
+    uint8_t length;         /**< Size of this descriptor */
+    uint8_t type;           /**< Descriptor type (@ref USB_TYPE_DESCRIPTOR_CDC) */
+    uint8_t subtype;        /**< Descriptor subtype (@ref USB_CDC_DESCR_SUBTYPE_NCM) */
+    uint16_t bcd_ncm;       /**< NCM release number in bcd (@ref USB_CDC_NCM_VERSION_BCD) */
+    uint8_t capabilities;   /**< Bitmap indicating the optional requests supported */
+} usb_desc_ncm_t;
+
+/**
+ * @name USB CDC NCM Network Transfer Block (NTB) defines
+ * @{
+ */
+#define USB_CDC_NCM_VERSION_BCD         0x0100      /**< NCM version in BCD */
+#define USB_CDC_NCM_NTB_FORMAT_16       (0x0001)    /**< 16 bit NTB format */
+#define USB_CDC_NCM_NTH16_SIGNATURE     0x484d434e  /**< "NCMH" */
+#define USB_CDC_NCM_NDP16_SIGNATURE     0x304d434e  /**< "NCM0", without CRC */
+/** @} */
+
+/**
+ * @brief USB CDC NCM NTB parameters, returned by
+ *        @ref USB_CDC_MGNT_REQUEST_GET_NTB_PARAMETERS
+ *
+ * @see USB CDC NCM 1.0 spec table 6-3
+ */
+typedef struct __attribute__((packed)) {
+    uint16_t length;                /**< Size of this structure */
+    uint16_t formats;               /**< Supported NTB formats */
+    uint32_t in_max_size;           /**< Maximum size of IN NTBs */
+    uint16_t in_divisor;            /**< Modulus for IN datagram alignment */
+    uint16_t in_remainder;          /**< Remainder for IN datagram alignment */
+    uint16_t in_alignment;          /**< Alignment of IN NDPs */
+    uint16_t reserved;              /**< Reserved, must be zero */
+    uint32_t out_max_size;          /**< Maximum size of OUT NTBs */
+    uint16_t out_divisor;           /**< Modulus for OUT datagram alignment */
+    uint16_t out_remainder;         /**< Remainder for OUT datagram alignment */
+    uint16_t out_alignment;         /**< Alignment of OUT NDPs */
+    uint16_t out_max_datagrams;     /**< Maximum number of datagrams in an
+                                         OUT NTB, 0 for no limit */
+} usb_req_cdcncm_ntb_params_t;
+
+/**
+ * @brief USB CDC NCM 16 bit NTB header (NTH16)
+ *
+ * @see USB CDC NCM 1.0 spec table 3-1
+ */
+typedef struct __attribute__((packed)) {
+    uint32_t signature;     /**< @ref USB_CDC_NCM_NTH16_SIGNATURE */
+    uint16_t header_len;    /**< Size of this header */
+    uint16_t sequence;      /**< Sequence number of the NTB */
+    uint16_t block_len;     /**< Size of the NTB */
+    uint16_t ndp_index;     /**< Offset of the first NDP in the NTB */
+} usb_cdcncm_nth16_t;
+
+/**
+ * @brief USB CDC NCM 16 bit datagram pointer entry
+ */
+typedef struct __attribute__((packed)) {
+    uint16_t index;         /**< Offset of the datagram in the NTB */
+    uint16_t len;           /**< Size of the datagram */
+} usb_cdcncm_dpe16_t;
+
+/**
+ * @brief USB CDC NCM 16 bit datagram pointer table (NDP16) header
+ *
+ * The header is followed by a list of @ref usb_cdcncm_dpe16_t, terminated by
+ * an all-zero entry.
+ *
+ * @see USB CDC NCM 1.0 spec table 3-3
+ */
+typedef struct __attribute__((packed)) {
+    uint32_t signature;     /**< @ref USB_CDC_NCM_NDP16_SIGNATURE */
+    uint16_t len;           /**< Size of the NDP, including the entries */
+    uint16_t next_index;    /**< Offset of the next NDP in the NTB or zero */
+} usb_cdcncm_ndp16_t;
+
 /**
  * @name USB CDC ACM line coding setup defines
  * @{
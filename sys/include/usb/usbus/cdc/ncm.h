@@ -0,0 +1,211 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for
+ * more details.
+ */
+
+/**
+ * @defgroup    usbus_cdc_ncm USBUS CDC NCM - USBUS CDC network control model
+ * @ingroup     usb
+ * @brief       USBUS CDC NCM interface module
+ *
+ * Ethernet frames are exchanged with the host in Network Transfer Blocks
+ * (NTBs), each of which can hold multiple frames. An NTB is moved in a single
+ * bulk transfer.
+ *
+ * Frames sent while the previous IN NTB is still being transferred are
+ * collected in a second NTB, which is sent as soon as the first one
+ * completes. Two OUT NTBs are used so that the host can send the next NTB
+ * while the frames of the previous one are passed to the network stack.
+ * Frames are written to and read from the NTBs in place.
+ *
+ * Only the 16 bit NTB format is supported, without CRC.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Interface and definitions for USB CDC NCM type interfaces
+ *
+ * @author      agent <agent@local>
+ */
+
+#ifndef USB_USBUS_CDC_NCM_H
+#define USB_USBUS_CDC_NCM_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "event.h"
+#include "mutex.h"
+#include "net/ethernet.h"
+#include "net/netdev.h"
+#include "usb/usbus.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Link throughput as reported by the peripheral
+ *
+ * This defines a common up and down link throughput in bits/second. The USB
+ * peripheral will report this to the host. This doesn't affect the actual
+ * throughput, only what the peripheral reports to the host.
+ */
+#ifndef CONFIG_USBUS_CDC_NCM_CONFIG_SPEED
+#define CONFIG_USBUS_CDC_NCM_CONFIG_SPEED  1000000
+#endif
+
+/**
+ * @brief Link download speed as reported by the peripheral
+ */
+#ifndef CONFIG_USBUS_CDC_NCM_CONFIG_SPEED_DOWNSTREAM
+#define CONFIG_USBUS_CDC_NCM_CONFIG_SPEED_DOWNSTREAM CONFIG_USBUS_CDC_NCM_CONFIG_SPEED
+#endif
+
+/**
+ * @brief Link upload speed as reported by the peripheral
+ */
+#ifndef CONFIG_USBUS_CDC_NCM_CONFIG_SPEED_UPSTREAM
+#define CONFIG_USBUS_CDC_NCM_CONFIG_SPEED_UPSTREAM   CONFIG_USBUS_CDC_NCM_CONFIG_SPEED
+#endif
+
+/**
+ * @brief Size of the IN (device to host) NTB buffers
+ *
+ * Two buffers of this size are used. This is the maximum reported to the
+ * host, the host may ask for smaller NTBs. Must be a multiple of 4 and at
+ * least 2048.
+ */
+#ifndef CONFIG_USBUS_CDC_NCM_NTB_IN_SIZE
+#define CONFIG_USBUS_CDC_NCM_NTB_IN_SIZE    2048
+#endif
+
+/**
+ * @brief Size of the OUT (host to device) NTB buffers
+ *
+ * Two buffers of this size are used. Must be a multiple of 4 and at least
+ * 2048.
+ */
+#ifndef CONFIG_USBUS_CDC_NCM_NTB_OUT_SIZE
+#define CONFIG_USBUS_CDC_NCM_NTB_OUT_SIZE   2048
+#endif
+
+/**
+ * @brief Maximum number of frames sent in a single IN NTB
+ */
+#ifndef CONFIG_USBUS_CDC_NCM_IN_DATAGRAMS_MAX
+#define CONFIG_USBUS_CDC_NCM_IN_DATAGRAMS_MAX   8
+#endif
+
+/**
+ * @brief CDC NCM interrupt endpoint size.
+ *
+ * Used by the device to report events to the host.
+ *
+ * @note Must be at least 16B to allow for reporting the link throughput
+ */
+#define USBUS_CDCNCM_EP_CTRL_SIZE  16
+
+/**
+ * @brief CDC NCM bulk data endpoint size.
+ */
+#ifndef MODULE_PERIPH_USBDEV_HS
+#define USBUS_CDCNCM_EP_DATA_SIZE  64
+#else
+#define USBUS_CDCNCM_EP_DATA_SIZE  512
+#endif
+
+/**
+ * @brief Number of IN EPs required for the CDC NCM interface
+ */
+#define USBUS_CDC_NCM_EP_IN_REQUIRED_NUMOF   2
+
+/**
+ * @brief Number of Out EPs required for the CDC NCM interface
+ */
+#define USBUS_CDC_NCM_EP_OUT_REQUIRED_NUMOF  1
+
+/**
+ * @brief notification state, used to track which information must be send to
+ * the host
+ */
+typedef enum {
+    USBUS_CDCNCM_NOTIF_NONE,    /**< Nothing notified so far */
+    USBUS_CDCNCM_NOTIF_LINK_UP, /**< Link status is notified */
+    USBUS_CDCNCM_NOTIF_SPEED,   /**< Link speed is notified */
+} usbus_cdcncm_notif_t;
+
+/**
+ * @brief USBUS CDC NCM device interface context
+ */
+typedef struct usbus_cdcncm_device {
+    usbus_handler_t handler_ctrl;           /**< Control interface handler */
+    usbus_interface_t iface_data;           /**< Data interface */
+    usbus_interface_t iface_ctrl;           /**< Control interface */
+    usbus_interface_alt_t iface_data_alt;   /**< Data alternative (active) interface */
+    usbus_endpoint_t *ep_in;                /**< Data endpoint in */
+    usbus_endpoint_t *ep_out;               /**< Data endpoint out */
+    usbus_endpoint_t *ep_ctrl;              /**< Control endpoint */
+    usbus_descr_gen_t ncm_descr;            /**< NCM descriptor generator */
+    event_t rx_flush;                       /**< OUT NTB processed event */
+    event_t tx_xmit;                        /**< Frames ready for IN event */
+    netdev_t netdev;                        /**< Netdev context struct */
+    uint8_t mac_netdev[ETHERNET_ADDR_LEN];  /**< this device's MAC address */
+    char mac_host[13];                      /**< host side's MAC address as string */
+    usbus_string_t mac_str;                 /**< String context for the host side mac address */
+    usbus_t *usbus;                         /**< Ptr to the USBUS context */
+    mutex_t tx_lock;                        /**< Protects the IN NTB state */
+    mutex_t tx_space;                       /**< Unlocked when an IN NTB is sent */
+    uint32_t ntb_in_size;                   /**< Maximum IN NTB size, set by the host */
+    uint16_t tx_len;                        /**< Bytes used in the IN NTB being filled */
+    uint16_t tx_seq;                        /**< Sequence number of the next IN NTB */
+    uint8_t tx_fill;                        /**< Index of the IN NTB being filled */
+    uint8_t tx_num;                         /**< Frames in the IN NTB being filled */
+    bool tx_busy;                           /**< The other IN NTB is being transferred */
+    bool rx_busy;                           /**< An OUT NTB is passed to netdev */
+    uint8_t rx_urb;                         /**< Index of the OUT NTB being received */
+    bool rx_pending;                        /**< The other OUT NTB waits for netdev */
+    uint16_t rx_len[2];                     /**< Bytes received per OUT NTB */
+    uint16_t rx_ndp;                        /**< Offset of the current NDP */
+    uint16_t rx_dpe;                        /**< Offset of the next frame entry,
+                                                 0 if the OUT NTB is processed */
+    uint8_t rx_cur;                         /**< Index of the OUT NTB passed to netdev */
+    usbus_cdcncm_notif_t notif;             /**< Startup message notification tracker */
+    unsigned active_iface;                  /**< Current active data interface */
+
+    /**
+     * @brief NTBs received from the host
+     */
+    usbdev_ep_buf_t data_out[2][CONFIG_USBUS_CDC_NCM_NTB_OUT_SIZE];
+
+    /**
+     * @brief NTBs sent to the host
+     */
+    usbdev_ep_buf_t data_in[2][CONFIG_USBUS_CDC_NCM_NTB_IN_SIZE];
+
+    /**
+     * @brief Host out device in control buffer
+     */
+    usbdev_ep_buf_t control_in[USBUS_CDCNCM_EP_CTRL_SIZE];
+
+    usbus_urb_t out_urb;                    /**< Host out device in reception URB */
+    usbus_urb_t in_urb;                     /**< Host in device out transmission URB */
+} usbus_cdcncm_device_t;
+
+/**
+ * @brief CDC NCM initialization function
+ *
+ * @param   usbus   USBUS thread to use
+ * @param   handler CDCNCM device struct
+ */
+void usbus_cdcncm_init(usbus_t *usbus, usbus_cdcncm_device_t *handler);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* USB_USBUS_CDC_NCM_H */
+/** @} */
@@ -221,6 +221,10 @@ extern "C" {
 #ifndef VFS_MAX_OPEN_FILES
 /**
  * @brief Maximum number of simultaneous open files
+ *
+ * Free file descriptors are looked up in a bitmap, so applications that keep
+ * many files open, e.g. multi-threaded file servers, can raise this at the
+ * cost of one @ref vfs_file_t per entry without slowing down `open()`.
  */
 #define VFS_MAX_OPEN_FILES (16)
 #endif
@@ -387,6 +391,7 @@ struct vfs_mount_struct {
     const vfs_file_system_t *fs; /**< The file system driver for the mount point */
     const char *mount_point;     /**< Mount point, e.g. "/mnt/cdrom" */
     size_t mount_point_len;      /**< Length of mount_point string (set by vfs_mount) */
+    vfs_mount_t *index_next;     /**< Next mount in the lookup index (internal) */
     uint16_t open_files;         /**< Number of currently open files and directories */
     void *private_data;          /**< File system driver private data, implementation defined */
 };
@@ -548,6 +553,51 @@ struct vfs_file_ops {
      */
     ssize_t (*read) (vfs_file_t *filp, void *dest, size_t nbytes);
 
+    /**
+     * @brief Reference bytes of an open file without copying them
+     *
+     * For file systems storing file contents in addressable memory. Points
+     * @p iol at up to @p nbytes bytes of the file at the current position and
+     * advances the position, like read() would. The referenced data must stay
+     * valid after the file is closed, until it is modified or its file system
+     * is unmounted.
+     *
+     * May be NULL, in which case the data is read into a caller supplied
+     * buffer.
+     *
+     * @param[in]  filp     pointer to open file
+     * @param[out] iol      iolist element to point at the file contents
+     * @param[in]  nbytes   maximum number of bytes to reference
+     *
+     * @return number of bytes referenced on success
+     * @return -ENOTSUP if the data at the current position is not addressable
+     * @return <0 on other errors
+     */
+    ssize_t (*read_iol) (vfs_file_t *filp, iolist_t *iol, size_t nbytes);
+
+    /**
+     * @brief Map a part of an open file for reading
+     *
+     * For file systems storing file contents contiguously in addressable
+     * memory. The file position is not changed. The mapping must stay valid
+     * after the file is closed, until the file is modified or its file system
+     * is unmounted.
+     *
+     * May be NULL, in which case the data is read into a caller supplied
+     * buffer.
+     *
+     * @param[in]  filp     pointer to open file
+     * @param[in]  off      offset of the mapping in the file
+     * @param[in]  len      maximum length of the mapping
+     * @param[out] addr     start of the mapping
+     *
+     * @return number of bytes mapped on success, 0 if @p off is at or past
+     *         the end of the file
+     * @return -ENOTSUP if the file is not memory mapped
+     * @return <0 on other errors
+     */
+    ssize_t (*mmap) (vfs_file_t *filp, off_t off, size_t len, const void **addr);
+
     /**
      * @brief Write bytes to an open file
      *
@@ -853,6 +903,54 @@ int vfs_open(const char *name, int flags, mode_t mode);
  */
 ssize_t vfs_read(int fd, void *dest, size_t count);
 
+/**
+ * @brief Read bytes from an open file into an iolist element
+ *
+ * Zero-copy variant of @ref vfs_read for sending file contents: If the file
+ * system can reference the file contents in place, @p iol is pointed at them
+ * and @p buf is left untouched. Otherwise the data is read into @p buf and
+ * @p iol is pointed at @p buf. Either way, @p iol can be passed on to e.g.
+ * @ref sock_udp_sendv without copying the data again. Data referenced in place
+ * stays valid after closing the file, until the file is modified or its file
+ * system is unmounted.
+ *
+ * @p iol->iol_next is not modified.
+ *
+ * @param[in]  fd       fd number obtained from vfs_open
+ * @param[out] iol      iolist element to point at the data
+ * @param[out] buf      fallback buffer of at least @p count bytes
+ * @param[in]  count    maximum number of bytes to read
+ *
+ * @return number of bytes read on success
+ * @return <0 on error
+ */
+ssize_t vfs_read_iol(int fd, iolist_t *iol, void *buf, size_t count);
+
+/**
+ * @brief Map a part of an open file for reading
+ *
+ * Gives access to file contents without copying them to RAM if the file system
+ * stores them in addressable memory, e.g. constfs or a file system on memory
+ * mapped flash. Data mapped in place stays valid after closing the file, until
+ * the file is modified or its file system is unmounted.
+ *
+ * If the file can't be mapped and @p buf is not NULL, the data is read into
+ * @p buf instead, and @p addr is set to @p buf. The file position is not
+ * changed in either case.
+ *
+ * @param[in]  fd       fd number obtained from vfs_open
+ * @param[in]  off      offset of the mapping in the file
+ * @param[in]  len      maximum length of the mapping
+ * @param[out] buf      fallback buffer of at least @p len bytes, may be NULL
+ * @param[out] addr     start of the mapping
+ *
+ * @return number of bytes mapped on success, less than @p len at the end of
+ *         the file
+ * @return -ENOTSUP if the file can't be mapped and @p buf is NULL
+ * @return <0 on other errors
+ */
+ssize_t vfs_mmap(int fd, off_t off, size_t len, void *buf, const void **addr);
+
 /**
  * @brief Read a line from an open text file
  *
@@ -0,0 +1,217 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for more
+ * details.
+ */
+
+/**
+ * @defgroup    sys_vfs_cache   VFS page cache
+ * @ingroup     sys_vfs
+ * @brief       Page cache and read-ahead for VFS file reads
+ *
+ * When this module is used, reads on files opened read-only are served from a
+ * small, statically allocated page cache shared by all mounts. Pages are
+ * looked up by mount and path, so a file that is opened again (e.g. for every
+ * block of a nanocoap fileserver transfer) is not read from the file system
+ * again. If reads on a file are sequential, the following
+ * @ref CONFIG_VFS_CACHE_READAHEAD pages are filled along with a missed page,
+ * without seeking the underlying file in between.
+ *
+ * Cached pages of a file are invalidated when it is written to, truncated,
+ * renamed or unlinked through the VFS, and when its file system is unmounted
+ * or formatted. Modifications that bypass the VFS (e.g. writing to the
+ * underlying MTD device directly) are not noticed, call @ref vfs_cache_drop
+ * after doing so.
+ *
+ * Reads of at least one page that start at an uncached page boundary are
+ * passed to the file system directly.
+ *
+ * @{
+ *
+ * @file
+ * @brief       VFS page cache
+ *
+ * @author      agent <agent@local>
+ */
+
+#ifndef VFS_CACHE_H
+#define VFS_CACHE_H
+
+#include <stdint.h>
+#include <sys/types.h>
+
+#include "vfs.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup    sys_vfs_cache_config    VFS page cache compile time configuration
+ * @ingroup     config
+ * @{
+ */
+/**
+ * @brief   Memory used for cached file data in bytes
+ */
+#ifndef CONFIG_VFS_CACHE_SIZE
+#define CONFIG_VFS_CACHE_SIZE       (1024)
+#endif
+
+/**
+ * @brief   Size of a cache page in bytes
+ */
+#ifndef CONFIG_VFS_CACHE_PAGE_SIZE
+#define CONFIG_VFS_CACHE_PAGE_SIZE  (128)
+#endif
+
+/**
+ * @brief   Maximum number of files with cached pages
+ *
+ * Every open file uses an entry as long as it is open.
+ */
+#ifndef CONFIG_VFS_CACHE_FILES
+#define CONFIG_VFS_CACHE_FILES      (4)
+#endif
+
+/**
+ * @brief   Maximum length of a file path (relative to its mount point)
+ *          including the terminating zero
+ *
+ * Files with longer paths are not cached.
+ */
+#ifndef CONFIG_VFS_CACHE_PATH_MAX
+#define CONFIG_VFS_CACHE_PATH_MAX   (64)
+#endif
+
+/**
+ * @brief   Number of pages read ahead when sequential access is detected
+ */
+#ifndef CONFIG_VFS_CACHE_READAHEAD
+#define CONFIG_VFS_CACHE_READAHEAD  (2)
+#endif
+/** @} */
+
+/**
+ * @brief   Number of cache pages
+ */
+#define VFS_CACHE_PAGES     (CONFIG_VFS_CACHE_SIZE / CONFIG_VFS_CACHE_PAGE_SIZE)
+
+/**
+ * @brief   Page cache statistics
+ */
+typedef struct {
+    uint32_t hits;          /**< pages read from the cache */
+    uint32_t misses;        /**< pages read from the file system */
+    uint32_t readahead;     /**< pages read ahead of time */
+} vfs_cache_stats_t;
+
+/**
+ * @brief   Get the page cache statistics
+ *
+ * @param[out] stats    statistics
+ */
+void vfs_cache_stats(vfs_cache_stats_t *stats);
+
+/**
+ * @brief   Drop all cached pages
+ */
+void vfs_cache_drop(void);
+
+/**
+ * @name    Hooks called by the VFS layer
+ * @internal
+ * @{
+ */
+/**
+ * @brief   Attach an opened file to the cache
+ *
+ * @param[in]  fd       file descriptor
+ * @param[in]  mp       mount of the file
+ * @param[in]  rel_path path of the file as passed to the file system
+ * @param[in]  flags    open flags
+ */
+void vfs_cache_open(int fd, const vfs_mount_t *mp, const char *rel_path, int flags);
+
+/**
+ * @brief   Detach a file from the cache before it is closed
+ *
+ * @param[in]  fd       file descriptor
+ */
+void vfs_cache_close(int fd);
+
+/**
+ * @brief   Read from a file through the cache
+ *
+ * @param[in]  fd       file descriptor
+ * @param[in]  filp     open file
+ * @param[out] dest     destination buffer
+ * @param[in]  count    number of bytes to read
+ *
+ * @return  number of bytes read, 0 at the end of file
+ * @return  <0 on error
+ */
+ssize_t vfs_cache_read(int fd, vfs_file_t *filp, void *dest, size_t count);
+
+/**
+ * @brief   Prepare an operation depending on the file position of @p filp
+ *
+ * Moves the position of the file system driver to the position seen by the
+ * user, as cache hits don't advance the former.
+ *
+ * @param[in]  fd       file descriptor
+ * @param[in]  filp     open file
+ */
+void vfs_cache_sync(int fd, vfs_file_t *filp);
+
+/**
+ * @brief   Record the position of a file after a seek
+ *
+ * @param[in]  fd       file descriptor
+ * @param[in]  pos      new file position
+ */
+void vfs_cache_seek(int fd, off_t pos);
+
+/**
+ * @brief   Advance the position of a file after data was read without the
+ *          cache, following @ref vfs_cache_sync
+ *
+ * @param[in]  fd       file descriptor
+ * @param[in]  count    number of bytes read
+ */
+void vfs_cache_skip(int fd, size_t count);
+
+/**
+ * @brief   Invalidate the cached pages of a file after it was written to
+ *
+ * Returns without locking for file descriptors without cached pages, such as
+ * stdio, so it may be called from interrupt context for those.
+ *
+ * @param[in]  fd       file descriptor
+ */
+void vfs_cache_write(int fd);
+
+/**
+ * @brief   Invalidate the cached pages of a file that is renamed or unlinked
+ *
+ * @param[in]  mp       mount of the file
+ * @param[in]  rel_path path of the file as passed to the file system
+ */
+void vfs_cache_invalidate_path(const vfs_mount_t *mp, const char *rel_path);
+
+/**
+ * @brief   Invalidate all cached pages of a mount
+ *
+ * @param[in]  mp       mount
+ */
+void vfs_cache_invalidate_mount(const vfs_mount_t *mp);
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VFS_CACHE_H */
+/** @} */
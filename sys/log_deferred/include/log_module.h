@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_log_deferred log_deferred: binary log module
+ * @ingroup     sys
+ * @brief       Log module that leaves formatting to the host
+ *
+ * Instead of formatting the message with printf, `LOG_*()` only stores the
+ * address of the format string and the arguments in a ring buffer. A low
+ * priority thread writes the records as binary frames to stdio, where
+ * `dist/tools/log_deferred/log_deferred.py` formats them using the ELF file
+ * of the application. Logging thereby costs a few stores with interrupts
+ * disabled instead of a call to printf and a blocking write to stdio.
+ *
+ * The arguments are stored when the message is logged, so only values can be
+ * logged:
+ *
+ * - Every argument is stored as `uintptr_t`. 64 bit integers are truncated on
+ *   platforms with 32 bit pointers and floating point values are truncated to
+ *   integers.
+ * - Strings (`%s`) are printed only if they point into the read-only data of
+ *   the application, e.g. string literals. The format string itself must be a
+ *   string literal too.
+ * - At most @ref LOG_DEFERRED_ARGS_MAX arguments are allowed.
+ *
+ * If the ring buffer is full, messages are dropped. The number of dropped
+ * messages is reported to the host.
+ *
+ * Text written to stdio by other means, e.g. `printf()`, passes the host
+ * script unchanged. The frames use the following format:
+ *
+ * | Offset | Size                 | Content                                 |
+ * |--------|----------------------|-----------------------------------------|
+ * | 0      | 1                    | @ref LOG_DEFERRED_FRAME_START           |
+ * | 1      | 1                    | Frame type                              |
+ *
+ * For @ref LOG_DEFERRED_FRAME_RECORD, this is followed by the log level, the
+ * PID of the logging thread (0 for interrupt context), the number of
+ * arguments and the address of the format string and the arguments, each as
+ * `uintptr_t` in the byte order of the device. For
+ * @ref LOG_DEFERRED_FRAME_DROPPED, it is followed by the number of dropped
+ * messages as `uintptr_t`.
+ *
+ * @{
+ *
+ * @file
+ * @brief       log_module header
+ *
+ * @author      agent <agent@local>
+ */
+
+#ifndef LOG_MODULE_H
+#define LOG_MODULE_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Size of the ring buffer for log records in bytes
+ *
+ * A record takes two words and one word per argument. Must be a power of two.
+ */
+#ifndef CONFIG_LOG_DEFERRED_BUFSIZE
+#define CONFIG_LOG_DEFERRED_BUFSIZE     (512U)
+#endif
+
+/**
+ * @brief   Maximum number of arguments of a log message
+ */
+#define LOG_DEFERRED_ARGS_MAX           (8U)
+
+/**
+ * @name    Frame format
+ * @{
+ */
+#define LOG_DEFERRED_FRAME_START        (0x1e)  /**< Start of a frame (ASCII RS) */
+#define LOG_DEFERRED_FRAME_RECORD       ('L')   /**< Log message */
+#define LOG_DEFERRED_FRAME_DROPPED      ('D')   /**< Messages were dropped */
+/** @} */
+
+/**
+ * @brief   Stores a log message in the ring buffer
+ *
+ * Use @ref log_write or the `LOG_*()` macros instead.
+ *
+ * @param[in] level     Log level of the message
+ * @param[in] nargs     Number of arguments
+ * @param[in] words     Address of the format string, followed by @p nargs
+ *                      arguments
+ */
+void log_deferred_write(unsigned level, unsigned nargs, const uintptr_t *words);
+
+/**
+ * @brief   Writes all stored log messages to stdio
+ *
+ * Blocks until the messages are written. This is done by the log thread, but
+ * can be called e.g. before rebooting to get all messages out.
+ *
+ * @note    Must be called from thread context.
+ */
+void log_deferred_flush(void);
+
+/**
+ * @brief   Starts the log thread
+ *
+ * Called by auto_init, unless `auto_init_log_deferred` is disabled. Messages
+ * are stored in the meantime.
+ */
+void log_deferred_init(void);
+
+#ifndef DOXYGEN
+/* Number of words for the format string and the arguments */
+#define _LOG_DEFERRED_NTH(_1, _2, _3, _4, _5, _6, _7, _8, _9, N, ...) N
+#define _LOG_DEFERRED_NWORDS(...) \
+    _LOG_DEFERRED_NTH(__VA_ARGS__, 9, 8, 7, 6, 5, 4, 3, 2, 1, ~)
+
+/* Casts each argument to a word */
+#define _LOG_DEFERRED_W1(a)         (uintptr_t)(a)
+#define _LOG_DEFERRED_W2(a, ...)    (uintptr_t)(a), _LOG_DEFERRED_W1(__VA_ARGS__)
+#define _LOG_DEFERRED_W3(a, ...)    (uintptr_t)(a), _LOG_DEFERRED_W2(__VA_ARGS__)
+#define _LOG_DEFERRED_W4(a, ...)    (uintptr_t)(a), _LOG_DEFERRED_W3(__VA_ARGS__)
+#define _LOG_DEFERRED_W5(a, ...)    (uintptr_t)(a), _LOG_DEFERRED_W4(__VA_ARGS__)
+#define _LOG_DEFERRED_W6(a, ...)    (uintptr_t)(a), _LOG_DEFERRED_W5(__VA_ARGS__)
+#define _LOG_DEFERRED_W7(a, ...)    (uintptr_t)(a), _LOG_DEFERRED_W6(__VA_ARGS__)
+#define _LOG_DEFERRED_W8(a, ...)    (uintptr_t)(a), _LOG_DEFERRED_W7(__VA_ARGS__)
+#define _LOG_DEFERRED_W9(a, ...)    (uintptr_t)(a), _LOG_DEFERRED_W8(__VA_ARGS__)
+#define _LOG_DEFERRED_WORDS_(n, ...) _LOG_DEFERRED_W ## n(__VA_ARGS__)
+#define _LOG_DEFERRED_WORDS(n, ...) _LOG_DEFERRED_WORDS_(n, __VA_ARGS__)
+#endif
+
+/**
+ * @brief   log_write overridden function
+ *
+ * Stores the message, it is formatted by the host.
+ *
+ * @param[in] level     Log level of the message
+ * @param[in] ...       Format string literal and arguments
+ */
+#define log_write(level, ...) do { \
+        const uintptr_t _log_words[] = { \
+            _LOG_DEFERRED_WORDS(_LOG_DEFERRED_NWORDS(__VA_ARGS__), __VA_ARGS__) \
+        }; \
+        log_deferred_write((level), \
+                           sizeof(_log_words) / sizeof(_log_words[0]) - 1, \
+                           _log_words); \
+    } while (0)
+
+#ifdef __cplusplus
+}
+#endif
+/**@}*/
+#endif /* LOG_MODULE_H */
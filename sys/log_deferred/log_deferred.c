@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @addtogroup  sys_log_deferred
+ * @{
+ *
+ * @file
+ * @brief       Deferred binary logging
+ *
+ * @author      agent <agent@local>
+ * @}
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "irq.h"
+#include "log.h"
+#include "mutex.h"
+#include "stdio_base.h"
+#include "thread.h"
+#include "thread_flags.h"
+
+#ifndef LOG_DEFERRED_PRIO
+/**
+ * @brief   Priority of the log thread, just above idle
+ */
+#define LOG_DEFERRED_PRIO       (THREAD_PRIORITY_IDLE - 1)
+#endif
+
+#ifndef LOG_DEFERRED_STACKSIZE
+/**
+ * @brief   Stack size of the log thread
+ */
+#define LOG_DEFERRED_STACKSIZE  (THREAD_STACKSIZE_SMALL)
+#endif
+
+#define LOG_DEFERRED_FLAG       (1U << 0)
+
+/* ring buffer size in words */
+#define RING_WORDS              (CONFIG_LOG_DEFERRED_BUFSIZE / sizeof(uintptr_t))
+#define RING_MASK               (RING_WORDS - 1)
+
+/* frame start, type, level, pid and nargs, followed by the words */
+#define FRAME_HDR_LEN           (5U)
+#define FRAME_LEN_MAX           (FRAME_HDR_LEN + \
+                                 (LOG_DEFERRED_ARGS_MAX + 1) * sizeof(uintptr_t))
+
+static_assert((RING_WORDS & RING_MASK) == 0,
+              "CONFIG_LOG_DEFERRED_BUFSIZE must be a power of two");
+static_assert(RING_WORDS >= LOG_DEFERRED_ARGS_MAX + 2,
+              "CONFIG_LOG_DEFERRED_BUFSIZE too small for a single record");
+
+static uintptr_t _ring[RING_WORDS];
+static unsigned _read;
+static unsigned _write;
+static unsigned _dropped;
+static thread_t *_thread;
+static mutex_t _lock = MUTEX_INIT;
+static char _stack[LOG_DEFERRED_STACKSIZE];
+
+void log_deferred_write(unsigned level, unsigned nargs, const uintptr_t *words)
+{
+    /* header: level, pid and number of arguments */
+    uintptr_t hdr = level | (nargs << 16);
+
+    if (!irq_is_in()) {
+        hdr |= (uintptr_t)(thread_getpid() & 0xff) << 8;
+    }
+
+    unsigned state = irq_disable();
+
+    if (RING_WORDS - (_write - _read) < nargs + 2) {
+        _dropped++;
+        irq_restore(state);
+        return;
+    }
+
+    bool empty = _write == _read;
+
+    _ring[_write++ & RING_MASK] = hdr;
+    for (unsigned i = 0; i <= nargs; i++) {
+        _ring[_write++ & RING_MASK] = words[i];
+    }
+    irq_restore(state);
+
+    /* The log thread empties the ring before waiting again */
+    if (empty && _thread) {
+        thread_flags_set(_thread, LOG_DEFERRED_FLAG);
+    }
+}
+
+/* Takes the next frame from the ring, returns its length or 0 if empty */
+static size_t _pull(uint8_t *frame)
+{
+    uintptr_t words[LOG_DEFERRED_ARGS_MAX + 1];
+    uintptr_t hdr;
+    unsigned nargs;
+
+    unsigned state = irq_disable();
+
+    if (_read == _write) {
+        /* report dropped messages after the ones stored before them */
+        uintptr_t dropped = _dropped;
+
+        _dropped = 0;
+        irq_restore(state);
+        if (!dropped) {
+            return 0;
+        }
+        frame[0] = LOG_DEFERRED_FRAME_START;
+        frame[1] = LOG_DEFERRED_FRAME_DROPPED;
+        memcpy(&frame[2], &dropped, sizeof(dropped));
+        return 2 + sizeof(dropped);
+    }
+    hdr = _ring[_read++ & RING_MASK];
+    nargs = hdr >> 16;
+    for (unsigned i = 0; i <= nargs; i++) {
+        words[i] = _ring[_read++ & RING_MASK];
+    }
+    irq_restore(state);
+
+    frame[0] = LOG_DEFERRED_FRAME_START;
+    frame[1] = LOG_DEFERRED_FRAME_RECORD;
+    frame[2] = hdr & 0xff;
+    frame[3] = (hdr >> 8) & 0xff;
+    frame[4] = nargs;
+    memcpy(&frame[FRAME_HDR_LEN], words, (nargs + 1) * sizeof(uintptr_t));
+    return FRAME_HDR_LEN + (nargs + 1) * sizeof(uintptr_t);
+}
+
+void log_deferred_flush(void)
+{
+    uint8_t frame[FRAME_LEN_MAX];
+    size_t len;
+
+    /* keeps the frames of concurrent flushes apart */
+    mutex_lock(&_lock);
+    while ((len = _pull(frame))) {
+        stdio_write(frame, len);
+    }
+    mutex_unlock(&_lock);
+}
+
+static void *_log_thread(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        log_deferred_flush();
+        thread_flags_wait_any(LOG_DEFERRED_FLAG);
+    }
+    return NULL;
+}
+
+void log_deferred_init(void)
+{
+    kernel_pid_t pid = thread_create(_stack, sizeof(_stack), LOG_DEFERRED_PRIO,
+                                     0, _log_thread, NULL, "log");
+
+    assert(pid_is_valid(pid));
+    _thread = thread_get(pid);
+}
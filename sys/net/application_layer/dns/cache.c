@@ -15,7 +15,9 @@
  * @}
  */
 
-#include "bitfield.h"
+#include <errno.h>
+#include <string.h>
+
 #include "checksum/fletcher32.h"
 #include "mutex.h"
 #include "net/af.h"
@@ -28,9 +30,19 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+/* entry holds a name */
+#define FLAG_VALID      (0x01)
+/* entry records that the name does not exist */
+#define FLAG_NEGATIVE   (0x02)
+/* a caller was asked to refresh the expired entry */
+#define FLAG_REFRESH    (0x04)
+
 static struct dns_cache_entry {
     uint32_t hash;
     uint32_t expires;
+    uint32_t used;      /**< value of @ref use_count when last used */
+    uint8_t flags;
+    uint8_t len;        /**< address length */
     union {
 #if IS_ACTIVE(CONFIG_DNS_CACHE_A)
         ipv4_addr_t v4;
@@ -40,60 +52,15 @@ static struct dns_cache_entry {
 #endif
     } addr;
 } cache[CONFIG_DNS_CACHE_SIZE];
+static uint32_t use_count;
 static mutex_t cache_mutex = MUTEX_INIT;
 
-#if IS_ACTIVE(CONFIG_DNS_CACHE_A) && IS_ACTIVE(CONFIG_DNS_CACHE_AAAA)
-BITFIELD(cache_is_v6, CONFIG_DNS_CACHE_SIZE);
-
-static inline uint8_t _get_len(unsigned idx)
-{
-    return bf_isset(cache_is_v6, idx) ? 16 : 4;
-}
-#elif IS_ACTIVE(CONFIG_DNS_CACHE_A)
-static inline uint8_t _get_len(unsigned idx)
-{
-    (void)idx;
-    return 4;
-}
-#elif IS_ACTIVE(CONFIG_DNS_CACHE_AAAA)
-static inline uint8_t _get_len(unsigned idx)
-{
-    (void)idx;
-    return 16;
-}
-#endif
-
-static void _set_len(unsigned idx, uint8_t len)
-{
-#if IS_ACTIVE(CONFIG_DNS_CACHE_A) && IS_ACTIVE(CONFIG_DNS_CACHE_AAAA)
-    if (len == 16) {
-        bf_set(cache_is_v6, idx);
-    } else {
-        bf_unset(cache_is_v6, idx);
-    }
+#if IS_USED(MODULE_DNS_CACHE_STATS)
+static dns_cache_stats_t stats;
+#define STATS_INC(field)    (stats.field++)
 #else
-    (void)idx;
-    (void)len;
+#define STATS_INC(field)
 #endif
-}
-
-static bool _is_empty(unsigned idx)
-{
-    const uint8_t len = _get_len(idx);
-    const uint8_t *addr = (void *)&cache[idx].addr;
-    for (unsigned i = 0; i < len; ++i) {
-        if (addr[i]) {
-            return false;
-        }
-    }
-
-    return true;
-}
-
-static void _set_empty(unsigned idx)
-{
-    memset(&cache[idx].addr, 0, _get_len(idx));
-}
 
 static uint8_t _addr_len(int family)
 {
@@ -118,90 +85,189 @@ static uint32_t _hash(const void *data, size_t len)
     return fletcher32(data, (len + 1) / 2);
 }
 
-int dns_cache_query(const char *domain_name, void *addr_out, int family)
+/* entry can neither be used nor served stale anymore */
+static bool _is_gone(const struct dns_cache_entry *entry, uint32_t now)
+{
+    return !(entry->flags & FLAG_VALID) ||
+           (now > entry->expires + CONFIG_DNS_CACHE_STALE_TTL);
+}
+
+int dns_cache_query_stale(const char *domain_name, void *addr_out, int family,
+                          bool *stale)
 {
     int res = 0;
     uint32_t now = ztimer_now(ZTIMER_MSEC) / MS_PER_SEC;
     uint32_t hash = _hash(domain_name, strlen(domain_name));
     uint8_t addr_len = _addr_len(family);
 
+    if (stale) {
+        *stale = false;
+    }
+
     mutex_lock(&cache_mutex);
     for (unsigned i = 0; i < CONFIG_DNS_CACHE_SIZE; ++i) {
-        /* empty slot */
-        if (_is_empty(i)) {
+        struct dns_cache_entry *entry = &cache[i];
+
+        if (_is_gone(entry, now)) {
+            if (entry->flags) {
+                DEBUG("dns_cache[%u] expired\n", i);
+                entry->flags = 0;
+            }
             continue;
         }
-        /* TTL expired - invalidate slot */
-        if (now > cache[i].expires) {
-            DEBUG("dns_cache[%u] expired\n", i);
-            _set_empty(i);
+        /* check if hash and length match, a name that does not exist has
+         * no address of any family */
+        if ((entry->hash != hash) ||
+            (!(entry->flags & FLAG_NEGATIVE) &&
+             addr_len && (addr_len != entry->len))) {
             continue;
         }
-        /* check if hash and length match */
-        if (cache[i].hash == hash && (!addr_len || addr_len == _get_len(i))) {
-            DEBUG("dns_cache[%u] hit\n", i);
-            memcpy(addr_out, &cache[i].addr, _get_len(i));
-            res = _get_len(i);
+        if (now > entry->expires) {
+            /* only addresses are served stale */
+            if ((stale == NULL) || (entry->flags & FLAG_NEGATIVE)) {
+                continue;
+            }
+            DEBUG("dns_cache[%u] stale hit\n", i);
+            STATS_INC(stale_hits);
+            if (!(entry->flags & FLAG_REFRESH)) {
+                entry->flags |= FLAG_REFRESH;
+                *stale = true;
+            }
+        }
+        else if (entry->flags & FLAG_NEGATIVE) {
+            DEBUG("dns_cache[%u] negative hit\n", i);
+            STATS_INC(negative_hits);
+            entry->used = ++use_count;
+            res = -ENOENT;
             break;
         }
+        else {
+            DEBUG("dns_cache[%u] hit\n", i);
+            STATS_INC(hits);
+        }
+        entry->used = ++use_count;
+        memcpy(addr_out, &entry->addr, entry->len);
+        res = entry->len;
+        break;
     }
     if (res == 0) {
         DEBUG("dns_cache miss\n");
+        STATS_INC(misses);
     }
     mutex_unlock(&cache_mutex);
     return res;
 }
 
-static void _add_entry(uint8_t i, uint32_t hash, const void *addr_out,
-                       int addr_len, uint32_t expires)
+int dns_cache_query(const char *domain_name, void *addr_out, int family)
 {
-    DEBUG("dns_cache[%u] add cache entry\n", i);
-    cache[i].hash = hash;
-    cache[i].expires = expires;
-    memcpy(&cache[i].addr, addr_out, addr_len);
-    _set_len(i, addr_len);
+    return dns_cache_query_stale(domain_name, addr_out, family, NULL);
 }
 
-void dns_cache_add(const char *domain_name, const void *addr_out,
-                        int addr_len, uint32_t ttl)
+static void _add(const char *domain_name, const void *addr, int addr_len,
+                 uint32_t ttl, uint8_t flags)
 {
     uint32_t now = ztimer_now(ZTIMER_MSEC) / MS_PER_SEC;
     uint32_t hash = _hash(domain_name, strlen(domain_name));
-    uint32_t oldest = ttl;
-    int idx = -1;
+    int match = -1;
+    int free = -1;
+    int lru = -1;
 
-    assert(addr_len == 4 || addr_len == 16);
     DEBUG("dns_cache: lifetime of %s is %"PRIu32" s\n", domain_name, ttl);
 
     mutex_lock(&cache_mutex);
     /* iterate even if TTL = 0 just in case we need to expire */
     for (unsigned i = 0; i < CONFIG_DNS_CACHE_SIZE; ++i) {
-        if (ttl && (now > cache[i].expires || _is_empty(i))) {
-            _add_entry(i, hash, addr_out, addr_len, now + ttl);
-            goto exit;
+        struct dns_cache_entry *entry = &cache[i];
+
+        if (_is_gone(entry, now)) {
+            entry->flags = 0;
+            if (free < 0) {
+                free = i;
+            }
+            continue;
         }
-        if (cache[i].hash == hash && _get_len(i) == addr_len) {
-            DEBUG("dns_cache[%u] update ttl\n", i);
-            if (ttl) {
-                cache[i].expires = now + ttl;
+        /* a negative entry replaces all addresses of the name and the
+         * other way round */
+        if ((entry->hash == hash) &&
+            ((flags & FLAG_NEGATIVE) || (entry->flags & FLAG_NEGATIVE) ||
+             (entry->len == addr_len))) {
+            if (match < 0) {
+                match = i;
             }
             else {
-                /* put one second into past so that it is immediately expired */
-                cache[i].expires = now - 1;
+                entry->flags = 0;
             }
-            goto exit;
+            continue;
         }
-        uint32_t _ttl = cache[i].expires - now;
-        if (_ttl < oldest) {
-            oldest = _ttl;
-            idx = i;
+        if ((lru < 0) ||
+            ((use_count - entry->used) > (use_count - cache[lru].used))) {
+            lru = i;
         }
     }
 
-    if (ttl && idx >= 0) {
-        DEBUG("dns_cache: evict first entry to expire\n");
-        _add_entry(idx, hash, addr_out, addr_len, now + ttl);
+    int idx = match;
+    if (ttl == 0) {
+        if (idx >= 0) {
+            DEBUG("dns_cache[%u] drop entry\n", idx);
+            cache[idx].flags = 0;
+        }
+        goto exit;
+    }
+    if (idx < 0) {
+        idx = free;
+    }
+    if (idx < 0) {
+        DEBUG("dns_cache: evict least recently used entry\n");
+        STATS_INC(evictions);
+        idx = lru;
+    }
+
+    DEBUG("dns_cache[%u] add cache entry\n", idx);
+    cache[idx].hash = hash;
+    cache[idx].expires = now + ttl;
+    cache[idx].used = ++use_count;
+    cache[idx].flags = FLAG_VALID | flags;
+    cache[idx].len = addr_len;
+    if (addr_len) {
+        memcpy(&cache[idx].addr, addr, addr_len);
     }
 exit:
     mutex_unlock(&cache_mutex);
 }
+
+void dns_cache_add(const char *domain_name, const void *addr_out,
+                        int addr_len, uint32_t ttl)
+{
+    assert(addr_len == 4 || addr_len == 16);
+    _add(domain_name, addr_out, addr_len, ttl, 0);
+}
+
+void dns_cache_add_negative(const char *domain_name, uint32_t ttl)
+{
+    if (ttl > CONFIG_DNS_CACHE_NEGATIVE_TTL) {
+        ttl = CONFIG_DNS_CACHE_NEGATIVE_TTL;
+    }
+    _add(domain_name, NULL, 0, ttl, FLAG_NEGATIVE);
+}
+
+void dns_cache_refresh_done(const char *domain_name)
+{
+    uint32_t hash = _hash(domain_name, strlen(domain_name));
+
+    mutex_lock(&cache_mutex);
+    for (unsigned i = 0; i < CONFIG_DNS_CACHE_SIZE; ++i) {
+        if (cache[i].hash == hash) {
+            cache[i].flags &= ~FLAG_REFRESH;
+        }
+    }
+    mutex_unlock(&cache_mutex);
+}
+
+#if IS_USED(MODULE_DNS_CACHE_STATS)
+void dns_cache_stats_get(dns_cache_stats_t *out)
+{
+    mutex_lock(&cache_mutex);
+    *out = stats;
+    mutex_unlock(&cache_mutex);
+}
+#endif
@@ -21,6 +21,7 @@
 #include <assert.h>
 #include <string.h>
 
+#include "atomic_utils.h"
 #include "log.h"
 #include "mutex.h"
 #include "sched.h"
@@ -43,6 +44,13 @@
 #define TFLAGS_RESP         (0x0001)
 #define TFLAGS_TIMEOUT      (0x0002)
 #define TFLAGS_ANY          (TFLAGS_RESP | TFLAGS_TIMEOUT)
+#define TFLAGS_WINDOW       (0x0004)
+
+/* topics registered at once by emcute_reg_many() */
+#define REG_BATCH_MAX       (32U)
+
+#define PUB_WINDOW          (CONFIG_EMCUTE_PUB_WINDOW > 1)
+#define T_RETRY_US          (CONFIG_EMCUTE_T_RETRY * US_PER_SEC)
 
 static const char *cli_id;
 static sock_udp_t sock;
@@ -61,6 +69,32 @@ static volatile uint8_t waiton = 0xff;
 static volatile uint16_t waitonid = 0;
 static volatile int result;
 
+/* topics of the running emcute_reg_many() call and a bitmask of the ones
+ * still waiting for their REGACK */
+static emcute_topic_t *reg_topics;
+static uint16_t reg_first_id;
+static uint32_t reg_open;
+
+#if PUB_WINDOW
+/**
+ * @brief   QoS 1 PUBLISH message waiting for its PUBACK
+ */
+typedef struct {
+    uint32_t sent;                      /**< time of the last transmission */
+    uint16_t id;                        /**< message ID */
+    uint16_t len;                       /**< message length, 0 if unused */
+    uint8_t flags_pos;                  /**< position of the flags field */
+    uint8_t retries;                    /**< number of retransmissions */
+    uint8_t buf[CONFIG_EMCUTE_BUFSIZE]; /**< the PUBLISH message */
+} inflight_t;
+
+static inflight_t inflight[CONFIG_EMCUTE_PUB_WINDOW];
+static unsigned inflight_num;
+static mutex_t inflight_lock;
+static thread_t *inflight_waiter;
+static int inflight_res = EMCUTE_OK;
+#endif
+
 static size_t set_len(uint8_t *buf, size_t len)
 {
     /* - `len` field minimum length == 1
@@ -124,6 +158,102 @@ static int syncsend(uint8_t resp, size_t len, bool unlock)
     return res;
 }
 
+#if PUB_WINDOW
+static void inflight_done(inflight_t *msg, int res)
+{
+    msg->len = 0;
+    inflight_num--;
+    if ((res != EMCUTE_OK) && (inflight_res == EMCUTE_OK)) {
+        inflight_res = res;
+    }
+    if (inflight_waiter) {
+        thread_flags_set(inflight_waiter, TFLAGS_WINDOW);
+    }
+}
+
+/* wait until at most @p num messages are in flight, must hold txlock */
+static void inflight_wait(unsigned num)
+{
+    inflight_waiter = thread_get_active();
+    while (1) {
+        thread_flags_clear(TFLAGS_WINDOW);
+        mutex_lock(&inflight_lock);
+        unsigned cur = inflight_num;
+        mutex_unlock(&inflight_lock);
+        if (cur <= num) {
+            break;
+        }
+        thread_flags_wait_any(TFLAGS_WINDOW);
+    }
+    inflight_waiter = NULL;
+}
+
+/* send the PUBLISH message in tbuf, must hold txlock */
+static void inflight_send(uint16_t id, size_t len, size_t flags_pos)
+{
+    inflight_wait(CONFIG_EMCUTE_PUB_WINDOW - 1);
+
+    mutex_lock(&inflight_lock);
+    inflight_t *msg = inflight;
+    while (msg->len != 0) {
+        msg++;
+    }
+    memcpy(msg->buf, tbuf, len);
+    msg->id = id;
+    msg->len = (uint16_t)len;
+    msg->flags_pos = (uint8_t)flags_pos;
+    msg->retries = 0;
+    msg->sent = xtimer_now_usec();
+    inflight_num++;
+    mutex_unlock(&inflight_lock);
+
+    sock_udp_send(&sock, tbuf, len, &gateway);
+}
+
+/* retransmit or time out messages, returns the time until the next check */
+static uint32_t inflight_retry(uint32_t now)
+{
+    uint32_t next = T_RETRY_US;
+
+    mutex_lock(&inflight_lock);
+    for (inflight_t *msg = inflight; msg < &inflight[CONFIG_EMCUTE_PUB_WINDOW];
+         msg++) {
+        if (msg->len == 0) {
+            continue;
+        }
+        uint32_t elapsed = now - msg->sent;
+        if (elapsed < T_RETRY_US) {
+            if ((T_RETRY_US - elapsed) < next) {
+                next = T_RETRY_US - elapsed;
+            }
+            continue;
+        }
+        if (msg->retries++ == CONFIG_EMCUTE_N_RETRY) {
+            DEBUG("[emcute] pub: message %u timed out\n", (unsigned)msg->id);
+            inflight_done(msg, EMCUTE_TIMEOUT);
+            continue;
+        }
+        msg->buf[msg->flags_pos] |= EMCUTE_DUP;
+        msg->sent = now;
+        sock_udp_send(&sock, msg->buf, msg->len, &gateway);
+    }
+    mutex_unlock(&inflight_lock);
+    return next;
+}
+
+static void inflight_drop(int res)
+{
+    mutex_lock(&inflight_lock);
+    for (inflight_t *msg = inflight; msg < &inflight[CONFIG_EMCUTE_PUB_WINDOW];
+         msg++) {
+        if (msg->len != 0) {
+            inflight_done(msg, res);
+        }
+    }
+    mutex_unlock(&inflight_lock);
+}
+#endif /* PUB_WINDOW */
+
 static void on_disconnect(void)
 {
     if (waiton == DISCONNECT) {
@@ -150,6 +280,50 @@ static void on_ack(uint8_t type, int id_pos, int ret_pos, int res_pos)
     }
 }
 
+static void on_puback(void)
+{
+#if PUB_WINDOW
+    uint16_t id = byteorder_bebuftohs(&rbuf[4]);
+
+    mutex_lock(&inflight_lock);
+    for (inflight_t *msg = inflight; msg < &inflight[CONFIG_EMCUTE_PUB_WINDOW];
+         msg++) {
+        if ((msg->len != 0) && (msg->id == id)) {
+            inflight_done(msg, (rbuf[6] == ACCEPT) ? EMCUTE_OK : EMCUTE_REJECT);
+            break;
+        }
+    }
+    mutex_unlock(&inflight_lock);
+#else
+    on_ack(PUBACK, 4, 6, 0);
+#endif
+}
+
+static void on_regack(void)
+{
+    uint32_t open = atomic_load_u32(&reg_open);
+
+    if (open == 0) {
+        on_ack(REGACK, 4, 6, 2);
+        return;
+    }
+
+    uint16_t i = byteorder_bebuftohs(&rbuf[4]) - reg_first_id;
+    uint32_t bit = (i < REG_BATCH_MAX) ? (1UL << i) : 0;
+    if (!(open & bit)) {
+        return;
+    }
+    if (rbuf[6] == ACCEPT) {
+        reg_topics[i].id = byteorder_bebuftohs(&rbuf[2]);
+    }
+    else {
+        result = EMCUTE_REJECT;
+    }
+    if ((atomic_fetch_and_u32(&reg_open, ~bit) & ~bit) == 0) {
+        thread_flags_set(timer.arg, TFLAGS_RESP);
+    }
+}
+
 static void on_publish(size_t len, size_t pos)
 {
     /* make sure packet length is valid - if not, drop packet silently */
@@ -296,6 +470,10 @@ int emcute_discon(void)
     tbuf[0] = 2;
     tbuf[1] = DISCONNECT;
 
+#if PUB_WINDOW
+    /* messages in flight won't be acknowledged anymore */
+    inflight_drop(EMCUTE_NOGW);
+#endif
     return syncsend(DISCONNECT, 2, true);
 }
 
@@ -327,6 +505,75 @@ int emcute_reg(emcute_topic_t *topic)
     return res;
 }
 
+static int reg_batch(emcute_topic_t *topics, unsigned num)
+{
+    int res = EMCUTE_TIMEOUT;
+
+    mutex_lock(&txlock);
+
+    reg_topics = topics;
+    reg_first_id = id_next;
+    id_next += num;
+    result = EMCUTE_OK;
+    for (unsigned i = 0; i < num; i++) {
+        topics[i].id = 0;
+    }
+    timer.arg = thread_get_active();
+    thread_flags_clear(TFLAGS_ANY);
+    atomic_store_u32(&reg_open, (num < 32) ? ((1UL << num) - 1) : UINT32_MAX);
+
+    for (unsigned retries = 0; retries <= CONFIG_EMCUTE_N_RETRY; retries++) {
+        /* send all REGISTER messages not acknowledged yet back to back */
+        for (unsigned i = 0; i < num; i++) {
+            if (!(atomic_load_u32(&reg_open) & (1UL << i))) {
+                continue;
+            }
+            tbuf[0] = (strlen(topics[i].name) + 6);
+            tbuf[1] = REGISTER;
+            byteorder_htobebufs(&tbuf[2], 0);
+            byteorder_htobebufs(&tbuf[4], reg_first_id + i);
+            memcpy(&tbuf[6], topics[i].name, strlen(topics[i].name));
+            sock_udp_send(&sock, tbuf, (size_t)tbuf[0], &gateway);
+        }
+
+        xtimer_set(&timer, T_RETRY_US);
+        thread_flags_t flags = thread_flags_wait_any(TFLAGS_ANY);
+        if (flags & TFLAGS_RESP) {
+            xtimer_remove(&timer);
+            res = result;
+            break;
+        }
+    }
+
+    atomic_store_u32(&reg_open, 0);
+    mutex_unlock(&txlock);
+    return res;
+}
+
+int emcute_reg_many(emcute_topic_t *topics, size_t num)
+{
+    assert(topics || (num == 0));
+
+    if (gateway.port == 0) {
+        return EMCUTE_NOGW;
+    }
+    for (size_t i = 0; i < num; i++) {
+        assert(topics[i].name);
+        if (strlen(topics[i].name) > CONFIG_EMCUTE_TOPIC_MAXLEN) {
+            return EMCUTE_OVERFLOW;
+        }
+    }
+
+    for (size_t i = 0; i < num; i += REG_BATCH_MAX) {
+        int res = reg_batch(&topics[i], ((num - i) < REG_BATCH_MAX)
+                                        ? (unsigned)(num - i) : REG_BATCH_MAX);
+        if (res != EMCUTE_OK) {
+            return res;
+        }
+    }
+    return EMCUTE_OK;
+}
+
 int emcute_pub(emcute_topic_t *topic, const void *data, size_t len,
                unsigned flags)
 {
@@ -348,6 +595,7 @@ int emcute_pub(emcute_topic_t *topic, const void *data, size_t len,
 
     size_t pos = set_len(tbuf, (len + 6));
     tbuf[pos++] = PUBLISH;
+    size_t flags_pos = pos;
     tbuf[pos++] = flags;
     byteorder_htobebufs(&tbuf[pos], topic->id);
     pos += 2;
@@ -364,7 +612,13 @@ int emcute_pub(emcute_topic_t *topic, const void *data, size_t len,
     memcpy(&tbuf[pos], data, len);
 
     if (flags & EMCUTE_QOS_1) {
+#if PUB_WINDOW
+        inflight_send(waitonid, len + pos, flags_pos);
+        mutex_unlock(&txlock);
+#else
+        (void)flags_pos;
         res = syncsend(PUBACK, len + pos, true);
+#endif
     }
     else {
         sock_udp_send(&sock, tbuf, len + pos, &gateway);
@@ -374,6 +628,20 @@ int emcute_pub(emcute_topic_t *topic, const void *data, size_t len,
     return res;
 }
 
+int emcute_pub_wait(void)
+{
+#if PUB_WINDOW
+    mutex_lock(&txlock);
+    inflight_wait(0);
+    int res = inflight_res;
+    inflight_res = EMCUTE_OK;
+    mutex_unlock(&txlock);
+    return res;
+#else
+    return EMCUTE_OK;
+#endif
+}
+
 int emcute_sub(emcute_sub_t *sub, unsigned flags)
 {
     assert(sub && (sub->cb) && (sub->topic.name) && !(flags & ~SUB_FLAGS));
@@ -508,6 +776,9 @@ void emcute_run(uint16_t port, const char *id)
     timer.callback = time_evt;
     timer.arg = NULL;
     mutex_init(&txlock);
+#if PUB_WINDOW
+    mutex_init(&inflight_lock);
+#endif
 
     if (sock_udp_create(&sock, &local, NULL, 0) < 0) {
         LOG_ERROR("[emcute] unable to open UDP socket on port %i\n", (int)port);
@@ -545,9 +816,9 @@ void emcute_run(uint16_t port, const char *id)
                 case CONNACK:       on_ack(type, 0, 2, 0);              break;
                 case WILLTOPICREQ:  on_ack(type, 0, 0, 0);              break;
                 case WILLMSGREQ:    on_ack(type, 0, 0, 0);              break;
-                case REGACK:        on_ack(type, 4, 6, 2);              break;
+                case REGACK:        on_regack();                        break;
                 case PUBLISH:       on_publish((size_t)pkt_len, pos);   break;
-                case PUBACK:        on_ack(type, 4, 6, 0);              break;
+                case PUBACK:        on_puback();                        break;
                 case SUBACK:        on_ack(type, 5, 7, 3);              break;
                 case UNSUBACK:      on_ack(type, 2, 0, 0);              break;
                 case PINGREQ:       on_pingreq(&remote);                break;
@@ -570,5 +841,12 @@ void emcute_run(uint16_t port, const char *id)
         else {
             t_out = (CONFIG_EMCUTE_KEEPALIVE * US_PER_SEC) - (now - start);
         }
+#if PUB_WINDOW
+        /* messages published while waiting are checked within T_RETRY */
+        uint32_t t_retry = inflight_retry(now);
+        if (t_retry < t_out) {
+            t_out = t_retry;
+        }
+#endif
     }
 }
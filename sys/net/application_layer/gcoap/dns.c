@@ -124,10 +124,13 @@ static ssize_t _send(const void *buf, size_t len, const sock_udp_ep_t *remote,
 int gcoap_dns_query(const char *domain_name, void *addr_out, int family)
 {
     int res;
+    bool stale;
 
-    if ((res = dns_cache_query(domain_name, addr_out, family)) > 0) {
+    res = dns_cache_query_stale(domain_name, addr_out, family, &stale);
+    if (res && !stale) {
         return res;
     }
+    int stale_res = res;
 
     static uint8_t coap_buf[CONFIG_GCOAP_DNS_PDU_BUF_SIZE];
     static uint8_t dns_buf[CONFIG_DNS_MSG_LEN];
@@ -149,6 +152,13 @@ int gcoap_dns_query(const char *domain_name, void *addr_out, int family)
         res = req_ctx.res;
     }
     mutex_unlock(&_client_mutex);
+    if (stale) {
+        dns_cache_refresh_done(domain_name);
+    }
+    if ((res <= 0) && (res != -ENOENT) && stale) {
+        /* the stale address is still in addr_out */
+        return stale_res;
+    }
     return res;
 }
 
@@ -742,6 +752,14 @@ static void _resp_handler(const gcoap_request_memo_t *memo, coap_pkt_t *pdu,
                 ttl += max_age;
                 dns_cache_add(_domain_name_from_ctx(context), context->addr_out, context->res, ttl);
             }
+            else if (IS_USED(MODULE_DNS_CACHE) && (context->res == -ENOENT)) {
+                uint32_t max_age;
+
+                if (coap_opt_get_uint(pdu, COAP_OPT_MAX_AGE, &max_age) < 0) {
+                    max_age = CONFIG_DNS_CACHE_NEGATIVE_TTL;
+                }
+                dns_cache_add_negative(_domain_name_from_ctx(context), max_age);
+            }
             else if (ENABLE_DEBUG && (context->res < 0)) {
                 DEBUG("gcoap_dns: Unable to parse DNS reply: %d\n",
                       context->res);
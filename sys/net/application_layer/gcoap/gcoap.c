@@ -315,9 +315,16 @@ static void _dtls_free_up_session(void *arg) {
 static void _on_sock_udp_evt(sock_udp_t *sock, sock_async_flags_t type, void *arg)
 {
     (void)arg;
-    sock_udp_ep_t remote;
 
-    if (type & SOCK_ASYNC_MSG_RECV) {
+    if (!(type & SOCK_ASYNC_MSG_RECV)) {
+        return;
+    }
+
+    /* Datagrams arriving in a burst are signaled by a single event, so take
+     * all of them in this wake-up. _listen_buf is reused for the response,
+     * hence they are received one at a time. */
+    while (true) {
+        sock_udp_ep_t remote;
         void *stackbuf;
         void *buf_ctx = NULL;
         bool truncated = false;
@@ -339,7 +346,9 @@ static void _on_sock_udp_evt(sock_udp_t *sock, sock_async_flags_t type, void *ar
         while (true) {
             ssize_t res = sock_udp_recv_buf_aux(sock, &stackbuf, &buf_ctx, 0, &remote, &aux_in);
             if (res < 0) {
-                DEBUG("gcoap: udp recv failure: %" PRIdSIZE "\n", res);
+                if (res != -EAGAIN) {
+                    DEBUG("gcoap: udp recv failure: %" PRIdSIZE "\n", res);
+                }
                 return;
             }
             if (res == 0) {
@@ -70,6 +70,8 @@ struct requestdata {
     /** 0-terminated expanded file name in the VFS */
     char namebuf[COAPFILESERVER_PATH_MAX];
     struct requestoptions options;
+    /** Response payload sent from outside the response buffer, if supported */
+    iolist_t *payload_iol;
 };
 
 /**
@@ -267,7 +269,17 @@ static ssize_t _get_file(coap_pkt_t *pdu, uint8_t *buf, size_t len,
      * */
     assert(pdu->payload + slicer.end - slicer.start <= buf + len);
     bool more = 1;
-    int read = vfs_read(fd, pdu->payload, slicer.end - slicer.start + more);
+    iolist_t data = { .iol_base = pdu->payload };
+    int read;
+    if (request->payload_iol) {
+        /* let the server send file contents in place if the file system
+         * supports it, saving the copy into the response buffer */
+        read = vfs_read_iol(fd, &data, pdu->payload,
+                            slicer.end - slicer.start + more);
+    }
+    else {
+        read = vfs_read(fd, pdu->payload, slicer.end - slicer.start + more);
+    }
     if (read < 0) {
         goto late_err;
     }
@@ -288,6 +300,12 @@ static ssize_t _get_file(coap_pkt_t *pdu, uint8_t *buf, size_t len,
         _event_file(NANOCOAP_FILESERVER_GET_FILE_END, request);
     }
 
+    if ((read > 0) && (data.iol_base != pdu->payload)) {
+        request->payload_iol->iol_base = data.iol_base;
+        request->payload_iol->iol_len = read;
+        return resp_len;
+    }
+
     return resp_len + read;
 
 late_err:
@@ -596,7 +614,9 @@ ssize_t nanocoap_fileserver_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
                                  coap_request_ctx_t *ctx) {
     const char *root = coap_request_ctx_get_context(ctx);
     const char *resource = coap_request_ctx_get_path(ctx);
-    struct requestdata request = {0};
+    struct requestdata request = {
+        .payload_iol = ctx->payload_iol,
+    };
 
     /** Index in request.namebuf. Must not point at the last entry as that will be
      * zeroed to get a 0-terminated string. */
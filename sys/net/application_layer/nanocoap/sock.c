@@ -947,8 +947,10 @@ int nanocoap_server(sock_udp_ep_t *local, uint8_t *buf, size_t bufsize)
 {
     sock_udp_t sock;
     sock_udp_ep_t remote;
+    iolist_t payload;
     coap_request_ctx_t ctx = {
         .remote = &remote,
+        .payload_iol = &payload,
     };
 
     if (!local->port) {
@@ -995,12 +997,18 @@ int nanocoap_server(sock_udp_ep_t *local, uint8_t *buf, size_t bufsize)
         }
         ctx.local = &aux_in.local;
 #endif
+        payload = (iolist_t){ 0 };
         if ((res = coap_handle_req(&pkt, buf, bufsize, &ctx)) <= 0) {
             DEBUG("nanocoap: error handling request %" PRIdSIZE "\n", res);
             continue;
         }
 
-        sock_udp_send_aux(&sock, buf, res, &remote, aux_out_ptr);
+        iolist_t head = {
+            .iol_next = payload.iol_len ? &payload : NULL,
+            .iol_base = buf,
+            .iol_len = res,
+        };
+        sock_udp_sendv_aux(&sock, &head, &remote, aux_out_ptr);
     }
 
     return 0;
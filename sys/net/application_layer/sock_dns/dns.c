@@ -21,12 +21,19 @@
 
 #include <arpa/inet.h>
 
+#include "mutex.h"
 #include "net/dns.h"
 #include "net/dns/cache.h"
 #include "net/dns/msg.h"
 #include "net/sock/udp.h"
 #include "net/sock/dns.h"
 
+#ifdef MODULE_SOCK_DNS_REFRESH
+#include <stdatomic.h>
+
+#include "event/thread.h"
+#endif
+
 /* min domain name length is 1, so minimum record length is 7 */
 #define DNS_MIN_REPLY_LEN   (unsigned)(sizeof(dns_hdr_t) + 7)
 
@@ -66,25 +73,14 @@ void auto_init_sock_dns(void)
 }
 #endif /* MODULE_AUTO_INIT_SOCK_DNS */
 
-int sock_dns_query(const char *domain_name, void *addr_out, int family)
+static int _query(const char *domain_name, void *addr_out, int family)
 {
     ssize_t res;
     sock_udp_t sock_dns;
     static uint8_t dns_buf[CONFIG_DNS_MSG_LEN];
+    static mutex_t dns_buf_lock = MUTEX_INIT;
 
-    if (sock_dns_server.port == 0) {
-        return -ECONNREFUSED;
-    }
-
-    if (strlen(domain_name) > SOCK_DNS_MAX_NAME_LEN) {
-        return -ENOSPC;
-    }
-
-    res = dns_cache_query(domain_name, addr_out, family);
-    if (res) {
-        return res;
-    }
-
+    mutex_lock(&dns_buf_lock);
     res = sock_udp_create(&sock_dns, NULL, &sock_dns_server, 0);
     if (res) {
         goto out;
@@ -107,6 +103,12 @@ int sock_dns_query(const char *domain_name, void *addr_out, int family)
                     dns_cache_add(domain_name, addr_out, res, ttl);
                     goto out;
                 }
+                if (res == -ENOENT) {
+                    /* the name does not exist, no need to ask again */
+                    dns_cache_add_negative(domain_name,
+                                           CONFIG_DNS_CACHE_NEGATIVE_TTL);
+                    goto out;
+                }
             }
             else {
                 res = -EBADMSG;
@@ -116,5 +118,83 @@ int sock_dns_query(const char *domain_name, void *addr_out, int family)
 
 out:
     sock_udp_close(&sock_dns);
+    mutex_unlock(&dns_buf_lock);
+    return res;
+}
+
+#if IS_USED(MODULE_SOCK_DNS_REFRESH)
+static char _refresh_name[SOCK_DNS_MAX_NAME_LEN + 1];
+static int _refresh_family;
+static atomic_flag _refresh_busy = ATOMIC_FLAG_INIT;
+static bool _refresh_started;
+static event_queue_t _refresh_queue;
+static char _refresh_stack[SOCK_DNS_REFRESH_STACKSIZE];
+
+static void _refresh_handler(event_t *ev)
+{
+    uint8_t addr[16];
+
+    (void)ev;
+    /* blocks for up to SOCK_DNS_RETRIES seconds, hence the own thread */
+    _query(_refresh_name, addr, _refresh_family);
+    dns_cache_refresh_done(_refresh_name);
+    atomic_flag_clear(&_refresh_busy);
+}
+
+static event_t _refresh_ev = { .handler = _refresh_handler };
+
+static void _refresh(const char *domain_name, int family)
+{
+    /* a single refresh at a time, the others keep serving stale addresses */
+    if (atomic_flag_test_and_set(&_refresh_busy)) {
+        /* let a later query start the refresh */
+        dns_cache_refresh_done(domain_name);
+        return;
+    }
+    if (!_refresh_started) {
+        /* only one caller gets here at a time */
+        event_thread_init(&_refresh_queue, _refresh_stack,
+                          sizeof(_refresh_stack), SOCK_DNS_REFRESH_PRIO);
+        _refresh_started = true;
+    }
+    strcpy(_refresh_name, domain_name);
+    _refresh_family = family;
+    event_post(&_refresh_queue, &_refresh_ev);
+}
+#endif
+
+int sock_dns_query(const char *domain_name, void *addr_out, int family)
+{
+    int res;
+    bool stale;
+
+    if (sock_dns_server.port == 0) {
+        return -ECONNREFUSED;
+    }
+
+    if (strlen(domain_name) > SOCK_DNS_MAX_NAME_LEN) {
+        return -ENOSPC;
+    }
+
+    res = dns_cache_query_stale(domain_name, addr_out, family, &stale);
+    if (res && !stale) {
+        return res;
+    }
+#if IS_USED(MODULE_SOCK_DNS_REFRESH)
+    if (stale) {
+        _refresh(domain_name, family);
+        return res;
+    }
+#endif
+
+    int stale_res = res;
+    res = _query(domain_name, addr_out, family);
+    if (stale) {
+        dns_cache_refresh_done(domain_name);
+    }
+    if ((res <= 0) && (res != -ENOENT) && stale) {
+        /* the stale address is still in addr_out */
+        return stale_res;
+    }
     return res;
 }
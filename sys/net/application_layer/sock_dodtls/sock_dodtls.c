@@ -71,13 +71,19 @@ int sock_dodtls_query(const char *domain_name, void *addr_out, int family)
     if (strlen(domain_name) > SOCK_DODTLS_MAX_NAME_LEN) {
         return -ENOSPC;
     }
-    res = dns_cache_query(domain_name, addr_out, family);
-    if (res) {
+    bool stale;
+    res = dns_cache_query_stale(domain_name, addr_out, family, &stale);
+    if (res && !stale) {
         return res;
     }
     if (!_server_set()) {
+        if (stale) {
+            dns_cache_refresh_done(domain_name);
+            return res;
+        }
         return -ECONNREFUSED;
     }
+    int stale_res = res;
 
     mutex_lock(&_server_mutex);
     id = _id++;
@@ -92,7 +98,8 @@ int sock_dodtls_query(const char *domain_name, void *addr_out, int family)
                              _dns_buf, buflen, timeout);
         send_duration = _now_ms() - start;
         if (send_duration > CONFIG_SOCK_DODTLS_TIMEOUT_MS) {
-            return -ETIMEDOUT;
+            res = -ETIMEDOUT;
+            goto out;
         }
         timeout -= send_duration;
         if (res <= 0) {
@@ -110,6 +117,12 @@ int sock_dodtls_query(const char *domain_name, void *addr_out, int family)
                     dns_cache_add(domain_name, addr_out, res, ttl);
                     goto out;
                 }
+                if (res == -ENOENT) {
+                    /* the name does not exist, no need to ask again */
+                    dns_cache_add_negative(domain_name,
+                                           CONFIG_DNS_CACHE_NEGATIVE_TTL);
+                    goto out;
+                }
             }
             else {
                 res = -EBADMSG;
@@ -120,6 +133,13 @@ int sock_dodtls_query(const char *domain_name, void *addr_out, int family)
 out:
     memset(_dns_buf, 0, sizeof(_dns_buf));  /* flush-out unencrypted data */
     mutex_unlock(&_server_mutex);
+    if (stale) {
+        dns_cache_refresh_done(domain_name);
+    }
+    if ((res <= 0) && (res != -ENOENT) && stale) {
+        /* the stale address is still in addr_out */
+        return stale_res;
+    }
     return res;
 }
 
@@ -26,6 +26,7 @@
 #include "net/gnrc/netreg.h"
 #include "net/gnrc/pktbuf.h"
 #include "net/gnrc/netapi.h"
+#include "net/netstats.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -62,6 +63,9 @@ int _gnrc_netapi_send_recv(kernel_pid_t pid, gnrc_pktsnip_t *pkt, uint16_t type)
     if (ret < 1) {
         DEBUG("gnrc_netapi: dropped message to %" PRIkernel_pid " (%s)\n", pid,
               (ret == 0) ? "receiver queue is full" : "invalid receiver");
+        if (ret == 0) {
+            netstats_drop(NETSTATS_DROP_QUEUE_FULL);
+        }
     }
     return ret;
 }
@@ -77,6 +81,7 @@ static inline int _snd_rcv_mbox(mbox_t *mbox, uint16_t type, gnrc_pktsnip_t *pkt
     int ret = mbox_try_put(mbox, &msg);
     if (ret < 1) {
         DEBUG("gnrc_netapi: dropped message to %p (was full)\n", (void*)mbox);
+        netstats_drop(NETSTATS_DROP_QUEUE_FULL);
     }
     return ret;
 }
@@ -189,13 +189,8 @@ int gnrc_netif_get_from_netdev(gnrc_netif_t *netif, gnrc_netapi_opt_t *opt)
             case NETSTATS_IPV6:
                 {
                     assert(opt->data_len == sizeof(netstats_t));
-                    /* IPv6 thread is updating this, to prevent data
-                     * corruptions, we have to guarantee mutually exclusive
-                     * access */
-                    unsigned irq_state = irq_disable();
-                    memcpy(opt->data, &netif->ipv6.stats,
-                           sizeof(netif->ipv6.stats));
-                    irq_restore(irq_state);
+                    /* IPv6 thread is updating this */
+                    netstats_get(opt->data, &netif->ipv6.stats);
                     res = sizeof(netif->ipv6.stats);
                 }
                 break;
@@ -426,12 +421,8 @@ int gnrc_netif_set_from_netdev(gnrc_netif_t *netif,
 #if IS_USED(MODULE_NETSTATS_IPV6) && IS_USED(MODULE_GNRC_NETIF_IPV6)
             case NETSTATS_IPV6:
                 {
-                    /* IPv6 thread is updating this, to prevent data
-                     * corruptions, we have to guarantee mutually exclusive
-                     * access */
-                    unsigned irq_state = irq_disable();
-                    memset(&netif->ipv6.stats, 0, sizeof(netif->ipv6.stats));
-                    irq_restore(irq_state);
+                    /* IPv6 thread is updating this */
+                    netstats_reset(&netif->ipv6.stats);
                     res = 0;
                 }
                 break;
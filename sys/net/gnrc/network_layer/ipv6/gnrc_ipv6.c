@@ -24,6 +24,7 @@
 #include "net/gnrc/icmpv6.h"
 #include "net/gnrc/sixlowpan/ctx.h"
 #include "net/gnrc/sixlowpan/nd.h"
+#include "net/netstats.h"
 #include "net/protnum.h"
 #include "thread.h"
 #include "utlist.h"
@@ -278,12 +279,9 @@ static void _send_to_iface(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
           ipv6_addr_to_str(addr_str, &hdr->dst, sizeof(addr_str)), hdr->nh,
           byteorder_ntohs(hdr->len));
 #ifdef MODULE_NETSTATS_IPV6
-    /* This is read from the netif thread. To prevent data corruptions, we
-     * have to guarantee mutually exclusive access */
-    unsigned irq_state = irq_disable();
-    netif->ipv6.stats.tx_success++;
-    netif->ipv6.stats.tx_bytes += gnrc_pkt_len(pkt->next);
-    irq_restore(irq_state);
+    /* This is read from the netif thread */
+    netstats_add(&netif->ipv6.stats.tx_success, 1);
+    netstats_add(&netif->ipv6.stats.tx_bytes, gnrc_pkt_len(pkt->next));
 #endif
 
 #ifdef MODULE_GNRC_SIXLOWPAN
@@ -502,6 +500,7 @@ static void _send_unicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
         /* packet is released by NIB */
         DEBUG("ipv6: no link-layer address or interface for next hop to %s\n",
               ipv6_addr_to_str(addr_str, &ipv6_hdr->dst, sizeof(addr_str)));
+        netstats_drop(NETSTATS_DROP_NO_ROUTE);
         return;
     }
     netif = gnrc_netif_get_by_pid(gnrc_ipv6_nib_nc_get_iface(&nce));
@@ -521,11 +520,8 @@ static void _send_unicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
               netif->pid);
         /* and send to interface */
 #ifdef MODULE_NETSTATS_IPV6
-        /* This is read from the netif thread. To prevent data corruptions, we
-         * have to guarantee mutually exclusive access */
-        unsigned irq_state = irq_disable();
-        netif->ipv6.stats.tx_unicast_count++;
-        irq_restore(irq_state);
+        /* This is read from the netif thread */
+        netstats_add(&netif->ipv6.stats.tx_unicast_count, 1);
 #endif
         _send_to_iface(netif, pkt);
     }
@@ -548,11 +544,8 @@ static inline void _send_multicast_over_iface(gnrc_pktsnip_t *pkt,
     }
     DEBUG("ipv6: send multicast over interface %" PRIkernel_pid "\n", netif->pid);
 #ifdef MODULE_NETSTATS_IPV6
-    /* This is read from the netif thread. To prevent data corruptions, we
-     * have to guarantee mutually exclusive access */
-    unsigned irq_state = irq_disable();
-    netif->ipv6.stats.tx_mcast_count++;
-    irq_restore(irq_state);
+    /* This is read from the netif thread */
+    netstats_add(&netif->ipv6.stats.tx_mcast_count, 1);
 #endif
     /* and send to interface */
     _send_to_iface(netif, pkt);
@@ -765,25 +758,24 @@ static void _receive(gnrc_pktsnip_t *pkt)
         netif = gnrc_netif_hdr_get_netif(netif_hdr->data);
 #ifdef MODULE_NETSTATS_IPV6
         assert(netif != NULL);
-        /* This is read from the netif thread. To prevent data corruptions, we
-         * have to guarantee mutually exclusive access */
-        unsigned irq_state = irq_disable();
+        /* This is read from the netif thread */
         netstats_t *stats = &netif->ipv6.stats;
-        stats->rx_count++;
-        stats->rx_bytes += (gnrc_pkt_len(pkt) - netif_hdr->size);
-        irq_restore(irq_state);
+        netstats_add(&stats->rx_count, 1);
+        netstats_add(&stats->rx_bytes, gnrc_pkt_len(pkt) - netif_hdr->size);
 #endif
     }
 
     if ((pkt->data == NULL) || (pkt->size < sizeof(ipv6_hdr_t)) ||
         !ipv6_hdr_is(pkt->data)) {
         DEBUG("ipv6: Received packet was not IPv6, dropping packet\n");
+        netstats_drop(NETSTATS_DROP_INVALID);
         gnrc_pktbuf_release(pkt);
         return;
     }
 #ifdef MODULE_GNRC_IPV6_WHITELIST
     else if (!gnrc_ipv6_whitelisted(&((ipv6_hdr_t *)(pkt->data))->src)) {
         DEBUG("ipv6: Source address not whitelisted, dropping packet\n");
+        netstats_drop(NETSTATS_DROP_FILTERED);
         gnrc_icmpv6_error_dst_unr_send(ICMPV6_ERROR_DST_UNR_PROHIB, pkt);
         gnrc_pktbuf_release(pkt);
         return;
@@ -792,6 +784,7 @@ static void _receive(gnrc_pktsnip_t *pkt)
 #ifdef MODULE_GNRC_IPV6_BLACKLIST
     else if (gnrc_ipv6_blacklisted(&((ipv6_hdr_t *)(pkt->data))->src)) {
         DEBUG("ipv6: Source address blacklisted, dropping packet\n");
+        netstats_drop(NETSTATS_DROP_FILTERED);
         gnrc_icmpv6_error_dst_unr_send(ICMPV6_ERROR_DST_UNR_PROHIB, pkt);
         gnrc_pktbuf_release(pkt);
         return;
@@ -825,6 +818,7 @@ static void _receive(gnrc_pktsnip_t *pkt)
          * forwarding step, so *do not* check it together with ((--hdr->hl) > 0)
          * in forwarding code below */
         DEBUG("ipv6: packet was received with hop-limit 0\n");
+        netstats_drop(NETSTATS_DROP_HOP_LIMIT);
         gnrc_icmpv6_error_time_exc_send(ICMPV6_ERROR_TIME_EXC_HL, pkt);
         gnrc_pktbuf_release_error(pkt, ETIMEDOUT);
         return;
@@ -836,6 +830,7 @@ static void _receive(gnrc_pktsnip_t *pkt)
     if ((ipv6_len == 0) && (first_nh != PROTNUM_IPV6_NONXT)) {
         /* this doesn't even make sense */
         DEBUG("ipv6: payload length 0, but next header not NONXT\n");
+        netstats_drop(NETSTATS_DROP_INVALID);
         gnrc_pktbuf_release(pkt);
         return;
     }
@@ -848,6 +843,7 @@ static void _receive(gnrc_pktsnip_t *pkt)
         DEBUG("ipv6: invalid payload length: %d, actual: %d, dropping packet\n",
               (int) byteorder_ntohs(hdr->len),
               (int) (gnrc_pkt_len_upto(pkt, GNRC_NETTYPE_IPV6) - sizeof(ipv6_hdr_t)));
+        netstats_drop(NETSTATS_DROP_INVALID);
         gnrc_icmpv6_error_param_prob_send(ICMPV6_ERROR_PARAM_PROB_HDR_FIELD,
                                           &(hdr->len), pkt);
         gnrc_pktbuf_release_error(pkt, EINVAL);
@@ -911,6 +907,7 @@ static void _receive(gnrc_pktsnip_t *pkt)
         }
         else {
             DEBUG("ipv6: hop limit reached 0: drop packet\n");
+            netstats_drop(NETSTATS_DROP_HOP_LIMIT);
             gnrc_icmpv6_error_time_exc_send(ICMPV6_ERROR_TIME_EXC_HL, pkt);
             gnrc_pktbuf_release_error(pkt, ETIMEDOUT);
             return;
@@ -872,6 +872,20 @@ void _nib_ft_get(const _nib_offl_entry_t *dst, gnrc_ipv6_nib_ft_t *fte);
 int _nib_get_route(const ipv6_addr_t *dst, gnrc_pktsnip_t *ctx,
                    gnrc_ipv6_nib_ft_t *entry);
 
+#if (CONFIG_GNRC_IPV6_NIB_FWD_CACHE_SIZE > 0) || defined(DOXYGEN)
+/**
+ * @brief   Invalidates all entries of the forwarding cache
+ *
+ * @pre The NIB is acquired.
+ *
+ * Must be called on every change to the NIB that might change the next hop
+ * of a destination.
+ */
+void _nib_fc_flush(void);
+#else
+#define _nib_fc_flush()     (void)0
+#endif
+
 #ifdef __cplusplus
 }
 #endif
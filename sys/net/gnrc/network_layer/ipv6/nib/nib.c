@@ -61,6 +61,34 @@ static gnrc_pktqueue_t _queue_pool[CONFIG_GNRC_IPV6_NIB_NUMOF];
 static evtimer_msg_event_t _rdnss_timeout;
 #endif
 
+#if CONFIG_GNRC_IPV6_NIB_FWD_CACHE_SIZE > 0
+/**
+ * @brief   Forwarding cache entry
+ *
+ * Maps a destination to the neighbor cache entry of its next hop. Only next
+ * hops whose neighbor cache entry does not need to change its state when
+ * used are cached, so a cache hit has no side effects on the NIB.
+ */
+typedef struct {
+    ipv6_addr_t dst;            /**< destination address */
+    ipv6_addr_t next_hop;       /**< address of _nib_fc_entry_t::node */
+    _nib_onl_entry_t *node;     /**< neighbor cache entry of the next hop */
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ROUTER)
+    ipv6_addr_t route;          /**< prefix of the route taken */
+    uint8_t route_len;          /**< length of _nib_fc_entry_t::route */
+    bool off_link;              /**< next hop was taken from a route */
+#endif  /* CONFIG_GNRC_IPV6_NIB_ROUTER */
+    uint16_t iface;             /**< interface the look-up was restricted to,
+                                 *   0 for any */
+    uint32_t gen;               /**< _fc_gen when the entry was added */
+} _nib_fc_entry_t;
+
+static _nib_fc_entry_t _fc[CONFIG_GNRC_IPV6_NIB_FWD_CACHE_SIZE];
+/* entries of older generations are invalid */
+static uint32_t _fc_gen;
+static unsigned _fc_next;
+#endif  /* CONFIG_GNRC_IPV6_NIB_FWD_CACHE_SIZE > 0 */
+
 /**
  * @internal
  * @{
@@ -104,6 +132,7 @@ void gnrc_ipv6_nib_init(void)
     evtimer_event_t *tmp;
 
     _nib_acquire();
+    _nib_fc_flush();
     for (evtimer_event_t *ptr = _nib_evtimer.events;
          (ptr != NULL) && (tmp = (ptr->next), 1);
          ptr = tmp) {
@@ -260,18 +289,108 @@ static gnrc_netif_t *_acquire_new_iface(unsigned iface)
     return netif;
 }
 
+#if CONFIG_GNRC_IPV6_NIB_FWD_CACHE_SIZE > 0
+void _nib_fc_flush(void)
+{
+    _fc_gen++;
+}
+
+static bool _fc_usable(_nib_onl_entry_t *node)
+{
+    uint16_t state = _get_nud_state(node);
+
+    /* using neighbors in any other state has side effects, e.g. moving them
+     * from STALE to DELAY */
+    return (node->mode & _NC) && _is_reachable(node) &&
+           ((state == GNRC_IPV6_NIB_NC_INFO_NUD_STATE_REACHABLE) ||
+            (state == GNRC_IPV6_NIB_NC_INFO_NUD_STATE_UNMANAGED));
+}
+
+static bool _fc_get(const ipv6_addr_t *dst, unsigned iface,
+                    gnrc_ipv6_nib_nc_t *nce)
+{
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_FWD_CACHE_SIZE; i++) {
+        _nib_fc_entry_t *entry = &_fc[i];
+
+        if ((entry->node == NULL) || (entry->gen != _fc_gen) ||
+            (entry->iface != iface) || !ipv6_addr_equal(&entry->dst, dst)) {
+            continue;
+        }
+        /* the neighbor cache entry might have been reused or changed its
+         * state without the NIB being changed via its API */
+        if (!ipv6_addr_equal(&entry->node->ipv6, &entry->next_hop) ||
+            !_fc_usable(entry->node)) {
+            entry->node = NULL;
+            return false;
+        }
+        DEBUG("nib: next hop for %s in forwarding cache\n",
+              ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
+        _nib_nc_get(entry->node, nce);
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ROUTER)
+        if (entry->off_link) {
+            _call_route_info_cb(
+                    gnrc_netif_get_by_pid(_nib_onl_get_if(entry->node)),
+                    GNRC_IPV6_NIB_ROUTE_INFO_TYPE_RN, &entry->route,
+                    (void *)((intptr_t)entry->route_len)
+                );
+        }
+#endif  /* CONFIG_GNRC_IPV6_NIB_ROUTER */
+        return true;
+    }
+    return false;
+}
+
+static void _fc_add(const ipv6_addr_t *dst, unsigned iface, uint32_t gen,
+                    _nib_onl_entry_t *node, const gnrc_ipv6_nib_ft_t *route)
+{
+    _nib_fc_entry_t *entry = &_fc[_fc_next];
+
+    /* the NIB might have changed while it was released to acquire a
+     * network interface */
+    if ((gen != _fc_gen) || (node == NULL) || !_fc_usable(node)) {
+        return;
+    }
+    _fc_next = (_fc_next + 1) % CONFIG_GNRC_IPV6_NIB_FWD_CACHE_SIZE;
+    entry->dst = *dst;
+    entry->next_hop = node->ipv6;
+    entry->node = node;
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ROUTER)
+    entry->off_link = (route != NULL);
+    if (route != NULL) {
+        entry->route = route->dst;
+        entry->route_len = route->dst_len;
+    }
+#else   /* CONFIG_GNRC_IPV6_NIB_ROUTER */
+    (void)route;
+#endif  /* CONFIG_GNRC_IPV6_NIB_ROUTER */
+    entry->iface = iface;
+    entry->gen = gen;
+}
+#else   /* CONFIG_GNRC_IPV6_NIB_FWD_CACHE_SIZE > 0 */
+#define _fc_get(dst, iface, nce)                    ((void)iface, false)
+#define _fc_add(dst, iface, gen, node, route)       (void)gen
+#define _fc_gen                                     (0U)
+#endif  /* CONFIG_GNRC_IPV6_NIB_FWD_CACHE_SIZE > 0 */
+
 int gnrc_ipv6_nib_get_next_hop_l2addr(const ipv6_addr_t *dst,
                                       gnrc_netif_t *netif, gnrc_pktsnip_t *pkt,
                                       gnrc_ipv6_nib_nc_t *nce)
 {
     int res = 0;
+    const unsigned fc_iface = (netif == NULL) ? 0 : netif->pid;
 
     DEBUG("nib: get next hop link-layer address of %s%%%u\n",
           ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)),
           (netif != NULL) ? (unsigned)netif->pid : 0U);
     gnrc_netif_acquire(netif);
     _nib_acquire();
+    const uint32_t fc_gen = _fc_gen;
+
     do {    /* XXX: hidden goto ;-) */
+        if (_fc_get(dst, fc_iface, nce)) {
+            break;
+        }
+
         _nib_onl_entry_t *node = _nib_onl_nc_get(dst,
                                                  (netif == NULL) ? 0 : netif->pid);
         /* consider neighbor cache entries first */
@@ -305,6 +424,7 @@ int gnrc_ipv6_nib_get_next_hop_l2addr(const ipv6_addr_t *dst,
                 res = -EHOSTUNREACH;
                 break;
             }
+            _fc_add(dst, fc_iface, fc_gen, node, NULL);
         }
         else {
             gnrc_ipv6_nib_ft_t route;
@@ -354,6 +474,7 @@ int gnrc_ipv6_nib_get_next_hop_l2addr(const ipv6_addr_t *dst,
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_DC)
                 _nib_dc_add(&route.next_hop, netif->pid, dst);
 #endif  /* CONFIG_GNRC_IPV6_NIB_DC */
+                _fc_add(dst, fc_iface, fc_gen, node, &route);
             }
             else {
                 /* _resolve_addr releases pkt if not queued (in which case
@@ -374,6 +495,7 @@ void gnrc_ipv6_nib_handle_pkt(gnrc_netif_t *netif, const ipv6_hdr_t *ipv6,
     assert(netif != NULL);
     gnrc_netif_acquire(netif);
     _nib_acquire();
+    _nib_fc_flush();
     switch (icmpv6->type) {
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ROUTER)
         case ICMPV6_RTR_SOL:
@@ -412,6 +534,7 @@ void gnrc_ipv6_nib_handle_timer_event(void *ctx, uint16_t type)
     DEBUG("nib: Handle timer event (ctx = %p, type = 0x%04x, now = %ums)\n",
           ctx, type, (unsigned)evtimer_now_msec());
     _nib_acquire();
+    _nib_fc_flush();
     switch (type) {
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM)
         case GNRC_IPV6_NIB_SND_UC_NS:
@@ -34,6 +34,36 @@ int gnrc_ipv6_nib_ft_get(const ipv6_addr_t *dst, gnrc_pktsnip_t *pkt,
     return res;
 }
 
+/* checks if adding the route only refreshes its lifetime, so the next hop of
+ * no destination changes */
+static bool _route_unchanged(const ipv6_addr_t *dst, unsigned dst_len,
+                             const ipv6_addr_t *next_hop, unsigned iface,
+                             bool is_default_route)
+{
+    if (is_default_route) {
+        _nib_dr_entry_t *entry = _nib_drl_get(next_hop, iface);
+
+        return (entry != NULL) && (entry == _prime_def_router);
+    }
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ROUTER)
+    _nib_offl_entry_t *entry = NULL;
+
+    while ((entry = _nib_offl_iter(entry))) {
+        if ((entry->mode & _FT) && (entry->pfx_len == dst_len) &&
+            (ipv6_addr_match_prefix(&entry->pfx, dst) >= dst_len) &&
+            (_nib_onl_get_if(entry->next_hop) == iface) &&
+            ((next_hop == NULL) ||
+             ipv6_addr_equal(next_hop, &entry->next_hop->ipv6))) {
+            return true;
+        }
+    }
+#else
+    (void)dst;
+    (void)dst_len;
+#endif
+    return false;
+}
+
 int gnrc_ipv6_nib_ft_add(const ipv6_addr_t *dst, unsigned dst_len,
                          const ipv6_addr_t *next_hop, unsigned iface,
                          uint32_t ltime)
@@ -57,6 +87,10 @@ int gnrc_ipv6_nib_ft_add(const ipv6_addr_t *dst, unsigned dst_len,
         return -EINVAL;
     }
     _nib_acquire();
+    dst_len = (dst_len > 128) ? 128 : dst_len;
+    if (!_route_unchanged(dst, dst_len, next_hop, iface, is_default_route)) {
+        _nib_fc_flush();
+    }
     if (is_default_route) {
         _nib_dr_entry_t *ptr;
 
@@ -76,7 +110,6 @@ int gnrc_ipv6_nib_ft_add(const ipv6_addr_t *dst, unsigned dst_len,
     else {
         _nib_offl_entry_t *ptr;
 
-        dst_len = (dst_len > 128) ? 128 : dst_len;
         ptr = _nib_ft_add(next_hop, iface, dst, dst_len);
         if (ptr == NULL) {
             res = -ENOMEM;
@@ -98,6 +131,7 @@ int gnrc_ipv6_nib_ft_add(const ipv6_addr_t *dst, unsigned dst_len,
 void gnrc_ipv6_nib_ft_del(const ipv6_addr_t *dst, unsigned dst_len)
 {
     _nib_acquire();
+    _nib_fc_flush();
     if ((dst == NULL) || (dst_len == 0) || ipv6_addr_is_unspecified(dst)) {
         _nib_dr_entry_t *entry = _nib_drl_get_dr();
 
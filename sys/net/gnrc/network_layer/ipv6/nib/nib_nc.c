@@ -34,6 +34,7 @@ int gnrc_ipv6_nib_nc_set(const ipv6_addr_t *ipv6, unsigned iface,
     assert(l2addr_len <= CONFIG_GNRC_IPV6_NIB_L2ADDR_MAX_LEN);
     assert((iface > KERNEL_PID_UNDEF) && (iface <= KERNEL_PID_LAST));
     _nib_acquire();
+    _nib_fc_flush();
     node = _nib_nc_add(ipv6, iface, GNRC_IPV6_NIB_NC_INFO_NUD_STATE_UNMANAGED);
     if (node == NULL) {
         _nib_release();
@@ -64,6 +65,7 @@ void gnrc_ipv6_nib_nc_del(const ipv6_addr_t *ipv6, unsigned iface)
     _nib_onl_entry_t *node = NULL;
 
     _nib_acquire();
+    _nib_fc_flush();
     while ((node = _nib_onl_iter(node)) != NULL) {
         if ((_nib_onl_get_if(node) == iface) &&
             ipv6_addr_equal(ipv6, &node->ipv6)) {
@@ -79,6 +81,7 @@ void gnrc_ipv6_nib_nc_mark_reachable(const ipv6_addr_t *ipv6)
     _nib_onl_entry_t *node = NULL;
 
     _nib_acquire();
+    _nib_fc_flush();
     while ((node = _nib_onl_iter(node)) != NULL) {
         if ((node->mode & _NC) && ipv6_addr_equal(ipv6, &node->ipv6)) {
             /* only set reachable if not unmanaged */
@@ -44,6 +44,7 @@ int gnrc_ipv6_nib_pl_set(unsigned iface,
         return -EINVAL;
     }
     _nib_acquire();
+    _nib_fc_flush();
     dst = _nib_pl_add(iface, pfx, pfx_len, valid_ltime,
                       pref_ltime);
     if (dst == NULL) {
@@ -98,6 +99,7 @@ void gnrc_ipv6_nib_pl_del(unsigned iface,
 
     assert(pfx != NULL);
     _nib_acquire();
+    _nib_fc_flush();
     while ((dst = _nib_offl_iter(dst)) != NULL) {
         assert(dst->next_hop != NULL);
         if ((pfx_len == dst->pfx_len) &&
@@ -15,6 +15,7 @@
 #include <stdbool.h>
 #include <inttypes.h>
 
+#include "atomic_utils.h"
 #include "mutex.h"
 #include "net/gnrc/sixlowpan/ctx.h"
 #if IS_USED(MODULE_ZTIMER_MSEC)
@@ -30,6 +31,8 @@
 static gnrc_sixlowpan_ctx_t _ctxs[GNRC_SIXLOWPAN_CTX_SIZE];
 static uint32_t _ctx_inval_times[GNRC_SIXLOWPAN_CTX_SIZE];
 static mutex_t _ctx_mutex = MUTEX_INIT;
+static uint32_t _version;           /* also changed from interrupt context */
+static uint32_t _version_minute;
 
 static uint32_t _current_minute(void);
 static void _update_lifetime(uint8_t id);
@@ -129,11 +132,35 @@ gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_update(uint8_t id, const ipv6_addr_t *p
           id, ipv6_addr_to_str(ipv6str, &_ctxs[id].prefix, sizeof(ipv6str)),
           _ctxs[id].prefix_len, _ctxs[id].ltime);
     _ctx_inval_times[id] = ltime + _current_minute();
+    atomic_fetch_add_u32(&_version, 1);
 
     mutex_unlock(&_ctx_mutex);
     return &(_ctxs[id]);
 }
 
+uint32_t gnrc_sixlowpan_ctx_version(void)
+{
+    uint32_t now = _current_minute();
+    uint32_t res;
+
+    mutex_lock(&_ctx_mutex);
+    /* lifetimes are only updated on lookup, so make users look up again
+     * once the minute changed */
+    if (now != _version_minute) {
+        _version_minute = now;
+        atomic_fetch_add_u32(&_version, 1);
+    }
+    res = atomic_load_u32(&_version);
+    mutex_unlock(&_ctx_mutex);
+
+    return res;
+}
+
+void gnrc_sixlowpan_ctx_changed(void)
+{
+    atomic_fetch_add_u32(&_version, 1);
+}
+
 static uint32_t _current_minute(void)
 {
 #if IS_USED(MODULE_ZTIMER_MSEC)
@@ -170,6 +197,7 @@ static void _update_lifetime(uint8_t id)
 void gnrc_sixlowpan_ctx_reset(void)
 {
     memset(_ctxs, 0, sizeof(_ctxs));
+    gnrc_sixlowpan_ctx_changed();
 }
 #endif
 
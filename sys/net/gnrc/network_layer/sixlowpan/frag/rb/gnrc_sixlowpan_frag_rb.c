@@ -17,6 +17,7 @@
 #include <inttypes.h>
 #include <stdbool.h>
 
+#include "macros/utils.h"
 #include "net/ieee802154.h"
 #include "net/ipv6.h"
 #include "net/ipv6/hdr.h"
@@ -63,6 +64,17 @@ static gnrc_sixlowpan_frag_rb_int_t rbuf_int[RBUF_INT_SIZE];
 
 static gnrc_sixlowpan_frag_rb_t rbuf[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
 
+/* index + 1 of the first entry of each look-up bucket, 0 if bucket is empty.
+ * Removed entries are only unlinked once they are reused for another
+ * datagram, so look-ups still need to check if an entry is in use. */
+static uint8_t _rbuf_buckets[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_BUCKETS];
+
+static_assert(CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE < UINT8_MAX,
+              "CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE must be smaller than 255");
+static_assert((CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_BUCKETS &
+               (CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_BUCKETS - 1)) == 0,
+              "CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_BUCKETS must be a power of 2");
+
 static char l2addr_str[3 * IEEE802154_LONG_ADDRESS_LEN];
 
 static xtimer_t _gc_timer;
@@ -71,9 +83,10 @@ static msg_t _gc_timer_msg = { .type = GNRC_SIXLOWPAN_FRAG_RB_GC_MSG };
 /* ------------------------------------
  * internal function definitions
  * ------------------------------------*/
-/* checks whether start and end overlaps, but not identical to, given interval i */
-static inline bool _rbuf_int_overlap_partially(gnrc_sixlowpan_frag_rb_int_t *i,
-                                               uint16_t start, uint16_t end);
+/* checks whether start and end are identical to one of the fragments merged
+ * into interval i */
+static inline bool _rbuf_int_is_frag(const gnrc_sixlowpan_frag_rb_int_t *i,
+                                     size_t start, size_t end);
 /* gets a free entry from interval buffer */
 static gnrc_sixlowpan_frag_rb_int_t *_rbuf_int_get_free(void);
 /* update interval buffer of entry */
@@ -84,6 +97,11 @@ static int _rbuf_get(const void *src, size_t src_len,
                      const void *dst, size_t dst_len,
                      size_t size, uint16_t tag,
                      unsigned page);
+/* finds an entry in use by its tuple via the look-up buckets */
+static gnrc_sixlowpan_frag_rb_t *_rbuf_find(const uint8_t *src, size_t src_len,
+                                            const uint8_t *dst, size_t dst_len,
+                                            uint16_t tag, size_t size,
+                                            bool any_size);
 /* gets an entry only by link-layer information and tag */
 static gnrc_sixlowpan_frag_rb_t *_rbuf_get_by_tag(const gnrc_netif_hdr_t *netif_hdr,
                                                   uint16_t tag);
@@ -114,23 +132,29 @@ static int _check_fragments(gnrc_sixlowpan_frag_rb_base_t *entry,
                             size_t frag_size, size_t offset)
 {
     gnrc_sixlowpan_frag_rb_int_t *ptr = entry->ints;
+    /* start and ends are both inclusive */
+    size_t end = offset + frag_size - 1;
 
-    /* If the fragment overlaps another fragment and differs in either the size
-     * or the offset of the overlapped fragment, discards the datagram
-     * https://tools.ietf.org/html/rfc4944#section-5.3 */
     while (ptr != NULL) {
-        if (_rbuf_int_overlap_partially(ptr, offset, offset + frag_size - 1)) {
-
+        if (_rbuf_int_is_frag(ptr, offset, end)) {
+            DEBUG("6lo rbuf: fragment already in reassembly buffer\n");
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_STATS)
+            gnrc_sixlowpan_frag_stats_get()->duplicates++;
+#endif
+            return RBUF_ADD_DUPLICATE;
+        }
+        /* If the fragment overlaps another fragment and differs in either the
+         * size or the offset of the overlapped fragment, discards the datagram
+         * https://tools.ietf.org/html/rfc4944#section-5.3 */
+        if ((ptr->start <= end) && (offset <= ptr->end)) {
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_STATS)
+            gnrc_sixlowpan_frag_stats_get()->overlaps++;
+#endif
             /* "A fresh reassembly may be commenced with the most recently
              * received link fragment"
              * https://tools.ietf.org/html/rfc4944#section-5.3 */
             return RBUF_ADD_REPEAT;
         }
-        /* End was already checked in overlap check */
-        if (ptr->start == offset) {
-            DEBUG("6lo rbuf: fragment already in reassembly buffer\n");
-            return RBUF_ADD_DUPLICATE;
-        }
         ptr = ptr->next;
     }
     return RBUF_ADD_SUCCESS;
@@ -180,29 +204,73 @@ void gnrc_sixlowpan_frag_rb_rm_by_datagram(const gnrc_netif_hdr_t *netif_hdr,
     }
 }
 
-static gnrc_sixlowpan_frag_rb_t *_rbuf_get_by_tag(const gnrc_netif_hdr_t *netif_hdr,
-                                                  uint16_t tag)
+static unsigned _rbuf_bucket(const uint8_t *src, size_t src_len, uint16_t tag)
 {
-    assert(netif_hdr != NULL);
-    const uint8_t *src = gnrc_netif_hdr_get_src_addr(netif_hdr);
-    const uint8_t *dst = gnrc_netif_hdr_get_dst_addr(netif_hdr);
-    const uint8_t src_len = netif_hdr->src_l2addr_len;
-    const uint8_t dst_len = netif_hdr->dst_l2addr_len;
+    unsigned hash = tag;
 
-    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
-        gnrc_sixlowpan_frag_rb_t *e = &rbuf[i];
+    for (unsigned i = 0; i < src_len; i++) {
+        hash = (hash * 33U) ^ src[i];
+    }
+    return (hash ^ (hash >> 8)) & (CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_BUCKETS - 1);
+}
+
+static void _rbuf_link(gnrc_sixlowpan_frag_rb_t *e, unsigned bucket)
+{
+    uint8_t idx = (e - rbuf) + 1;
+
+    if (e->bucket == (bucket + 1)) {
+        return;
+    }
+    if (e->bucket != 0) {
+        /* unlink from bucket of the previous datagram */
+        uint8_t *ptr = &_rbuf_buckets[e->bucket - 1];
+
+        while (*ptr != idx) {
+            assert(*ptr != 0);
+            ptr = &rbuf[*ptr - 1].bucket_next;
+        }
+        *ptr = e->bucket_next;
+    }
+    e->bucket = bucket + 1;
+    e->bucket_next = _rbuf_buckets[bucket];
+    _rbuf_buckets[bucket] = idx;
+}
+
+static gnrc_sixlowpan_frag_rb_t *_rbuf_find(const uint8_t *src, size_t src_len,
+                                            const uint8_t *dst, size_t dst_len,
+                                            uint16_t tag, size_t size,
+                                            bool any_size)
+{
+    uint8_t idx = _rbuf_buckets[_rbuf_bucket(src, src_len, tag)];
+
+    while (idx != 0) {
+        gnrc_sixlowpan_frag_rb_t *e = &rbuf[idx - 1];
 
         if ((e->pkt != NULL) && (e->super.tag == tag) &&
+            (any_size || (e->super.datagram_size == size)) &&
             (e->super.src_len == src_len) &&
             (e->super.dst_len == dst_len) &&
             (memcmp(e->super.src, src, src_len) == 0) &&
             (memcmp(e->super.dst, dst, dst_len) == 0)) {
             return e;
         }
+        idx = e->bucket_next;
     }
     return NULL;
 }
 
+static gnrc_sixlowpan_frag_rb_t *_rbuf_get_by_tag(const gnrc_netif_hdr_t *netif_hdr,
+                                                  uint16_t tag)
+{
+    assert(netif_hdr != NULL);
+
+    return _rbuf_find(gnrc_netif_hdr_get_src_addr(netif_hdr),
+                      netif_hdr->src_l2addr_len,
+                      gnrc_netif_hdr_get_dst_addr(netif_hdr),
+                      netif_hdr->dst_l2addr_len,
+                      tag, 0, true);
+}
+
 #ifndef NDEBUG
 static bool _valid_offset(gnrc_pktsnip_t *pkt, size_t offset)
 {
@@ -409,6 +477,9 @@ static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
     if (_rbuf_update_ints(entry.super, offset, frag_size)) {
         DEBUG("6lo rbuf: add fragment data\n");
         entry.super->current_size += (uint16_t)frag_size;
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_STATS)
+        entry.rbuf->fragments++;
+#endif
         if (offset == 0) {
             if (IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC) &&
                 sixlowpan_iphc_is(data)) {
@@ -504,12 +575,13 @@ static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
     return res;
 }
 
-static inline bool _rbuf_int_overlap_partially(gnrc_sixlowpan_frag_rb_int_t *i,
-                                               uint16_t start, uint16_t end)
+static inline bool _rbuf_int_is_frag(const gnrc_sixlowpan_frag_rb_int_t *i,
+                                     size_t start, size_t end)
 {
-    /* start and ends are both inclusive, so using <= for both */
-    return ((i->start <= end) && (start <= i->end)) && /* overlaps */
-        ((start != i->start) || (end != i->end)); /* not identical */
+    /* start and ends are both inclusive */
+    return (i->start <= start) && (end <= i->end) &&
+           (((start - i->start) % i->frag_size) == 0) &&
+           (end == MIN(start + i->frag_size - 1U, (size_t)i->end));
 }
 
 static gnrc_sixlowpan_frag_rb_int_t *_rbuf_int_get_free(void)
@@ -538,18 +610,60 @@ bool gnrc_sixlowpan_frag_rb_ints_empty(void)
 static bool _rbuf_update_ints(gnrc_sixlowpan_frag_rb_base_t *entry,
                               uint16_t offset, size_t frag_size)
 {
-    gnrc_sixlowpan_frag_rb_int_t *new;
+    gnrc_sixlowpan_frag_rb_int_t *new, *prev = NULL, *next = NULL;
+    gnrc_sixlowpan_frag_rb_int_t **next_ptr = NULL;
     uint16_t end = (uint16_t)(offset + frag_size - 1);
 
+    /* merge with the intervals of the fragments directly before and after,
+     * so in-order reception only takes up a single interval. Fragments are
+     * only merged as long as they keep the interval regular, so every
+     * fragment can still be told apart from a partial overlap */
+    for (gnrc_sixlowpan_frag_rb_int_t **ptr = &entry->ints; *ptr != NULL;
+         ptr = &(*ptr)->next) {
+        gnrc_sixlowpan_frag_rb_int_t *i = *ptr;
+
+        if (((i->end + 1U) == offset) && (frag_size <= i->frag_size) &&
+            (((i->end + 1U - i->start) % i->frag_size) == 0)) {
+            prev = i;
+        }
+        else if (((end + 1U) == i->start) && (frag_size == i->frag_size)) {
+            next = i;
+            next_ptr = ptr;
+        }
+    }
+    if ((prev != NULL) && (next != NULL) && (prev->frag_size == frag_size)) {
+        /* fragment closed the gap between two intervals */
+        prev->end = next->end;
+        *next_ptr = next->next;
+        next->start = 0;
+        next->end = 0;
+        next->next = NULL;
+    }
+    else if (prev != NULL) {
+        prev->end = end;
+    }
+    else if (next != NULL) {
+        next->start = offset;
+    }
+    if ((prev != NULL) || (next != NULL)) {
+        DEBUG("6lo rfrag: merged fragment (%" PRIu16 ", %" PRIu16 ")\n",
+              offset, end);
+        return true;
+    }
+
     new = _rbuf_int_get_free();
 
     if (new == NULL) {
         DEBUG("6lo rfrag: no space left in rbuf interval buffer.\n");
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_STATS)
+        gnrc_sixlowpan_frag_stats_get()->ints_full++;
+#endif
         return false;
     }
 
     new->start = offset;
     new->end = end;
+    new->frag_size = frag_size;
 
     DEBUG("6lo rfrag: add interval (%" PRIu16 ", %" PRIu16 ") to entry (%s, ",
           new->start, new->end, gnrc_netif_addr_to_str(entry->src,
@@ -596,6 +710,12 @@ void gnrc_sixlowpan_frag_rb_gc(void)
                                          rbuf[i].super.dst_len,
                                          l2addr_str),
                   (unsigned)rbuf[i].super.datagram_size, rbuf[i].super.tag);
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_STATS)
+            /* entries scheduled for deletion have no current size */
+            if (rbuf[i].super.current_size > 0) {
+                gnrc_sixlowpan_frag_stats_get()->rbuf_timeouts++;
+            }
+#endif
 
             _gc_pkt(&rbuf[i]);
             gnrc_sixlowpan_frag_rb_remove(&(rbuf[i]));
@@ -617,47 +737,40 @@ static int _rbuf_get(const void *src, size_t src_len,
                      size_t size, uint16_t tag,
                      unsigned page)
 {
-    gnrc_sixlowpan_frag_rb_t *res = NULL, *oldest = NULL;
+    gnrc_sixlowpan_frag_rb_t *res, *oldest = NULL;
     uint32_t now_usec = xtimer_now_usec();
 
-    for (unsigned int i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
-        /* check first if entry already available */
-        if ((rbuf[i].pkt != NULL) && (rbuf[i].super.tag == tag) &&
-            ((IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) &&
-              /* not all SFR fragments carry the datagram size, so make 0 a
-               * legal value to not compare datagram size */
-              ((size == 0) || (rbuf[i].super.datagram_size == size))) ||
-             (!IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) &&
-              (rbuf[i].super.datagram_size == size))) &&
-            (rbuf[i].super.src_len == src_len) &&
-            (rbuf[i].super.dst_len == dst_len) &&
-            (memcmp(rbuf[i].super.src, src, src_len) == 0) &&
-            (memcmp(rbuf[i].super.dst, dst, dst_len) == 0)) {
-            DEBUG("6lo rfrag: entry %p (%s, ", (void *)(&rbuf[i]),
-                  gnrc_netif_addr_to_str(rbuf[i].super.src,
-                                         rbuf[i].super.src_len,
-                                         l2addr_str));
-            DEBUG("%s, %u, %u) found\n",
-                  gnrc_netif_addr_to_str(rbuf[i].super.dst,
-                                         rbuf[i].super.dst_len,
-                                         l2addr_str),
-                  (unsigned)rbuf[i].super.datagram_size, rbuf[i].super.tag);
+    /* check first if entry already available. Not all SFR fragments carry
+     * the datagram size, so make 0 a legal value to not compare datagram
+     * size */
+    res = _rbuf_find(src, src_len, dst, dst_len, tag, size,
+                     IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) && (size == 0));
+    if (res != NULL) {
+        DEBUG("6lo rfrag: entry %p (%s, ", (void *)res,
+              gnrc_netif_addr_to_str(res->super.src, res->super.src_len,
+                                     l2addr_str));
+        DEBUG("%s, %u, %u) found\n",
+              gnrc_netif_addr_to_str(res->super.dst, res->super.dst_len,
+                                     l2addr_str),
+              (unsigned)res->super.datagram_size, res->super.tag);
 #if CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER > 0
-            if (rbuf[i].super.current_size == 0) {
-                /* ensure that only empty reassembly buffer entries and entries
-                 * scheduled for deletion have `current_size == 0` */
-                DEBUG("6lo rfrag: scheduled for deletion, don't add fragment\n");
-                return -1;
-            }
-#endif
-            rbuf[i].super.arrival = now_usec;
-            _set_rbuf_timeout();
-            return i;
+        if (res->super.current_size == 0) {
+            /* ensure that only empty reassembly buffer entries and entries
+             * scheduled for deletion have `current_size == 0` */
+            DEBUG("6lo rfrag: scheduled for deletion, don't add fragment\n");
+            return -1;
         }
+#endif
+        res->super.arrival = now_usec;
+        _set_rbuf_timeout();
+        return res - &(rbuf[0]);
+    }
 
-        /* if there is a free spot: remember it */
-        if ((res == NULL) && gnrc_sixlowpan_frag_rb_entry_empty(&rbuf[i])) {
+    for (unsigned int i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
+        /* if there is a free spot: take it */
+        if (gnrc_sixlowpan_frag_rb_entry_empty(&rbuf[i])) {
             res = &(rbuf[i]);
+            break;
         }
 
         /* remember oldest slot */
@@ -742,6 +855,10 @@ static int _rbuf_get(const void *src, size_t src_len,
     res->super.dst_len = dst_len;
     res->super.tag = tag;
     res->super.current_size = 0;
+    _rbuf_link(res, _rbuf_bucket(src, src_len, tag));
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_STATS)
+    res->fragments = 0;
+#endif
 #if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR)
     res->offset_diff = 0U;
     memset(res->received, 0U, sizeof(res->received));
@@ -772,6 +889,7 @@ void gnrc_sixlowpan_frag_rb_reset(void)
         }
     }
     memset(rbuf, 0, sizeof(rbuf));
+    memset(_rbuf_buckets, 0, sizeof(_rbuf_buckets));
 }
 
 const gnrc_sixlowpan_frag_rb_t *gnrc_sixlowpan_frag_rb_array(void)
@@ -812,20 +930,6 @@ static void _tmp_rm(gnrc_sixlowpan_frag_rb_t *rbuf)
 #endif  /* CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER */
 }
 
-#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_STATS)
-static inline unsigned _count_frags(gnrc_sixlowpan_frag_rb_t *rbuf)
-{
-    unsigned frags = 0;
-    gnrc_sixlowpan_frag_rb_int_t *frag = rbuf->super.ints;
-
-    while (frag) {
-        frag = frag->next;
-        frags++;
-    }
-    return frags;
-}
-#endif
-
 int gnrc_sixlowpan_frag_rb_dispatch_when_complete(gnrc_sixlowpan_frag_rb_t *rbuf,
                                                    gnrc_netif_hdr_t *netif_hdr)
 {
@@ -857,7 +961,7 @@ int gnrc_sixlowpan_frag_rb_dispatch_when_complete(gnrc_sixlowpan_frag_rb_t *rbuf
         new_netif_hdr->rssi = netif_hdr->rssi;
         rbuf->pkt = gnrc_pkt_append(rbuf->pkt, netif);
 #if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_STATS)
-        gnrc_sixlowpan_frag_stats_get()->fragments += _count_frags(rbuf);
+        gnrc_sixlowpan_frag_stats_get()->fragments += rbuf->fragments;
         gnrc_sixlowpan_frag_stats_get()->datagrams++;
 #endif
         gnrc_sixlowpan_dispatch_recv(rbuf->pkt, NULL, 0);
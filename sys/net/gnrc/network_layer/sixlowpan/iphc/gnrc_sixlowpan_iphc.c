@@ -115,6 +115,32 @@
 
 #define SIXLOWPAN_IPHC_PREFIX_LEN   (64)    /**< minimum prefix length for IPHC */
 
+#if (CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE > 0) && (GNRC_NETIF_L2ADDR_MAXLEN > 0)
+#define IPHC_CACHE_SIZE     CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE
+
+/**
+ * @brief   Cached address compression of a flow
+ */
+typedef struct {
+    ipv6_addr_t src;            /**< source address */
+    ipv6_addr_t dst;            /**< destination address */
+    uint32_t ctx_version;       /**< version of the contexts used */
+    kernel_pid_t iface;         /**< interface, KERNEL_PID_UNDEF if unused */
+    uint8_t src_l2addr[GNRC_NETIF_L2ADDR_MAXLEN];   /**< interface address */
+    uint8_t dst_l2addr[GNRC_NETIF_L2ADDR_MAXLEN];   /**< link-layer destination */
+    uint8_t src_l2addr_len;     /**< length of the interface address */
+    uint8_t dst_l2addr_len;     /**< length of the link-layer destination */
+    uint8_t iphc2;              /**< address compression bits of IPHC byte 2 */
+    uint8_t cid_ext;            /**< context identifier extension */
+} _iphc_cache_t;
+
+/* only accessed from the 6LoWPAN thread */
+static _iphc_cache_t _cache[IPHC_CACHE_SIZE];
+static unsigned _cache_next;
+#else
+#define IPHC_CACHE_SIZE     (0)
+#endif
+
 /* currently only used with forwarding output, remove guard if more debug info
  * is added */
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
@@ -134,7 +160,7 @@ static inline bool _is_rfrag(gnrc_pktsnip_t *sixlo)
 }
 
 static inline bool _context_overlaps_iid(gnrc_sixlowpan_ctx_t *ctx,
-                                         ipv6_addr_t *addr,
+                                         const ipv6_addr_t *addr,
                                          eui64_t *iid)
 {
     uint8_t byte_mask[] = {0xff, 0x7f, 0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x01};
@@ -1073,31 +1099,34 @@ static inline bool _compressible_nh(uint8_t nh)
     }
 }
 
-static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
-                                const gnrc_netif_hdr_t *netif_hdr,
-                                gnrc_netif_t *iface,
-                                uint8_t *iphc_hdr)
+/**
+ * @brief   Chooses the address compression for an IPv6 header
+ *
+ * @param[in] ipv6_hdr  IPv6 header to compress
+ * @param[in] netif_hdr network interface header of the packet
+ * @param[in] iface     interface the packet is sent over
+ * @param[out] iphc2    address compression bits (including
+ *                      @ref SIXLOWPAN_IPHC2_CID_EXT) of the second IPHC byte
+ * @param[out] cid_ext  context identifier extension
+ *
+ * @return  true on success
+ * @return  false if the IID of the source or destination could not be
+ *          determined
+ */
+static bool _iphc_addr_comp(const ipv6_hdr_t *ipv6_hdr,
+                            const gnrc_netif_hdr_t *netif_hdr,
+                            gnrc_netif_t *iface,
+                            uint8_t *iphc2, uint8_t *cid_ext)
 {
     gnrc_sixlowpan_ctx_t *src_ctx = NULL, *dst_ctx = NULL;
-    ipv6_hdr_t *ipv6_hdr;
-    bool addr_comp = false;
-    uint16_t inline_pos = SIXLOWPAN_IPHC_HDR_LEN;
-
-    assert(iface != NULL);
-
-    if (pkt->next == NULL) {
-        DEBUG("6lo iphc: packet missing header\n");
-        return 0;
-    }
-    ipv6_hdr = pkt->next->data;
+    const ipv6_addr_t *src = &ipv6_hdr->src, *dst = &ipv6_hdr->dst;
 
-    /* set initial dispatch value*/
-    iphc_hdr[IPHC1_IDX] = SIXLOWPAN_IPHC1_DISP;
-    iphc_hdr[IPHC2_IDX] = 0;
+    *iphc2 = 0;
+    *cid_ext = 0;
 
     /* check for available contexts */
-    if (!ipv6_addr_is_unspecified(&(ipv6_hdr->src))) {
-        src_ctx = gnrc_sixlowpan_ctx_lookup_addr(&(ipv6_hdr->src));
+    if (!ipv6_addr_is_unspecified(src)) {
+        src_ctx = gnrc_sixlowpan_ctx_lookup_addr(src);
         /* do not use source context for compression if */
         /* GNRC_SIXLOWPAN_CTX_FLAGS_COMP is not set */
         if (src_ctx && !(src_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_COMP)) {
@@ -1105,13 +1134,13 @@ static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
         }
         /* prefix bits not covered by context information must be zero */
         if (src_ctx &&
-            ipv6_addr_match_prefix(&src_ctx->prefix, &ipv6_hdr->src) < SIXLOWPAN_IPHC_PREFIX_LEN) {
+            ipv6_addr_match_prefix(&src_ctx->prefix, src) < SIXLOWPAN_IPHC_PREFIX_LEN) {
             src_ctx = NULL;
         }
     }
 
-    if (!ipv6_addr_is_multicast(&ipv6_hdr->dst)) {
-        dst_ctx = gnrc_sixlowpan_ctx_lookup_addr(&(ipv6_hdr->dst));
+    if (!ipv6_addr_is_multicast(dst)) {
+        dst_ctx = gnrc_sixlowpan_ctx_lookup_addr(dst);
         /* do not use destination context for compression if */
         /* GNRC_SIXLOWPAN_CTX_FLAGS_COMP is not set */
         if (dst_ctx && !(dst_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_COMP)) {
@@ -1119,98 +1148,36 @@ static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
         }
         /* prefix bits not covered by context information must be zero */
         if (dst_ctx &&
-            ipv6_addr_match_prefix(&dst_ctx->prefix, &ipv6_hdr->dst) < SIXLOWPAN_IPHC_PREFIX_LEN) {
+            ipv6_addr_match_prefix(&dst_ctx->prefix, dst) < SIXLOWPAN_IPHC_PREFIX_LEN) {
             dst_ctx = NULL;
         }
     }
 
     /* if contexts available and both != 0 */
-    /* since this moves inline_pos we have to do this ahead*/
     if (((src_ctx != NULL) &&
             ((src_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK) != 0)) ||
         ((dst_ctx != NULL) &&
             ((dst_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK) != 0))) {
         /* add context identifier extension */
-        iphc_hdr[IPHC2_IDX] |= SIXLOWPAN_IPHC2_CID_EXT;
-        iphc_hdr[CID_EXT_IDX] = 0;
-
-        /* move position to behind CID extension */
-        inline_pos += SIXLOWPAN_IPHC_CID_EXT_LEN;
+        *iphc2 |= SIXLOWPAN_IPHC2_CID_EXT;
     }
 
-    /* compress flow label and traffic class */
-    if (ipv6_hdr_get_fl(ipv6_hdr) == 0) {
-        if (ipv6_hdr_get_tc(ipv6_hdr) == 0) {
-            /* elide both traffic class and flow label */
-            iphc_hdr[IPHC1_IDX] |= IPHC_TF_ECN_ELIDE;
-        }
-        else {
-            /* elide flow label, traffic class (ECN + DSCP) inline (1 byte) */
-            iphc_hdr[IPHC1_IDX] |= IPHC_TF_ECN_DSCP;
-            iphc_hdr[inline_pos++] = ipv6_hdr_get_tc(ipv6_hdr);
-        }
+    if (ipv6_addr_is_unspecified(src)) {
+        *iphc2 |= IPHC_SAC_SAM_UNSPEC;
     }
     else {
-        if (ipv6_hdr_get_tc_dscp(ipv6_hdr) == 0) {
-            /* elide DSCP, ECN + 2-bit pad + flow label inline (3 byte) */
-            iphc_hdr[IPHC1_IDX] |= IPHC_TF_ECN_FL;
-            iphc_hdr[inline_pos++] = (uint8_t)((ipv6_hdr_get_tc_ecn(ipv6_hdr) << 6) |
-                                               ((ipv6_hdr_get_fl(ipv6_hdr) & 0x000f0000) >> 16));
-        }
-        else {
-            /* ECN + DSCP + 4-bit pad + flow label (4 bytes) */
-            iphc_hdr[IPHC1_IDX] |= IPHC_TF_ECN_DSCP_FL;
-            iphc_hdr[inline_pos++] = ipv6_hdr_get_tc(ipv6_hdr);
-            iphc_hdr[inline_pos++] = (uint8_t)((ipv6_hdr_get_fl(ipv6_hdr) & 0x000f0000) >> 16);
-        }
+        bool addr_comp = false;
 
-        /* copy remaining bytes of flow label */
-        iphc_hdr[inline_pos++] = (uint8_t)((ipv6_hdr_get_fl(ipv6_hdr) & 0x0000ff00) >> 8);
-        iphc_hdr[inline_pos++] = (uint8_t)(ipv6_hdr_get_fl(ipv6_hdr) & 0x000000ff);
-    }
-
-    /* check for compressible next header */
-    if (_compressible_nh(ipv6_hdr->nh)) {
-        iphc_hdr[IPHC1_IDX] |= SIXLOWPAN_IPHC1_NH;
-    }
-    else {
-        iphc_hdr[inline_pos++] = ipv6_hdr->nh;
-    }
-
-    /* compress hop limit */
-    switch (ipv6_hdr->hl) {
-        case 1:
-            iphc_hdr[IPHC1_IDX] |= IPHC_HL_1;
-            break;
-
-        case 64:
-            iphc_hdr[IPHC1_IDX] |= IPHC_HL_64;
-            break;
-
-        case 255:
-            iphc_hdr[IPHC1_IDX] |= IPHC_HL_255;
-            break;
-
-        default:
-            iphc_hdr[IPHC1_IDX] |= IPHC_HL_INLINE;
-            iphc_hdr[inline_pos++] = ipv6_hdr->hl;
-            break;
-    }
-
-    if (ipv6_addr_is_unspecified(&(ipv6_hdr->src))) {
-        iphc_hdr[IPHC2_IDX] |= IPHC_SAC_SAM_UNSPEC;
-    }
-    else {
         if (src_ctx != NULL) {
             /* stateful source address compression */
-            iphc_hdr[IPHC2_IDX] |= SIXLOWPAN_IPHC2_SAC;
+            *iphc2 |= SIXLOWPAN_IPHC2_SAC;
 
             if (((src_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK) != 0)) {
-                iphc_hdr[CID_EXT_IDX] |= ((src_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK) << 4);
+                *cid_ext |= ((src_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK) << 4);
             }
         }
 
-        if ((src_ctx != NULL) || ipv6_addr_is_link_local(&(ipv6_hdr->src))) {
+        if ((src_ctx != NULL) || ipv6_addr_is_link_local(src)) {
             eui64_t iid;
             iid.uint64.u64 = 0;
 
@@ -1218,160 +1185,371 @@ static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
             if (gnrc_netif_ipv6_get_iid(iface, &iid) < 0) {
                 DEBUG("6lo iphc: could not get interface's IID\n");
                 gnrc_netif_release(iface);
-                return 0;
+                return false;
             }
             gnrc_netif_release(iface);
 
-            if ((ipv6_hdr->src.u64[1].u64 == iid.uint64.u64) ||
-                _context_overlaps_iid(src_ctx, &ipv6_hdr->src, &iid)) {
+            if ((src->u64[1].u64 == iid.uint64.u64) ||
+                _context_overlaps_iid(src_ctx, src, &iid)) {
                 /* 0 bits. The address is derived from link-layer address */
-                iphc_hdr[IPHC2_IDX] |= IPHC_SAC_SAM_L2;
-                addr_comp = true;
+                *iphc2 |= IPHC_SAC_SAM_L2;
             }
-            else if ((byteorder_ntohl(ipv6_hdr->src.u32[2]) == 0x000000ff) &&
-                     (byteorder_ntohs(ipv6_hdr->src.u16[6]) == 0xfe00)) {
+            else if ((byteorder_ntohl(src->u32[2]) == 0x000000ff) &&
+                     (byteorder_ntohs(src->u16[6]) == 0xfe00)) {
                 /* 16 bits. The address is derived using 16 bits carried inline */
-                iphc_hdr[IPHC2_IDX] |= IPHC_SAC_SAM_16;
-                memcpy(iphc_hdr + inline_pos, ipv6_hdr->src.u16 + 7, 2);
-                inline_pos += 2;
-                addr_comp = true;
+                *iphc2 |= IPHC_SAC_SAM_16;
             }
             else {
                 /* 64 bits. The address is derived using 64 bits carried inline */
-                iphc_hdr[IPHC2_IDX] |= IPHC_SAC_SAM_64;
-                memcpy(iphc_hdr + inline_pos, ipv6_hdr->src.u64 + 1, 8);
-                inline_pos += 8;
-                addr_comp = true;
+                *iphc2 |= IPHC_SAC_SAM_64;
             }
+            addr_comp = true;
         }
 
         if (!addr_comp) {
             /* full address is carried inline */
-            iphc_hdr[IPHC2_IDX] |= IPHC_SAC_SAM_FULL;
-            memcpy(iphc_hdr + inline_pos, &ipv6_hdr->src, 16);
-            inline_pos += 16;
+            *iphc2 |= IPHC_SAC_SAM_FULL;
         }
     }
 
-    addr_comp = false;
-
     /* M: Multicast compression */
-    if (ipv6_addr_is_multicast(&(ipv6_hdr->dst))) {
-        iphc_hdr[IPHC2_IDX] |= SIXLOWPAN_IPHC2_M;
+    if (ipv6_addr_is_multicast(dst)) {
+        *iphc2 |= SIXLOWPAN_IPHC2_M;
 
         /* if multicast address is of format ffXX::XXXX:XXXX:XXXX */
-        if ((ipv6_hdr->dst.u16[1].u16 == 0) &&
-            (ipv6_hdr->dst.u32[1].u32 == 0) &&
-            (ipv6_hdr->dst.u16[4].u16 == 0)) {
+        if ((dst->u16[1].u16 == 0) &&
+            (dst->u32[1].u32 == 0) &&
+            (dst->u16[4].u16 == 0)) {
             /* if multicast address is of format ff02::XX */
-            if ((ipv6_hdr->dst.u8[1] == 0x02) &&
-                (ipv6_hdr->dst.u32[2].u32 == 0) &&
-                (ipv6_hdr->dst.u16[6].u16 == 0) &&
-                (ipv6_hdr->dst.u8[14] == 0)) {
+            if ((dst->u8[1] == 0x02) &&
+                (dst->u32[2].u32 == 0) &&
+                (dst->u16[6].u16 == 0) &&
+                (dst->u8[14] == 0)) {
                 /* 8 bits. The address is derived using 8 bits carried inline */
-                iphc_hdr[IPHC2_IDX] |= IPHC_M_DAC_DAM_M_8;
-                iphc_hdr[inline_pos++] = ipv6_hdr->dst.u8[15];
-                addr_comp = true;
+                *iphc2 |= IPHC_M_DAC_DAM_M_8;
             }
             /* if multicast address is of format ffXX::XX:XXXX */
-            else if ((ipv6_hdr->dst.u16[5].u16 == 0) &&
-                     (ipv6_hdr->dst.u8[12] == 0)) {
+            else if ((dst->u16[5].u16 == 0) &&
+                     (dst->u8[12] == 0)) {
                 /* 32 bits. The address is derived using 32 bits carried inline */
-                iphc_hdr[IPHC2_IDX] |= IPHC_M_DAC_DAM_M_32;
-                iphc_hdr[inline_pos++] = ipv6_hdr->dst.u8[1];
-                memcpy(iphc_hdr + inline_pos, ipv6_hdr->dst.u8 + 13, 3);
-                inline_pos += 3;
-                addr_comp = true;
+                *iphc2 |= IPHC_M_DAC_DAM_M_32;
             }
             /* if multicast address is of format ffXX::XX:XXXX:XXXX */
-            else if (ipv6_hdr->dst.u8[10] == 0) {
+            else if (dst->u8[10] == 0) {
                 /* 48 bits. The address is derived using 48 bits carried inline */
-                iphc_hdr[IPHC2_IDX] |= IPHC_M_DAC_DAM_M_48;
-                iphc_hdr[inline_pos++] = ipv6_hdr->dst.u8[1];
-                memcpy(iphc_hdr + inline_pos, ipv6_hdr->dst.u8 + 11, 5);
-                inline_pos += 5;
-                addr_comp = true;
+                *iphc2 |= IPHC_M_DAC_DAM_M_48;
             }
+            /* else full destination address is carried inline */
         }
         /* try unicast prefix based compression */
         else {
             gnrc_sixlowpan_ctx_t *ctx;
             ipv6_addr_t unicast_prefix;
-            unicast_prefix.u16[0] = ipv6_hdr->dst.u16[2];
-            unicast_prefix.u16[1] = ipv6_hdr->dst.u16[3];
-            unicast_prefix.u16[2] = ipv6_hdr->dst.u16[4];
-            unicast_prefix.u16[3] = ipv6_hdr->dst.u16[5];
+            unicast_prefix.u16[0] = dst->u16[2];
+            unicast_prefix.u16[1] = dst->u16[3];
+            unicast_prefix.u16[2] = dst->u16[4];
+            unicast_prefix.u16[3] = dst->u16[5];
 
             ctx = gnrc_sixlowpan_ctx_lookup_addr(&unicast_prefix);
 
             if ((ctx != NULL) && (ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_COMP) &&
-                (ctx->prefix_len == ipv6_hdr->dst.u8[3])) {
+                (ctx->prefix_len == dst->u8[3])) {
                 /* Unicast prefix based IPv6 multicast address
                  * (https://tools.ietf.org/html/rfc3306) with given context
                  * for unicast prefix -> context based compression */
-                iphc_hdr[IPHC2_IDX] |= SIXLOWPAN_IPHC2_DAC;
+                *iphc2 |= IPHC_M_DAC_DAM_M_UC_PREFIX;
                 if ((ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK) != 0) {
-                    iphc_hdr[CID_EXT_IDX] |= (ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK);
+                    *cid_ext |= (ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK);
                 }
-                iphc_hdr[inline_pos++] = ipv6_hdr->dst.u8[1];
-                iphc_hdr[inline_pos++] = ipv6_hdr->dst.u8[2];
-                memcpy(iphc_hdr + inline_pos, ipv6_hdr->dst.u16 + 6, 4);
-                inline_pos += 4;
-                addr_comp = true;
             }
         }
     }
     else if (((dst_ctx != NULL) ||
-              ipv6_addr_is_link_local(&ipv6_hdr->dst)) && (netif_hdr->dst_l2addr_len > 0)) {
+              ipv6_addr_is_link_local(dst)) && (netif_hdr->dst_l2addr_len > 0)) {
         eui64_t iid;
 
         if (dst_ctx != NULL) {
             /* stateful destination address compression */
-            iphc_hdr[IPHC2_IDX] |= SIXLOWPAN_IPHC2_DAC;
+            *iphc2 |= SIXLOWPAN_IPHC2_DAC;
 
             if (((dst_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK) != 0)) {
-                iphc_hdr[CID_EXT_IDX] |= (dst_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK);
+                *cid_ext |= (dst_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK);
             }
         }
 
         if (gnrc_netif_hdr_ipv6_iid_from_dst(iface, netif_hdr, &iid) < 0) {
             DEBUG("6lo iphc: could not get destination's IID\n");
-            return 0;
+            return false;
         }
 
-        if ((ipv6_hdr->dst.u64[1].u64 == iid.uint64.u64) ||
-            _context_overlaps_iid(dst_ctx, &(ipv6_hdr->dst), &iid)) {
+        if ((dst->u64[1].u64 == iid.uint64.u64) ||
+            _context_overlaps_iid(dst_ctx, dst, &iid)) {
             /* 0 bits. The address is derived using the link-layer address */
-            iphc_hdr[IPHC2_IDX] |= IPHC_M_DAC_DAM_U_L2;
-            addr_comp = true;
+            *iphc2 |= IPHC_M_DAC_DAM_U_L2;
         }
-        else if ((byteorder_ntohl(ipv6_hdr->dst.u32[2]) == 0x000000ff) &&
-                 (byteorder_ntohs(ipv6_hdr->dst.u16[6]) == 0xfe00)) {
+        else if ((byteorder_ntohl(dst->u32[2]) == 0x000000ff) &&
+                 (byteorder_ntohs(dst->u16[6]) == 0xfe00)) {
             /* 16 bits. The address is derived using 16 bits carried inline */
-            iphc_hdr[IPHC2_IDX] |= IPHC_M_DAC_DAM_U_16;
-            memcpy(&(iphc_hdr[inline_pos]), &(ipv6_hdr->dst.u16[7]), 2);
-            inline_pos += 2;
-            addr_comp = true;
+            *iphc2 |= IPHC_M_DAC_DAM_U_16;
         }
         else {
             /* 64 bits. The address is derived using 64 bits carried inline */
-            iphc_hdr[IPHC2_IDX] |= IPHC_M_DAC_DAM_U_64;
-            memcpy(&(iphc_hdr[inline_pos]), &(ipv6_hdr->dst.u8[8]), 8);
-            inline_pos += 8;
-            addr_comp = true;
+            *iphc2 |= IPHC_M_DAC_DAM_U_64;
         }
     }
+    /* else full destination address is carried inline */
+
+    return true;
+}
+
+/**
+ * @brief   Writes the inline parts of the addresses for the address
+ *          compression chosen by @ref _iphc_addr_comp
+ *
+ * @param[in] ipv6_hdr  IPv6 header to compress
+ * @param[in] iphc2     address compression bits of the second IPHC byte
+ * @param[out] iphc_hdr IPHC header
+ * @param[in] inline_pos    position to write the addresses to in @p iphc_hdr
+ *
+ * @return  position in @p iphc_hdr behind the inline addresses
+ */
+static uint16_t _iphc_addr_inline(const ipv6_hdr_t *ipv6_hdr, uint8_t iphc2,
+                                  uint8_t *iphc_hdr, uint16_t inline_pos)
+{
+    const ipv6_addr_t *src = &ipv6_hdr->src, *dst = &ipv6_hdr->dst;
 
-    if (!addr_comp) {
-        /* full destination address is carried inline */
-        iphc_hdr[IPHC2_IDX] |= IPHC_SAC_SAM_FULL;
-        memcpy(iphc_hdr + inline_pos, &ipv6_hdr->dst, 16);
-        inline_pos += 16;
+    switch (iphc2 & (SIXLOWPAN_IPHC2_SAC | SIXLOWPAN_IPHC2_SAM)) {
+        case IPHC_SAC_SAM_FULL:
+            memcpy(iphc_hdr + inline_pos, src, 16);
+            inline_pos += 16;
+            break;
+        case IPHC_SAC_SAM_64:
+        case IPHC_SAC_SAM_CTX_64:
+            memcpy(iphc_hdr + inline_pos, src->u64 + 1, 8);
+            inline_pos += 8;
+            break;
+        case IPHC_SAC_SAM_16:
+        case IPHC_SAC_SAM_CTX_16:
+            memcpy(iphc_hdr + inline_pos, src->u16 + 7, 2);
+            inline_pos += 2;
+            break;
+        default:
+            /* unspecified or derived from link-layer address */
+            break;
+    }
+
+    switch (iphc2 & (SIXLOWPAN_IPHC2_M | SIXLOWPAN_IPHC2_DAC |
+                     SIXLOWPAN_IPHC2_DAM)) {
+        case IPHC_M_DAC_DAM_U_FULL:
+        case IPHC_M_DAC_DAM_M_FULL:
+            memcpy(iphc_hdr + inline_pos, dst, 16);
+            inline_pos += 16;
+            break;
+        case IPHC_M_DAC_DAM_U_64:
+        case IPHC_M_DAC_DAM_U_CTX_64:
+            memcpy(iphc_hdr + inline_pos, dst->u8 + 8, 8);
+            inline_pos += 8;
+            break;
+        case IPHC_M_DAC_DAM_U_16:
+        case IPHC_M_DAC_DAM_U_CTX_16:
+            memcpy(iphc_hdr + inline_pos, dst->u16 + 7, 2);
+            inline_pos += 2;
+            break;
+        case IPHC_M_DAC_DAM_M_48:
+            iphc_hdr[inline_pos++] = dst->u8[1];
+            memcpy(iphc_hdr + inline_pos, dst->u8 + 11, 5);
+            inline_pos += 5;
+            break;
+        case IPHC_M_DAC_DAM_M_32:
+            iphc_hdr[inline_pos++] = dst->u8[1];
+            memcpy(iphc_hdr + inline_pos, dst->u8 + 13, 3);
+            inline_pos += 3;
+            break;
+        case IPHC_M_DAC_DAM_M_8:
+            iphc_hdr[inline_pos++] = dst->u8[15];
+            break;
+        case IPHC_M_DAC_DAM_M_UC_PREFIX:
+            iphc_hdr[inline_pos++] = dst->u8[1];
+            iphc_hdr[inline_pos++] = dst->u8[2];
+            memcpy(iphc_hdr + inline_pos, dst->u16 + 6, 4);
+            inline_pos += 4;
+            break;
+        default:
+            /* derived from link-layer address */
+            break;
     }
 
     return inline_pos;
 }
 
+#if IPHC_CACHE_SIZE
+/**
+ * @brief   Looks up the address compression of a flow in the cache or
+ *          chooses and caches it on a miss
+ *
+ * @see _iphc_addr_comp
+ */
+static bool _iphc_addr_comp_cached(const ipv6_hdr_t *ipv6_hdr,
+                                   const gnrc_netif_hdr_t *netif_hdr,
+                                   gnrc_netif_t *iface,
+                                   uint8_t *iphc2, uint8_t *cid_ext)
+{
+    uint32_t version = gnrc_sixlowpan_ctx_version();
+    const uint8_t *dst_l2addr = gnrc_netif_hdr_get_dst_addr(netif_hdr);
+    _iphc_cache_t *entry;
+
+    for (entry = _cache; entry < &_cache[IPHC_CACHE_SIZE]; entry++) {
+        if ((entry->iface == iface->pid) &&
+            ipv6_addr_equal(&entry->src, &ipv6_hdr->src) &&
+            ipv6_addr_equal(&entry->dst, &ipv6_hdr->dst) &&
+            (entry->dst_l2addr_len == netif_hdr->dst_l2addr_len) &&
+            (memcmp(entry->dst_l2addr, dst_l2addr,
+                    netif_hdr->dst_l2addr_len) == 0)) {
+            break;
+        }
+    }
+    if ((entry != &_cache[IPHC_CACHE_SIZE]) &&
+        (entry->ctx_version == version)) {
+        bool hit;
+
+        /* the IID of the source address is derived from the interface's
+         * link-layer address, so it must not have changed either */
+        gnrc_netif_acquire(iface);
+        hit = (entry->src_l2addr_len == iface->l2addr_len) &&
+              (memcmp(entry->src_l2addr, iface->l2addr,
+                      iface->l2addr_len) == 0);
+        gnrc_netif_release(iface);
+        if (hit) {
+            *iphc2 = entry->iphc2;
+            *cid_ext = entry->cid_ext;
+            return true;
+        }
+    }
+    if (!_iphc_addr_comp(ipv6_hdr, netif_hdr, iface, iphc2, cid_ext)) {
+        return false;
+    }
+    if ((netif_hdr->dst_l2addr_len > sizeof(entry->dst_l2addr)) ||
+        (iface->l2addr_len > sizeof(entry->src_l2addr))) {
+        return true;
+    }
+    if (entry == &_cache[IPHC_CACHE_SIZE]) {
+        /* replace entries round robin */
+        entry = &_cache[_cache_next];
+        _cache_next = (_cache_next + 1) % IPHC_CACHE_SIZE;
+    }
+    entry->src = ipv6_hdr->src;
+    entry->dst = ipv6_hdr->dst;
+    entry->ctx_version = version;
+    entry->iface = iface->pid;
+    gnrc_netif_acquire(iface);
+    entry->src_l2addr_len = iface->l2addr_len;
+    memcpy(entry->src_l2addr, iface->l2addr, iface->l2addr_len);
+    gnrc_netif_release(iface);
+    entry->dst_l2addr_len = netif_hdr->dst_l2addr_len;
+    memcpy(entry->dst_l2addr, dst_l2addr, netif_hdr->dst_l2addr_len);
+    entry->iphc2 = *iphc2;
+    entry->cid_ext = *cid_ext;
+    return true;
+}
+#else
+#define _iphc_addr_comp_cached  _iphc_addr_comp
+#endif
+
+static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
+                                const gnrc_netif_hdr_t *netif_hdr,
+                                gnrc_netif_t *iface,
+                                uint8_t *iphc_hdr)
+{
+    ipv6_hdr_t *ipv6_hdr;
+    uint16_t inline_pos = SIXLOWPAN_IPHC_HDR_LEN;
+    uint8_t iphc2, cid_ext;
+
+    assert(iface != NULL);
+
+    if (pkt->next == NULL) {
+        DEBUG("6lo iphc: packet missing header\n");
+        return 0;
+    }
+    ipv6_hdr = pkt->next->data;
+
+    if (!_iphc_addr_comp_cached(ipv6_hdr, netif_hdr, iface, &iphc2, &cid_ext)) {
+        return 0;
+    }
+
+    /* set initial dispatch value*/
+    iphc_hdr[IPHC1_IDX] = SIXLOWPAN_IPHC1_DISP;
+    iphc_hdr[IPHC2_IDX] = iphc2;
+
+    /* since this moves inline_pos we have to do this ahead*/
+    if (iphc2 & SIXLOWPAN_IPHC2_CID_EXT) {
+        iphc_hdr[CID_EXT_IDX] = cid_ext;
+
+        /* move position to behind CID extension */
+        inline_pos += SIXLOWPAN_IPHC_CID_EXT_LEN;
+    }
+
+    /* compress flow label and traffic class */
+    if (ipv6_hdr_get_fl(ipv6_hdr) == 0) {
+        if (ipv6_hdr_get_tc(ipv6_hdr) == 0) {
+            /* elide both traffic class and flow label */
+            iphc_hdr[IPHC1_IDX] |= IPHC_TF_ECN_ELIDE;
+        }
+        else {
+            /* elide flow label, traffic class (ECN + DSCP) inline (1 byte) */
+            iphc_hdr[IPHC1_IDX] |= IPHC_TF_ECN_DSCP;
+            iphc_hdr[inline_pos++] = ipv6_hdr_get_tc(ipv6_hdr);
+        }
+    }
+    else {
+        if (ipv6_hdr_get_tc_dscp(ipv6_hdr) == 0) {
+            /* elide DSCP, ECN + 2-bit pad + flow label inline (3 byte) */
+            iphc_hdr[IPHC1_IDX] |= IPHC_TF_ECN_FL;
+            iphc_hdr[inline_pos++] = (uint8_t)((ipv6_hdr_get_tc_ecn(ipv6_hdr) << 6) |
+                                               ((ipv6_hdr_get_fl(ipv6_hdr) & 0x000f0000) >> 16));
+        }
+        else {
+            /* ECN + DSCP + 4-bit pad + flow label (4 bytes) */
+            iphc_hdr[IPHC1_IDX] |= IPHC_TF_ECN_DSCP_FL;
+            iphc_hdr[inline_pos++] = ipv6_hdr_get_tc(ipv6_hdr);
+            iphc_hdr[inline_pos++] = (uint8_t)((ipv6_hdr_get_fl(ipv6_hdr) & 0x000f0000) >> 16);
+        }
+
+        /* copy remaining bytes of flow label */
+        iphc_hdr[inline_pos++] = (uint8_t)((ipv6_hdr_get_fl(ipv6_hdr) & 0x0000ff00) >> 8);
+        iphc_hdr[inline_pos++] = (uint8_t)(ipv6_hdr_get_fl(ipv6_hdr) & 0x000000ff);
+    }
+
+    /* check for compressible next header */
+    if (_compressible_nh(ipv6_hdr->nh)) {
+        iphc_hdr[IPHC1_IDX] |= SIXLOWPAN_IPHC1_NH;
+    }
+    else {
+        iphc_hdr[inline_pos++] = ipv6_hdr->nh;
+    }
+
+    /* compress hop limit */
+    switch (ipv6_hdr->hl) {
+        case 1:
+            iphc_hdr[IPHC1_IDX] |= IPHC_HL_1;
+            break;
+
+        case 64:
+            iphc_hdr[IPHC1_IDX] |= IPHC_HL_64;
+            break;
+
+        case 255:
+            iphc_hdr[IPHC1_IDX] |= IPHC_HL_255;
+            break;
+
+        default:
+            iphc_hdr[IPHC1_IDX] |= IPHC_HL_INLINE;
+            iphc_hdr[inline_pos++] = ipv6_hdr->hl;
+            break;
+    }
+
+    return _iphc_addr_inline(ipv6_hdr, iphc2, iphc_hdr, inline_pos);
+}
+
 #ifdef MODULE_GNRC_SIXLOWPAN_IPHC_NHC
 static ssize_t _iphc_nhc_ipv6_ext_encode(uint8_t *nhc_data,
                                         const gnrc_pktsnip_t *ext,
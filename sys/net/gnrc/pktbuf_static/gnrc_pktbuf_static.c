@@ -30,6 +30,7 @@
 #include "net/gnrc/pktbuf.h"
 #include "net/gnrc/nettype.h"
 #include "net/gnrc/pkt.h"
+#include "net/netstats.h"
 #include "string_utils.h"
 
 #include "pktbuf_internal.h"
@@ -390,6 +391,7 @@ static void *_pktbuf_alloc(size_t size)
     }
     if (ptr == NULL) {
         DEBUG("pktbuf: no space left in packet buffer\n");
+        netstats_drop(NETSTATS_DROP_NO_BUF);
         return NULL;
     }
     /* _unused_t struct would fit => add new space at ptr */
@@ -40,7 +40,8 @@
 
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 
-static gnrc_rpl_parent_t *_gnrc_rpl_find_preferred_parent(gnrc_rpl_dodag_t *dodag);
+static gnrc_rpl_parent_t *_gnrc_rpl_find_preferred_parent(gnrc_rpl_dodag_t *dodag,
+                                                          gnrc_rpl_parent_t *changed);
 
 static void _rpl_trickle_send_dio(void *args)
 {
@@ -296,7 +297,9 @@ void gnrc_rpl_parent_update(gnrc_rpl_dodag_t *dodag, gnrc_rpl_parent_t *parent)
         if (dodag->instance->mop != GNRC_RPL_P2P_MOP) {
 #endif
         if (parent == dodag->parents) {
-            gnrc_ipv6_nib_ft_del(NULL, 0);
+            /* the default route already points to the preferred parent, so
+             * only refresh its lifetime instead of removing it (and with it
+             * all destination cache entries via the parent) on every DIO */
             gnrc_ipv6_nib_ft_add(NULL, 0, &parent->addr, dodag->iface,
                                  _dflt_route_lifetime_sec(dodag));
         }
@@ -305,20 +308,75 @@ void gnrc_rpl_parent_update(gnrc_rpl_dodag_t *dodag, gnrc_rpl_parent_t *parent)
 #endif
     }
 
-    if (_gnrc_rpl_find_preferred_parent(dodag) == NULL) {
+    if (_gnrc_rpl_find_preferred_parent(dodag, parent) == NULL) {
         gnrc_rpl_local_repair(dodag);
     }
 }
 
+/**
+ * @brief   Sort the parents of a DODAG by the objective function
+ *
+ * The parents are kept sorted, so usually only the parent whose rank was
+ * updated needs to be moved. The result is the same as that of a stable sort
+ * of the whole list.
+ *
+ * @param[in] dodag     Pointer to the DODAG
+ * @param[in] changed   Parent that was updated since the last sort. May be NULL.
+ */
+static void _sort_parents(gnrc_rpl_dodag_t *dodag, gnrc_rpl_parent_t *changed)
+{
+    int (*cmp)(gnrc_rpl_parent_t *, gnrc_rpl_parent_t *) = dodag->instance->of->parent_cmp;
+    gnrc_rpl_parent_t **pos = &dodag->parents;
+    gnrc_rpl_parent_t *prev = NULL;
+
+    while ((*pos != NULL) && (*pos != changed)) {
+        prev = *pos;
+        pos = &(*pos)->next;
+    }
+    if ((changed != NULL) && (*pos == changed)) {
+        gnrc_rpl_parent_t *next = changed->next;
+
+        if ((prev != NULL) && (cmp(prev, changed) > 0)) {
+            /* move towards the head, behind the parents comparing equal */
+            *pos = next;
+            pos = &dodag->parents;
+            while (cmp(*pos, changed) <= 0) {
+                pos = &(*pos)->next;
+            }
+            changed->next = *pos;
+            *pos = changed;
+        }
+        else if ((next != NULL) && (cmp(changed, next) > 0)) {
+            /* move towards the tail, in front of the parents comparing equal */
+            *pos = next;
+            pos = &next->next;
+            while ((*pos != NULL) && (cmp(*pos, changed) < 0)) {
+                pos = &(*pos)->next;
+            }
+            changed->next = *pos;
+            *pos = changed;
+        }
+    }
+    /* the objective function might order parents by more than their rank */
+    for (gnrc_rpl_parent_t *elt = dodag->parents; elt && elt->next; elt = elt->next) {
+        if (cmp(elt, elt->next) > 0) {
+            LL_SORT(dodag->parents, cmp);
+            break;
+        }
+    }
+}
+
 /**
  * @brief   Find the parent with the lowest rank and update the DODAG's preferred parent
  *
  * @param[in] dodag     Pointer to the DODAG
+ * @param[in] changed   Parent that was updated. May be NULL.
  *
  * @return  Pointer to the preferred parent, on success.
  * @return  NULL, otherwise.
  */
-static gnrc_rpl_parent_t *_gnrc_rpl_find_preferred_parent(gnrc_rpl_dodag_t *dodag)
+static gnrc_rpl_parent_t *_gnrc_rpl_find_preferred_parent(gnrc_rpl_dodag_t *dodag,
+                                                          gnrc_rpl_parent_t *changed)
 {
     gnrc_rpl_parent_t *old_best = dodag->parents;
     gnrc_rpl_parent_t *new_best;
@@ -330,7 +388,7 @@ static gnrc_rpl_parent_t *_gnrc_rpl_find_preferred_parent(gnrc_rpl_dodag_t *doda
         return NULL;
     }
 
-    LL_SORT(dodag->parents, dodag->instance->of->parent_cmp);
+    _sort_parents(dodag, changed);
     new_best = dodag->parents;
 
     if (new_best->rank == GNRC_RPL_INFINITE_RANK) {
@@ -63,6 +63,16 @@ extern "C" {
 #define CONFIG_GNRC_SOCK_UDP_CHECK_REMOTE_ADDR (1)
 #endif
 
+/**
+ * @brief   Number of hash buckets for bound UDP socks (must be a power of 2)
+ *
+ * Only used with module `gnrc_sock_check_reuse`. Socks are hashed by their
+ * local port, so checking a port for reuse only walks the socks in one bucket.
+ */
+#ifndef CONFIG_GNRC_SOCK_UDP_BUCKETS
+#define CONFIG_GNRC_SOCK_UDP_BUCKETS (4U)
+#endif
+
 /**
  * @brief   Structure to retrieve auxiliary data from @ref gnrc_sock_recv
  *
@@ -19,6 +19,7 @@
 #include <errno.h>
 #include <string.h>
 
+#include "bitfield.h"
 #include "byteorder.h"
 #include "net/af.h"
 #include "net/protnum.h"
@@ -34,36 +35,109 @@
 #include "debug.h"
 
 #ifdef MODULE_GNRC_SOCK_CHECK_REUSE
-static sock_udp_t *_udp_socks = NULL;
+static_assert((CONFIG_GNRC_SOCK_UDP_BUCKETS & (CONFIG_GNRC_SOCK_UDP_BUCKETS - 1)) == 0,
+              "CONFIG_GNRC_SOCK_UDP_BUCKETS must be a power of 2");
+
+/* bound socks, hashed by local port */
+static sock_udp_t *_udp_socks[CONFIG_GNRC_SOCK_UDP_BUCKETS];
+#endif
+#if IS_USED(MODULE_GNRC_SOCK_UDP_PORTMAP)
+/* dynamic ports used by socks bound to the unspecified address */
+static BITFIELD(_dyn_ports, GNRC_SOCK_DYN_PORTRANGE_NUM);
 #endif
 
+#ifdef MODULE_GNRC_SOCK_CHECK_REUSE
+static inline sock_udp_t **_bucket(uint16_t port)
+{
+    return &_udp_socks[port & (CONFIG_GNRC_SOCK_UDP_BUCKETS - 1)];
+}
+
+static bool _addr_unspec(const sock_udp_ep_t *ep)
+{
+    const uint8_t *const p = (uint8_t *)&ep->addr;
+
+    for (unsigned i = 0; i < sizeof(ep->addr); i++) {
+        if (p[i] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static inline bool _is_dyn_port(uint16_t port)
+{
+    return (unsigned)(port - GNRC_SOCK_DYN_PORTRANGE_MIN) <
+           GNRC_SOCK_DYN_PORTRANGE_NUM;
+}
+
 /**
- * @brief   Checks if a given UDP port is already used by another sock
+ * @brief   Checks if a given UDP port is already used by a sock bound to the
+ *          unspecified address, ignoring @p skip
  */
-static bool _dyn_port_used(uint16_t port)
+static bool _port_used(uint16_t port, const sock_udp_t *skip)
 {
-#ifdef MODULE_GNRC_SOCK_CHECK_REUSE
-    for (sock_udp_t *ptr = _udp_socks; ptr != NULL;
+    for (sock_udp_t *ptr = *_bucket(port); ptr != NULL;
          ptr = (sock_udp_t *)ptr->reg.next) {
-        bool spec_addr = false;
-        for (unsigned i = 0; i < sizeof(ptr->local.addr); i++) {
-            const uint8_t *const p = (uint8_t *)&ptr->local.addr;
-            if (p[i] != 0) {
-                spec_addr = true;
-            }
-        }
-        if (spec_addr) {
-            continue;
-        }
-        if (ptr->local.port == port) {
-            /* port already in use by another sock */
+        if ((ptr != skip) && (ptr->local.port == port) &&
+            _addr_unspec(&ptr->local)) {
             return true;
         }
     }
+    return false;
+}
+
+/**
+ * @brief   Adds a bound sock to the sock table
+ */
+static void _add_sock(sock_udp_t *sock)
+{
+    sock_udp_t **bucket = _bucket(sock->local.port);
+
+    /* prepend to current socks */
+    sock->reg.next = (gnrc_sock_reg_t *)*bucket;
+    *bucket = sock;
+#if IS_USED(MODULE_GNRC_SOCK_UDP_PORTMAP)
+    if (_is_dyn_port(sock->local.port) && _addr_unspec(&sock->local)) {
+        bf_set(_dyn_ports, sock->local.port - GNRC_SOCK_DYN_PORTRANGE_MIN);
+    }
+#endif
+}
+
+/**
+ * @brief   Removes a sock from the sock table
+ */
+static void _remove_sock(sock_udp_t *sock)
+{
+    sock_udp_t **bucket = _bucket(sock->local.port);
+    gnrc_sock_reg_t *head = (gnrc_sock_reg_t *)*bucket;
+
+    if (head == NULL) {
+        return;
+    }
+    LL_DELETE(head, &sock->reg);
+    *bucket = (sock_udp_t *)head;
+#if IS_USED(MODULE_GNRC_SOCK_UDP_PORTMAP)
+    if (_is_dyn_port(sock->local.port) && _addr_unspec(&sock->local) &&
+        !_port_used(sock->local.port, sock)) {
+        bf_unset(_dyn_ports, sock->local.port - GNRC_SOCK_DYN_PORTRANGE_MIN);
+    }
+#endif
+}
+#endif /* MODULE_GNRC_SOCK_CHECK_REUSE */
+
+/**
+ * @brief   Checks if a given UDP port is already used by another sock
+ */
+static bool _dyn_port_used(uint16_t port)
+{
+#if IS_USED(MODULE_GNRC_SOCK_UDP_PORTMAP)
+    return bf_isset(_dyn_ports, port - GNRC_SOCK_DYN_PORTRANGE_MIN);
+#elif defined(MODULE_GNRC_SOCK_CHECK_REUSE)
+    return _port_used(port, NULL);
 #else
     (void) port;
-#endif /* MODULE_GNRC_SOCK_CHECK_REUSE */
     return false;
+#endif
 }
 
 /**
@@ -71,9 +145,31 @@ static bool _dyn_port_used(uint16_t port)
  *
  * implements "Another Simple Port Randomization Algorithm" as specified in
  * RFC 6056, see https://tools.ietf.org/html/rfc6056#section-3.3.2
+ *
+ * With the port bitmap, "Simple Port Randomization Algorithm" (see
+ * https://tools.ietf.org/html/rfc6056#section-3.3.1) is used instead, so
+ * a free port is found without random probing even if most ports are used.
  */
 static uint16_t _get_dyn_port(sock_udp_t *sock)
 {
+#if IS_USED(MODULE_GNRC_SOCK_UDP_PORTMAP)
+    unsigned idx = random_uint32() % GNRC_SOCK_DYN_PORTRANGE_NUM;
+
+    if (sock && (sock->flags & SOCK_FLAGS_REUSE_EP)) {
+        return GNRC_SOCK_DYN_PORTRANGE_MIN + idx;
+    }
+    for (unsigned n = 0; n < GNRC_SOCK_DYN_PORTRANGE_NUM;) {
+        if (!_dyn_port_used(GNRC_SOCK_DYN_PORTRANGE_MIN + idx)) {
+            return GNRC_SOCK_DYN_PORTRANGE_MIN + idx;
+        }
+        /* skip fully used bytes of the bitmap */
+        unsigned step = (((idx & 7) == 0) && (_dyn_ports[idx / 8] == 0xff))
+                      ? 8 : 1;
+        n += step;
+        idx = (idx + step) % GNRC_SOCK_DYN_PORTRANGE_NUM;
+    }
+    return GNRC_SOCK_DYN_PORTRANGE_ERR;
+#else
     unsigned count = GNRC_SOCK_DYN_PORTRANGE_NUM;
     do {
         uint16_t port = GNRC_SOCK_DYN_PORTRANGE_MIN +
@@ -84,6 +180,7 @@ static uint16_t _get_dyn_port(sock_udp_t *sock)
         --count;
     } while (count > 0);
     return GNRC_SOCK_DYN_PORTRANGE_ERR;
+#endif
 }
 
 int sock_udp_create(sock_udp_t *sock, const sock_udp_ep_t *local,
@@ -112,19 +209,19 @@ int sock_udp_create(sock_udp_t *sock, const sock_udp_ep_t *local,
         }
 #ifdef MODULE_GNRC_SOCK_CHECK_REUSE
         else if (!(flags & SOCK_FLAGS_REUSE_EP)) {
-            for (sock_udp_t *ptr = _udp_socks; ptr != NULL;
+            for (sock_udp_t *ptr = *_bucket(port); ptr != NULL;
                  ptr = (sock_udp_t *)ptr->reg.next) {
                 if (memcmp(&ptr->local, local, sizeof(sock_udp_ep_t)) == 0) {
                     return -EADDRINUSE;
                 }
             }
         }
-        /* prepend to current socks */
-        sock->reg.next = (gnrc_sock_reg_t *)_udp_socks;
-        _udp_socks = sock;
 #endif
         memcpy(&sock->local, local, sizeof(sock_udp_ep_t));
         sock->local.port = port;
+#ifdef MODULE_GNRC_SOCK_CHECK_REUSE
+        _add_sock(sock);
+#endif
     }
     memset(&sock->remote, 0, sizeof(sock_udp_ep_t));
     if (remote != NULL) {
@@ -156,10 +253,7 @@ void sock_udp_close(sock_udp_t *sock)
     assert(sock != NULL);
     gnrc_netreg_unregister(GNRC_NETTYPE_UDP, &sock->reg.entry);
 #ifdef MODULE_GNRC_SOCK_CHECK_REUSE
-    if (_udp_socks != NULL) {
-        gnrc_sock_reg_t *head = (gnrc_sock_reg_t *)_udp_socks;
-        LL_DELETE(head, (gnrc_sock_reg_t *)sock);
-    }
+    _remove_sock(sock);
 #endif
 }
 
@@ -353,9 +447,41 @@ ssize_t sock_udp_recv_buf_aux(sock_udp_t *sock, void **data, void **buf_ctx,
     return res;
 }
 
-ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
-                           const iolist_t *snips,
-                           const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux)
+int sock_udp_recv_many(sock_udp_t *sock, sock_udp_mmsg_t *msgs, unsigned num,
+                       uint32_t timeout)
+{
+    unsigned i = 0;
+
+    assert((sock != NULL) && (msgs != NULL) && (num > 0));
+    while (i < num) {
+        sock_udp_mmsg_t *msg = &msgs[i];
+        void *data, *pkt = NULL;
+        ssize_t res = sock_udp_recv_buf_aux(sock, &data, &pkt, timeout,
+                                            &msg->remote, &msg->aux.rx);
+
+        if ((res == -EPROTO) && (i > 0)) {
+            /* packet from wrong remote was dropped, try next */
+            continue;
+        }
+        if (res < 0) {
+            return (i > 0) ? (int)i : res;
+        }
+        /* received payload is always a single snip */
+        msg->truncated = ((size_t)res > msg->len);
+        if (!msg->truncated) {
+            msg->len = res;
+        }
+        memcpy(msg->data, data, msg->len);
+        gnrc_pktbuf_release(pkt);
+        /* only wait for the first datagram */
+        timeout = 0;
+        i++;
+    }
+    return i;
+}
+
+static ssize_t _sendv(sock_udp_t *sock, const iolist_t *snips,
+                      const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux)
 {
     (void)aux;
     int res;
@@ -410,9 +536,7 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
             }
             gnrc_sock_create(&sock->reg, GNRC_NETTYPE_UDP, src_port);
 #ifdef MODULE_GNRC_SOCK_CHECK_REUSE
-            /* prepend to current socks */
-            sock->reg.next = (gnrc_sock_reg_t *)_udp_socks;
-            _udp_socks = sock;
+            _add_sock(sock);
 #endif /* MODULE_GNRC_SOCK_CHECK_REUSE */
         }
     }
@@ -467,15 +591,56 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
     if (res > 0) {
         res -= sizeof(udp_hdr_t);
     }
+    return res;
+}
+
+static void _notify_sent(sock_udp_t *sock)
+{
 #ifdef SOCK_HAS_ASYNC
     if ((sock != NULL) && (sock->reg.async_cb.udp)) {
         sock->reg.async_cb.udp(sock, SOCK_ASYNC_MSG_SENT,
                                sock->reg.async_cb_arg);
     }
+#else
+    (void)sock;
 #endif  /* SOCK_HAS_ASYNC */
+}
+
+ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
+                           const iolist_t *snips,
+                           const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux)
+{
+    ssize_t res = _sendv(sock, snips, remote, aux);
+
+    _notify_sent(sock);
     return res;
 }
 
+int sock_udp_send_many(sock_udp_t *sock, sock_udp_mmsg_t *msgs, unsigned num)
+{
+    ssize_t res = 0;
+    unsigned i;
+
+    assert((msgs != NULL) && (num > 0));
+    for (i = 0; i < num; i++) {
+        const iolist_t snip = {
+            NULL,
+            msgs[i].data,
+            msgs[i].len,
+        };
+
+        res = _sendv(sock, &snip,
+                     (msgs[i].remote.port != 0) ? &msgs[i].remote : NULL,
+                     &msgs[i].aux.tx);
+        if (res < 0) {
+            break;
+        }
+    }
+    /* one notification for the whole batch */
+    _notify_sent(sock);
+    return (i > 0) ? (int)i : res;
+}
+
 #ifdef SOCK_HAS_ASYNC
 void sock_udp_set_cb(sock_udp_t *sock, sock_udp_cb_t cb, void *arg)
 {
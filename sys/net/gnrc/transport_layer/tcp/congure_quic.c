@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       QUIC congestion control for GNRC TCP
+ *
+ * @author      agent <agent@local>
+ * @}
+ */
+
+#include "congure/quic.h"
+#include "net/gnrc/tcp/config.h"
+
+#include "include/gnrc_tcp_congure.h"
+
+/* initial window from RFC 9002, section 7.2 */
+#define INIT_WND    ((10U * CONFIG_GNRC_TCP_MSS < 14720U) \
+                     ? (10U * CONFIG_GNRC_TCP_MSS) \
+                     : ((2U * CONFIG_GNRC_TCP_MSS > 14720U) \
+                        ? (2U * CONFIG_GNRC_TCP_MSS) : 14720U))
+
+static const congure_quic_snd_consts_t _tcp_congure_quic_consts = {
+    /* cong_event_cb is not needed, since GNRC TCP retransmits lost segments
+     * by itself */
+    .init_wnd = INIT_WND,
+    .min_wnd = 2U * CONFIG_GNRC_TCP_MSS,
+    .init_rtt = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS / 3U,
+    .max_msg_size = CONFIG_GNRC_TCP_MSS,
+    .pc_thresh = 3U,
+    .granularity = CONFIG_GNRC_TCP_RTO_GRANULARITY_MS,
+    .loss_reduction_numerator = 1U,
+    .loss_reduction_denominator = 2U,
+    .inter_msg_interval_numerator = 5U,
+    .inter_msg_interval_denominator = 4U,
+};
+
+void _gnrc_tcp_congure_setup(gnrc_tcp_tcb_t *tcb)
+{
+    congure_quic_snd_setup(&tcb->congure, &_tcp_congure_quic_consts);
+    tcb->congure.super.driver->init(&tcb->congure.super, tcb);
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       TCP Reno congestion control for GNRC TCP
+ *
+ * @author      agent <agent@local>
+ * @}
+ */
+
+#include "congure/reno.h"
+#include "net/gnrc/tcp/config.h"
+
+#include "include/gnrc_tcp_congure.h"
+
+static void _fr(congure_reno_snd_t *c);
+static bool _same_wnd_adv(congure_reno_snd_t *c, congure_snd_ack_t *ack);
+
+static const congure_reno_snd_consts_t _tcp_congure_reno_consts = {
+    .fr = _fr,
+    .same_wnd_adv = _same_wnd_adv,
+    .init_mss = CONFIG_GNRC_TCP_MSS,
+    /* initial window boundaries from RFC 5681, section 3.1 */
+    .cwnd_upper = 2190U,
+    .cwnd_lower = 1095U,
+    .init_ssthresh = CONGURE_WND_SIZE_MAX,
+    .frthresh = 3U,
+};
+
+void _gnrc_tcp_congure_setup(gnrc_tcp_tcb_t *tcb)
+{
+    uint16_t mss = CONFIG_GNRC_TCP_MSS;
+
+    if ((tcb->mss > 0) && (tcb->mss < mss)) {
+        mss = tcb->mss;
+    }
+    congure_reno_snd_setup(&tcb->congure, &_tcp_congure_reno_consts);
+    tcb->congure.super.driver->init(&tcb->congure.super, tcb);
+    congure_reno_set_mss(&tcb->congure, mss);
+}
+
+static void _fr(congure_reno_snd_t *c)
+{
+    (void)c;
+    /* GNRC TCP detects duplicate ACKs and retransmits by itself, so do
+     * nothing */
+}
+
+static bool _same_wnd_adv(congure_reno_snd_t *c, congure_snd_ack_t *ack)
+{
+    (void)c;
+    (void)ack;
+    /* duplicate ACKs are not reported to CongURE */
+    return true;
+}
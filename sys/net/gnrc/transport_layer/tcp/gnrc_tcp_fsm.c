@@ -25,6 +25,7 @@
 #include "evtimer.h"
 #include "evtimer_msg.h"
 #include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_congure.h"
 #include "include/gnrc_tcp_eventloop.h"
 #include "include/gnrc_tcp_pkt.h"
 #include "include/gnrc_tcp_option.h"
@@ -92,15 +93,199 @@ static uint16_t _get_random_local_port(void)
 static int _clear_retransmit(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
-    if (tcb->pkt_retransmit != NULL) {
+    if (tcb->rtx_len > 0) {
         _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
-        tcb->pkt_retransmit = NULL;
+        for (unsigned i = 0; i < tcb->rtx_len; i++) {
+            gnrc_pktbuf_release(tcb->rtx_queue[i]);
+        }
+        tcb->rtx_len = 0;
     }
+    tcb->rtx_resent = 0;
+    tcb->rtx_sacked = 0;
+    tcb->dup_acks = 0;
     TCP_DEBUG_LEAVE;
     return 0;
 }
 
+/**
+ * @brief Clears out-of-order queue.
+ *
+ * @param[in,out] tcb   TCB holding the out-of-order queue.
+ */
+static void _clear_ooo(gnrc_tcp_tcb_t *tcb)
+{
+#if CONFIG_GNRC_TCP_OOO_QUEUE_SIZE
+    for (unsigned i = 0; i < tcb->ooo_len; i++) {
+        gnrc_pktbuf_release(tcb->ooo_queue[i]);
+    }
+    tcb->ooo_len = 0;
+#else
+    (void)tcb;
+#endif
+}
+
+/**
+ * @brief Resends a packet from the retransmit queue without timer backoff.
+ *
+ * @param[in,out] tcb   TCB holding the retransmit queue.
+ * @param[in]     idx   Index of the packet in the retransmit queue.
+ *
+ * @returns   Payload length of the resent packet.
+ */
+static unsigned _resend(gnrc_tcp_tcb_t *tcb, unsigned idx)
+{
+    gnrc_pktsnip_t *pkt = tcb->rtx_queue[idx];
+
+    tcb->rtx_resent |= (1UL << idx);
+    gnrc_pktbuf_hold(pkt, 1);
+    _gnrc_tcp_pkt_send(tcb, pkt, 0, true);
+    return _gnrc_tcp_pkt_get_pay_len(pkt);
+}
+
+/**
+ * @brief Fast retransmit of lost packets after duplicate acknowledgments (see RFC 5681
+ *        and RFC 6675).
+ *
+ * Resends the oldest packet that was not selectively acknowledged, once the
+ * duplicate ACK threshold is reached, and any gap below selectively acknowledged data
+ * that was not resent yet.
+ *
+ * @param[in,out] tcb   TCB holding the retransmit queue.
+ */
+static void _fast_retransmit(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    unsigned lost = 0;
+    uint32_t sent = 0;
+    unsigned highest = 0;
+
+    /* Gaps are only known below the highest selectively acknowledged packet */
+    for (unsigned i = 0; i < tcb->rtx_len; i++) {
+        if (tcb->rtx_sacked & (1UL << i)) {
+            highest = i;
+        }
+    }
+
+    for (unsigned i = 0; i < tcb->rtx_len; i++) {
+        uint32_t mask = (1UL << i);
+
+        if (tcb->rtx_sacked & mask) {
+            continue;
+        }
+        if ((lost == 0 && tcb->dup_acks == DUP_ACK_THRESHOLD) ||
+            (i < highest && !(tcb->rtx_resent & mask))) {
+            sent = tcb->rtx_sent[i];
+            lost += _resend(tcb, i);
+        }
+        else if (i >= highest) {
+            break;
+        }
+    }
+
+    if (lost > 0) {
+        _gnrc_tcp_congure_report_lost(tcb, lost, sent, false, false);
+        _gnrc_tcp_congure_report_sent(tcb, lost);
+    }
+    TCP_DEBUG_LEAVE;
+}
+
+/**
+ * @brief Copies the payload of a packet into the receive buffer, skipping data that
+ *        was received before.
+ *
+ * @param[in,out] tcb       TCB holding the receive buffer.
+ * @param[in]     pkt       Packet holding the payload.
+ * @param[in]     seg_seq   Sequence number of @p pkt, must not be greater than
+ *                          tcb->rcv_nxt.
+ */
+static void _rcv_payload(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, uint32_t seg_seq)
+{
+    gnrc_pktsnip_t *snp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_UNDEF);
+    size_t skip = tcb->rcv_nxt - seg_seq;
+
+    while (snp && snp->type == GNRC_NETTYPE_UNDEF) {
+        if (skip < snp->size) {
+            size_t len = snp->size - skip;
+            size_t added = ringbuffer_add(&(tcb->rcv_buf), (char *)snp->data + skip, len);
+
+            tcb->rcv_nxt += added;
+            if (added < len) {
+                break;
+            }
+            skip = 0;
+        }
+        else {
+            skip -= snp->size;
+        }
+        snp = snp->next;
+    }
+}
+
+#if CONFIG_GNRC_TCP_OOO_QUEUE_SIZE
+/**
+ * @brief Moves packets from the out-of-order queue that are in sequence now into the
+ *        receive buffer.
+ *
+ * @param[in,out] tcb   TCB holding the out-of-order queue.
+ */
+static void _drain_ooo(gnrc_tcp_tcb_t *tcb)
+{
+    unsigned done = 0;
+
+    while (done < tcb->ooo_len) {
+        gnrc_pktsnip_t *pkt = tcb->ooo_queue[done];
+        uint32_t seq = _gnrc_tcp_pkt_get_seq_num(pkt);
+
+        if (LSS_32_BIT(tcb->rcv_nxt, seq)) {
+            break;
+        }
+        if (LSS_32_BIT(tcb->rcv_nxt, seq + _gnrc_tcp_pkt_get_pay_len(pkt))) {
+            _rcv_payload(tcb, pkt, seq);
+        }
+        gnrc_pktbuf_release(pkt);
+        done++;
+    }
+    tcb->ooo_len -= done;
+    memmove(&tcb->ooo_queue[0], &tcb->ooo_queue[done],
+            tcb->ooo_len * sizeof(tcb->ooo_queue[0]));
+}
+
+/**
+ * @brief Stores a packet received out of order.
+ *
+ * @param[in,out] tcb       TCB holding the out-of-order queue.
+ * @param[in]     pkt       Received packet.
+ * @param[in]     seg_seq   Sequence number of @p pkt.
+ */
+static void _store_ooo(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, uint32_t seg_seq)
+{
+    unsigned idx = 0;
+
+    /* Find insert position, drop duplicates */
+    while (idx < tcb->ooo_len) {
+        uint32_t seq = _gnrc_tcp_pkt_get_seq_num(tcb->ooo_queue[idx]);
+
+        if (seq == seg_seq) {
+            return;
+        }
+        if (LSS_32_BIT(seg_seq, seq)) {
+            break;
+        }
+        idx++;
+    }
+    if (tcb->ooo_len >= CONFIG_GNRC_TCP_OOO_QUEUE_SIZE) {
+        TCP_DEBUG_INFO("Out-of-order queue is full.");
+        return;
+    }
+    memmove(&tcb->ooo_queue[idx + 1], &tcb->ooo_queue[idx],
+            (tcb->ooo_len - idx) * sizeof(tcb->ooo_queue[0]));
+    tcb->ooo_queue[idx] = pkt;
+    tcb->ooo_len++;
+    tcb->ooo_last_seq = seg_seq;
+    gnrc_pktbuf_hold(pkt, 1);
+}
+#endif
+
 /**
  * @brief Restarts timewait timer.
  *
@@ -148,8 +333,9 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
 
     switch (state) {
         case FSM_STATE_CLOSED:
-            /* Clear retransmit queue */
+            /* Clear retransmit and out-of-order queue */
             _clear_retransmit(tcb);
+            _clear_ooo(tcb);
 
             /* Close connection if not listenng */
             if (!(tcb->status & STATUS_LISTENING))
@@ -175,7 +361,7 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
 
         case FSM_STATE_LISTEN:
             /* Clear Accepted Status */
-            tcb->status &= ~(STATUS_ACCEPTED);
+            tcb->status &= ~(STATUS_ACCEPTED | STATUS_SACK_PERMITTED);
 
             /* Clear address info */
 #ifdef MODULE_GNRC_IPV6
@@ -198,6 +384,8 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
             break;
 
         case FSM_STATE_SYN_SENT:
+            tcb->status &= ~(STATUS_SACK_PERMITTED);
+
             /* Add connection to active connections (if not already active) */
             mutex_lock(&list->lock);
             LL_SEARCH(list->head, iter, tcb, TCB_EQUAL);
@@ -232,6 +420,9 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
             break;
 
         case FSM_STATE_ESTABLISHED:
+            /* Peers MSS is known now */
+            _gnrc_tcp_congure_init(tcb);
+            /* Fall through */
         case FSM_STATE_CLOSE_WAIT:
             /* Stop timeout for listening TCBs */
             if (tcb->status & STATUS_LISTENING) {
@@ -317,27 +508,39 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
 static int _fsm_call_send(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
 {
     TCP_DEBUG_ENTER;
-    size_t payload = (tcb->snd_una + tcb->snd_wnd) - tcb->snd_nxt;
+    size_t sent = 0;
+
+    /* Send segments as long as the send and congestion window are open */
+    while (sent < len && tcb->rtx_len < CONFIG_GNRC_TCP_SND_QUEUE_SIZE) {
+        uint32_t wnd = _gnrc_tcp_congure_cwnd(tcb);
+        uint32_t flight = tcb->snd_nxt - tcb->snd_una;
+
+        wnd = (wnd < tcb->snd_wnd) ? wnd : tcb->snd_wnd;
+        if (flight >= wnd) {
+            break;
+        }
 
-    /* Check if window is open and all packets were transmitted */
-    if (payload > 0 && tcb->snd_wnd > 0 && tcb->pkt_retransmit == NULL) {
         /* Calculate segment size */
+        size_t payload = wnd - flight;
         payload = (payload < CONFIG_GNRC_TCP_MSS) ? payload : CONFIG_GNRC_TCP_MSS;
         payload = (payload < tcb->mss) ? payload : tcb->mss;
-        payload = (payload < len) ? payload : len;
+        payload = (payload < len - sent) ? payload : len - sent;
 
         /* Calculate payload size for this segment */
         gnrc_pktsnip_t *out_pkt = NULL;
         uint16_t seq_con = 0;
-        _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH,
-                            tcb->snd_nxt, tcb->rcv_nxt, buf, payload);
+        if (_gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH,
+                                tcb->snd_nxt, tcb->rcv_nxt, (uint8_t *)buf + sent,
+                                payload) < 0) {
+            break;
+        }
         _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt, false);
         _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
-        TCP_DEBUG_LEAVE;
-        return payload;
+        _gnrc_tcp_congure_report_sent(tcb, payload);
+        sent += payload;
     }
     TCP_DEBUG_LEAVE;
-    return 0;
+    return sent;
 }
 
 /**
@@ -713,7 +916,21 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 /* Acknowledge previously sent data */
                 if (LSS_32_BIT(tcb->snd_una, seg_ack) && LEQ_32_BIT(seg_ack, tcb->snd_nxt)) {
                     tcb->snd_una = seg_ack;
+                    tcb->dup_acks = 0;
                     _gnrc_tcp_pkt_acknowledge(tcb, seg_ack);
+
+                    /* Signal user, the retransmission queue has room again */
+                    tcb->status |= STATUS_NOTIFY_USER;
+                }
+                /* Count duplicate ACKs, trigger fast retransmit (see RFC 5681) */
+                else if (seg_ack == tcb->snd_una && pay_len == 0 && seg_wnd == tcb->snd_wnd &&
+                         !(ctl & (MSK_SYN | MSK_FIN)) && tcb->rtx_len > 0) {
+                    if (tcb->dup_acks < UINT8_MAX) {
+                        tcb->dup_acks += 1;
+                    }
+                    if (tcb->dup_acks >= DUP_ACK_THRESHOLD) {
+                        _fast_retransmit(tcb);
+                    }
                 }
                 /* ACK received for something not yet sent: Reply with pure ACK */
                 else if (LSS_32_BIT(tcb->snd_nxt, seg_ack)) {
@@ -738,25 +955,25 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 /* Additional processing */
                 /* Check additionally if previously sent FIN was acknowledged */
                 if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->rtx_len == 0) {
                         _transition_to(tcb, FSM_STATE_FIN_WAIT_2);
                     }
                 }
                 /* If retransmission queue is empty, acknowledge close operation */
                 if (tcb->state == FSM_STATE_FIN_WAIT_2) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->rtx_len == 0) {
                         /* Optional: Unblock user close operation */
                     }
                 }
                 /* If our FIN has been acknowledged: Transition to TIME_WAIT */
                 if (tcb->state == FSM_STATE_CLOSING) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->rtx_len == 0) {
                         _transition_to(tcb, FSM_STATE_TIME_WAIT);
                     }
                 }
                 /* If our FIN was acknowledged and status is LAST_ACK: close connection */
                 if (tcb->state == FSM_STATE_LAST_ACK) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->rtx_len == 0) {
                         _transition_to(tcb, FSM_STATE_CLOSED);
                         TCP_DEBUG_LEAVE;
                         return 0;
@@ -772,24 +989,27 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
             /* Check if state is valid for payload receiving */
             if (tcb->state == FSM_STATE_ESTABLISHED || tcb->state == FSM_STATE_FIN_WAIT_1 ||
                 tcb->state == FSM_STATE_FIN_WAIT_2) {
-                /* Search for begin of payload */
-                snp = gnrc_pktsnip_search_type(in_pkt, GNRC_NETTYPE_UNDEF);
-
-                /* Accept only data that is expected, to be received */
-                if (tcb->rcv_nxt == seg_seq) {
+                /* Accept data that is expected, skip data received before */
+                if (LEQ_32_BIT(seg_seq, tcb->rcv_nxt)) {
                     /* Copy contents into receive buffer */
-                    while (snp && snp->type == GNRC_NETTYPE_UNDEF) {
-                        tcb->rcv_nxt += ringbuffer_add(&(tcb->rcv_buf), snp->data, snp->size);
-                        snp = snp->next;
-                    }
+                    _rcv_payload(tcb, in_pkt, seg_seq);
+#if CONFIG_GNRC_TCP_OOO_QUEUE_SIZE
+                    _drain_ooo(tcb);
+#endif
                     /* Shrink receive window */
                     tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
                     /* Notify owner because new data is available */
                     tcb->status |= STATUS_NOTIFY_USER;
                 }
+#if CONFIG_GNRC_TCP_OOO_QUEUE_SIZE
+                /* Keep data received out of order, SACK it if permitted */
+                else if (!(ctl & MSK_FIN)) {
+                    _store_ooo(tcb, in_pkt, seg_seq);
+                }
+#endif
                 /* Send ACK, if FIN processing sends ACK already */
                 /* NOTE: this is the place to add payload piggybagging in the future */
-                if (!(ctl & MSK_FIN)) {
+                if (!(ctl & MSK_FIN) || seg_seq + pay_len != tcb->rcv_nxt) {
                     _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK,
                                         tcb->snd_nxt, tcb->rcv_nxt, NULL, 0);
                     _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
@@ -803,6 +1023,11 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 TCP_DEBUG_LEAVE;
                 return 0;
             }
+            /* Process FIN only after all data in front of it was received */
+            if (seg_seq + pay_len != tcb->rcv_nxt) {
+                TCP_DEBUG_LEAVE;
+                return 0;
+            }
             /* Advance rcv_nxt over FIN bit */
             tcb->rcv_nxt = seg_seq + seg_len;
             _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt,
@@ -813,7 +1038,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 _transition_to(tcb, FSM_STATE_CLOSE_WAIT);
             }
             else if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                if (tcb->pkt_retransmit == NULL) {
+                if (tcb->rtx_len == 0) {
                     _transition_to(tcb, FSM_STATE_TIME_WAIT);
                 }
                 else {
@@ -857,9 +1082,18 @@ static int _fsm_timeout_timewait(gnrc_tcp_tcb_t *tcb)
 static int _fsm_timeout_retransmit(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
-    if (tcb->pkt_retransmit != NULL) {
-        _gnrc_tcp_pkt_setup_retransmit(tcb, tcb->pkt_retransmit, true);
-        _gnrc_tcp_pkt_send(tcb, tcb->pkt_retransmit, 0, true);
+    if (tcb->rtx_len > 0) {
+        gnrc_pktsnip_t *pkt = tcb->rtx_queue[0];
+        unsigned len = _gnrc_tcp_pkt_get_pay_len(pkt);
+
+        /* The receiver may discard selectively acknowledged data (see RFC 2018) */
+        tcb->rtx_sacked = 0;
+        tcb->dup_acks = 0;
+        _gnrc_tcp_congure_report_lost(tcb, len, tcb->rtx_sent[0],
+                                      tcb->rtx_resent & 1, true);
+        _gnrc_tcp_pkt_setup_retransmit(tcb, pkt, true);
+        _gnrc_tcp_pkt_send(tcb, pkt, 0, true);
+        _gnrc_tcp_congure_report_sent(tcb, len);
     }
     else {
         TCP_DEBUG_INFO("Retransmission queue is empty.");
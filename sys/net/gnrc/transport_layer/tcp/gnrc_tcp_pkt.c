@@ -25,6 +25,7 @@
 #include "net/inet_csum.h"
 #include "net/gnrc.h"
 #include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_congure.h"
 #include "include/gnrc_tcp_eventloop.h"
 #include "include/gnrc_tcp_option.h"
 #include "include/gnrc_tcp_pkt.h"
@@ -49,6 +50,115 @@ static inline uint32_t _max(const uint32_t x, const uint32_t y)
   return (x > y) ? x : y;
 }
 
+/**
+ * @brief Calculates the retransmission timeout from the current RTT estimation.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _calc_rto(gnrc_tcp_tcb_t *tcb)
+{
+    /* Without RTT measurement: rto is 1 sec (Lower Bound) */
+    if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
+    }
+    else {
+        tcb->rto = tcb->srtt + _max(CONFIG_GNRC_TCP_RTO_GRANULARITY_MS,
+                                    CONFIG_GNRC_TCP_RTO_K * tcb->rtt_var);
+    }
+}
+
+/**
+ * @brief (Re-)starts the retransmission timer with the current RTO.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _sched_retransmit(gnrc_tcp_tcb_t *tcb)
+{
+    /* Perform boundary checks on current RTO before usage */
+    if (tcb->rto < (int32_t) CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
+    }
+    else if (tcb->rto > (int32_t) CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS;
+    }
+
+    /* Setup retransmission timer, msg to TCP thread with ptr to TCB */
+    _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
+    _gnrc_tcp_eventloop_sched(&tcb->event_retransmit, tcb->rto,
+                              MSG_TYPE_RETRANSMISSION, tcb);
+}
+
+/**
+ * @brief Updates the RTT estimation with a new sample (see RFC 6298).
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ * @param[in]     rtt   Measured round trip time in milliseconds.
+ */
+static void _update_rtt(gnrc_tcp_tcb_t *tcb, int32_t rtt)
+{
+    /* If this is the first sample taken */
+    if (tcb->srtt == RTO_UNINITIALIZED && tcb->rtt_var == RTO_UNINITIALIZED) {
+        tcb->srtt = rtt;
+        tcb->rtt_var = (rtt >> 1);
+    }
+    /* If this is a subsequent sample */
+    else {
+        tcb->rtt_var = (tcb->rtt_var / CONFIG_GNRC_TCP_RTO_B_DIV) * (CONFIG_GNRC_TCP_RTO_B_DIV-1);
+        tcb->rtt_var += labs(tcb->srtt - rtt) / CONFIG_GNRC_TCP_RTO_B_DIV;
+        tcb->srtt = (tcb->srtt / CONFIG_GNRC_TCP_RTO_A_DIV) * (CONFIG_GNRC_TCP_RTO_A_DIV-1);
+        tcb->srtt += rtt / CONFIG_GNRC_TCP_RTO_A_DIV;
+    }
+}
+
+#if CONFIG_GNRC_TCP_OOO_QUEUE_SIZE
+/**
+ * @brief Collects the SACK blocks describing the out-of-order queue.
+ *
+ * The first block holds the latest segment received (see RFC 2018, section 4).
+ *
+ * @param[in]  tcb      TCB holding the connection information.
+ * @param[out] blocks   Left and right edges of the blocks.
+ *
+ * @returns   Number of blocks, at most SACK_BLOCKS_MAX.
+ */
+static unsigned _sack_blocks(const gnrc_tcp_tcb_t *tcb, uint32_t *blocks)
+{
+    unsigned num = 0;
+    unsigned latest = 0;
+
+    for (unsigned i = 0; i < tcb->ooo_len; i++) {
+        uint32_t left = _gnrc_tcp_pkt_get_seq_num(tcb->ooo_queue[i]);
+        uint32_t right = left + _gnrc_tcp_pkt_get_pay_len(tcb->ooo_queue[i]);
+
+        /* Merge with the previous block if contiguous */
+        if (num > 0 && LEQ_32_BIT(left, blocks[2 * num - 1])) {
+            if (LSS_32_BIT(blocks[2 * num - 1], right)) {
+                blocks[2 * num - 1] = right;
+            }
+        }
+        else {
+            blocks[2 * num] = left;
+            blocks[2 * num + 1] = right;
+            num++;
+        }
+        if (left == tcb->ooo_last_seq) {
+            latest = num - 1;
+        }
+    }
+
+    /* Move block holding the latest segment to the front */
+    if (latest > 0) {
+        uint32_t left = blocks[2 * latest];
+        uint32_t right = blocks[2 * latest + 1];
+
+        memmove(&blocks[2], &blocks[0], 2 * latest * sizeof(blocks[0]));
+        blocks[0] = left;
+        blocks[1] = right;
+    }
+    return (num < SACK_BLOCKS_MAX) ? num : SACK_BLOCKS_MAX;
+}
+#endif
+
 int _gnrc_tcp_pkt_build_reset_from_pkt(gnrc_pktsnip_t **out_pkt,
                                        gnrc_pktsnip_t *in_pkt)
 {
@@ -180,7 +290,22 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
     /* Add MSS option if SYN is sent */
     if (ctl & MSK_SYN) {
         offset += 1;
+        /* Add SACK permitted option if SACK is enabled */
+        if (IS_ACTIVE(CONFIG_GNRC_TCP_SACK_EN)) {
+            offset += 1;
+        }
+    }
+#if CONFIG_GNRC_TCP_OOO_QUEUE_SIZE
+    /* Add SACK option to pure ACKs if data was received out of order */
+    uint32_t sack_blocks[2 * CONFIG_GNRC_TCP_OOO_QUEUE_SIZE];
+    unsigned sack_num = 0;
+    if (ctl == MSK_ACK && payload_len == 0 && (tcb->status & STATUS_SACK_PERMITTED)) {
+        sack_num = _sack_blocks(tcb, sack_blocks);
+        if (sack_num) {
+            offset += 1 + (sack_num * TCP_OPTION_LENGTH_SACK_BLOCK) / 4;
+        }
     }
+#endif
     /* Set offset and control bit accordingly */
     tcp_hdr.off_ctl = byteorder_htons(
         _gnrc_tcp_option_build_offset_control(offset, ctl));
@@ -217,8 +342,32 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
                     _gnrc_tcp_option_build_mss(CONFIG_GNRC_TCP_MSS));
 
                 memcpy(opt_ptr, &mss_option, sizeof(mss_option));
+                opt_ptr += sizeof(mss_option);
+
+                /* Add SACK permitted option, padded to 32 bit with NOPs */
+                if (IS_ACTIVE(CONFIG_GNRC_TCP_SACK_EN)) {
+                    network_uint32_t sack_perm_option = byteorder_htonl(
+                        _gnrc_tcp_option_build_sack_perm());
+
+                    memcpy(opt_ptr, &sack_perm_option, sizeof(sack_perm_option));
+                    opt_ptr += sizeof(sack_perm_option);
+                }
             }
-            /* Increase opt_ptr and decrease opt_left, if other options are added */
+#if CONFIG_GNRC_TCP_OOO_QUEUE_SIZE
+            /* Add SACK option, padded to 32 bit with NOPs */
+            if (sack_num) {
+                *(opt_ptr++) = TCP_OPTION_KIND_NOP;
+                *(opt_ptr++) = TCP_OPTION_KIND_NOP;
+                *(opt_ptr++) = TCP_OPTION_KIND_SACK;
+                *(opt_ptr++) = TCP_OPTION_LENGTH_MIN + sack_num * TCP_OPTION_LENGTH_SACK_BLOCK;
+                for (unsigned i = 0; i < 2 * sack_num; i++) {
+                    network_uint32_t edge = byteorder_htonl(sack_blocks[i]);
+
+                    memcpy(opt_ptr, &edge, sizeof(edge));
+                    opt_ptr += sizeof(edge);
+                }
+            }
+#endif
             /* NOTE: Add additional options here */
         }
         *(out_pkt) = tcp_snp;
@@ -285,14 +434,9 @@ int _gnrc_tcp_pkt_send(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *out_pkt,
         return -EINVAL;
     }
 
-    /* If this is no retransmission, advance sequence number and measure time */
+    /* If this is no retransmission, advance sequence number */
     if (!retransmit) {
-        tcb->retries = 0;
         tcb->snd_nxt += seq_con;
-        tcb->rtt_start = evtimer_now_msec();
-    }
-    else {
-        tcb->retries += 1;
     }
 
     /* Pass packet down the network stack */
@@ -376,6 +520,16 @@ uint32_t _gnrc_tcp_pkt_get_pay_len(gnrc_pktsnip_t *pkt)
     return seg_len;
 }
 
+uint32_t _gnrc_tcp_pkt_get_seq_num(gnrc_pktsnip_t *pkt)
+{
+    TCP_DEBUG_ENTER;
+    gnrc_pktsnip_t *snp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_TCP);
+    assert(snp != NULL);
+    uint32_t seq = byteorder_ntohl(((tcp_hdr_t *) snp->data)->seq_num);
+    TCP_DEBUG_LEAVE;
+    return seq;
+}
+
 int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
                                    const bool retransmit)
 {
@@ -391,13 +545,6 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
         return -EINVAL;
     }
 
-    /* Check if retransmit queue is full and pkt is not already in retransmit queue */
-    if (tcb->pkt_retransmit != NULL && tcb->pkt_retransmit != pkt) {
-        TCP_DEBUG_ERROR("-ENOMEM: Retransmit queue is full.");
-        TCP_DEBUG_LEAVE;
-        return -ENOMEM;
-    }
-
     /* Extract control bits and segment length */
     snp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_TCP);
     if (snp == NULL) {
@@ -415,22 +562,44 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
         return 0;
     }
 
-    /* Assign pkt and increase users: every send attempt consumes a user */
-    tcb->pkt_retransmit = pkt;
-    gnrc_pktbuf_hold(pkt, 1);
-
-    /* RTO adjustment */
+    /* Increase users: every send attempt consumes a user */
     if (!retransmit) {
-        /* If this is the first transmission: rto is 1 sec (Lower Bound) */
-        if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
-            tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
+        /* Data segments leave one slot for a SYN or FIN */
+        unsigned limit = (ctl & (MSK_SYN | MSK_FIN)) ? GNRC_TCP_RTX_QUEUE_LEN
+                                                     : CONFIG_GNRC_TCP_SND_QUEUE_SIZE;
+        if (tcb->rtx_len >= limit) {
+            TCP_DEBUG_ERROR("-ENOMEM: Retransmit queue is full.");
+            TCP_DEBUG_LEAVE;
+            return -ENOMEM;
         }
-        else {
-            tcb->rto = tcb->srtt + _max(CONFIG_GNRC_TCP_RTO_GRANULARITY_MS,
-                                        CONFIG_GNRC_TCP_RTO_K * tcb->rtt_var);
+
+        /* Append pkt to retransmit queue */
+        tcb->rtx_queue[tcb->rtx_len] = pkt;
+        tcb->rtx_sent[tcb->rtx_len] = evtimer_now_msec();
+        tcb->rtx_len++;
+        gnrc_pktbuf_hold(pkt, 1);
+
+        /* Timer is already running for the oldest segment */
+        if (tcb->rtx_len > 1) {
+            TCP_DEBUG_LEAVE;
+            return 0;
         }
+        _calc_rto(tcb);
     }
     else {
+        unsigned idx = 0;
+        while (idx < tcb->rtx_len && tcb->rtx_queue[idx] != pkt) {
+            idx++;
+        }
+        if (idx == tcb->rtx_len) {
+            TCP_DEBUG_ERROR("-EINVAL: pkt is not in retransmit queue.");
+            TCP_DEBUG_LEAVE;
+            return -EINVAL;
+        }
+        tcb->rtx_resent |= (1UL << idx);
+        tcb->retries += 1;
+        gnrc_pktbuf_hold(pkt, 1);
+
         /* If this is a retransmission: Double the rto (Timer Backoff) */
         tcb->rto *= 2;
 
@@ -442,17 +611,7 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
         }
     }
 
-    /* Perform boundary checks on current RTO before usage */
-    if (tcb->rto < (int32_t) CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS) {
-        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
-    }
-    else if (tcb->rto > (int32_t) CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS) {
-        tcb->rto = CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS;
-    }
-
-    /* Setup retransmission timer, msg to TCP thread with ptr to TCB */
-    _gnrc_tcp_eventloop_sched(&tcb->event_retransmit, tcb->rto,
-                              MSG_TYPE_RETRANSMISSION, tcb);
+    _sched_retransmit(tcb);
     TCP_DEBUG_LEAVE;
     return 0;
 }
@@ -460,59 +619,78 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
 int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
 {
     TCP_DEBUG_ENTER;
-    uint32_t seg = 0;
-    gnrc_pktsnip_t *snp = NULL;
-    tcp_hdr_t *hdr;
+    unsigned acked = 0;
+    unsigned acked_bytes = 0;
 
     /* Retransmission queue is empty. Nothing to ACK there */
-    if (tcb->pkt_retransmit == NULL) {
+    if (tcb->rtx_len == 0) {
         TCP_DEBUG_ERROR("-ENODATA: No packet to acknowledge.");
         TCP_DEBUG_LEAVE;
         return -ENODATA;
     }
 
-    snp = gnrc_pktsnip_search_type(tcb->pkt_retransmit, GNRC_NETTYPE_TCP);
-    if (snp == NULL) {
-        TCP_DEBUG_ERROR("-EINVAL: snp == NULL.");
-        TCP_DEBUG_LEAVE;
-        return -EINVAL;
+    /* Count segments that are acknowledged completely */
+    while (acked < tcb->rtx_len) {
+        gnrc_pktsnip_t *pkt = tcb->rtx_queue[acked];
+        uint32_t seg = _gnrc_tcp_pkt_get_seq_num(pkt) + _gnrc_tcp_pkt_get_seg_len(pkt) - 1;
+
+        if (!LSS_32_BIT(seg, ack)) {
+            break;
+        }
+        acked_bytes += _gnrc_tcp_pkt_get_pay_len(pkt);
+        gnrc_pktbuf_release(pkt);
+        acked++;
     }
 
-    hdr = (tcp_hdr_t *) snp->data;
+    /* If segments were acknowledged -> remove them, update rto and restart timer. */
+    if (acked > 0) {
+        uint32_t sent = tcb->rtx_sent[acked - 1];
 
-    /* There must be a packet, waiting to be acknowledged. */
-    seg = byteorder_ntohl(hdr->seq_num) + _gnrc_tcp_pkt_get_seg_len(
-        tcb->pkt_retransmit) - 1;
+        /* Measure round trip time. Use time only if there was no timer overflow and
+         * the latest acknowledged segment was not retransmitted (Karns Algorithm) */
+        int32_t rtt = evtimer_now_msec() - sent;
+        if (!(tcb->rtx_resent & (1UL << (acked - 1))) && rtt > 0) {
+            _update_rtt(tcb, rtt);
+        }
+
+        tcb->rtx_len -= acked;
+        memmove(&tcb->rtx_queue[0], &tcb->rtx_queue[acked],
+                tcb->rtx_len * sizeof(tcb->rtx_queue[0]));
+        memmove(&tcb->rtx_sent[0], &tcb->rtx_sent[acked],
+                tcb->rtx_len * sizeof(tcb->rtx_sent[0]));
+        tcb->rtx_resent >>= acked;
+        tcb->rtx_sacked >>= acked;
+        tcb->retries = 0;
+
+        if (acked_bytes > 0) {
+            _gnrc_tcp_congure_report_acked(tcb, ack, acked_bytes, sent);
+        }
 
-        /* If segment can be acknowledged -> stop timer, release packet from pktbuf and update rto. */
-    if (LSS_32_BIT(seg, ack)) {
         _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
-        tcb->pkt_retransmit = NULL;
-
-        /* Measure round trip time */
-        int32_t rtt = evtimer_now_msec() - tcb->rtt_start;
-
-        /* Use time only if there was no timer overflow and no retransmission (Karns Algorithm) */
-        if (tcb->retries == 0 && rtt > 0) {
-            /* If this is the first sample taken */
-            if (tcb->srtt == RTO_UNINITIALIZED && tcb->rtt_var == RTO_UNINITIALIZED) {
-                tcb->srtt = rtt;
-                tcb->rtt_var = (rtt >> 1);
-            }
-            /* If this is a subsequent sample */
-            else {
-                tcb->rtt_var = (tcb->rtt_var / CONFIG_GNRC_TCP_RTO_B_DIV) * (CONFIG_GNRC_TCP_RTO_B_DIV-1);
-                tcb->rtt_var += labs(tcb->srtt - rtt) / CONFIG_GNRC_TCP_RTO_B_DIV;
-                tcb->srtt = (tcb->srtt / CONFIG_GNRC_TCP_RTO_A_DIV) * (CONFIG_GNRC_TCP_RTO_A_DIV-1);
-                tcb->srtt += rtt / CONFIG_GNRC_TCP_RTO_A_DIV;
-            }
+        if (tcb->rtx_len > 0) {
+            _calc_rto(tcb);
+            _sched_retransmit(tcb);
         }
     }
     TCP_DEBUG_LEAVE;
     return 0;
 }
 
+void _gnrc_tcp_pkt_sack(gnrc_tcp_tcb_t *tcb, const uint32_t left, const uint32_t right)
+{
+    TCP_DEBUG_ENTER;
+    for (unsigned i = 0; i < tcb->rtx_len; i++) {
+        gnrc_pktsnip_t *pkt = tcb->rtx_queue[i];
+        uint32_t seq = _gnrc_tcp_pkt_get_seq_num(pkt);
+
+        if (LEQ_32_BIT(left, seq) &&
+            LEQ_32_BIT(seq + _gnrc_tcp_pkt_get_seg_len(pkt), right)) {
+            tcb->rtx_sacked |= (1UL << i);
+        }
+    }
+    TCP_DEBUG_LEAVE;
+}
+
 uint16_t _gnrc_tcp_pkt_calc_csum(const gnrc_pktsnip_t *hdr,
                                  const gnrc_pktsnip_t *pseudo_hdr,
                                  const gnrc_pktsnip_t *payload)
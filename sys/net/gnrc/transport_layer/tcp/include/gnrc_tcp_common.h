@@ -47,6 +47,7 @@ extern "C" {
 #define STATUS_NOTIFY_USER    (1 << 2) /**< Internal: Status bitmask NOTIFY_USER */
 #define STATUS_ACCEPTED       (1 << 3) /**< Internal: Status bitmask ACCEPTED */
 #define STATUS_LOCKED         (1 << 4) /**< Internal: Status bitmask LOCKED */
+#define STATUS_SACK_PERMITTED (1 << 5) /**< Internal: Status bitmask SACK_PERMITTED */
 /** @} */
 
 /**
@@ -88,6 +89,16 @@ extern "C" {
 #define MSG_TYPE_NOTIFY_USER        (GNRC_NETAPI_MSG_TYPE_ACK + 106) /**< Internal: message id */
 /** @} */
 
+/**
+ * @brief Number of duplicate ACKs that trigger a fast retransmit (see RFC 5681).
+ */
+#define DUP_ACK_THRESHOLD (3U)
+
+/**
+ * @brief Maximum number of blocks in an outgoing SACK option.
+ */
+#define SACK_BLOCKS_MAX (4U)
+
 /**
  * @brief Define for marking that time measurement is uninitialized.
  */
@@ -101,7 +112,7 @@ extern "C" {
 #define LSS_32_BIT(x, y) (((int32_t) (x)) - ((int32_t) (y)) <  0) /**< Internal: operator < */
 #define LEQ_32_BIT(x, y) (((int32_t) (x)) - ((int32_t) (y)) <= 0) /**< Internal: operator <= */
 #define GRT_32_BIT(x, y) (!LEQ_32_BIT(x, y)) /**< Internal: operator > */
-#define GEQ_32_BIT(x, y) (!LSS_32_BOT(x, y)) /**< Internal: operator >= */
+#define GEQ_32_BIT(x, y) (!LSS_32_BIT(x, y)) /**< Internal: operator >= */
 /** @} */
 
 /**
@@ -0,0 +1,180 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc_tcp
+ *
+ * @{
+ *
+ * @file
+ * @brief       Glue between GNRC TCP and the congestion control of
+ *              @ref net_gnrc_tcp_congure
+ *
+ * All functions are no-ops if @ref net_gnrc_tcp_congure is not used. Sizes
+ * are given in bytes.
+ *
+ * @author      agent <agent@local>
+ */
+
+#ifndef GNRC_TCP_CONGURE_H
+#define GNRC_TCP_CONGURE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "modules.h"
+#include "net/gnrc/tcp/tcb.h"
+#include "ztimer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Sets up the congestion control state of a TCB.
+ *
+ * Implemented by the selected sub-module of @ref net_gnrc_tcp_congure.
+ *
+ * @param[in,out] tcb   TCB to set up, the peers MSS must be known.
+ */
+void _gnrc_tcp_congure_setup(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Initializes congestion control of a connection.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static inline void _gnrc_tcp_congure_init(gnrc_tcp_tcb_t *tcb)
+{
+#if IS_USED(MODULE_GNRC_TCP_CONGURE)
+    _gnrc_tcp_congure_setup(tcb);
+#else
+    (void)tcb;
+#endif
+}
+
+/**
+ * @brief Returns the congestion window of a connection.
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @returns   Congestion window in bytes, UINT32_MAX without congestion control.
+ */
+static inline uint32_t _gnrc_tcp_congure_cwnd(const gnrc_tcp_tcb_t *tcb)
+{
+#if IS_USED(MODULE_GNRC_TCP_CONGURE)
+    return tcb->congure.super.cwnd;
+#else
+    (void)tcb;
+    return UINT32_MAX;
+#endif
+}
+
+/**
+ * @brief Reports data sent (or resent) to congestion control.
+ *
+ * @param[in,out] tcb    TCB holding the connection information.
+ * @param[in]     size   Number of bytes sent.
+ */
+static inline void _gnrc_tcp_congure_report_sent(gnrc_tcp_tcb_t *tcb,
+                                                 unsigned size)
+{
+#if IS_USED(MODULE_GNRC_TCP_CONGURE)
+    congure_snd_t *c = &tcb->congure.super;
+
+    c->driver->report_msg_sent(c, size);
+#else
+    (void)tcb;
+    (void)size;
+#endif
+}
+
+/**
+ * @brief Reports newly acknowledged data to congestion control.
+ *
+ * @param[in,out] tcb         TCB holding the connection information.
+ * @param[in]     ack         Acknowledgment number of the ACK.
+ * @param[in]     size        Number of bytes acknowledged.
+ * @param[in]     send_time   Send time of the latest acknowledged segment.
+ */
+static inline void _gnrc_tcp_congure_report_acked(gnrc_tcp_tcb_t *tcb,
+                                                  uint32_t ack, unsigned size,
+                                                  uint32_t send_time)
+{
+#if IS_USED(MODULE_GNRC_TCP_CONGURE)
+    congure_snd_t *c = &tcb->congure.super;
+    congure_snd_msg_t msg = {
+        .send_time = send_time,
+        .size = size,
+    };
+    congure_snd_ack_t ack_info = {
+        .recv_time = ztimer_now(ZTIMER_MSEC),
+        .id = ack,
+        .wnd = tcb->snd_wnd,
+        .clean = true,
+    };
+    congure_wnd_size_t cwnd = c->cwnd;
+
+    c->driver->report_msg_acked(c, &msg, &ack_info);
+    /* the window only grows on new ACKs, cap it instead of wrapping around */
+    if (c->cwnd < cwnd) {
+        c->cwnd = CONGURE_WND_SIZE_MAX;
+    }
+#else
+    (void)tcb;
+    (void)ack;
+    (void)size;
+    (void)send_time;
+#endif
+}
+
+/**
+ * @brief Reports lost data to congestion control.
+ *
+ * @param[in,out] tcb         TCB holding the connection information.
+ * @param[in]     size        Number of bytes lost.
+ * @param[in]     send_time   Send time of the latest lost segment.
+ * @param[in]     resent      True, if lost data was already retransmitted.
+ * @param[in]     timeout     True, if the loss was detected by a timeout.
+ */
+static inline void _gnrc_tcp_congure_report_lost(gnrc_tcp_tcb_t *tcb,
+                                                 unsigned size,
+                                                 uint32_t send_time,
+                                                 bool resent, bool timeout)
+{
+#if IS_USED(MODULE_GNRC_TCP_CONGURE)
+    congure_snd_t *c = &tcb->congure.super;
+    congure_snd_msg_t lost = {
+        .send_time = send_time,
+        .size = size,
+        .resends = resent,
+    };
+    congure_snd_msg_t msgs = { .super.next = &lost.super };
+
+    lost.super.next = &lost.super;
+    if (timeout) {
+        c->driver->report_msgs_timeout(c, &msgs);
+    }
+    else {
+        c->driver->report_msgs_lost(c, &msgs);
+    }
+#else
+    (void)tcb;
+    (void)size;
+    (void)send_time;
+    (void)resent;
+    (void)timeout;
+#endif
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GNRC_TCP_CONGURE_H */
+/** @} */
@@ -108,6 +108,15 @@ uint32_t _gnrc_tcp_pkt_get_seg_len(gnrc_pktsnip_t *pkt);
  */
 uint32_t _gnrc_tcp_pkt_get_pay_len(gnrc_pktsnip_t *pkt);
 
+/**
+ * @brief Extracts a packets sequence number.
+ *
+ * @param[in] pkt   Packet to extract the sequence number from.
+ *
+ * @returns   The packets sequence number.
+ */
+uint32_t _gnrc_tcp_pkt_get_seq_num(gnrc_pktsnip_t *pkt);
+
 /**
  * @brief Adds a packet to the retransmission mechanism.
  *
@@ -133,6 +142,15 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
  */
 int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack);
 
+/**
+ * @brief Marks packets in the retransmission queue as selectively acknowledged.
+ *
+ * @param[in,out] tcb     TCB holding the connection information.
+ * @param[in]     left    Left edge of the SACK block.
+ * @param[in]     right   Right edge of the SACK block.
+ */
+void _gnrc_tcp_pkt_sack(gnrc_tcp_tcb_t *tcb, const uint32_t left, const uint32_t right);
+
 /**
  * @brief Calculates checksum over payload, TCP header and network layer header.
  *
@@ -67,6 +67,51 @@ static bool _has_retrans_left(ieee802154_submac_t *submac)
     return submac->retrans < CONFIG_IEEE802154_DEFAULT_MAX_FRAME_RETRANS;
 }
 
+static void _tx_init(ieee802154_submac_t *submac, const uint8_t *psdu)
+{
+    submac->wait_for_ack = psdu[0] & IEEE802154_FCF_ACK_REQ;
+    submac->retrans = 0;
+    submac->csma_retries_nb = 0;
+    submac->backoff_mask = (1 << submac->be.min) - 1;
+}
+
+#if CONFIG_IEEE802154_SUBMAC_TX_QUEUE_SIZE
+static int _tx_queue_put(ieee802154_submac_t *submac, const iolist_t *iolist)
+{
+    ieee802154_submac_tx_frame_t *frame;
+    size_t len = iolist_size(iolist);
+
+    if ((len == 0) || (len > sizeof(frame->psdu)) ||
+        (submac->tx_queue_len == CONFIG_IEEE802154_SUBMAC_TX_QUEUE_SIZE)) {
+        return -EBUSY;
+    }
+    frame = &submac->tx_queue[(submac->tx_queue_head + submac->tx_queue_len) %
+                              CONFIG_IEEE802154_SUBMAC_TX_QUEUE_SIZE];
+    frame->len = iolist_to_buffer(iolist, frame->psdu, sizeof(frame->psdu));
+    submac->tx_queue_len++;
+    return 0;
+}
+
+static ieee802154_fsm_state_t _tx_queue_next(ieee802154_submac_t *submac)
+{
+    ieee802154_submac_tx_frame_t *frame = &submac->tx_queue[submac->tx_queue_head];
+    iolist_t psdu = { .iol_base = frame->psdu, .iol_len = frame->len };
+
+    _tx_init(submac, frame->psdu);
+    submac->psdu = NULL;
+    /* the radio is still in TX_ON after the previous transmission */
+    ieee802154_radio_write(&submac->dev, &psdu);
+    submac->tx_queue_head = (submac->tx_queue_head + 1) %
+                            CONFIG_IEEE802154_SUBMAC_TX_QUEUE_SIZE;
+    submac->tx_queue_len--;
+#if IS_USED(MODULE_IEEE802154_SUBMAC_STATS)
+    submac->stats.tx_queued++;
+#endif
+    ieee802154_submac_bh_request(submac);
+    return IEEE802154_FSM_STATE_PREPARE;
+}
+#endif
+
 static ieee802154_fsm_state_t _tx_end(ieee802154_submac_t *submac, int status,
                                       ieee802154_tx_info_t *info)
 {
@@ -81,6 +126,13 @@ static ieee802154_fsm_state_t _tx_end(ieee802154_submac_t *submac, int status,
 
     assert(res >= 0);
     submac->cb->tx_done(submac, status, info);
+#if CONFIG_IEEE802154_SUBMAC_TX_QUEUE_SIZE
+    /* send the next queued frame right away, this may have been queued
+     * during the TX done callback */
+    if (submac->tx_queue_len > 0) {
+        return _tx_queue_next(submac);
+    }
+#endif
     return IEEE802154_FSM_STATE_IDLE;
 }
 
@@ -399,6 +451,14 @@ ieee802154_fsm_state_t ieee802154_submac_process_ev(ieee802154_submac_t *submac,
         _print_debug(submac->fsm_state, new_state, ev);
         assert(false);
     }
+#if IS_USED(MODULE_IEEE802154_SUBMAC_STATS)
+    if (new_state != submac->fsm_state) {
+        uint32_t now = ztimer_now(ZTIMER_USEC);
+
+        submac->stats.state_time[submac->fsm_state] += now - submac->stats.state_since;
+        submac->stats.state_since = now;
+    }
+#endif
     submac->fsm_state = new_state;
     return submac->fsm_state;
 }
@@ -408,21 +468,19 @@ int ieee802154_send(ieee802154_submac_t *submac, const iolist_t *iolist)
     ieee802154_fsm_state_t current_state = submac->fsm_state;
 
     if (current_state != IEEE802154_FSM_STATE_RX && current_state != IEEE802154_FSM_STATE_IDLE) {
+#if CONFIG_IEEE802154_SUBMAC_TX_QUEUE_SIZE
+        return _tx_queue_put(submac, iolist);
+#else
         return -EBUSY;
+#endif
     }
 
     if (iolist == NULL) {
         return 0;
     }
 
-    uint8_t *buf = iolist->iol_base;
-    bool cnf = buf[0] & IEEE802154_FCF_ACK_REQ;
-
-    submac->wait_for_ack = cnf;
+    _tx_init(submac, iolist->iol_base);
     submac->psdu = iolist;
-    submac->retrans = 0;
-    submac->csma_retries_nb = 0;
-    submac->backoff_mask = (1 << submac->be.min) - 1;
 
     if (ieee802154_submac_process_ev(submac, IEEE802154_FSM_EV_REQUEST_TX)
         != IEEE802154_FSM_STATE_PREPARE) {
@@ -437,6 +495,14 @@ int ieee802154_submac_init(ieee802154_submac_t *submac, const network_uint16_t *
     ieee802154_dev_t *dev = &submac->dev;
 
     submac->fsm_state = IEEE802154_FSM_STATE_RX;
+#if CONFIG_IEEE802154_SUBMAC_TX_QUEUE_SIZE
+    submac->tx_queue_head = 0;
+    submac->tx_queue_len = 0;
+#endif
+#if IS_USED(MODULE_IEEE802154_SUBMAC_STATS)
+    memset(&submac->stats, 0, sizeof(submac->stats));
+    submac->stats.state_since = ztimer_now(ZTIMER_USEC);
+#endif
 
     int res;
 
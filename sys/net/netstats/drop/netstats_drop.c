@@ -0,0 +1,38 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_netstats
+ * @{
+ *
+ * @file
+ * @brief       Counters of dropped packets
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include "atomic_utils.h"
+#include "net/netstats.h"
+
+uint32_t netstats_drops[NETSTATS_DROP_NUMOF];
+
+void netstats_drop_get(uint32_t drops[NETSTATS_DROP_NUMOF])
+{
+    for (unsigned i = 0; i < NETSTATS_DROP_NUMOF; i++) {
+        drops[i] = atomic_load_u32(&netstats_drops[i]);
+    }
+}
+
+void netstats_drop_reset(void)
+{
+    for (unsigned i = 0; i < NETSTATS_DROP_NUMOF; i++) {
+        atomic_store_u32(&netstats_drops[i], 0);
+    }
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup posix_poll     POSIX poll
+ * @ingroup  posix
+ * @brief   Poll implementation for RIOT
+ *
+ * `poll()` is provided by the `posix_select` module.
+ *
+ * @see     [The Open Group Base Specification Issue 7]
+ *          (https://pubs.opengroup.org/onlinepubs/9699919799.2018edition/)
+ * @todo    Currently, only [sockets](@ref posix_sockets) are supported
+ * @{
+ *
+ * @file
+ * @brief   Poll types
+ * @see     [The Open Group Base Specification Issue 7, 2018 edition,
+ *          <poll.h>](https://pubs.opengroup.org/onlinepubs/9699919799.2018edition/basedefs/poll.h.html)
+ */
+
+#ifndef POLL_H
+#define POLL_H
+
+#ifdef CPU_NATIVE
+/* On native, system headers may depend on system's <poll.h>. Hence,
+ * include the real poll.h here. */
+__extension__
+#include_next <poll.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef CPU_NATIVE
+
+/**
+ * @name    Poll events
+ * @{
+ */
+#define POLLIN      (0x001)     /**< Data other than high-priority data may
+                                 *   be read without blocking */
+#define POLLPRI     (0x002)     /**< High-priority data may be read without
+                                 *   blocking */
+#define POLLOUT     (0x004)     /**< Normal data may be written without
+                                 *   blocking */
+#define POLLERR     (0x008)     /**< An error has occurred (only in
+                                 *   `revents`) */
+#define POLLHUP     (0x010)     /**< Device has been disconnected (only in
+                                 *   `revents`) */
+#define POLLNVAL    (0x020)     /**< Invalid file descriptor (only in
+                                 *   `revents`) */
+#define POLLRDNORM  (0x040)     /**< Normal data may be read without
+                                 *   blocking */
+#define POLLRDBAND  (0x080)     /**< Priority data may be read without
+                                 *   blocking */
+#define POLLWRNORM  (0x100)     /**< Equivalent to @ref POLLOUT */
+#define POLLWRBAND  (0x200)     /**< Priority data may be written */
+/** @} */
+
+/**
+ * @brief   Type for the number of file descriptors to poll
+ */
+typedef unsigned int nfds_t;
+
+/**
+ * @brief   File descriptor to poll
+ */
+struct pollfd {
+    int fd;         /**< The file descriptor. Ignored if negative */
+    short events;   /**< The events of interest */
+    short revents;  /**< The events that occurred */
+};
+
+/**
+ * @brief   Waits until one of the given file descriptors is ready
+ *
+ * Sockets are always reported as ready to write (@ref POLLOUT and
+ * @ref POLLWRNORM). File descriptors that are not sockets are reported with
+ * @ref POLLNVAL.
+ *
+ * @param[in,out] fds   The file descriptors to poll, the events that occurred
+ *                      are written to their `revents` member.
+ * @param[in] nfds      The number of elements in @p fds
+ * @param[in] timeout   Timeout in milliseconds. 0 to return immediately, -1
+ *                      to block indefinitely.
+ *
+ * @return  number of elements in @p fds with a non-zero `revents` on success.
+ *          0 on timeout.
+ * @return  -1 on error, `errno` is set to indicate the error.
+ */
+int poll(struct pollfd fds[], nfds_t nfds, int timeout);
+
+#endif /* CPU_NATIVE */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* POLL_H */
+/** @} */
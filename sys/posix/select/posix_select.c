@@ -13,6 +13,7 @@
  */
 
 #include <errno.h>
+#include <poll.h>
 #include <stdbool.h>
 #include <sys/select.h>
 
@@ -24,7 +25,7 @@
 #if IS_USED(MODULE_POSIX_SOCKETS)
 extern bool posix_socket_is(int fd);
 extern unsigned posix_socket_avail(int fd);
-extern void posix_socket_select(int fd);
+extern int posix_socket_select(int fd);
 #else   /* MODULE_POSIX_SOCKETS */
 static inline bool posix_socket_is(int fd)
 {
@@ -38,7 +39,7 @@ static inline unsigned posix_socket_avail(int fd)
     return 0;
 }
 
-static inline void posix_socket_select(int fd)
+static inline int posix_socket_select(int fd)
 {
     (void)fd;
     return 0;
@@ -69,22 +70,39 @@ static int _set_timeout(ztimer64_t *timeout_timer, struct timeval *timeout,
     return 0;
 }
 
+static int _select_readfds(int nfds, fd_set *readfds, fd_set *ret_readfds)
+{
+    int fds_set = 0;
+
+    for (int i = 0; i < nfds; i++) {
+        if (FD_ISSET(i, readfds) && !FD_ISSET(i, ret_readfds) &&
+            (posix_socket_avail(i) > 0)) {
+            FD_SET(i, ret_readfds);
+            fds_set++;
+        }
+    }
+    return fds_set;
+}
+
 int select(int nfds, fd_set *readfds, fd_set *writefds, fd_set *errorfds,
            struct timeval *timeout)
 {
     uint32_t start_time = ztimer64_now(ZTIMER64_USEC);
-    fd_set ret_readfds;
+    fd_set ret_readfds, ret_writefds;
     ztimer64_t timeout_timer;
     int fds_set = 0;
     bool wait = true;
 
     FD_ZERO(&ret_readfds);
-    /* TODO ignored writefds and errorfds for now since there is no point for
-     * them with sockets */
-    if ((nfds >= FD_SETSIZE) || ((unsigned)nfds >= VFS_MAX_OPEN_FILES)) {
+    FD_ZERO(&ret_writefds);
+    /* nfds is the highest file descriptor checked + 1 */
+    if ((nfds < 0) || (nfds > FD_SETSIZE) ||
+        ((unsigned)nfds > VFS_MAX_OPEN_FILES)) {
         errno = EINVAL;
         return -1;
     }
+    /* a stale timeout flag would end a wait without timeout right away */
+    thread_flags_clear(POSIX_SELECT_THREAD_FLAG | THREAD_FLAG_TIMEOUT);
     for (int i = 0; i < nfds; i++) {
         if ((readfds != NULL) && FD_ISSET(i, readfds)) {
             if (!posix_socket_is(i)) {
@@ -94,16 +112,19 @@ int select(int nfds, fd_set *readfds, fd_set *writefds, fd_set *errorfds,
             if (posix_socket_avail(i) > 0) {
                 FD_SET(i, &ret_readfds);
                 fds_set++;
-                wait = false;
             }
             else {
                 posix_socket_select(i);
             }
         }
-        if ((writefds != NULL) && FD_ISSET(i, writefds) &&
-            !posix_socket_is(i)) {
-            errno = EBADF;
-            return -1;
+        if ((writefds != NULL) && FD_ISSET(i, writefds)) {
+            if (!posix_socket_is(i)) {
+                errno = EBADF;
+                return -1;
+            }
+            /* sockets are always ready to write */
+            FD_SET(i, &ret_writefds);
+            fds_set++;
         }
         if ((errorfds != NULL) && FD_ISSET(i, errorfds) &&
             !posix_socket_is(i)) {
@@ -111,34 +132,104 @@ int select(int nfds, fd_set *readfds, fd_set *writefds, fd_set *errorfds,
             return -1;
         }
     }
+    wait = (fds_set == 0);
     while (wait) {
         if (_set_timeout(&timeout_timer, timeout,
                          ztimer64_now(ZTIMER64_USEC) - start_time, &wait) < 0) {
             return -1;
         }
         if (!wait) {
-            errno = EINTR;
-            return -1;
+            /* timed out */
+            break;
         }
         thread_flags_t tflags = thread_flags_wait_any(POSIX_SELECT_THREAD_FLAG |
                                                       THREAD_FLAG_TIMEOUT);
-        if (tflags & POSIX_SELECT_THREAD_FLAG) {
-            for (int i = 0; i < nfds; i++) {
-                if (FD_ISSET(i, readfds)) {
-                    if (posix_socket_avail(i) > 0) {
-                        FD_SET(i, &ret_readfds);
-                        fds_set++;
-                        wait = false;
-                    }
-                }
-            }
+        if ((tflags & POSIX_SELECT_THREAD_FLAG) && (readfds != NULL)) {
+            fds_set += _select_readfds(nfds, readfds, &ret_readfds);
+            wait = (fds_set == 0);
         }
-        else if (tflags & THREAD_FLAG_TIMEOUT) {
-            errno = EINTR;
-            return -1;
+        if (tflags & THREAD_FLAG_TIMEOUT) {
+            wait = false;
         }
         ztimer64_remove(ZTIMER64_USEC, &timeout_timer);
     }
-    *readfds = ret_readfds;
+    if (readfds != NULL) {
+        *readfds = ret_readfds;
+    }
+    if (writefds != NULL) {
+        *writefds = ret_writefds;
+    }
+    if (errorfds != NULL) {
+        /* no error conditions are reported for sockets */
+        FD_ZERO(errorfds);
+    }
     return fds_set;
 }
+
+static int _poll_fds(struct pollfd fds[], nfds_t nfds, bool subscribe)
+{
+    int fds_ready = 0;
+
+    for (nfds_t i = 0; i < nfds; i++) {
+        struct pollfd *pfd = &fds[i];
+
+        pfd->revents = 0;
+        if (pfd->fd < 0) {
+            continue;
+        }
+        if (!posix_socket_is(pfd->fd)) {
+            pfd->revents = POLLNVAL;
+            fds_ready++;
+            continue;
+        }
+        if (pfd->events & (POLLIN | POLLRDNORM)) {
+            if (posix_socket_avail(pfd->fd) > 0) {
+                pfd->revents |= pfd->events & (POLLIN | POLLRDNORM);
+            }
+            else if (subscribe && (posix_socket_select(pfd->fd) < 0)) {
+                pfd->revents |= POLLERR;
+            }
+        }
+        /* sockets are always ready to write */
+        pfd->revents |= pfd->events & (POLLOUT | POLLWRNORM);
+        if (pfd->revents) {
+            fds_ready++;
+        }
+    }
+    return fds_ready;
+}
+
+int poll(struct pollfd fds[], nfds_t nfds, int timeout)
+{
+    ztimer64_t timeout_timer;
+    int fds_ready;
+
+    if (nfds > VFS_MAX_OPEN_FILES) {
+        errno = EINVAL;
+        return -1;
+    }
+    /* a stale timeout flag would end a wait without timeout right away */
+    thread_flags_clear(POSIX_SELECT_THREAD_FLAG | THREAD_FLAG_TIMEOUT);
+    fds_ready = _poll_fds(fds, nfds, true);
+    if ((fds_ready > 0) || (timeout == 0)) {
+        return fds_ready;
+    }
+    if (timeout > 0) {
+        ztimer64_set_timeout_flag(ZTIMER64_USEC, &timeout_timer,
+                                  (uint64_t)timeout * US_PER_MS);
+    }
+    while (fds_ready == 0) {
+        thread_flags_t tflags = thread_flags_wait_any(POSIX_SELECT_THREAD_FLAG |
+                                                      THREAD_FLAG_TIMEOUT);
+        if (tflags & POSIX_SELECT_THREAD_FLAG) {
+            fds_ready = _poll_fds(fds, nfds, false);
+        }
+        if (tflags & THREAD_FLAG_TIMEOUT) {
+            break;
+        }
+    }
+    if (timeout > 0) {
+        ztimer64_remove(ZTIMER64_USEC, &timeout_timer);
+    }
+    return fds_ready;
+}
@@ -975,10 +975,16 @@ static ssize_t socket_recvfrom(socket_t *s, void *restrict buffer,
         res = -EOPNOTSUPP;
         break;
     }
-    if ((res >= 0) && (address != NULL) && (address_len != NULL)) {
 #ifdef MODULE_SOCK_ASYNC
-        atomic_fetch_sub(&s->available, 1);
+    if (res >= 0) {
+        /* also count down for recv(), but never below 0 in case the data was
+         * received before the callback was set */
+        unsigned avail = atomic_load(&s->available);
+        while ((avail > 0) &&
+               !atomic_compare_exchange_weak(&s->available, &avail, avail - 1)) {}
+    }
 #endif
+    if ((res >= 0) && (address != NULL) && (address_len != NULL)) {
         switch (s->type) {
 #ifdef MODULE_SOCK_TCP
         case SOCK_STREAM:
@@ -39,6 +39,7 @@ void _del_cb(void *ptr)
     gnrc_sixlowpan_ctx_t *ctx = ptr;
     uint8_t cid = ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK;
     ctx->prefix_len = 0;
+    gnrc_sixlowpan_ctx_changed();
     del_timer[cid].callback = NULL;
 }
 
@@ -125,6 +126,7 @@ static int _gnrc_6ctx_del(char *cmd_str, char *ctx_str)
         if (ctx != NULL) {
             ctx->flags_id &= ~GNRC_SIXLOWPAN_CTX_FLAGS_COMP;
             ctx->ltime = 0;
+            gnrc_sixlowpan_ctx_changed();
             del_timer[cid].callback = _del_cb;
             del_timer[cid].arg = ctx;
 #if IS_USED(MODULE_ZTIMER_MSEC)
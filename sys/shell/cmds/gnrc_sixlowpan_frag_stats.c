@@ -29,6 +29,11 @@ static int _gnrc_6lo_frag_stats(int argc, char **argv)
     (void)argv;
     printf("rbuf full: %u\n", stats->rbuf_full);
     printf("frag full: %u\n", stats->frag_full);
+    printf("ints full: %u\n", stats->ints_full);
+    printf("datagrams: %u, fragments: %u\n", stats->datagrams,
+           stats->fragments);
+    printf("overlaps: %u, duplicates: %u, timeouts: %u\n", stats->overlaps,
+           stats->duplicates, stats->rbuf_timeouts);
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
     printf("VRB full: %u\n", stats->vrb_full);
 #endif
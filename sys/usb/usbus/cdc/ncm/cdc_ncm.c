@@ -0,0 +1,588 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup usbus_cdc_ncm
+ * @{
+ * @file USBUS implementation for network control model
+ *
+ * @author  agent <agent@local>
+ * @}
+ */
+
+#define USB_H_USER_IS_RIOT_INTERNAL
+
+#include <string.h>
+
+#include "event.h"
+#include "fmt.h"
+#include "kernel_defines.h"
+#include "luid.h"
+#include "net/ethernet.h"
+#include "net/eui48.h"
+#include "usb/cdc.h"
+#include "usb/descriptor.h"
+#include "usb/usbus.h"
+#include "usb/usbus/control.h"
+#include "usb/usbus/cdc/ncm.h"
+
+#include "cdc_ncm_internal.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static_assert((CONFIG_USBUS_CDC_NCM_NTB_IN_SIZE >= 2048) &&
+              (CONFIG_USBUS_CDC_NCM_NTB_IN_SIZE <= UINT16_MAX) &&
+              (CONFIG_USBUS_CDC_NCM_NTB_IN_SIZE % 4 == 0),
+              "NTB IN size must be a multiple of 4 between 2048 and 65535");
+static_assert((CONFIG_USBUS_CDC_NCM_NTB_OUT_SIZE >= 2048) &&
+              (CONFIG_USBUS_CDC_NCM_NTB_OUT_SIZE <= UINT16_MAX) &&
+              (CONFIG_USBUS_CDC_NCM_NTB_OUT_SIZE % 4 == 0),
+              "NTB OUT size must be a multiple of 4 between 2048 and 65535");
+
+static void _event_handler(usbus_t *usbus, usbus_handler_t *handler,
+                           usbus_event_usb_t event);
+static int _control_handler(usbus_t *usbus, usbus_handler_t *handler,
+                            usbus_control_request_state_t state,
+                            usb_setup_t *setup);
+static void _transfer_handler(usbus_t *usbus, usbus_handler_t *handler,
+                              usbdev_ep_t *ep, usbus_event_transfer_t event);
+static void _init(usbus_t *usbus, usbus_handler_t *handler);
+static void _handle_rx_flush_ev(event_t *ev);
+static void _handle_tx_xmit(event_t *ev);
+
+static size_t _gen_full_ncm_descriptor(usbus_t *usbus, void *arg);
+static size_t _gen_assoc_descriptor(usbus_t *usbus, void *arg);
+
+static const usbus_descr_gen_funcs_t _ncm_descriptor = {
+    .fmt_post_descriptor = _gen_full_ncm_descriptor,
+    .fmt_pre_descriptor = _gen_assoc_descriptor,
+    .len = {
+        .fixed_len = sizeof(usb_descriptor_interface_association_t) +
+                     sizeof(usb_desc_cdc_t) +
+                     sizeof(usb_desc_union_t) +
+                     sizeof(usb_desc_ecm_t) +
+                     sizeof(usb_desc_ncm_t),
+    },
+    .len_type = USBUS_DESCR_LEN_FIXED,
+};
+
+static size_t _gen_assoc_descriptor(usbus_t *usbus, void *arg)
+{
+    usbus_cdcncm_device_t *cdcncm = arg;
+    usb_descriptor_interface_association_t iad;
+
+    iad.length = sizeof(usb_descriptor_interface_association_t);
+    iad.type = USB_TYPE_DESCRIPTOR_INTERFACE_ASSOC;
+    iad.first_interface = cdcncm->iface_ctrl.idx;
+    iad.interface_count = 2; /* Control and data interface */
+    iad.class = USB_CLASS_CDC_CONTROL;
+    iad.subclass = USB_CDC_SUBCLASS_NCM;
+    iad.protocol = USB_CDC_PROTOCOL_NONE;
+    iad.idx = 0;
+    usbus_control_slicer_put_bytes(usbus, (uint8_t *)&iad, sizeof(iad));
+    return sizeof(iad);
+}
+
+static size_t _gen_union_descriptor(usbus_t *usbus, usbus_cdcncm_device_t *cdcncm)
+{
+    usb_desc_union_t uni;
+
+    /* functional union descriptor */
+    uni.length = sizeof(usb_desc_union_t);
+    uni.type = USB_TYPE_DESCRIPTOR_CDC;
+    uni.subtype = USB_CDC_DESCR_SUBTYPE_UNION;
+    uni.master_if = cdcncm->iface_ctrl.idx;
+    uni.slave_if = cdcncm->iface_data.idx;
+    usbus_control_slicer_put_bytes(usbus, (uint8_t *)&uni, sizeof(uni));
+    return sizeof(usb_desc_union_t);
+}
+
+static size_t _gen_ecm_descriptor(usbus_t *usbus, usbus_cdcncm_device_t *cdcncm)
+{
+    usb_desc_ecm_t ecm;
+
+    /* functional ethernet networking descriptor, also required for NCM */
+    ecm.length = sizeof(usb_desc_ecm_t);
+    ecm.type = USB_TYPE_DESCRIPTOR_CDC;
+    ecm.subtype = USB_CDC_DESCR_SUBTYPE_ETH_NET;
+    ecm.macaddress = cdcncm->mac_str.idx;
+    ecm.ethernetstatistics = 0;
+    ecm.maxsegmentsize = ETHERNET_FRAME_LEN;
+    ecm.numbermcfilters = 0x0000; /* No filtering */
+    ecm.numberpowerfilters = 0;
+    usbus_control_slicer_put_bytes(usbus, (uint8_t *)&ecm, sizeof(ecm));
+    return sizeof(usb_desc_ecm_t);
+}
+
+static size_t _gen_ncm_descriptor(usbus_t *usbus)
+{
+    usb_desc_ncm_t ncm;
+
+    /* functional cdc ncm descriptor */
+    ncm.length = sizeof(usb_desc_ncm_t);
+    ncm.type = USB_TYPE_DESCRIPTOR_CDC;
+    ncm.subtype = USB_CDC_DESCR_SUBTYPE_NCM;
+    ncm.bcd_ncm = USB_CDC_NCM_VERSION_BCD;
+    ncm.capabilities = 0; /* None of the optional requests */
+    usbus_control_slicer_put_bytes(usbus, (uint8_t *)&ncm, sizeof(ncm));
+    return sizeof(usb_desc_ncm_t);
+}
+
+static size_t _gen_cdc_descriptor(usbus_t *usbus)
+{
+    usb_desc_cdc_t cdc;
+    /* functional cdc descriptor */
+    cdc.length = sizeof(usb_desc_cdc_t);
+    cdc.bcd_cdc = USB_CDC_VERSION_BCD;
+    cdc.type = USB_TYPE_DESCRIPTOR_CDC;
+    cdc.subtype = 0x00;
+    usbus_control_slicer_put_bytes(usbus, (uint8_t *)&cdc, sizeof(cdc));
+    return sizeof(usb_desc_cdc_t);
+}
+
+static size_t _gen_full_ncm_descriptor(usbus_t *usbus, void *arg)
+{
+    usbus_cdcncm_device_t *cdcncm = (usbus_cdcncm_device_t *)arg;
+    size_t total_size = 0;
+
+    total_size += _gen_cdc_descriptor(usbus);
+    total_size += _gen_union_descriptor(usbus, cdcncm);
+    total_size += _gen_ecm_descriptor(usbus, cdcncm);
+    total_size += _gen_ncm_descriptor(usbus);
+    return total_size;
+}
+
+static void _notify_link_speed(usbus_cdcncm_device_t *cdcncm)
+{
+    DEBUG("CDC NCM: sending link speed indication\n");
+    usb_desc_cdcecm_speed_t *notification =
+        (usb_desc_cdcecm_speed_t *)cdcncm->control_in;
+    notification->setup.type = USB_SETUP_REQUEST_DEVICE2HOST |
+                               USB_SETUP_REQUEST_TYPE_CLASS |
+                               USB_SETUP_REQUEST_RECIPIENT_INTERFACE;
+    notification->setup.request = USB_CDC_MGNT_NOTIF_CONN_SPEED_CHANGE;
+    notification->setup.value = 0;
+    notification->setup.index = cdcncm->iface_ctrl.idx;
+    notification->setup.length = 8;
+
+    notification->down = CONFIG_USBUS_CDC_NCM_CONFIG_SPEED_DOWNSTREAM;
+    notification->up = CONFIG_USBUS_CDC_NCM_CONFIG_SPEED_UPSTREAM;
+    usbdev_ep_xmit(cdcncm->ep_ctrl->ep, cdcncm->control_in,
+                   sizeof(usb_desc_cdcecm_speed_t));
+    cdcncm->notif = USBUS_CDCNCM_NOTIF_SPEED;
+}
+
+static void _notify_link_up(usbus_cdcncm_device_t *cdcncm)
+{
+    DEBUG("CDC NCM: sending link up indication\n");
+    usb_setup_t *notification = (usb_setup_t *)cdcncm->control_in;
+    notification->type = USB_SETUP_REQUEST_DEVICE2HOST |
+                         USB_SETUP_REQUEST_TYPE_CLASS |
+                         USB_SETUP_REQUEST_RECIPIENT_INTERFACE;
+    notification->request = USB_CDC_MGNT_NOTIF_NETWORK_CONNECTION;
+    notification->value = 1;
+    notification->index = cdcncm->iface_ctrl.idx;
+    notification->length = 0;
+    usbdev_ep_xmit(cdcncm->ep_ctrl->ep, cdcncm->control_in, sizeof(usb_setup_t));
+    cdcncm->notif = USBUS_CDCNCM_NOTIF_LINK_UP;
+}
+
+static const usbus_handler_driver_t cdcncm_driver = {
+    .init = _init,
+    .event_handler = _event_handler,
+    .transfer_handler = _transfer_handler,
+    .control_handler = _control_handler,
+};
+
+static void _fill_ethernet(usbus_cdcncm_device_t *cdcncm)
+{
+    uint8_t ethernet[ETHERNET_ADDR_LEN];
+
+    luid_get_eui48((eui48_t *)ethernet);
+    fmt_bytes_hex(cdcncm->mac_host, ethernet, sizeof(ethernet));
+}
+
+/* must be called with the tx_lock held */
+static void _tx_reset(usbus_cdcncm_device_t *cdcncm)
+{
+    cdcncm->tx_busy = false;
+    cdcncm->tx_num = 0;
+    cdcncm->tx_len = CDCNCM_TX_DATAGRAM_START;
+    /* wake up senders waiting for space */
+    mutex_unlock(&cdcncm->tx_space);
+}
+
+/* must be called with the tx_lock held */
+static void _tx_flush(usbus_cdcncm_device_t *cdcncm)
+{
+    if (cdcncm->tx_busy || cdcncm->tx_num == 0) {
+        return;
+    }
+
+    uint8_t *ntb = cdcncm->data_in[cdcncm->tx_fill];
+    usb_cdcncm_nth16_t *nth = (usb_cdcncm_nth16_t *)ntb;
+    usb_cdcncm_ndp16_t *ndp = (usb_cdcncm_ndp16_t *)(ntb + sizeof(*nth));
+    usb_cdcncm_dpe16_t *dpe = (usb_cdcncm_dpe16_t *)(ndp + 1);
+
+    /* the datagram entries are already filled in by the netdev */
+    nth->signature = USB_CDC_NCM_NTH16_SIGNATURE;
+    nth->header_len = sizeof(*nth);
+    nth->sequence = cdcncm->tx_seq++;
+    nth->block_len = cdcncm->tx_len;
+    nth->ndp_index = sizeof(*nth);
+    ndp->signature = USB_CDC_NCM_NDP16_SIGNATURE;
+    ndp->len = sizeof(*ndp) + (cdcncm->tx_num + 1) * sizeof(*dpe);
+    ndp->next_index = 0;
+    dpe[cdcncm->tx_num].index = 0;
+    dpe[cdcncm->tx_num].len = 0;
+
+    DEBUG("CDC NCM: sending NTB with %u frames, %u bytes\n",
+          cdcncm->tx_num, cdcncm->tx_len);
+    /* A full size NTB doesn't need to be terminated */
+    usbus_urb_init(&cdcncm->in_urb, ntb, cdcncm->tx_len,
+                   cdcncm->tx_len < cdcncm->ntb_in_size
+                   ? USBUS_URB_FLAG_AUTO_ZLP : 0);
+    usbus_urb_submit(cdcncm->usbus, cdcncm->ep_in, &cdcncm->in_urb);
+
+    /* Frames sent from here on go to the other NTB */
+    cdcncm->tx_fill ^= 1;
+    _tx_reset(cdcncm);
+    cdcncm->tx_busy = true;
+}
+
+static void _rx_start(usbus_cdcncm_device_t *cdcncm, unsigned idx)
+{
+    cdcncm->rx_urb = idx;
+    usbus_urb_init(&cdcncm->out_urb, cdcncm->data_out[idx],
+                   CONFIG_USBUS_CDC_NCM_NTB_OUT_SIZE, 0);
+    usbus_urb_submit(cdcncm->usbus, cdcncm->ep_out, &cdcncm->out_urb);
+}
+
+/* Pass a received NTB to the netdev, false if it is not valid */
+static bool _rx_pass(usbus_cdcncm_device_t *cdcncm, unsigned idx)
+{
+    const usb_cdcncm_nth16_t *nth =
+        (const usb_cdcncm_nth16_t *)cdcncm->data_out[idx];
+    size_t len = cdcncm->rx_len[idx];
+
+    if ((len < sizeof(*nth)) ||
+        (nth->signature != USB_CDC_NCM_NTH16_SIGNATURE) ||
+        (nth->header_len != sizeof(*nth)) ||
+        (nth->block_len > len)) {
+        DEBUG("CDC NCM: dropping NTB with invalid header\n");
+        return false;
+    }
+    /* Everything after the block is padding */
+    cdcncm->rx_len[idx] = nth->block_len;
+    if (!cdcncm_ndp_valid(cdcncm->data_out[idx], nth->block_len,
+                          nth->ndp_index)) {
+        DEBUG("CDC NCM: dropping NTB with invalid NDP\n");
+        return false;
+    }
+
+    cdcncm->rx_cur = idx;
+    cdcncm->rx_ndp = nth->ndp_index;
+    cdcncm->rx_dpe = nth->ndp_index + sizeof(usb_cdcncm_ndp16_t);
+    cdcncm->rx_busy = true;
+    netdev_trigger_event_isr(&cdcncm->netdev);
+    return true;
+}
+
+static void _handle_rx_complete(usbus_cdcncm_device_t *cdcncm)
+{
+    unsigned idx = cdcncm->rx_urb;
+
+    cdcncm->rx_len[idx] = cdcncm->out_urb.transferred;
+    cdcncm->rx_urb = CDCNCM_RX_NONE;
+    if (cdcncm->rx_busy) {
+        /* the netdev still has the other NTB, continue once it is done */
+        cdcncm->rx_pending = true;
+        return;
+    }
+    if (_rx_pass(cdcncm, idx)) {
+        idx ^= 1;
+    }
+    _rx_start(cdcncm, idx);
+}
+
+void usbus_cdcncm_init(usbus_t *usbus, usbus_cdcncm_device_t *handler)
+{
+    assert(usbus);
+    assert(handler);
+    memset(handler, 0, sizeof(usbus_cdcncm_device_t));
+    mutex_init(&handler->tx_lock);
+    handler->tx_space = (mutex_t)MUTEX_INIT_LOCKED;
+    handler->ntb_in_size = CONFIG_USBUS_CDC_NCM_NTB_IN_SIZE;
+    handler->tx_len = CDCNCM_TX_DATAGRAM_START;
+    handler->rx_urb = CDCNCM_RX_NONE;
+    _fill_ethernet(handler);
+    handler->usbus = usbus;
+    handler->handler_ctrl.driver = &cdcncm_driver;
+    usbus_register_event_handler(usbus, (usbus_handler_t *)handler);
+}
+
+static void _init(usbus_t *usbus, usbus_handler_t *handler)
+{
+    DEBUG("CDC NCM: initialization\n");
+    usbus_cdcncm_device_t *cdcncm = (usbus_cdcncm_device_t *)handler;
+
+    /* Add event handlers */
+    cdcncm->tx_xmit.handler = _handle_tx_xmit;
+    cdcncm->rx_flush.handler = _handle_rx_flush_ev;
+
+    /* Set up descriptor generators */
+    cdcncm->ncm_descr.next = NULL;
+    cdcncm->ncm_descr.funcs = &_ncm_descriptor;
+    cdcncm->ncm_descr.arg = cdcncm;
+
+    /* Configure Interface 0 as control interface */
+    cdcncm->iface_ctrl.class = USB_CLASS_CDC_CONTROL;
+    cdcncm->iface_ctrl.subclass = USB_CDC_SUBCLASS_NCM;
+    cdcncm->iface_ctrl.protocol = USB_CDC_PROTOCOL_NONE;
+    cdcncm->iface_ctrl.descr_gen = &cdcncm->ncm_descr;
+    cdcncm->iface_ctrl.handler = handler;
+
+    /* Configure second interface to handle data endpoint */
+    cdcncm->iface_data.class = USB_CLASS_CDC_DATA;
+    cdcncm->iface_data.subclass = USB_CDC_SUBCLASS_NONE;
+    cdcncm->iface_data.protocol = USB_CDC_DATA_PROTOCOL_NTB;
+    cdcncm->iface_data.descr_gen = NULL;
+    cdcncm->iface_data.handler = handler;
+
+    /* Add string descriptor for the host mac */
+    usbus_add_string_descriptor(usbus, &cdcncm->mac_str, cdcncm->mac_host);
+
+    /* Create required endpoints */
+    cdcncm->ep_ctrl = usbus_add_endpoint(usbus, &cdcncm->iface_ctrl,
+                                         USB_EP_TYPE_INTERRUPT,
+                                         USB_EP_DIR_IN,
+                                         USBUS_CDCNCM_EP_CTRL_SIZE);
+    assert(cdcncm->ep_ctrl);
+    cdcncm->ep_ctrl->interval = 0x10;
+
+    cdcncm->ep_out = usbus_add_endpoint(usbus,
+                                        (usbus_interface_t *)&cdcncm->iface_data_alt,
+                                        USB_EP_TYPE_BULK,
+                                        USB_EP_DIR_OUT,
+                                        USBUS_CDCNCM_EP_DATA_SIZE);
+    assert(cdcncm->ep_out);
+    cdcncm->ep_out->interval = 0; /* Must be 0 for bulk endpoints */
+    cdcncm->ep_in = usbus_add_endpoint(usbus,
+                                       (usbus_interface_t *)&cdcncm->iface_data_alt,
+                                       USB_EP_TYPE_BULK,
+                                       USB_EP_DIR_IN,
+                                       USBUS_CDCNCM_EP_DATA_SIZE);
+    assert(cdcncm->ep_in);
+    cdcncm->ep_in->interval = 0; /* Must be 0 for bulk endpoints */
+
+    /* Add interfaces to the stack */
+    usbus_add_interface(usbus, &cdcncm->iface_ctrl);
+    usbus_add_interface(usbus, &cdcncm->iface_data);
+
+    usbus_add_interface_alt(&cdcncm->iface_data, &cdcncm->iface_data_alt);
+
+    usbus_enable_endpoint(cdcncm->ep_out);
+    usbus_enable_endpoint(cdcncm->ep_in);
+    usbus_enable_endpoint(cdcncm->ep_ctrl);
+    usbus_handler_set_flag(handler, USBUS_HANDLER_FLAG_RESET);
+}
+
+static void _set_data_iface(usbus_cdcncm_device_t *cdcncm, unsigned alt)
+{
+    mutex_lock(&cdcncm->tx_lock);
+    cdcncm->active_iface = alt;
+    if (alt == 0) {
+        /* Selecting alternate setting 0 resets the NTB parameters */
+        cdcncm->ntb_in_size = CONFIG_USBUS_CDC_NCM_NTB_IN_SIZE;
+        cdcncm->tx_seq = 0;
+    }
+    _tx_reset(cdcncm);
+    mutex_unlock(&cdcncm->tx_lock);
+
+    if (alt == 1) {
+        _notify_link_up(cdcncm);
+        if (cdcncm->rx_urb == CDCNCM_RX_NONE && !cdcncm->rx_busy) {
+            _rx_start(cdcncm, 0);
+        }
+    }
+}
+
+static int _control_handler(usbus_t *usbus, usbus_handler_t *handler,
+                            usbus_control_request_state_t state,
+                            usb_setup_t *setup)
+{
+    usbus_cdcncm_device_t *cdcncm = (usbus_cdcncm_device_t *)handler;
+
+    DEBUG("CDC NCM: Request: 0x%x\n", setup->request);
+    switch (setup->request) {
+        case USB_SETUP_REQ_SET_INTERFACE:
+            DEBUG("CDC NCM: Changing active interface to alt %d\n",
+                  setup->value);
+            _set_data_iface(cdcncm, setup->value);
+            break;
+
+        case USB_CDC_MGNT_REQUEST_GET_NTB_PARAMETERS:
+        {
+            usb_req_cdcncm_ntb_params_t params = {
+                .length = sizeof(usb_req_cdcncm_ntb_params_t),
+                .formats = USB_CDC_NCM_NTB_FORMAT_16,
+                .in_max_size = CONFIG_USBUS_CDC_NCM_NTB_IN_SIZE,
+                .in_divisor = CDCNCM_ALIGN,
+                .in_remainder = 0,
+                .in_alignment = CDCNCM_ALIGN,
+                .out_max_size = CONFIG_USBUS_CDC_NCM_NTB_OUT_SIZE,
+                .out_divisor = CDCNCM_ALIGN,
+                .out_remainder = 0,
+                .out_alignment = CDCNCM_ALIGN,
+                .out_max_datagrams = 0, /* No limit */
+            };
+            usbus_control_slicer_put_bytes(usbus, (uint8_t *)&params,
+                                           sizeof(params));
+            break;
+        }
+
+        case USB_CDC_MGNT_REQUEST_GET_NTB_FORMAT:
+        {
+            uint16_t format = 0; /* 16 bit NTBs */
+            usbus_control_slicer_put_bytes(usbus, (uint8_t *)&format,
+                                           sizeof(format));
+            break;
+        }
+
+        case USB_CDC_MGNT_REQUEST_SET_NTB_FORMAT:
+            if (setup->value != 0) {
+                return -1; /* Only 16 bit NTBs are supported */
+            }
+            break;
+
+        case USB_CDC_MGNT_REQUEST_GET_NTB_INPUT_SIZE:
+            usbus_control_slicer_put_bytes(usbus,
+                                           (uint8_t *)&cdcncm->ntb_in_size,
+                                           sizeof(cdcncm->ntb_in_size));
+            break;
+
+        case USB_CDC_MGNT_REQUEST_SET_NTB_INPUT_SIZE:
+            /* Only allowed while the data interface is disabled */
+            if (setup->length != sizeof(uint32_t) || cdcncm->active_iface) {
+                return -1;
+            }
+            if (state == USBUS_CONTROL_REQUEST_STATE_OUTDATA) {
+                size_t len = 0;
+                uint8_t *data = usbus_control_get_out_data(usbus, &len);
+                uint32_t size;
+
+                if (len != sizeof(size)) {
+                    return -1;
+                }
+                memcpy(&size, data, sizeof(size));
+                if (size < 2048 || size > CONFIG_USBUS_CDC_NCM_NTB_IN_SIZE) {
+                    DEBUG("CDC NCM: unsupported NTB input size %" PRIu32 "\n",
+                          size);
+                    return -1;
+                }
+                DEBUG("CDC NCM: NTB input size %" PRIu32 "\n", size);
+                cdcncm->ntb_in_size = size;
+            }
+            break;
+
+        case USB_CDC_MGNT_REQUEST_SET_ETH_PACKET_FILTER:
+            /* While we do answer the request, CDC NCM filters are not really
+             * implemented */
+            DEBUG("CDC NCM: Not modifying filter to 0x%x\n", setup->value);
+            break;
+
+        default:
+            return -1;
+    }
+
+    return 1;
+}
+
+static void _handle_tx_xmit(event_t *ev)
+{
+    usbus_cdcncm_device_t *cdcncm = container_of(ev, usbus_cdcncm_device_t,
+                                                 tx_xmit);
+
+    DEBUG("CDC NCM: Handling TX xmit from netdev\n");
+    mutex_lock(&cdcncm->tx_lock);
+    if (cdcncm->usbus->state == USBUS_STATE_CONFIGURED &&
+        cdcncm->active_iface == 1) {
+        _tx_flush(cdcncm);
+    }
+    mutex_unlock(&cdcncm->tx_lock);
+}
+
+static void _handle_rx_flush_ev(event_t *ev)
+{
+    usbus_cdcncm_device_t *cdcncm = container_of(ev, usbus_cdcncm_device_t,
+                                                 rx_flush);
+    unsigned idx = cdcncm->rx_cur;
+
+    /* The netdev is done with the NTB */
+    cdcncm->rx_busy = false;
+    if (cdcncm->rx_pending) {
+        cdcncm->rx_pending = false;
+        _rx_pass(cdcncm, idx ^ 1);
+    }
+    if (cdcncm->rx_urb == CDCNCM_RX_NONE) {
+        _rx_start(cdcncm, cdcncm->rx_busy ? idx : idx ^ 1);
+    }
+}
+
+static void _transfer_handler(usbus_t *usbus, usbus_handler_t *handler,
+                              usbdev_ep_t *ep, usbus_event_transfer_t event)
+{
+    (void)event; /* Only receives TR_COMPLETE events */
+    (void)usbus;
+    usbus_cdcncm_device_t *cdcncm = (usbus_cdcncm_device_t *)handler;
+
+    if (ep == cdcncm->ep_out->ep) {
+        _handle_rx_complete(cdcncm);
+    }
+    else if (ep == cdcncm->ep_in->ep) {
+        mutex_lock(&cdcncm->tx_lock);
+        cdcncm->tx_busy = false;
+        /* Send the frames collected in the meantime */
+        _tx_flush(cdcncm);
+        mutex_unlock(&cdcncm->tx_lock);
+    }
+    else if (ep == cdcncm->ep_ctrl->ep &&
+             cdcncm->notif == USBUS_CDCNCM_NOTIF_LINK_UP) {
+        _notify_link_speed(cdcncm);
+    }
+}
+
+static void _handle_reset(usbus_t *usbus, usbus_handler_t *handler)
+{
+    usbus_cdcncm_device_t *cdcncm = (usbus_cdcncm_device_t *)handler;
+
+    /* Set the max packet size advertised to the host to something compatible with the enumerated
+     * size */
+    size_t maxpacketsize = usbus_max_bulk_endpoint_size(usbus);
+    cdcncm->ep_in->maxpacketsize = maxpacketsize;
+    cdcncm->ep_out->maxpacketsize = maxpacketsize;
+
+    DEBUG("CDC NCM: Reset\n");
+    cdcncm->notif = USBUS_CDCNCM_NOTIF_NONE;
+    _set_data_iface(cdcncm, 0);
+}
+
+static void _event_handler(usbus_t *usbus, usbus_handler_t *handler,
+                           usbus_event_usb_t event)
+{
+    switch (event) {
+        case USBUS_EVENT_USB_RESET:
+            _handle_reset(usbus, handler);
+            break;
+
+        default:
+            DEBUG("Unhandled event :0x%x\n", event);
+            break;
+    }
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     usbus_cdc_ncm
+ * @{
+ *
+ * @file
+ * @brief       CDC NCM internals shared by the USBUS and the netdev part
+ *
+ * @author      agent <agent@local>
+ */
+
+#ifndef CDC_NCM_INTERNAL_H
+#define CDC_NCM_INTERNAL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "usb/cdc.h"
+#include "usb/usbus/cdc/ncm.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Alignment of NDPs and datagrams in both directions
+ */
+#define CDCNCM_ALIGN                (4U)
+
+/**
+ * @brief   Value of usbus_cdcncm_device_t::rx_urb while no URB is submitted
+ */
+#define CDCNCM_RX_NONE              (0xff)
+
+/**
+ * @brief   Offset of the first datagram in an IN NTB
+ *
+ * IN NTBs start with the header, followed by the single NDP that has room for
+ * @ref CONFIG_USBUS_CDC_NCM_IN_DATAGRAMS_MAX entries and the terminating
+ * entry. Datagrams follow after that.
+ */
+#define CDCNCM_TX_DATAGRAM_START    ((sizeof(usb_cdcncm_nth16_t) + \
+                                      sizeof(usb_cdcncm_ndp16_t) + \
+                                      (CONFIG_USBUS_CDC_NCM_IN_DATAGRAMS_MAX + 1) * \
+                                      sizeof(usb_cdcncm_dpe16_t) + \
+                                      CDCNCM_ALIGN - 1) & ~(CDCNCM_ALIGN - 1))
+
+/**
+ * @brief   Checks whether an NDP in a received NTB can be parsed
+ *
+ * @param[in] ntb       The NTB
+ * @param[in] len       Length of the NTB
+ * @param[in] index     Offset of the NDP in @p ntb
+ *
+ * @return  true if the NDP and its entries are within the NTB
+ */
+static inline bool cdcncm_ndp_valid(const uint8_t *ntb, size_t len,
+                                    uint16_t index)
+{
+    const usb_cdcncm_ndp16_t *ndp = (const usb_cdcncm_ndp16_t *)(ntb + index);
+
+    return (index % CDCNCM_ALIGN == 0) &&
+           (index >= sizeof(usb_cdcncm_nth16_t)) &&
+           (index + sizeof(*ndp) <= len) &&
+           (ndp->signature == USB_CDC_NCM_NDP16_SIGNATURE) &&
+           (ndp->len >= sizeof(*ndp) + 2 * sizeof(usb_cdcncm_dpe16_t)) &&
+           (index + ndp->len <= len);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CDC_NCM_INTERNAL_H */
+/** @} */
@@ -0,0 +1,254 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup usbus_cdc_ncm
+ * @{
+ * @file Netdev implementation for network control model
+ *
+ * @author  agent <agent@local>
+ * @}
+ */
+
+#define USB_H_USER_IS_RIOT_INTERNAL
+
+#include <assert.h>
+#include <errno.h>
+#include <string.h>
+
+#include "kernel_defines.h"
+#include "iolist.h"
+#include "mutex.h"
+#include "net/ethernet.h"
+#include "net/eui_provider.h"
+#include "net/netdev.h"
+#include "net/netdev/eth.h"
+#include "usb/usbus/cdc/ncm.h"
+
+#include "cdc_ncm_internal.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static const netdev_driver_t netdev_driver_cdcncm;
+
+static void _signal_rx_flush(usbus_cdcncm_device_t *cdcncm)
+{
+    usbus_event_post(cdcncm->usbus, &cdcncm->rx_flush);
+}
+
+static void _signal_tx_xmit(usbus_cdcncm_device_t *cdcncm)
+{
+    usbus_event_post(cdcncm->usbus, &cdcncm->tx_xmit);
+}
+
+static usbus_cdcncm_device_t *_netdev_to_cdcncm(netdev_t *netdev)
+{
+    return container_of(netdev, usbus_cdcncm_device_t, netdev);
+}
+
+void cdcncm_netdev_setup(usbus_cdcncm_device_t *cdcncm)
+{
+    cdcncm->netdev.driver = &netdev_driver_cdcncm;
+    netdev_register(&cdcncm->netdev, NETDEV_CDC_NCM, 0);
+}
+
+/* must be called with the tx_lock held */
+static bool _tx_fits(usbus_cdcncm_device_t *cdcncm, size_t len)
+{
+    size_t offset = (cdcncm->tx_len + CDCNCM_ALIGN - 1) & ~(CDCNCM_ALIGN - 1);
+
+    return (cdcncm->tx_num < CONFIG_USBUS_CDC_NCM_IN_DATAGRAMS_MAX) &&
+           (offset + len <= cdcncm->ntb_in_size);
+}
+
+static int _send(netdev_t *netdev, const iolist_t *iolist)
+{
+    assert(iolist);
+    usbus_cdcncm_device_t *cdcncm = _netdev_to_cdcncm(netdev);
+    size_t len = iolist_size(iolist);
+
+    if (len > ETHERNET_FRAME_LEN) {
+        return -EMSGSIZE;
+    }
+
+    mutex_lock(&cdcncm->tx_lock);
+    /* interface with alternative function ID 1 is the interface containing the
+     * data endpoints, no sense trying to transmit data if it is not active */
+    while (cdcncm->active_iface == 1 && !_tx_fits(cdcncm, len)) {
+        /* Wait until the NTB being filled is handed to USBUS */
+        mutex_unlock(&cdcncm->tx_lock);
+        mutex_lock(&cdcncm->tx_space);
+        mutex_lock(&cdcncm->tx_lock);
+    }
+    if (cdcncm->active_iface != 1) {
+        mutex_unlock(&cdcncm->tx_lock);
+        return -ENOTCONN;
+    }
+
+    uint8_t *ntb = cdcncm->data_in[cdcncm->tx_fill];
+    usb_cdcncm_dpe16_t *dpe = (usb_cdcncm_dpe16_t *)(ntb +
+                                                     sizeof(usb_cdcncm_nth16_t) +
+                                                     sizeof(usb_cdcncm_ndp16_t));
+    size_t offset = (cdcncm->tx_len + CDCNCM_ALIGN - 1) & ~(CDCNCM_ALIGN - 1);
+
+    DEBUG("CDC NCM netdev: adding %u bytes at %u\n", (unsigned)len,
+          (unsigned)offset);
+    /* Copy the frame straight into the NTB */
+    iolist_to_buffer(iolist, ntb + offset, len);
+    dpe[cdcncm->tx_num].index = offset;
+    dpe[cdcncm->tx_num].len = len;
+    cdcncm->tx_num++;
+    cdcncm->tx_len = offset + len;
+    /* If an NTB is in flight, this one is sent when that one completes */
+    bool idle = !cdcncm->tx_busy;
+    mutex_unlock(&cdcncm->tx_lock);
+
+    if (idle) {
+        _signal_tx_xmit(cdcncm);
+    }
+    return len;
+}
+
+/* Returns the entry of the next frame in the current OUT NTB */
+static const usb_cdcncm_dpe16_t *_rx_datagram(usbus_cdcncm_device_t *cdcncm)
+{
+    const uint8_t *ntb = cdcncm->data_out[cdcncm->rx_cur];
+    size_t len = cdcncm->rx_len[cdcncm->rx_cur];
+
+    while (cdcncm->rx_dpe) {
+        const usb_cdcncm_ndp16_t *ndp =
+            (const usb_cdcncm_ndp16_t *)(ntb + cdcncm->rx_ndp);
+        const usb_cdcncm_dpe16_t *dpe =
+            (const usb_cdcncm_dpe16_t *)(ntb + cdcncm->rx_dpe);
+
+        if ((cdcncm->rx_dpe + sizeof(*dpe) <= cdcncm->rx_ndp + ndp->len) &&
+            dpe->index && dpe->len) {
+            if ((dpe->index + dpe->len <= len) &&
+                (dpe->len <= ETHERNET_FRAME_LEN)) {
+                return dpe;
+            }
+            DEBUG("CDC NCM netdev: skipping invalid datagram\n");
+            cdcncm->rx_dpe += sizeof(*dpe);
+            continue;
+        }
+        /* End of this NDP, offsets must increase to rule out loops */
+        if ((ndp->next_index > cdcncm->rx_ndp) &&
+            cdcncm_ndp_valid(ntb, len, ndp->next_index)) {
+            cdcncm->rx_ndp = ndp->next_index;
+            cdcncm->rx_dpe = ndp->next_index + sizeof(*ndp);
+        }
+        else {
+            cdcncm->rx_dpe = 0;
+        }
+    }
+    return NULL;
+}
+
+static int _recv(netdev_t *netdev, void *buf, size_t max_len, void *info)
+{
+    (void)info;
+    usbus_cdcncm_device_t *cdcncm = _netdev_to_cdcncm(netdev);
+    const usb_cdcncm_dpe16_t *dpe = _rx_datagram(cdcncm);
+
+    if (!dpe) {
+        return 0;
+    }
+
+    size_t pktlen = dpe->len;
+
+    if (max_len == 0 && buf == NULL) {
+        return pktlen;
+    }
+    /* The frame is consumed, also if it is dropped */
+    cdcncm->rx_dpe += sizeof(*dpe);
+    if (buf == NULL) {
+        return pktlen;
+    }
+    if (pktlen > max_len) {
+        return -ENOBUFS;
+    }
+    /* Copy the frame from the NTB to the netif buffer */
+    memcpy(buf, cdcncm->data_out[cdcncm->rx_cur] + dpe->index, pktlen);
+    return pktlen;
+}
+
+static int _init(netdev_t *netdev)
+{
+    usbus_cdcncm_device_t *cdcncm = _netdev_to_cdcncm(netdev);
+
+    netdev_eui48_get(netdev, (eui48_t *)&cdcncm->mac_netdev);
+
+    /* signal link UP */
+    netdev->event_callback(netdev, NETDEV_EVENT_LINK_UP);
+
+    return 0;
+}
+
+static int _get(netdev_t *netdev, netopt_t opt, void *value, size_t max_len)
+{
+    usbus_cdcncm_device_t *cdcncm = _netdev_to_cdcncm(netdev);
+
+    (void)max_len;
+
+    switch (opt) {
+        case NETOPT_ADDRESS:
+            assert(max_len >= ETHERNET_ADDR_LEN);
+            memcpy(value, cdcncm->mac_netdev, ETHERNET_ADDR_LEN);
+            return ETHERNET_ADDR_LEN;
+        default:
+            return netdev_eth_get(netdev, opt, value, max_len);
+    }
+}
+
+static int _set(netdev_t *netdev, netopt_t opt, const void *value,
+                size_t value_len)
+{
+    usbus_cdcncm_device_t *cdcncm = _netdev_to_cdcncm(netdev);
+
+    switch (opt) {
+        case NETOPT_ADDRESS:
+            assert(value_len == ETHERNET_ADDR_LEN);
+            memcpy(cdcncm->mac_netdev, value, ETHERNET_ADDR_LEN);
+            return ETHERNET_ADDR_LEN;
+        default:
+            return netdev_eth_set(netdev, opt, value, value_len);
+    }
+}
+
+static void _isr(netdev_t *dev)
+{
+    usbus_cdcncm_device_t *cdcncm = _netdev_to_cdcncm(dev);
+
+    if (!cdcncm->rx_ndp) {
+        /* No NTB passed by USBUS */
+        return;
+    }
+    while (_rx_datagram(cdcncm)) {
+        uint16_t dpe = cdcncm->rx_dpe;
+
+        cdcncm->netdev.event_callback(&cdcncm->netdev,
+                                      NETDEV_EVENT_RX_COMPLETE);
+        if (cdcncm->rx_dpe == dpe) {
+            /* Not read by the upper layer, drop it */
+            cdcncm->rx_dpe += sizeof(usb_cdcncm_dpe16_t);
+        }
+    }
+    /* All frames are passed on, the NTB can be reused */
+    cdcncm->rx_ndp = 0;
+    _signal_rx_flush(cdcncm);
+}
+
+static const netdev_driver_t netdev_driver_cdcncm = {
+    .send = _send,
+    .recv = _recv,
+    .init = _init,
+    .isr = _isr,
+    .get = _get,
+    .set = _set,
+};
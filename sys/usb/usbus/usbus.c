@@ -464,8 +464,9 @@ static void *_usbus_thread(void *args)
 
         }
         if (flags & THREAD_FLAG_EVENT) {
-            event_t *event = event_get(&usbus->queue);
-            if (event) {
+            /* The flag is set once for any number of posted events */
+            event_t *event;
+            while ((event = event_get(&usbus->queue))) {
                 event->handler(event);
             }
         }
@@ -24,6 +24,7 @@
 #include <unistd.h> /* for STDIN_FILENO, STDOUT_FILENO, STDERR_FILENO */
 
 #include "atomic_utils.h"
+#include "bitarithm.h"
 #include "clist.h"
 #include "compiler_hints.h"
 #include "container.h"
@@ -33,6 +34,7 @@
 #include "test_utils/expect.h"
 #include "thread.h"
 #include "vfs.h"
+#include "vfs_cache.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -75,6 +77,31 @@ static vfs_file_t _vfs_open_files[VFS_MAX_OPEN_FILES];
  */
 static clist_node_t _vfs_mounts_list;
 
+/**
+ * @internal
+ * @brief Mount point prefix index
+ *
+ * All mounts sorted by decreasing length of the mount point, so that the first
+ * mount point matching a path is the longest matching prefix.
+ */
+static vfs_mount_t *_vfs_mounts_index;
+
+/**
+ * @internal
+ * @brief Sequence counter of the mount point index
+ *
+ * Odd while the index is modified. Path lookups don't take _mount_mutex, but
+ * validate their result against this counter and retry if the index changed
+ * in the meantime.
+ */
+static uint32_t _mount_seq;
+
+/**
+ * @internal
+ * @brief Bitmap of allocated entries in the _vfs_open_files array
+ */
+static uint32_t _vfs_fds_used[(VFS_MAX_OPEN_FILES + 31) / 32];
+
 /**
  * @internal
  * @brief Find an unused entry in the _vfs_open_files array and mark it as used
@@ -83,9 +110,8 @@ static clist_node_t _vfs_mounts_list;
  * corresponding slot in the open files table is already occupied, no iteration
  * is done to find another free number in this case.
  *
- * If the @p fd argument is negative, the algorithm will iterate through the
- * open files table until it find an unused slot and return the number of that
- * slot.
+ * If the @p fd argument is negative, the lowest unused slot is looked up in
+ * the allocation bitmap (one word per 32 slots) and its number is returned.
  *
  * @param[in]  fd  Desired fd number, use VFS_ANY_FD for any free fd
  *
@@ -145,6 +171,33 @@ static inline int _find_mount(vfs_mount_t **mountpp, const char *name, const cha
  */
 static inline int _fd_is_valid(int fd);
 
+/**
+ * @internal
+ * @brief Seek in an open file, using the naive default if the driver does not
+ * implement lseek()
+ */
+static off_t _lseek(vfs_file_t *filp, off_t off, int whence);
+
+/**
+ * @internal
+ * @brief Add a mount to the mount list and the prefix index
+ *
+ * Must be called with _mount_mutex held.
+ *
+ * @param[in]  mountp  mount to add
+ */
+static void _index_insert(vfs_mount_t *mountp);
+
+/**
+ * @internal
+ * @brief Remove a mount from the prefix index
+ *
+ * Must be called with _mount_mutex held and _mount_seq odd.
+ *
+ * @param[in]  mountp  mount to remove
+ */
+static void _index_remove(vfs_mount_t *mountp);
+
 static mutex_t _mount_mutex = MUTEX_INIT;
 static mutex_t _open_mutex = MUTEX_INIT;
 
@@ -156,6 +209,9 @@ int vfs_close(int fd)
         return res;
     }
     vfs_file_t *filp = &_vfs_open_files[fd];
+    if (IS_USED(MODULE_VFS_CACHE)) {
+        vfs_cache_close(fd);
+    }
     if (filp->f_op->close != NULL) {
         /* We will invalidate the fd regardless of the outcome of the file
          * system driver close() call below */
@@ -250,6 +306,19 @@ off_t vfs_lseek(int fd, off_t off, int whence)
         return res;
     }
     vfs_file_t *filp = &_vfs_open_files[fd];
+    if (IS_USED(MODULE_VFS_CACHE)) {
+        vfs_cache_sync(fd, filp);
+        off = _lseek(filp, off, whence);
+        if (off >= 0) {
+            vfs_cache_seek(fd, off);
+        }
+        return off;
+    }
+    return _lseek(filp, off, whence);
+}
+
+static off_t _lseek(vfs_file_t *filp, off_t off, int whence)
+{
     if (filp->f_op->lseek == NULL) {
         /* driver does not implement lseek() */
         /* default seek functionality is naive */
@@ -313,6 +382,9 @@ int vfs_open(const char *name, int flags, mode_t mode)
             return res;
         }
     }
+    if (IS_USED(MODULE_VFS_CACHE)) {
+        vfs_cache_open(fd, mountp, rel_path, flags);
+    }
     DEBUG("vfs_open: opened %d\n", fd);
     return fd;
 }
@@ -342,6 +414,14 @@ static inline int _prep_read(int fd, const void *dest, vfs_file_t **filp)
     return 0;
 }
 
+static inline ssize_t _read(int fd, vfs_file_t *filp, void *dest, size_t count)
+{
+    if (IS_USED(MODULE_VFS_CACHE)) {
+        return vfs_cache_read(fd, filp, dest, count);
+    }
+    return filp->f_op->read(filp, dest, count);
+}
+
 ssize_t vfs_read(int fd, void *dest, size_t count)
 {
     DEBUG("vfs_read: %d, %p, %" PRIuSIZE "\n", fd, dest, count);
@@ -353,7 +433,91 @@ ssize_t vfs_read(int fd, void *dest, size_t count)
         return res;
     }
 
-    return filp->f_op->read(filp, dest, count);
+    return _read(fd, filp, dest, count);
+}
+
+ssize_t vfs_read_iol(int fd, iolist_t *iol, void *buf, size_t count)
+{
+    DEBUG("vfs_read_iol: %d, %p, %p, %" PRIuSIZE "\n", fd, (void *)iol, buf, count);
+    vfs_file_t *filp = NULL;
+
+    int res = _prep_read(fd, buf, &filp);
+    if (res) {
+        DEBUG("vfs_read_iol: can't open file - %d\n", res);
+        return res;
+    }
+
+    if (filp->f_op->read_iol != NULL) {
+        if (IS_USED(MODULE_VFS_CACHE)) {
+            vfs_cache_sync(fd, filp);
+        }
+        ssize_t nbytes = filp->f_op->read_iol(filp, iol, count);
+        if (nbytes != -ENOTSUP) {
+            if (IS_USED(MODULE_VFS_CACHE) && (nbytes > 0)) {
+                vfs_cache_skip(fd, nbytes);
+            }
+            return nbytes;
+        }
+    }
+
+    /* fall back to copying */
+    ssize_t nbytes = _read(fd, filp, buf, count);
+    if (nbytes >= 0) {
+        iol->iol_base = buf;
+        iol->iol_len = nbytes;
+    }
+    return nbytes;
+}
+
+ssize_t vfs_mmap(int fd, off_t off, size_t len, void *buf, const void **addr)
+{
+    DEBUG("vfs_mmap: %d, %ld, %" PRIuSIZE ", %p\n", fd, (long)off, len, buf);
+    vfs_file_t *filp = NULL;
+
+    int res = _prep_read(fd, addr, &filp);
+    if (res) {
+        DEBUG("vfs_mmap: can't open file - %d\n", res);
+        return res;
+    }
+    if (off < 0) {
+        return -EINVAL;
+    }
+
+    if (filp->f_op->mmap != NULL) {
+        ssize_t nbytes = filp->f_op->mmap(filp, off, len, addr);
+        if (nbytes != -ENOTSUP) {
+            return nbytes;
+        }
+    }
+    if (buf == NULL) {
+        return -ENOTSUP;
+    }
+
+    /* fall back to reading, restoring the file position afterwards */
+    off_t pos = vfs_lseek(fd, 0, SEEK_CUR);
+    if (pos < 0) {
+        return pos;
+    }
+    off = vfs_lseek(fd, off, SEEK_SET);
+    if (off < 0) {
+        return off;
+    }
+    size_t done = 0;
+    while (done < len) {
+        ssize_t nbytes = vfs_read(fd, (uint8_t *)buf + done, len - done);
+        if (nbytes < 0) {
+            vfs_lseek(fd, pos, SEEK_SET);
+            return nbytes;
+        }
+        if (nbytes == 0) {
+            break;
+        }
+        done += nbytes;
+    }
+    vfs_lseek(fd, pos, SEEK_SET);
+
+    *addr = buf;
+    return done;
 }
 
 ssize_t vfs_readline(int fd, char *dst, size_t len_max)
@@ -369,7 +533,7 @@ ssize_t vfs_readline(int fd, char *dst, size_t len_max)
 
     const char *start = dst;
     while (len_max) {
-        int res = filp->f_op->read(filp, dst, 1);
+        int res = _read(fd, filp, dst, 1);
         if (res < 0) {
             break;
         }
@@ -410,7 +574,11 @@ ssize_t vfs_write(int fd, const void *src, size_t count)
         /* driver does not implement write() */
         return -EINVAL;
     }
-    return filp->f_op->write(filp, src, count);
+    ssize_t written = filp->f_op->write(filp, src, count);
+    if (IS_USED(MODULE_VFS_CACHE) && (written > 0)) {
+        vfs_cache_write(fd);
+    }
+    return written;
 }
 
 ssize_t vfs_write_iol(int fd, const iolist_t *snips)
@@ -571,7 +739,11 @@ int vfs_format(vfs_mount_t *mountp)
 
     if (mountp->fs->fs_op != NULL) {
         if (mountp->fs->fs_op->format != NULL) {
-            return mountp->fs->fs_op->format(mountp);
+            ret = mountp->fs->fs_op->format(mountp);
+            if (IS_USED(MODULE_VFS_CACHE)) {
+                vfs_cache_invalidate_mount(mountp);
+            }
+            return ret;
         }
     }
 
@@ -598,8 +770,7 @@ int vfs_mount(vfs_mount_t *mountp)
             }
         }
     }
-    /* Insert last in list. This property is relied on by vfs_iterate_mount_dirs. */
-    clist_rpush(&_vfs_mounts_list, &mountp->list_entry);
+    _index_insert(mountp);
     mutex_unlock(&_mount_mutex);
     DEBUG("vfs_mount: mount done\n");
     return 0;
@@ -623,7 +794,11 @@ int vfs_umount(vfs_mount_t *mountp, bool force)
     }
     DEBUG("vfs_umount: -> \"%s\" open=%u\n", mountp->mount_point,
           (unsigned)atomic_load_u16(&mountp->open_files));
+    /* Lookups running concurrently retry once the sequence counter changed,
+     * so no new reference can be taken after the check below */
+    atomic_store_u32(&_mount_seq, _mount_seq + 1);
     if (atomic_load_u16(&mountp->open_files) > 0 && !force) {
+        atomic_store_u32(&_mount_seq, _mount_seq + 1);
         mutex_unlock(&_mount_mutex);
         return -EBUSY;
     }
@@ -633,13 +808,19 @@ int vfs_umount(vfs_mount_t *mountp, bool force)
             if (res < 0) {
                 /* umount failed */
                 DEBUG("vfs_umount: ERR %d!\n", res);
+                atomic_store_u32(&_mount_seq, _mount_seq + 1);
                 mutex_unlock(&_mount_mutex);
                 return res;
             }
         }
     }
     /* find mountp in the list and remove it */
+    _index_remove(mountp);
+    if (IS_USED(MODULE_VFS_CACHE)) {
+        vfs_cache_invalidate_mount(mountp);
+    }
     clist_node_t *node = clist_remove(&_vfs_mounts_list, &mountp->list_entry);
+    atomic_store_u32(&_mount_seq, _mount_seq + 1);
     if (node == NULL) {
         /* not found */
         DEBUG("vfs_umount: ERR not mounted!\n");
@@ -696,6 +877,10 @@ int vfs_rename(const char *from_path, const char *to_path)
         return -EXDEV;
     }
     res = mountp->fs->fs_op->rename(mountp, rel_from, rel_to);
+    if (IS_USED(MODULE_VFS_CACHE)) {
+        vfs_cache_invalidate_path(mountp, rel_from);
+        vfs_cache_invalidate_path(mountp, rel_to);
+    }
     DEBUG("vfs_rename: rename %p, \"%s\" -> \"%s\"", (void *)mountp, rel_from, rel_to);
     if (res < 0) {
         /* something went wrong during rename */
@@ -739,6 +924,9 @@ int vfs_unlink(const char *name)
         return -EROFS;
     }
     res = mountp->fs->fs_op->unlink(mountp, rel_path);
+    if (IS_USED(MODULE_VFS_CACHE)) {
+        vfs_cache_invalidate_path(mountp, rel_path);
+    }
     DEBUG("vfs_unlink: unlink %p, \"%s\"", (void *)mountp, rel_path);
     if (res < 0) {
         /* something went wrong during unlink */
@@ -1064,15 +1252,19 @@ const vfs_file_t *vfs_file_get(int fd)
 static inline int _allocate_fd(int fd)
 {
     if (fd < 0) {
-        for (fd = 0; fd < VFS_MAX_OPEN_FILES; ++fd) {
-            if ((fd == STDIN_FILENO) || (fd == STDOUT_FILENO) || (fd == STDERR_FILENO)) {
+        fd = VFS_MAX_OPEN_FILES;
+        for (unsigned i = 0; i < ARRAY_SIZE(_vfs_fds_used); i++) {
+            uint32_t unused = ~_vfs_fds_used[i];
+            if (i == 0) {
                 /* Do not auto-allocate the stdio file descriptor numbers to
                  * avoid conflicts between normal file system users and stdio
                  * drivers such as stdio_uart, stdio_rtt which need to be able
                  * to bind to these specific file descriptor numbers. */
-                continue;
+                unused &= ~((1UL << STDIN_FILENO) | (1UL << STDOUT_FILENO) |
+                            (1UL << STDERR_FILENO));
             }
-            if (_vfs_open_files[fd].pid == KERNEL_PID_UNDEF) {
+            if (unused) {
+                fd = i * 32 + bitarithm_lsb(unused);
                 break;
             }
         }
@@ -1092,6 +1284,7 @@ static inline int _allocate_fd(int fd)
         pid = -1;
     }
     _vfs_open_files[fd].pid = pid;
+    _vfs_fds_used[fd / 32] |= 1UL << (fd % 32);
     return fd;
 }
 
@@ -1102,7 +1295,10 @@ static inline void _free_fd(int fd)
         uint16_t before = atomic_fetch_sub_u16(&_vfs_open_files[fd].mp->open_files, 1);
         assume(before > 0);
     }
+    mutex_lock(&_open_mutex);
     _vfs_open_files[fd].pid = KERNEL_PID_UNDEF;
+    _vfs_fds_used[fd / 32] &= ~(1UL << (fd % 32));
+    mutex_unlock(&_open_mutex);
 }
 
 static inline int _init_fd(int fd, const vfs_file_ops_t *f_op, vfs_mount_t *mountp, int flags, void *private_data)
@@ -1120,27 +1316,10 @@ static inline int _init_fd(int fd, const vfs_file_ops_t *f_op, vfs_mount_t *moun
     return fd;
 }
 
-static inline int _find_mount(vfs_mount_t **mountpp, const char *name, const char **rel_path)
+static vfs_mount_t *_lookup_mount(const char *name, size_t name_len)
 {
-    size_t longest_match = 0;
-    size_t name_len = strlen(name);
-    mutex_lock(&_mount_mutex);
-
-    clist_node_t *node = _vfs_mounts_list.next;
-    if (node == NULL) {
-        /* list empty */
-        mutex_unlock(&_mount_mutex);
-        return -ENOENT;
-    }
-    vfs_mount_t *mountp = NULL;
-    do {
-        node = node->next;
-        vfs_mount_t *it = container_of(node, vfs_mount_t, list_entry);
+    for (vfs_mount_t *it = _vfs_mounts_index; it; it = it->index_next) {
         size_t len = it->mount_point_len;
-        if (len < longest_match) {
-            /* Already found a longer prefix */
-            continue;
-        }
         if (len > name_len) {
             /* path name is shorter than the mount point name */
             continue;
@@ -1149,40 +1328,94 @@ static inline int _find_mount(vfs_mount_t **mountpp, const char *name, const cha
             /* name does not have a directory separator where mount point name ends */
             continue;
         }
-        if (strncmp(name, it->mount_point, len) == 0) {
-            /* mount_point is a prefix of name */
-            /* special check for mount_point == "/" */
-            if (len > 1) {
-                longest_match = len;
+        if (memcmp(name, it->mount_point, len) == 0) {
+            /* mount_point is a prefix of name, and as the index is sorted by
+             * length the longest one */
+            return it;
+        }
+    }
+    return NULL;
+}
+
+static inline int _find_mount(vfs_mount_t **mountpp, const char *name, const char **rel_path)
+{
+    size_t name_len = strlen(name);
+    vfs_mount_t *mountp;
+
+    while (1) {
+        uint32_t seq = atomic_load_u32(&_mount_seq);
+        if (seq & 1) {
+            /* index is being modified, wait for the writer to finish */
+            mutex_lock(&_mount_mutex);
+            mutex_unlock(&_mount_mutex);
+            continue;
+        }
+
+        mountp = _lookup_mount(name, name_len);
+        if (mountp == NULL) {
+            if (atomic_load_u32(&_mount_seq) != seq) {
+                continue;
             }
-            mountp = it;
+            /* not found */
+            return -ENOENT;
         }
-    } while (node != _vfs_mounts_list.next);
-    if (mountp == NULL) {
-        /* not found */
-        mutex_unlock(&_mount_mutex);
-        return -ENOENT;
+
+        /* Increment open files counter for this mount */
+        uint16_t before = atomic_fetch_add_u16(&mountp->open_files, 1);
+        /* We cannot use assume() here, an overflow could occur in absence of
+         * any bugs and should also be checked for in production code. We use
+         * expect() here, which was actually written for unit tests but works
+         * here as well */
+        expect(before < UINT16_MAX);
+
+        /* the reference keeps the mount alive if no unmount started since
+         * the lookup began */
+        if (atomic_load_u32(&_mount_seq) == seq) {
+            break;
+        }
+        before = atomic_fetch_sub_u16(&mountp->open_files, 1);
+        assume(before > 0);
     }
-    /* Increment open files counter for this mount */
-    uint16_t before = atomic_fetch_add_u16(&mountp->open_files, 1);
-    /* We cannot use assume() here, an overflow could occur in absence of
-     * any bugs and should also be checked for in production code. We use
-     * expect() here, which was actually written for unit tests but works
-     * here as well */
-    expect(before < UINT16_MAX);
-    mutex_unlock(&_mount_mutex);
     *mountpp = mountp;
 
     if (rel_path != NULL) {
-        if (mountp->fs->flags & VFS_FS_FLAG_WANT_ABS_PATH) {
+        if ((mountp->fs->flags & VFS_FS_FLAG_WANT_ABS_PATH) ||
+            (mountp->mount_point_len == 1)) {
+            /* special case for mount_point == "/" */
             *rel_path = name;
         } else {
-            *rel_path = name + longest_match;
+            *rel_path = name + mountp->mount_point_len;
         }
     }
     return 0;
 }
 
+static void _index_insert(vfs_mount_t *mountp)
+{
+    vfs_mount_t **it = &_vfs_mounts_index;
+
+    while (*it && ((*it)->mount_point_len >= mountp->mount_point_len)) {
+        it = &(*it)->index_next;
+    }
+
+    atomic_store_u32(&_mount_seq, _mount_seq + 1);
+    mountp->index_next = *it;
+    *it = mountp;
+    /* Insert last in list. This property is relied on by vfs_iterate_mount_dirs. */
+    clist_rpush(&_vfs_mounts_list, &mountp->list_entry);
+    atomic_store_u32(&_mount_seq, _mount_seq + 1);
+}
+
+static void _index_remove(vfs_mount_t *mountp)
+{
+    for (vfs_mount_t **it = &_vfs_mounts_index; *it; it = &(*it)->index_next) {
+        if (*it == mountp) {
+            *it = mountp->index_next;
+            break;
+        }
+    }
+}
+
 static inline int _fd_is_valid(int fd)
 {
     if ((unsigned int)fd >= VFS_MAX_OPEN_FILES) {
@@ -0,0 +1,524 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for more
+ * details.
+ */
+
+/**
+ * @ingroup     sys_vfs_cache
+ * @{
+ *
+ * @file
+ * @brief       VFS page cache implementation
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "macros/utils.h"
+#include "mutex.h"
+#include "vfs_cache.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static_assert(CONFIG_VFS_CACHE_PAGE_SIZE <= UINT16_MAX,
+              "CONFIG_VFS_CACHE_PAGE_SIZE too large");
+static_assert(VFS_CACHE_PAGES > CONFIG_VFS_CACHE_READAHEAD,
+              "CONFIG_VFS_CACHE_SIZE must hold more pages than read ahead");
+static_assert(CONFIG_VFS_CACHE_FILES < UINT8_MAX,
+              "CONFIG_VFS_CACHE_FILES too large");
+
+/* reads of this fd go through the cache */
+#define FD_CACHED       (0x1)
+/* fd is open for writing, but not attached to a file entry */
+#define FD_BLIND        (0x2)
+
+/* a file that may have pages in the cache */
+typedef struct {
+    const vfs_mount_t *mp;          /* NULL if unused */
+    off_t next;                     /* end of the last read, to detect sequential access */
+    uint32_t used;                  /* LRU stamp */
+    uint8_t refs;                   /* number of open fds */
+    bool detached;                  /* path no longer refers to this file */
+    char path[CONFIG_VFS_CACHE_PATH_MAX];
+} _file_t;
+
+/* cache state of an open fd */
+typedef struct {
+    uint8_t file;                   /* file entry index + 1, 0 if not attached */
+    uint8_t flags;
+    off_t pos;                      /* file position seen by the user */
+    off_t fs_pos;                   /* file position of the file system driver */
+} _fd_t;
+
+typedef struct {
+    uint32_t page;                  /* page number within the file */
+    uint32_t used;                  /* LRU stamp */
+    uint16_t len;                   /* valid bytes, less than a page at EOF */
+    uint8_t file;                   /* file entry index + 1, 0 if unused */
+    bool busy;                      /* being filled without holding the lock */
+    uint8_t data[CONFIG_VFS_CACHE_PAGE_SIZE];
+} _page_t;
+
+static mutex_t _lock = MUTEX_INIT;
+static _file_t _files[CONFIG_VFS_CACHE_FILES];
+static _fd_t _fds[VFS_MAX_OPEN_FILES];
+static _page_t _pages[VFS_CACHE_PAGES];
+static uint32_t _clock;
+static uint32_t _gen;               /* incremented whenever pages are dropped */
+static unsigned _blind_writers;
+static vfs_cache_stats_t _stats;
+
+static void _drop_pages(unsigned file)
+{
+    _gen++;
+    for (unsigned i = 0; i < ARRAY_SIZE(_pages); i++) {
+        if (_pages[i].file == file + 1) {
+            _pages[i].file = 0;
+        }
+    }
+    _files[file].next = 0;
+}
+
+static void _drop_all(void)
+{
+    _gen++;
+    for (unsigned i = 0; i < ARRAY_SIZE(_pages); i++) {
+        _pages[i].file = 0;
+    }
+}
+
+static void _invalidate(unsigned file)
+{
+    _drop_pages(file);
+    if (_files[file].refs) {
+        /* open fds keep using the entry, but it must not be found by path */
+        _files[file].detached = true;
+    }
+    else {
+        _files[file].mp = NULL;
+    }
+}
+
+static int _file_find(const vfs_mount_t *mp, const char *path)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_files); i++) {
+        if ((_files[i].mp == mp) && !_files[i].detached &&
+            (strcmp(_files[i].path, path) == 0)) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static int _file_alloc(void)
+{
+    int lru = -1;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_files); i++) {
+        if (_files[i].mp == NULL) {
+            return i;
+        }
+        if (_files[i].refs) {
+            continue;
+        }
+        if ((lru < 0) || ((int32_t)(_files[i].used - _files[lru].used) < 0)) {
+            lru = i;
+        }
+    }
+    if (lru >= 0) {
+        _drop_pages(lru);
+        _files[lru].mp = NULL;
+    }
+    return lru;
+}
+
+static _page_t *_page_find(unsigned file, uint32_t page)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_pages); i++) {
+        if ((_pages[i].file == file + 1) && (_pages[i].page == page)) {
+            _pages[i].used = ++_clock;
+            return &_pages[i];
+        }
+    }
+    return NULL;
+}
+
+static _page_t *_page_alloc(void)
+{
+    _page_t *lru = NULL;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_pages); i++) {
+        if (_pages[i].busy) {
+            continue;
+        }
+        if (_pages[i].file == 0) {
+            return &_pages[i];
+        }
+        if ((lru == NULL) || ((int32_t)(_pages[i].used - lru->used) < 0)) {
+            lru = &_pages[i];
+        }
+    }
+    return lru;
+}
+
+static int _fs_seek(_fd_t *fdp, vfs_file_t *filp, off_t pos)
+{
+    if (fdp->fs_pos == pos) {
+        return 0;
+    }
+    if (filp->f_op->lseek) {
+        off_t res = filp->f_op->lseek(filp, pos, SEEK_SET);
+        if (res < 0) {
+            return res;
+        }
+    }
+    else {
+        filp->pos = pos;
+    }
+    fdp->fs_pos = pos;
+    return 0;
+}
+
+/* Reads from the file system at the user position of @p fdp. Called with the
+ * lock held, which is released during the read. */
+static ssize_t _read_direct(_fd_t *fdp, vfs_file_t *filp, void *dest, size_t len)
+{
+    mutex_unlock(&_lock);
+    ssize_t res = _fs_seek(fdp, filp, fdp->pos);
+    if (res == 0) {
+        res = filp->f_op->read(filp, dest, len);
+    }
+    mutex_lock(&_lock);
+
+    if (res < 0) {
+        /* position of the driver is unknown now */
+        fdp->fs_pos = -1;
+        return res;
+    }
+    fdp->fs_pos += res;
+    return res;
+}
+
+/* Reads a page from the file system. Called with the lock held, which is
+ * released during the read. Returns NULL with *err = -EBUSY if all pages are
+ * being filled. The page is not cached if its file was written to in the
+ * meantime, but its data stays valid until the lock is released. */
+static _page_t *_fill(_fd_t *fdp, vfs_file_t *filp, uint32_t page, int *err)
+{
+    _page_t *p = _page_alloc();
+    if (p == NULL) {
+        *err = -EBUSY;
+        return NULL;
+    }
+    p->file = 0;
+    p->busy = true;
+    uint32_t gen = _gen;
+    mutex_unlock(&_lock);
+
+    size_t len = 0;
+    *err = _fs_seek(fdp, filp, (off_t)page * CONFIG_VFS_CACHE_PAGE_SIZE);
+    while ((*err == 0) && (len < CONFIG_VFS_CACHE_PAGE_SIZE)) {
+        ssize_t res = filp->f_op->read(filp, &p->data[len],
+                                       CONFIG_VFS_CACHE_PAGE_SIZE - len);
+        if (res < 0) {
+            /* position of the driver is unknown now */
+            fdp->fs_pos = -1;
+            *err = res;
+        }
+        else if (res == 0) {
+            break;
+        }
+        else {
+            len += res;
+        }
+    }
+
+    mutex_lock(&_lock);
+    p->busy = false;
+    if (*err < 0) {
+        return NULL;
+    }
+    fdp->fs_pos += len;
+    p->len = len;
+    p->page = page;
+    p->used = ++_clock;
+    /* another reader may have filled the same page concurrently */
+    if ((gen == _gen) && !_page_find(fdp->file - 1, page)) {
+        p->file = fdp->file;
+    }
+    return p;
+}
+
+static void _readahead(_fd_t *fdp, vfs_file_t *filp, uint32_t page)
+{
+    for (unsigned i = 1; i <= CONFIG_VFS_CACHE_READAHEAD; i++) {
+        if (_page_find(fdp->file - 1, page + i)) {
+            continue;
+        }
+        int err;
+        _page_t *p = _fill(fdp, filp, page + i, &err);
+        if (p == NULL) {
+            return;
+        }
+        _stats.readahead++;
+        if (p->len < CONFIG_VFS_CACHE_PAGE_SIZE) {
+            /* end of file */
+            return;
+        }
+    }
+}
+
+void vfs_cache_open(int fd, const vfs_mount_t *mp, const char *rel_path, int flags)
+{
+    _fd_t *fdp = &_fds[fd];
+    bool writable = (flags & O_ACCMODE) != O_RDONLY;
+    int file = -1;
+
+    mutex_lock(&_lock);
+    memset(fdp, 0, sizeof(*fdp));
+
+    if (strlen(rel_path) < CONFIG_VFS_CACHE_PATH_MAX) {
+        file = _file_find(mp, rel_path);
+        /* while a writer without file entry exists, new entries could be
+         * for the file it is writing to */
+        if ((file < 0) && (writable || (_blind_writers == 0))) {
+            file = _file_alloc();
+            if (file >= 0) {
+                _files[file].mp = mp;
+                _files[file].next = 0;
+                _files[file].detached = false;
+                strcpy(_files[file].path, rel_path);
+            }
+        }
+    }
+
+    if (file < 0) {
+        if (writable) {
+            /* writes can't be attributed to a file, so they drop everything */
+            fdp->flags = FD_BLIND;
+            _blind_writers++;
+            if (flags & O_TRUNC) {
+                _drop_all();
+            }
+        }
+        mutex_unlock(&_lock);
+        return;
+    }
+
+    DEBUG("vfs_cache_open: %d -> %d \"%s\"\n", fd, file, rel_path);
+    _files[file].refs++;
+    _files[file].used = ++_clock;
+    fdp->file = file + 1;
+    if (!writable) {
+        fdp->flags = FD_CACHED;
+    }
+    else if (flags & O_TRUNC) {
+        _drop_pages(file);
+    }
+    mutex_unlock(&_lock);
+}
+
+void vfs_cache_close(int fd)
+{
+    _fd_t *fdp = &_fds[fd];
+
+    mutex_lock(&_lock);
+    if (fdp->flags & FD_BLIND) {
+        _blind_writers--;
+    }
+    if (fdp->file) {
+        _file_t *f = &_files[fdp->file - 1];
+        f->refs--;
+        if ((f->refs == 0) && f->detached) {
+            f->mp = NULL;
+        }
+    }
+    memset(fdp, 0, sizeof(*fdp));
+    mutex_unlock(&_lock);
+}
+
+ssize_t vfs_cache_read(int fd, vfs_file_t *filp, void *dest, size_t count)
+{
+    _fd_t *fdp = &_fds[fd];
+
+    if (!(fdp->flags & FD_CACHED)) {
+        return filp->f_op->read(filp, dest, count);
+    }
+
+    mutex_lock(&_lock);
+    unsigned file = fdp->file - 1;
+    bool sequential = fdp->pos == _files[file].next;
+    uint8_t *dst = dest;
+    size_t done = 0;
+    int err = 0;
+
+    while (done < count) {
+        uint32_t page = fdp->pos / CONFIG_VFS_CACHE_PAGE_SIZE;
+        size_t off = fdp->pos % CONFIG_VFS_CACHE_PAGE_SIZE;
+        bool miss = false;
+
+        _page_t *p = _page_find(file, page);
+        if ((p == NULL) && (off == 0) &&
+            (count - done >= CONFIG_VFS_CACHE_PAGE_SIZE)) {
+            /* large reads don't benefit from the cache */
+            size_t len = count - done;
+            len -= len % CONFIG_VFS_CACHE_PAGE_SIZE;
+            ssize_t res = _read_direct(fdp, filp, &dst[done], len);
+            if (res < 0) {
+                err = res;
+                break;
+            }
+            done += res;
+            fdp->pos += res;
+            if ((size_t)res < len) {
+                break;
+            }
+            continue;
+        }
+        if (p == NULL) {
+            p = _fill(fdp, filp, page, &err);
+            if ((p == NULL) && (err == -EBUSY)) {
+                /* all pages are being filled by other readers */
+                size_t len = MIN(CONFIG_VFS_CACHE_PAGE_SIZE - off, count - done);
+                ssize_t res = _read_direct(fdp, filp, &dst[done], len);
+                if (res <= 0) {
+                    err = res;
+                    break;
+                }
+                done += res;
+                fdp->pos += res;
+                continue;
+            }
+            if (p == NULL) {
+                break;
+            }
+            miss = true;
+            _stats.misses++;
+        }
+        else {
+            _stats.hits++;
+        }
+
+        if (off >= p->len) {
+            /* end of file */
+            break;
+        }
+        size_t len = MIN(p->len - off, count - done);
+        memcpy(&dst[done], &p->data[off], len);
+        done += len;
+        fdp->pos += len;
+
+        if (miss && sequential && (p->len == CONFIG_VFS_CACHE_PAGE_SIZE)) {
+            _readahead(fdp, filp, page);
+        }
+    }
+    _files[file].next = fdp->pos;
+    _files[file].used = ++_clock;
+    mutex_unlock(&_lock);
+
+    if ((done == 0) && (err < 0)) {
+        return err;
+    }
+    return done;
+}
+
+void vfs_cache_sync(int fd, vfs_file_t *filp)
+{
+    _fd_t *fdp = &_fds[fd];
+
+    if (!(fdp->flags & FD_CACHED)) {
+        return;
+    }
+    /* the position is only used by the thread operating on the fd */
+    _fs_seek(fdp, filp, fdp->pos);
+}
+
+void vfs_cache_seek(int fd, off_t pos)
+{
+    _fd_t *fdp = &_fds[fd];
+
+    if (!(fdp->flags & FD_CACHED)) {
+        return;
+    }
+    mutex_lock(&_lock);
+    fdp->pos = pos;
+    fdp->fs_pos = pos;
+    mutex_unlock(&_lock);
+}
+
+void vfs_cache_skip(int fd, size_t count)
+{
+    _fd_t *fdp = &_fds[fd];
+
+    if (!(fdp->flags & FD_CACHED)) {
+        return;
+    }
+    mutex_lock(&_lock);
+    fdp->pos += count;
+    fdp->fs_pos = fdp->pos;
+    mutex_unlock(&_lock);
+}
+
+void vfs_cache_write(int fd)
+{
+    _fd_t *fdp = &_fds[fd];
+
+    /* no cache state, e.g. stdio: don't lock, this may run in an ISR */
+    if (!(fdp->flags & FD_BLIND) && !fdp->file) {
+        return;
+    }
+    mutex_lock(&_lock);
+    if (fdp->flags & FD_BLIND) {
+        _drop_all();
+    }
+    else if (fdp->file) {
+        _drop_pages(fdp->file - 1);
+    }
+    mutex_unlock(&_lock);
+}
+
+void vfs_cache_invalidate_path(const vfs_mount_t *mp, const char *rel_path)
+{
+    mutex_lock(&_lock);
+    int file = _file_find(mp, rel_path);
+    if (file >= 0) {
+        _invalidate(file);
+    }
+    mutex_unlock(&_lock);
+}
+
+void vfs_cache_invalidate_mount(const vfs_mount_t *mp)
+{
+    mutex_lock(&_lock);
+    for (unsigned i = 0; i < ARRAY_SIZE(_files); i++) {
+        if (_files[i].mp == mp) {
+            _invalidate(i);
+        }
+    }
+    mutex_unlock(&_lock);
+}
+
+void vfs_cache_drop(void)
+{
+    mutex_lock(&_lock);
+    _drop_all();
+    mutex_unlock(&_lock);
+}
+
+void vfs_cache_stats(vfs_cache_stats_t *stats)
+{
+    mutex_lock(&_lock);
+    *stats = _stats;
+    mutex_unlock(&_lock);
+}
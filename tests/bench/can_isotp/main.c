@@ -0,0 +1,236 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for ISO-TP transfers
+ *
+ * Two ISO-TP connections exchange messages of @ref MSG_LEN bytes over a mocked
+ * CAN device that confirms every frame right away and loops it back as
+ * received frame. The receiver requests BS = 0 and STmin = 0. The messages
+ * are received with conn_can_isotp_recv(), then with
+ * conn_can_isotp_recv_buf(). A last run with BS = 2 and STmin = 100 us
+ * covers the sender pacing the consecutive frames with a timer.
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "can/candev.h"
+#include "can/conn/isotp.h"
+#include "can/device.h"
+#include "can/dll.h"
+#include "can/isotp.h"
+#include "mutex.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "timex.h"
+#include "ztimer.h"
+
+/* messages per measurement */
+#ifndef TRANSFERS
+#define TRANSFERS       (100U)
+#endif
+
+/* largest ISO-TP message */
+#define MSG_LEN         (4095U)
+
+#define SENDER_ID       (0x700U)
+#define RECEIVER_ID     (0x708U)
+
+/* frames handed to the mocked device and not looped back yet */
+#define LOOPBACK_NUMOF  (8U)
+
+static char _candev_stack[THREAD_STACKSIZE_DEFAULT];
+static char _isotp_stack[THREAD_STACKSIZE_DEFAULT];
+static char _sender_stack[THREAD_STACKSIZE_DEFAULT];
+
+static const struct can_frame *_loopback[LOOPBACK_NUMOF];
+static unsigned _loopback_head;
+static unsigned _loopback_len;
+
+static conn_can_isotp_t _tx_conn;
+static conn_can_isotp_t _rx_conn;
+static uint8_t _data[MSG_LEN];
+static uint8_t _buf[MSG_LEN];
+static mutex_t _start = MUTEX_INIT_LOCKED;
+
+static int _send(candev_t *dev, const struct can_frame *frame)
+{
+    if (_loopback_len == LOOPBACK_NUMOF) {
+        return -EBUSY;
+    }
+    _loopback[(_loopback_head + _loopback_len++) % LOOPBACK_NUMOF] = frame;
+    dev->event_callback(dev, CANDEV_EVENT_ISR, NULL);
+    return 0;
+}
+
+static void _isr(candev_t *dev)
+{
+    while (_loopback_len > 0) {
+        const struct can_frame *frame = _loopback[_loopback_head];
+        struct can_frame rx = *frame;
+
+        _loopback_head = (_loopback_head + 1) % LOOPBACK_NUMOF;
+        _loopback_len--;
+        /* frame belongs to the DLL, it is freed by the confirmation */
+        dev->event_callback(dev, CANDEV_EVENT_TX_CONFIRMATION, (void *)frame);
+        dev->event_callback(dev, CANDEV_EVENT_RX_INDICATION, &rx);
+    }
+}
+
+static int _abort(candev_t *dev, const struct can_frame *frame)
+{
+    (void)dev;
+    (void)frame;
+    return -ENOTSUP;
+}
+
+static int _init(candev_t *dev)
+{
+    (void)dev;
+    return 0;
+}
+
+static int _get(candev_t *dev, canopt_t opt, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)opt;
+    (void)value;
+    (void)max_len;
+    return -ENOTSUP;
+}
+
+static int _set(candev_t *dev, canopt_t opt, void *value, size_t value_len)
+{
+    (void)dev;
+    (void)value;
+    (void)value_len;
+    return (opt == CANOPT_STATE) ? 0 : -ENOTSUP;
+}
+
+static int _set_filter(candev_t *dev, const struct can_filter *filter)
+{
+    (void)dev;
+    (void)filter;
+    return 0;
+}
+
+static int _remove_filter(candev_t *dev, const struct can_filter *filter)
+{
+    (void)dev;
+    (void)filter;
+    return 0;
+}
+
+static const candev_driver_t _loopback_driver = {
+    .send = _send,
+    .abort = _abort,
+    .init = _init,
+    .isr = _isr,
+    .get = _get,
+    .set = _set,
+    .set_filter = _set_filter,
+    .remove_filter = _remove_filter,
+};
+
+static candev_t _candev = { .driver = &_loopback_driver };
+static candev_dev_t _candev_dev = { .dev = &_candev, .name = "loopback" };
+
+static void *_sender(void *arg)
+{
+    (void)arg;
+    while (1) {
+        mutex_lock(&_start);
+        for (unsigned i = 0; i < TRANSFERS; i++) {
+            _data[0] = i;
+            expect(conn_can_isotp_send(&_tx_conn, _data, sizeof(_data), 0) ==
+                   sizeof(_data));
+        }
+    }
+    return NULL;
+}
+
+static void _bind(conn_can_isotp_t *conn, canid_t tx_id, canid_t rx_id,
+                  uint8_t bs, uint8_t stmin)
+{
+    struct isotp_options opt = { .tx_id = tx_id, .rx_id = rx_id };
+    struct isotp_fc_options fc = { .bs = bs, .stmin = stmin };
+
+    expect(conn_can_isotp_create(conn, &opt, 0) == 0);
+    expect(conn_can_isotp_bind(conn, &fc) == 0);
+}
+
+static void _print(const char *name, uint32_t time)
+{
+    printf("%-10s: %8lu bytes/s\n", name,
+           (unsigned long)((uint64_t)TRANSFERS * MSG_LEN * US_PER_SEC / time));
+}
+
+int main(void)
+{
+    uint32_t start;
+
+    for (unsigned i = 0; i < MSG_LEN; i++) {
+        _data[i] = i;
+    }
+
+    can_dll_init();
+    isotp_init(_isotp_stack, sizeof(_isotp_stack), THREAD_PRIORITY_MAIN - 2,
+               "isotp");
+    can_device_init(_candev_stack, sizeof(_candev_stack),
+                    THREAD_PRIORITY_MAIN - 3, "loopback", &_candev_dev);
+    _bind(&_tx_conn, SENDER_ID, RECEIVER_ID, 0, 0);
+    _bind(&_rx_conn, RECEIVER_ID, SENDER_ID, 0, 0);
+    thread_create(_sender_stack, sizeof(_sender_stack),
+                  THREAD_PRIORITY_MAIN + 1, 0, _sender, NULL, "sender");
+
+    start = ztimer_now(ZTIMER_USEC);
+    mutex_unlock(&_start);
+    for (unsigned i = 0; i < TRANSFERS; i++) {
+        expect(conn_can_isotp_recv(&_rx_conn, _buf, sizeof(_buf), 0) == MSG_LEN);
+        expect((_buf[0] == (uint8_t)i) && (_buf[MSG_LEN - 1] == (uint8_t)(MSG_LEN - 1)));
+    }
+    _print("recv", ztimer_now(ZTIMER_USEC) - start);
+
+    start = ztimer_now(ZTIMER_USEC);
+    mutex_unlock(&_start);
+    for (unsigned i = 0; i < TRANSFERS; i++) {
+        void *buf_ctx = NULL;
+        uint8_t *data;
+
+        expect(conn_can_isotp_recv_buf(&_rx_conn, (void **)&data, &buf_ctx, 0) ==
+               MSG_LEN);
+        expect((data[0] == (uint8_t)i) && (data[MSG_LEN - 1] == (uint8_t)(MSG_LEN - 1)));
+        expect(conn_can_isotp_recv_buf(&_rx_conn, (void **)&data, &buf_ctx, 0) == 0);
+    }
+    _print("recv_buf", ztimer_now(ZTIMER_USEC) - start);
+
+    /* STmin = 0xF1 (100 us), the sender waits for the TX confirmation and the
+     * STmin timer before each consecutive frame */
+    expect(conn_can_isotp_close(&_rx_conn) == 0);
+    _bind(&_rx_conn, RECEIVER_ID, SENDER_ID, 2, 0xF1);
+    start = ztimer_now(ZTIMER_USEC);
+    mutex_unlock(&_start);
+    for (unsigned i = 0; i < TRANSFERS; i++) {
+        expect(conn_can_isotp_recv(&_rx_conn, _buf, sizeof(_buf), 0) == MSG_LEN);
+        expect((_buf[0] == (uint8_t)i) && (_buf[MSG_LEN - 1] == (uint8_t)(MSG_LEN - 1)));
+    }
+    _print("stmin", ztimer_now(ZTIMER_USEC) - start);
+
+    puts("DONE");
+    return 0;
+}
@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for dispatching received CAN frames
+ *
+ * @ref FILTERS single CAN IDs and @ref MASKED masked filters are subscribed
+ * to on one interface. Received frames are injected into the CAN router
+ * directly, no CAN device is involved. Frames matching one of the single IDs,
+ * one of the masked filters and no filter at all are dispatched.
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "can/pkt.h"
+#include "can/raw.h"
+#include "can/router.h"
+#include "msg.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "timex.h"
+#include "ztimer.h"
+
+/* frames per measurement */
+#ifndef FRAMES
+#define FRAMES          (100000U)
+#endif
+
+#define MASKED          (8U)
+
+/* subscribed single IDs are ID_BASE to ID_BASE + FILTERS - 1 */
+#define ID_BASE         (0x100U)
+/* masked filters match MASKED_BASE + (i << 4) to MASKED_BASE + (i << 4) + 0xf */
+#define MASKED_BASE     (0x600U)
+#define MASKED_MASK     (0x7f0U)
+#define UNUSED_ID       (0x500U)
+
+static msg_t _msg_queue[4];
+
+static can_reg_entry_t _entry;
+
+static void _dispatch(canid_t can_id, unsigned matches)
+{
+    struct can_frame frame = { .can_id = can_id, .len = 8 };
+    can_pkt_t *pkt = can_pkt_alloc_rx(0, &frame);
+    msg_t msg;
+
+    expect(pkt != NULL);
+    expect(can_router_dispatch_rx_indic(pkt) == 0);
+    while (matches--) {
+        msg_receive(&msg);
+        expect(msg.type == CAN_MSG_RX_INDICATION);
+        raw_can_free_frame(msg.content.ptr);
+    }
+}
+
+static void _print(const char *name, uint32_t time)
+{
+    printf("%-10s: %8lu frames/s\n", name,
+           (unsigned long)((uint64_t)FRAMES * US_PER_SEC / time));
+}
+
+int main(void)
+{
+    uint32_t start;
+
+    msg_init_queue(_msg_queue, ARRAY_SIZE(_msg_queue));
+    can_pkt_init();
+    can_router_init();
+
+    _entry.ifnum = 0;
+    _entry.target.pid = thread_getpid();
+    for (unsigned i = 0; i < FILTERS; i++) {
+        expect(can_router_register(&_entry, ID_BASE + i, 0xffffffff, NULL) == 0);
+    }
+    for (unsigned i = 0; i < MASKED; i++) {
+        expect(can_router_register(&_entry, MASKED_BASE + (i << 4), MASKED_MASK,
+                                   NULL) == 0);
+    }
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < FRAMES; i++) {
+        _dispatch(ID_BASE + (i % FILTERS), 1);
+    }
+    _print("single ID", ztimer_now(ZTIMER_USEC) - start);
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < FRAMES; i++) {
+        _dispatch(MASKED_BASE + ((i % MASKED) << 4) + (i & 0xf), 1);
+    }
+    _print("masked", ztimer_now(ZTIMER_USEC) - start);
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < FRAMES; i++) {
+        _dispatch(UNUSED_ID + (i & 0xff), 0);
+    }
+    _print("no match", ztimer_now(ZTIMER_USEC) - start);
+
+    /* a single ID is delivered once per matching filter */
+    expect(can_router_register(&_entry, ID_BASE, CAN_SFF_MASK, NULL) == 0);
+    _dispatch(ID_BASE, 2);
+    expect(can_router_unregister(&_entry, ID_BASE, CAN_SFF_MASK, NULL) == 0);
+    expect(can_router_unregister(&_entry, ID_BASE, 0xffffffff, NULL) == 0);
+    _dispatch(ID_BASE, 0);
+
+    puts("DONE");
+    return 0;
+}
@@ -0,0 +1,272 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for emCute publications
+ *
+ * emCute connects to a mock MQTT-SN broker running in another thread on the
+ * same node, over a mocked Ethernet interface. The broker acknowledges every
+ * message @ref BROKER_DELAY_US after receiving it. @ref TOPICS topics are
+ * registered at once, then messages are published with QoS 0 and QoS 1.
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "net/emcute.h"
+#include "net/ethernet.h"
+#include "net/gnrc.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/netdev_test.h"
+#include "net/sock/udp.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "timex.h"
+#include "ztimer.h"
+
+/* messages per measurement */
+#ifndef PUBS
+#define PUBS            (1000U)
+#endif
+
+#define TOPICS          (8U)
+#define BROKER_PORT     (10000U)
+
+/* MQTT-SN message types */
+#define CONNECT         (0x04)
+#define CONNACK         (0x05)
+#define REGISTER        (0x0a)
+#define REGACK          (0x0b)
+#define PUBLISH         (0x0c)
+#define PUBACK          (0x0d)
+#define DISCONNECT      (0x18)
+
+/* acknowledgements the broker holds back */
+#define ACKS_NUMOF      (32U)
+
+typedef struct {
+    uint32_t due;
+    uint8_t buf[7];
+} ack_t;
+
+static const uint8_t _l2addr[] = { 0x3e, 0xe6, 0xb5, 0x0f, 0x19, 0x22 };
+static const ipv6_addr_t _addr = { .u8 = {
+        0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    } };
+
+static char _mock_netif_stack[THREAD_STACKSIZE_DEFAULT];
+static char _emcute_stack[THREAD_STACKSIZE_DEFAULT];
+static char _broker_stack[THREAD_STACKSIZE_DEFAULT];
+static netdev_test_t _mock_dev;
+static gnrc_netif_t _netif;
+
+static ack_t _acks[ACKS_NUMOF];
+static unsigned _acks_head;
+static unsigned _acks_len;
+
+static int _get_device_type(netdev_t *netdev, void *value, size_t max_len)
+{
+    (void)netdev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_pdu_size(netdev_t *netdev, void *value, size_t max_len)
+{
+    (void)netdev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *netdev, void *value, size_t max_len)
+{
+    (void)netdev;
+    expect(max_len >= sizeof(_l2addr));
+    memcpy(value, _l2addr, sizeof(_l2addr));
+    return sizeof(_l2addr);
+}
+
+static void _init_mock_netif(void)
+{
+    netdev_test_setup(&_mock_dev, NULL);
+    netdev_test_set_get_cb(&_mock_dev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_mock_dev, NETOPT_MAX_PDU_SIZE, _get_max_pdu_size);
+    netdev_test_set_get_cb(&_mock_dev, NETOPT_ADDRESS, _get_address);
+    expect(gnrc_netif_ethernet_create(&_netif, _mock_netif_stack,
+                                      sizeof(_mock_netif_stack),
+                                      GNRC_NETIF_PRIO, "mock_netif",
+                                      &_mock_dev.netdev.netdev) == 0);
+    thread_yield_higher();
+    expect(gnrc_netif_ipv6_addr_add(&_netif, &_addr, 64,
+                                    GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID) > 0);
+}
+
+static uint8_t *_ack_put(uint32_t now)
+{
+    expect(_acks_len < ACKS_NUMOF);
+    ack_t *ack = &_acks[(_acks_head + _acks_len++) % ACKS_NUMOF];
+
+    ack->due = now + BROKER_DELAY_US;
+    return ack->buf;
+}
+
+static void _handle(const uint8_t *msg, size_t len)
+{
+    uint32_t now = ztimer_now(ZTIMER_USEC);
+    uint8_t *ack;
+
+    expect((len >= 2) && (msg[0] == len));
+    switch (msg[1]) {
+    case CONNECT:
+        ack = _ack_put(now);
+        ack[0] = 3;
+        ack[1] = CONNACK;
+        ack[2] = 0;
+        break;
+    case REGISTER:
+        /* use the message ID as topic ID */
+        ack = _ack_put(now);
+        ack[0] = 7;
+        ack[1] = REGACK;
+        memcpy(&ack[2], &msg[4], 2);
+        memcpy(&ack[4], &msg[4], 2);
+        ack[6] = 0;
+        break;
+    case PUBLISH:
+        if ((msg[2] & EMCUTE_QOS_MASK) == EMCUTE_QOS_1) {
+            ack = _ack_put(now);
+            ack[0] = 7;
+            ack[1] = PUBACK;
+            memcpy(&ack[2], &msg[3], 4);
+            ack[6] = 0;
+        }
+        break;
+    case DISCONNECT:
+        ack = _ack_put(now);
+        ack[0] = 2;
+        ack[1] = DISCONNECT;
+        break;
+    default:
+        break;
+    }
+}
+
+static void *_broker(void *arg)
+{
+    sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+    sock_udp_ep_t remote = { .family = AF_INET6 };
+    sock_udp_t sock;
+    uint8_t buf[64];
+
+    (void)arg;
+    local.port = BROKER_PORT;
+    expect(sock_udp_create(&sock, &local, NULL, 0) == 0);
+    while (1) {
+        uint32_t timeout = SOCK_NO_TIMEOUT;
+        uint32_t now = ztimer_now(ZTIMER_USEC);
+
+        /* send the acknowledgements that are due */
+        while (_acks_len > 0) {
+            ack_t *ack = &_acks[_acks_head];
+            uint32_t left = ack->due - now;
+
+            if ((left > 0) && (left <= BROKER_DELAY_US)) {
+                timeout = left;
+                break;
+            }
+            expect(sock_udp_send(&sock, ack->buf, ack->buf[0], &remote) > 0);
+            _acks_head = (_acks_head + 1) % ACKS_NUMOF;
+            _acks_len--;
+        }
+
+        ssize_t res = sock_udp_recv(&sock, buf, sizeof(buf), timeout, &remote);
+        if (res >= 0) {
+            _handle(buf, res);
+        }
+        else {
+            expect(res == -ETIMEDOUT);
+        }
+    }
+    return NULL;
+}
+
+static void *_emcute(void *arg)
+{
+    (void)arg;
+    emcute_run(CONFIG_EMCUTE_DEFAULT_PORT, "bench");
+    return NULL;
+}
+
+static void _print(const char *name, const char *unit, unsigned num,
+                   uint32_t time)
+{
+    printf("%-10s: %8lu %s/s\n", name,
+           (unsigned long)((uint64_t)num * US_PER_SEC / time), unit);
+}
+
+int main(void)
+{
+    sock_udp_ep_t gw = { .family = AF_INET6, .port = BROKER_PORT };
+    static char names[TOPICS][sizeof("bench/0")];
+    emcute_topic_t topics[TOPICS];
+    uint8_t data[16] = { 0 };
+    uint32_t start;
+
+    _init_mock_netif();
+    thread_create(_broker_stack, sizeof(_broker_stack),
+                  THREAD_PRIORITY_MAIN - 2, 0, _broker, NULL, "broker");
+    thread_create(_emcute_stack, sizeof(_emcute_stack),
+                  THREAD_PRIORITY_MAIN - 1, 0, _emcute, NULL, "emcute");
+
+    memcpy(&gw.addr.ipv6, &_addr, sizeof(_addr));
+    expect(emcute_con(&gw, true, NULL, NULL, 0, 0) == EMCUTE_OK);
+
+    for (unsigned i = 0; i < TOPICS; i++) {
+        snprintf(names[i], sizeof(names[i]), "bench/%u", i);
+        topics[i].name = names[i];
+    }
+    start = ztimer_now(ZTIMER_USEC);
+    expect(emcute_reg_many(topics, TOPICS) == EMCUTE_OK);
+    _print("reg", "topics", TOPICS, ztimer_now(ZTIMER_USEC) - start);
+    for (unsigned i = 0; i < TOPICS; i++) {
+        expect(topics[i].id != 0);
+    }
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < PUBS; i++) {
+        data[0] = i;
+        expect(emcute_pub(&topics[i % TOPICS], data, sizeof(data),
+                          EMCUTE_QOS_0) == EMCUTE_OK);
+    }
+    _print("qos0", "msgs", PUBS, ztimer_now(ZTIMER_USEC) - start);
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < PUBS; i++) {
+        data[0] = i;
+        expect(emcute_pub(&topics[i % TOPICS], data, sizeof(data),
+                          EMCUTE_QOS_1) == EMCUTE_OK);
+    }
+    expect(emcute_pub_wait() == EMCUTE_OK);
+    _print("qos1", "msgs", PUBS, ztimer_now(ZTIMER_USEC) - start);
+
+    expect(emcute_discon() == EMCUTE_OK);
+
+    puts("DONE");
+    return 0;
+}
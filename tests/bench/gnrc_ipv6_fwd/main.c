@@ -0,0 +1,198 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for IPv6 forwarding
+ *
+ * The forwarding table is filled with routes via a single neighbor. The next
+ * hop of a few flows, each one matching a different route, is looked up in
+ * the NIB directly. Then packets of these flows are received on a mocked
+ * Ethernet interface and forwarded back out of it.
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "net/ethernet.h"
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6/hdr.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/netdev_test.h"
+#include "net/protnum.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "timex.h"
+#include "ztimer.h"
+
+/* packets per measurement */
+#ifndef PKTS
+#define PKTS            (10000U)
+#endif
+
+/* routes in the forwarding table */
+#ifndef ROUTES
+#define ROUTES          (6U)
+#endif
+
+/* destinations forwarded to in turn, each via a different route */
+#ifndef FLOWS
+#define FLOWS           (4U)
+#endif
+
+static const uint8_t _l2addr[] = { 0x3e, 0xe6, 0xb5, 0x0f, 0x19, 0x22 };
+static const uint8_t _nbr_l2addr[] = { 0x57, 0x44, 0x33, 0x22, 0x11, 0x00 };
+static const ipv6_addr_t _nbr = { .u8 = {
+        0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x55, 0x44, 0x33, 0xff, 0xfe, 0x22, 0x11, 0x00,
+    } };
+static const ipv6_addr_t _src = { .u8 = {
+        0x20, 0x01, 0x0d, 0xb8, 0xff, 0xff, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    } };
+static const uint8_t _payload[32];
+
+static char _mock_netif_stack[THREAD_STACKSIZE_DEFAULT];
+static netdev_test_t _mock_dev;
+static gnrc_netif_t _netif;
+
+static ipv6_addr_t _dsts[FLOWS];
+static unsigned _sent;
+
+static int _get_device_type(netdev_t *netdev, void *value, size_t max_len)
+{
+    (void)netdev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_pdu_size(netdev_t *netdev, void *value, size_t max_len)
+{
+    (void)netdev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *netdev, void *value, size_t max_len)
+{
+    (void)netdev;
+    expect(max_len >= sizeof(_l2addr));
+    memcpy(value, _l2addr, sizeof(_l2addr));
+    return sizeof(_l2addr);
+}
+
+static int _send(netdev_t *netdev, const iolist_t *iolist)
+{
+    (void)netdev;
+    _sent++;
+    return iolist_size(iolist);
+}
+
+static void _init_mock_netif(void)
+{
+    netdev_test_setup(&_mock_dev, NULL);
+    netdev_test_set_get_cb(&_mock_dev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_mock_dev, NETOPT_MAX_PDU_SIZE, _get_max_pdu_size);
+    netdev_test_set_get_cb(&_mock_dev, NETOPT_ADDRESS, _get_address);
+    netdev_test_set_send_cb(&_mock_dev, _send);
+    expect(gnrc_netif_ethernet_create(&_netif, _mock_netif_stack,
+                                      sizeof(_mock_netif_stack),
+                                      GNRC_NETIF_PRIO, "mock_netif",
+                                      &_mock_dev.netdev.netdev) == 0);
+    thread_yield_higher();
+}
+
+static void _init_routes(void)
+{
+    expect(gnrc_ipv6_nib_nc_set(&_nbr, _netif.pid, _nbr_l2addr,
+                                sizeof(_nbr_l2addr)) == 0);
+    /* add the routes used by the flows last, so they are found last */
+    for (unsigned i = 0; i < ROUTES; i++) {
+        ipv6_addr_t pfx = { .u8 = { 0x20, 0x01, 0x0d, 0xb8, 0x00, i } };
+
+        expect(gnrc_ipv6_nib_ft_add(&pfx, 48, &_nbr, _netif.pid, 0) == 0);
+    }
+    for (unsigned i = 0; i < FLOWS; i++) {
+        _dsts[i] = (ipv6_addr_t){ .u8 = { 0x20, 0x01, 0x0d, 0xb8, 0x00,
+                                          ROUTES - 1 - (i % ROUTES) } };
+        _dsts[i].u8[15] = i + 1;
+    }
+}
+
+static gnrc_pktsnip_t *_build_recvd(const ipv6_addr_t *dst)
+{
+    gnrc_pktsnip_t *netif, *pkt;
+    ipv6_hdr_t *hdr;
+
+    netif = gnrc_netif_hdr_build(_nbr_l2addr, sizeof(_nbr_l2addr),
+                                 _l2addr, sizeof(_l2addr));
+    expect(netif);
+    gnrc_netif_hdr_set_netif(netif->data, &_netif);
+    /* IPv6 parses the header of received packets itself */
+    pkt = gnrc_pktbuf_add(netif, NULL, sizeof(ipv6_hdr_t) + sizeof(_payload),
+                          GNRC_NETTYPE_IPV6);
+    expect(pkt);
+    hdr = pkt->data;
+    memset(hdr, 0, sizeof(*hdr));
+    ipv6_hdr_set_version(hdr);
+    hdr->len = byteorder_htons(sizeof(_payload));
+    hdr->nh = PROTNUM_IPV6_NONXT;
+    hdr->hl = 64;
+    hdr->src = _src;
+    hdr->dst = *dst;
+    memcpy(hdr + 1, _payload, sizeof(_payload));
+    return pkt;
+}
+
+static void _print(const char *name, uint32_t time)
+{
+    printf("%-10s: %8lu pkts/s\n", name,
+           (unsigned long)((uint64_t)PKTS * US_PER_SEC / time));
+}
+
+int main(void)
+{
+    uint32_t start;
+
+    _init_mock_netif();
+    _init_routes();
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < PKTS; i++) {
+        gnrc_ipv6_nib_nc_t nce;
+
+        expect(gnrc_ipv6_nib_get_next_hop_l2addr(&_dsts[i % FLOWS], NULL,
+                                                 NULL, &nce) == 0);
+    }
+    _print("next hop", ztimer_now(ZTIMER_USEC) - start);
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < PKTS; i++) {
+        /* IPv6 and the interface have higher priority, so the packet is
+         * forwarded before this returns */
+        gnrc_netapi_dispatch_receive(GNRC_NETTYPE_IPV6,
+                                     GNRC_NETREG_DEMUX_CTX_ALL,
+                                     _build_recvd(&_dsts[i % FLOWS]));
+    }
+    _print("forward", ztimer_now(ZTIMER_USEC) - start);
+    expect(_sent == PKTS);
+
+    puts("DONE");
+    return 0;
+}
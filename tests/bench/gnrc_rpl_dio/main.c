@@ -0,0 +1,225 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for RPL DIO processing
+ *
+ * The node joins a DODAG and receives DIOs from @ref GNRC_RPL_PARENTS_NUMOF
+ * parents in turn over a mocked Ethernet interface. Parent ranks are kept
+ * within the same DAGRank, so no parent is dropped. First the ranks stay the
+ * same ("steady"), then all but the preferred parent change their rank with
+ * every DIO ("reorder").
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "net/ethernet.h"
+#include "net/gnrc.h"
+#include "net/gnrc/icmpv6.h"
+#include "net/gnrc/ipv6/hdr.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/rpl.h"
+#include "net/gnrc/rpl/structs.h"
+#include "net/icmpv6.h"
+#include "net/netdev_test.h"
+#include "net/protnum.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "timex.h"
+#include "ztimer.h"
+
+/* DIOs per measurement */
+#ifndef DIOS
+#define DIOS            (10000U)
+#endif
+
+#define INSTANCE_ID     (7U)
+#define PARENT_RANK     (2 * CONFIG_GNRC_RPL_DEFAULT_MIN_HOP_RANK_INCREASE)
+
+static const uint8_t _l2addr[] = { 0x3e, 0xe6, 0xb5, 0x0f, 0x19, 0x22 };
+static const ipv6_addr_t _dodag_id = { .u8 = {
+        0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    } };
+static const ipv6_addr_t _addr = { .u8 = {
+        0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    } };
+
+static char _mock_netif_stack[THREAD_STACKSIZE_DEFAULT];
+static netdev_test_t _mock_dev;
+static gnrc_netif_t _netif;
+
+static int _get_device_type(netdev_t *netdev, void *value, size_t max_len)
+{
+    (void)netdev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_pdu_size(netdev_t *netdev, void *value, size_t max_len)
+{
+    (void)netdev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *netdev, void *value, size_t max_len)
+{
+    (void)netdev;
+    expect(max_len >= sizeof(_l2addr));
+    memcpy(value, _l2addr, sizeof(_l2addr));
+    return sizeof(_l2addr);
+}
+
+static int _send(netdev_t *netdev, const iolist_t *iolist)
+{
+    (void)netdev;
+    return iolist_size(iolist);
+}
+
+static void _init_mock_netif(void)
+{
+    netdev_test_setup(&_mock_dev, NULL);
+    netdev_test_set_get_cb(&_mock_dev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_mock_dev, NETOPT_MAX_PDU_SIZE, _get_max_pdu_size);
+    netdev_test_set_get_cb(&_mock_dev, NETOPT_ADDRESS, _get_address);
+    netdev_test_set_send_cb(&_mock_dev, _send);
+    expect(gnrc_netif_ethernet_create(&_netif, _mock_netif_stack,
+                                      sizeof(_mock_netif_stack),
+                                      GNRC_NETIF_PRIO, "mock_netif",
+                                      &_mock_dev.netdev.netdev) == 0);
+    thread_yield_higher();
+    expect(gnrc_netif_ipv6_addr_add(&_netif, &_addr, 64,
+                                    GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID) > 0);
+}
+
+static void _recv_dio(unsigned parent, uint16_t rank)
+{
+    gnrc_pktsnip_t *netif, *ipv6, *icmpv6;
+    gnrc_rpl_opt_dodag_conf_t *conf;
+    gnrc_rpl_dio_t *dio;
+    ipv6_hdr_t *hdr;
+    const size_t len = sizeof(icmpv6_hdr_t) + sizeof(*dio) + sizeof(*conf);
+
+    netif = gnrc_netif_hdr_build(NULL, 0, NULL, 0);
+    expect(netif);
+    gnrc_netif_hdr_set_netif(netif->data, &_netif);
+    ipv6 = gnrc_pktbuf_add(netif, NULL, sizeof(*hdr), GNRC_NETTYPE_IPV6);
+    expect(ipv6);
+    hdr = ipv6->data;
+    memset(hdr, 0, sizeof(*hdr));
+    ipv6_hdr_set_version(hdr);
+    hdr->len = byteorder_htons(len);
+    hdr->nh = PROTNUM_ICMPV6;
+    hdr->hl = 255;
+    ipv6_addr_set_link_local_prefix(&hdr->src);
+    hdr->src.u8[15] = parent + 1;
+    hdr->dst = ipv6_addr_all_rpl_nodes;
+    /* received packets are in reverse order */
+    icmpv6 = gnrc_icmpv6_build(ipv6, ICMPV6_RPL_CTRL, GNRC_RPL_ICMPV6_CODE_DIO,
+                               len);
+    expect(icmpv6);
+    dio = (gnrc_rpl_dio_t *)((icmpv6_hdr_t *)icmpv6->data + 1);
+    memset(dio, 0, sizeof(*dio));
+    dio->instance_id = INSTANCE_ID;
+    dio->rank = byteorder_htons(rank);
+    /* grounded, storing mode without multicast */
+    dio->g_mop_prf = (1 << 7) | (GNRC_RPL_MOP_STORING_MODE_NO_MC << 3);
+    dio->dtsn = 1;
+    dio->dodag_id = _dodag_id;
+    conf = (gnrc_rpl_opt_dodag_conf_t *)(dio + 1);
+    memset(conf, 0, sizeof(*conf));
+    conf->type = GNRC_RPL_OPT_DODAG_CONF;
+    conf->length = GNRC_RPL_OPT_DODAG_CONF_LEN;
+    conf->dio_int_doubl = CONFIG_GNRC_RPL_DEFAULT_DIO_INTERVAL_DOUBLINGS;
+    conf->dio_int_min = CONFIG_GNRC_RPL_DEFAULT_DIO_INTERVAL_MIN;
+    conf->dio_redun = CONFIG_GNRC_RPL_DEFAULT_DIO_REDUNDANCY_CONSTANT;
+    conf->max_rank_inc = byteorder_htons(CONFIG_GNRC_RPL_DEFAULT_MAX_RANK_INCREASE);
+    conf->min_hop_rank_inc = byteorder_htons(CONFIG_GNRC_RPL_DEFAULT_MIN_HOP_RANK_INCREASE);
+    conf->ocp = byteorder_htons(GNRC_RPL_DEFAULT_OCP);
+    conf->default_lifetime = CONFIG_GNRC_RPL_DEFAULT_LIFETIME;
+    conf->lifetime_unit = byteorder_htons(CONFIG_GNRC_RPL_LIFETIME_UNIT);
+    /* RPL has a higher priority, so the DIO is handled before this returns */
+    expect(gnrc_netapi_dispatch_receive(GNRC_NETTYPE_ICMPV6, ICMPV6_RPL_CTRL,
+                                        icmpv6) == 1);
+}
+
+static uint16_t _rank(unsigned parent, unsigned round)
+{
+    /* the preferred parent keeps the lowest rank, the others alternate
+     * within the same DAGRank */
+    if (parent == 0) {
+        return PARENT_RANK;
+    }
+    return PARENT_RANK + (((parent + round) % GNRC_RPL_PARENTS_NUMOF) + 1) * 8;
+}
+
+static void _print(const char *name, uint32_t time)
+{
+    printf("%-10s: %8lu DIOs/s\n", name,
+           (unsigned long)((uint64_t)DIOS * US_PER_SEC / time));
+}
+
+int main(void)
+{
+    gnrc_rpl_instance_t *inst;
+    unsigned parents;
+    uint32_t start;
+
+    _init_mock_netif();
+    expect(gnrc_rpl_init(_netif.pid) > KERNEL_PID_UNDEF);
+    for (unsigned i = 0; i < GNRC_RPL_PARENTS_NUMOF; i++) {
+        _recv_dio(i, _rank(i, 0));
+    }
+    inst = gnrc_rpl_instance_get(INSTANCE_ID);
+    expect(inst != NULL);
+    expect(inst->dodag.my_rank ==
+           PARENT_RANK + CONFIG_GNRC_RPL_DEFAULT_MIN_HOP_RANK_INCREASE);
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < DIOS; i++) {
+        unsigned parent = i % GNRC_RPL_PARENTS_NUMOF;
+
+        _recv_dio(parent, _rank(parent, 0));
+    }
+    _print("steady", ztimer_now(ZTIMER_USEC) - start);
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < DIOS; i++) {
+        unsigned parent = i % GNRC_RPL_PARENTS_NUMOF;
+
+        _recv_dio(parent, _rank(parent, i));
+    }
+    _print("reorder", ztimer_now(ZTIMER_USEC) - start);
+
+    /* no parent was dropped, the preferred one did not change and the
+     * others are still sorted by rank */
+    expect(inst->dodag.parents->addr.u8[15] == 1);
+    parents = 0;
+    for (gnrc_rpl_parent_t *p = inst->dodag.parents; p != NULL; p = p->next) {
+        expect((p->next == NULL) || (p->rank <= p->next->rank));
+        parents++;
+    }
+    expect(parents == GNRC_RPL_PARENTS_NUMOF);
+
+    puts("DONE");
+    return 0;
+}
@@ -0,0 +1,214 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for 6LoWPAN IPHC compression and decompression
+ *
+ * All compression contexts are in use, with both addresses of the benchmarked
+ * flow being compressible with a context. Compressed packets are sent over a
+ * mocked IEEE 802.15.4 interface, decompressed packets are handed to the IPv6
+ * thread, which drops them.
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6/hdr.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/netif/ieee802154.h"
+#include "net/gnrc/sixlowpan/ctx.h"
+#include "net/gnrc/sixlowpan/iphc.h"
+#include "net/netdev_test.h"
+#include "net/protnum.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "timex.h"
+#include "ztimer.h"
+
+/* packets per measurement */
+#ifndef PKTS
+#define PKTS            (10000U)
+#endif
+
+#define MAX_PDU_SIZE    (102U)
+
+static const uint8_t _l2addr[] = { 0x2a, 0xab, 0xdc, 0x15, 0x54, 0x01, 0x64, 0x79 };
+static const uint8_t _peer_l2addr[] = { 0x5a, 0x9d, 0x93, 0x86, 0x22, 0x08, 0x65, 0x79 };
+static const uint8_t _payload[32];
+
+static char _mock_netif_stack[THREAD_STACKSIZE_DEFAULT];
+static netdev_test_t _mock_dev;
+static gnrc_netif_t _netif;
+
+static ipv6_addr_t _src, _dst;
+static uint8_t _frame[MAX_PDU_SIZE];
+static size_t _frame_len;
+static unsigned _sent;
+
+static int _get_device_type(netdev_t *netdev, void *value, size_t max_len)
+{
+    (void)netdev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_IEEE802154;
+    return sizeof(uint16_t);
+}
+
+static int _get_proto(netdev_t *netdev, void *value, size_t max_len)
+{
+    (void)netdev;
+    expect(max_len == sizeof(gnrc_nettype_t));
+    *((gnrc_nettype_t *)value) = GNRC_NETTYPE_SIXLOWPAN;
+    return sizeof(gnrc_nettype_t);
+}
+
+static int _get_max_pdu_size(netdev_t *netdev, void *value, size_t max_len)
+{
+    (void)netdev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = MAX_PDU_SIZE;
+    return sizeof(uint16_t);
+}
+
+static int _get_src_len(netdev_t *netdev, void *value, size_t max_len)
+{
+    (void)netdev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = sizeof(_l2addr);
+    return sizeof(uint16_t);
+}
+
+static int _get_addr_long(netdev_t *netdev, void *value, size_t max_len)
+{
+    (void)netdev;
+    expect(max_len >= sizeof(_l2addr));
+    memcpy(value, _l2addr, sizeof(_l2addr));
+    return sizeof(_l2addr);
+}
+
+static int _send(netdev_t *netdev, const iolist_t *iolist)
+{
+    (void)netdev;
+    if (_sent++ == 0) {
+        /* keep the first 6LoWPAN frame (without MAC header) to decompress it */
+        for (const iolist_t *ptr = iolist->iol_next; ptr; ptr = ptr->iol_next) {
+            expect(_frame_len + ptr->iol_len <= sizeof(_frame));
+            memcpy(&_frame[_frame_len], ptr->iol_base, ptr->iol_len);
+            _frame_len += ptr->iol_len;
+        }
+    }
+    return iolist_size(iolist);
+}
+
+static void _init_mock_netif(void)
+{
+    netdev_test_setup(&_mock_dev, NULL);
+    netdev_test_set_get_cb(&_mock_dev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_mock_dev, NETOPT_PROTO, _get_proto);
+    netdev_test_set_get_cb(&_mock_dev, NETOPT_MAX_PDU_SIZE, _get_max_pdu_size);
+    netdev_test_set_get_cb(&_mock_dev, NETOPT_SRC_LEN, _get_src_len);
+    netdev_test_set_get_cb(&_mock_dev, NETOPT_ADDRESS_LONG, _get_addr_long);
+    netdev_test_set_send_cb(&_mock_dev, _send);
+    gnrc_netif_ieee802154_create(&_netif, _mock_netif_stack,
+                                 sizeof(_mock_netif_stack), GNRC_NETIF_PRIO,
+                                 "mock_netif", &_mock_dev.netdev.netdev);
+    thread_yield_higher();
+}
+
+static void _init_ctxs(void)
+{
+    eui64_t iid;
+
+    /* fill all contexts, the ones used by the flow last */
+    for (unsigned id = 0; id < GNRC_SIXLOWPAN_CTX_SIZE; id++) {
+        ipv6_addr_t prefix = { .u8 = { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00,
+                                       0x00, id } };
+
+        expect(gnrc_sixlowpan_ctx_update(id, &prefix, 64, UINT16_MAX, true));
+    }
+    expect(gnrc_netif_ipv6_get_iid(&_netif, &iid) == sizeof(iid));
+    _src = (ipv6_addr_t){ .u8 = { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00,
+                                  GNRC_SIXLOWPAN_CTX_SIZE - 1 } };
+    memcpy(&_src.u8[8], &iid, sizeof(iid));
+    _dst = (ipv6_addr_t){ .u8 = { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00,
+                                  GNRC_SIXLOWPAN_CTX_SIZE - 2,
+                                  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01 } };
+}
+
+static gnrc_pktsnip_t *_build_ipv6(void)
+{
+    gnrc_pktsnip_t *payload, *ipv6, *netif;
+    ipv6_hdr_t *hdr;
+
+    payload = gnrc_pktbuf_add(NULL, _payload, sizeof(_payload),
+                              GNRC_NETTYPE_UNDEF);
+    expect(payload);
+    ipv6 = gnrc_ipv6_hdr_build(payload, &_src, &_dst);
+    expect(ipv6);
+    hdr = ipv6->data;
+    hdr->len = byteorder_htons(sizeof(_payload));
+    hdr->nh = PROTNUM_IPV6_NONXT;
+    hdr->hl = 64;
+    netif = gnrc_netif_hdr_build(NULL, 0, _peer_l2addr, sizeof(_peer_l2addr));
+    expect(netif);
+    gnrc_netif_hdr_set_netif(netif->data, &_netif);
+    netif->next = ipv6;
+    return netif;
+}
+
+static gnrc_pktsnip_t *_build_sixlo(void)
+{
+    gnrc_pktsnip_t *netif;
+
+    netif = gnrc_netif_hdr_build(_peer_l2addr, sizeof(_peer_l2addr),
+                                 _l2addr, sizeof(_l2addr));
+    expect(netif);
+    gnrc_netif_hdr_set_netif(netif->data, &_netif);
+    return gnrc_pktbuf_add(netif, _frame, _frame_len, GNRC_NETTYPE_SIXLOWPAN);
+}
+
+static void _print(const char *name, uint32_t time)
+{
+    printf("%-10s: %8lu pkts/s\n", name,
+           (unsigned long)((uint64_t)PKTS * US_PER_SEC / time));
+}
+
+int main(void)
+{
+    uint32_t start;
+
+    _init_mock_netif();
+    _init_ctxs();
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < PKTS; i++) {
+        gnrc_sixlowpan_iphc_send(_build_ipv6(), NULL, 0);
+    }
+    _print("compress", ztimer_now(ZTIMER_USEC) - start);
+    expect(_sent == PKTS);
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < PKTS; i++) {
+        gnrc_pktsnip_t *pkt = _build_sixlo();
+
+        expect(pkt);
+        gnrc_sixlowpan_iphc_recv(pkt, NULL, 0);
+    }
+    _print("decompress", ztimer_now(ZTIMER_USEC) - start);
+
+    puts("DONE");
+    return 0;
+}
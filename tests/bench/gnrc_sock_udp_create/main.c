@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for UDP sock creation with many open socks
+ *
+ * Opens more and more socks on ephemeral ports and measures, at every fill
+ * level, how long it takes to create (and close) one more sock and to look
+ * up the receiver of an incoming datagram for the oldest sock in netreg.
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "net/gnrc/netreg.h"
+#include "net/sock/udp.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#ifndef NUM_SOCKS
+#define NUM_SOCKS       (256U)
+#endif
+
+/* socks opened between two measurements */
+#define STEP            (NUM_SOCKS / 8)
+
+/* operations per measurement */
+#ifndef OPS
+#define OPS             (1000U)
+#endif
+
+static sock_udp_t _socks[NUM_SOCKS + 1];
+
+static uint32_t _bench_create(sock_udp_t *sock)
+{
+    const sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    for (unsigned i = 0; i < OPS; i++) {
+        expect(sock_udp_create(sock, &local, NULL, 0) == 0);
+        sock_udp_close(sock);
+    }
+    return ztimer_now(ZTIMER_USEC) - start;
+}
+
+static uint32_t _bench_demux(uint16_t port)
+{
+    gnrc_netreg_acquire_shared();
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    for (unsigned i = 0; i < OPS; i++) {
+        expect(gnrc_netreg_lookup(GNRC_NETTYPE_UDP, port) != NULL);
+    }
+    uint32_t time = ztimer_now(ZTIMER_USEC) - start;
+    gnrc_netreg_release_shared();
+    return time;
+}
+
+int main(void)
+{
+    const sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+    unsigned open = 0;
+
+    while (true) {
+        uint32_t create = _bench_create(&_socks[NUM_SOCKS]);
+        uint32_t demux = (open > 0) ? _bench_demux(_socks[0].local.port) : 0;
+
+        printf("open %4u: create %6lu ns, demux %6lu ns\n", open,
+               (unsigned long)((uint64_t)create * NS_PER_US / OPS),
+               (unsigned long)((uint64_t)demux * NS_PER_US / OPS));
+        if (open == NUM_SOCKS) {
+            break;
+        }
+        for (unsigned i = 0; i < STEP; i++, open++) {
+            expect(sock_udp_create(&_socks[open], &local, NULL, 0) == 0);
+        }
+    }
+    for (unsigned i = 0; i < open; i++) {
+        sock_udp_close(&_socks[i]);
+    }
+
+    puts("DONE");
+    return 0;
+}
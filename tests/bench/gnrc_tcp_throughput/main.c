@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       GNRC TCP bulk transfer throughput benchmark
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "msg.h"
+#include "net/gnrc/tcp.h"
+#include "shell.h"
+#include "ztimer.h"
+
+#define MAIN_QUEUE_SIZE (8)
+#define CHUNK_SIZE      (1024)
+
+static msg_t _main_msg_queue[MAIN_QUEUE_SIZE];
+static gnrc_tcp_tcb_t _tcb;
+static uint8_t _buf[CHUNK_SIZE];
+
+static int _tput_cmd(int argc, char **argv)
+{
+    gnrc_tcp_ep_t remote;
+
+    if (argc < 3) {
+        printf("usage: %s <[addr%%iface]:port> <KiB>\n", argv[0]);
+        return 1;
+    }
+    if (gnrc_tcp_ep_from_str(&remote, argv[1]) < 0) {
+        puts("tput: invalid endpoint");
+        return 1;
+    }
+    unsigned kib = atoi(argv[2]);
+
+    for (unsigned i = 0; i < sizeof(_buf); i++) {
+        _buf[i] = i;
+    }
+
+    gnrc_tcp_tcb_init(&_tcb);
+    int res = gnrc_tcp_open(&_tcb, &remote, 0);
+    if (res < 0) {
+        printf("tput: open failed (%d)\n", res);
+        return 1;
+    }
+
+    uint32_t start = ztimer_now(ZTIMER_MSEC);
+    for (unsigned i = 0; i < kib && res >= 0; i++) {
+        size_t sent = 0;
+        while (sent < sizeof(_buf)) {
+            res = gnrc_tcp_send(&_tcb, _buf + sent, sizeof(_buf) - sent, 0);
+            if (res < 0) {
+                break;
+            }
+            sent += res;
+        }
+    }
+    /* the peer answers with a single byte once it received everything */
+    if (res >= 0) {
+        res = gnrc_tcp_recv(&_tcb, _buf, 1, GNRC_TCP_NO_TIMEOUT);
+    }
+    uint32_t time = ztimer_now(ZTIMER_MSEC) - start;
+    gnrc_tcp_close(&_tcb);
+
+    if (res < 0) {
+        printf("tput: transfer failed (%d)\n", res);
+        return 1;
+    }
+    printf("tput: %u KiB in %" PRIu32 " ms, %" PRIu32 " KiB/s\n",
+           kib, time, time ? (uint32_t)((kib * 1000LU) / time) : 0);
+    return 0;
+}
+
+static const shell_command_t _commands[] = {
+    { "tput", "send KiB of data to a TCP server", _tput_cmd },
+    { NULL, NULL, NULL }
+};
+
+int main(void)
+{
+    msg_init_queue(_main_msg_queue, MAIN_QUEUE_SIZE);
+    printf("segments in flight: %u, out-of-order queue: %u, SACK: %u\n",
+           CONFIG_GNRC_TCP_SND_QUEUE_SIZE, CONFIG_GNRC_TCP_OOO_QUEUE_SIZE,
+           CONFIG_GNRC_TCP_SACK_EN);
+
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+    shell_run(_commands, line_buf, SHELL_DEFAULT_BUFSIZE);
+    return 0;
+}
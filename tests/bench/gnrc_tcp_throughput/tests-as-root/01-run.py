@@ -0,0 +1,69 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import re
+import socket
+import sys
+import threading
+
+from testrunner import run
+
+KIB = int(os.environ.get("TPUT_KIB", 256))
+PORT = 50000
+
+
+def _host_interface():
+    # use the bridge if the tap device is part of one
+    tap = os.environ["TAPDEV"]
+    bridge = re.search("master (.*) state",
+                       os.popen("bridge link show dev {}".format(tap)).read())
+    return bridge.group(1).strip() if bridge else tap
+
+
+def _host_address(interface):
+    res = os.popen("ip addr show dev {} scope link".format(interface)).read()
+    return re.search("inet6 (.*)/64", res).group(1).strip()
+
+
+def _server(sock, result):
+    conn, _ = sock.accept()
+    received = 0
+    while received < KIB * 1024:
+        data = conn.recv(65536)
+        if not data:
+            break
+        received += len(data)
+    conn.send(b"\x00")
+    result.append(received)
+    conn.close()
+
+
+def testfunc(child):
+    addr = _host_address(_host_interface())
+    sock = socket.socket(socket.AF_INET6, socket.SOCK_STREAM)
+    sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+    sock.bind(("::", PORT))
+    sock.listen(1)
+    result = []
+    server = threading.Thread(target=_server, args=(sock, result), daemon=True)
+    server.start()
+
+    child.sendline("ifconfig")
+    child.expect(r"Iface\s+(\d+)\s")
+    iface = child.match.group(1)
+    child.sendline("tput [{}%{}]:{} {}".format(addr, iface, PORT, KIB))
+    child.expect(r"tput: (\d+) KiB in (\d+) ms, (\d+) KiB/s", timeout=120)
+    print("\n" + child.match.group(0))
+    server.join(timeout=5)
+    sock.close()
+    assert result == [KIB * 1024]
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
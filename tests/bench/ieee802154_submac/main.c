@@ -0,0 +1,307 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for IEEE 802.15.4 SubMAC transmissions
+ *
+ * The SubMAC runs on top of a mocked radio that performs CSMA-CA itself and
+ * reports TX done as soon as a transmission is requested. Frames are sent
+ * one at a time, waiting for the TX done callback before sending the next one
+ * ("single"), then the SubMAC TX queue is kept filled ("queued"). For both,
+ * the time the SubMAC spent in IDLE, PREPARE and TX is printed.
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "iolist.h"
+#include "net/ieee802154.h"
+#include "net/ieee802154/radio.h"
+#include "net/ieee802154/submac.h"
+#include "test_utils/expect.h"
+#include "timex.h"
+#include "ztimer.h"
+
+/* frames per measurement */
+#ifndef FRAMES
+#define FRAMES          (10000U)
+#endif
+
+#define FLAG_BH         (1U << 0)
+#define FLAG_TX_DONE    (1U << 1)
+
+static const network_uint16_t _short_addr = { .u8 = { 0x12, 0x34 } };
+static const eui64_t _ext_addr = { .uint8 = {
+        0x2a, 0xab, 0xdc, 0x15, 0x54, 0x01, 0x64, 0x79,
+    } };
+
+/* data frame without ACK request, short addresses, PAN ID compression */
+static uint8_t _frame[] = {
+    0x41, 0x88, 0x00, 0x23, 0x00, 0xff, 0xff, 0x12, 0x34,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static ieee802154_submac_t _submac;
+static unsigned _flags;
+static unsigned _tx_done;
+
+static int _write(ieee802154_dev_t *dev, const iolist_t *psdu)
+{
+    (void)dev;
+    expect(iolist_size(psdu) == sizeof(_frame));
+    return 0;
+}
+
+static int _len(ieee802154_dev_t *dev)
+{
+    (void)dev;
+    return 0;
+}
+
+static int _read(ieee802154_dev_t *dev, void *buf, size_t size,
+                 ieee802154_rx_info_t *info)
+{
+    (void)dev;
+    (void)buf;
+    (void)size;
+    (void)info;
+    return 0;
+}
+
+static int _dev_op(ieee802154_dev_t *dev)
+{
+    (void)dev;
+    return 0;
+}
+
+static int _request_op(ieee802154_dev_t *dev, ieee802154_hal_op_t op, void *ctx)
+{
+    (void)ctx;
+    if (op == IEEE802154_HAL_OP_TRANSMIT) {
+        dev->cb(dev, IEEE802154_RADIO_CONFIRM_TX_DONE);
+    }
+    return 0;
+}
+
+static int _confirm_op(ieee802154_dev_t *dev, ieee802154_hal_op_t op, void *ctx)
+{
+    (void)dev;
+    if ((op == IEEE802154_HAL_OP_TRANSMIT) && ctx) {
+        ((ieee802154_tx_info_t *)ctx)->status = TX_STATUS_SUCCESS;
+    }
+    return 0;
+}
+
+static int _set_cca_threshold(ieee802154_dev_t *dev, int8_t threshold)
+{
+    (void)dev;
+    (void)threshold;
+    return 0;
+}
+
+static int _set_cca_mode(ieee802154_dev_t *dev, ieee802154_cca_mode_t mode)
+{
+    (void)dev;
+    (void)mode;
+    return 0;
+}
+
+static int _config_phy(ieee802154_dev_t *dev, const ieee802154_phy_conf_t *conf)
+{
+    (void)dev;
+    (void)conf;
+    return 0;
+}
+
+static int _set_csma_params(ieee802154_dev_t *dev, const ieee802154_csma_be_t *bd,
+                            int8_t retries)
+{
+    (void)dev;
+    (void)bd;
+    (void)retries;
+    return 0;
+}
+
+static int _set_frame_filter_mode(ieee802154_dev_t *dev,
+                                  ieee802154_filter_mode_t mode)
+{
+    (void)dev;
+    (void)mode;
+    return 0;
+}
+
+static int _config_addr_filter(ieee802154_dev_t *dev, ieee802154_af_cmd_t cmd,
+                               const void *value)
+{
+    (void)dev;
+    (void)cmd;
+    (void)value;
+    return 0;
+}
+
+static int _config_src_addr_match(ieee802154_dev_t *dev,
+                                  ieee802154_src_match_t cmd, const void *value)
+{
+    (void)dev;
+    (void)cmd;
+    (void)value;
+    return -ENOTSUP;
+}
+
+static const ieee802154_radio_ops_t _mock_radio_ops = {
+    .caps = IEEE802154_CAP_24_GHZ
+          | IEEE802154_CAP_AUTO_CSMA
+          | IEEE802154_CAP_IRQ_TX_DONE
+          | IEEE802154_CAP_PHY_OQPSK,
+    .write = _write,
+    .read = _read,
+    .request_op = _request_op,
+    .confirm_op = _confirm_op,
+    .len = _len,
+    .off = _dev_op,
+    .request_on = _dev_op,
+    .confirm_on = _dev_op,
+    .set_cca_threshold = _set_cca_threshold,
+    .set_cca_mode = _set_cca_mode,
+    .config_phy = _config_phy,
+    .config_addr_filter = _config_addr_filter,
+    .config_src_addr_match = _config_src_addr_match,
+    .set_csma_params = _set_csma_params,
+    .set_frame_filter_mode = _set_frame_filter_mode,
+};
+
+static void _radio_cb(ieee802154_dev_t *dev, ieee802154_trx_ev_t status)
+{
+    (void)dev;
+    if (status == IEEE802154_RADIO_CONFIRM_TX_DONE) {
+        _flags |= FLAG_TX_DONE;
+    }
+}
+
+void ieee802154_submac_bh_request(ieee802154_submac_t *submac)
+{
+    (void)submac;
+    _flags |= FLAG_BH;
+}
+
+void ieee802154_submac_ack_timer_set(ieee802154_submac_t *submac, uint16_t us)
+{
+    (void)submac;
+    (void)us;
+    /* frames don't request an ACK */
+    expect(false);
+}
+
+void ieee802154_submac_ack_timer_cancel(ieee802154_submac_t *submac)
+{
+    (void)submac;
+}
+
+static void _submac_rx_done(ieee802154_submac_t *submac)
+{
+    (void)submac;
+}
+
+static void _submac_tx_done(ieee802154_submac_t *submac, int status,
+                            ieee802154_tx_info_t *info)
+{
+    (void)submac;
+    (void)info;
+    expect(status == TX_STATUS_SUCCESS);
+    _tx_done++;
+}
+
+static const ieee802154_submac_cb_t _submac_cb = {
+    .rx_done = _submac_rx_done,
+    .tx_done = _submac_tx_done,
+};
+
+/* process SubMAC events, like the netdev adaption does in its ISR handler */
+static void _process(void)
+{
+    while (_flags) {
+        unsigned flags = _flags;
+
+        _flags = 0;
+        if (flags & FLAG_BH) {
+            ieee802154_submac_bh_process(&_submac);
+        }
+        if (flags & FLAG_TX_DONE) {
+            ieee802154_submac_tx_done_cb(&_submac);
+        }
+    }
+}
+
+static int _send(void)
+{
+    iolist_t psdu = { .iol_base = _frame, .iol_len = sizeof(_frame) };
+
+    /* sequence number */
+    _frame[2]++;
+    return ieee802154_send(&_submac, &psdu);
+}
+
+static void _print(const char *name, uint32_t time)
+{
+    ieee802154_submac_stats_t *stats = &_submac.stats;
+
+    printf("%-10s: %8lu frames/s\n", name,
+           (unsigned long)((uint64_t)FRAMES * US_PER_SEC / time));
+    printf("            idle %lu us, prepare %lu us, tx %lu us\n",
+           (unsigned long)stats->state_time[IEEE802154_FSM_STATE_IDLE],
+           (unsigned long)stats->state_time[IEEE802154_FSM_STATE_PREPARE],
+           (unsigned long)stats->state_time[IEEE802154_FSM_STATE_TX]);
+    memset(stats->state_time, 0, sizeof(stats->state_time));
+}
+
+int main(void)
+{
+    uint32_t start;
+    unsigned sent;
+
+    _submac.dev.driver = &_mock_radio_ops;
+    _submac.dev.cb = _radio_cb;
+    _submac.cb = &_submac_cb;
+    expect(ieee802154_submac_init(&_submac, &_short_addr, &_ext_addr) >= 0);
+
+    _tx_done = 0;
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < FRAMES; i++) {
+        expect(_send() == 0);
+        _process();
+        expect(_tx_done == i + 1);
+    }
+    _print("single", ztimer_now(ZTIMER_USEC) - start);
+
+    _tx_done = 0;
+    sent = 0;
+    start = ztimer_now(ZTIMER_USEC);
+    while (_tx_done < FRAMES) {
+        /* fill the queue, the first frame is sent directly */
+        while ((sent < FRAMES) && (_send() == 0)) {
+            sent++;
+        }
+        _process();
+    }
+    _print("queued", ztimer_now(ZTIMER_USEC) - start);
+    expect((CONFIG_IEEE802154_SUBMAC_TX_QUEUE_SIZE == 0) ||
+           (_submac.stats.tx_queued > 0));
+
+    puts("DONE");
+    return 0;
+}
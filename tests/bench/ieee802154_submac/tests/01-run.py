@@ -0,0 +1,21 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    for phase in ("single", "queued"):
+        child.expect(phase + r"\s*:\s*[0-9]+ frames/s")
+        child.expect(r"idle [0-9]+ us, prepare [0-9]+ us, tx [0-9]+ us")
+    child.expect_exact("DONE")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
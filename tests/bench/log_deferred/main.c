@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for deferred logging
+ *
+ * Compares the cost of @ref CALLS messages written with printf() to the same
+ * messages logged by log_deferred. Writing the deferred messages to stdio is
+ * not included, it is done by the log thread in the background.
+ *
+ * The output can be decoded with `dist/tools/log_deferred/log_deferred.py`.
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "log.h"
+#include "timex.h"
+#include "ztimer.h"
+
+static void _print(const char *name, uint32_t time)
+{
+    printf("%-10s: %8lu calls/s\n", name,
+           (unsigned long)((uint64_t)CALLS * US_PER_SEC / time));
+}
+
+int main(void)
+{
+    uint32_t start;
+    uint32_t printf_time;
+    uint32_t deferred_time;
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < CALLS; i++) {
+        printf("message %u of %u\n", i, CALLS);
+    }
+    printf_time = ztimer_now(ZTIMER_USEC) - start;
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < CALLS; i++) {
+        LOG_INFO("message %u of %u\n", i, CALLS);
+    }
+    deferred_time = ztimer_now(ZTIMER_USEC) - start;
+
+    LOG_WARNING("%s done\n", "log_deferred");
+    log_deferred_flush();
+
+    _print("printf", printf_time);
+    _print("deferred", deferred_time);
+
+    puts("DONE");
+    return 0;
+}
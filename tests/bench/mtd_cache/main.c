@@ -0,0 +1,167 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for the MTD sector cache
+ *
+ * Writes a region of an emulated MTD in small chunks, as file systems do,
+ * once directly using read-modify-write and once through the sector cache,
+ * and reports the number of sector erases and the throughput.
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "kernel_defines.h"
+#include "mtd.h"
+#include "mtd_cache.h"
+#include "mtd_emulated.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#define SECTOR_COUNT        (16U)
+#define PAGE_PER_SECTOR     (8U)
+#define PAGE_SIZE           (256U)
+
+/* size of a single write, e.g. littlefs prog_size */
+#ifndef CHUNK_SIZE
+#define CHUNK_SIZE          (16U)
+#endif
+
+/* simulated sector erase time, the emulated MTD erases instantly */
+#ifndef ERASE_TIME_US
+#define ERASE_TIME_US       (100U)
+#endif
+
+#define SECTOR_SIZE         (PAGE_PER_SECTOR * PAGE_SIZE)
+#define REGION_SIZE         (SECTOR_SIZE * SECTOR_COUNT)
+
+MTD_EMULATED_DEV(0, SECTOR_COUNT, PAGE_PER_SECTOR, PAGE_SIZE);
+
+/* pass-through device counting the erases of the emulated MTD */
+typedef struct {
+    mtd_dev_t mtd;
+    mtd_dev_t *parent;
+    unsigned erases;
+} counting_mtd_t;
+
+static int _count_init(mtd_dev_t *mtd)
+{
+    counting_mtd_t *dev = container_of(mtd, counting_mtd_t, mtd);
+
+    return mtd_init(dev->parent);
+}
+
+static int _count_read_page(mtd_dev_t *mtd, void *dest, uint32_t page,
+                            uint32_t offset, uint32_t count)
+{
+    counting_mtd_t *dev = container_of(mtd, counting_mtd_t, mtd);
+
+    count = MIN(count, mtd->page_size - offset);
+    int res = mtd_read_page(dev->parent, dest, page, offset, count);
+    return res < 0 ? res : (int)count;
+}
+
+static int _count_write_page(mtd_dev_t *mtd, const void *src, uint32_t page,
+                             uint32_t offset, uint32_t count)
+{
+    counting_mtd_t *dev = container_of(mtd, counting_mtd_t, mtd);
+
+    count = MIN(count, mtd->page_size - offset);
+    int res = mtd_write_page_raw(dev->parent, src, page, offset, count);
+    return res < 0 ? res : (int)count;
+}
+
+static int _count_erase_sector(mtd_dev_t *mtd, uint32_t sector, uint32_t count)
+{
+    counting_mtd_t *dev = container_of(mtd, counting_mtd_t, mtd);
+
+    dev->erases += count;
+    if (ERASE_TIME_US) {
+        ztimer_spin(ZTIMER_USEC, count * ERASE_TIME_US);
+    }
+    return mtd_erase_sector(dev->parent, sector, count);
+}
+
+static const mtd_desc_t _count_driver = {
+    .init = _count_init,
+    .read_page = _count_read_page,
+    .write_page = _count_write_page,
+    .erase_sector = _count_erase_sector,
+};
+
+static counting_mtd_t _counting = {
+    .mtd = {
+        .driver = &_count_driver,
+        .sector_count = SECTOR_COUNT,
+        .pages_per_sector = PAGE_PER_SECTOR,
+        .page_size = PAGE_SIZE,
+        .write_size = 1,
+    },
+    .parent = &mtd_emulated_dev0.base,
+};
+
+static uint8_t _cache_buf[MTD_CACHE_BUF_SIZE(SECTOR_SIZE)];
+static mtd_cache_t _cache = MTD_CACHE_INIT(&_counting.mtd, _cache_buf);
+
+static uint8_t _chunk[CHUNK_SIZE];
+
+static void _bench(const char *name, mtd_dev_t *dev)
+{
+    unsigned erases = _counting.erases;
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    for (uint32_t addr = 0; addr < REGION_SIZE; addr += CHUNK_SIZE) {
+        uint32_t page = addr / PAGE_SIZE;
+        if (mtd_write_page(dev, _chunk, page, addr % PAGE_SIZE, CHUNK_SIZE)) {
+            printf("%s: write failed\n", name);
+            return;
+        }
+    }
+    if (mtd_flush(dev)) {
+        printf("%s: flush failed\n", name);
+        return;
+    }
+
+    uint32_t duration = ztimer_now(ZTIMER_USEC) - start;
+    printf("%-8s %6u erases, %8" PRIu32 " us, %8" PRIu32 " KiB/s\n",
+           name, _counting.erases - erases, duration,
+           (uint32_t)(((uint64_t)REGION_SIZE * US_PER_SEC / 1024)
+                      / (duration ? duration : 1)));
+}
+
+int main(void)
+{
+    memset(_chunk, 0x5a, sizeof(_chunk));
+
+    if (mtd_init(&_cache.mtd) || mtd_init(&_counting.mtd)) {
+        puts("init failed");
+        return 1;
+    }
+
+    printf("writing %u bytes in chunks of %u bytes, %u cached sectors, "
+           "%u us per erase\n", REGION_SIZE, CHUNK_SIZE,
+           CONFIG_MTD_CACHE_SECTORS, ERASE_TIME_US);
+    _bench("direct", &_counting.mtd);
+    _bench("cached", &_cache.mtd);
+    printf("cache: %" PRIu32 " hits, %" PRIu32 " misses, %" PRIu32 " write-backs\n",
+           _cache.stats.hits, _cache.stats.misses, _cache.stats.writebacks);
+
+    puts("DONE");
+    return 0;
+}
@@ -0,0 +1,20 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect(r"direct\s+[0-9]+ erases, \s*[0-9]+ us, \s*[0-9]+ KiB/s")
+    child.expect(r"cached\s+[0-9]+ erases, \s*[0-9]+ us, \s*[0-9]+ KiB/s")
+    child.expect_exact("DONE")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
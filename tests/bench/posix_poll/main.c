@@ -0,0 +1,232 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for select() and poll() on POSIX sockets
+ *
+ * @ref IDLE_SOCKETS UDP sockets that never receive data are waited on together
+ * with one socket that receives a datagram, sent to the node's own address
+ * over a mocked Ethernet interface, before every call.
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "net/ethernet.h"
+#include "net/gnrc.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/netdev_test.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "timex.h"
+#include "ztimer.h"
+
+/* calls per measurement */
+#ifndef CALLS
+#define CALLS           (10000U)
+#endif
+
+#define PORT            (1350U)
+
+#define THREAD_FLAG_SEND    (1U << 0)
+
+static const uint8_t _l2addr[] = { 0x3e, 0xe6, 0xb5, 0x0f, 0x19, 0x22 };
+static const ipv6_addr_t _addr = { .u8 = {
+        0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    } };
+
+static char _mock_netif_stack[THREAD_STACKSIZE_DEFAULT];
+static char _sender_stack[THREAD_STACKSIZE_DEFAULT];
+static netdev_test_t _mock_dev;
+static gnrc_netif_t _netif;
+
+/* the receiving socket is the last one */
+static int _fds[IDLE_SOCKETS + 1];
+static int _max_fd;
+static int _sender;
+static thread_t *_sender_tcb;
+static struct sockaddr_in6 _dst = { .sin6_family = AF_INET6 };
+
+static int _get_device_type(netdev_t *netdev, void *value, size_t max_len)
+{
+    (void)netdev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_pdu_size(netdev_t *netdev, void *value, size_t max_len)
+{
+    (void)netdev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *netdev, void *value, size_t max_len)
+{
+    (void)netdev;
+    expect(max_len >= sizeof(_l2addr));
+    memcpy(value, _l2addr, sizeof(_l2addr));
+    return sizeof(_l2addr);
+}
+
+static void _init_mock_netif(void)
+{
+    netdev_test_setup(&_mock_dev, NULL);
+    netdev_test_set_get_cb(&_mock_dev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_mock_dev, NETOPT_MAX_PDU_SIZE, _get_max_pdu_size);
+    netdev_test_set_get_cb(&_mock_dev, NETOPT_ADDRESS, _get_address);
+    expect(gnrc_netif_ethernet_create(&_netif, _mock_netif_stack,
+                                      sizeof(_mock_netif_stack),
+                                      GNRC_NETIF_PRIO, "mock_netif",
+                                      &_mock_dev.netdev.netdev) == 0);
+    thread_yield_higher();
+    expect(gnrc_netif_ipv6_addr_add(&_netif, &_addr, 64,
+                                    GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID) > 0);
+}
+
+static void _init_sockets(void)
+{
+    struct sockaddr_in6 local = { .sin6_family = AF_INET6,
+                                  .sin6_addr = IN6ADDR_ANY_INIT };
+
+    for (unsigned i = 0; i <= IDLE_SOCKETS; i++) {
+        _fds[i] = socket(AF_INET6, SOCK_DGRAM, 0);
+        expect(_fds[i] >= 0);
+        local.sin6_port = htons(PORT + i);
+        expect(bind(_fds[i], (struct sockaddr *)&local, sizeof(local)) == 0);
+        if (_fds[i] > _max_fd) {
+            _max_fd = _fds[i];
+        }
+    }
+    _sender = socket(AF_INET6, SOCK_DGRAM, 0);
+    expect(_sender >= 0);
+    memcpy(&_dst.sin6_addr, &_addr, sizeof(_addr));
+    _dst.sin6_port = htons(PORT + IDLE_SOCKETS);
+}
+
+static void _send(void)
+{
+    static const uint8_t data[8];
+
+    expect(sendto(_sender, data, sizeof(data), 0, (struct sockaddr *)&_dst,
+                  sizeof(_dst)) == sizeof(data));
+}
+
+/* sends a datagram whenever main blocks after setting a flag */
+static void *_sender_thread(void *arg)
+{
+    (void)arg;
+    while (1) {
+        thread_flags_wait_any(THREAD_FLAG_SEND);
+        _send();
+    }
+    return NULL;
+}
+
+static void _recv(void)
+{
+    uint8_t data[8];
+
+    expect(recv(_fds[IDLE_SOCKETS], data, sizeof(data), 0) == sizeof(data));
+}
+
+static void _print(const char *name, uint32_t time)
+{
+    printf("%-10s: %8lu calls/s\n", name,
+           (unsigned long)((uint64_t)CALLS * US_PER_SEC / time));
+}
+
+int main(void)
+{
+    struct pollfd pfds[IDLE_SOCKETS + 1];
+    uint32_t start;
+
+    _init_mock_netif();
+    _init_sockets();
+    _sender_tcb = thread_get(thread_create(_sender_stack, sizeof(_sender_stack),
+                                           THREAD_PRIORITY_MAIN + 1, 0,
+                                           _sender_thread, NULL, "sender"));
+
+    for (unsigned j = 0; j <= IDLE_SOCKETS; j++) {
+        pfds[j].fd = _fds[j];
+        pfds[j].events = POLLIN;
+    }
+    /* sockets are bound on the first wait, nothing to read yet */
+    expect(poll(pfds, IDLE_SOCKETS + 1, 0) == 0);
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < CALLS; i++) {
+        fd_set readfds;
+
+        FD_ZERO(&readfds);
+        for (unsigned j = 0; j <= IDLE_SOCKETS; j++) {
+            FD_SET(_fds[j], &readfds);
+        }
+        /* UDP and IPv6 have higher priority, so the datagram is received
+         * before this returns */
+        _send();
+        expect(select(_max_fd + 1, &readfds, NULL, NULL, NULL) == 1);
+        expect(FD_ISSET(_fds[IDLE_SOCKETS], &readfds));
+        _recv();
+    }
+    _print("select", ztimer_now(ZTIMER_USEC) - start);
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < CALLS; i++) {
+        _send();
+        expect(poll(pfds, IDLE_SOCKETS + 1, -1) == 1);
+        expect(pfds[IDLE_SOCKETS].revents == POLLIN);
+        _recv();
+    }
+    _print("poll", ztimer_now(ZTIMER_USEC) - start);
+
+    /* a timeout flag left over from an earlier timer must not end a wait
+     * without timeout */
+    thread_flags_set(thread_get_active(), THREAD_FLAG_TIMEOUT);
+    thread_flags_set(_sender_tcb, THREAD_FLAG_SEND);
+    expect(poll(pfds, IDLE_SOCKETS + 1, -1) == 1);
+    _recv();
+    thread_flags_set(thread_get_active(), THREAD_FLAG_TIMEOUT);
+    thread_flags_set(_sender_tcb, THREAD_FLAG_SEND);
+    {
+        fd_set readfds;
+
+        FD_ZERO(&readfds);
+        FD_SET(_fds[IDLE_SOCKETS], &readfds);
+        expect(select(_max_fd + 1, &readfds, NULL, NULL, NULL) == 1);
+    }
+    _recv();
+
+    /* nothing to read: time out */
+    expect(poll(pfds, IDLE_SOCKETS + 1, 1) == 0);
+    /* sockets are always writable */
+    pfds[0].events = POLLIN | POLLOUT;
+    expect(poll(pfds, IDLE_SOCKETS + 1, 0) == 1);
+    expect(pfds[0].revents == POLLOUT);
+
+    puts("DONE");
+    return 0;
+}
@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for the chacha20poly1305 AEAD cipher
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "crypto/chacha20poly1305.h"
+#include "periph_conf.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#ifndef LOOPS
+#define LOOPS       (100U)
+#endif
+
+#define MSG_LEN     (1024U)
+#define CHUNK_LEN   (64U)
+
+static const uint8_t key[CHACHA20POLY1305_KEY_BYTES] = { 0x42 };
+static const uint8_t nonce[CHACHA20POLY1305_NONCE_BYTES] = { 0x23 };
+static const uint8_t aad[16] = { 0x17 };
+
+static uint8_t msg[MSG_LEN];
+static uint8_t cipher[MSG_LEN + CHACHA20POLY1305_TAG_BYTES];
+
+static void _print_result(const char *name, uint32_t duration)
+{
+    const uint32_t bytes = LOOPS * MSG_LEN;
+
+    printf("%-24s %8" PRIu32 " us, %8" PRIu32 " KiB/s", name, duration,
+           (uint32_t)(((uint64_t)bytes * US_PER_SEC / 1024) / duration));
+#ifdef CLOCK_CORECLOCK
+    /* cycles per byte, in hundredths */
+    uint64_t cpb = ((uint64_t)duration * (CLOCK_CORECLOCK / 10000))
+                 / bytes;
+    printf(", %" PRIu32 ".%02" PRIu32 " cycles/byte",
+           (uint32_t)(cpb / 100), (uint32_t)(cpb % 100));
+#endif
+    puts("");
+}
+
+static uint32_t _bench_encrypt(void)
+{
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    for (unsigned i = 0; i < LOOPS; i++) {
+        chacha20poly1305_encrypt(cipher, msg, sizeof(msg), aad, sizeof(aad),
+                                 key, nonce);
+    }
+    return ztimer_now(ZTIMER_USEC) - start;
+}
+
+static uint32_t _bench_decrypt(void)
+{
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    size_t len;
+
+    for (unsigned i = 0; i < LOOPS; i++) {
+        chacha20poly1305_decrypt(cipher, sizeof(cipher), msg, &len, aad,
+                                 sizeof(aad), key, nonce);
+    }
+    return ztimer_now(ZTIMER_USEC) - start;
+}
+
+static uint32_t _bench_stream(void)
+{
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    chacha20poly1305_stream_ctx_t ctx;
+
+    for (unsigned i = 0; i < LOOPS; i++) {
+        chacha20poly1305_stream_init(&ctx, key, nonce);
+        chacha20poly1305_stream_aad(&ctx, aad, sizeof(aad));
+        for (unsigned pos = 0; pos < sizeof(msg); pos += CHUNK_LEN) {
+            chacha20poly1305_stream_encrypt(&ctx, &cipher[pos], &msg[pos],
+                                            CHUNK_LEN);
+        }
+        chacha20poly1305_stream_finish(&ctx, &cipher[sizeof(msg)]);
+    }
+    return ztimer_now(ZTIMER_USEC) - start;
+}
+
+int main(void)
+{
+    size_t len;
+
+    for (unsigned i = 0; i < sizeof(msg); i++) {
+        msg[i] = i;
+    }
+
+    printf("chacha20poly1305: %u x %u bytes\n", LOOPS, MSG_LEN);
+    _print_result("encrypt", _bench_encrypt());
+    _print_result("decrypt", _bench_decrypt());
+    _print_result("stream encrypt (64 B)", _bench_stream());
+
+    if (chacha20poly1305_decrypt(cipher, sizeof(cipher), msg, &len, aad,
+                                 sizeof(aad), key, nonce) != 1) {
+        puts("FAILED");
+        return 1;
+    }
+    puts("DONE");
+    return 0;
+}
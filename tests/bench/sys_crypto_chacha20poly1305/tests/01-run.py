@@ -0,0 +1,21 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect(r"encrypt\s+[0-9]+ us, \s*[0-9]+ KiB/s")
+    child.expect(r"decrypt\s+[0-9]+ us, \s*[0-9]+ KiB/s")
+    child.expect(r"stream encrypt \(64 B\)\s+[0-9]+ us, \s*[0-9]+ KiB/s")
+    child.expect_exact("DONE")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,10016 @@
+/* DO NOT edit this file, your changes will be overwritten and won't take any effect! */
+#ifndef RIOT_PP_SUCCESSOR_H
+#define RIOT_PP_SUCCESSOR_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RIOT_PP_SUCCESSOR_MAX 9999
+
+#define RIOT_PP_SUCCESSOR_0 1
+#define RIOT_PP_SUCCESSOR_1 2
+#define RIOT_PP_SUCCESSOR_2 3
+#define RIOT_PP_SUCCESSOR_3 4
+#define RIOT_PP_SUCCESSOR_4 5
+#define RIOT_PP_SUCCESSOR_5 6
+#define RIOT_PP_SUCCESSOR_6 7
+#define RIOT_PP_SUCCESSOR_7 8
+#define RIOT_PP_SUCCESSOR_8 9
+#define RIOT_PP_SUCCESSOR_9 10
+#define RIOT_PP_SUCCESSOR_10 11
+#define RIOT_PP_SUCCESSOR_11 12
+#define RIOT_PP_SUCCESSOR_12 13
+#define RIOT_PP_SUCCESSOR_13 14
+#define RIOT_PP_SUCCESSOR_14 15
+#define RIOT_PP_SUCCESSOR_15 16
+#define RIOT_PP_SUCCESSOR_16 17
+#define RIOT_PP_SUCCESSOR_17 18
+#define RIOT_PP_SUCCESSOR_18 19
+#define RIOT_PP_SUCCESSOR_19 20
+#define RIOT_PP_SUCCESSOR_20 21
+#define RIOT_PP_SUCCESSOR_21 22
+#define RIOT_PP_SUCCESSOR_22 23
+#define RIOT_PP_SUCCESSOR_23 24
+#define RIOT_PP_SUCCESSOR_24 25
+#define RIOT_PP_SUCCESSOR_25 26
+#define RIOT_PP_SUCCESSOR_26 27
+#define RIOT_PP_SUCCESSOR_27 28
+#define RIOT_PP_SUCCESSOR_28 29
+#define RIOT_PP_SUCCESSOR_29 30
+#define RIOT_PP_SUCCESSOR_30 31
+#define RIOT_PP_SUCCESSOR_31 32
+#define RIOT_PP_SUCCESSOR_32 33
+#define RIOT_PP_SUCCESSOR_33 34
+#define RIOT_PP_SUCCESSOR_34 35
+#define RIOT_PP_SUCCESSOR_35 36
+#define RIOT_PP_SUCCESSOR_36 37
+#define RIOT_PP_SUCCESSOR_37 38
+#define RIOT_PP_SUCCESSOR_38 39
+#define RIOT_PP_SUCCESSOR_39 40
+#define RIOT_PP_SUCCESSOR_40 41
+#define RIOT_PP_SUCCESSOR_41 42
+#define RIOT_PP_SUCCESSOR_42 43
+#define RIOT_PP_SUCCESSOR_43 44
+#define RIOT_PP_SUCCESSOR_44 45
+#define RIOT_PP_SUCCESSOR_45 46
+#define RIOT_PP_SUCCESSOR_46 47
+#define RIOT_PP_SUCCESSOR_47 48
+#define RIOT_PP_SUCCESSOR_48 49
+#define RIOT_PP_SUCCESSOR_49 50
+#define RIOT_PP_SUCCESSOR_50 51
+#define RIOT_PP_SUCCESSOR_51 52
+#define RIOT_PP_SUCCESSOR_52 53
+#define RIOT_PP_SUCCESSOR_53 54
+#define RIOT_PP_SUCCESSOR_54 55
+#define RIOT_PP_SUCCESSOR_55 56
+#define RIOT_PP_SUCCESSOR_56 57
+#define RIOT_PP_SUCCESSOR_57 58
+#define RIOT_PP_SUCCESSOR_58 59
+#define RIOT_PP_SUCCESSOR_59 60
+#define RIOT_PP_SUCCESSOR_60 61
+#define RIOT_PP_SUCCESSOR_61 62
+#define RIOT_PP_SUCCESSOR_62 63
+#define RIOT_PP_SUCCESSOR_63 64
+#define RIOT_PP_SUCCESSOR_64 65
+#define RIOT_PP_SUCCESSOR_65 66
+#define RIOT_PP_SUCCESSOR_66 67
+#define RIOT_PP_SUCCESSOR_67 68
+#define RIOT_PP_SUCCESSOR_68 69
+#define RIOT_PP_SUCCESSOR_69 70
+#define RIOT_PP_SUCCESSOR_70 71
+#define RIOT_PP_SUCCESSOR_71 72
+#define RIOT_PP_SUCCESSOR_72 73
+#define RIOT_PP_SUCCESSOR_73 74
+#define RIOT_PP_SUCCESSOR_74 75
+#define RIOT_PP_SUCCESSOR_75 76
+#define RIOT_PP_SUCCESSOR_76 77
+#define RIOT_PP_SUCCESSOR_77 78
+#define RIOT_PP_SUCCESSOR_78 79
+#define RIOT_PP_SUCCESSOR_79 80
+#define RIOT_PP_SUCCESSOR_80 81
+#define RIOT_PP_SUCCESSOR_81 82
+#define RIOT_PP_SUCCESSOR_82 83
+#define RIOT_PP_SUCCESSOR_83 84
+#define RIOT_PP_SUCCESSOR_84 85
+#define RIOT_PP_SUCCESSOR_85 86
+#define RIOT_PP_SUCCESSOR_86 87
+#define RIOT_PP_SUCCESSOR_87 88
+#define RIOT_PP_SUCCESSOR_88 89
+#define RIOT_PP_SUCCESSOR_89 90
+#define RIOT_PP_SUCCESSOR_90 91
+#define RIOT_PP_SUCCESSOR_91 92
+#define RIOT_PP_SUCCESSOR_92 93
+#define RIOT_PP_SUCCESSOR_93 94
+#define RIOT_PP_SUCCESSOR_94 95
+#define RIOT_PP_SUCCESSOR_95 96
+#define RIOT_PP_SUCCESSOR_96 97
+#define RIOT_PP_SUCCESSOR_97 98
+#define RIOT_PP_SUCCESSOR_98 99
+#define RIOT_PP_SUCCESSOR_99 100
+#define RIOT_PP_SUCCESSOR_100 101
+#define RIOT_PP_SUCCESSOR_101 102
+#define RIOT_PP_SUCCESSOR_102 103
+#define RIOT_PP_SUCCESSOR_103 104
+#define RIOT_PP_SUCCESSOR_104 105
+#define RIOT_PP_SUCCESSOR_105 106
+#define RIOT_PP_SUCCESSOR_106 107
+#define RIOT_PP_SUCCESSOR_107 108
+#define RIOT_PP_SUCCESSOR_108 109
+#define RIOT_PP_SUCCESSOR_109 110
+#define RIOT_PP_SUCCESSOR_110 111
+#define RIOT_PP_SUCCESSOR_111 112
+#define RIOT_PP_SUCCESSOR_112 113
+#define RIOT_PP_SUCCESSOR_113 114
+#define RIOT_PP_SUCCESSOR_114 115
+#define RIOT_PP_SUCCESSOR_115 116
+#define RIOT_PP_SUCCESSOR_116 117
+#define RIOT_PP_SUCCESSOR_117 118
+#define RIOT_PP_SUCCESSOR_118 119
+#define RIOT_PP_SUCCESSOR_119 120
+#define RIOT_PP_SUCCESSOR_120 121
+#define RIOT_PP_SUCCESSOR_121 122
+#define RIOT_PP_SUCCESSOR_122 123
+#define RIOT_PP_SUCCESSOR_123 124
+#define RIOT_PP_SUCCESSOR_124 125
+#define RIOT_PP_SUCCESSOR_125 126
+#define RIOT_PP_SUCCESSOR_126 127
+#define RIOT_PP_SUCCESSOR_127 128
+#define RIOT_PP_SUCCESSOR_128 129
+#define RIOT_PP_SUCCESSOR_129 130
+#define RIOT_PP_SUCCESSOR_130 131
+#define RIOT_PP_SUCCESSOR_131 132
+#define RIOT_PP_SUCCESSOR_132 133
+#define RIOT_PP_SUCCESSOR_133 134
+#define RIOT_PP_SUCCESSOR_134 135
+#define RIOT_PP_SUCCESSOR_135 136
+#define RIOT_PP_SUCCESSOR_136 137
+#define RIOT_PP_SUCCESSOR_137 138
+#define RIOT_PP_SUCCESSOR_138 139
+#define RIOT_PP_SUCCESSOR_139 140
+#define RIOT_PP_SUCCESSOR_140 141
+#define RIOT_PP_SUCCESSOR_141 142
+#define RIOT_PP_SUCCESSOR_142 143
+#define RIOT_PP_SUCCESSOR_143 144
+#define RIOT_PP_SUCCESSOR_144 145
+#define RIOT_PP_SUCCESSOR_145 146
+#define RIOT_PP_SUCCESSOR_146 147
+#define RIOT_PP_SUCCESSOR_147 148
+#define RIOT_PP_SUCCESSOR_148 149
+#define RIOT_PP_SUCCESSOR_149 150
+#define RIOT_PP_SUCCESSOR_150 151
+#define RIOT_PP_SUCCESSOR_151 152
+#define RIOT_PP_SUCCESSOR_152 153
+#define RIOT_PP_SUCCESSOR_153 154
+#define RIOT_PP_SUCCESSOR_154 155
+#define RIOT_PP_SUCCESSOR_155 156
+#define RIOT_PP_SUCCESSOR_156 157
+#define RIOT_PP_SUCCESSOR_157 158
+#define RIOT_PP_SUCCESSOR_158 159
+#define RIOT_PP_SUCCESSOR_159 160
+#define RIOT_PP_SUCCESSOR_160 161
+#define RIOT_PP_SUCCESSOR_161 162
+#define RIOT_PP_SUCCESSOR_162 163
+#define RIOT_PP_SUCCESSOR_163 164
+#define RIOT_PP_SUCCESSOR_164 165
+#define RIOT_PP_SUCCESSOR_165 166
+#define RIOT_PP_SUCCESSOR_166 167
+#define RIOT_PP_SUCCESSOR_167 168
+#define RIOT_PP_SUCCESSOR_168 169
+#define RIOT_PP_SUCCESSOR_169 170
+#define RIOT_PP_SUCCESSOR_170 171
+#define RIOT_PP_SUCCESSOR_171 172
+#define RIOT_PP_SUCCESSOR_172 173
+#define RIOT_PP_SUCCESSOR_173 174
+#define RIOT_PP_SUCCESSOR_174 175
+#define RIOT_PP_SUCCESSOR_175 176
+#define RIOT_PP_SUCCESSOR_176 177
+#define RIOT_PP_SUCCESSOR_177 178
+#define RIOT_PP_SUCCESSOR_178 179
+#define RIOT_PP_SUCCESSOR_179 180
+#define RIOT_PP_SUCCESSOR_180 181
+#define RIOT_PP_SUCCESSOR_181 182
+#define RIOT_PP_SUCCESSOR_182 183
+#define RIOT_PP_SUCCESSOR_183 184
+#define RIOT_PP_SUCCESSOR_184 185
+#define RIOT_PP_SUCCESSOR_185 186
+#define RIOT_PP_SUCCESSOR_186 187
+#define RIOT_PP_SUCCESSOR_187 188
+#define RIOT_PP_SUCCESSOR_188 189
+#define RIOT_PP_SUCCESSOR_189 190
+#define RIOT_PP_SUCCESSOR_190 191
+#define RIOT_PP_SUCCESSOR_191 192
+#define RIOT_PP_SUCCESSOR_192 193
+#define RIOT_PP_SUCCESSOR_193 194
+#define RIOT_PP_SUCCESSOR_194 195
+#define RIOT_PP_SUCCESSOR_195 196
+#define RIOT_PP_SUCCESSOR_196 197
+#define RIOT_PP_SUCCESSOR_197 198
+#define RIOT_PP_SUCCESSOR_198 199
+#define RIOT_PP_SUCCESSOR_199 200
+#define RIOT_PP_SUCCESSOR_200 201
+#define RIOT_PP_SUCCESSOR_201 202
+#define RIOT_PP_SUCCESSOR_202 203
+#define RIOT_PP_SUCCESSOR_203 204
+#define RIOT_PP_SUCCESSOR_204 205
+#define RIOT_PP_SUCCESSOR_205 206
+#define RIOT_PP_SUCCESSOR_206 207
+#define RIOT_PP_SUCCESSOR_207 208
+#define RIOT_PP_SUCCESSOR_208 209
+#define RIOT_PP_SUCCESSOR_209 210
+#define RIOT_PP_SUCCESSOR_210 211
+#define RIOT_PP_SUCCESSOR_211 212
+#define RIOT_PP_SUCCESSOR_212 213
+#define RIOT_PP_SUCCESSOR_213 214
+#define RIOT_PP_SUCCESSOR_214 215
+#define RIOT_PP_SUCCESSOR_215 216
+#define RIOT_PP_SUCCESSOR_216 217
+#define RIOT_PP_SUCCESSOR_217 218
+#define RIOT_PP_SUCCESSOR_218 219
+#define RIOT_PP_SUCCESSOR_219 220
+#define RIOT_PP_SUCCESSOR_220 221
+#define RIOT_PP_SUCCESSOR_221 222
+#define RIOT_PP_SUCCESSOR_222 223
+#define RIOT_PP_SUCCESSOR_223 224
+#define RIOT_PP_SUCCESSOR_224 225
+#define RIOT_PP_SUCCESSOR_225 226
+#define RIOT_PP_SUCCESSOR_226 227
+#define RIOT_PP_SUCCESSOR_227 228
+#define RIOT_PP_SUCCESSOR_228 229
+#define RIOT_PP_SUCCESSOR_229 230
+#define RIOT_PP_SUCCESSOR_230 231
+#define RIOT_PP_SUCCESSOR_231 232
+#define RIOT_PP_SUCCESSOR_232 233
+#define RIOT_PP_SUCCESSOR_233 234
+#define RIOT_PP_SUCCESSOR_234 235
+#define RIOT_PP_SUCCESSOR_235 236
+#define RIOT_PP_SUCCESSOR_236 237
+#define RIOT_PP_SUCCESSOR_237 238
+#define RIOT_PP_SUCCESSOR_238 239
+#define RIOT_PP_SUCCESSOR_239 240
+#define RIOT_PP_SUCCESSOR_240 241
+#define RIOT_PP_SUCCESSOR_241 242
+#define RIOT_PP_SUCCESSOR_242 243
+#define RIOT_PP_SUCCESSOR_243 244
+#define RIOT_PP_SUCCESSOR_244 245
+#define RIOT_PP_SUCCESSOR_245 246
+#define RIOT_PP_SUCCESSOR_246 247
+#define RIOT_PP_SUCCESSOR_247 248
+#define RIOT_PP_SUCCESSOR_248 249
+#define RIOT_PP_SUCCESSOR_249 250
+#define RIOT_PP_SUCCESSOR_250 251
+#define RIOT_PP_SUCCESSOR_251 252
+#define RIOT_PP_SUCCESSOR_252 253
+#define RIOT_PP_SUCCESSOR_253 254
+#define RIOT_PP_SUCCESSOR_254 255
+#define RIOT_PP_SUCCESSOR_255 256
+#define RIOT_PP_SUCCESSOR_256 257
+#define RIOT_PP_SUCCESSOR_257 258
+#define RIOT_PP_SUCCESSOR_258 259
+#define RIOT_PP_SUCCESSOR_259 260
+#define RIOT_PP_SUCCESSOR_260 261
+#define RIOT_PP_SUCCESSOR_261 262
+#define RIOT_PP_SUCCESSOR_262 263
+#define RIOT_PP_SUCCESSOR_263 264
+#define RIOT_PP_SUCCESSOR_264 265
+#define RIOT_PP_SUCCESSOR_265 266
+#define RIOT_PP_SUCCESSOR_266 267
+#define RIOT_PP_SUCCESSOR_267 268
+#define RIOT_PP_SUCCESSOR_268 269
+#define RIOT_PP_SUCCESSOR_269 270
+#define RIOT_PP_SUCCESSOR_270 271
+#define RIOT_PP_SUCCESSOR_271 272
+#define RIOT_PP_SUCCESSOR_272 273
+#define RIOT_PP_SUCCESSOR_273 274
+#define RIOT_PP_SUCCESSOR_274 275
+#define RIOT_PP_SUCCESSOR_275 276
+#define RIOT_PP_SUCCESSOR_276 277
+#define RIOT_PP_SUCCESSOR_277 278
+#define RIOT_PP_SUCCESSOR_278 279
+#define RIOT_PP_SUCCESSOR_279 280
+#define RIOT_PP_SUCCESSOR_280 281
+#define RIOT_PP_SUCCESSOR_281 282
+#define RIOT_PP_SUCCESSOR_282 283
+#define RIOT_PP_SUCCESSOR_283 284
+#define RIOT_PP_SUCCESSOR_284 285
+#define RIOT_PP_SUCCESSOR_285 286
+#define RIOT_PP_SUCCESSOR_286 287
+#define RIOT_PP_SUCCESSOR_287 288
+#define RIOT_PP_SUCCESSOR_288 289
+#define RIOT_PP_SUCCESSOR_289 290
+#define RIOT_PP_SUCCESSOR_290 291
+#define RIOT_PP_SUCCESSOR_291 292
+#define RIOT_PP_SUCCESSOR_292 293
+#define RIOT_PP_SUCCESSOR_293 294
+#define RIOT_PP_SUCCESSOR_294 295
+#define RIOT_PP_SUCCESSOR_295 296
+#define RIOT_PP_SUCCESSOR_296 297
+#define RIOT_PP_SUCCESSOR_297 298
+#define RIOT_PP_SUCCESSOR_298 299
+#define RIOT_PP_SUCCESSOR_299 300
+#define RIOT_PP_SUCCESSOR_300 301
+#define RIOT_PP_SUCCESSOR_301 302
+#define RIOT_PP_SUCCESSOR_302 303
+#define RIOT_PP_SUCCESSOR_303 304
+#define RIOT_PP_SUCCESSOR_304 305
+#define RIOT_PP_SUCCESSOR_305 306
+#define RIOT_PP_SUCCESSOR_306 307
+#define RIOT_PP_SUCCESSOR_307 308
+#define RIOT_PP_SUCCESSOR_308 309
+#define RIOT_PP_SUCCESSOR_309 310
+#define RIOT_PP_SUCCESSOR_310 311
+#define RIOT_PP_SUCCESSOR_311 312
+#define RIOT_PP_SUCCESSOR_312 313
+#define RIOT_PP_SUCCESSOR_313 314
+#define RIOT_PP_SUCCESSOR_314 315
+#define RIOT_PP_SUCCESSOR_315 316
+#define RIOT_PP_SUCCESSOR_316 317
+#define RIOT_PP_SUCCESSOR_317 318
+#define RIOT_PP_SUCCESSOR_318 319
+#define RIOT_PP_SUCCESSOR_319 320
+#define RIOT_PP_SUCCESSOR_320 321
+#define RIOT_PP_SUCCESSOR_321 322
+#define RIOT_PP_SUCCESSOR_322 323
+#define RIOT_PP_SUCCESSOR_323 324
+#define RIOT_PP_SUCCESSOR_324 325
+#define RIOT_PP_SUCCESSOR_325 326
+#define RIOT_PP_SUCCESSOR_326 327
+#define RIOT_PP_SUCCESSOR_327 328
+#define RIOT_PP_SUCCESSOR_328 329
+#define RIOT_PP_SUCCESSOR_329 330
+#define RIOT_PP_SUCCESSOR_330 331
+#define RIOT_PP_SUCCESSOR_331 332
+#define RIOT_PP_SUCCESSOR_332 333
+#define RIOT_PP_SUCCESSOR_333 334
+#define RIOT_PP_SUCCESSOR_334 335
+#define RIOT_PP_SUCCESSOR_335 336
+#define RIOT_PP_SUCCESSOR_336 337
+#define RIOT_PP_SUCCESSOR_337 338
+#define RIOT_PP_SUCCESSOR_338 339
+#define RIOT_PP_SUCCESSOR_339 340
+#define RIOT_PP_SUCCESSOR_340 341
+#define RIOT_PP_SUCCESSOR_341 342
+#define RIOT_PP_SUCCESSOR_342 343
+#define RIOT_PP_SUCCESSOR_343 344
+#define RIOT_PP_SUCCESSOR_344 345
+#define RIOT_PP_SUCCESSOR_345 346
+#define RIOT_PP_SUCCESSOR_346 347
+#define RIOT_PP_SUCCESSOR_347 348
+#define RIOT_PP_SUCCESSOR_348 349
+#define RIOT_PP_SUCCESSOR_349 350
+#define RIOT_PP_SUCCESSOR_350 351
+#define RIOT_PP_SUCCESSOR_351 352
+#define RIOT_PP_SUCCESSOR_352 353
+#define RIOT_PP_SUCCESSOR_353 354
+#define RIOT_PP_SUCCESSOR_354 355
+#define RIOT_PP_SUCCESSOR_355 356
+#define RIOT_PP_SUCCESSOR_356 357
+#define RIOT_PP_SUCCESSOR_357 358
+#define RIOT_PP_SUCCESSOR_358 359
+#define RIOT_PP_SUCCESSOR_359 360
+#define RIOT_PP_SUCCESSOR_360 361
+#define RIOT_PP_SUCCESSOR_361 362
+#define RIOT_PP_SUCCESSOR_362 363
+#define RIOT_PP_SUCCESSOR_363 364
+#define RIOT_PP_SUCCESSOR_364 365
+#define RIOT_PP_SUCCESSOR_365 366
+#define RIOT_PP_SUCCESSOR_366 367
+#define RIOT_PP_SUCCESSOR_367 368
+#define RIOT_PP_SUCCESSOR_368 369
+#define RIOT_PP_SUCCESSOR_369 370
+#define RIOT_PP_SUCCESSOR_370 371
+#define RIOT_PP_SUCCESSOR_371 372
+#define RIOT_PP_SUCCESSOR_372 373
+#define RIOT_PP_SUCCESSOR_373 374
+#define RIOT_PP_SUCCESSOR_374 375
+#define RIOT_PP_SUCCESSOR_375 376
+#define RIOT_PP_SUCCESSOR_376 377
+#define RIOT_PP_SUCCESSOR_377 378
+#define RIOT_PP_SUCCESSOR_378 379
+#define RIOT_PP_SUCCESSOR_379 380
+#define RIOT_PP_SUCCESSOR_380 381
+#define RIOT_PP_SUCCESSOR_381 382
+#define RIOT_PP_SUCCESSOR_382 383
+#define RIOT_PP_SUCCESSOR_383 384
+#define RIOT_PP_SUCCESSOR_384 385
+#define RIOT_PP_SUCCESSOR_385 386
+#define RIOT_PP_SUCCESSOR_386 387
+#define RIOT_PP_SUCCESSOR_387 388
+#define RIOT_PP_SUCCESSOR_388 389
+#define RIOT_PP_SUCCESSOR_389 390
+#define RIOT_PP_SUCCESSOR_390 391
+#define RIOT_PP_SUCCESSOR_391 392
+#define RIOT_PP_SUCCESSOR_392 393
+#define RIOT_PP_SUCCESSOR_393 394
+#define RIOT_PP_SUCCESSOR_394 395
+#define RIOT_PP_SUCCESSOR_395 396
+#define RIOT_PP_SUCCESSOR_396 397
+#define RIOT_PP_SUCCESSOR_397 398
+#define RIOT_PP_SUCCESSOR_398 399
+#define RIOT_PP_SUCCESSOR_399 400
+#define RIOT_PP_SUCCESSOR_400 401
+#define RIOT_PP_SUCCESSOR_401 402
+#define RIOT_PP_SUCCESSOR_402 403
+#define RIOT_PP_SUCCESSOR_403 404
+#define RIOT_PP_SUCCESSOR_404 405
+#define RIOT_PP_SUCCESSOR_405 406
+#define RIOT_PP_SUCCESSOR_406 407
+#define RIOT_PP_SUCCESSOR_407 408
+#define RIOT_PP_SUCCESSOR_408 409
+#define RIOT_PP_SUCCESSOR_409 410
+#define RIOT_PP_SUCCESSOR_410 411
+#define RIOT_PP_SUCCESSOR_411 412
+#define RIOT_PP_SUCCESSOR_412 413
+#define RIOT_PP_SUCCESSOR_413 414
+#define RIOT_PP_SUCCESSOR_414 415
+#define RIOT_PP_SUCCESSOR_415 416
+#define RIOT_PP_SUCCESSOR_416 417
+#define RIOT_PP_SUCCESSOR_417 418
+#define RIOT_PP_SUCCESSOR_418 419
+#define RIOT_PP_SUCCESSOR_419 420
+#define RIOT_PP_SUCCESSOR_420 421
+#define RIOT_PP_SUCCESSOR_421 422
+#define RIOT_PP_SUCCESSOR_422 423
+#define RIOT_PP_SUCCESSOR_423 424
+#define RIOT_PP_SUCCESSOR_424 425
+#define RIOT_PP_SUCCESSOR_425 426
+#define RIOT_PP_SUCCESSOR_426 427
+#define RIOT_PP_SUCCESSOR_427 428
+#define RIOT_PP_SUCCESSOR_428 429
+#define RIOT_PP_SUCCESSOR_429 430
+#define RIOT_PP_SUCCESSOR_430 431
+#define RIOT_PP_SUCCESSOR_431 432
+#define RIOT_PP_SUCCESSOR_432 433
+#define RIOT_PP_SUCCESSOR_433 434
+#define RIOT_PP_SUCCESSOR_434 435
+#define RIOT_PP_SUCCESSOR_435 436
+#define RIOT_PP_SUCCESSOR_436 437
+#define RIOT_PP_SUCCESSOR_437 438
+#define RIOT_PP_SUCCESSOR_438 439
+#define RIOT_PP_SUCCESSOR_439 440
+#define RIOT_PP_SUCCESSOR_440 441
+#define RIOT_PP_SUCCESSOR_441 442
+#define RIOT_PP_SUCCESSOR_442 443
+#define RIOT_PP_SUCCESSOR_443 444
+#define RIOT_PP_SUCCESSOR_444 445
+#define RIOT_PP_SUCCESSOR_445 446
+#define RIOT_PP_SUCCESSOR_446 447
+#define RIOT_PP_SUCCESSOR_447 448
+#define RIOT_PP_SUCCESSOR_448 449
+#define RIOT_PP_SUCCESSOR_449 450
+#define RIOT_PP_SUCCESSOR_450 451
+#define RIOT_PP_SUCCESSOR_451 452
+#define RIOT_PP_SUCCESSOR_452 453
+#define RIOT_PP_SUCCESSOR_453 454
+#define RIOT_PP_SUCCESSOR_454 455
+#define RIOT_PP_SUCCESSOR_455 456
+#define RIOT_PP_SUCCESSOR_456 457
+#define RIOT_PP_SUCCESSOR_457 458
+#define RIOT_PP_SUCCESSOR_458 459
+#define RIOT_PP_SUCCESSOR_459 460
+#define RIOT_PP_SUCCESSOR_460 461
+#define RIOT_PP_SUCCESSOR_461 462
+#define RIOT_PP_SUCCESSOR_462 463
+#define RIOT_PP_SUCCESSOR_463 464
+#define RIOT_PP_SUCCESSOR_464 465
+#define RIOT_PP_SUCCESSOR_465 466
+#define RIOT_PP_SUCCESSOR_466 467
+#define RIOT_PP_SUCCESSOR_467 468
+#define RIOT_PP_SUCCESSOR_468 469
+#define RIOT_PP_SUCCESSOR_469 470
+#define RIOT_PP_SUCCESSOR_470 471
+#define RIOT_PP_SUCCESSOR_471 472
+#define RIOT_PP_SUCCESSOR_472 473
+#define RIOT_PP_SUCCESSOR_473 474
+#define RIOT_PP_SUCCESSOR_474 475
+#define RIOT_PP_SUCCESSOR_475 476
+#define RIOT_PP_SUCCESSOR_476 477
+#define RIOT_PP_SUCCESSOR_477 478
+#define RIOT_PP_SUCCESSOR_478 479
+#define RIOT_PP_SUCCESSOR_479 480
+#define RIOT_PP_SUCCESSOR_480 481
+#define RIOT_PP_SUCCESSOR_481 482
+#define RIOT_PP_SUCCESSOR_482 483
+#define RIOT_PP_SUCCESSOR_483 484
+#define RIOT_PP_SUCCESSOR_484 485
+#define RIOT_PP_SUCCESSOR_485 486
+#define RIOT_PP_SUCCESSOR_486 487
+#define RIOT_PP_SUCCESSOR_487 488
+#define RIOT_PP_SUCCESSOR_488 489
+#define RIOT_PP_SUCCESSOR_489 490
+#define RIOT_PP_SUCCESSOR_490 491
+#define RIOT_PP_SUCCESSOR_491 492
+#define RIOT_PP_SUCCESSOR_492 493
+#define RIOT_PP_SUCCESSOR_493 494
+#define RIOT_PP_SUCCESSOR_494 495
+#define RIOT_PP_SUCCESSOR_495 496
+#define RIOT_PP_SUCCESSOR_496 497
+#define RIOT_PP_SUCCESSOR_497 498
+#define RIOT_PP_SUCCESSOR_498 499
+#define RIOT_PP_SUCCESSOR_499 500
+#define RIOT_PP_SUCCESSOR_500 501
+#define RIOT_PP_SUCCESSOR_501 502
+#define RIOT_PP_SUCCESSOR_502 503
+#define RIOT_PP_SUCCESSOR_503 504
+#define RIOT_PP_SUCCESSOR_504 505
+#define RIOT_PP_SUCCESSOR_505 506
+#define RIOT_PP_SUCCESSOR_506 507
+#define RIOT_PP_SUCCESSOR_507 508
+#define RIOT_PP_SUCCESSOR_508 509
+#define RIOT_PP_SUCCESSOR_509 510
+#define RIOT_PP_SUCCESSOR_510 511
+#define RIOT_PP_SUCCESSOR_511 512
+#define RIOT_PP_SUCCESSOR_512 513
+#define RIOT_PP_SUCCESSOR_513 514
+#define RIOT_PP_SUCCESSOR_514 515
+#define RIOT_PP_SUCCESSOR_515 516
+#define RIOT_PP_SUCCESSOR_516 517
+#define RIOT_PP_SUCCESSOR_517 518
+#define RIOT_PP_SUCCESSOR_518 519
+#define RIOT_PP_SUCCESSOR_519 520
+#define RIOT_PP_SUCCESSOR_520 521
+#define RIOT_PP_SUCCESSOR_521 522
+#define RIOT_PP_SUCCESSOR_522 523
+#define RIOT_PP_SUCCESSOR_523 524
+#define RIOT_PP_SUCCESSOR_524 525
+#define RIOT_PP_SUCCESSOR_525 526
+#define RIOT_PP_SUCCESSOR_526 527
+#define RIOT_PP_SUCCESSOR_527 528
+#define RIOT_PP_SUCCESSOR_528 529
+#define RIOT_PP_SUCCESSOR_529 530
+#define RIOT_PP_SUCCESSOR_530 531
+#define RIOT_PP_SUCCESSOR_531 532
+#define RIOT_PP_SUCCESSOR_532 533
+#define RIOT_PP_SUCCESSOR_533 534
+#define RIOT_PP_SUCCESSOR_534 535
+#define RIOT_PP_SUCCESSOR_535 536
+#define RIOT_PP_SUCCESSOR_536 537
+#define RIOT_PP_SUCCESSOR_537 538
+#define RIOT_PP_SUCCESSOR_538 539
+#define RIOT_PP_SUCCESSOR_539 540
+#define RIOT_PP_SUCCESSOR_540 541
+#define RIOT_PP_SUCCESSOR_541 542
+#define RIOT_PP_SUCCESSOR_542 543
+#define RIOT_PP_SUCCESSOR_543 544
+#define RIOT_PP_SUCCESSOR_544 545
+#define RIOT_PP_SUCCESSOR_545 546
+#define RIOT_PP_SUCCESSOR_546 547
+#define RIOT_PP_SUCCESSOR_547 548
+#define RIOT_PP_SUCCESSOR_548 549
+#define RIOT_PP_SUCCESSOR_549 550
+#define RIOT_PP_SUCCESSOR_550 551
+#define RIOT_PP_SUCCESSOR_551 552
+#define RIOT_PP_SUCCESSOR_552 553
+#define RIOT_PP_SUCCESSOR_553 554
+#define RIOT_PP_SUCCESSOR_554 555
+#define RIOT_PP_SUCCESSOR_555 556
+#define RIOT_PP_SUCCESSOR_556 557
+#define RIOT_PP_SUCCESSOR_557 558
+#define RIOT_PP_SUCCESSOR_558 559
+#define RIOT_PP_SUCCESSOR_559 560
+#define RIOT_PP_SUCCESSOR_560 561
+#define RIOT_PP_SUCCESSOR_561 562
+#define RIOT_PP_SUCCESSOR_562 563
+#define RIOT_PP_SUCCESSOR_563 564
+#define RIOT_PP_SUCCESSOR_564 565
+#define RIOT_PP_SUCCESSOR_565 566
+#define RIOT_PP_SUCCESSOR_566 567
+#define RIOT_PP_SUCCESSOR_567 568
+#define RIOT_PP_SUCCESSOR_568 569
+#define RIOT_PP_SUCCESSOR_569 570
+#define RIOT_PP_SUCCESSOR_570 571
+#define RIOT_PP_SUCCESSOR_571 572
+#define RIOT_PP_SUCCESSOR_572 573
+#define RIOT_PP_SUCCESSOR_573 574
+#define RIOT_PP_SUCCESSOR_574 575
+#define RIOT_PP_SUCCESSOR_575 576
+#define RIOT_PP_SUCCESSOR_576 577
+#define RIOT_PP_SUCCESSOR_577 578
+#define RIOT_PP_SUCCESSOR_578 579
+#define RIOT_PP_SUCCESSOR_579 580
+#define RIOT_PP_SUCCESSOR_580 581
+#define RIOT_PP_SUCCESSOR_581 582
+#define RIOT_PP_SUCCESSOR_582 583
+#define RIOT_PP_SUCCESSOR_583 584
+#define RIOT_PP_SUCCESSOR_584 585
+#define RIOT_PP_SUCCESSOR_585 586
+#define RIOT_PP_SUCCESSOR_586 587
+#define RIOT_PP_SUCCESSOR_587 588
+#define RIOT_PP_SUCCESSOR_588 589
+#define RIOT_PP_SUCCESSOR_589 590
+#define RIOT_PP_SUCCESSOR_590 591
+#define RIOT_PP_SUCCESSOR_591 592
+#define RIOT_PP_SUCCESSOR_592 593
+#define RIOT_PP_SUCCESSOR_593 594
+#define RIOT_PP_SUCCESSOR_594 595
+#define RIOT_PP_SUCCESSOR_595 596
+#define RIOT_PP_SUCCESSOR_596 597
+#define RIOT_PP_SUCCESSOR_597 598
+#define RIOT_PP_SUCCESSOR_598 599
+#define RIOT_PP_SUCCESSOR_599 600
+#define RIOT_PP_SUCCESSOR_600 601
+#define RIOT_PP_SUCCESSOR_601 602
+#define RIOT_PP_SUCCESSOR_602 603
+#define RIOT_PP_SUCCESSOR_603 604
+#define RIOT_PP_SUCCESSOR_604 605
+#define RIOT_PP_SUCCESSOR_605 606
+#define RIOT_PP_SUCCESSOR_606 607
+#define RIOT_PP_SUCCESSOR_607 608
+#define RIOT_PP_SUCCESSOR_608 609
+#define RIOT_PP_SUCCESSOR_609 610
+#define RIOT_PP_SUCCESSOR_610 611
+#define RIOT_PP_SUCCESSOR_611 612
+#define RIOT_PP_SUCCESSOR_612 613
+#define RIOT_PP_SUCCESSOR_613 614
+#define RIOT_PP_SUCCESSOR_614 615
+#define RIOT_PP_SUCCESSOR_615 616
+#define RIOT_PP_SUCCESSOR_616 617
+#define RIOT_PP_SUCCESSOR_617 618
+#define RIOT_PP_SUCCESSOR_618 619
+#define RIOT_PP_SUCCESSOR_619 620
+#define RIOT_PP_SUCCESSOR_620 621
+#define RIOT_PP_SUCCESSOR_621 622
+#define RIOT_PP_SUCCESSOR_622 623
+#define RIOT_PP_SUCCESSOR_623 624
+#define RIOT_PP_SUCCESSOR_624 625
+#define RIOT_PP_SUCCESSOR_625 626
+#define RIOT_PP_SUCCESSOR_626 627
+#define RIOT_PP_SUCCESSOR_627 628
+#define RIOT_PP_SUCCESSOR_628 629
+#define RIOT_PP_SUCCESSOR_629 630
+#define RIOT_PP_SUCCESSOR_630 631
+#define RIOT_PP_SUCCESSOR_631 632
+#define RIOT_PP_SUCCESSOR_632 633
+#define RIOT_PP_SUCCESSOR_633 634
+#define RIOT_PP_SUCCESSOR_634 635
+#define RIOT_PP_SUCCESSOR_635 636
+#define RIOT_PP_SUCCESSOR_636 637
+#define RIOT_PP_SUCCESSOR_637 638
+#define RIOT_PP_SUCCESSOR_638 639
+#define RIOT_PP_SUCCESSOR_639 640
+#define RIOT_PP_SUCCESSOR_640 641
+#define RIOT_PP_SUCCESSOR_641 642
+#define RIOT_PP_SUCCESSOR_642 643
+#define RIOT_PP_SUCCESSOR_643 644
+#define RIOT_PP_SUCCESSOR_644 645
+#define RIOT_PP_SUCCESSOR_645 646
+#define RIOT_PP_SUCCESSOR_646 647
+#define RIOT_PP_SUCCESSOR_647 648
+#define RIOT_PP_SUCCESSOR_648 649
+#define RIOT_PP_SUCCESSOR_649 650
+#define RIOT_PP_SUCCESSOR_650 651
+#define RIOT_PP_SUCCESSOR_651 652
+#define RIOT_PP_SUCCESSOR_652 653
+#define RIOT_PP_SUCCESSOR_653 654
+#define RIOT_PP_SUCCESSOR_654 655
+#define RIOT_PP_SUCCESSOR_655 656
+#define RIOT_PP_SUCCESSOR_656 657
+#define RIOT_PP_SUCCESSOR_657 658
+#define RIOT_PP_SUCCESSOR_658 659
+#define RIOT_PP_SUCCESSOR_659 660
+#define RIOT_PP_SUCCESSOR_660 661
+#define RIOT_PP_SUCCESSOR_661 662
+#define RIOT_PP_SUCCESSOR_662 663
+#define RIOT_PP_SUCCESSOR_663 664
+#define RIOT_PP_SUCCESSOR_664 665
+#define RIOT_PP_SUCCESSOR_665 666
+#define RIOT_PP_SUCCESSOR_666 667
+#define RIOT_PP_SUCCESSOR_667 668
+#define RIOT_PP_SUCCESSOR_668 669
+#define RIOT_PP_SUCCESSOR_669 670
+#define RIOT_PP_SUCCESSOR_670 671
+#define RIOT_PP_SUCCESSOR_671 672
+#define RIOT_PP_SUCCESSOR_672 673
+#define RIOT_PP_SUCCESSOR_673 674
+#define RIOT_PP_SUCCESSOR_674 675
+#define RIOT_PP_SUCCESSOR_675 676
+#define RIOT_PP_SUCCESSOR_676 677
+#define RIOT_PP_SUCCESSOR_677 678
+#define RIOT_PP_SUCCESSOR_678 679
+#define RIOT_PP_SUCCESSOR_679 680
+#define RIOT_PP_SUCCESSOR_680 681
+#define RIOT_PP_SUCCESSOR_681 682
+#define RIOT_PP_SUCCESSOR_682 683
+#define RIOT_PP_SUCCESSOR_683 684
+#define RIOT_PP_SUCCESSOR_684 685
+#define RIOT_PP_SUCCESSOR_685 686
+#define RIOT_PP_SUCCESSOR_686 687
+#define RIOT_PP_SUCCESSOR_687 688
+#define RIOT_PP_SUCCESSOR_688 689
+#define RIOT_PP_SUCCESSOR_689 690
+#define RIOT_PP_SUCCESSOR_690 691
+#define RIOT_PP_SUCCESSOR_691 692
+#define RIOT_PP_SUCCESSOR_692 693
+#define RIOT_PP_SUCCESSOR_693 694
+#define RIOT_PP_SUCCESSOR_694 695
+#define RIOT_PP_SUCCESSOR_695 696
+#define RIOT_PP_SUCCESSOR_696 697
+#define RIOT_PP_SUCCESSOR_697 698
+#define RIOT_PP_SUCCESSOR_698 699
+#define RIOT_PP_SUCCESSOR_699 700
+#define RIOT_PP_SUCCESSOR_700 701
+#define RIOT_PP_SUCCESSOR_701 702
+#define RIOT_PP_SUCCESSOR_702 703
+#define RIOT_PP_SUCCESSOR_703 704
+#define RIOT_PP_SUCCESSOR_704 705
+#define RIOT_PP_SUCCESSOR_705 706
+#define RIOT_PP_SUCCESSOR_706 707
+#define RIOT_PP_SUCCESSOR_707 708
+#define RIOT_PP_SUCCESSOR_708 709
+#define RIOT_PP_SUCCESSOR_709 710
+#define RIOT_PP_SUCCESSOR_710 711
+#define RIOT_PP_SUCCESSOR_711 712
+#define RIOT_PP_SUCCESSOR_712 713
+#define RIOT_PP_SUCCESSOR_713 714
+#define RIOT_PP_SUCCESSOR_714 715
+#define RIOT_PP_SUCCESSOR_715 716
+#define RIOT_PP_SUCCESSOR_716 717
+#define RIOT_PP_SUCCESSOR_717 718
+#define RIOT_PP_SUCCESSOR_718 719
+#define RIOT_PP_SUCCESSOR_719 720
+#define RIOT_PP_SUCCESSOR_720 721
+#define RIOT_PP_SUCCESSOR_721 722
+#define RIOT_PP_SUCCESSOR_722 723
+#define RIOT_PP_SUCCESSOR_723 724
+#define RIOT_PP_SUCCESSOR_724 725
+#define RIOT_PP_SUCCESSOR_725 726
+#define RIOT_PP_SUCCESSOR_726 727
+#define RIOT_PP_SUCCESSOR_727 728
+#define RIOT_PP_SUCCESSOR_728 729
+#define RIOT_PP_SUCCESSOR_729 730
+#define RIOT_PP_SUCCESSOR_730 731
+#define RIOT_PP_SUCCESSOR_731 732
+#define RIOT_PP_SUCCESSOR_732 733
+#define RIOT_PP_SUCCESSOR_733 734
+#define RIOT_PP_SUCCESSOR_734 735
+#define RIOT_PP_SUCCESSOR_735 736
+#define RIOT_PP_SUCCESSOR_736 737
+#define RIOT_PP_SUCCESSOR_737 738
+#define RIOT_PP_SUCCESSOR_738 739
+#define RIOT_PP_SUCCESSOR_739 740
+#define RIOT_PP_SUCCESSOR_740 741
+#define RIOT_PP_SUCCESSOR_741 742
+#define RIOT_PP_SUCCESSOR_742 743
+#define RIOT_PP_SUCCESSOR_743 744
+#define RIOT_PP_SUCCESSOR_744 745
+#define RIOT_PP_SUCCESSOR_745 746
+#define RIOT_PP_SUCCESSOR_746 747
+#define RIOT_PP_SUCCESSOR_747 748
+#define RIOT_PP_SUCCESSOR_748 749
+#define RIOT_PP_SUCCESSOR_749 750
+#define RIOT_PP_SUCCESSOR_750 751
+#define RIOT_PP_SUCCESSOR_751 752
+#define RIOT_PP_SUCCESSOR_752 753
+#define RIOT_PP_SUCCESSOR_753 754
+#define RIOT_PP_SUCCESSOR_754 755
+#define RIOT_PP_SUCCESSOR_755 756
+#define RIOT_PP_SUCCESSOR_756 757
+#define RIOT_PP_SUCCESSOR_757 758
+#define RIOT_PP_SUCCESSOR_758 759
+#define RIOT_PP_SUCCESSOR_759 760
+#define RIOT_PP_SUCCESSOR_760 761
+#define RIOT_PP_SUCCESSOR_761 762
+#define RIOT_PP_SUCCESSOR_762 763
+#define RIOT_PP_SUCCESSOR_763 764
+#define RIOT_PP_SUCCESSOR_764 765
+#define RIOT_PP_SUCCESSOR_765 766
+#define RIOT_PP_SUCCESSOR_766 767
+#define RIOT_PP_SUCCESSOR_767 768
+#define RIOT_PP_SUCCESSOR_768 769
+#define RIOT_PP_SUCCESSOR_769 770
+#define RIOT_PP_SUCCESSOR_770 771
+#define RIOT_PP_SUCCESSOR_771 772
+#define RIOT_PP_SUCCESSOR_772 773
+#define RIOT_PP_SUCCESSOR_773 774
+#define RIOT_PP_SUCCESSOR_774 775
+#define RIOT_PP_SUCCESSOR_775 776
+#define RIOT_PP_SUCCESSOR_776 777
+#define RIOT_PP_SUCCESSOR_777 778
+#define RIOT_PP_SUCCESSOR_778 779
+#define RIOT_PP_SUCCESSOR_779 780
+#define RIOT_PP_SUCCESSOR_780 781
+#define RIOT_PP_SUCCESSOR_781 782
+#define RIOT_PP_SUCCESSOR_782 783
+#define RIOT_PP_SUCCESSOR_783 784
+#define RIOT_PP_SUCCESSOR_784 785
+#define RIOT_PP_SUCCESSOR_785 786
+#define RIOT_PP_SUCCESSOR_786 787
+#define RIOT_PP_SUCCESSOR_787 788
+#define RIOT_PP_SUCCESSOR_788 789
+#define RIOT_PP_SUCCESSOR_789 790
+#define RIOT_PP_SUCCESSOR_790 791
+#define RIOT_PP_SUCCESSOR_791 792
+#define RIOT_PP_SUCCESSOR_792 793
+#define RIOT_PP_SUCCESSOR_793 794
+#define RIOT_PP_SUCCESSOR_794 795
+#define RIOT_PP_SUCCESSOR_795 796
+#define RIOT_PP_SUCCESSOR_796 797
+#define RIOT_PP_SUCCESSOR_797 798
+#define RIOT_PP_SUCCESSOR_798 799
+#define RIOT_PP_SUCCESSOR_799 800
+#define RIOT_PP_SUCCESSOR_800 801
+#define RIOT_PP_SUCCESSOR_801 802
+#define RIOT_PP_SUCCESSOR_802 803
+#define RIOT_PP_SUCCESSOR_803 804
+#define RIOT_PP_SUCCESSOR_804 805
+#define RIOT_PP_SUCCESSOR_805 806
+#define RIOT_PP_SUCCESSOR_806 807
+#define RIOT_PP_SUCCESSOR_807 808
+#define RIOT_PP_SUCCESSOR_808 809
+#define RIOT_PP_SUCCESSOR_809 810
+#define RIOT_PP_SUCCESSOR_810 811
+#define RIOT_PP_SUCCESSOR_811 812
+#define RIOT_PP_SUCCESSOR_812 813
+#define RIOT_PP_SUCCESSOR_813 814
+#define RIOT_PP_SUCCESSOR_814 815
+#define RIOT_PP_SUCCESSOR_815 816
+#define RIOT_PP_SUCCESSOR_816 817
+#define RIOT_PP_SUCCESSOR_817 818
+#define RIOT_PP_SUCCESSOR_818 819
+#define RIOT_PP_SUCCESSOR_819 820
+#define RIOT_PP_SUCCESSOR_820 821
+#define RIOT_PP_SUCCESSOR_821 822
+#define RIOT_PP_SUCCESSOR_822 823
+#define RIOT_PP_SUCCESSOR_823 824
+#define RIOT_PP_SUCCESSOR_824 825
+#define RIOT_PP_SUCCESSOR_825 826
+#define RIOT_PP_SUCCESSOR_826 827
+#define RIOT_PP_SUCCESSOR_827 828
+#define RIOT_PP_SUCCESSOR_828 829
+#define RIOT_PP_SUCCESSOR_829 830
+#define RIOT_PP_SUCCESSOR_830 831
+#define RIOT_PP_SUCCESSOR_831 832
+#define RIOT_PP_SUCCESSOR_832 833
+#define RIOT_PP_SUCCESSOR_833 834
+#define RIOT_PP_SUCCESSOR_834 835
+#define RIOT_PP_SUCCESSOR_835 836
+#define RIOT_PP_SUCCESSOR_836 837
+#define RIOT_PP_SUCCESSOR_837 838
+#define RIOT_PP_SUCCESSOR_838 839
+#define RIOT_PP_SUCCESSOR_839 840
+#define RIOT_PP_SUCCESSOR_840 841
+#define RIOT_PP_SUCCESSOR_841 842
+#define RIOT_PP_SUCCESSOR_842 843
+#define RIOT_PP_SUCCESSOR_843 844
+#define RIOT_PP_SUCCESSOR_844 845
+#define RIOT_PP_SUCCESSOR_845 846
+#define RIOT_PP_SUCCESSOR_846 847
+#define RIOT_PP_SUCCESSOR_847 848
+#define RIOT_PP_SUCCESSOR_848 849
+#define RIOT_PP_SUCCESSOR_849 850
+#define RIOT_PP_SUCCESSOR_850 851
+#define RIOT_PP_SUCCESSOR_851 852
+#define RIOT_PP_SUCCESSOR_852 853
+#define RIOT_PP_SUCCESSOR_853 854
+#define RIOT_PP_SUCCESSOR_854 855
+#define RIOT_PP_SUCCESSOR_855 856
+#define RIOT_PP_SUCCESSOR_856 857
+#define RIOT_PP_SUCCESSOR_857 858
+#define RIOT_PP_SUCCESSOR_858 859
+#define RIOT_PP_SUCCESSOR_859 860
+#define RIOT_PP_SUCCESSOR_860 861
+#define RIOT_PP_SUCCESSOR_861 862
+#define RIOT_PP_SUCCESSOR_862 863
+#define RIOT_PP_SUCCESSOR_863 864
+#define RIOT_PP_SUCCESSOR_864 865
+#define RIOT_PP_SUCCESSOR_865 866
+#define RIOT_PP_SUCCESSOR_866 867
+#define RIOT_PP_SUCCESSOR_867 868
+#define RIOT_PP_SUCCESSOR_868 869
+#define RIOT_PP_SUCCESSOR_869 870
+#define RIOT_PP_SUCCESSOR_870 871
+#define RIOT_PP_SUCCESSOR_871 872
+#define RIOT_PP_SUCCESSOR_872 873
+#define RIOT_PP_SUCCESSOR_873 874
+#define RIOT_PP_SUCCESSOR_874 875
+#define RIOT_PP_SUCCESSOR_875 876
+#define RIOT_PP_SUCCESSOR_876 877
+#define RIOT_PP_SUCCESSOR_877 878
+#define RIOT_PP_SUCCESSOR_878 879
+#define RIOT_PP_SUCCESSOR_879 880
+#define RIOT_PP_SUCCESSOR_880 881
+#define RIOT_PP_SUCCESSOR_881 882
+#define RIOT_PP_SUCCESSOR_882 883
+#define RIOT_PP_SUCCESSOR_883 884
+#define RIOT_PP_SUCCESSOR_884 885
+#define RIOT_PP_SUCCESSOR_885 886
+#define RIOT_PP_SUCCESSOR_886 887
+#define RIOT_PP_SUCCESSOR_887 888
+#define RIOT_PP_SUCCESSOR_888 889
+#define RIOT_PP_SUCCESSOR_889 890
+#define RIOT_PP_SUCCESSOR_890 891
+#define RIOT_PP_SUCCESSOR_891 892
+#define RIOT_PP_SUCCESSOR_892 893
+#define RIOT_PP_SUCCESSOR_893 894
+#define RIOT_PP_SUCCESSOR_894 895
+#define RIOT_PP_SUCCESSOR_895 896
+#define RIOT_PP_SUCCESSOR_896 897
+#define RIOT_PP_SUCCESSOR_897 898
+#define RIOT_PP_SUCCESSOR_898 899
+#define RIOT_PP_SUCCESSOR_899 900
+#define RIOT_PP_SUCCESSOR_900 901
+#define RIOT_PP_SUCCESSOR_901 902
+#define RIOT_PP_SUCCESSOR_902 903
+#define RIOT_PP_SUCCESSOR_903 904
+#define RIOT_PP_SUCCESSOR_904 905
+#define RIOT_PP_SUCCESSOR_905 906
+#define RIOT_PP_SUCCESSOR_906 907
+#define RIOT_PP_SUCCESSOR_907 908
+#define RIOT_PP_SUCCESSOR_908 909
+#define RIOT_PP_SUCCESSOR_909 910
+#define RIOT_PP_SUCCESSOR_910 911
+#define RIOT_PP_SUCCESSOR_911 912
+#define RIOT_PP_SUCCESSOR_912 913
+#define RIOT_PP_SUCCESSOR_913 914
+#define RIOT_PP_SUCCESSOR_914 915
+#define RIOT_PP_SUCCESSOR_915 916
+#define RIOT_PP_SUCCESSOR_916 917
+#define RIOT_PP_SUCCESSOR_917 918
+#define RIOT_PP_SUCCESSOR_918 919
+#define RIOT_PP_SUCCESSOR_919 920
+#define RIOT_PP_SUCCESSOR_920 921
+#define RIOT_PP_SUCCESSOR_921 922
+#define RIOT_PP_SUCCESSOR_922 923
+#define RIOT_PP_SUCCESSOR_923 924
+#define RIOT_PP_SUCCESSOR_924 925
+#define RIOT_PP_SUCCESSOR_925 926
+#define RIOT_PP_SUCCESSOR_926 927
+#define RIOT_PP_SUCCESSOR_927 928
+#define RIOT_PP_SUCCESSOR_928 929
+#define RIOT_PP_SUCCESSOR_929 930
+#define RIOT_PP_SUCCESSOR_930 931
+#define RIOT_PP_SUCCESSOR_931 932
+#define RIOT_PP_SUCCESSOR_932 933
+#define RIOT_PP_SUCCESSOR_933 934
+#define RIOT_PP_SUCCESSOR_934 935
+#define RIOT_PP_SUCCESSOR_935 936
+#define RIOT_PP_SUCCESSOR_936 937
+#define RIOT_PP_SUCCESSOR_937 938
+#define RIOT_PP_SUCCESSOR_938 939
+#define RIOT_PP_SUCCESSOR_939 940
+#define RIOT_PP_SUCCESSOR_940 941
+#define RIOT_PP_SUCCESSOR_941 942
+#define RIOT_PP_SUCCESSOR_942 943
+#define RIOT_PP_SUCCESSOR_943 944
+#define RIOT_PP_SUCCESSOR_944 945
+#define RIOT_PP_SUCCESSOR_945 946
+#define RIOT_PP_SUCCESSOR_946 947
+#define RIOT_PP_SUCCESSOR_947 948
+#define RIOT_PP_SUCCESSOR_948 949
+#define RIOT_PP_SUCCESSOR_949 950
+#define RIOT_PP_SUCCESSOR_950 951
+#define RIOT_PP_SUCCESSOR_951 952
+#define RIOT_PP_SUCCESSOR_952 953
+#define RIOT_PP_SUCCESSOR_953 954
+#define RIOT_PP_SUCCESSOR_954 955
+#define RIOT_PP_SUCCESSOR_955 956
+#define RIOT_PP_SUCCESSOR_956 957
+#define RIOT_PP_SUCCESSOR_957 958
+#define RIOT_PP_SUCCESSOR_958 959
+#define RIOT_PP_SUCCESSOR_959 960
+#define RIOT_PP_SUCCESSOR_960 961
+#define RIOT_PP_SUCCESSOR_961 962
+#define RIOT_PP_SUCCESSOR_962 963
+#define RIOT_PP_SUCCESSOR_963 964
+#define RIOT_PP_SUCCESSOR_964 965
+#define RIOT_PP_SUCCESSOR_965 966
+#define RIOT_PP_SUCCESSOR_966 967
+#define RIOT_PP_SUCCESSOR_967 968
+#define RIOT_PP_SUCCESSOR_968 969
+#define RIOT_PP_SUCCESSOR_969 970
+#define RIOT_PP_SUCCESSOR_970 971
+#define RIOT_PP_SUCCESSOR_971 972
+#define RIOT_PP_SUCCESSOR_972 973
+#define RIOT_PP_SUCCESSOR_973 974
+#define RIOT_PP_SUCCESSOR_974 975
+#define RIOT_PP_SUCCESSOR_975 976
+#define RIOT_PP_SUCCESSOR_976 977
+#define RIOT_PP_SUCCESSOR_977 978
+#define RIOT_PP_SUCCESSOR_978 979
+#define RIOT_PP_SUCCESSOR_979 980
+#define RIOT_PP_SUCCESSOR_980 981
+#define RIOT_PP_SUCCESSOR_981 982
+#define RIOT_PP_SUCCESSOR_982 983
+#define RIOT_PP_SUCCESSOR_983 984
+#define RIOT_PP_SUCCESSOR_984 985
+#define RIOT_PP_SUCCESSOR_985 986
+#define RIOT_PP_SUCCESSOR_986 987
+#define RIOT_PP_SUCCESSOR_987 988
+#define RIOT_PP_SUCCESSOR_988 989
+#define RIOT_PP_SUCCESSOR_989 990
+#define RIOT_PP_SUCCESSOR_990 991
+#define RIOT_PP_SUCCESSOR_991 992
+#define RIOT_PP_SUCCESSOR_992 993
+#define RIOT_PP_SUCCESSOR_993 994
+#define RIOT_PP_SUCCESSOR_994 995
+#define RIOT_PP_SUCCESSOR_995 996
+#define RIOT_PP_SUCCESSOR_996 997
+#define RIOT_PP_SUCCESSOR_997 998
+#define RIOT_PP_SUCCESSOR_998 999
+#define RIOT_PP_SUCCESSOR_999 1000
+#define RIOT_PP_SUCCESSOR_1000 1001
+#define RIOT_PP_SUCCESSOR_1001 1002
+#define RIOT_PP_SUCCESSOR_1002 1003
+#define RIOT_PP_SUCCESSOR_1003 1004
+#define RIOT_PP_SUCCESSOR_1004 1005
+#define RIOT_PP_SUCCESSOR_1005 1006
+#define RIOT_PP_SUCCESSOR_1006 1007
+#define RIOT_PP_SUCCESSOR_1007 1008
+#define RIOT_PP_SUCCESSOR_1008 1009
+#define RIOT_PP_SUCCESSOR_1009 1010
+#define RIOT_PP_SUCCESSOR_1010 1011
+#define RIOT_PP_SUCCESSOR_1011 1012
+#define RIOT_PP_SUCCESSOR_1012 1013
+#define RIOT_PP_SUCCESSOR_1013 1014
+#define RIOT_PP_SUCCESSOR_1014 1015
+#define RIOT_PP_SUCCESSOR_1015 1016
+#define RIOT_PP_SUCCESSOR_1016 1017
+#define RIOT_PP_SUCCESSOR_1017 1018
+#define RIOT_PP_SUCCESSOR_1018 1019
+#define RIOT_PP_SUCCESSOR_1019 1020
+#define RIOT_PP_SUCCESSOR_1020 1021
+#define RIOT_PP_SUCCESSOR_1021 1022
+#define RIOT_PP_SUCCESSOR_1022 1023
+#define RIOT_PP_SUCCESSOR_1023 1024
+#define RIOT_PP_SUCCESSOR_1024 1025
+#define RIOT_PP_SUCCESSOR_1025 1026
+#define RIOT_PP_SUCCESSOR_1026 1027
+#define RIOT_PP_SUCCESSOR_1027 1028
+#define RIOT_PP_SUCCESSOR_1028 1029
+#define RIOT_PP_SUCCESSOR_1029 1030
+#define RIOT_PP_SUCCESSOR_1030 1031
+#define RIOT_PP_SUCCESSOR_1031 1032
+#define RIOT_PP_SUCCESSOR_1032 1033
+#define RIOT_PP_SUCCESSOR_1033 1034
+#define RIOT_PP_SUCCESSOR_1034 1035
+#define RIOT_PP_SUCCESSOR_1035 1036
+#define RIOT_PP_SUCCESSOR_1036 1037
+#define RIOT_PP_SUCCESSOR_1037 1038
+#define RIOT_PP_SUCCESSOR_1038 1039
+#define RIOT_PP_SUCCESSOR_1039 1040
+#define RIOT_PP_SUCCESSOR_1040 1041
+#define RIOT_PP_SUCCESSOR_1041 1042
+#define RIOT_PP_SUCCESSOR_1042 1043
+#define RIOT_PP_SUCCESSOR_1043 1044
+#define RIOT_PP_SUCCESSOR_1044 1045
+#define RIOT_PP_SUCCESSOR_1045 1046
+#define RIOT_PP_SUCCESSOR_1046 1047
+#define RIOT_PP_SUCCESSOR_1047 1048
+#define RIOT_PP_SUCCESSOR_1048 1049
+#define RIOT_PP_SUCCESSOR_1049 1050
+#define RIOT_PP_SUCCESSOR_1050 1051
+#define RIOT_PP_SUCCESSOR_1051 1052
+#define RIOT_PP_SUCCESSOR_1052 1053
+#define RIOT_PP_SUCCESSOR_1053 1054
+#define RIOT_PP_SUCCESSOR_1054 1055
+#define RIOT_PP_SUCCESSOR_1055 1056
+#define RIOT_PP_SUCCESSOR_1056 1057
+#define RIOT_PP_SUCCESSOR_1057 1058
+#define RIOT_PP_SUCCESSOR_1058 1059
+#define RIOT_PP_SUCCESSOR_1059 1060
+#define RIOT_PP_SUCCESSOR_1060 1061
+#define RIOT_PP_SUCCESSOR_1061 1062
+#define RIOT_PP_SUCCESSOR_1062 1063
+#define RIOT_PP_SUCCESSOR_1063 1064
+#define RIOT_PP_SUCCESSOR_1064 1065
+#define RIOT_PP_SUCCESSOR_1065 1066
+#define RIOT_PP_SUCCESSOR_1066 1067
+#define RIOT_PP_SUCCESSOR_1067 1068
+#define RIOT_PP_SUCCESSOR_1068 1069
+#define RIOT_PP_SUCCESSOR_1069 1070
+#define RIOT_PP_SUCCESSOR_1070 1071
+#define RIOT_PP_SUCCESSOR_1071 1072
+#define RIOT_PP_SUCCESSOR_1072 1073
+#define RIOT_PP_SUCCESSOR_1073 1074
+#define RIOT_PP_SUCCESSOR_1074 1075
+#define RIOT_PP_SUCCESSOR_1075 1076
+#define RIOT_PP_SUCCESSOR_1076 1077
+#define RIOT_PP_SUCCESSOR_1077 1078
+#define RIOT_PP_SUCCESSOR_1078 1079
+#define RIOT_PP_SUCCESSOR_1079 1080
+#define RIOT_PP_SUCCESSOR_1080 1081
+#define RIOT_PP_SUCCESSOR_1081 1082
+#define RIOT_PP_SUCCESSOR_1082 1083
+#define RIOT_PP_SUCCESSOR_1083 1084
+#define RIOT_PP_SUCCESSOR_1084 1085
+#define RIOT_PP_SUCCESSOR_1085 1086
+#define RIOT_PP_SUCCESSOR_1086 1087
+#define RIOT_PP_SUCCESSOR_1087 1088
+#define RIOT_PP_SUCCESSOR_1088 1089
+#define RIOT_PP_SUCCESSOR_1089 1090
+#define RIOT_PP_SUCCESSOR_1090 1091
+#define RIOT_PP_SUCCESSOR_1091 1092
+#define RIOT_PP_SUCCESSOR_1092 1093
+#define RIOT_PP_SUCCESSOR_1093 1094
+#define RIOT_PP_SUCCESSOR_1094 1095
+#define RIOT_PP_SUCCESSOR_1095 1096
+#define RIOT_PP_SUCCESSOR_1096 1097
+#define RIOT_PP_SUCCESSOR_1097 1098
+#define RIOT_PP_SUCCESSOR_1098 1099
+#define RIOT_PP_SUCCESSOR_1099 1100
+#define RIOT_PP_SUCCESSOR_1100 1101
+#define RIOT_PP_SUCCESSOR_1101 1102
+#define RIOT_PP_SUCCESSOR_1102 1103
+#define RIOT_PP_SUCCESSOR_1103 1104
+#define RIOT_PP_SUCCESSOR_1104 1105
+#define RIOT_PP_SUCCESSOR_1105 1106
+#define RIOT_PP_SUCCESSOR_1106 1107
+#define RIOT_PP_SUCCESSOR_1107 1108
+#define RIOT_PP_SUCCESSOR_1108 1109
+#define RIOT_PP_SUCCESSOR_1109 1110
+#define RIOT_PP_SUCCESSOR_1110 1111
+#define RIOT_PP_SUCCESSOR_1111 1112
+#define RIOT_PP_SUCCESSOR_1112 1113
+#define RIOT_PP_SUCCESSOR_1113 1114
+#define RIOT_PP_SUCCESSOR_1114 1115
+#define RIOT_PP_SUCCESSOR_1115 1116
+#define RIOT_PP_SUCCESSOR_1116 1117
+#define RIOT_PP_SUCCESSOR_1117 1118
+#define RIOT_PP_SUCCESSOR_1118 1119
+#define RIOT_PP_SUCCESSOR_1119 1120
+#define RIOT_PP_SUCCESSOR_1120 1121
+#define RIOT_PP_SUCCESSOR_1121 1122
+#define RIOT_PP_SUCCESSOR_1122 1123
+#define RIOT_PP_SUCCESSOR_1123 1124
+#define RIOT_PP_SUCCESSOR_1124 1125
+#define RIOT_PP_SUCCESSOR_1125 1126
+#define RIOT_PP_SUCCESSOR_1126 1127
+#define RIOT_PP_SUCCESSOR_1127 1128
+#define RIOT_PP_SUCCESSOR_1128 1129
+#define RIOT_PP_SUCCESSOR_1129 1130
+#define RIOT_PP_SUCCESSOR_1130 1131
+#define RIOT_PP_SUCCESSOR_1131 1132
+#define RIOT_PP_SUCCESSOR_1132 1133
+#define RIOT_PP_SUCCESSOR_1133 1134
+#define RIOT_PP_SUCCESSOR_1134 1135
+#define RIOT_PP_SUCCESSOR_1135 1136
+#define RIOT_PP_SUCCESSOR_1136 1137
+#define RIOT_PP_SUCCESSOR_1137 1138
+#define RIOT_PP_SUCCESSOR_1138 1139
+#define RIOT_PP_SUCCESSOR_1139 1140
+#define RIOT_PP_SUCCESSOR_1140 1141
+#define RIOT_PP_SUCCESSOR_1141 1142
+#define RIOT_PP_SUCCESSOR_1142 1143
+#define RIOT_PP_SUCCESSOR_1143 1144
+#define RIOT_PP_SUCCESSOR_1144 1145
+#define RIOT_PP_SUCCESSOR_1145 1146
+#define RIOT_PP_SUCCESSOR_1146 1147
+#define RIOT_PP_SUCCESSOR_1147 1148
+#define RIOT_PP_SUCCESSOR_1148 1149
+#define RIOT_PP_SUCCESSOR_1149 1150
+#define RIOT_PP_SUCCESSOR_1150 1151
+#define RIOT_PP_SUCCESSOR_1151 1152
+#define RIOT_PP_SUCCESSOR_1152 1153
+#define RIOT_PP_SUCCESSOR_1153 1154
+#define RIOT_PP_SUCCESSOR_1154 1155
+#define RIOT_PP_SUCCESSOR_1155 1156
+#define RIOT_PP_SUCCESSOR_1156 1157
+#define RIOT_PP_SUCCESSOR_1157 1158
+#define RIOT_PP_SUCCESSOR_1158 1159
+#define RIOT_PP_SUCCESSOR_1159 1160
+#define RIOT_PP_SUCCESSOR_1160 1161
+#define RIOT_PP_SUCCESSOR_1161 1162
+#define RIOT_PP_SUCCESSOR_1162 1163
+#define RIOT_PP_SUCCESSOR_1163 1164
+#define RIOT_PP_SUCCESSOR_1164 1165
+#define RIOT_PP_SUCCESSOR_1165 1166
+#define RIOT_PP_SUCCESSOR_1166 1167
+#define RIOT_PP_SUCCESSOR_1167 1168
+#define RIOT_PP_SUCCESSOR_1168 1169
+#define RIOT_PP_SUCCESSOR_1169 1170
+#define RIOT_PP_SUCCESSOR_1170 1171
+#define RIOT_PP_SUCCESSOR_1171 1172
+#define RIOT_PP_SUCCESSOR_1172 1173
+#define RIOT_PP_SUCCESSOR_1173 1174
+#define RIOT_PP_SUCCESSOR_1174 1175
+#define RIOT_PP_SUCCESSOR_1175 1176
+#define RIOT_PP_SUCCESSOR_1176 1177
+#define RIOT_PP_SUCCESSOR_1177 1178
+#define RIOT_PP_SUCCESSOR_1178 1179
+#define RIOT_PP_SUCCESSOR_1179 1180
+#define RIOT_PP_SUCCESSOR_1180 1181
+#define RIOT_PP_SUCCESSOR_1181 1182
+#define RIOT_PP_SUCCESSOR_1182 1183
+#define RIOT_PP_SUCCESSOR_1183 1184
+#define RIOT_PP_SUCCESSOR_1184 1185
+#define RIOT_PP_SUCCESSOR_1185 1186
+#define RIOT_PP_SUCCESSOR_1186 1187
+#define RIOT_PP_SUCCESSOR_1187 1188
+#define RIOT_PP_SUCCESSOR_1188 1189
+#define RIOT_PP_SUCCESSOR_1189 1190
+#define RIOT_PP_SUCCESSOR_1190 1191
+#define RIOT_PP_SUCCESSOR_1191 1192
+#define RIOT_PP_SUCCESSOR_1192 1193
+#define RIOT_PP_SUCCESSOR_1193 1194
+#define RIOT_PP_SUCCESSOR_1194 1195
+#define RIOT_PP_SUCCESSOR_1195 1196
+#define RIOT_PP_SUCCESSOR_1196 1197
+#define RIOT_PP_SUCCESSOR_1197 1198
+#define RIOT_PP_SUCCESSOR_1198 1199
+#define RIOT_PP_SUCCESSOR_1199 1200
+#define RIOT_PP_SUCCESSOR_1200 1201
+#define RIOT_PP_SUCCESSOR_1201 1202
+#define RIOT_PP_SUCCESSOR_1202 1203
+#define RIOT_PP_SUCCESSOR_1203 1204
+#define RIOT_PP_SUCCESSOR_1204 1205
+#define RIOT_PP_SUCCESSOR_1205 1206
+#define RIOT_PP_SUCCESSOR_1206 1207
+#define RIOT_PP_SUCCESSOR_1207 1208
+#define RIOT_PP_SUCCESSOR_1208 1209
+#define RIOT_PP_SUCCESSOR_1209 1210
+#define RIOT_PP_SUCCESSOR_1210 1211
+#define RIOT_PP_SUCCESSOR_1211 1212
+#define RIOT_PP_SUCCESSOR_1212 1213
+#define RIOT_PP_SUCCESSOR_1213 1214
+#define RIOT_PP_SUCCESSOR_1214 1215
+#define RIOT_PP_SUCCESSOR_1215 1216
+#define RIOT_PP_SUCCESSOR_1216 1217
+#define RIOT_PP_SUCCESSOR_1217 1218
+#define RIOT_PP_SUCCESSOR_1218 1219
+#define RIOT_PP_SUCCESSOR_1219 1220
+#define RIOT_PP_SUCCESSOR_1220 1221
+#define RIOT_PP_SUCCESSOR_1221 1222
+#define RIOT_PP_SUCCESSOR_1222 1223
+#define RIOT_PP_SUCCESSOR_1223 1224
+#define RIOT_PP_SUCCESSOR_1224 1225
+#define RIOT_PP_SUCCESSOR_1225 1226
+#define RIOT_PP_SUCCESSOR_1226 1227
+#define RIOT_PP_SUCCESSOR_1227 1228
+#define RIOT_PP_SUCCESSOR_1228 1229
+#define RIOT_PP_SUCCESSOR_1229 1230
+#define RIOT_PP_SUCCESSOR_1230 1231
+#define RIOT_PP_SUCCESSOR_1231 1232
+#define RIOT_PP_SUCCESSOR_1232 1233
+#define RIOT_PP_SUCCESSOR_1233 1234
+#define RIOT_PP_SUCCESSOR_1234 1235
+#define RIOT_PP_SUCCESSOR_1235 1236
+#define RIOT_PP_SUCCESSOR_1236 1237
+#define RIOT_PP_SUCCESSOR_1237 1238
+#define RIOT_PP_SUCCESSOR_1238 1239
+#define RIOT_PP_SUCCESSOR_1239 1240
+#define RIOT_PP_SUCCESSOR_1240 1241
+#define RIOT_PP_SUCCESSOR_1241 1242
+#define RIOT_PP_SUCCESSOR_1242 1243
+#define RIOT_PP_SUCCESSOR_1243 1244
+#define RIOT_PP_SUCCESSOR_1244 1245
+#define RIOT_PP_SUCCESSOR_1245 1246
+#define RIOT_PP_SUCCESSOR_1246 1247
+#define RIOT_PP_SUCCESSOR_1247 1248
+#define RIOT_PP_SUCCESSOR_1248 1249
+#define RIOT_PP_SUCCESSOR_1249 1250
+#define RIOT_PP_SUCCESSOR_1250 1251
+#define RIOT_PP_SUCCESSOR_1251 1252
+#define RIOT_PP_SUCCESSOR_1252 1253
+#define RIOT_PP_SUCCESSOR_1253 1254
+#define RIOT_PP_SUCCESSOR_1254 1255
+#define RIOT_PP_SUCCESSOR_1255 1256
+#define RIOT_PP_SUCCESSOR_1256 1257
+#define RIOT_PP_SUCCESSOR_1257 1258
+#define RIOT_PP_SUCCESSOR_1258 1259
+#define RIOT_PP_SUCCESSOR_1259 1260
+#define RIOT_PP_SUCCESSOR_1260 1261
+#define RIOT_PP_SUCCESSOR_1261 1262
+#define RIOT_PP_SUCCESSOR_1262 1263
+#define RIOT_PP_SUCCESSOR_1263 1264
+#define RIOT_PP_SUCCESSOR_1264 1265
+#define RIOT_PP_SUCCESSOR_1265 1266
+#define RIOT_PP_SUCCESSOR_1266 1267
+#define RIOT_PP_SUCCESSOR_1267 1268
+#define RIOT_PP_SUCCESSOR_1268 1269
+#define RIOT_PP_SUCCESSOR_1269 1270
+#define RIOT_PP_SUCCESSOR_1270 1271
+#define RIOT_PP_SUCCESSOR_1271 1272
+#define RIOT_PP_SUCCESSOR_1272 1273
+#define RIOT_PP_SUCCESSOR_1273 1274
+#define RIOT_PP_SUCCESSOR_1274 1275
+#define RIOT_PP_SUCCESSOR_1275 1276
+#define RIOT_PP_SUCCESSOR_1276 1277
+#define RIOT_PP_SUCCESSOR_1277 1278
+#define RIOT_PP_SUCCESSOR_1278 1279
+#define RIOT_PP_SUCCESSOR_1279 1280
+#define RIOT_PP_SUCCESSOR_1280 1281
+#define RIOT_PP_SUCCESSOR_1281 1282
+#define RIOT_PP_SUCCESSOR_1282 1283
+#define RIOT_PP_SUCCESSOR_1283 1284
+#define RIOT_PP_SUCCESSOR_1284 1285
+#define RIOT_PP_SUCCESSOR_1285 1286
+#define RIOT_PP_SUCCESSOR_1286 1287
+#define RIOT_PP_SUCCESSOR_1287 1288
+#define RIOT_PP_SUCCESSOR_1288 1289
+#define RIOT_PP_SUCCESSOR_1289 1290
+#define RIOT_PP_SUCCESSOR_1290 1291
+#define RIOT_PP_SUCCESSOR_1291 1292
+#define RIOT_PP_SUCCESSOR_1292 1293
+#define RIOT_PP_SUCCESSOR_1293 1294
+#define RIOT_PP_SUCCESSOR_1294 1295
+#define RIOT_PP_SUCCESSOR_1295 1296
+#define RIOT_PP_SUCCESSOR_1296 1297
+#define RIOT_PP_SUCCESSOR_1297 1298
+#define RIOT_PP_SUCCESSOR_1298 1299
+#define RIOT_PP_SUCCESSOR_1299 1300
+#define RIOT_PP_SUCCESSOR_1300 1301
+#define RIOT_PP_SUCCESSOR_1301 1302
+#define RIOT_PP_SUCCESSOR_1302 1303
+#define RIOT_PP_SUCCESSOR_1303 1304
+#define RIOT_PP_SUCCESSOR_1304 1305
+#define RIOT_PP_SUCCESSOR_1305 1306
+#define RIOT_PP_SUCCESSOR_1306 1307
+#define RIOT_PP_SUCCESSOR_1307 1308
+#define RIOT_PP_SUCCESSOR_1308 1309
+#define RIOT_PP_SUCCESSOR_1309 1310
+#define RIOT_PP_SUCCESSOR_1310 1311
+#define RIOT_PP_SUCCESSOR_1311 1312
+#define RIOT_PP_SUCCESSOR_1312 1313
+#define RIOT_PP_SUCCESSOR_1313 1314
+#define RIOT_PP_SUCCESSOR_1314 1315
+#define RIOT_PP_SUCCESSOR_1315 1316
+#define RIOT_PP_SUCCESSOR_1316 1317
+#define RIOT_PP_SUCCESSOR_1317 1318
+#define RIOT_PP_SUCCESSOR_1318 1319
+#define RIOT_PP_SUCCESSOR_1319 1320
+#define RIOT_PP_SUCCESSOR_1320 1321
+#define RIOT_PP_SUCCESSOR_1321 1322
+#define RIOT_PP_SUCCESSOR_1322 1323
+#define RIOT_PP_SUCCESSOR_1323 1324
+#define RIOT_PP_SUCCESSOR_1324 1325
+#define RIOT_PP_SUCCESSOR_1325 1326
+#define RIOT_PP_SUCCESSOR_1326 1327
+#define RIOT_PP_SUCCESSOR_1327 1328
+#define RIOT_PP_SUCCESSOR_1328 1329
+#define RIOT_PP_SUCCESSOR_1329 1330
+#define RIOT_PP_SUCCESSOR_1330 1331
+#define RIOT_PP_SUCCESSOR_1331 1332
+#define RIOT_PP_SUCCESSOR_1332 1333
+#define RIOT_PP_SUCCESSOR_1333 1334
+#define RIOT_PP_SUCCESSOR_1334 1335
+#define RIOT_PP_SUCCESSOR_1335 1336
+#define RIOT_PP_SUCCESSOR_1336 1337
+#define RIOT_PP_SUCCESSOR_1337 1338
+#define RIOT_PP_SUCCESSOR_1338 1339
+#define RIOT_PP_SUCCESSOR_1339 1340
+#define RIOT_PP_SUCCESSOR_1340 1341
+#define RIOT_PP_SUCCESSOR_1341 1342
+#define RIOT_PP_SUCCESSOR_1342 1343
+#define RIOT_PP_SUCCESSOR_1343 1344
+#define RIOT_PP_SUCCESSOR_1344 1345
+#define RIOT_PP_SUCCESSOR_1345 1346
+#define RIOT_PP_SUCCESSOR_1346 1347
+#define RIOT_PP_SUCCESSOR_1347 1348
+#define RIOT_PP_SUCCESSOR_1348 1349
+#define RIOT_PP_SUCCESSOR_1349 1350
+#define RIOT_PP_SUCCESSOR_1350 1351
+#define RIOT_PP_SUCCESSOR_1351 1352
+#define RIOT_PP_SUCCESSOR_1352 1353
+#define RIOT_PP_SUCCESSOR_1353 1354
+#define RIOT_PP_SUCCESSOR_1354 1355
+#define RIOT_PP_SUCCESSOR_1355 1356
+#define RIOT_PP_SUCCESSOR_1356 1357
+#define RIOT_PP_SUCCESSOR_1357 1358
+#define RIOT_PP_SUCCESSOR_1358 1359
+#define RIOT_PP_SUCCESSOR_1359 1360
+#define RIOT_PP_SUCCESSOR_1360 1361
+#define RIOT_PP_SUCCESSOR_1361 1362
+#define RIOT_PP_SUCCESSOR_1362 1363
+#define RIOT_PP_SUCCESSOR_1363 1364
+#define RIOT_PP_SUCCESSOR_1364 1365
+#define RIOT_PP_SUCCESSOR_1365 1366
+#define RIOT_PP_SUCCESSOR_1366 1367
+#define RIOT_PP_SUCCESSOR_1367 1368
+#define RIOT_PP_SUCCESSOR_1368 1369
+#define RIOT_PP_SUCCESSOR_1369 1370
+#define RIOT_PP_SUCCESSOR_1370 1371
+#define RIOT_PP_SUCCESSOR_1371 1372
+#define RIOT_PP_SUCCESSOR_1372 1373
+#define RIOT_PP_SUCCESSOR_1373 1374
+#define RIOT_PP_SUCCESSOR_1374 1375
+#define RIOT_PP_SUCCESSOR_1375 1376
+#define RIOT_PP_SUCCESSOR_1376 1377
+#define RIOT_PP_SUCCESSOR_1377 1378
+#define RIOT_PP_SUCCESSOR_1378 1379
+#define RIOT_PP_SUCCESSOR_1379 1380
+#define RIOT_PP_SUCCESSOR_1380 1381
+#define RIOT_PP_SUCCESSOR_1381 1382
+#define RIOT_PP_SUCCESSOR_1382 1383
+#define RIOT_PP_SUCCESSOR_1383 1384
+#define RIOT_PP_SUCCESSOR_1384 1385
+#define RIOT_PP_SUCCESSOR_1385 1386
+#define RIOT_PP_SUCCESSOR_1386 1387
+#define RIOT_PP_SUCCESSOR_1387 1388
+#define RIOT_PP_SUCCESSOR_1388 1389
+#define RIOT_PP_SUCCESSOR_1389 1390
+#define RIOT_PP_SUCCESSOR_1390 1391
+#define RIOT_PP_SUCCESSOR_1391 1392
+#define RIOT_PP_SUCCESSOR_1392 1393
+#define RIOT_PP_SUCCESSOR_1393 1394
+#define RIOT_PP_SUCCESSOR_1394 1395
+#define RIOT_PP_SUCCESSOR_1395 1396
+#define RIOT_PP_SUCCESSOR_1396 1397
+#define RIOT_PP_SUCCESSOR_1397 1398
+#define RIOT_PP_SUCCESSOR_1398 1399
+#define RIOT_PP_SUCCESSOR_1399 1400
+#define RIOT_PP_SUCCESSOR_1400 1401
+#define RIOT_PP_SUCCESSOR_1401 1402
+#define RIOT_PP_SUCCESSOR_1402 1403
+#define RIOT_PP_SUCCESSOR_1403 1404
+#define RIOT_PP_SUCCESSOR_1404 1405
+#define RIOT_PP_SUCCESSOR_1405 1406
+#define RIOT_PP_SUCCESSOR_1406 1407
+#define RIOT_PP_SUCCESSOR_1407 1408
+#define RIOT_PP_SUCCESSOR_1408 1409
+#define RIOT_PP_SUCCESSOR_1409 1410
+#define RIOT_PP_SUCCESSOR_1410 1411
+#define RIOT_PP_SUCCESSOR_1411 1412
+#define RIOT_PP_SUCCESSOR_1412 1413
+#define RIOT_PP_SUCCESSOR_1413 1414
+#define RIOT_PP_SUCCESSOR_1414 1415
+#define RIOT_PP_SUCCESSOR_1415 1416
+#define RIOT_PP_SUCCESSOR_1416 1417
+#define RIOT_PP_SUCCESSOR_1417 1418
+#define RIOT_PP_SUCCESSOR_1418 1419
+#define RIOT_PP_SUCCESSOR_1419 1420
+#define RIOT_PP_SUCCESSOR_1420 1421
+#define RIOT_PP_SUCCESSOR_1421 1422
+#define RIOT_PP_SUCCESSOR_1422 1423
+#define RIOT_PP_SUCCESSOR_1423 1424
+#define RIOT_PP_SUCCESSOR_1424 1425
+#define RIOT_PP_SUCCESSOR_1425 1426
+#define RIOT_PP_SUCCESSOR_1426 1427
+#define RIOT_PP_SUCCESSOR_1427 1428
+#define RIOT_PP_SUCCESSOR_1428 1429
+#define RIOT_PP_SUCCESSOR_1429 1430
+#define RIOT_PP_SUCCESSOR_1430 1431
+#define RIOT_PP_SUCCESSOR_1431 1432
+#define RIOT_PP_SUCCESSOR_1432 1433
+#define RIOT_PP_SUCCESSOR_1433 1434
+#define RIOT_PP_SUCCESSOR_1434 1435
+#define RIOT_PP_SUCCESSOR_1435 1436
+#define RIOT_PP_SUCCESSOR_1436 1437
+#define RIOT_PP_SUCCESSOR_1437 1438
+#define RIOT_PP_SUCCESSOR_1438 1439
+#define RIOT_PP_SUCCESSOR_1439 1440
+#define RIOT_PP_SUCCESSOR_1440 1441
+#define RIOT_PP_SUCCESSOR_1441 1442
+#define RIOT_PP_SUCCESSOR_1442 1443
+#define RIOT_PP_SUCCESSOR_1443 1444
+#define RIOT_PP_SUCCESSOR_1444 1445
+#define RIOT_PP_SUCCESSOR_1445 1446
+#define RIOT_PP_SUCCESSOR_1446 1447
+#define RIOT_PP_SUCCESSOR_1447 1448
+#define RIOT_PP_SUCCESSOR_1448 1449
+#define RIOT_PP_SUCCESSOR_1449 1450
+#define RIOT_PP_SUCCESSOR_1450 1451
+#define RIOT_PP_SUCCESSOR_1451 1452
+#define RIOT_PP_SUCCESSOR_1452 1453
+#define RIOT_PP_SUCCESSOR_1453 1454
+#define RIOT_PP_SUCCESSOR_1454 1455
+#define RIOT_PP_SUCCESSOR_1455 1456
+#define RIOT_PP_SUCCESSOR_1456 1457
+#define RIOT_PP_SUCCESSOR_1457 1458
+#define RIOT_PP_SUCCESSOR_1458 1459
+#define RIOT_PP_SUCCESSOR_1459 1460
+#define RIOT_PP_SUCCESSOR_1460 1461
+#define RIOT_PP_SUCCESSOR_1461 1462
+#define RIOT_PP_SUCCESSOR_1462 1463
+#define RIOT_PP_SUCCESSOR_1463 1464
+#define RIOT_PP_SUCCESSOR_1464 1465
+#define RIOT_PP_SUCCESSOR_1465 1466
+#define RIOT_PP_SUCCESSOR_1466 1467
+#define RIOT_PP_SUCCESSOR_1467 1468
+#define RIOT_PP_SUCCESSOR_1468 1469
+#define RIOT_PP_SUCCESSOR_1469 1470
+#define RIOT_PP_SUCCESSOR_1470 1471
+#define RIOT_PP_SUCCESSOR_1471 1472
+#define RIOT_PP_SUCCESSOR_1472 1473
+#define RIOT_PP_SUCCESSOR_1473 1474
+#define RIOT_PP_SUCCESSOR_1474 1475
+#define RIOT_PP_SUCCESSOR_1475 1476
+#define RIOT_PP_SUCCESSOR_1476 1477
+#define RIOT_PP_SUCCESSOR_1477 1478
+#define RIOT_PP_SUCCESSOR_1478 1479
+#define RIOT_PP_SUCCESSOR_1479 1480
+#define RIOT_PP_SUCCESSOR_1480 1481
+#define RIOT_PP_SUCCESSOR_1481 1482
+#define RIOT_PP_SUCCESSOR_1482 1483
+#define RIOT_PP_SUCCESSOR_1483 1484
+#define RIOT_PP_SUCCESSOR_1484 1485
+#define RIOT_PP_SUCCESSOR_1485 1486
+#define RIOT_PP_SUCCESSOR_1486 1487
+#define RIOT_PP_SUCCESSOR_1487 1488
+#define RIOT_PP_SUCCESSOR_1488 1489
+#define RIOT_PP_SUCCESSOR_1489 1490
+#define RIOT_PP_SUCCESSOR_1490 1491
+#define RIOT_PP_SUCCESSOR_1491 1492
+#define RIOT_PP_SUCCESSOR_1492 1493
+#define RIOT_PP_SUCCESSOR_1493 1494
+#define RIOT_PP_SUCCESSOR_1494 1495
+#define RIOT_PP_SUCCESSOR_1495 1496
+#define RIOT_PP_SUCCESSOR_1496 1497
+#define RIOT_PP_SUCCESSOR_1497 1498
+#define RIOT_PP_SUCCESSOR_1498 1499
+#define RIOT_PP_SUCCESSOR_1499 1500
+#define RIOT_PP_SUCCESSOR_1500 1501
+#define RIOT_PP_SUCCESSOR_1501 1502
+#define RIOT_PP_SUCCESSOR_1502 1503
+#define RIOT_PP_SUCCESSOR_1503 1504
+#define RIOT_PP_SUCCESSOR_1504 1505
+#define RIOT_PP_SUCCESSOR_1505 1506
+#define RIOT_PP_SUCCESSOR_1506 1507
+#define RIOT_PP_SUCCESSOR_1507 1508
+#define RIOT_PP_SUCCESSOR_1508 1509
+#define RIOT_PP_SUCCESSOR_1509 1510
+#define RIOT_PP_SUCCESSOR_1510 1511
+#define RIOT_PP_SUCCESSOR_1511 1512
+#define RIOT_PP_SUCCESSOR_1512 1513
+#define RIOT_PP_SUCCESSOR_1513 1514
+#define RIOT_PP_SUCCESSOR_1514 1515
+#define RIOT_PP_SUCCESSOR_1515 1516
+#define RIOT_PP_SUCCESSOR_1516 1517
+#define RIOT_PP_SUCCESSOR_1517 1518
+#define RIOT_PP_SUCCESSOR_1518 1519
+#define RIOT_PP_SUCCESSOR_1519 1520
+#define RIOT_PP_SUCCESSOR_1520 1521
+#define RIOT_PP_SUCCESSOR_1521 1522
+#define RIOT_PP_SUCCESSOR_1522 1523
+#define RIOT_PP_SUCCESSOR_1523 1524
+#define RIOT_PP_SUCCESSOR_1524 1525
+#define RIOT_PP_SUCCESSOR_1525 1526
+#define RIOT_PP_SUCCESSOR_1526 1527
+#define RIOT_PP_SUCCESSOR_1527 1528
+#define RIOT_PP_SUCCESSOR_1528 1529
+#define RIOT_PP_SUCCESSOR_1529 1530
+#define RIOT_PP_SUCCESSOR_1530 1531
+#define RIOT_PP_SUCCESSOR_1531 1532
+#define RIOT_PP_SUCCESSOR_1532 1533
+#define RIOT_PP_SUCCESSOR_1533 1534
+#define RIOT_PP_SUCCESSOR_1534 1535
+#define RIOT_PP_SUCCESSOR_1535 1536
+#define RIOT_PP_SUCCESSOR_1536 1537
+#define RIOT_PP_SUCCESSOR_1537 1538
+#define RIOT_PP_SUCCESSOR_1538 1539
+#define RIOT_PP_SUCCESSOR_1539 1540
+#define RIOT_PP_SUCCESSOR_1540 1541
+#define RIOT_PP_SUCCESSOR_1541 1542
+#define RIOT_PP_SUCCESSOR_1542 1543
+#define RIOT_PP_SUCCESSOR_1543 1544
+#define RIOT_PP_SUCCESSOR_1544 1545
+#define RIOT_PP_SUCCESSOR_1545 1546
+#define RIOT_PP_SUCCESSOR_1546 1547
+#define RIOT_PP_SUCCESSOR_1547 1548
+#define RIOT_PP_SUCCESSOR_1548 1549
+#define RIOT_PP_SUCCESSOR_1549 1550
+#define RIOT_PP_SUCCESSOR_1550 1551
+#define RIOT_PP_SUCCESSOR_1551 1552
+#define RIOT_PP_SUCCESSOR_1552 1553
+#define RIOT_PP_SUCCESSOR_1553 1554
+#define RIOT_PP_SUCCESSOR_1554 1555
+#define RIOT_PP_SUCCESSOR_1555 1556
+#define RIOT_PP_SUCCESSOR_1556 1557
+#define RIOT_PP_SUCCESSOR_1557 1558
+#define RIOT_PP_SUCCESSOR_1558 1559
+#define RIOT_PP_SUCCESSOR_1559 1560
+#define RIOT_PP_SUCCESSOR_1560 1561
+#define RIOT_PP_SUCCESSOR_1561 1562
+#define RIOT_PP_SUCCESSOR_1562 1563
+#define RIOT_PP_SUCCESSOR_1563 1564
+#define RIOT_PP_SUCCESSOR_1564 1565
+#define RIOT_PP_SUCCESSOR_1565 1566
+#define RIOT_PP_SUCCESSOR_1566 1567
+#define RIOT_PP_SUCCESSOR_1567 1568
+#define RIOT_PP_SUCCESSOR_1568 1569
+#define RIOT_PP_SUCCESSOR_1569 1570
+#define RIOT_PP_SUCCESSOR_1570 1571
+#define RIOT_PP_SUCCESSOR_1571 1572
+#define RIOT_PP_SUCCESSOR_1572 1573
+#define RIOT_PP_SUCCESSOR_1573 1574
+#define RIOT_PP_SUCCESSOR_1574 1575
+#define RIOT_PP_SUCCESSOR_1575 1576
+#define RIOT_PP_SUCCESSOR_1576 1577
+#define RIOT_PP_SUCCESSOR_1577 1578
+#define RIOT_PP_SUCCESSOR_1578 1579
+#define RIOT_PP_SUCCESSOR_1579 1580
+#define RIOT_PP_SUCCESSOR_1580 1581
+#define RIOT_PP_SUCCESSOR_1581 1582
+#define RIOT_PP_SUCCESSOR_1582 1583
+#define RIOT_PP_SUCCESSOR_1583 1584
+#define RIOT_PP_SUCCESSOR_1584 1585
+#define RIOT_PP_SUCCESSOR_1585 1586
+#define RIOT_PP_SUCCESSOR_1586 1587
+#define RIOT_PP_SUCCESSOR_1587 1588
+#define RIOT_PP_SUCCESSOR_1588 1589
+#define RIOT_PP_SUCCESSOR_1589 1590
+#define RIOT_PP_SUCCESSOR_1590 1591
+#define RIOT_PP_SUCCESSOR_1591 1592
+#define RIOT_PP_SUCCESSOR_1592 1593
+#define RIOT_PP_SUCCESSOR_1593 1594
+#define RIOT_PP_SUCCESSOR_1594 1595
+#define RIOT_PP_SUCCESSOR_1595 1596
+#define RIOT_PP_SUCCESSOR_1596 1597
+#define RIOT_PP_SUCCESSOR_1597 1598
+#define RIOT_PP_SUCCESSOR_1598 1599
+#define RIOT_PP_SUCCESSOR_1599 1600
+#define RIOT_PP_SUCCESSOR_1600 1601
+#define RIOT_PP_SUCCESSOR_1601 1602
+#define RIOT_PP_SUCCESSOR_1602 1603
+#define RIOT_PP_SUCCESSOR_1603 1604
+#define RIOT_PP_SUCCESSOR_1604 1605
+#define RIOT_PP_SUCCESSOR_1605 1606
+#define RIOT_PP_SUCCESSOR_1606 1607
+#define RIOT_PP_SUCCESSOR_1607 1608
+#define RIOT_PP_SUCCESSOR_1608 1609
+#define RIOT_PP_SUCCESSOR_1609 1610
+#define RIOT_PP_SUCCESSOR_1610 1611
+#define RIOT_PP_SUCCESSOR_1611 1612
+#define RIOT_PP_SUCCESSOR_1612 1613
+#define RIOT_PP_SUCCESSOR_1613 1614
+#define RIOT_PP_SUCCESSOR_1614 1615
+#define RIOT_PP_SUCCESSOR_1615 1616
+#define RIOT_PP_SUCCESSOR_1616 1617
+#define RIOT_PP_SUCCESSOR_1617 1618
+#define RIOT_PP_SUCCESSOR_1618 1619
+#define RIOT_PP_SUCCESSOR_1619 1620
+#define RIOT_PP_SUCCESSOR_1620 1621
+#define RIOT_PP_SUCCESSOR_1621 1622
+#define RIOT_PP_SUCCESSOR_1622 1623
+#define RIOT_PP_SUCCESSOR_1623 1624
+#define RIOT_PP_SUCCESSOR_1624 1625
+#define RIOT_PP_SUCCESSOR_1625 1626
+#define RIOT_PP_SUCCESSOR_1626 1627
+#define RIOT_PP_SUCCESSOR_1627 1628
+#define RIOT_PP_SUCCESSOR_1628 1629
+#define RIOT_PP_SUCCESSOR_1629 1630
+#define RIOT_PP_SUCCESSOR_1630 1631
+#define RIOT_PP_SUCCESSOR_1631 1632
+#define RIOT_PP_SUCCESSOR_1632 1633
+#define RIOT_PP_SUCCESSOR_1633 1634
+#define RIOT_PP_SUCCESSOR_1634 1635
+#define RIOT_PP_SUCCESSOR_1635 1636
+#define RIOT_PP_SUCCESSOR_1636 1637
+#define RIOT_PP_SUCCESSOR_1637 1638
+#define RIOT_PP_SUCCESSOR_1638 1639
+#define RIOT_PP_SUCCESSOR_1639 1640
+#define RIOT_PP_SUCCESSOR_1640 1641
+#define RIOT_PP_SUCCESSOR_1641 1642
+#define RIOT_PP_SUCCESSOR_1642 1643
+#define RIOT_PP_SUCCESSOR_1643 1644
+#define RIOT_PP_SUCCESSOR_1644 1645
+#define RIOT_PP_SUCCESSOR_1645 1646
+#define RIOT_PP_SUCCESSOR_1646 1647
+#define RIOT_PP_SUCCESSOR_1647 1648
+#define RIOT_PP_SUCCESSOR_1648 1649
+#define RIOT_PP_SUCCESSOR_1649 1650
+#define RIOT_PP_SUCCESSOR_1650 1651
+#define RIOT_PP_SUCCESSOR_1651 1652
+#define RIOT_PP_SUCCESSOR_1652 1653
+#define RIOT_PP_SUCCESSOR_1653 1654
+#define RIOT_PP_SUCCESSOR_1654 1655
+#define RIOT_PP_SUCCESSOR_1655 1656
+#define RIOT_PP_SUCCESSOR_1656 1657
+#define RIOT_PP_SUCCESSOR_1657 1658
+#define RIOT_PP_SUCCESSOR_1658 1659
+#define RIOT_PP_SUCCESSOR_1659 1660
+#define RIOT_PP_SUCCESSOR_1660 1661
+#define RIOT_PP_SUCCESSOR_1661 1662
+#define RIOT_PP_SUCCESSOR_1662 1663
+#define RIOT_PP_SUCCESSOR_1663 1664
+#define RIOT_PP_SUCCESSOR_1664 1665
+#define RIOT_PP_SUCCESSOR_1665 1666
+#define RIOT_PP_SUCCESSOR_1666 1667
+#define RIOT_PP_SUCCESSOR_1667 1668
+#define RIOT_PP_SUCCESSOR_1668 1669
+#define RIOT_PP_SUCCESSOR_1669 1670
+#define RIOT_PP_SUCCESSOR_1670 1671
+#define RIOT_PP_SUCCESSOR_1671 1672
+#define RIOT_PP_SUCCESSOR_1672 1673
+#define RIOT_PP_SUCCESSOR_1673 1674
+#define RIOT_PP_SUCCESSOR_1674 1675
+#define RIOT_PP_SUCCESSOR_1675 1676
+#define RIOT_PP_SUCCESSOR_1676 1677
+#define RIOT_PP_SUCCESSOR_1677 1678
+#define RIOT_PP_SUCCESSOR_1678 1679
+#define RIOT_PP_SUCCESSOR_1679 1680
+#define RIOT_PP_SUCCESSOR_1680 1681
+#define RIOT_PP_SUCCESSOR_1681 1682
+#define RIOT_PP_SUCCESSOR_1682 1683
+#define RIOT_PP_SUCCESSOR_1683 1684
+#define RIOT_PP_SUCCESSOR_1684 1685
+#define RIOT_PP_SUCCESSOR_1685 1686
+#define RIOT_PP_SUCCESSOR_1686 1687
+#define RIOT_PP_SUCCESSOR_1687 1688
+#define RIOT_PP_SUCCESSOR_1688 1689
+#define RIOT_PP_SUCCESSOR_1689 1690
+#define RIOT_PP_SUCCESSOR_1690 1691
+#define RIOT_PP_SUCCESSOR_1691 1692
+#define RIOT_PP_SUCCESSOR_1692 1693
+#define RIOT_PP_SUCCESSOR_1693 1694
+#define RIOT_PP_SUCCESSOR_1694 1695
+#define RIOT_PP_SUCCESSOR_1695 1696
+#define RIOT_PP_SUCCESSOR_1696 1697
+#define RIOT_PP_SUCCESSOR_1697 1698
+#define RIOT_PP_SUCCESSOR_1698 1699
+#define RIOT_PP_SUCCESSOR_1699 1700
+#define RIOT_PP_SUCCESSOR_1700 1701
+#define RIOT_PP_SUCCESSOR_1701 1702
+#define RIOT_PP_SUCCESSOR_1702 1703
+#define RIOT_PP_SUCCESSOR_1703 1704
+#define RIOT_PP_SUCCESSOR_1704 1705
+#define RIOT_PP_SUCCESSOR_1705 1706
+#define RIOT_PP_SUCCESSOR_1706 1707
+#define RIOT_PP_SUCCESSOR_1707 1708
+#define RIOT_PP_SUCCESSOR_1708 1709
+#define RIOT_PP_SUCCESSOR_1709 1710
+#define RIOT_PP_SUCCESSOR_1710 1711
+#define RIOT_PP_SUCCESSOR_1711 1712
+#define RIOT_PP_SUCCESSOR_1712 1713
+#define RIOT_PP_SUCCESSOR_1713 1714
+#define RIOT_PP_SUCCESSOR_1714 1715
+#define RIOT_PP_SUCCESSOR_1715 1716
+#define RIOT_PP_SUCCESSOR_1716 1717
+#define RIOT_PP_SUCCESSOR_1717 1718
+#define RIOT_PP_SUCCESSOR_1718 1719
+#define RIOT_PP_SUCCESSOR_1719 1720
+#define RIOT_PP_SUCCESSOR_1720 1721
+#define RIOT_PP_SUCCESSOR_1721 1722
+#define RIOT_PP_SUCCESSOR_1722 1723
+#define RIOT_PP_SUCCESSOR_1723 1724
+#define RIOT_PP_SUCCESSOR_1724 1725
+#define RIOT_PP_SUCCESSOR_1725 1726
+#define RIOT_PP_SUCCESSOR_1726 1727
+#define RIOT_PP_SUCCESSOR_1727 1728
+#define RIOT_PP_SUCCESSOR_1728 1729
+#define RIOT_PP_SUCCESSOR_1729 1730
+#define RIOT_PP_SUCCESSOR_1730 1731
+#define RIOT_PP_SUCCESSOR_1731 1732
+#define RIOT_PP_SUCCESSOR_1732 1733
+#define RIOT_PP_SUCCESSOR_1733 1734
+#define RIOT_PP_SUCCESSOR_1734 1735
+#define RIOT_PP_SUCCESSOR_1735 1736
+#define RIOT_PP_SUCCESSOR_1736 1737
+#define RIOT_PP_SUCCESSOR_1737 1738
+#define RIOT_PP_SUCCESSOR_1738 1739
+#define RIOT_PP_SUCCESSOR_1739 1740
+#define RIOT_PP_SUCCESSOR_1740 1741
+#define RIOT_PP_SUCCESSOR_1741 1742
+#define RIOT_PP_SUCCESSOR_1742 1743
+#define RIOT_PP_SUCCESSOR_1743 1744
+#define RIOT_PP_SUCCESSOR_1744 1745
+#define RIOT_PP_SUCCESSOR_1745 1746
+#define RIOT_PP_SUCCESSOR_1746 1747
+#define RIOT_PP_SUCCESSOR_1747 1748
+#define RIOT_PP_SUCCESSOR_1748 1749
+#define RIOT_PP_SUCCESSOR_1749 1750
+#define RIOT_PP_SUCCESSOR_1750 1751
+#define RIOT_PP_SUCCESSOR_1751 1752
+#define RIOT_PP_SUCCESSOR_1752 1753
+#define RIOT_PP_SUCCESSOR_1753 1754
+#define RIOT_PP_SUCCESSOR_1754 1755
+#define RIOT_PP_SUCCESSOR_1755 1756
+#define RIOT_PP_SUCCESSOR_1756 1757
+#define RIOT_PP_SUCCESSOR_1757 1758
+#define RIOT_PP_SUCCESSOR_1758 1759
+#define RIOT_PP_SUCCESSOR_1759 1760
+#define RIOT_PP_SUCCESSOR_1760 1761
+#define RIOT_PP_SUCCESSOR_1761 1762
+#define RIOT_PP_SUCCESSOR_1762 1763
+#define RIOT_PP_SUCCESSOR_1763 1764
+#define RIOT_PP_SUCCESSOR_1764 1765
+#define RIOT_PP_SUCCESSOR_1765 1766
+#define RIOT_PP_SUCCESSOR_1766 1767
+#define RIOT_PP_SUCCESSOR_1767 1768
+#define RIOT_PP_SUCCESSOR_1768 1769
+#define RIOT_PP_SUCCESSOR_1769 1770
+#define RIOT_PP_SUCCESSOR_1770 1771
+#define RIOT_PP_SUCCESSOR_1771 1772
+#define RIOT_PP_SUCCESSOR_1772 1773
+#define RIOT_PP_SUCCESSOR_1773 1774
+#define RIOT_PP_SUCCESSOR_1774 1775
+#define RIOT_PP_SUCCESSOR_1775 1776
+#define RIOT_PP_SUCCESSOR_1776 1777
+#define RIOT_PP_SUCCESSOR_1777 1778
+#define RIOT_PP_SUCCESSOR_1778 1779
+#define RIOT_PP_SUCCESSOR_1779 1780
+#define RIOT_PP_SUCCESSOR_1780 1781
+#define RIOT_PP_SUCCESSOR_1781 1782
+#define RIOT_PP_SUCCESSOR_1782 1783
+#define RIOT_PP_SUCCESSOR_1783 1784
+#define RIOT_PP_SUCCESSOR_1784 1785
+#define RIOT_PP_SUCCESSOR_1785 1786
+#define RIOT_PP_SUCCESSOR_1786 1787
+#define RIOT_PP_SUCCESSOR_1787 1788
+#define RIOT_PP_SUCCESSOR_1788 1789
+#define RIOT_PP_SUCCESSOR_1789 1790
+#define RIOT_PP_SUCCESSOR_1790 1791
+#define RIOT_PP_SUCCESSOR_1791 1792
+#define RIOT_PP_SUCCESSOR_1792 1793
+#define RIOT_PP_SUCCESSOR_1793 1794
+#define RIOT_PP_SUCCESSOR_1794 1795
+#define RIOT_PP_SUCCESSOR_1795 1796
+#define RIOT_PP_SUCCESSOR_1796 1797
+#define RIOT_PP_SUCCESSOR_1797 1798
+#define RIOT_PP_SUCCESSOR_1798 1799
+#define RIOT_PP_SUCCESSOR_1799 1800
+#define RIOT_PP_SUCCESSOR_1800 1801
+#define RIOT_PP_SUCCESSOR_1801 1802
+#define RIOT_PP_SUCCESSOR_1802 1803
+#define RIOT_PP_SUCCESSOR_1803 1804
+#define RIOT_PP_SUCCESSOR_1804 1805
+#define RIOT_PP_SUCCESSOR_1805 1806
+#define RIOT_PP_SUCCESSOR_1806 1807
+#define RIOT_PP_SUCCESSOR_1807 1808
+#define RIOT_PP_SUCCESSOR_1808 1809
+#define RIOT_PP_SUCCESSOR_1809 1810
+#define RIOT_PP_SUCCESSOR_1810 1811
+#define RIOT_PP_SUCCESSOR_1811 1812
+#define RIOT_PP_SUCCESSOR_1812 1813
+#define RIOT_PP_SUCCESSOR_1813 1814
+#define RIOT_PP_SUCCESSOR_1814 1815
+#define RIOT_PP_SUCCESSOR_1815 1816
+#define RIOT_PP_SUCCESSOR_1816 1817
+#define RIOT_PP_SUCCESSOR_1817 1818
+#define RIOT_PP_SUCCESSOR_1818 1819
+#define RIOT_PP_SUCCESSOR_1819 1820
+#define RIOT_PP_SUCCESSOR_1820 1821
+#define RIOT_PP_SUCCESSOR_1821 1822
+#define RIOT_PP_SUCCESSOR_1822 1823
+#define RIOT_PP_SUCCESSOR_1823 1824
+#define RIOT_PP_SUCCESSOR_1824 1825
+#define RIOT_PP_SUCCESSOR_1825 1826
+#define RIOT_PP_SUCCESSOR_1826 1827
+#define RIOT_PP_SUCCESSOR_1827 1828
+#define RIOT_PP_SUCCESSOR_1828 1829
+#define RIOT_PP_SUCCESSOR_1829 1830
+#define RIOT_PP_SUCCESSOR_1830 1831
+#define RIOT_PP_SUCCESSOR_1831 1832
+#define RIOT_PP_SUCCESSOR_1832 1833
+#define RIOT_PP_SUCCESSOR_1833 1834
+#define RIOT_PP_SUCCESSOR_1834 1835
+#define RIOT_PP_SUCCESSOR_1835 1836
+#define RIOT_PP_SUCCESSOR_1836 1837
+#define RIOT_PP_SUCCESSOR_1837 1838
+#define RIOT_PP_SUCCESSOR_1838 1839
+#define RIOT_PP_SUCCESSOR_1839 1840
+#define RIOT_PP_SUCCESSOR_1840 1841
+#define RIOT_PP_SUCCESSOR_1841 1842
+#define RIOT_PP_SUCCESSOR_1842 1843
+#define RIOT_PP_SUCCESSOR_1843 1844
+#define RIOT_PP_SUCCESSOR_1844 1845
+#define RIOT_PP_SUCCESSOR_1845 1846
+#define RIOT_PP_SUCCESSOR_1846 1847
+#define RIOT_PP_SUCCESSOR_1847 1848
+#define RIOT_PP_SUCCESSOR_1848 1849
+#define RIOT_PP_SUCCESSOR_1849 1850
+#define RIOT_PP_SUCCESSOR_1850 1851
+#define RIOT_PP_SUCCESSOR_1851 1852
+#define RIOT_PP_SUCCESSOR_1852 1853
+#define RIOT_PP_SUCCESSOR_1853 1854
+#define RIOT_PP_SUCCESSOR_1854 1855
+#define RIOT_PP_SUCCESSOR_1855 1856
+#define RIOT_PP_SUCCESSOR_1856 1857
+#define RIOT_PP_SUCCESSOR_1857 1858
+#define RIOT_PP_SUCCESSOR_1858 1859
+#define RIOT_PP_SUCCESSOR_1859 1860
+#define RIOT_PP_SUCCESSOR_1860 1861
+#define RIOT_PP_SUCCESSOR_1861 1862
+#define RIOT_PP_SUCCESSOR_1862 1863
+#define RIOT_PP_SUCCESSOR_1863 1864
+#define RIOT_PP_SUCCESSOR_1864 1865
+#define RIOT_PP_SUCCESSOR_1865 1866
+#define RIOT_PP_SUCCESSOR_1866 1867
+#define RIOT_PP_SUCCESSOR_1867 1868
+#define RIOT_PP_SUCCESSOR_1868 1869
+#define RIOT_PP_SUCCESSOR_1869 1870
+#define RIOT_PP_SUCCESSOR_1870 1871
+#define RIOT_PP_SUCCESSOR_1871 1872
+#define RIOT_PP_SUCCESSOR_1872 1873
+#define RIOT_PP_SUCCESSOR_1873 1874
+#define RIOT_PP_SUCCESSOR_1874 1875
+#define RIOT_PP_SUCCESSOR_1875 1876
+#define RIOT_PP_SUCCESSOR_1876 1877
+#define RIOT_PP_SUCCESSOR_1877 1878
+#define RIOT_PP_SUCCESSOR_1878 1879
+#define RIOT_PP_SUCCESSOR_1879 1880
+#define RIOT_PP_SUCCESSOR_1880 1881
+#define RIOT_PP_SUCCESSOR_1881 1882
+#define RIOT_PP_SUCCESSOR_1882 1883
+#define RIOT_PP_SUCCESSOR_1883 1884
+#define RIOT_PP_SUCCESSOR_1884 1885
+#define RIOT_PP_SUCCESSOR_1885 1886
+#define RIOT_PP_SUCCESSOR_1886 1887
+#define RIOT_PP_SUCCESSOR_1887 1888
+#define RIOT_PP_SUCCESSOR_1888 1889
+#define RIOT_PP_SUCCESSOR_1889 1890
+#define RIOT_PP_SUCCESSOR_1890 1891
+#define RIOT_PP_SUCCESSOR_1891 1892
+#define RIOT_PP_SUCCESSOR_1892 1893
+#define RIOT_PP_SUCCESSOR_1893 1894
+#define RIOT_PP_SUCCESSOR_1894 1895
+#define RIOT_PP_SUCCESSOR_1895 1896
+#define RIOT_PP_SUCCESSOR_1896 1897
+#define RIOT_PP_SUCCESSOR_1897 1898
+#define RIOT_PP_SUCCESSOR_1898 1899
+#define RIOT_PP_SUCCESSOR_1899 1900
+#define RIOT_PP_SUCCESSOR_1900 1901
+#define RIOT_PP_SUCCESSOR_1901 1902
+#define RIOT_PP_SUCCESSOR_1902 1903
+#define RIOT_PP_SUCCESSOR_1903 1904
+#define RIOT_PP_SUCCESSOR_1904 1905
+#define RIOT_PP_SUCCESSOR_1905 1906
+#define RIOT_PP_SUCCESSOR_1906 1907
+#define RIOT_PP_SUCCESSOR_1907 1908
+#define RIOT_PP_SUCCESSOR_1908 1909
+#define RIOT_PP_SUCCESSOR_1909 1910
+#define RIOT_PP_SUCCESSOR_1910 1911
+#define RIOT_PP_SUCCESSOR_1911 1912
+#define RIOT_PP_SUCCESSOR_1912 1913
+#define RIOT_PP_SUCCESSOR_1913 1914
+#define RIOT_PP_SUCCESSOR_1914 1915
+#define RIOT_PP_SUCCESSOR_1915 1916
+#define RIOT_PP_SUCCESSOR_1916 1917
+#define RIOT_PP_SUCCESSOR_1917 1918
+#define RIOT_PP_SUCCESSOR_1918 1919
+#define RIOT_PP_SUCCESSOR_1919 1920
+#define RIOT_PP_SUCCESSOR_1920 1921
+#define RIOT_PP_SUCCESSOR_1921 1922
+#define RIOT_PP_SUCCESSOR_1922 1923
+#define RIOT_PP_SUCCESSOR_1923 1924
+#define RIOT_PP_SUCCESSOR_1924 1925
+#define RIOT_PP_SUCCESSOR_1925 1926
+#define RIOT_PP_SUCCESSOR_1926 1927
+#define RIOT_PP_SUCCESSOR_1927 1928
+#define RIOT_PP_SUCCESSOR_1928 1929
+#define RIOT_PP_SUCCESSOR_1929 1930
+#define RIOT_PP_SUCCESSOR_1930 1931
+#define RIOT_PP_SUCCESSOR_1931 1932
+#define RIOT_PP_SUCCESSOR_1932 1933
+#define RIOT_PP_SUCCESSOR_1933 1934
+#define RIOT_PP_SUCCESSOR_1934 1935
+#define RIOT_PP_SUCCESSOR_1935 1936
+#define RIOT_PP_SUCCESSOR_1936 1937
+#define RIOT_PP_SUCCESSOR_1937 1938
+#define RIOT_PP_SUCCESSOR_1938 1939
+#define RIOT_PP_SUCCESSOR_1939 1940
+#define RIOT_PP_SUCCESSOR_1940 1941
+#define RIOT_PP_SUCCESSOR_1941 1942
+#define RIOT_PP_SUCCESSOR_1942 1943
+#define RIOT_PP_SUCCESSOR_1943 1944
+#define RIOT_PP_SUCCESSOR_1944 1945
+#define RIOT_PP_SUCCESSOR_1945 1946
+#define RIOT_PP_SUCCESSOR_1946 1947
+#define RIOT_PP_SUCCESSOR_1947 1948
+#define RIOT_PP_SUCCESSOR_1948 1949
+#define RIOT_PP_SUCCESSOR_1949 1950
+#define RIOT_PP_SUCCESSOR_1950 1951
+#define RIOT_PP_SUCCESSOR_1951 1952
+#define RIOT_PP_SUCCESSOR_1952 1953
+#define RIOT_PP_SUCCESSOR_1953 1954
+#define RIOT_PP_SUCCESSOR_1954 1955
+#define RIOT_PP_SUCCESSOR_1955 1956
+#define RIOT_PP_SUCCESSOR_1956 1957
+#define RIOT_PP_SUCCESSOR_1957 1958
+#define RIOT_PP_SUCCESSOR_1958 1959
+#define RIOT_PP_SUCCESSOR_1959 1960
+#define RIOT_PP_SUCCESSOR_1960 1961
+#define RIOT_PP_SUCCESSOR_1961 1962
+#define RIOT_PP_SUCCESSOR_1962 1963
+#define RIOT_PP_SUCCESSOR_1963 1964
+#define RIOT_PP_SUCCESSOR_1964 1965
+#define RIOT_PP_SUCCESSOR_1965 1966
+#define RIOT_PP_SUCCESSOR_1966 1967
+#define RIOT_PP_SUCCESSOR_1967 1968
+#define RIOT_PP_SUCCESSOR_1968 1969
+#define RIOT_PP_SUCCESSOR_1969 1970
+#define RIOT_PP_SUCCESSOR_1970 1971
+#define RIOT_PP_SUCCESSOR_1971 1972
+#define RIOT_PP_SUCCESSOR_1972 1973
+#define RIOT_PP_SUCCESSOR_1973 1974
+#define RIOT_PP_SUCCESSOR_1974 1975
+#define RIOT_PP_SUCCESSOR_1975 1976
+#define RIOT_PP_SUCCESSOR_1976 1977
+#define RIOT_PP_SUCCESSOR_1977 1978
+#define RIOT_PP_SUCCESSOR_1978 1979
+#define RIOT_PP_SUCCESSOR_1979 1980
+#define RIOT_PP_SUCCESSOR_1980 1981
+#define RIOT_PP_SUCCESSOR_1981 1982
+#define RIOT_PP_SUCCESSOR_1982 1983
+#define RIOT_PP_SUCCESSOR_1983 1984
+#define RIOT_PP_SUCCESSOR_1984 1985
+#define RIOT_PP_SUCCESSOR_1985 1986
+#define RIOT_PP_SUCCESSOR_1986 1987
+#define RIOT_PP_SUCCESSOR_1987 1988
+#define RIOT_PP_SUCCESSOR_1988 1989
+#define RIOT_PP_SUCCESSOR_1989 1990
+#define RIOT_PP_SUCCESSOR_1990 1991
+#define RIOT_PP_SUCCESSOR_1991 1992
+#define RIOT_PP_SUCCESSOR_1992 1993
+#define RIOT_PP_SUCCESSOR_1993 1994
+#define RIOT_PP_SUCCESSOR_1994 1995
+#define RIOT_PP_SUCCESSOR_1995 1996
+#define RIOT_PP_SUCCESSOR_1996 1997
+#define RIOT_PP_SUCCESSOR_1997 1998
+#define RIOT_PP_SUCCESSOR_1998 1999
+#define RIOT_PP_SUCCESSOR_1999 2000
+#define RIOT_PP_SUCCESSOR_2000 2001
+#define RIOT_PP_SUCCESSOR_2001 2002
+#define RIOT_PP_SUCCESSOR_2002 2003
+#define RIOT_PP_SUCCESSOR_2003 2004
+#define RIOT_PP_SUCCESSOR_2004 2005
+#define RIOT_PP_SUCCESSOR_2005 2006
+#define RIOT_PP_SUCCESSOR_2006 2007
+#define RIOT_PP_SUCCESSOR_2007 2008
+#define RIOT_PP_SUCCESSOR_2008 2009
+#define RIOT_PP_SUCCESSOR_2009 2010
+#define RIOT_PP_SUCCESSOR_2010 2011
+#define RIOT_PP_SUCCESSOR_2011 2012
+#define RIOT_PP_SUCCESSOR_2012 2013
+#define RIOT_PP_SUCCESSOR_2013 2014
+#define RIOT_PP_SUCCESSOR_2014 2015
+#define RIOT_PP_SUCCESSOR_2015 2016
+#define RIOT_PP_SUCCESSOR_2016 2017
+#define RIOT_PP_SUCCESSOR_2017 2018
+#define RIOT_PP_SUCCESSOR_2018 2019
+#define RIOT_PP_SUCCESSOR_2019 2020
+#define RIOT_PP_SUCCESSOR_2020 2021
+#define RIOT_PP_SUCCESSOR_2021 2022
+#define RIOT_PP_SUCCESSOR_2022 2023
+#define RIOT_PP_SUCCESSOR_2023 2024
+#define RIOT_PP_SUCCESSOR_2024 2025
+#define RIOT_PP_SUCCESSOR_2025 2026
+#define RIOT_PP_SUCCESSOR_2026 2027
+#define RIOT_PP_SUCCESSOR_2027 2028
+#define RIOT_PP_SUCCESSOR_2028 2029
+#define RIOT_PP_SUCCESSOR_2029 2030
+#define RIOT_PP_SUCCESSOR_2030 2031
+#define RIOT_PP_SUCCESSOR_2031 2032
+#define RIOT_PP_SUCCESSOR_2032 2033
+#define RIOT_PP_SUCCESSOR_2033 2034
+#define RIOT_PP_SUCCESSOR_2034 2035
+#define RIOT_PP_SUCCESSOR_2035 2036
+#define RIOT_PP_SUCCESSOR_2036 2037
+#define RIOT_PP_SUCCESSOR_2037 2038
+#define RIOT_PP_SUCCESSOR_2038 2039
+#define RIOT_PP_SUCCESSOR_2039 2040
+#define RIOT_PP_SUCCESSOR_2040 2041
+#define RIOT_PP_SUCCESSOR_2041 2042
+#define RIOT_PP_SUCCESSOR_2042 2043
+#define RIOT_PP_SUCCESSOR_2043 2044
+#define RIOT_PP_SUCCESSOR_2044 2045
+#define RIOT_PP_SUCCESSOR_2045 2046
+#define RIOT_PP_SUCCESSOR_2046 2047
+#define RIOT_PP_SUCCESSOR_2047 2048
+#define RIOT_PP_SUCCESSOR_2048 2049
+#define RIOT_PP_SUCCESSOR_2049 2050
+#define RIOT_PP_SUCCESSOR_2050 2051
+#define RIOT_PP_SUCCESSOR_2051 2052
+#define RIOT_PP_SUCCESSOR_2052 2053
+#define RIOT_PP_SUCCESSOR_2053 2054
+#define RIOT_PP_SUCCESSOR_2054 2055
+#define RIOT_PP_SUCCESSOR_2055 2056
+#define RIOT_PP_SUCCESSOR_2056 2057
+#define RIOT_PP_SUCCESSOR_2057 2058
+#define RIOT_PP_SUCCESSOR_2058 2059
+#define RIOT_PP_SUCCESSOR_2059 2060
+#define RIOT_PP_SUCCESSOR_2060 2061
+#define RIOT_PP_SUCCESSOR_2061 2062
+#define RIOT_PP_SUCCESSOR_2062 2063
+#define RIOT_PP_SUCCESSOR_2063 2064
+#define RIOT_PP_SUCCESSOR_2064 2065
+#define RIOT_PP_SUCCESSOR_2065 2066
+#define RIOT_PP_SUCCESSOR_2066 2067
+#define RIOT_PP_SUCCESSOR_2067 2068
+#define RIOT_PP_SUCCESSOR_2068 2069
+#define RIOT_PP_SUCCESSOR_2069 2070
+#define RIOT_PP_SUCCESSOR_2070 2071
+#define RIOT_PP_SUCCESSOR_2071 2072
+#define RIOT_PP_SUCCESSOR_2072 2073
+#define RIOT_PP_SUCCESSOR_2073 2074
+#define RIOT_PP_SUCCESSOR_2074 2075
+#define RIOT_PP_SUCCESSOR_2075 2076
+#define RIOT_PP_SUCCESSOR_2076 2077
+#define RIOT_PP_SUCCESSOR_2077 2078
+#define RIOT_PP_SUCCESSOR_2078 2079
+#define RIOT_PP_SUCCESSOR_2079 2080
+#define RIOT_PP_SUCCESSOR_2080 2081
+#define RIOT_PP_SUCCESSOR_2081 2082
+#define RIOT_PP_SUCCESSOR_2082 2083
+#define RIOT_PP_SUCCESSOR_2083 2084
+#define RIOT_PP_SUCCESSOR_2084 2085
+#define RIOT_PP_SUCCESSOR_2085 2086
+#define RIOT_PP_SUCCESSOR_2086 2087
+#define RIOT_PP_SUCCESSOR_2087 2088
+#define RIOT_PP_SUCCESSOR_2088 2089
+#define RIOT_PP_SUCCESSOR_2089 2090
+#define RIOT_PP_SUCCESSOR_2090 2091
+#define RIOT_PP_SUCCESSOR_2091 2092
+#define RIOT_PP_SUCCESSOR_2092 2093
+#define RIOT_PP_SUCCESSOR_2093 2094
+#define RIOT_PP_SUCCESSOR_2094 2095
+#define RIOT_PP_SUCCESSOR_2095 2096
+#define RIOT_PP_SUCCESSOR_2096 2097
+#define RIOT_PP_SUCCESSOR_2097 2098
+#define RIOT_PP_SUCCESSOR_2098 2099
+#define RIOT_PP_SUCCESSOR_2099 2100
+#define RIOT_PP_SUCCESSOR_2100 2101
+#define RIOT_PP_SUCCESSOR_2101 2102
+#define RIOT_PP_SUCCESSOR_2102 2103
+#define RIOT_PP_SUCCESSOR_2103 2104
+#define RIOT_PP_SUCCESSOR_2104 2105
+#define RIOT_PP_SUCCESSOR_2105 2106
+#define RIOT_PP_SUCCESSOR_2106 2107
+#define RIOT_PP_SUCCESSOR_2107 2108
+#define RIOT_PP_SUCCESSOR_2108 2109
+#define RIOT_PP_SUCCESSOR_2109 2110
+#define RIOT_PP_SUCCESSOR_2110 2111
+#define RIOT_PP_SUCCESSOR_2111 2112
+#define RIOT_PP_SUCCESSOR_2112 2113
+#define RIOT_PP_SUCCESSOR_2113 2114
+#define RIOT_PP_SUCCESSOR_2114 2115
+#define RIOT_PP_SUCCESSOR_2115 2116
+#define RIOT_PP_SUCCESSOR_2116 2117
+#define RIOT_PP_SUCCESSOR_2117 2118
+#define RIOT_PP_SUCCESSOR_2118 2119
+#define RIOT_PP_SUCCESSOR_2119 2120
+#define RIOT_PP_SUCCESSOR_2120 2121
+#define RIOT_PP_SUCCESSOR_2121 2122
+#define RIOT_PP_SUCCESSOR_2122 2123
+#define RIOT_PP_SUCCESSOR_2123 2124
+#define RIOT_PP_SUCCESSOR_2124 2125
+#define RIOT_PP_SUCCESSOR_2125 2126
+#define RIOT_PP_SUCCESSOR_2126 2127
+#define RIOT_PP_SUCCESSOR_2127 2128
+#define RIOT_PP_SUCCESSOR_2128 2129
+#define RIOT_PP_SUCCESSOR_2129 2130
+#define RIOT_PP_SUCCESSOR_2130 2131
+#define RIOT_PP_SUCCESSOR_2131 2132
+#define RIOT_PP_SUCCESSOR_2132 2133
+#define RIOT_PP_SUCCESSOR_2133 2134
+#define RIOT_PP_SUCCESSOR_2134 2135
+#define RIOT_PP_SUCCESSOR_2135 2136
+#define RIOT_PP_SUCCESSOR_2136 2137
+#define RIOT_PP_SUCCESSOR_2137 2138
+#define RIOT_PP_SUCCESSOR_2138 2139
+#define RIOT_PP_SUCCESSOR_2139 2140
+#define RIOT_PP_SUCCESSOR_2140 2141
+#define RIOT_PP_SUCCESSOR_2141 2142
+#define RIOT_PP_SUCCESSOR_2142 2143
+#define RIOT_PP_SUCCESSOR_2143 2144
+#define RIOT_PP_SUCCESSOR_2144 2145
+#define RIOT_PP_SUCCESSOR_2145 2146
+#define RIOT_PP_SUCCESSOR_2146 2147
+#define RIOT_PP_SUCCESSOR_2147 2148
+#define RIOT_PP_SUCCESSOR_2148 2149
+#define RIOT_PP_SUCCESSOR_2149 2150
+#define RIOT_PP_SUCCESSOR_2150 2151
+#define RIOT_PP_SUCCESSOR_2151 2152
+#define RIOT_PP_SUCCESSOR_2152 2153
+#define RIOT_PP_SUCCESSOR_2153 2154
+#define RIOT_PP_SUCCESSOR_2154 2155
+#define RIOT_PP_SUCCESSOR_2155 2156
+#define RIOT_PP_SUCCESSOR_2156 2157
+#define RIOT_PP_SUCCESSOR_2157 2158
+#define RIOT_PP_SUCCESSOR_2158 2159
+#define RIOT_PP_SUCCESSOR_2159 2160
+#define RIOT_PP_SUCCESSOR_2160 2161
+#define RIOT_PP_SUCCESSOR_2161 2162
+#define RIOT_PP_SUCCESSOR_2162 2163
+#define RIOT_PP_SUCCESSOR_2163 2164
+#define RIOT_PP_SUCCESSOR_2164 2165
+#define RIOT_PP_SUCCESSOR_2165 2166
+#define RIOT_PP_SUCCESSOR_2166 2167
+#define RIOT_PP_SUCCESSOR_2167 2168
+#define RIOT_PP_SUCCESSOR_2168 2169
+#define RIOT_PP_SUCCESSOR_2169 2170
+#define RIOT_PP_SUCCESSOR_2170 2171
+#define RIOT_PP_SUCCESSOR_2171 2172
+#define RIOT_PP_SUCCESSOR_2172 2173
+#define RIOT_PP_SUCCESSOR_2173 2174
+#define RIOT_PP_SUCCESSOR_2174 2175
+#define RIOT_PP_SUCCESSOR_2175 2176
+#define RIOT_PP_SUCCESSOR_2176 2177
+#define RIOT_PP_SUCCESSOR_2177 2178
+#define RIOT_PP_SUCCESSOR_2178 2179
+#define RIOT_PP_SUCCESSOR_2179 2180
+#define RIOT_PP_SUCCESSOR_2180 2181
+#define RIOT_PP_SUCCESSOR_2181 2182
+#define RIOT_PP_SUCCESSOR_2182 2183
+#define RIOT_PP_SUCCESSOR_2183 2184
+#define RIOT_PP_SUCCESSOR_2184 2185
+#define RIOT_PP_SUCCESSOR_2185 2186
+#define RIOT_PP_SUCCESSOR_2186 2187
+#define RIOT_PP_SUCCESSOR_2187 2188
+#define RIOT_PP_SUCCESSOR_2188 2189
+#define RIOT_PP_SUCCESSOR_2189 2190
+#define RIOT_PP_SUCCESSOR_2190 2191
+#define RIOT_PP_SUCCESSOR_2191 2192
+#define RIOT_PP_SUCCESSOR_2192 2193
+#define RIOT_PP_SUCCESSOR_2193 2194
+#define RIOT_PP_SUCCESSOR_2194 2195
+#define RIOT_PP_SUCCESSOR_2195 2196
+#define RIOT_PP_SUCCESSOR_2196 2197
+#define RIOT_PP_SUCCESSOR_2197 2198
+#define RIOT_PP_SUCCESSOR_2198 2199
+#define RIOT_PP_SUCCESSOR_2199 2200
+#define RIOT_PP_SUCCESSOR_2200 2201
+#define RIOT_PP_SUCCESSOR_2201 2202
+#define RIOT_PP_SUCCESSOR_2202 2203
+#define RIOT_PP_SUCCESSOR_2203 2204
+#define RIOT_PP_SUCCESSOR_2204 2205
+#define RIOT_PP_SUCCESSOR_2205 2206
+#define RIOT_PP_SUCCESSOR_2206 2207
+#define RIOT_PP_SUCCESSOR_2207 2208
+#define RIOT_PP_SUCCESSOR_2208 2209
+#define RIOT_PP_SUCCESSOR_2209 2210
+#define RIOT_PP_SUCCESSOR_2210 2211
+#define RIOT_PP_SUCCESSOR_2211 2212
+#define RIOT_PP_SUCCESSOR_2212 2213
+#define RIOT_PP_SUCCESSOR_2213 2214
+#define RIOT_PP_SUCCESSOR_2214 2215
+#define RIOT_PP_SUCCESSOR_2215 2216
+#define RIOT_PP_SUCCESSOR_2216 2217
+#define RIOT_PP_SUCCESSOR_2217 2218
+#define RIOT_PP_SUCCESSOR_2218 2219
+#define RIOT_PP_SUCCESSOR_2219 2220
+#define RIOT_PP_SUCCESSOR_2220 2221
+#define RIOT_PP_SUCCESSOR_2221 2222
+#define RIOT_PP_SUCCESSOR_2222 2223
+#define RIOT_PP_SUCCESSOR_2223 2224
+#define RIOT_PP_SUCCESSOR_2224 2225
+#define RIOT_PP_SUCCESSOR_2225 2226
+#define RIOT_PP_SUCCESSOR_2226 2227
+#define RIOT_PP_SUCCESSOR_2227 2228
+#define RIOT_PP_SUCCESSOR_2228 2229
+#define RIOT_PP_SUCCESSOR_2229 2230
+#define RIOT_PP_SUCCESSOR_2230 2231
+#define RIOT_PP_SUCCESSOR_2231 2232
+#define RIOT_PP_SUCCESSOR_2232 2233
+#define RIOT_PP_SUCCESSOR_2233 2234
+#define RIOT_PP_SUCCESSOR_2234 2235
+#define RIOT_PP_SUCCESSOR_2235 2236
+#define RIOT_PP_SUCCESSOR_2236 2237
+#define RIOT_PP_SUCCESSOR_2237 2238
+#define RIOT_PP_SUCCESSOR_2238 2239
+#define RIOT_PP_SUCCESSOR_2239 2240
+#define RIOT_PP_SUCCESSOR_2240 2241
+#define RIOT_PP_SUCCESSOR_2241 2242
+#define RIOT_PP_SUCCESSOR_2242 2243
+#define RIOT_PP_SUCCESSOR_2243 2244
+#define RIOT_PP_SUCCESSOR_2244 2245
+#define RIOT_PP_SUCCESSOR_2245 2246
+#define RIOT_PP_SUCCESSOR_2246 2247
+#define RIOT_PP_SUCCESSOR_2247 2248
+#define RIOT_PP_SUCCESSOR_2248 2249
+#define RIOT_PP_SUCCESSOR_2249 2250
+#define RIOT_PP_SUCCESSOR_2250 2251
+#define RIOT_PP_SUCCESSOR_2251 2252
+#define RIOT_PP_SUCCESSOR_2252 2253
+#define RIOT_PP_SUCCESSOR_2253 2254
+#define RIOT_PP_SUCCESSOR_2254 2255
+#define RIOT_PP_SUCCESSOR_2255 2256
+#define RIOT_PP_SUCCESSOR_2256 2257
+#define RIOT_PP_SUCCESSOR_2257 2258
+#define RIOT_PP_SUCCESSOR_2258 2259
+#define RIOT_PP_SUCCESSOR_2259 2260
+#define RIOT_PP_SUCCESSOR_2260 2261
+#define RIOT_PP_SUCCESSOR_2261 2262
+#define RIOT_PP_SUCCESSOR_2262 2263
+#define RIOT_PP_SUCCESSOR_2263 2264
+#define RIOT_PP_SUCCESSOR_2264 2265
+#define RIOT_PP_SUCCESSOR_2265 2266
+#define RIOT_PP_SUCCESSOR_2266 2267
+#define RIOT_PP_SUCCESSOR_2267 2268
+#define RIOT_PP_SUCCESSOR_2268 2269
+#define RIOT_PP_SUCCESSOR_2269 2270
+#define RIOT_PP_SUCCESSOR_2270 2271
+#define RIOT_PP_SUCCESSOR_2271 2272
+#define RIOT_PP_SUCCESSOR_2272 2273
+#define RIOT_PP_SUCCESSOR_2273 2274
+#define RIOT_PP_SUCCESSOR_2274 2275
+#define RIOT_PP_SUCCESSOR_2275 2276
+#define RIOT_PP_SUCCESSOR_2276 2277
+#define RIOT_PP_SUCCESSOR_2277 2278
+#define RIOT_PP_SUCCESSOR_2278 2279
+#define RIOT_PP_SUCCESSOR_2279 2280
+#define RIOT_PP_SUCCESSOR_2280 2281
+#define RIOT_PP_SUCCESSOR_2281 2282
+#define RIOT_PP_SUCCESSOR_2282 2283
+#define RIOT_PP_SUCCESSOR_2283 2284
+#define RIOT_PP_SUCCESSOR_2284 2285
+#define RIOT_PP_SUCCESSOR_2285 2286
+#define RIOT_PP_SUCCESSOR_2286 2287
+#define RIOT_PP_SUCCESSOR_2287 2288
+#define RIOT_PP_SUCCESSOR_2288 2289
+#define RIOT_PP_SUCCESSOR_2289 2290
+#define RIOT_PP_SUCCESSOR_2290 2291
+#define RIOT_PP_SUCCESSOR_2291 2292
+#define RIOT_PP_SUCCESSOR_2292 2293
+#define RIOT_PP_SUCCESSOR_2293 2294
+#define RIOT_PP_SUCCESSOR_2294 2295
+#define RIOT_PP_SUCCESSOR_2295 2296
+#define RIOT_PP_SUCCESSOR_2296 2297
+#define RIOT_PP_SUCCESSOR_2297 2298
+#define RIOT_PP_SUCCESSOR_2298 2299
+#define RIOT_PP_SUCCESSOR_2299 2300
+#define RIOT_PP_SUCCESSOR_2300 2301
+#define RIOT_PP_SUCCESSOR_2301 2302
+#define RIOT_PP_SUCCESSOR_2302 2303
+#define RIOT_PP_SUCCESSOR_2303 2304
+#define RIOT_PP_SUCCESSOR_2304 2305
+#define RIOT_PP_SUCCESSOR_2305 2306
+#define RIOT_PP_SUCCESSOR_2306 2307
+#define RIOT_PP_SUCCESSOR_2307 2308
+#define RIOT_PP_SUCCESSOR_2308 2309
+#define RIOT_PP_SUCCESSOR_2309 2310
+#define RIOT_PP_SUCCESSOR_2310 2311
+#define RIOT_PP_SUCCESSOR_2311 2312
+#define RIOT_PP_SUCCESSOR_2312 2313
+#define RIOT_PP_SUCCESSOR_2313 2314
+#define RIOT_PP_SUCCESSOR_2314 2315
+#define RIOT_PP_SUCCESSOR_2315 2316
+#define RIOT_PP_SUCCESSOR_2316 2317
+#define RIOT_PP_SUCCESSOR_2317 2318
+#define RIOT_PP_SUCCESSOR_2318 2319
+#define RIOT_PP_SUCCESSOR_2319 2320
+#define RIOT_PP_SUCCESSOR_2320 2321
+#define RIOT_PP_SUCCESSOR_2321 2322
+#define RIOT_PP_SUCCESSOR_2322 2323
+#define RIOT_PP_SUCCESSOR_2323 2324
+#define RIOT_PP_SUCCESSOR_2324 2325
+#define RIOT_PP_SUCCESSOR_2325 2326
+#define RIOT_PP_SUCCESSOR_2326 2327
+#define RIOT_PP_SUCCESSOR_2327 2328
+#define RIOT_PP_SUCCESSOR_2328 2329
+#define RIOT_PP_SUCCESSOR_2329 2330
+#define RIOT_PP_SUCCESSOR_2330 2331
+#define RIOT_PP_SUCCESSOR_2331 2332
+#define RIOT_PP_SUCCESSOR_2332 2333
+#define RIOT_PP_SUCCESSOR_2333 2334
+#define RIOT_PP_SUCCESSOR_2334 2335
+#define RIOT_PP_SUCCESSOR_2335 2336
+#define RIOT_PP_SUCCESSOR_2336 2337
+#define RIOT_PP_SUCCESSOR_2337 2338
+#define RIOT_PP_SUCCESSOR_2338 2339
+#define RIOT_PP_SUCCESSOR_2339 2340
+#define RIOT_PP_SUCCESSOR_2340 2341
+#define RIOT_PP_SUCCESSOR_2341 2342
+#define RIOT_PP_SUCCESSOR_2342 2343
+#define RIOT_PP_SUCCESSOR_2343 2344
+#define RIOT_PP_SUCCESSOR_2344 2345
+#define RIOT_PP_SUCCESSOR_2345 2346
+#define RIOT_PP_SUCCESSOR_2346 2347
+#define RIOT_PP_SUCCESSOR_2347 2348
+#define RIOT_PP_SUCCESSOR_2348 2349
+#define RIOT_PP_SUCCESSOR_2349 2350
+#define RIOT_PP_SUCCESSOR_2350 2351
+#define RIOT_PP_SUCCESSOR_2351 2352
+#define RIOT_PP_SUCCESSOR_2352 2353
+#define RIOT_PP_SUCCESSOR_2353 2354
+#define RIOT_PP_SUCCESSOR_2354 2355
+#define RIOT_PP_SUCCESSOR_2355 2356
+#define RIOT_PP_SUCCESSOR_2356 2357
+#define RIOT_PP_SUCCESSOR_2357 2358
+#define RIOT_PP_SUCCESSOR_2358 2359
+#define RIOT_PP_SUCCESSOR_2359 2360
+#define RIOT_PP_SUCCESSOR_2360 2361
+#define RIOT_PP_SUCCESSOR_2361 2362
+#define RIOT_PP_SUCCESSOR_2362 2363
+#define RIOT_PP_SUCCESSOR_2363 2364
+#define RIOT_PP_SUCCESSOR_2364 2365
+#define RIOT_PP_SUCCESSOR_2365 2366
+#define RIOT_PP_SUCCESSOR_2366 2367
+#define RIOT_PP_SUCCESSOR_2367 2368
+#define RIOT_PP_SUCCESSOR_2368 2369
+#define RIOT_PP_SUCCESSOR_2369 2370
+#define RIOT_PP_SUCCESSOR_2370 2371
+#define RIOT_PP_SUCCESSOR_2371 2372
+#define RIOT_PP_SUCCESSOR_2372 2373
+#define RIOT_PP_SUCCESSOR_2373 2374
+#define RIOT_PP_SUCCESSOR_2374 2375
+#define RIOT_PP_SUCCESSOR_2375 2376
+#define RIOT_PP_SUCCESSOR_2376 2377
+#define RIOT_PP_SUCCESSOR_2377 2378
+#define RIOT_PP_SUCCESSOR_2378 2379
+#define RIOT_PP_SUCCESSOR_2379 2380
+#define RIOT_PP_SUCCESSOR_2380 2381
+#define RIOT_PP_SUCCESSOR_2381 2382
+#define RIOT_PP_SUCCESSOR_2382 2383
+#define RIOT_PP_SUCCESSOR_2383 2384
+#define RIOT_PP_SUCCESSOR_2384 2385
+#define RIOT_PP_SUCCESSOR_2385 2386
+#define RIOT_PP_SUCCESSOR_2386 2387
+#define RIOT_PP_SUCCESSOR_2387 2388
+#define RIOT_PP_SUCCESSOR_2388 2389
+#define RIOT_PP_SUCCESSOR_2389 2390
+#define RIOT_PP_SUCCESSOR_2390 2391
+#define RIOT_PP_SUCCESSOR_2391 2392
+#define RIOT_PP_SUCCESSOR_2392 2393
+#define RIOT_PP_SUCCESSOR_2393 2394
+#define RIOT_PP_SUCCESSOR_2394 2395
+#define RIOT_PP_SUCCESSOR_2395 2396
+#define RIOT_PP_SUCCESSOR_2396 2397
+#define RIOT_PP_SUCCESSOR_2397 2398
+#define RIOT_PP_SUCCESSOR_2398 2399
+#define RIOT_PP_SUCCESSOR_2399 2400
+#define RIOT_PP_SUCCESSOR_2400 2401
+#define RIOT_PP_SUCCESSOR_2401 2402
+#define RIOT_PP_SUCCESSOR_2402 2403
+#define RIOT_PP_SUCCESSOR_2403 2404
+#define RIOT_PP_SUCCESSOR_2404 2405
+#define RIOT_PP_SUCCESSOR_2405 2406
+#define RIOT_PP_SUCCESSOR_2406 2407
+#define RIOT_PP_SUCCESSOR_2407 2408
+#define RIOT_PP_SUCCESSOR_2408 2409
+#define RIOT_PP_SUCCESSOR_2409 2410
+#define RIOT_PP_SUCCESSOR_2410 2411
+#define RIOT_PP_SUCCESSOR_2411 2412
+#define RIOT_PP_SUCCESSOR_2412 2413
+#define RIOT_PP_SUCCESSOR_2413 2414
+#define RIOT_PP_SUCCESSOR_2414 2415
+#define RIOT_PP_SUCCESSOR_2415 2416
+#define RIOT_PP_SUCCESSOR_2416 2417
+#define RIOT_PP_SUCCESSOR_2417 2418
+#define RIOT_PP_SUCCESSOR_2418 2419
+#define RIOT_PP_SUCCESSOR_2419 2420
+#define RIOT_PP_SUCCESSOR_2420 2421
+#define RIOT_PP_SUCCESSOR_2421 2422
+#define RIOT_PP_SUCCESSOR_2422 2423
+#define RIOT_PP_SUCCESSOR_2423 2424
+#define RIOT_PP_SUCCESSOR_2424 2425
+#define RIOT_PP_SUCCESSOR_2425 2426
+#define RIOT_PP_SUCCESSOR_2426 2427
+#define RIOT_PP_SUCCESSOR_2427 2428
+#define RIOT_PP_SUCCESSOR_2428 2429
+#define RIOT_PP_SUCCESSOR_2429 2430
+#define RIOT_PP_SUCCESSOR_2430 2431
+#define RIOT_PP_SUCCESSOR_2431 2432
+#define RIOT_PP_SUCCESSOR_2432 2433
+#define RIOT_PP_SUCCESSOR_2433 2434
+#define RIOT_PP_SUCCESSOR_2434 2435
+#define RIOT_PP_SUCCESSOR_2435 2436
+#define RIOT_PP_SUCCESSOR_2436 2437
+#define RIOT_PP_SUCCESSOR_2437 2438
+#define RIOT_PP_SUCCESSOR_2438 2439
+#define RIOT_PP_SUCCESSOR_2439 2440
+#define RIOT_PP_SUCCESSOR_2440 2441
+#define RIOT_PP_SUCCESSOR_2441 2442
+#define RIOT_PP_SUCCESSOR_2442 2443
+#define RIOT_PP_SUCCESSOR_2443 2444
+#define RIOT_PP_SUCCESSOR_2444 2445
+#define RIOT_PP_SUCCESSOR_2445 2446
+#define RIOT_PP_SUCCESSOR_2446 2447
+#define RIOT_PP_SUCCESSOR_2447 2448
+#define RIOT_PP_SUCCESSOR_2448 2449
+#define RIOT_PP_SUCCESSOR_2449 2450
+#define RIOT_PP_SUCCESSOR_2450 2451
+#define RIOT_PP_SUCCESSOR_2451 2452
+#define RIOT_PP_SUCCESSOR_2452 2453
+#define RIOT_PP_SUCCESSOR_2453 2454
+#define RIOT_PP_SUCCESSOR_2454 2455
+#define RIOT_PP_SUCCESSOR_2455 2456
+#define RIOT_PP_SUCCESSOR_2456 2457
+#define RIOT_PP_SUCCESSOR_2457 2458
+#define RIOT_PP_SUCCESSOR_2458 2459
+#define RIOT_PP_SUCCESSOR_2459 2460
+#define RIOT_PP_SUCCESSOR_2460 2461
+#define RIOT_PP_SUCCESSOR_2461 2462
+#define RIOT_PP_SUCCESSOR_2462 2463
+#define RIOT_PP_SUCCESSOR_2463 2464
+#define RIOT_PP_SUCCESSOR_2464 2465
+#define RIOT_PP_SUCCESSOR_2465 2466
+#define RIOT_PP_SUCCESSOR_2466 2467
+#define RIOT_PP_SUCCESSOR_2467 2468
+#define RIOT_PP_SUCCESSOR_2468 2469
+#define RIOT_PP_SUCCESSOR_2469 2470
+#define RIOT_PP_SUCCESSOR_2470 2471
+#define RIOT_PP_SUCCESSOR_2471 2472
+#define RIOT_PP_SUCCESSOR_2472 2473
+#define RIOT_PP_SUCCESSOR_2473 2474
+#define RIOT_PP_SUCCESSOR_2474 2475
+#define RIOT_PP_SUCCESSOR_2475 2476
+#define RIOT_PP_SUCCESSOR_2476 2477
+#define RIOT_PP_SUCCESSOR_2477 2478
+#define RIOT_PP_SUCCESSOR_2478 2479
+#define RIOT_PP_SUCCESSOR_2479 2480
+#define RIOT_PP_SUCCESSOR_2480 2481
+#define RIOT_PP_SUCCESSOR_2481 2482
+#define RIOT_PP_SUCCESSOR_2482 2483
+#define RIOT_PP_SUCCESSOR_2483 2484
+#define RIOT_PP_SUCCESSOR_2484 2485
+#define RIOT_PP_SUCCESSOR_2485 2486
+#define RIOT_PP_SUCCESSOR_2486 2487
+#define RIOT_PP_SUCCESSOR_2487 2488
+#define RIOT_PP_SUCCESSOR_2488 2489
+#define RIOT_PP_SUCCESSOR_2489 2490
+#define RIOT_PP_SUCCESSOR_2490 2491
+#define RIOT_PP_SUCCESSOR_2491 2492
+#define RIOT_PP_SUCCESSOR_2492 2493
+#define RIOT_PP_SUCCESSOR_2493 2494
+#define RIOT_PP_SUCCESSOR_2494 2495
+#define RIOT_PP_SUCCESSOR_2495 2496
+#define RIOT_PP_SUCCESSOR_2496 2497
+#define RIOT_PP_SUCCESSOR_2497 2498
+#define RIOT_PP_SUCCESSOR_2498 2499
+#define RIOT_PP_SUCCESSOR_2499 2500
+#define RIOT_PP_SUCCESSOR_2500 2501
+#define RIOT_PP_SUCCESSOR_2501 2502
+#define RIOT_PP_SUCCESSOR_2502 2503
+#define RIOT_PP_SUCCESSOR_2503 2504
+#define RIOT_PP_SUCCESSOR_2504 2505
+#define RIOT_PP_SUCCESSOR_2505 2506
+#define RIOT_PP_SUCCESSOR_2506 2507
+#define RIOT_PP_SUCCESSOR_2507 2508
+#define RIOT_PP_SUCCESSOR_2508 2509
+#define RIOT_PP_SUCCESSOR_2509 2510
+#define RIOT_PP_SUCCESSOR_2510 2511
+#define RIOT_PP_SUCCESSOR_2511 2512
+#define RIOT_PP_SUCCESSOR_2512 2513
+#define RIOT_PP_SUCCESSOR_2513 2514
+#define RIOT_PP_SUCCESSOR_2514 2515
+#define RIOT_PP_SUCCESSOR_2515 2516
+#define RIOT_PP_SUCCESSOR_2516 2517
+#define RIOT_PP_SUCCESSOR_2517 2518
+#define RIOT_PP_SUCCESSOR_2518 2519
+#define RIOT_PP_SUCCESSOR_2519 2520
+#define RIOT_PP_SUCCESSOR_2520 2521
+#define RIOT_PP_SUCCESSOR_2521 2522
+#define RIOT_PP_SUCCESSOR_2522 2523
+#define RIOT_PP_SUCCESSOR_2523 2524
+#define RIOT_PP_SUCCESSOR_2524 2525
+#define RIOT_PP_SUCCESSOR_2525 2526
+#define RIOT_PP_SUCCESSOR_2526 2527
+#define RIOT_PP_SUCCESSOR_2527 2528
+#define RIOT_PP_SUCCESSOR_2528 2529
+#define RIOT_PP_SUCCESSOR_2529 2530
+#define RIOT_PP_SUCCESSOR_2530 2531
+#define RIOT_PP_SUCCESSOR_2531 2532
+#define RIOT_PP_SUCCESSOR_2532 2533
+#define RIOT_PP_SUCCESSOR_2533 2534
+#define RIOT_PP_SUCCESSOR_2534 2535
+#define RIOT_PP_SUCCESSOR_2535 2536
+#define RIOT_PP_SUCCESSOR_2536 2537
+#define RIOT_PP_SUCCESSOR_2537 2538
+#define RIOT_PP_SUCCESSOR_2538 2539
+#define RIOT_PP_SUCCESSOR_2539 2540
+#define RIOT_PP_SUCCESSOR_2540 2541
+#define RIOT_PP_SUCCESSOR_2541 2542
+#define RIOT_PP_SUCCESSOR_2542 2543
+#define RIOT_PP_SUCCESSOR_2543 2544
+#define RIOT_PP_SUCCESSOR_2544 2545
+#define RIOT_PP_SUCCESSOR_2545 2546
+#define RIOT_PP_SUCCESSOR_2546 2547
+#define RIOT_PP_SUCCESSOR_2547 2548
+#define RIOT_PP_SUCCESSOR_2548 2549
+#define RIOT_PP_SUCCESSOR_2549 2550
+#define RIOT_PP_SUCCESSOR_2550 2551
+#define RIOT_PP_SUCCESSOR_2551 2552
+#define RIOT_PP_SUCCESSOR_2552 2553
+#define RIOT_PP_SUCCESSOR_2553 2554
+#define RIOT_PP_SUCCESSOR_2554 2555
+#define RIOT_PP_SUCCESSOR_2555 2556
+#define RIOT_PP_SUCCESSOR_2556 2557
+#define RIOT_PP_SUCCESSOR_2557 2558
+#define RIOT_PP_SUCCESSOR_2558 2559
+#define RIOT_PP_SUCCESSOR_2559 2560
+#define RIOT_PP_SUCCESSOR_2560 2561
+#define RIOT_PP_SUCCESSOR_2561 2562
+#define RIOT_PP_SUCCESSOR_2562 2563
+#define RIOT_PP_SUCCESSOR_2563 2564
+#define RIOT_PP_SUCCESSOR_2564 2565
+#define RIOT_PP_SUCCESSOR_2565 2566
+#define RIOT_PP_SUCCESSOR_2566 2567
+#define RIOT_PP_SUCCESSOR_2567 2568
+#define RIOT_PP_SUCCESSOR_2568 2569
+#define RIOT_PP_SUCCESSOR_2569 2570
+#define RIOT_PP_SUCCESSOR_2570 2571
+#define RIOT_PP_SUCCESSOR_2571 2572
+#define RIOT_PP_SUCCESSOR_2572 2573
+#define RIOT_PP_SUCCESSOR_2573 2574
+#define RIOT_PP_SUCCESSOR_2574 2575
+#define RIOT_PP_SUCCESSOR_2575 2576
+#define RIOT_PP_SUCCESSOR_2576 2577
+#define RIOT_PP_SUCCESSOR_2577 2578
+#define RIOT_PP_SUCCESSOR_2578 2579
+#define RIOT_PP_SUCCESSOR_2579 2580
+#define RIOT_PP_SUCCESSOR_2580 2581
+#define RIOT_PP_SUCCESSOR_2581 2582
+#define RIOT_PP_SUCCESSOR_2582 2583
+#define RIOT_PP_SUCCESSOR_2583 2584
+#define RIOT_PP_SUCCESSOR_2584 2585
+#define RIOT_PP_SUCCESSOR_2585 2586
+#define RIOT_PP_SUCCESSOR_2586 2587
+#define RIOT_PP_SUCCESSOR_2587 2588
+#define RIOT_PP_SUCCESSOR_2588 2589
+#define RIOT_PP_SUCCESSOR_2589 2590
+#define RIOT_PP_SUCCESSOR_2590 2591
+#define RIOT_PP_SUCCESSOR_2591 2592
+#define RIOT_PP_SUCCESSOR_2592 2593
+#define RIOT_PP_SUCCESSOR_2593 2594
+#define RIOT_PP_SUCCESSOR_2594 2595
+#define RIOT_PP_SUCCESSOR_2595 2596
+#define RIOT_PP_SUCCESSOR_2596 2597
+#define RIOT_PP_SUCCESSOR_2597 2598
+#define RIOT_PP_SUCCESSOR_2598 2599
+#define RIOT_PP_SUCCESSOR_2599 2600
+#define RIOT_PP_SUCCESSOR_2600 2601
+#define RIOT_PP_SUCCESSOR_2601 2602
+#define RIOT_PP_SUCCESSOR_2602 2603
+#define RIOT_PP_SUCCESSOR_2603 2604
+#define RIOT_PP_SUCCESSOR_2604 2605
+#define RIOT_PP_SUCCESSOR_2605 2606
+#define RIOT_PP_SUCCESSOR_2606 2607
+#define RIOT_PP_SUCCESSOR_2607 2608
+#define RIOT_PP_SUCCESSOR_2608 2609
+#define RIOT_PP_SUCCESSOR_2609 2610
+#define RIOT_PP_SUCCESSOR_2610 2611
+#define RIOT_PP_SUCCESSOR_2611 2612
+#define RIOT_PP_SUCCESSOR_2612 2613
+#define RIOT_PP_SUCCESSOR_2613 2614
+#define RIOT_PP_SUCCESSOR_2614 2615
+#define RIOT_PP_SUCCESSOR_2615 2616
+#define RIOT_PP_SUCCESSOR_2616 2617
+#define RIOT_PP_SUCCESSOR_2617 2618
+#define RIOT_PP_SUCCESSOR_2618 2619
+#define RIOT_PP_SUCCESSOR_2619 2620
+#define RIOT_PP_SUCCESSOR_2620 2621
+#define RIOT_PP_SUCCESSOR_2621 2622
+#define RIOT_PP_SUCCESSOR_2622 2623
+#define RIOT_PP_SUCCESSOR_2623 2624
+#define RIOT_PP_SUCCESSOR_2624 2625
+#define RIOT_PP_SUCCESSOR_2625 2626
+#define RIOT_PP_SUCCESSOR_2626 2627
+#define RIOT_PP_SUCCESSOR_2627 2628
+#define RIOT_PP_SUCCESSOR_2628 2629
+#define RIOT_PP_SUCCESSOR_2629 2630
+#define RIOT_PP_SUCCESSOR_2630 2631
+#define RIOT_PP_SUCCESSOR_2631 2632
+#define RIOT_PP_SUCCESSOR_2632 2633
+#define RIOT_PP_SUCCESSOR_2633 2634
+#define RIOT_PP_SUCCESSOR_2634 2635
+#define RIOT_PP_SUCCESSOR_2635 2636
+#define RIOT_PP_SUCCESSOR_2636 2637
+#define RIOT_PP_SUCCESSOR_2637 2638
+#define RIOT_PP_SUCCESSOR_2638 2639
+#define RIOT_PP_SUCCESSOR_2639 2640
+#define RIOT_PP_SUCCESSOR_2640 2641
+#define RIOT_PP_SUCCESSOR_2641 2642
+#define RIOT_PP_SUCCESSOR_2642 2643
+#define RIOT_PP_SUCCESSOR_2643 2644
+#define RIOT_PP_SUCCESSOR_2644 2645
+#define RIOT_PP_SUCCESSOR_2645 2646
+#define RIOT_PP_SUCCESSOR_2646 2647
+#define RIOT_PP_SUCCESSOR_2647 2648
+#define RIOT_PP_SUCCESSOR_2648 2649
+#define RIOT_PP_SUCCESSOR_2649 2650
+#define RIOT_PP_SUCCESSOR_2650 2651
+#define RIOT_PP_SUCCESSOR_2651 2652
+#define RIOT_PP_SUCCESSOR_2652 2653
+#define RIOT_PP_SUCCESSOR_2653 2654
+#define RIOT_PP_SUCCESSOR_2654 2655
+#define RIOT_PP_SUCCESSOR_2655 2656
+#define RIOT_PP_SUCCESSOR_2656 2657
+#define RIOT_PP_SUCCESSOR_2657 2658
+#define RIOT_PP_SUCCESSOR_2658 2659
+#define RIOT_PP_SUCCESSOR_2659 2660
+#define RIOT_PP_SUCCESSOR_2660 2661
+#define RIOT_PP_SUCCESSOR_2661 2662
+#define RIOT_PP_SUCCESSOR_2662 2663
+#define RIOT_PP_SUCCESSOR_2663 2664
+#define RIOT_PP_SUCCESSOR_2664 2665
+#define RIOT_PP_SUCCESSOR_2665 2666
+#define RIOT_PP_SUCCESSOR_2666 2667
+#define RIOT_PP_SUCCESSOR_2667 2668
+#define RIOT_PP_SUCCESSOR_2668 2669
+#define RIOT_PP_SUCCESSOR_2669 2670
+#define RIOT_PP_SUCCESSOR_2670 2671
+#define RIOT_PP_SUCCESSOR_2671 2672
+#define RIOT_PP_SUCCESSOR_2672 2673
+#define RIOT_PP_SUCCESSOR_2673 2674
+#define RIOT_PP_SUCCESSOR_2674 2675
+#define RIOT_PP_SUCCESSOR_2675 2676
+#define RIOT_PP_SUCCESSOR_2676 2677
+#define RIOT_PP_SUCCESSOR_2677 2678
+#define RIOT_PP_SUCCESSOR_2678 2679
+#define RIOT_PP_SUCCESSOR_2679 2680
+#define RIOT_PP_SUCCESSOR_2680 2681
+#define RIOT_PP_SUCCESSOR_2681 2682
+#define RIOT_PP_SUCCESSOR_2682 2683
+#define RIOT_PP_SUCCESSOR_2683 2684
+#define RIOT_PP_SUCCESSOR_2684 2685
+#define RIOT_PP_SUCCESSOR_2685 2686
+#define RIOT_PP_SUCCESSOR_2686 2687
+#define RIOT_PP_SUCCESSOR_2687 2688
+#define RIOT_PP_SUCCESSOR_2688 2689
+#define RIOT_PP_SUCCESSOR_2689 2690
+#define RIOT_PP_SUCCESSOR_2690 2691
+#define RIOT_PP_SUCCESSOR_2691 2692
+#define RIOT_PP_SUCCESSOR_2692 2693
+#define RIOT_PP_SUCCESSOR_2693 2694
+#define RIOT_PP_SUCCESSOR_2694 2695
+#define RIOT_PP_SUCCESSOR_2695 2696
+#define RIOT_PP_SUCCESSOR_2696 2697
+#define RIOT_PP_SUCCESSOR_2697 2698
+#define RIOT_PP_SUCCESSOR_2698 2699
+#define RIOT_PP_SUCCESSOR_2699 2700
+#define RIOT_PP_SUCCESSOR_2700 2701
+#define RIOT_PP_SUCCESSOR_2701 2702
+#define RIOT_PP_SUCCESSOR_2702 2703
+#define RIOT_PP_SUCCESSOR_2703 2704
+#define RIOT_PP_SUCCESSOR_2704 2705
+#define RIOT_PP_SUCCESSOR_2705 2706
+#define RIOT_PP_SUCCESSOR_2706 2707
+#define RIOT_PP_SUCCESSOR_2707 2708
+#define RIOT_PP_SUCCESSOR_2708 2709
+#define RIOT_PP_SUCCESSOR_2709 2710
+#define RIOT_PP_SUCCESSOR_2710 2711
+#define RIOT_PP_SUCCESSOR_2711 2712
+#define RIOT_PP_SUCCESSOR_2712 2713
+#define RIOT_PP_SUCCESSOR_2713 2714
+#define RIOT_PP_SUCCESSOR_2714 2715
+#define RIOT_PP_SUCCESSOR_2715 2716
+#define RIOT_PP_SUCCESSOR_2716 2717
+#define RIOT_PP_SUCCESSOR_2717 2718
+#define RIOT_PP_SUCCESSOR_2718 2719
+#define RIOT_PP_SUCCESSOR_2719 2720
+#define RIOT_PP_SUCCESSOR_2720 2721
+#define RIOT_PP_SUCCESSOR_2721 2722
+#define RIOT_PP_SUCCESSOR_2722 2723
+#define RIOT_PP_SUCCESSOR_2723 2724
+#define RIOT_PP_SUCCESSOR_2724 2725
+#define RIOT_PP_SUCCESSOR_2725 2726
+#define RIOT_PP_SUCCESSOR_2726 2727
+#define RIOT_PP_SUCCESSOR_2727 2728
+#define RIOT_PP_SUCCESSOR_2728 2729
+#define RIOT_PP_SUCCESSOR_2729 2730
+#define RIOT_PP_SUCCESSOR_2730 2731
+#define RIOT_PP_SUCCESSOR_2731 2732
+#define RIOT_PP_SUCCESSOR_2732 2733
+#define RIOT_PP_SUCCESSOR_2733 2734
+#define RIOT_PP_SUCCESSOR_2734 2735
+#define RIOT_PP_SUCCESSOR_2735 2736
+#define RIOT_PP_SUCCESSOR_2736 2737
+#define RIOT_PP_SUCCESSOR_2737 2738
+#define RIOT_PP_SUCCESSOR_2738 2739
+#define RIOT_PP_SUCCESSOR_2739 2740
+#define RIOT_PP_SUCCESSOR_2740 2741
+#define RIOT_PP_SUCCESSOR_2741 2742
+#define RIOT_PP_SUCCESSOR_2742 2743
+#define RIOT_PP_SUCCESSOR_2743 2744
+#define RIOT_PP_SUCCESSOR_2744 2745
+#define RIOT_PP_SUCCESSOR_2745 2746
+#define RIOT_PP_SUCCESSOR_2746 2747
+#define RIOT_PP_SUCCESSOR_2747 2748
+#define RIOT_PP_SUCCESSOR_2748 2749
+#define RIOT_PP_SUCCESSOR_2749 2750
+#define RIOT_PP_SUCCESSOR_2750 2751
+#define RIOT_PP_SUCCESSOR_2751 2752
+#define RIOT_PP_SUCCESSOR_2752 2753
+#define RIOT_PP_SUCCESSOR_2753 2754
+#define RIOT_PP_SUCCESSOR_2754 2755
+#define RIOT_PP_SUCCESSOR_2755 2756
+#define RIOT_PP_SUCCESSOR_2756 2757
+#define RIOT_PP_SUCCESSOR_2757 2758
+#define RIOT_PP_SUCCESSOR_2758 2759
+#define RIOT_PP_SUCCESSOR_2759 2760
+#define RIOT_PP_SUCCESSOR_2760 2761
+#define RIOT_PP_SUCCESSOR_2761 2762
+#define RIOT_PP_SUCCESSOR_2762 2763
+#define RIOT_PP_SUCCESSOR_2763 2764
+#define RIOT_PP_SUCCESSOR_2764 2765
+#define RIOT_PP_SUCCESSOR_2765 2766
+#define RIOT_PP_SUCCESSOR_2766 2767
+#define RIOT_PP_SUCCESSOR_2767 2768
+#define RIOT_PP_SUCCESSOR_2768 2769
+#define RIOT_PP_SUCCESSOR_2769 2770
+#define RIOT_PP_SUCCESSOR_2770 2771
+#define RIOT_PP_SUCCESSOR_2771 2772
+#define RIOT_PP_SUCCESSOR_2772 2773
+#define RIOT_PP_SUCCESSOR_2773 2774
+#define RIOT_PP_SUCCESSOR_2774 2775
+#define RIOT_PP_SUCCESSOR_2775 2776
+#define RIOT_PP_SUCCESSOR_2776 2777
+#define RIOT_PP_SUCCESSOR_2777 2778
+#define RIOT_PP_SUCCESSOR_2778 2779
+#define RIOT_PP_SUCCESSOR_2779 2780
+#define RIOT_PP_SUCCESSOR_2780 2781
+#define RIOT_PP_SUCCESSOR_2781 2782
+#define RIOT_PP_SUCCESSOR_2782 2783
+#define RIOT_PP_SUCCESSOR_2783 2784
+#define RIOT_PP_SUCCESSOR_2784 2785
+#define RIOT_PP_SUCCESSOR_2785 2786
+#define RIOT_PP_SUCCESSOR_2786 2787
+#define RIOT_PP_SUCCESSOR_2787 2788
+#define RIOT_PP_SUCCESSOR_2788 2789
+#define RIOT_PP_SUCCESSOR_2789 2790
+#define RIOT_PP_SUCCESSOR_2790 2791
+#define RIOT_PP_SUCCESSOR_2791 2792
+#define RIOT_PP_SUCCESSOR_2792 2793
+#define RIOT_PP_SUCCESSOR_2793 2794
+#define RIOT_PP_SUCCESSOR_2794 2795
+#define RIOT_PP_SUCCESSOR_2795 2796
+#define RIOT_PP_SUCCESSOR_2796 2797
+#define RIOT_PP_SUCCESSOR_2797 2798
+#define RIOT_PP_SUCCESSOR_2798 2799
+#define RIOT_PP_SUCCESSOR_2799 2800
+#define RIOT_PP_SUCCESSOR_2800 2801
+#define RIOT_PP_SUCCESSOR_2801 2802
+#define RIOT_PP_SUCCESSOR_2802 2803
+#define RIOT_PP_SUCCESSOR_2803 2804
+#define RIOT_PP_SUCCESSOR_2804 2805
+#define RIOT_PP_SUCCESSOR_2805 2806
+#define RIOT_PP_SUCCESSOR_2806 2807
+#define RIOT_PP_SUCCESSOR_2807 2808
+#define RIOT_PP_SUCCESSOR_2808 2809
+#define RIOT_PP_SUCCESSOR_2809 2810
+#define RIOT_PP_SUCCESSOR_2810 2811
+#define RIOT_PP_SUCCESSOR_2811 2812
+#define RIOT_PP_SUCCESSOR_2812 2813
+#define RIOT_PP_SUCCESSOR_2813 2814
+#define RIOT_PP_SUCCESSOR_2814 2815
+#define RIOT_PP_SUCCESSOR_2815 2816
+#define RIOT_PP_SUCCESSOR_2816 2817
+#define RIOT_PP_SUCCESSOR_2817 2818
+#define RIOT_PP_SUCCESSOR_2818 2819
+#define RIOT_PP_SUCCESSOR_2819 2820
+#define RIOT_PP_SUCCESSOR_2820 2821
+#define RIOT_PP_SUCCESSOR_2821 2822
+#define RIOT_PP_SUCCESSOR_2822 2823
+#define RIOT_PP_SUCCESSOR_2823 2824
+#define RIOT_PP_SUCCESSOR_2824 2825
+#define RIOT_PP_SUCCESSOR_2825 2826
+#define RIOT_PP_SUCCESSOR_2826 2827
+#define RIOT_PP_SUCCESSOR_2827 2828
+#define RIOT_PP_SUCCESSOR_2828 2829
+#define RIOT_PP_SUCCESSOR_2829 2830
+#define RIOT_PP_SUCCESSOR_2830 2831
+#define RIOT_PP_SUCCESSOR_2831 2832
+#define RIOT_PP_SUCCESSOR_2832 2833
+#define RIOT_PP_SUCCESSOR_2833 2834
+#define RIOT_PP_SUCCESSOR_2834 2835
+#define RIOT_PP_SUCCESSOR_2835 2836
+#define RIOT_PP_SUCCESSOR_2836 2837
+#define RIOT_PP_SUCCESSOR_2837 2838
+#define RIOT_PP_SUCCESSOR_2838 2839
+#define RIOT_PP_SUCCESSOR_2839 2840
+#define RIOT_PP_SUCCESSOR_2840 2841
+#define RIOT_PP_SUCCESSOR_2841 2842
+#define RIOT_PP_SUCCESSOR_2842 2843
+#define RIOT_PP_SUCCESSOR_2843 2844
+#define RIOT_PP_SUCCESSOR_2844 2845
+#define RIOT_PP_SUCCESSOR_2845 2846
+#define RIOT_PP_SUCCESSOR_2846 2847
+#define RIOT_PP_SUCCESSOR_2847 2848
+#define RIOT_PP_SUCCESSOR_2848 2849
+#define RIOT_PP_SUCCESSOR_2849 2850
+#define RIOT_PP_SUCCESSOR_2850 2851
+#define RIOT_PP_SUCCESSOR_2851 2852
+#define RIOT_PP_SUCCESSOR_2852 2853
+#define RIOT_PP_SUCCESSOR_2853 2854
+#define RIOT_PP_SUCCESSOR_2854 2855
+#define RIOT_PP_SUCCESSOR_2855 2856
+#define RIOT_PP_SUCCESSOR_2856 2857
+#define RIOT_PP_SUCCESSOR_2857 2858
+#define RIOT_PP_SUCCESSOR_2858 2859
+#define RIOT_PP_SUCCESSOR_2859 2860
+#define RIOT_PP_SUCCESSOR_2860 2861
+#define RIOT_PP_SUCCESSOR_2861 2862
+#define RIOT_PP_SUCCESSOR_2862 2863
+#define RIOT_PP_SUCCESSOR_2863 2864
+#define RIOT_PP_SUCCESSOR_2864 2865
+#define RIOT_PP_SUCCESSOR_2865 2866
+#define RIOT_PP_SUCCESSOR_2866 2867
+#define RIOT_PP_SUCCESSOR_2867 2868
+#define RIOT_PP_SUCCESSOR_2868 2869
+#define RIOT_PP_SUCCESSOR_2869 2870
+#define RIOT_PP_SUCCESSOR_2870 2871
+#define RIOT_PP_SUCCESSOR_2871 2872
+#define RIOT_PP_SUCCESSOR_2872 2873
+#define RIOT_PP_SUCCESSOR_2873 2874
+#define RIOT_PP_SUCCESSOR_2874 2875
+#define RIOT_PP_SUCCESSOR_2875 2876
+#define RIOT_PP_SUCCESSOR_2876 2877
+#define RIOT_PP_SUCCESSOR_2877 2878
+#define RIOT_PP_SUCCESSOR_2878 2879
+#define RIOT_PP_SUCCESSOR_2879 2880
+#define RIOT_PP_SUCCESSOR_2880 2881
+#define RIOT_PP_SUCCESSOR_2881 2882
+#define RIOT_PP_SUCCESSOR_2882 2883
+#define RIOT_PP_SUCCESSOR_2883 2884
+#define RIOT_PP_SUCCESSOR_2884 2885
+#define RIOT_PP_SUCCESSOR_2885 2886
+#define RIOT_PP_SUCCESSOR_2886 2887
+#define RIOT_PP_SUCCESSOR_2887 2888
+#define RIOT_PP_SUCCESSOR_2888 2889
+#define RIOT_PP_SUCCESSOR_2889 2890
+#define RIOT_PP_SUCCESSOR_2890 2891
+#define RIOT_PP_SUCCESSOR_2891 2892
+#define RIOT_PP_SUCCESSOR_2892 2893
+#define RIOT_PP_SUCCESSOR_2893 2894
+#define RIOT_PP_SUCCESSOR_2894 2895
+#define RIOT_PP_SUCCESSOR_2895 2896
+#define RIOT_PP_SUCCESSOR_2896 2897
+#define RIOT_PP_SUCCESSOR_2897 2898
+#define RIOT_PP_SUCCESSOR_2898 2899
+#define RIOT_PP_SUCCESSOR_2899 2900
+#define RIOT_PP_SUCCESSOR_2900 2901
+#define RIOT_PP_SUCCESSOR_2901 2902
+#define RIOT_PP_SUCCESSOR_2902 2903
+#define RIOT_PP_SUCCESSOR_2903 2904
+#define RIOT_PP_SUCCESSOR_2904 2905
+#define RIOT_PP_SUCCESSOR_2905 2906
+#define RIOT_PP_SUCCESSOR_2906 2907
+#define RIOT_PP_SUCCESSOR_2907 2908
+#define RIOT_PP_SUCCESSOR_2908 2909
+#define RIOT_PP_SUCCESSOR_2909 2910
+#define RIOT_PP_SUCCESSOR_2910 2911
+#define RIOT_PP_SUCCESSOR_2911 2912
+#define RIOT_PP_SUCCESSOR_2912 2913
+#define RIOT_PP_SUCCESSOR_2913 2914
+#define RIOT_PP_SUCCESSOR_2914 2915
+#define RIOT_PP_SUCCESSOR_2915 2916
+#define RIOT_PP_SUCCESSOR_2916 2917
+#define RIOT_PP_SUCCESSOR_2917 2918
+#define RIOT_PP_SUCCESSOR_2918 2919
+#define RIOT_PP_SUCCESSOR_2919 2920
+#define RIOT_PP_SUCCESSOR_2920 2921
+#define RIOT_PP_SUCCESSOR_2921 2922
+#define RIOT_PP_SUCCESSOR_2922 2923
+#define RIOT_PP_SUCCESSOR_2923 2924
+#define RIOT_PP_SUCCESSOR_2924 2925
+#define RIOT_PP_SUCCESSOR_2925 2926
+#define RIOT_PP_SUCCESSOR_2926 2927
+#define RIOT_PP_SUCCESSOR_2927 2928
+#define RIOT_PP_SUCCESSOR_2928 2929
+#define RIOT_PP_SUCCESSOR_2929 2930
+#define RIOT_PP_SUCCESSOR_2930 2931
+#define RIOT_PP_SUCCESSOR_2931 2932
+#define RIOT_PP_SUCCESSOR_2932 2933
+#define RIOT_PP_SUCCESSOR_2933 2934
+#define RIOT_PP_SUCCESSOR_2934 2935
+#define RIOT_PP_SUCCESSOR_2935 2936
+#define RIOT_PP_SUCCESSOR_2936 2937
+#define RIOT_PP_SUCCESSOR_2937 2938
+#define RIOT_PP_SUCCESSOR_2938 2939
+#define RIOT_PP_SUCCESSOR_2939 2940
+#define RIOT_PP_SUCCESSOR_2940 2941
+#define RIOT_PP_SUCCESSOR_2941 2942
+#define RIOT_PP_SUCCESSOR_2942 2943
+#define RIOT_PP_SUCCESSOR_2943 2944
+#define RIOT_PP_SUCCESSOR_2944 2945
+#define RIOT_PP_SUCCESSOR_2945 2946
+#define RIOT_PP_SUCCESSOR_2946 2947
+#define RIOT_PP_SUCCESSOR_2947 2948
+#define RIOT_PP_SUCCESSOR_2948 2949
+#define RIOT_PP_SUCCESSOR_2949 2950
+#define RIOT_PP_SUCCESSOR_2950 2951
+#define RIOT_PP_SUCCESSOR_2951 2952
+#define RIOT_PP_SUCCESSOR_2952 2953
+#define RIOT_PP_SUCCESSOR_2953 2954
+#define RIOT_PP_SUCCESSOR_2954 2955
+#define RIOT_PP_SUCCESSOR_2955 2956
+#define RIOT_PP_SUCCESSOR_2956 2957
+#define RIOT_PP_SUCCESSOR_2957 2958
+#define RIOT_PP_SUCCESSOR_2958 2959
+#define RIOT_PP_SUCCESSOR_2959 2960
+#define RIOT_PP_SUCCESSOR_2960 2961
+#define RIOT_PP_SUCCESSOR_2961 2962
+#define RIOT_PP_SUCCESSOR_2962 2963
+#define RIOT_PP_SUCCESSOR_2963 2964
+#define RIOT_PP_SUCCESSOR_2964 2965
+#define RIOT_PP_SUCCESSOR_2965 2966
+#define RIOT_PP_SUCCESSOR_2966 2967
+#define RIOT_PP_SUCCESSOR_2967 2968
+#define RIOT_PP_SUCCESSOR_2968 2969
+#define RIOT_PP_SUCCESSOR_2969 2970
+#define RIOT_PP_SUCCESSOR_2970 2971
+#define RIOT_PP_SUCCESSOR_2971 2972
+#define RIOT_PP_SUCCESSOR_2972 2973
+#define RIOT_PP_SUCCESSOR_2973 2974
+#define RIOT_PP_SUCCESSOR_2974 2975
+#define RIOT_PP_SUCCESSOR_2975 2976
+#define RIOT_PP_SUCCESSOR_2976 2977
+#define RIOT_PP_SUCCESSOR_2977 2978
+#define RIOT_PP_SUCCESSOR_2978 2979
+#define RIOT_PP_SUCCESSOR_2979 2980
+#define RIOT_PP_SUCCESSOR_2980 2981
+#define RIOT_PP_SUCCESSOR_2981 2982
+#define RIOT_PP_SUCCESSOR_2982 2983
+#define RIOT_PP_SUCCESSOR_2983 2984
+#define RIOT_PP_SUCCESSOR_2984 2985
+#define RIOT_PP_SUCCESSOR_2985 2986
+#define RIOT_PP_SUCCESSOR_2986 2987
+#define RIOT_PP_SUCCESSOR_2987 2988
+#define RIOT_PP_SUCCESSOR_2988 2989
+#define RIOT_PP_SUCCESSOR_2989 2990
+#define RIOT_PP_SUCCESSOR_2990 2991
+#define RIOT_PP_SUCCESSOR_2991 2992
+#define RIOT_PP_SUCCESSOR_2992 2993
+#define RIOT_PP_SUCCESSOR_2993 2994
+#define RIOT_PP_SUCCESSOR_2994 2995
+#define RIOT_PP_SUCCESSOR_2995 2996
+#define RIOT_PP_SUCCESSOR_2996 2997
+#define RIOT_PP_SUCCESSOR_2997 2998
+#define RIOT_PP_SUCCESSOR_2998 2999
+#define RIOT_PP_SUCCESSOR_2999 3000
+#define RIOT_PP_SUCCESSOR_3000 3001
+#define RIOT_PP_SUCCESSOR_3001 3002
+#define RIOT_PP_SUCCESSOR_3002 3003
+#define RIOT_PP_SUCCESSOR_3003 3004
+#define RIOT_PP_SUCCESSOR_3004 3005
+#define RIOT_PP_SUCCESSOR_3005 3006
+#define RIOT_PP_SUCCESSOR_3006 3007
+#define RIOT_PP_SUCCESSOR_3007 3008
+#define RIOT_PP_SUCCESSOR_3008 3009
+#define RIOT_PP_SUCCESSOR_3009 3010
+#define RIOT_PP_SUCCESSOR_3010 3011
+#define RIOT_PP_SUCCESSOR_3011 3012
+#define RIOT_PP_SUCCESSOR_3012 3013
+#define RIOT_PP_SUCCESSOR_3013 3014
+#define RIOT_PP_SUCCESSOR_3014 3015
+#define RIOT_PP_SUCCESSOR_3015 3016
+#define RIOT_PP_SUCCESSOR_3016 3017
+#define RIOT_PP_SUCCESSOR_3017 3018
+#define RIOT_PP_SUCCESSOR_3018 3019
+#define RIOT_PP_SUCCESSOR_3019 3020
+#define RIOT_PP_SUCCESSOR_3020 3021
+#define RIOT_PP_SUCCESSOR_3021 3022
+#define RIOT_PP_SUCCESSOR_3022 3023
+#define RIOT_PP_SUCCESSOR_3023 3024
+#define RIOT_PP_SUCCESSOR_3024 3025
+#define RIOT_PP_SUCCESSOR_3025 3026
+#define RIOT_PP_SUCCESSOR_3026 3027
+#define RIOT_PP_SUCCESSOR_3027 3028
+#define RIOT_PP_SUCCESSOR_3028 3029
+#define RIOT_PP_SUCCESSOR_3029 3030
+#define RIOT_PP_SUCCESSOR_3030 3031
+#define RIOT_PP_SUCCESSOR_3031 3032
+#define RIOT_PP_SUCCESSOR_3032 3033
+#define RIOT_PP_SUCCESSOR_3033 3034
+#define RIOT_PP_SUCCESSOR_3034 3035
+#define RIOT_PP_SUCCESSOR_3035 3036
+#define RIOT_PP_SUCCESSOR_3036 3037
+#define RIOT_PP_SUCCESSOR_3037 3038
+#define RIOT_PP_SUCCESSOR_3038 3039
+#define RIOT_PP_SUCCESSOR_3039 3040
+#define RIOT_PP_SUCCESSOR_3040 3041
+#define RIOT_PP_SUCCESSOR_3041 3042
+#define RIOT_PP_SUCCESSOR_3042 3043
+#define RIOT_PP_SUCCESSOR_3043 3044
+#define RIOT_PP_SUCCESSOR_3044 3045
+#define RIOT_PP_SUCCESSOR_3045 3046
+#define RIOT_PP_SUCCESSOR_3046 3047
+#define RIOT_PP_SUCCESSOR_3047 3048
+#define RIOT_PP_SUCCESSOR_3048 3049
+#define RIOT_PP_SUCCESSOR_3049 3050
+#define RIOT_PP_SUCCESSOR_3050 3051
+#define RIOT_PP_SUCCESSOR_3051 3052
+#define RIOT_PP_SUCCESSOR_3052 3053
+#define RIOT_PP_SUCCESSOR_3053 3054
+#define RIOT_PP_SUCCESSOR_3054 3055
+#define RIOT_PP_SUCCESSOR_3055 3056
+#define RIOT_PP_SUCCESSOR_3056 3057
+#define RIOT_PP_SUCCESSOR_3057 3058
+#define RIOT_PP_SUCCESSOR_3058 3059
+#define RIOT_PP_SUCCESSOR_3059 3060
+#define RIOT_PP_SUCCESSOR_3060 3061
+#define RIOT_PP_SUCCESSOR_3061 3062
+#define RIOT_PP_SUCCESSOR_3062 3063
+#define RIOT_PP_SUCCESSOR_3063 3064
+#define RIOT_PP_SUCCESSOR_3064 3065
+#define RIOT_PP_SUCCESSOR_3065 3066
+#define RIOT_PP_SUCCESSOR_3066 3067
+#define RIOT_PP_SUCCESSOR_3067 3068
+#define RIOT_PP_SUCCESSOR_3068 3069
+#define RIOT_PP_SUCCESSOR_3069 3070
+#define RIOT_PP_SUCCESSOR_3070 3071
+#define RIOT_PP_SUCCESSOR_3071 3072
+#define RIOT_PP_SUCCESSOR_3072 3073
+#define RIOT_PP_SUCCESSOR_3073 3074
+#define RIOT_PP_SUCCESSOR_3074 3075
+#define RIOT_PP_SUCCESSOR_3075 3076
+#define RIOT_PP_SUCCESSOR_3076 3077
+#define RIOT_PP_SUCCESSOR_3077 3078
+#define RIOT_PP_SUCCESSOR_3078 3079
+#define RIOT_PP_SUCCESSOR_3079 3080
+#define RIOT_PP_SUCCESSOR_3080 3081
+#define RIOT_PP_SUCCESSOR_3081 3082
+#define RIOT_PP_SUCCESSOR_3082 3083
+#define RIOT_PP_SUCCESSOR_3083 3084
+#define RIOT_PP_SUCCESSOR_3084 3085
+#define RIOT_PP_SUCCESSOR_3085 3086
+#define RIOT_PP_SUCCESSOR_3086 3087
+#define RIOT_PP_SUCCESSOR_3087 3088
+#define RIOT_PP_SUCCESSOR_3088 3089
+#define RIOT_PP_SUCCESSOR_3089 3090
+#define RIOT_PP_SUCCESSOR_3090 3091
+#define RIOT_PP_SUCCESSOR_3091 3092
+#define RIOT_PP_SUCCESSOR_3092 3093
+#define RIOT_PP_SUCCESSOR_3093 3094
+#define RIOT_PP_SUCCESSOR_3094 3095
+#define RIOT_PP_SUCCESSOR_3095 3096
+#define RIOT_PP_SUCCESSOR_3096 3097
+#define RIOT_PP_SUCCESSOR_3097 3098
+#define RIOT_PP_SUCCESSOR_3098 3099
+#define RIOT_PP_SUCCESSOR_3099 3100
+#define RIOT_PP_SUCCESSOR_3100 3101
+#define RIOT_PP_SUCCESSOR_3101 3102
+#define RIOT_PP_SUCCESSOR_3102 3103
+#define RIOT_PP_SUCCESSOR_3103 3104
+#define RIOT_PP_SUCCESSOR_3104 3105
+#define RIOT_PP_SUCCESSOR_3105 3106
+#define RIOT_PP_SUCCESSOR_3106 3107
+#define RIOT_PP_SUCCESSOR_3107 3108
+#define RIOT_PP_SUCCESSOR_3108 3109
+#define RIOT_PP_SUCCESSOR_3109 3110
+#define RIOT_PP_SUCCESSOR_3110 3111
+#define RIOT_PP_SUCCESSOR_3111 3112
+#define RIOT_PP_SUCCESSOR_3112 3113
+#define RIOT_PP_SUCCESSOR_3113 3114
+#define RIOT_PP_SUCCESSOR_3114 3115
+#define RIOT_PP_SUCCESSOR_3115 3116
+#define RIOT_PP_SUCCESSOR_3116 3117
+#define RIOT_PP_SUCCESSOR_3117 3118
+#define RIOT_PP_SUCCESSOR_3118 3119
+#define RIOT_PP_SUCCESSOR_3119 3120
+#define RIOT_PP_SUCCESSOR_3120 3121
+#define RIOT_PP_SUCCESSOR_3121 3122
+#define RIOT_PP_SUCCESSOR_3122 3123
+#define RIOT_PP_SUCCESSOR_3123 3124
+#define RIOT_PP_SUCCESSOR_3124 3125
+#define RIOT_PP_SUCCESSOR_3125 3126
+#define RIOT_PP_SUCCESSOR_3126 3127
+#define RIOT_PP_SUCCESSOR_3127 3128
+#define RIOT_PP_SUCCESSOR_3128 3129
+#define RIOT_PP_SUCCESSOR_3129 3130
+#define RIOT_PP_SUCCESSOR_3130 3131
+#define RIOT_PP_SUCCESSOR_3131 3132
+#define RIOT_PP_SUCCESSOR_3132 3133
+#define RIOT_PP_SUCCESSOR_3133 3134
+#define RIOT_PP_SUCCESSOR_3134 3135
+#define RIOT_PP_SUCCESSOR_3135 3136
+#define RIOT_PP_SUCCESSOR_3136 3137
+#define RIOT_PP_SUCCESSOR_3137 3138
+#define RIOT_PP_SUCCESSOR_3138 3139
+#define RIOT_PP_SUCCESSOR_3139 3140
+#define RIOT_PP_SUCCESSOR_3140 3141
+#define RIOT_PP_SUCCESSOR_3141 3142
+#define RIOT_PP_SUCCESSOR_3142 3143
+#define RIOT_PP_SUCCESSOR_3143 3144
+#define RIOT_PP_SUCCESSOR_3144 3145
+#define RIOT_PP_SUCCESSOR_3145 3146
+#define RIOT_PP_SUCCESSOR_3146 3147
+#define RIOT_PP_SUCCESSOR_3147 3148
+#define RIOT_PP_SUCCESSOR_3148 3149
+#define RIOT_PP_SUCCESSOR_3149 3150
+#define RIOT_PP_SUCCESSOR_3150 3151
+#define RIOT_PP_SUCCESSOR_3151 3152
+#define RIOT_PP_SUCCESSOR_3152 3153
+#define RIOT_PP_SUCCESSOR_3153 3154
+#define RIOT_PP_SUCCESSOR_3154 3155
+#define RIOT_PP_SUCCESSOR_3155 3156
+#define RIOT_PP_SUCCESSOR_3156 3157
+#define RIOT_PP_SUCCESSOR_3157 3158
+#define RIOT_PP_SUCCESSOR_3158 3159
+#define RIOT_PP_SUCCESSOR_3159 3160
+#define RIOT_PP_SUCCESSOR_3160 3161
+#define RIOT_PP_SUCCESSOR_3161 3162
+#define RIOT_PP_SUCCESSOR_3162 3163
+#define RIOT_PP_SUCCESSOR_3163 3164
+#define RIOT_PP_SUCCESSOR_3164 3165
+#define RIOT_PP_SUCCESSOR_3165 3166
+#define RIOT_PP_SUCCESSOR_3166 3167
+#define RIOT_PP_SUCCESSOR_3167 3168
+#define RIOT_PP_SUCCESSOR_3168 3169
+#define RIOT_PP_SUCCESSOR_3169 3170
+#define RIOT_PP_SUCCESSOR_3170 3171
+#define RIOT_PP_SUCCESSOR_3171 3172
+#define RIOT_PP_SUCCESSOR_3172 3173
+#define RIOT_PP_SUCCESSOR_3173 3174
+#define RIOT_PP_SUCCESSOR_3174 3175
+#define RIOT_PP_SUCCESSOR_3175 3176
+#define RIOT_PP_SUCCESSOR_3176 3177
+#define RIOT_PP_SUCCESSOR_3177 3178
+#define RIOT_PP_SUCCESSOR_3178 3179
+#define RIOT_PP_SUCCESSOR_3179 3180
+#define RIOT_PP_SUCCESSOR_3180 3181
+#define RIOT_PP_SUCCESSOR_3181 3182
+#define RIOT_PP_SUCCESSOR_3182 3183
+#define RIOT_PP_SUCCESSOR_3183 3184
+#define RIOT_PP_SUCCESSOR_3184 3185
+#define RIOT_PP_SUCCESSOR_3185 3186
+#define RIOT_PP_SUCCESSOR_3186 3187
+#define RIOT_PP_SUCCESSOR_3187 3188
+#define RIOT_PP_SUCCESSOR_3188 3189
+#define RIOT_PP_SUCCESSOR_3189 3190
+#define RIOT_PP_SUCCESSOR_3190 3191
+#define RIOT_PP_SUCCESSOR_3191 3192
+#define RIOT_PP_SUCCESSOR_3192 3193
+#define RIOT_PP_SUCCESSOR_3193 3194
+#define RIOT_PP_SUCCESSOR_3194 3195
+#define RIOT_PP_SUCCESSOR_3195 3196
+#define RIOT_PP_SUCCESSOR_3196 3197
+#define RIOT_PP_SUCCESSOR_3197 3198
+#define RIOT_PP_SUCCESSOR_3198 3199
+#define RIOT_PP_SUCCESSOR_3199 3200
+#define RIOT_PP_SUCCESSOR_3200 3201
+#define RIOT_PP_SUCCESSOR_3201 3202
+#define RIOT_PP_SUCCESSOR_3202 3203
+#define RIOT_PP_SUCCESSOR_3203 3204
+#define RIOT_PP_SUCCESSOR_3204 3205
+#define RIOT_PP_SUCCESSOR_3205 3206
+#define RIOT_PP_SUCCESSOR_3206 3207
+#define RIOT_PP_SUCCESSOR_3207 3208
+#define RIOT_PP_SUCCESSOR_3208 3209
+#define RIOT_PP_SUCCESSOR_3209 3210
+#define RIOT_PP_SUCCESSOR_3210 3211
+#define RIOT_PP_SUCCESSOR_3211 3212
+#define RIOT_PP_SUCCESSOR_3212 3213
+#define RIOT_PP_SUCCESSOR_3213 3214
+#define RIOT_PP_SUCCESSOR_3214 3215
+#define RIOT_PP_SUCCESSOR_3215 3216
+#define RIOT_PP_SUCCESSOR_3216 3217
+#define RIOT_PP_SUCCESSOR_3217 3218
+#define RIOT_PP_SUCCESSOR_3218 3219
+#define RIOT_PP_SUCCESSOR_3219 3220
+#define RIOT_PP_SUCCESSOR_3220 3221
+#define RIOT_PP_SUCCESSOR_3221 3222
+#define RIOT_PP_SUCCESSOR_3222 3223
+#define RIOT_PP_SUCCESSOR_3223 3224
+#define RIOT_PP_SUCCESSOR_3224 3225
+#define RIOT_PP_SUCCESSOR_3225 3226
+#define RIOT_PP_SUCCESSOR_3226 3227
+#define RIOT_PP_SUCCESSOR_3227 3228
+#define RIOT_PP_SUCCESSOR_3228 3229
+#define RIOT_PP_SUCCESSOR_3229 3230
+#define RIOT_PP_SUCCESSOR_3230 3231
+#define RIOT_PP_SUCCESSOR_3231 3232
+#define RIOT_PP_SUCCESSOR_3232 3233
+#define RIOT_PP_SUCCESSOR_3233 3234
+#define RIOT_PP_SUCCESSOR_3234 3235
+#define RIOT_PP_SUCCESSOR_3235 3236
+#define RIOT_PP_SUCCESSOR_3236 3237
+#define RIOT_PP_SUCCESSOR_3237 3238
+#define RIOT_PP_SUCCESSOR_3238 3239
+#define RIOT_PP_SUCCESSOR_3239 3240
+#define RIOT_PP_SUCCESSOR_3240 3241
+#define RIOT_PP_SUCCESSOR_3241 3242
+#define RIOT_PP_SUCCESSOR_3242 3243
+#define RIOT_PP_SUCCESSOR_3243 3244
+#define RIOT_PP_SUCCESSOR_3244 3245
+#define RIOT_PP_SUCCESSOR_3245 3246
+#define RIOT_PP_SUCCESSOR_3246 3247
+#define RIOT_PP_SUCCESSOR_3247 3248
+#define RIOT_PP_SUCCESSOR_3248 3249
+#define RIOT_PP_SUCCESSOR_3249 3250
+#define RIOT_PP_SUCCESSOR_3250 3251
+#define RIOT_PP_SUCCESSOR_3251 3252
+#define RIOT_PP_SUCCESSOR_3252 3253
+#define RIOT_PP_SUCCESSOR_3253 3254
+#define RIOT_PP_SUCCESSOR_3254 3255
+#define RIOT_PP_SUCCESSOR_3255 3256
+#define RIOT_PP_SUCCESSOR_3256 3257
+#define RIOT_PP_SUCCESSOR_3257 3258
+#define RIOT_PP_SUCCESSOR_3258 3259
+#define RIOT_PP_SUCCESSOR_3259 3260
+#define RIOT_PP_SUCCESSOR_3260 3261
+#define RIOT_PP_SUCCESSOR_3261 3262
+#define RIOT_PP_SUCCESSOR_3262 3263
+#define RIOT_PP_SUCCESSOR_3263 3264
+#define RIOT_PP_SUCCESSOR_3264 3265
+#define RIOT_PP_SUCCESSOR_3265 3266
+#define RIOT_PP_SUCCESSOR_3266 3267
+#define RIOT_PP_SUCCESSOR_3267 3268
+#define RIOT_PP_SUCCESSOR_3268 3269
+#define RIOT_PP_SUCCESSOR_3269 3270
+#define RIOT_PP_SUCCESSOR_3270 3271
+#define RIOT_PP_SUCCESSOR_3271 3272
+#define RIOT_PP_SUCCESSOR_3272 3273
+#define RIOT_PP_SUCCESSOR_3273 3274
+#define RIOT_PP_SUCCESSOR_3274 3275
+#define RIOT_PP_SUCCESSOR_3275 3276
+#define RIOT_PP_SUCCESSOR_3276 3277
+#define RIOT_PP_SUCCESSOR_3277 3278
+#define RIOT_PP_SUCCESSOR_3278 3279
+#define RIOT_PP_SUCCESSOR_3279 3280
+#define RIOT_PP_SUCCESSOR_3280 3281
+#define RIOT_PP_SUCCESSOR_3281 3282
+#define RIOT_PP_SUCCESSOR_3282 3283
+#define RIOT_PP_SUCCESSOR_3283 3284
+#define RIOT_PP_SUCCESSOR_3284 3285
+#define RIOT_PP_SUCCESSOR_3285 3286
+#define RIOT_PP_SUCCESSOR_3286 3287
+#define RIOT_PP_SUCCESSOR_3287 3288
+#define RIOT_PP_SUCCESSOR_3288 3289
+#define RIOT_PP_SUCCESSOR_3289 3290
+#define RIOT_PP_SUCCESSOR_3290 3291
+#define RIOT_PP_SUCCESSOR_3291 3292
+#define RIOT_PP_SUCCESSOR_3292 3293
+#define RIOT_PP_SUCCESSOR_3293 3294
+#define RIOT_PP_SUCCESSOR_3294 3295
+#define RIOT_PP_SUCCESSOR_3295 3296
+#define RIOT_PP_SUCCESSOR_3296 3297
+#define RIOT_PP_SUCCESSOR_3297 3298
+#define RIOT_PP_SUCCESSOR_3298 3299
+#define RIOT_PP_SUCCESSOR_3299 3300
+#define RIOT_PP_SUCCESSOR_3300 3301
+#define RIOT_PP_SUCCESSOR_3301 3302
+#define RIOT_PP_SUCCESSOR_3302 3303
+#define RIOT_PP_SUCCESSOR_3303 3304
+#define RIOT_PP_SUCCESSOR_3304 3305
+#define RIOT_PP_SUCCESSOR_3305 3306
+#define RIOT_PP_SUCCESSOR_3306 3307
+#define RIOT_PP_SUCCESSOR_3307 3308
+#define RIOT_PP_SUCCESSOR_3308 3309
+#define RIOT_PP_SUCCESSOR_3309 3310
+#define RIOT_PP_SUCCESSOR_3310 3311
+#define RIOT_PP_SUCCESSOR_3311 3312
+#define RIOT_PP_SUCCESSOR_3312 3313
+#define RIOT_PP_SUCCESSOR_3313 3314
+#define RIOT_PP_SUCCESSOR_3314 3315
+#define RIOT_PP_SUCCESSOR_3315 3316
+#define RIOT_PP_SUCCESSOR_3316 3317
+#define RIOT_PP_SUCCESSOR_3317 3318
+#define RIOT_PP_SUCCESSOR_3318 3319
+#define RIOT_PP_SUCCESSOR_3319 3320
+#define RIOT_PP_SUCCESSOR_3320 3321
+#define RIOT_PP_SUCCESSOR_3321 3322
+#define RIOT_PP_SUCCESSOR_3322 3323
+#define RIOT_PP_SUCCESSOR_3323 3324
+#define RIOT_PP_SUCCESSOR_3324 3325
+#define RIOT_PP_SUCCESSOR_3325 3326
+#define RIOT_PP_SUCCESSOR_3326 3327
+#define RIOT_PP_SUCCESSOR_3327 3328
+#define RIOT_PP_SUCCESSOR_3328 3329
+#define RIOT_PP_SUCCESSOR_3329 3330
+#define RIOT_PP_SUCCESSOR_3330 3331
+#define RIOT_PP_SUCCESSOR_3331 3332
+#define RIOT_PP_SUCCESSOR_3332 3333
+#define RIOT_PP_SUCCESSOR_3333 3334
+#define RIOT_PP_SUCCESSOR_3334 3335
+#define RIOT_PP_SUCCESSOR_3335 3336
+#define RIOT_PP_SUCCESSOR_3336 3337
+#define RIOT_PP_SUCCESSOR_3337 3338
+#define RIOT_PP_SUCCESSOR_3338 3339
+#define RIOT_PP_SUCCESSOR_3339 3340
+#define RIOT_PP_SUCCESSOR_3340 3341
+#define RIOT_PP_SUCCESSOR_3341 3342
+#define RIOT_PP_SUCCESSOR_3342 3343
+#define RIOT_PP_SUCCESSOR_3343 3344
+#define RIOT_PP_SUCCESSOR_3344 3345
+#define RIOT_PP_SUCCESSOR_3345 3346
+#define RIOT_PP_SUCCESSOR_3346 3347
+#define RIOT_PP_SUCCESSOR_3347 3348
+#define RIOT_PP_SUCCESSOR_3348 3349
+#define RIOT_PP_SUCCESSOR_3349 3350
+#define RIOT_PP_SUCCESSOR_3350 3351
+#define RIOT_PP_SUCCESSOR_3351 3352
+#define RIOT_PP_SUCCESSOR_3352 3353
+#define RIOT_PP_SUCCESSOR_3353 3354
+#define RIOT_PP_SUCCESSOR_3354 3355
+#define RIOT_PP_SUCCESSOR_3355 3356
+#define RIOT_PP_SUCCESSOR_3356 3357
+#define RIOT_PP_SUCCESSOR_3357 3358
+#define RIOT_PP_SUCCESSOR_3358 3359
+#define RIOT_PP_SUCCESSOR_3359 3360
+#define RIOT_PP_SUCCESSOR_3360 3361
+#define RIOT_PP_SUCCESSOR_3361 3362
+#define RIOT_PP_SUCCESSOR_3362 3363
+#define RIOT_PP_SUCCESSOR_3363 3364
+#define RIOT_PP_SUCCESSOR_3364 3365
+#define RIOT_PP_SUCCESSOR_3365 3366
+#define RIOT_PP_SUCCESSOR_3366 3367
+#define RIOT_PP_SUCCESSOR_3367 3368
+#define RIOT_PP_SUCCESSOR_3368 3369
+#define RIOT_PP_SUCCESSOR_3369 3370
+#define RIOT_PP_SUCCESSOR_3370 3371
+#define RIOT_PP_SUCCESSOR_3371 3372
+#define RIOT_PP_SUCCESSOR_3372 3373
+#define RIOT_PP_SUCCESSOR_3373 3374
+#define RIOT_PP_SUCCESSOR_3374 3375
+#define RIOT_PP_SUCCESSOR_3375 3376
+#define RIOT_PP_SUCCESSOR_3376 3377
+#define RIOT_PP_SUCCESSOR_3377 3378
+#define RIOT_PP_SUCCESSOR_3378 3379
+#define RIOT_PP_SUCCESSOR_3379 3380
+#define RIOT_PP_SUCCESSOR_3380 3381
+#define RIOT_PP_SUCCESSOR_3381 3382
+#define RIOT_PP_SUCCESSOR_3382 3383
+#define RIOT_PP_SUCCESSOR_3383 3384
+#define RIOT_PP_SUCCESSOR_3384 3385
+#define RIOT_PP_SUCCESSOR_3385 3386
+#define RIOT_PP_SUCCESSOR_3386 3387
+#define RIOT_PP_SUCCESSOR_3387 3388
+#define RIOT_PP_SUCCESSOR_3388 3389
+#define RIOT_PP_SUCCESSOR_3389 3390
+#define RIOT_PP_SUCCESSOR_3390 3391
+#define RIOT_PP_SUCCESSOR_3391 3392
+#define RIOT_PP_SUCCESSOR_3392 3393
+#define RIOT_PP_SUCCESSOR_3393 3394
+#define RIOT_PP_SUCCESSOR_3394 3395
+#define RIOT_PP_SUCCESSOR_3395 3396
+#define RIOT_PP_SUCCESSOR_3396 3397
+#define RIOT_PP_SUCCESSOR_3397 3398
+#define RIOT_PP_SUCCESSOR_3398 3399
+#define RIOT_PP_SUCCESSOR_3399 3400
+#define RIOT_PP_SUCCESSOR_3400 3401
+#define RIOT_PP_SUCCESSOR_3401 3402
+#define RIOT_PP_SUCCESSOR_3402 3403
+#define RIOT_PP_SUCCESSOR_3403 3404
+#define RIOT_PP_SUCCESSOR_3404 3405
+#define RIOT_PP_SUCCESSOR_3405 3406
+#define RIOT_PP_SUCCESSOR_3406 3407
+#define RIOT_PP_SUCCESSOR_3407 3408
+#define RIOT_PP_SUCCESSOR_3408 3409
+#define RIOT_PP_SUCCESSOR_3409 3410
+#define RIOT_PP_SUCCESSOR_3410 3411
+#define RIOT_PP_SUCCESSOR_3411 3412
+#define RIOT_PP_SUCCESSOR_3412 3413
+#define RIOT_PP_SUCCESSOR_3413 3414
+#define RIOT_PP_SUCCESSOR_3414 3415
+#define RIOT_PP_SUCCESSOR_3415 3416
+#define RIOT_PP_SUCCESSOR_3416 3417
+#define RIOT_PP_SUCCESSOR_3417 3418
+#define RIOT_PP_SUCCESSOR_3418 3419
+#define RIOT_PP_SUCCESSOR_3419 3420
+#define RIOT_PP_SUCCESSOR_3420 3421
+#define RIOT_PP_SUCCESSOR_3421 3422
+#define RIOT_PP_SUCCESSOR_3422 3423
+#define RIOT_PP_SUCCESSOR_3423 3424
+#define RIOT_PP_SUCCESSOR_3424 3425
+#define RIOT_PP_SUCCESSOR_3425 3426
+#define RIOT_PP_SUCCESSOR_3426 3427
+#define RIOT_PP_SUCCESSOR_3427 3428
+#define RIOT_PP_SUCCESSOR_3428 3429
+#define RIOT_PP_SUCCESSOR_3429 3430
+#define RIOT_PP_SUCCESSOR_3430 3431
+#define RIOT_PP_SUCCESSOR_3431 3432
+#define RIOT_PP_SUCCESSOR_3432 3433
+#define RIOT_PP_SUCCESSOR_3433 3434
+#define RIOT_PP_SUCCESSOR_3434 3435
+#define RIOT_PP_SUCCESSOR_3435 3436
+#define RIOT_PP_SUCCESSOR_3436 3437
+#define RIOT_PP_SUCCESSOR_3437 3438
+#define RIOT_PP_SUCCESSOR_3438 3439
+#define RIOT_PP_SUCCESSOR_3439 3440
+#define RIOT_PP_SUCCESSOR_3440 3441
+#define RIOT_PP_SUCCESSOR_3441 3442
+#define RIOT_PP_SUCCESSOR_3442 3443
+#define RIOT_PP_SUCCESSOR_3443 3444
+#define RIOT_PP_SUCCESSOR_3444 3445
+#define RIOT_PP_SUCCESSOR_3445 3446
+#define RIOT_PP_SUCCESSOR_3446 3447
+#define RIOT_PP_SUCCESSOR_3447 3448
+#define RIOT_PP_SUCCESSOR_3448 3449
+#define RIOT_PP_SUCCESSOR_3449 3450
+#define RIOT_PP_SUCCESSOR_3450 3451
+#define RIOT_PP_SUCCESSOR_3451 3452
+#define RIOT_PP_SUCCESSOR_3452 3453
+#define RIOT_PP_SUCCESSOR_3453 3454
+#define RIOT_PP_SUCCESSOR_3454 3455
+#define RIOT_PP_SUCCESSOR_3455 3456
+#define RIOT_PP_SUCCESSOR_3456 3457
+#define RIOT_PP_SUCCESSOR_3457 3458
+#define RIOT_PP_SUCCESSOR_3458 3459
+#define RIOT_PP_SUCCESSOR_3459 3460
+#define RIOT_PP_SUCCESSOR_3460 3461
+#define RIOT_PP_SUCCESSOR_3461 3462
+#define RIOT_PP_SUCCESSOR_3462 3463
+#define RIOT_PP_SUCCESSOR_3463 3464
+#define RIOT_PP_SUCCESSOR_3464 3465
+#define RIOT_PP_SUCCESSOR_3465 3466
+#define RIOT_PP_SUCCESSOR_3466 3467
+#define RIOT_PP_SUCCESSOR_3467 3468
+#define RIOT_PP_SUCCESSOR_3468 3469
+#define RIOT_PP_SUCCESSOR_3469 3470
+#define RIOT_PP_SUCCESSOR_3470 3471
+#define RIOT_PP_SUCCESSOR_3471 3472
+#define RIOT_PP_SUCCESSOR_3472 3473
+#define RIOT_PP_SUCCESSOR_3473 3474
+#define RIOT_PP_SUCCESSOR_3474 3475
+#define RIOT_PP_SUCCESSOR_3475 3476
+#define RIOT_PP_SUCCESSOR_3476 3477
+#define RIOT_PP_SUCCESSOR_3477 3478
+#define RIOT_PP_SUCCESSOR_3478 3479
+#define RIOT_PP_SUCCESSOR_3479 3480
+#define RIOT_PP_SUCCESSOR_3480 3481
+#define RIOT_PP_SUCCESSOR_3481 3482
+#define RIOT_PP_SUCCESSOR_3482 3483
+#define RIOT_PP_SUCCESSOR_3483 3484
+#define RIOT_PP_SUCCESSOR_3484 3485
+#define RIOT_PP_SUCCESSOR_3485 3486
+#define RIOT_PP_SUCCESSOR_3486 3487
+#define RIOT_PP_SUCCESSOR_3487 3488
+#define RIOT_PP_SUCCESSOR_3488 3489
+#define RIOT_PP_SUCCESSOR_3489 3490
+#define RIOT_PP_SUCCESSOR_3490 3491
+#define RIOT_PP_SUCCESSOR_3491 3492
+#define RIOT_PP_SUCCESSOR_3492 3493
+#define RIOT_PP_SUCCESSOR_3493 3494
+#define RIOT_PP_SUCCESSOR_3494 3495
+#define RIOT_PP_SUCCESSOR_3495 3496
+#define RIOT_PP_SUCCESSOR_3496 3497
+#define RIOT_PP_SUCCESSOR_3497 3498
+#define RIOT_PP_SUCCESSOR_3498 3499
+#define RIOT_PP_SUCCESSOR_3499 3500
+#define RIOT_PP_SUCCESSOR_3500 3501
+#define RIOT_PP_SUCCESSOR_3501 3502
+#define RIOT_PP_SUCCESSOR_3502 3503
+#define RIOT_PP_SUCCESSOR_3503 3504
+#define RIOT_PP_SUCCESSOR_3504 3505
+#define RIOT_PP_SUCCESSOR_3505 3506
+#define RIOT_PP_SUCCESSOR_3506 3507
+#define RIOT_PP_SUCCESSOR_3507 3508
+#define RIOT_PP_SUCCESSOR_3508 3509
+#define RIOT_PP_SUCCESSOR_3509 3510
+#define RIOT_PP_SUCCESSOR_3510 3511
+#define RIOT_PP_SUCCESSOR_3511 3512
+#define RIOT_PP_SUCCESSOR_3512 3513
+#define RIOT_PP_SUCCESSOR_3513 3514
+#define RIOT_PP_SUCCESSOR_3514 3515
+#define RIOT_PP_SUCCESSOR_3515 3516
+#define RIOT_PP_SUCCESSOR_3516 3517
+#define RIOT_PP_SUCCESSOR_3517 3518
+#define RIOT_PP_SUCCESSOR_3518 3519
+#define RIOT_PP_SUCCESSOR_3519 3520
+#define RIOT_PP_SUCCESSOR_3520 3521
+#define RIOT_PP_SUCCESSOR_3521 3522
+#define RIOT_PP_SUCCESSOR_3522 3523
+#define RIOT_PP_SUCCESSOR_3523 3524
+#define RIOT_PP_SUCCESSOR_3524 3525
+#define RIOT_PP_SUCCESSOR_3525 3526
+#define RIOT_PP_SUCCESSOR_3526 3527
+#define RIOT_PP_SUCCESSOR_3527 3528
+#define RIOT_PP_SUCCESSOR_3528 3529
+#define RIOT_PP_SUCCESSOR_3529 3530
+#define RIOT_PP_SUCCESSOR_3530 3531
+#define RIOT_PP_SUCCESSOR_3531 3532
+#define RIOT_PP_SUCCESSOR_3532 3533
+#define RIOT_PP_SUCCESSOR_3533 3534
+#define RIOT_PP_SUCCESSOR_3534 3535
+#define RIOT_PP_SUCCESSOR_3535 3536
+#define RIOT_PP_SUCCESSOR_3536 3537
+#define RIOT_PP_SUCCESSOR_3537 3538
+#define RIOT_PP_SUCCESSOR_3538 3539
+#define RIOT_PP_SUCCESSOR_3539 3540
+#define RIOT_PP_SUCCESSOR_3540 3541
+#define RIOT_PP_SUCCESSOR_3541 3542
+#define RIOT_PP_SUCCESSOR_3542 3543
+#define RIOT_PP_SUCCESSOR_3543 3544
+#define RIOT_PP_SUCCESSOR_3544 3545
+#define RIOT_PP_SUCCESSOR_3545 3546
+#define RIOT_PP_SUCCESSOR_3546 3547
+#define RIOT_PP_SUCCESSOR_3547 3548
+#define RIOT_PP_SUCCESSOR_3548 3549
+#define RIOT_PP_SUCCESSOR_3549 3550
+#define RIOT_PP_SUCCESSOR_3550 3551
+#define RIOT_PP_SUCCESSOR_3551 3552
+#define RIOT_PP_SUCCESSOR_3552 3553
+#define RIOT_PP_SUCCESSOR_3553 3554
+#define RIOT_PP_SUCCESSOR_3554 3555
+#define RIOT_PP_SUCCESSOR_3555 3556
+#define RIOT_PP_SUCCESSOR_3556 3557
+#define RIOT_PP_SUCCESSOR_3557 3558
+#define RIOT_PP_SUCCESSOR_3558 3559
+#define RIOT_PP_SUCCESSOR_3559 3560
+#define RIOT_PP_SUCCESSOR_3560 3561
+#define RIOT_PP_SUCCESSOR_3561 3562
+#define RIOT_PP_SUCCESSOR_3562 3563
+#define RIOT_PP_SUCCESSOR_3563 3564
+#define RIOT_PP_SUCCESSOR_3564 3565
+#define RIOT_PP_SUCCESSOR_3565 3566
+#define RIOT_PP_SUCCESSOR_3566 3567
+#define RIOT_PP_SUCCESSOR_3567 3568
+#define RIOT_PP_SUCCESSOR_3568 3569
+#define RIOT_PP_SUCCESSOR_3569 3570
+#define RIOT_PP_SUCCESSOR_3570 3571
+#define RIOT_PP_SUCCESSOR_3571 3572
+#define RIOT_PP_SUCCESSOR_3572 3573
+#define RIOT_PP_SUCCESSOR_3573 3574
+#define RIOT_PP_SUCCESSOR_3574 3575
+#define RIOT_PP_SUCCESSOR_3575 3576
+#define RIOT_PP_SUCCESSOR_3576 3577
+#define RIOT_PP_SUCCESSOR_3577 3578
+#define RIOT_PP_SUCCESSOR_3578 3579
+#define RIOT_PP_SUCCESSOR_3579 3580
+#define RIOT_PP_SUCCESSOR_3580 3581
+#define RIOT_PP_SUCCESSOR_3581 3582
+#define RIOT_PP_SUCCESSOR_3582 3583
+#define RIOT_PP_SUCCESSOR_3583 3584
+#define RIOT_PP_SUCCESSOR_3584 3585
+#define RIOT_PP_SUCCESSOR_3585 3586
+#define RIOT_PP_SUCCESSOR_3586 3587
+#define RIOT_PP_SUCCESSOR_3587 3588
+#define RIOT_PP_SUCCESSOR_3588 3589
+#define RIOT_PP_SUCCESSOR_3589 3590
+#define RIOT_PP_SUCCESSOR_3590 3591
+#define RIOT_PP_SUCCESSOR_3591 3592
+#define RIOT_PP_SUCCESSOR_3592 3593
+#define RIOT_PP_SUCCESSOR_3593 3594
+#define RIOT_PP_SUCCESSOR_3594 3595
+#define RIOT_PP_SUCCESSOR_3595 3596
+#define RIOT_PP_SUCCESSOR_3596 3597
+#define RIOT_PP_SUCCESSOR_3597 3598
+#define RIOT_PP_SUCCESSOR_3598 3599
+#define RIOT_PP_SUCCESSOR_3599 3600
+#define RIOT_PP_SUCCESSOR_3600 3601
+#define RIOT_PP_SUCCESSOR_3601 3602
+#define RIOT_PP_SUCCESSOR_3602 3603
+#define RIOT_PP_SUCCESSOR_3603 3604
+#define RIOT_PP_SUCCESSOR_3604 3605
+#define RIOT_PP_SUCCESSOR_3605 3606
+#define RIOT_PP_SUCCESSOR_3606 3607
+#define RIOT_PP_SUCCESSOR_3607 3608
+#define RIOT_PP_SUCCESSOR_3608 3609
+#define RIOT_PP_SUCCESSOR_3609 3610
+#define RIOT_PP_SUCCESSOR_3610 3611
+#define RIOT_PP_SUCCESSOR_3611 3612
+#define RIOT_PP_SUCCESSOR_3612 3613
+#define RIOT_PP_SUCCESSOR_3613 3614
+#define RIOT_PP_SUCCESSOR_3614 3615
+#define RIOT_PP_SUCCESSOR_3615 3616
+#define RIOT_PP_SUCCESSOR_3616 3617
+#define RIOT_PP_SUCCESSOR_3617 3618
+#define RIOT_PP_SUCCESSOR_3618 3619
+#define RIOT_PP_SUCCESSOR_3619 3620
+#define RIOT_PP_SUCCESSOR_3620 3621
+#define RIOT_PP_SUCCESSOR_3621 3622
+#define RIOT_PP_SUCCESSOR_3622 3623
+#define RIOT_PP_SUCCESSOR_3623 3624
+#define RIOT_PP_SUCCESSOR_3624 3625
+#define RIOT_PP_SUCCESSOR_3625 3626
+#define RIOT_PP_SUCCESSOR_3626 3627
+#define RIOT_PP_SUCCESSOR_3627 3628
+#define RIOT_PP_SUCCESSOR_3628 3629
+#define RIOT_PP_SUCCESSOR_3629 3630
+#define RIOT_PP_SUCCESSOR_3630 3631
+#define RIOT_PP_SUCCESSOR_3631 3632
+#define RIOT_PP_SUCCESSOR_3632 3633
+#define RIOT_PP_SUCCESSOR_3633 3634
+#define RIOT_PP_SUCCESSOR_3634 3635
+#define RIOT_PP_SUCCESSOR_3635 3636
+#define RIOT_PP_SUCCESSOR_3636 3637
+#define RIOT_PP_SUCCESSOR_3637 3638
+#define RIOT_PP_SUCCESSOR_3638 3639
+#define RIOT_PP_SUCCESSOR_3639 3640
+#define RIOT_PP_SUCCESSOR_3640 3641
+#define RIOT_PP_SUCCESSOR_3641 3642
+#define RIOT_PP_SUCCESSOR_3642 3643
+#define RIOT_PP_SUCCESSOR_3643 3644
+#define RIOT_PP_SUCCESSOR_3644 3645
+#define RIOT_PP_SUCCESSOR_3645 3646
+#define RIOT_PP_SUCCESSOR_3646 3647
+#define RIOT_PP_SUCCESSOR_3647 3648
+#define RIOT_PP_SUCCESSOR_3648 3649
+#define RIOT_PP_SUCCESSOR_3649 3650
+#define RIOT_PP_SUCCESSOR_3650 3651
+#define RIOT_PP_SUCCESSOR_3651 3652
+#define RIOT_PP_SUCCESSOR_3652 3653
+#define RIOT_PP_SUCCESSOR_3653 3654
+#define RIOT_PP_SUCCESSOR_3654 3655
+#define RIOT_PP_SUCCESSOR_3655 3656
+#define RIOT_PP_SUCCESSOR_3656 3657
+#define RIOT_PP_SUCCESSOR_3657 3658
+#define RIOT_PP_SUCCESSOR_3658 3659
+#define RIOT_PP_SUCCESSOR_3659 3660
+#define RIOT_PP_SUCCESSOR_3660 3661
+#define RIOT_PP_SUCCESSOR_3661 3662
+#define RIOT_PP_SUCCESSOR_3662 3663
+#define RIOT_PP_SUCCESSOR_3663 3664
+#define RIOT_PP_SUCCESSOR_3664 3665
+#define RIOT_PP_SUCCESSOR_3665 3666
+#define RIOT_PP_SUCCESSOR_3666 3667
+#define RIOT_PP_SUCCESSOR_3667 3668
+#define RIOT_PP_SUCCESSOR_3668 3669
+#define RIOT_PP_SUCCESSOR_3669 3670
+#define RIOT_PP_SUCCESSOR_3670 3671
+#define RIOT_PP_SUCCESSOR_3671 3672
+#define RIOT_PP_SUCCESSOR_3672 3673
+#define RIOT_PP_SUCCESSOR_3673 3674
+#define RIOT_PP_SUCCESSOR_3674 3675
+#define RIOT_PP_SUCCESSOR_3675 3676
+#define RIOT_PP_SUCCESSOR_3676 3677
+#define RIOT_PP_SUCCESSOR_3677 3678
+#define RIOT_PP_SUCCESSOR_3678 3679
+#define RIOT_PP_SUCCESSOR_3679 3680
+#define RIOT_PP_SUCCESSOR_3680 3681
+#define RIOT_PP_SUCCESSOR_3681 3682
+#define RIOT_PP_SUCCESSOR_3682 3683
+#define RIOT_PP_SUCCESSOR_3683 3684
+#define RIOT_PP_SUCCESSOR_3684 3685
+#define RIOT_PP_SUCCESSOR_3685 3686
+#define RIOT_PP_SUCCESSOR_3686 3687
+#define RIOT_PP_SUCCESSOR_3687 3688
+#define RIOT_PP_SUCCESSOR_3688 3689
+#define RIOT_PP_SUCCESSOR_3689 3690
+#define RIOT_PP_SUCCESSOR_3690 3691
+#define RIOT_PP_SUCCESSOR_3691 3692
+#define RIOT_PP_SUCCESSOR_3692 3693
+#define RIOT_PP_SUCCESSOR_3693 3694
+#define RIOT_PP_SUCCESSOR_3694 3695
+#define RIOT_PP_SUCCESSOR_3695 3696
+#define RIOT_PP_SUCCESSOR_3696 3697
+#define RIOT_PP_SUCCESSOR_3697 3698
+#define RIOT_PP_SUCCESSOR_3698 3699
+#define RIOT_PP_SUCCESSOR_3699 3700
+#define RIOT_PP_SUCCESSOR_3700 3701
+#define RIOT_PP_SUCCESSOR_3701 3702
+#define RIOT_PP_SUCCESSOR_3702 3703
+#define RIOT_PP_SUCCESSOR_3703 3704
+#define RIOT_PP_SUCCESSOR_3704 3705
+#define RIOT_PP_SUCCESSOR_3705 3706
+#define RIOT_PP_SUCCESSOR_3706 3707
+#define RIOT_PP_SUCCESSOR_3707 3708
+#define RIOT_PP_SUCCESSOR_3708 3709
+#define RIOT_PP_SUCCESSOR_3709 3710
+#define RIOT_PP_SUCCESSOR_3710 3711
+#define RIOT_PP_SUCCESSOR_3711 3712
+#define RIOT_PP_SUCCESSOR_3712 3713
+#define RIOT_PP_SUCCESSOR_3713 3714
+#define RIOT_PP_SUCCESSOR_3714 3715
+#define RIOT_PP_SUCCESSOR_3715 3716
+#define RIOT_PP_SUCCESSOR_3716 3717
+#define RIOT_PP_SUCCESSOR_3717 3718
+#define RIOT_PP_SUCCESSOR_3718 3719
+#define RIOT_PP_SUCCESSOR_3719 3720
+#define RIOT_PP_SUCCESSOR_3720 3721
+#define RIOT_PP_SUCCESSOR_3721 3722
+#define RIOT_PP_SUCCESSOR_3722 3723
+#define RIOT_PP_SUCCESSOR_3723 3724
+#define RIOT_PP_SUCCESSOR_3724 3725
+#define RIOT_PP_SUCCESSOR_3725 3726
+#define RIOT_PP_SUCCESSOR_3726 3727
+#define RIOT_PP_SUCCESSOR_3727 3728
+#define RIOT_PP_SUCCESSOR_3728 3729
+#define RIOT_PP_SUCCESSOR_3729 3730
+#define RIOT_PP_SUCCESSOR_3730 3731
+#define RIOT_PP_SUCCESSOR_3731 3732
+#define RIOT_PP_SUCCESSOR_3732 3733
+#define RIOT_PP_SUCCESSOR_3733 3734
+#define RIOT_PP_SUCCESSOR_3734 3735
+#define RIOT_PP_SUCCESSOR_3735 3736
+#define RIOT_PP_SUCCESSOR_3736 3737
+#define RIOT_PP_SUCCESSOR_3737 3738
+#define RIOT_PP_SUCCESSOR_3738 3739
+#define RIOT_PP_SUCCESSOR_3739 3740
+#define RIOT_PP_SUCCESSOR_3740 3741
+#define RIOT_PP_SUCCESSOR_3741 3742
+#define RIOT_PP_SUCCESSOR_3742 3743
+#define RIOT_PP_SUCCESSOR_3743 3744
+#define RIOT_PP_SUCCESSOR_3744 3745
+#define RIOT_PP_SUCCESSOR_3745 3746
+#define RIOT_PP_SUCCESSOR_3746 3747
+#define RIOT_PP_SUCCESSOR_3747 3748
+#define RIOT_PP_SUCCESSOR_3748 3749
+#define RIOT_PP_SUCCESSOR_3749 3750
+#define RIOT_PP_SUCCESSOR_3750 3751
+#define RIOT_PP_SUCCESSOR_3751 3752
+#define RIOT_PP_SUCCESSOR_3752 3753
+#define RIOT_PP_SUCCESSOR_3753 3754
+#define RIOT_PP_SUCCESSOR_3754 3755
+#define RIOT_PP_SUCCESSOR_3755 3756
+#define RIOT_PP_SUCCESSOR_3756 3757
+#define RIOT_PP_SUCCESSOR_3757 3758
+#define RIOT_PP_SUCCESSOR_3758 3759
+#define RIOT_PP_SUCCESSOR_3759 3760
+#define RIOT_PP_SUCCESSOR_3760 3761
+#define RIOT_PP_SUCCESSOR_3761 3762
+#define RIOT_PP_SUCCESSOR_3762 3763
+#define RIOT_PP_SUCCESSOR_3763 3764
+#define RIOT_PP_SUCCESSOR_3764 3765
+#define RIOT_PP_SUCCESSOR_3765 3766
+#define RIOT_PP_SUCCESSOR_3766 3767
+#define RIOT_PP_SUCCESSOR_3767 3768
+#define RIOT_PP_SUCCESSOR_3768 3769
+#define RIOT_PP_SUCCESSOR_3769 3770
+#define RIOT_PP_SUCCESSOR_3770 3771
+#define RIOT_PP_SUCCESSOR_3771 3772
+#define RIOT_PP_SUCCESSOR_3772 3773
+#define RIOT_PP_SUCCESSOR_3773 3774
+#define RIOT_PP_SUCCESSOR_3774 3775
+#define RIOT_PP_SUCCESSOR_3775 3776
+#define RIOT_PP_SUCCESSOR_3776 3777
+#define RIOT_PP_SUCCESSOR_3777 3778
+#define RIOT_PP_SUCCESSOR_3778 3779
+#define RIOT_PP_SUCCESSOR_3779 3780
+#define RIOT_PP_SUCCESSOR_3780 3781
+#define RIOT_PP_SUCCESSOR_3781 3782
+#define RIOT_PP_SUCCESSOR_3782 3783
+#define RIOT_PP_SUCCESSOR_3783 3784
+#define RIOT_PP_SUCCESSOR_3784 3785
+#define RIOT_PP_SUCCESSOR_3785 3786
+#define RIOT_PP_SUCCESSOR_3786 3787
+#define RIOT_PP_SUCCESSOR_3787 3788
+#define RIOT_PP_SUCCESSOR_3788 3789
+#define RIOT_PP_SUCCESSOR_3789 3790
+#define RIOT_PP_SUCCESSOR_3790 3791
+#define RIOT_PP_SUCCESSOR_3791 3792
+#define RIOT_PP_SUCCESSOR_3792 3793
+#define RIOT_PP_SUCCESSOR_3793 3794
+#define RIOT_PP_SUCCESSOR_3794 3795
+#define RIOT_PP_SUCCESSOR_3795 3796
+#define RIOT_PP_SUCCESSOR_3796 3797
+#define RIOT_PP_SUCCESSOR_3797 3798
+#define RIOT_PP_SUCCESSOR_3798 3799
+#define RIOT_PP_SUCCESSOR_3799 3800
+#define RIOT_PP_SUCCESSOR_3800 3801
+#define RIOT_PP_SUCCESSOR_3801 3802
+#define RIOT_PP_SUCCESSOR_3802 3803
+#define RIOT_PP_SUCCESSOR_3803 3804
+#define RIOT_PP_SUCCESSOR_3804 3805
+#define RIOT_PP_SUCCESSOR_3805 3806
+#define RIOT_PP_SUCCESSOR_3806 3807
+#define RIOT_PP_SUCCESSOR_3807 3808
+#define RIOT_PP_SUCCESSOR_3808 3809
+#define RIOT_PP_SUCCESSOR_3809 3810
+#define RIOT_PP_SUCCESSOR_3810 3811
+#define RIOT_PP_SUCCESSOR_3811 3812
+#define RIOT_PP_SUCCESSOR_3812 3813
+#define RIOT_PP_SUCCESSOR_3813 3814
+#define RIOT_PP_SUCCESSOR_3814 3815
+#define RIOT_PP_SUCCESSOR_3815 3816
+#define RIOT_PP_SUCCESSOR_3816 3817
+#define RIOT_PP_SUCCESSOR_3817 3818
+#define RIOT_PP_SUCCESSOR_3818 3819
+#define RIOT_PP_SUCCESSOR_3819 3820
+#define RIOT_PP_SUCCESSOR_3820 3821
+#define RIOT_PP_SUCCESSOR_3821 3822
+#define RIOT_PP_SUCCESSOR_3822 3823
+#define RIOT_PP_SUCCESSOR_3823 3824
+#define RIOT_PP_SUCCESSOR_3824 3825
+#define RIOT_PP_SUCCESSOR_3825 3826
+#define RIOT_PP_SUCCESSOR_3826 3827
+#define RIOT_PP_SUCCESSOR_3827 3828
+#define RIOT_PP_SUCCESSOR_3828 3829
+#define RIOT_PP_SUCCESSOR_3829 3830
+#define RIOT_PP_SUCCESSOR_3830 3831
+#define RIOT_PP_SUCCESSOR_3831 3832
+#define RIOT_PP_SUCCESSOR_3832 3833
+#define RIOT_PP_SUCCESSOR_3833 3834
+#define RIOT_PP_SUCCESSOR_3834 3835
+#define RIOT_PP_SUCCESSOR_3835 3836
+#define RIOT_PP_SUCCESSOR_3836 3837
+#define RIOT_PP_SUCCESSOR_3837 3838
+#define RIOT_PP_SUCCESSOR_3838 3839
+#define RIOT_PP_SUCCESSOR_3839 3840
+#define RIOT_PP_SUCCESSOR_3840 3841
+#define RIOT_PP_SUCCESSOR_3841 3842
+#define RIOT_PP_SUCCESSOR_3842 3843
+#define RIOT_PP_SUCCESSOR_3843 3844
+#define RIOT_PP_SUCCESSOR_3844 3845
+#define RIOT_PP_SUCCESSOR_3845 3846
+#define RIOT_PP_SUCCESSOR_3846 3847
+#define RIOT_PP_SUCCESSOR_3847 3848
+#define RIOT_PP_SUCCESSOR_3848 3849
+#define RIOT_PP_SUCCESSOR_3849 3850
+#define RIOT_PP_SUCCESSOR_3850 3851
+#define RIOT_PP_SUCCESSOR_3851 3852
+#define RIOT_PP_SUCCESSOR_3852 3853
+#define RIOT_PP_SUCCESSOR_3853 3854
+#define RIOT_PP_SUCCESSOR_3854 3855
+#define RIOT_PP_SUCCESSOR_3855 3856
+#define RIOT_PP_SUCCESSOR_3856 3857
+#define RIOT_PP_SUCCESSOR_3857 3858
+#define RIOT_PP_SUCCESSOR_3858 3859
+#define RIOT_PP_SUCCESSOR_3859 3860
+#define RIOT_PP_SUCCESSOR_3860 3861
+#define RIOT_PP_SUCCESSOR_3861 3862
+#define RIOT_PP_SUCCESSOR_3862 3863
+#define RIOT_PP_SUCCESSOR_3863 3864
+#define RIOT_PP_SUCCESSOR_3864 3865
+#define RIOT_PP_SUCCESSOR_3865 3866
+#define RIOT_PP_SUCCESSOR_3866 3867
+#define RIOT_PP_SUCCESSOR_3867 3868
+#define RIOT_PP_SUCCESSOR_3868 3869
+#define RIOT_PP_SUCCESSOR_3869 3870
+#define RIOT_PP_SUCCESSOR_3870 3871
+#define RIOT_PP_SUCCESSOR_3871 3872
+#define RIOT_PP_SUCCESSOR_3872 3873
+#define RIOT_PP_SUCCESSOR_3873 3874
+#define RIOT_PP_SUCCESSOR_3874 3875
+#define RIOT_PP_SUCCESSOR_3875 3876
+#define RIOT_PP_SUCCESSOR_3876 3877
+#define RIOT_PP_SUCCESSOR_3877 3878
+#define RIOT_PP_SUCCESSOR_3878 3879
+#define RIOT_PP_SUCCESSOR_3879 3880
+#define RIOT_PP_SUCCESSOR_3880 3881
+#define RIOT_PP_SUCCESSOR_3881 3882
+#define RIOT_PP_SUCCESSOR_3882 3883
+#define RIOT_PP_SUCCESSOR_3883 3884
+#define RIOT_PP_SUCCESSOR_3884 3885
+#define RIOT_PP_SUCCESSOR_3885 3886
+#define RIOT_PP_SUCCESSOR_3886 3887
+#define RIOT_PP_SUCCESSOR_3887 3888
+#define RIOT_PP_SUCCESSOR_3888 3889
+#define RIOT_PP_SUCCESSOR_3889 3890
+#define RIOT_PP_SUCCESSOR_3890 3891
+#define RIOT_PP_SUCCESSOR_3891 3892
+#define RIOT_PP_SUCCESSOR_3892 3893
+#define RIOT_PP_SUCCESSOR_3893 3894
+#define RIOT_PP_SUCCESSOR_3894 3895
+#define RIOT_PP_SUCCESSOR_3895 3896
+#define RIOT_PP_SUCCESSOR_3896 3897
+#define RIOT_PP_SUCCESSOR_3897 3898
+#define RIOT_PP_SUCCESSOR_3898 3899
+#define RIOT_PP_SUCCESSOR_3899 3900
+#define RIOT_PP_SUCCESSOR_3900 3901
+#define RIOT_PP_SUCCESSOR_3901 3902
+#define RIOT_PP_SUCCESSOR_3902 3903
+#define RIOT_PP_SUCCESSOR_3903 3904
+#define RIOT_PP_SUCCESSOR_3904 3905
+#define RIOT_PP_SUCCESSOR_3905 3906
+#define RIOT_PP_SUCCESSOR_3906 3907
+#define RIOT_PP_SUCCESSOR_3907 3908
+#define RIOT_PP_SUCCESSOR_3908 3909
+#define RIOT_PP_SUCCESSOR_3909 3910
+#define RIOT_PP_SUCCESSOR_3910 3911
+#define RIOT_PP_SUCCESSOR_3911 3912
+#define RIOT_PP_SUCCESSOR_3912 3913
+#define RIOT_PP_SUCCESSOR_3913 3914
+#define RIOT_PP_SUCCESSOR_3914 3915
+#define RIOT_PP_SUCCESSOR_3915 3916
+#define RIOT_PP_SUCCESSOR_3916 3917
+#define RIOT_PP_SUCCESSOR_3917 3918
+#define RIOT_PP_SUCCESSOR_3918 3919
+#define RIOT_PP_SUCCESSOR_3919 3920
+#define RIOT_PP_SUCCESSOR_3920 3921
+#define RIOT_PP_SUCCESSOR_3921 3922
+#define RIOT_PP_SUCCESSOR_3922 3923
+#define RIOT_PP_SUCCESSOR_3923 3924
+#define RIOT_PP_SUCCESSOR_3924 3925
+#define RIOT_PP_SUCCESSOR_3925 3926
+#define RIOT_PP_SUCCESSOR_3926 3927
+#define RIOT_PP_SUCCESSOR_3927 3928
+#define RIOT_PP_SUCCESSOR_3928 3929
+#define RIOT_PP_SUCCESSOR_3929 3930
+#define RIOT_PP_SUCCESSOR_3930 3931
+#define RIOT_PP_SUCCESSOR_3931 3932
+#define RIOT_PP_SUCCESSOR_3932 3933
+#define RIOT_PP_SUCCESSOR_3933 3934
+#define RIOT_PP_SUCCESSOR_3934 3935
+#define RIOT_PP_SUCCESSOR_3935 3936
+#define RIOT_PP_SUCCESSOR_3936 3937
+#define RIOT_PP_SUCCESSOR_3937 3938
+#define RIOT_PP_SUCCESSOR_3938 3939
+#define RIOT_PP_SUCCESSOR_3939 3940
+#define RIOT_PP_SUCCESSOR_3940 3941
+#define RIOT_PP_SUCCESSOR_3941 3942
+#define RIOT_PP_SUCCESSOR_3942 3943
+#define RIOT_PP_SUCCESSOR_3943 3944
+#define RIOT_PP_SUCCESSOR_3944 3945
+#define RIOT_PP_SUCCESSOR_3945 3946
+#define RIOT_PP_SUCCESSOR_3946 3947
+#define RIOT_PP_SUCCESSOR_3947 3948
+#define RIOT_PP_SUCCESSOR_3948 3949
+#define RIOT_PP_SUCCESSOR_3949 3950
+#define RIOT_PP_SUCCESSOR_3950 3951
+#define RIOT_PP_SUCCESSOR_3951 3952
+#define RIOT_PP_SUCCESSOR_3952 3953
+#define RIOT_PP_SUCCESSOR_3953 3954
+#define RIOT_PP_SUCCESSOR_3954 3955
+#define RIOT_PP_SUCCESSOR_3955 3956
+#define RIOT_PP_SUCCESSOR_3956 3957
+#define RIOT_PP_SUCCESSOR_3957 3958
+#define RIOT_PP_SUCCESSOR_3958 3959
+#define RIOT_PP_SUCCESSOR_3959 3960
+#define RIOT_PP_SUCCESSOR_3960 3961
+#define RIOT_PP_SUCCESSOR_3961 3962
+#define RIOT_PP_SUCCESSOR_3962 3963
+#define RIOT_PP_SUCCESSOR_3963 3964
+#define RIOT_PP_SUCCESSOR_3964 3965
+#define RIOT_PP_SUCCESSOR_3965 3966
+#define RIOT_PP_SUCCESSOR_3966 3967
+#define RIOT_PP_SUCCESSOR_3967 3968
+#define RIOT_PP_SUCCESSOR_3968 3969
+#define RIOT_PP_SUCCESSOR_3969 3970
+#define RIOT_PP_SUCCESSOR_3970 3971
+#define RIOT_PP_SUCCESSOR_3971 3972
+#define RIOT_PP_SUCCESSOR_3972 3973
+#define RIOT_PP_SUCCESSOR_3973 3974
+#define RIOT_PP_SUCCESSOR_3974 3975
+#define RIOT_PP_SUCCESSOR_3975 3976
+#define RIOT_PP_SUCCESSOR_3976 3977
+#define RIOT_PP_SUCCESSOR_3977 3978
+#define RIOT_PP_SUCCESSOR_3978 3979
+#define RIOT_PP_SUCCESSOR_3979 3980
+#define RIOT_PP_SUCCESSOR_3980 3981
+#define RIOT_PP_SUCCESSOR_3981 3982
+#define RIOT_PP_SUCCESSOR_3982 3983
+#define RIOT_PP_SUCCESSOR_3983 3984
+#define RIOT_PP_SUCCESSOR_3984 3985
+#define RIOT_PP_SUCCESSOR_3985 3986
+#define RIOT_PP_SUCCESSOR_3986 3987
+#define RIOT_PP_SUCCESSOR_3987 3988
+#define RIOT_PP_SUCCESSOR_3988 3989
+#define RIOT_PP_SUCCESSOR_3989 3990
+#define RIOT_PP_SUCCESSOR_3990 3991
+#define RIOT_PP_SUCCESSOR_3991 3992
+#define RIOT_PP_SUCCESSOR_3992 3993
+#define RIOT_PP_SUCCESSOR_3993 3994
+#define RIOT_PP_SUCCESSOR_3994 3995
+#define RIOT_PP_SUCCESSOR_3995 3996
+#define RIOT_PP_SUCCESSOR_3996 3997
+#define RIOT_PP_SUCCESSOR_3997 3998
+#define RIOT_PP_SUCCESSOR_3998 3999
+#define RIOT_PP_SUCCESSOR_3999 4000
+#define RIOT_PP_SUCCESSOR_4000 4001
+#define RIOT_PP_SUCCESSOR_4001 4002
+#define RIOT_PP_SUCCESSOR_4002 4003
+#define RIOT_PP_SUCCESSOR_4003 4004
+#define RIOT_PP_SUCCESSOR_4004 4005
+#define RIOT_PP_SUCCESSOR_4005 4006
+#define RIOT_PP_SUCCESSOR_4006 4007
+#define RIOT_PP_SUCCESSOR_4007 4008
+#define RIOT_PP_SUCCESSOR_4008 4009
+#define RIOT_PP_SUCCESSOR_4009 4010
+#define RIOT_PP_SUCCESSOR_4010 4011
+#define RIOT_PP_SUCCESSOR_4011 4012
+#define RIOT_PP_SUCCESSOR_4012 4013
+#define RIOT_PP_SUCCESSOR_4013 4014
+#define RIOT_PP_SUCCESSOR_4014 4015
+#define RIOT_PP_SUCCESSOR_4015 4016
+#define RIOT_PP_SUCCESSOR_4016 4017
+#define RIOT_PP_SUCCESSOR_4017 4018
+#define RIOT_PP_SUCCESSOR_4018 4019
+#define RIOT_PP_SUCCESSOR_4019 4020
+#define RIOT_PP_SUCCESSOR_4020 4021
+#define RIOT_PP_SUCCESSOR_4021 4022
+#define RIOT_PP_SUCCESSOR_4022 4023
+#define RIOT_PP_SUCCESSOR_4023 4024
+#define RIOT_PP_SUCCESSOR_4024 4025
+#define RIOT_PP_SUCCESSOR_4025 4026
+#define RIOT_PP_SUCCESSOR_4026 4027
+#define RIOT_PP_SUCCESSOR_4027 4028
+#define RIOT_PP_SUCCESSOR_4028 4029
+#define RIOT_PP_SUCCESSOR_4029 4030
+#define RIOT_PP_SUCCESSOR_4030 4031
+#define RIOT_PP_SUCCESSOR_4031 4032
+#define RIOT_PP_SUCCESSOR_4032 4033
+#define RIOT_PP_SUCCESSOR_4033 4034
+#define RIOT_PP_SUCCESSOR_4034 4035
+#define RIOT_PP_SUCCESSOR_4035 4036
+#define RIOT_PP_SUCCESSOR_4036 4037
+#define RIOT_PP_SUCCESSOR_4037 4038
+#define RIOT_PP_SUCCESSOR_4038 4039
+#define RIOT_PP_SUCCESSOR_4039 4040
+#define RIOT_PP_SUCCESSOR_4040 4041
+#define RIOT_PP_SUCCESSOR_4041 4042
+#define RIOT_PP_SUCCESSOR_4042 4043
+#define RIOT_PP_SUCCESSOR_4043 4044
+#define RIOT_PP_SUCCESSOR_4044 4045
+#define RIOT_PP_SUCCESSOR_4045 4046
+#define RIOT_PP_SUCCESSOR_4046 4047
+#define RIOT_PP_SUCCESSOR_4047 4048
+#define RIOT_PP_SUCCESSOR_4048 4049
+#define RIOT_PP_SUCCESSOR_4049 4050
+#define RIOT_PP_SUCCESSOR_4050 4051
+#define RIOT_PP_SUCCESSOR_4051 4052
+#define RIOT_PP_SUCCESSOR_4052 4053
+#define RIOT_PP_SUCCESSOR_4053 4054
+#define RIOT_PP_SUCCESSOR_4054 4055
+#define RIOT_PP_SUCCESSOR_4055 4056
+#define RIOT_PP_SUCCESSOR_4056 4057
+#define RIOT_PP_SUCCESSOR_4057 4058
+#define RIOT_PP_SUCCESSOR_4058 4059
+#define RIOT_PP_SUCCESSOR_4059 4060
+#define RIOT_PP_SUCCESSOR_4060 4061
+#define RIOT_PP_SUCCESSOR_4061 4062
+#define RIOT_PP_SUCCESSOR_4062 4063
+#define RIOT_PP_SUCCESSOR_4063 4064
+#define RIOT_PP_SUCCESSOR_4064 4065
+#define RIOT_PP_SUCCESSOR_4065 4066
+#define RIOT_PP_SUCCESSOR_4066 4067
+#define RIOT_PP_SUCCESSOR_4067 4068
+#define RIOT_PP_SUCCESSOR_4068 4069
+#define RIOT_PP_SUCCESSOR_4069 4070
+#define RIOT_PP_SUCCESSOR_4070 4071
+#define RIOT_PP_SUCCESSOR_4071 4072
+#define RIOT_PP_SUCCESSOR_4072 4073
+#define RIOT_PP_SUCCESSOR_4073 4074
+#define RIOT_PP_SUCCESSOR_4074 4075
+#define RIOT_PP_SUCCESSOR_4075 4076
+#define RIOT_PP_SUCCESSOR_4076 4077
+#define RIOT_PP_SUCCESSOR_4077 4078
+#define RIOT_PP_SUCCESSOR_4078 4079
+#define RIOT_PP_SUCCESSOR_4079 4080
+#define RIOT_PP_SUCCESSOR_4080 4081
+#define RIOT_PP_SUCCESSOR_4081 4082
+#define RIOT_PP_SUCCESSOR_4082 4083
+#define RIOT_PP_SUCCESSOR_4083 4084
+#define RIOT_PP_SUCCESSOR_4084 4085
+#define RIOT_PP_SUCCESSOR_4085 4086
+#define RIOT_PP_SUCCESSOR_4086 4087
+#define RIOT_PP_SUCCESSOR_4087 4088
+#define RIOT_PP_SUCCESSOR_4088 4089
+#define RIOT_PP_SUCCESSOR_4089 4090
+#define RIOT_PP_SUCCESSOR_4090 4091
+#define RIOT_PP_SUCCESSOR_4091 4092
+#define RIOT_PP_SUCCESSOR_4092 4093
+#define RIOT_PP_SUCCESSOR_4093 4094
+#define RIOT_PP_SUCCESSOR_4094 4095
+#define RIOT_PP_SUCCESSOR_4095 4096
+#define RIOT_PP_SUCCESSOR_4096 4097
+#define RIOT_PP_SUCCESSOR_4097 4098
+#define RIOT_PP_SUCCESSOR_4098 4099
+#define RIOT_PP_SUCCESSOR_4099 4100
+#define RIOT_PP_SUCCESSOR_4100 4101
+#define RIOT_PP_SUCCESSOR_4101 4102
+#define RIOT_PP_SUCCESSOR_4102 4103
+#define RIOT_PP_SUCCESSOR_4103 4104
+#define RIOT_PP_SUCCESSOR_4104 4105
+#define RIOT_PP_SUCCESSOR_4105 4106
+#define RIOT_PP_SUCCESSOR_4106 4107
+#define RIOT_PP_SUCCESSOR_4107 4108
+#define RIOT_PP_SUCCESSOR_4108 4109
+#define RIOT_PP_SUCCESSOR_4109 4110
+#define RIOT_PP_SUCCESSOR_4110 4111
+#define RIOT_PP_SUCCESSOR_4111 4112
+#define RIOT_PP_SUCCESSOR_4112 4113
+#define RIOT_PP_SUCCESSOR_4113 4114
+#define RIOT_PP_SUCCESSOR_4114 4115
+#define RIOT_PP_SUCCESSOR_4115 4116
+#define RIOT_PP_SUCCESSOR_4116 4117
+#define RIOT_PP_SUCCESSOR_4117 4118
+#define RIOT_PP_SUCCESSOR_4118 4119
+#define RIOT_PP_SUCCESSOR_4119 4120
+#define RIOT_PP_SUCCESSOR_4120 4121
+#define RIOT_PP_SUCCESSOR_4121 4122
+#define RIOT_PP_SUCCESSOR_4122 4123
+#define RIOT_PP_SUCCESSOR_4123 4124
+#define RIOT_PP_SUCCESSOR_4124 4125
+#define RIOT_PP_SUCCESSOR_4125 4126
+#define RIOT_PP_SUCCESSOR_4126 4127
+#define RIOT_PP_SUCCESSOR_4127 4128
+#define RIOT_PP_SUCCESSOR_4128 4129
+#define RIOT_PP_SUCCESSOR_4129 4130
+#define RIOT_PP_SUCCESSOR_4130 4131
+#define RIOT_PP_SUCCESSOR_4131 4132
+#define RIOT_PP_SUCCESSOR_4132 4133
+#define RIOT_PP_SUCCESSOR_4133 4134
+#define RIOT_PP_SUCCESSOR_4134 4135
+#define RIOT_PP_SUCCESSOR_4135 4136
+#define RIOT_PP_SUCCESSOR_4136 4137
+#define RIOT_PP_SUCCESSOR_4137 4138
+#define RIOT_PP_SUCCESSOR_4138 4139
+#define RIOT_PP_SUCCESSOR_4139 4140
+#define RIOT_PP_SUCCESSOR_4140 4141
+#define RIOT_PP_SUCCESSOR_4141 4142
+#define RIOT_PP_SUCCESSOR_4142 4143
+#define RIOT_PP_SUCCESSOR_4143 4144
+#define RIOT_PP_SUCCESSOR_4144 4145
+#define RIOT_PP_SUCCESSOR_4145 4146
+#define RIOT_PP_SUCCESSOR_4146 4147
+#define RIOT_PP_SUCCESSOR_4147 4148
+#define RIOT_PP_SUCCESSOR_4148 4149
+#define RIOT_PP_SUCCESSOR_4149 4150
+#define RIOT_PP_SUCCESSOR_4150 4151
+#define RIOT_PP_SUCCESSOR_4151 4152
+#define RIOT_PP_SUCCESSOR_4152 4153
+#define RIOT_PP_SUCCESSOR_4153 4154
+#define RIOT_PP_SUCCESSOR_4154 4155
+#define RIOT_PP_SUCCESSOR_4155 4156
+#define RIOT_PP_SUCCESSOR_4156 4157
+#define RIOT_PP_SUCCESSOR_4157 4158
+#define RIOT_PP_SUCCESSOR_4158 4159
+#define RIOT_PP_SUCCESSOR_4159 4160
+#define RIOT_PP_SUCCESSOR_4160 4161
+#define RIOT_PP_SUCCESSOR_4161 4162
+#define RIOT_PP_SUCCESSOR_4162 4163
+#define RIOT_PP_SUCCESSOR_4163 4164
+#define RIOT_PP_SUCCESSOR_4164 4165
+#define RIOT_PP_SUCCESSOR_4165 4166
+#define RIOT_PP_SUCCESSOR_4166 4167
+#define RIOT_PP_SUCCESSOR_4167 4168
+#define RIOT_PP_SUCCESSOR_4168 4169
+#define RIOT_PP_SUCCESSOR_4169 4170
+#define RIOT_PP_SUCCESSOR_4170 4171
+#define RIOT_PP_SUCCESSOR_4171 4172
+#define RIOT_PP_SUCCESSOR_4172 4173
+#define RIOT_PP_SUCCESSOR_4173 4174
+#define RIOT_PP_SUCCESSOR_4174 4175
+#define RIOT_PP_SUCCESSOR_4175 4176
+#define RIOT_PP_SUCCESSOR_4176 4177
+#define RIOT_PP_SUCCESSOR_4177 4178
+#define RIOT_PP_SUCCESSOR_4178 4179
+#define RIOT_PP_SUCCESSOR_4179 4180
+#define RIOT_PP_SUCCESSOR_4180 4181
+#define RIOT_PP_SUCCESSOR_4181 4182
+#define RIOT_PP_SUCCESSOR_4182 4183
+#define RIOT_PP_SUCCESSOR_4183 4184
+#define RIOT_PP_SUCCESSOR_4184 4185
+#define RIOT_PP_SUCCESSOR_4185 4186
+#define RIOT_PP_SUCCESSOR_4186 4187
+#define RIOT_PP_SUCCESSOR_4187 4188
+#define RIOT_PP_SUCCESSOR_4188 4189
+#define RIOT_PP_SUCCESSOR_4189 4190
+#define RIOT_PP_SUCCESSOR_4190 4191
+#define RIOT_PP_SUCCESSOR_4191 4192
+#define RIOT_PP_SUCCESSOR_4192 4193
+#define RIOT_PP_SUCCESSOR_4193 4194
+#define RIOT_PP_SUCCESSOR_4194 4195
+#define RIOT_PP_SUCCESSOR_4195 4196
+#define RIOT_PP_SUCCESSOR_4196 4197
+#define RIOT_PP_SUCCESSOR_4197 4198
+#define RIOT_PP_SUCCESSOR_4198 4199
+#define RIOT_PP_SUCCESSOR_4199 4200
+#define RIOT_PP_SUCCESSOR_4200 4201
+#define RIOT_PP_SUCCESSOR_4201 4202
+#define RIOT_PP_SUCCESSOR_4202 4203
+#define RIOT_PP_SUCCESSOR_4203 4204
+#define RIOT_PP_SUCCESSOR_4204 4205
+#define RIOT_PP_SUCCESSOR_4205 4206
+#define RIOT_PP_SUCCESSOR_4206 4207
+#define RIOT_PP_SUCCESSOR_4207 4208
+#define RIOT_PP_SUCCESSOR_4208 4209
+#define RIOT_PP_SUCCESSOR_4209 4210
+#define RIOT_PP_SUCCESSOR_4210 4211
+#define RIOT_PP_SUCCESSOR_4211 4212
+#define RIOT_PP_SUCCESSOR_4212 4213
+#define RIOT_PP_SUCCESSOR_4213 4214
+#define RIOT_PP_SUCCESSOR_4214 4215
+#define RIOT_PP_SUCCESSOR_4215 4216
+#define RIOT_PP_SUCCESSOR_4216 4217
+#define RIOT_PP_SUCCESSOR_4217 4218
+#define RIOT_PP_SUCCESSOR_4218 4219
+#define RIOT_PP_SUCCESSOR_4219 4220
+#define RIOT_PP_SUCCESSOR_4220 4221
+#define RIOT_PP_SUCCESSOR_4221 4222
+#define RIOT_PP_SUCCESSOR_4222 4223
+#define RIOT_PP_SUCCESSOR_4223 4224
+#define RIOT_PP_SUCCESSOR_4224 4225
+#define RIOT_PP_SUCCESSOR_4225 4226
+#define RIOT_PP_SUCCESSOR_4226 4227
+#define RIOT_PP_SUCCESSOR_4227 4228
+#define RIOT_PP_SUCCESSOR_4228 4229
+#define RIOT_PP_SUCCESSOR_4229 4230
+#define RIOT_PP_SUCCESSOR_4230 4231
+#define RIOT_PP_SUCCESSOR_4231 4232
+#define RIOT_PP_SUCCESSOR_4232 4233
+#define RIOT_PP_SUCCESSOR_4233 4234
+#define RIOT_PP_SUCCESSOR_4234 4235
+#define RIOT_PP_SUCCESSOR_4235 4236
+#define RIOT_PP_SUCCESSOR_4236 4237
+#define RIOT_PP_SUCCESSOR_4237 4238
+#define RIOT_PP_SUCCESSOR_4238 4239
+#define RIOT_PP_SUCCESSOR_4239 4240
+#define RIOT_PP_SUCCESSOR_4240 4241
+#define RIOT_PP_SUCCESSOR_4241 4242
+#define RIOT_PP_SUCCESSOR_4242 4243
+#define RIOT_PP_SUCCESSOR_4243 4244
+#define RIOT_PP_SUCCESSOR_4244 4245
+#define RIOT_PP_SUCCESSOR_4245 4246
+#define RIOT_PP_SUCCESSOR_4246 4247
+#define RIOT_PP_SUCCESSOR_4247 4248
+#define RIOT_PP_SUCCESSOR_4248 4249
+#define RIOT_PP_SUCCESSOR_4249 4250
+#define RIOT_PP_SUCCESSOR_4250 4251
+#define RIOT_PP_SUCCESSOR_4251 4252
+#define RIOT_PP_SUCCESSOR_4252 4253
+#define RIOT_PP_SUCCESSOR_4253 4254
+#define RIOT_PP_SUCCESSOR_4254 4255
+#define RIOT_PP_SUCCESSOR_4255 4256
+#define RIOT_PP_SUCCESSOR_4256 4257
+#define RIOT_PP_SUCCESSOR_4257 4258
+#define RIOT_PP_SUCCESSOR_4258 4259
+#define RIOT_PP_SUCCESSOR_4259 4260
+#define RIOT_PP_SUCCESSOR_4260 4261
+#define RIOT_PP_SUCCESSOR_4261 4262
+#define RIOT_PP_SUCCESSOR_4262 4263
+#define RIOT_PP_SUCCESSOR_4263 4264
+#define RIOT_PP_SUCCESSOR_4264 4265
+#define RIOT_PP_SUCCESSOR_4265 4266
+#define RIOT_PP_SUCCESSOR_4266 4267
+#define RIOT_PP_SUCCESSOR_4267 4268
+#define RIOT_PP_SUCCESSOR_4268 4269
+#define RIOT_PP_SUCCESSOR_4269 4270
+#define RIOT_PP_SUCCESSOR_4270 4271
+#define RIOT_PP_SUCCESSOR_4271 4272
+#define RIOT_PP_SUCCESSOR_4272 4273
+#define RIOT_PP_SUCCESSOR_4273 4274
+#define RIOT_PP_SUCCESSOR_4274 4275
+#define RIOT_PP_SUCCESSOR_4275 4276
+#define RIOT_PP_SUCCESSOR_4276 4277
+#define RIOT_PP_SUCCESSOR_4277 4278
+#define RIOT_PP_SUCCESSOR_4278 4279
+#define RIOT_PP_SUCCESSOR_4279 4280
+#define RIOT_PP_SUCCESSOR_4280 4281
+#define RIOT_PP_SUCCESSOR_4281 4282
+#define RIOT_PP_SUCCESSOR_4282 4283
+#define RIOT_PP_SUCCESSOR_4283 4284
+#define RIOT_PP_SUCCESSOR_4284 4285
+#define RIOT_PP_SUCCESSOR_4285 4286
+#define RIOT_PP_SUCCESSOR_4286 4287
+#define RIOT_PP_SUCCESSOR_4287 4288
+#define RIOT_PP_SUCCESSOR_4288 4289
+#define RIOT_PP_SUCCESSOR_4289 4290
+#define RIOT_PP_SUCCESSOR_4290 4291
+#define RIOT_PP_SUCCESSOR_4291 4292
+#define RIOT_PP_SUCCESSOR_4292 4293
+#define RIOT_PP_SUCCESSOR_4293 4294
+#define RIOT_PP_SUCCESSOR_4294 4295
+#define RIOT_PP_SUCCESSOR_4295 4296
+#define RIOT_PP_SUCCESSOR_4296 4297
+#define RIOT_PP_SUCCESSOR_4297 4298
+#define RIOT_PP_SUCCESSOR_4298 4299
+#define RIOT_PP_SUCCESSOR_4299 4300
+#define RIOT_PP_SUCCESSOR_4300 4301
+#define RIOT_PP_SUCCESSOR_4301 4302
+#define RIOT_PP_SUCCESSOR_4302 4303
+#define RIOT_PP_SUCCESSOR_4303 4304
+#define RIOT_PP_SUCCESSOR_4304 4305
+#define RIOT_PP_SUCCESSOR_4305 4306
+#define RIOT_PP_SUCCESSOR_4306 4307
+#define RIOT_PP_SUCCESSOR_4307 4308
+#define RIOT_PP_SUCCESSOR_4308 4309
+#define RIOT_PP_SUCCESSOR_4309 4310
+#define RIOT_PP_SUCCESSOR_4310 4311
+#define RIOT_PP_SUCCESSOR_4311 4312
+#define RIOT_PP_SUCCESSOR_4312 4313
+#define RIOT_PP_SUCCESSOR_4313 4314
+#define RIOT_PP_SUCCESSOR_4314 4315
+#define RIOT_PP_SUCCESSOR_4315 4316
+#define RIOT_PP_SUCCESSOR_4316 4317
+#define RIOT_PP_SUCCESSOR_4317 4318
+#define RIOT_PP_SUCCESSOR_4318 4319
+#define RIOT_PP_SUCCESSOR_4319 4320
+#define RIOT_PP_SUCCESSOR_4320 4321
+#define RIOT_PP_SUCCESSOR_4321 4322
+#define RIOT_PP_SUCCESSOR_4322 4323
+#define RIOT_PP_SUCCESSOR_4323 4324
+#define RIOT_PP_SUCCESSOR_4324 4325
+#define RIOT_PP_SUCCESSOR_4325 4326
+#define RIOT_PP_SUCCESSOR_4326 4327
+#define RIOT_PP_SUCCESSOR_4327 4328
+#define RIOT_PP_SUCCESSOR_4328 4329
+#define RIOT_PP_SUCCESSOR_4329 4330
+#define RIOT_PP_SUCCESSOR_4330 4331
+#define RIOT_PP_SUCCESSOR_4331 4332
+#define RIOT_PP_SUCCESSOR_4332 4333
+#define RIOT_PP_SUCCESSOR_4333 4334
+#define RIOT_PP_SUCCESSOR_4334 4335
+#define RIOT_PP_SUCCESSOR_4335 4336
+#define RIOT_PP_SUCCESSOR_4336 4337
+#define RIOT_PP_SUCCESSOR_4337 4338
+#define RIOT_PP_SUCCESSOR_4338 4339
+#define RIOT_PP_SUCCESSOR_4339 4340
+#define RIOT_PP_SUCCESSOR_4340 4341
+#define RIOT_PP_SUCCESSOR_4341 4342
+#define RIOT_PP_SUCCESSOR_4342 4343
+#define RIOT_PP_SUCCESSOR_4343 4344
+#define RIOT_PP_SUCCESSOR_4344 4345
+#define RIOT_PP_SUCCESSOR_4345 4346
+#define RIOT_PP_SUCCESSOR_4346 4347
+#define RIOT_PP_SUCCESSOR_4347 4348
+#define RIOT_PP_SUCCESSOR_4348 4349
+#define RIOT_PP_SUCCESSOR_4349 4350
+#define RIOT_PP_SUCCESSOR_4350 4351
+#define RIOT_PP_SUCCESSOR_4351 4352
+#define RIOT_PP_SUCCESSOR_4352 4353
+#define RIOT_PP_SUCCESSOR_4353 4354
+#define RIOT_PP_SUCCESSOR_4354 4355
+#define RIOT_PP_SUCCESSOR_4355 4356
+#define RIOT_PP_SUCCESSOR_4356 4357
+#define RIOT_PP_SUCCESSOR_4357 4358
+#define RIOT_PP_SUCCESSOR_4358 4359
+#define RIOT_PP_SUCCESSOR_4359 4360
+#define RIOT_PP_SUCCESSOR_4360 4361
+#define RIOT_PP_SUCCESSOR_4361 4362
+#define RIOT_PP_SUCCESSOR_4362 4363
+#define RIOT_PP_SUCCESSOR_4363 4364
+#define RIOT_PP_SUCCESSOR_4364 4365
+#define RIOT_PP_SUCCESSOR_4365 4366
+#define RIOT_PP_SUCCESSOR_4366 4367
+#define RIOT_PP_SUCCESSOR_4367 4368
+#define RIOT_PP_SUCCESSOR_4368 4369
+#define RIOT_PP_SUCCESSOR_4369 4370
+#define RIOT_PP_SUCCESSOR_4370 4371
+#define RIOT_PP_SUCCESSOR_4371 4372
+#define RIOT_PP_SUCCESSOR_4372 4373
+#define RIOT_PP_SUCCESSOR_4373 4374
+#define RIOT_PP_SUCCESSOR_4374 4375
+#define RIOT_PP_SUCCESSOR_4375 4376
+#define RIOT_PP_SUCCESSOR_4376 4377
+#define RIOT_PP_SUCCESSOR_4377 4378
+#define RIOT_PP_SUCCESSOR_4378 4379
+#define RIOT_PP_SUCCESSOR_4379 4380
+#define RIOT_PP_SUCCESSOR_4380 4381
+#define RIOT_PP_SUCCESSOR_4381 4382
+#define RIOT_PP_SUCCESSOR_4382 4383
+#define RIOT_PP_SUCCESSOR_4383 4384
+#define RIOT_PP_SUCCESSOR_4384 4385
+#define RIOT_PP_SUCCESSOR_4385 4386
+#define RIOT_PP_SUCCESSOR_4386 4387
+#define RIOT_PP_SUCCESSOR_4387 4388
+#define RIOT_PP_SUCCESSOR_4388 4389
+#define RIOT_PP_SUCCESSOR_4389 4390
+#define RIOT_PP_SUCCESSOR_4390 4391
+#define RIOT_PP_SUCCESSOR_4391 4392
+#define RIOT_PP_SUCCESSOR_4392 4393
+#define RIOT_PP_SUCCESSOR_4393 4394
+#define RIOT_PP_SUCCESSOR_4394 4395
+#define RIOT_PP_SUCCESSOR_4395 4396
+#define RIOT_PP_SUCCESSOR_4396 4397
+#define RIOT_PP_SUCCESSOR_4397 4398
+#define RIOT_PP_SUCCESSOR_4398 4399
+#define RIOT_PP_SUCCESSOR_4399 4400
+#define RIOT_PP_SUCCESSOR_4400 4401
+#define RIOT_PP_SUCCESSOR_4401 4402
+#define RIOT_PP_SUCCESSOR_4402 4403
+#define RIOT_PP_SUCCESSOR_4403 4404
+#define RIOT_PP_SUCCESSOR_4404 4405
+#define RIOT_PP_SUCCESSOR_4405 4406
+#define RIOT_PP_SUCCESSOR_4406 4407
+#define RIOT_PP_SUCCESSOR_4407 4408
+#define RIOT_PP_SUCCESSOR_4408 4409
+#define RIOT_PP_SUCCESSOR_4409 4410
+#define RIOT_PP_SUCCESSOR_4410 4411
+#define RIOT_PP_SUCCESSOR_4411 4412
+#define RIOT_PP_SUCCESSOR_4412 4413
+#define RIOT_PP_SUCCESSOR_4413 4414
+#define RIOT_PP_SUCCESSOR_4414 4415
+#define RIOT_PP_SUCCESSOR_4415 4416
+#define RIOT_PP_SUCCESSOR_4416 4417
+#define RIOT_PP_SUCCESSOR_4417 4418
+#define RIOT_PP_SUCCESSOR_4418 4419
+#define RIOT_PP_SUCCESSOR_4419 4420
+#define RIOT_PP_SUCCESSOR_4420 4421
+#define RIOT_PP_SUCCESSOR_4421 4422
+#define RIOT_PP_SUCCESSOR_4422 4423
+#define RIOT_PP_SUCCESSOR_4423 4424
+#define RIOT_PP_SUCCESSOR_4424 4425
+#define RIOT_PP_SUCCESSOR_4425 4426
+#define RIOT_PP_SUCCESSOR_4426 4427
+#define RIOT_PP_SUCCESSOR_4427 4428
+#define RIOT_PP_SUCCESSOR_4428 4429
+#define RIOT_PP_SUCCESSOR_4429 4430
+#define RIOT_PP_SUCCESSOR_4430 4431
+#define RIOT_PP_SUCCESSOR_4431 4432
+#define RIOT_PP_SUCCESSOR_4432 4433
+#define RIOT_PP_SUCCESSOR_4433 4434
+#define RIOT_PP_SUCCESSOR_4434 4435
+#define RIOT_PP_SUCCESSOR_4435 4436
+#define RIOT_PP_SUCCESSOR_4436 4437
+#define RIOT_PP_SUCCESSOR_4437 4438
+#define RIOT_PP_SUCCESSOR_4438 4439
+#define RIOT_PP_SUCCESSOR_4439 4440
+#define RIOT_PP_SUCCESSOR_4440 4441
+#define RIOT_PP_SUCCESSOR_4441 4442
+#define RIOT_PP_SUCCESSOR_4442 4443
+#define RIOT_PP_SUCCESSOR_4443 4444
+#define RIOT_PP_SUCCESSOR_4444 4445
+#define RIOT_PP_SUCCESSOR_4445 4446
+#define RIOT_PP_SUCCESSOR_4446 4447
+#define RIOT_PP_SUCCESSOR_4447 4448
+#define RIOT_PP_SUCCESSOR_4448 4449
+#define RIOT_PP_SUCCESSOR_4449 4450
+#define RIOT_PP_SUCCESSOR_4450 4451
+#define RIOT_PP_SUCCESSOR_4451 4452
+#define RIOT_PP_SUCCESSOR_4452 4453
+#define RIOT_PP_SUCCESSOR_4453 4454
+#define RIOT_PP_SUCCESSOR_4454 4455
+#define RIOT_PP_SUCCESSOR_4455 4456
+#define RIOT_PP_SUCCESSOR_4456 4457
+#define RIOT_PP_SUCCESSOR_4457 4458
+#define RIOT_PP_SUCCESSOR_4458 4459
+#define RIOT_PP_SUCCESSOR_4459 4460
+#define RIOT_PP_SUCCESSOR_4460 4461
+#define RIOT_PP_SUCCESSOR_4461 4462
+#define RIOT_PP_SUCCESSOR_4462 4463
+#define RIOT_PP_SUCCESSOR_4463 4464
+#define RIOT_PP_SUCCESSOR_4464 4465
+#define RIOT_PP_SUCCESSOR_4465 4466
+#define RIOT_PP_SUCCESSOR_4466 4467
+#define RIOT_PP_SUCCESSOR_4467 4468
+#define RIOT_PP_SUCCESSOR_4468 4469
+#define RIOT_PP_SUCCESSOR_4469 4470
+#define RIOT_PP_SUCCESSOR_4470 4471
+#define RIOT_PP_SUCCESSOR_4471 4472
+#define RIOT_PP_SUCCESSOR_4472 4473
+#define RIOT_PP_SUCCESSOR_4473 4474
+#define RIOT_PP_SUCCESSOR_4474 4475
+#define RIOT_PP_SUCCESSOR_4475 4476
+#define RIOT_PP_SUCCESSOR_4476 4477
+#define RIOT_PP_SUCCESSOR_4477 4478
+#define RIOT_PP_SUCCESSOR_4478 4479
+#define RIOT_PP_SUCCESSOR_4479 4480
+#define RIOT_PP_SUCCESSOR_4480 4481
+#define RIOT_PP_SUCCESSOR_4481 4482
+#define RIOT_PP_SUCCESSOR_4482 4483
+#define RIOT_PP_SUCCESSOR_4483 4484
+#define RIOT_PP_SUCCESSOR_4484 4485
+#define RIOT_PP_SUCCESSOR_4485 4486
+#define RIOT_PP_SUCCESSOR_4486 4487
+#define RIOT_PP_SUCCESSOR_4487 4488
+#define RIOT_PP_SUCCESSOR_4488 4489
+#define RIOT_PP_SUCCESSOR_4489 4490
+#define RIOT_PP_SUCCESSOR_4490 4491
+#define RIOT_PP_SUCCESSOR_4491 4492
+#define RIOT_PP_SUCCESSOR_4492 4493
+#define RIOT_PP_SUCCESSOR_4493 4494
+#define RIOT_PP_SUCCESSOR_4494 4495
+#define RIOT_PP_SUCCESSOR_4495 4496
+#define RIOT_PP_SUCCESSOR_4496 4497
+#define RIOT_PP_SUCCESSOR_4497 4498
+#define RIOT_PP_SUCCESSOR_4498 4499
+#define RIOT_PP_SUCCESSOR_4499 4500
+#define RIOT_PP_SUCCESSOR_4500 4501
+#define RIOT_PP_SUCCESSOR_4501 4502
+#define RIOT_PP_SUCCESSOR_4502 4503
+#define RIOT_PP_SUCCESSOR_4503 4504
+#define RIOT_PP_SUCCESSOR_4504 4505
+#define RIOT_PP_SUCCESSOR_4505 4506
+#define RIOT_PP_SUCCESSOR_4506 4507
+#define RIOT_PP_SUCCESSOR_4507 4508
+#define RIOT_PP_SUCCESSOR_4508 4509
+#define RIOT_PP_SUCCESSOR_4509 4510
+#define RIOT_PP_SUCCESSOR_4510 4511
+#define RIOT_PP_SUCCESSOR_4511 4512
+#define RIOT_PP_SUCCESSOR_4512 4513
+#define RIOT_PP_SUCCESSOR_4513 4514
+#define RIOT_PP_SUCCESSOR_4514 4515
+#define RIOT_PP_SUCCESSOR_4515 4516
+#define RIOT_PP_SUCCESSOR_4516 4517
+#define RIOT_PP_SUCCESSOR_4517 4518
+#define RIOT_PP_SUCCESSOR_4518 4519
+#define RIOT_PP_SUCCESSOR_4519 4520
+#define RIOT_PP_SUCCESSOR_4520 4521
+#define RIOT_PP_SUCCESSOR_4521 4522
+#define RIOT_PP_SUCCESSOR_4522 4523
+#define RIOT_PP_SUCCESSOR_4523 4524
+#define RIOT_PP_SUCCESSOR_4524 4525
+#define RIOT_PP_SUCCESSOR_4525 4526
+#define RIOT_PP_SUCCESSOR_4526 4527
+#define RIOT_PP_SUCCESSOR_4527 4528
+#define RIOT_PP_SUCCESSOR_4528 4529
+#define RIOT_PP_SUCCESSOR_4529 4530
+#define RIOT_PP_SUCCESSOR_4530 4531
+#define RIOT_PP_SUCCESSOR_4531 4532
+#define RIOT_PP_SUCCESSOR_4532 4533
+#define RIOT_PP_SUCCESSOR_4533 4534
+#define RIOT_PP_SUCCESSOR_4534 4535
+#define RIOT_PP_SUCCESSOR_4535 4536
+#define RIOT_PP_SUCCESSOR_4536 4537
+#define RIOT_PP_SUCCESSOR_4537 4538
+#define RIOT_PP_SUCCESSOR_4538 4539
+#define RIOT_PP_SUCCESSOR_4539 4540
+#define RIOT_PP_SUCCESSOR_4540 4541
+#define RIOT_PP_SUCCESSOR_4541 4542
+#define RIOT_PP_SUCCESSOR_4542 4543
+#define RIOT_PP_SUCCESSOR_4543 4544
+#define RIOT_PP_SUCCESSOR_4544 4545
+#define RIOT_PP_SUCCESSOR_4545 4546
+#define RIOT_PP_SUCCESSOR_4546 4547
+#define RIOT_PP_SUCCESSOR_4547 4548
+#define RIOT_PP_SUCCESSOR_4548 4549
+#define RIOT_PP_SUCCESSOR_4549 4550
+#define RIOT_PP_SUCCESSOR_4550 4551
+#define RIOT_PP_SUCCESSOR_4551 4552
+#define RIOT_PP_SUCCESSOR_4552 4553
+#define RIOT_PP_SUCCESSOR_4553 4554
+#define RIOT_PP_SUCCESSOR_4554 4555
+#define RIOT_PP_SUCCESSOR_4555 4556
+#define RIOT_PP_SUCCESSOR_4556 4557
+#define RIOT_PP_SUCCESSOR_4557 4558
+#define RIOT_PP_SUCCESSOR_4558 4559
+#define RIOT_PP_SUCCESSOR_4559 4560
+#define RIOT_PP_SUCCESSOR_4560 4561
+#define RIOT_PP_SUCCESSOR_4561 4562
+#define RIOT_PP_SUCCESSOR_4562 4563
+#define RIOT_PP_SUCCESSOR_4563 4564
+#define RIOT_PP_SUCCESSOR_4564 4565
+#define RIOT_PP_SUCCESSOR_4565 4566
+#define RIOT_PP_SUCCESSOR_4566 4567
+#define RIOT_PP_SUCCESSOR_4567 4568
+#define RIOT_PP_SUCCESSOR_4568 4569
+#define RIOT_PP_SUCCESSOR_4569 4570
+#define RIOT_PP_SUCCESSOR_4570 4571
+#define RIOT_PP_SUCCESSOR_4571 4572
+#define RIOT_PP_SUCCESSOR_4572 4573
+#define RIOT_PP_SUCCESSOR_4573 4574
+#define RIOT_PP_SUCCESSOR_4574 4575
+#define RIOT_PP_SUCCESSOR_4575 4576
+#define RIOT_PP_SUCCESSOR_4576 4577
+#define RIOT_PP_SUCCESSOR_4577 4578
+#define RIOT_PP_SUCCESSOR_4578 4579
+#define RIOT_PP_SUCCESSOR_4579 4580
+#define RIOT_PP_SUCCESSOR_4580 4581
+#define RIOT_PP_SUCCESSOR_4581 4582
+#define RIOT_PP_SUCCESSOR_4582 4583
+#define RIOT_PP_SUCCESSOR_4583 4584
+#define RIOT_PP_SUCCESSOR_4584 4585
+#define RIOT_PP_SUCCESSOR_4585 4586
+#define RIOT_PP_SUCCESSOR_4586 4587
+#define RIOT_PP_SUCCESSOR_4587 4588
+#define RIOT_PP_SUCCESSOR_4588 4589
+#define RIOT_PP_SUCCESSOR_4589 4590
+#define RIOT_PP_SUCCESSOR_4590 4591
+#define RIOT_PP_SUCCESSOR_4591 4592
+#define RIOT_PP_SUCCESSOR_4592 4593
+#define RIOT_PP_SUCCESSOR_4593 4594
+#define RIOT_PP_SUCCESSOR_4594 4595
+#define RIOT_PP_SUCCESSOR_4595 4596
+#define RIOT_PP_SUCCESSOR_4596 4597
+#define RIOT_PP_SUCCESSOR_4597 4598
+#define RIOT_PP_SUCCESSOR_4598 4599
+#define RIOT_PP_SUCCESSOR_4599 4600
+#define RIOT_PP_SUCCESSOR_4600 4601
+#define RIOT_PP_SUCCESSOR_4601 4602
+#define RIOT_PP_SUCCESSOR_4602 4603
+#define RIOT_PP_SUCCESSOR_4603 4604
+#define RIOT_PP_SUCCESSOR_4604 4605
+#define RIOT_PP_SUCCESSOR_4605 4606
+#define RIOT_PP_SUCCESSOR_4606 4607
+#define RIOT_PP_SUCCESSOR_4607 4608
+#define RIOT_PP_SUCCESSOR_4608 4609
+#define RIOT_PP_SUCCESSOR_4609 4610
+#define RIOT_PP_SUCCESSOR_4610 4611
+#define RIOT_PP_SUCCESSOR_4611 4612
+#define RIOT_PP_SUCCESSOR_4612 4613
+#define RIOT_PP_SUCCESSOR_4613 4614
+#define RIOT_PP_SUCCESSOR_4614 4615
+#define RIOT_PP_SUCCESSOR_4615 4616
+#define RIOT_PP_SUCCESSOR_4616 4617
+#define RIOT_PP_SUCCESSOR_4617 4618
+#define RIOT_PP_SUCCESSOR_4618 4619
+#define RIOT_PP_SUCCESSOR_4619 4620
+#define RIOT_PP_SUCCESSOR_4620 4621
+#define RIOT_PP_SUCCESSOR_4621 4622
+#define RIOT_PP_SUCCESSOR_4622 4623
+#define RIOT_PP_SUCCESSOR_4623 4624
+#define RIOT_PP_SUCCESSOR_4624 4625
+#define RIOT_PP_SUCCESSOR_4625 4626
+#define RIOT_PP_SUCCESSOR_4626 4627
+#define RIOT_PP_SUCCESSOR_4627 4628
+#define RIOT_PP_SUCCESSOR_4628 4629
+#define RIOT_PP_SUCCESSOR_4629 4630
+#define RIOT_PP_SUCCESSOR_4630 4631
+#define RIOT_PP_SUCCESSOR_4631 4632
+#define RIOT_PP_SUCCESSOR_4632 4633
+#define RIOT_PP_SUCCESSOR_4633 4634
+#define RIOT_PP_SUCCESSOR_4634 4635
+#define RIOT_PP_SUCCESSOR_4635 4636
+#define RIOT_PP_SUCCESSOR_4636 4637
+#define RIOT_PP_SUCCESSOR_4637 4638
+#define RIOT_PP_SUCCESSOR_4638 4639
+#define RIOT_PP_SUCCESSOR_4639 4640
+#define RIOT_PP_SUCCESSOR_4640 4641
+#define RIOT_PP_SUCCESSOR_4641 4642
+#define RIOT_PP_SUCCESSOR_4642 4643
+#define RIOT_PP_SUCCESSOR_4643 4644
+#define RIOT_PP_SUCCESSOR_4644 4645
+#define RIOT_PP_SUCCESSOR_4645 4646
+#define RIOT_PP_SUCCESSOR_4646 4647
+#define RIOT_PP_SUCCESSOR_4647 4648
+#define RIOT_PP_SUCCESSOR_4648 4649
+#define RIOT_PP_SUCCESSOR_4649 4650
+#define RIOT_PP_SUCCESSOR_4650 4651
+#define RIOT_PP_SUCCESSOR_4651 4652
+#define RIOT_PP_SUCCESSOR_4652 4653
+#define RIOT_PP_SUCCESSOR_4653 4654
+#define RIOT_PP_SUCCESSOR_4654 4655
+#define RIOT_PP_SUCCESSOR_4655 4656
+#define RIOT_PP_SUCCESSOR_4656 4657
+#define RIOT_PP_SUCCESSOR_4657 4658
+#define RIOT_PP_SUCCESSOR_4658 4659
+#define RIOT_PP_SUCCESSOR_4659 4660
+#define RIOT_PP_SUCCESSOR_4660 4661
+#define RIOT_PP_SUCCESSOR_4661 4662
+#define RIOT_PP_SUCCESSOR_4662 4663
+#define RIOT_PP_SUCCESSOR_4663 4664
+#define RIOT_PP_SUCCESSOR_4664 4665
+#define RIOT_PP_SUCCESSOR_4665 4666
+#define RIOT_PP_SUCCESSOR_4666 4667
+#define RIOT_PP_SUCCESSOR_4667 4668
+#define RIOT_PP_SUCCESSOR_4668 4669
+#define RIOT_PP_SUCCESSOR_4669 4670
+#define RIOT_PP_SUCCESSOR_4670 4671
+#define RIOT_PP_SUCCESSOR_4671 4672
+#define RIOT_PP_SUCCESSOR_4672 4673
+#define RIOT_PP_SUCCESSOR_4673 4674
+#define RIOT_PP_SUCCESSOR_4674 4675
+#define RIOT_PP_SUCCESSOR_4675 4676
+#define RIOT_PP_SUCCESSOR_4676 4677
+#define RIOT_PP_SUCCESSOR_4677 4678
+#define RIOT_PP_SUCCESSOR_4678 4679
+#define RIOT_PP_SUCCESSOR_4679 4680
+#define RIOT_PP_SUCCESSOR_4680 4681
+#define RIOT_PP_SUCCESSOR_4681 4682
+#define RIOT_PP_SUCCESSOR_4682 4683
+#define RIOT_PP_SUCCESSOR_4683 4684
+#define RIOT_PP_SUCCESSOR_4684 4685
+#define RIOT_PP_SUCCESSOR_4685 4686
+#define RIOT_PP_SUCCESSOR_4686 4687
+#define RIOT_PP_SUCCESSOR_4687 4688
+#define RIOT_PP_SUCCESSOR_4688 4689
+#define RIOT_PP_SUCCESSOR_4689 4690
+#define RIOT_PP_SUCCESSOR_4690 4691
+#define RIOT_PP_SUCCESSOR_4691 4692
+#define RIOT_PP_SUCCESSOR_4692 4693
+#define RIOT_PP_SUCCESSOR_4693 4694
+#define RIOT_PP_SUCCESSOR_4694 4695
+#define RIOT_PP_SUCCESSOR_4695 4696
+#define RIOT_PP_SUCCESSOR_4696 4697
+#define RIOT_PP_SUCCESSOR_4697 4698
+#define RIOT_PP_SUCCESSOR_4698 4699
+#define RIOT_PP_SUCCESSOR_4699 4700
+#define RIOT_PP_SUCCESSOR_4700 4701
+#define RIOT_PP_SUCCESSOR_4701 4702
+#define RIOT_PP_SUCCESSOR_4702 4703
+#define RIOT_PP_SUCCESSOR_4703 4704
+#define RIOT_PP_SUCCESSOR_4704 4705
+#define RIOT_PP_SUCCESSOR_4705 4706
+#define RIOT_PP_SUCCESSOR_4706 4707
+#define RIOT_PP_SUCCESSOR_4707 4708
+#define RIOT_PP_SUCCESSOR_4708 4709
+#define RIOT_PP_SUCCESSOR_4709 4710
+#define RIOT_PP_SUCCESSOR_4710 4711
+#define RIOT_PP_SUCCESSOR_4711 4712
+#define RIOT_PP_SUCCESSOR_4712 4713
+#define RIOT_PP_SUCCESSOR_4713 4714
+#define RIOT_PP_SUCCESSOR_4714 4715
+#define RIOT_PP_SUCCESSOR_4715 4716
+#define RIOT_PP_SUCCESSOR_4716 4717
+#define RIOT_PP_SUCCESSOR_4717 4718
+#define RIOT_PP_SUCCESSOR_4718 4719
+#define RIOT_PP_SUCCESSOR_4719 4720
+#define RIOT_PP_SUCCESSOR_4720 4721
+#define RIOT_PP_SUCCESSOR_4721 4722
+#define RIOT_PP_SUCCESSOR_4722 4723
+#define RIOT_PP_SUCCESSOR_4723 4724
+#define RIOT_PP_SUCCESSOR_4724 4725
+#define RIOT_PP_SUCCESSOR_4725 4726
+#define RIOT_PP_SUCCESSOR_4726 4727
+#define RIOT_PP_SUCCESSOR_4727 4728
+#define RIOT_PP_SUCCESSOR_4728 4729
+#define RIOT_PP_SUCCESSOR_4729 4730
+#define RIOT_PP_SUCCESSOR_4730 4731
+#define RIOT_PP_SUCCESSOR_4731 4732
+#define RIOT_PP_SUCCESSOR_4732 4733
+#define RIOT_PP_SUCCESSOR_4733 4734
+#define RIOT_PP_SUCCESSOR_4734 4735
+#define RIOT_PP_SUCCESSOR_4735 4736
+#define RIOT_PP_SUCCESSOR_4736 4737
+#define RIOT_PP_SUCCESSOR_4737 4738
+#define RIOT_PP_SUCCESSOR_4738 4739
+#define RIOT_PP_SUCCESSOR_4739 4740
+#define RIOT_PP_SUCCESSOR_4740 4741
+#define RIOT_PP_SUCCESSOR_4741 4742
+#define RIOT_PP_SUCCESSOR_4742 4743
+#define RIOT_PP_SUCCESSOR_4743 4744
+#define RIOT_PP_SUCCESSOR_4744 4745
+#define RIOT_PP_SUCCESSOR_4745 4746
+#define RIOT_PP_SUCCESSOR_4746 4747
+#define RIOT_PP_SUCCESSOR_4747 4748
+#define RIOT_PP_SUCCESSOR_4748 4749
+#define RIOT_PP_SUCCESSOR_4749 4750
+#define RIOT_PP_SUCCESSOR_4750 4751
+#define RIOT_PP_SUCCESSOR_4751 4752
+#define RIOT_PP_SUCCESSOR_4752 4753
+#define RIOT_PP_SUCCESSOR_4753 4754
+#define RIOT_PP_SUCCESSOR_4754 4755
+#define RIOT_PP_SUCCESSOR_4755 4756
+#define RIOT_PP_SUCCESSOR_4756 4757
+#define RIOT_PP_SUCCESSOR_4757 4758
+#define RIOT_PP_SUCCESSOR_4758 4759
+#define RIOT_PP_SUCCESSOR_4759 4760
+#define RIOT_PP_SUCCESSOR_4760 4761
+#define RIOT_PP_SUCCESSOR_4761 4762
+#define RIOT_PP_SUCCESSOR_4762 4763
+#define RIOT_PP_SUCCESSOR_4763 4764
+#define RIOT_PP_SUCCESSOR_4764 4765
+#define RIOT_PP_SUCCESSOR_4765 4766
+#define RIOT_PP_SUCCESSOR_4766 4767
+#define RIOT_PP_SUCCESSOR_4767 4768
+#define RIOT_PP_SUCCESSOR_4768 4769
+#define RIOT_PP_SUCCESSOR_4769 4770
+#define RIOT_PP_SUCCESSOR_4770 4771
+#define RIOT_PP_SUCCESSOR_4771 4772
+#define RIOT_PP_SUCCESSOR_4772 4773
+#define RIOT_PP_SUCCESSOR_4773 4774
+#define RIOT_PP_SUCCESSOR_4774 4775
+#define RIOT_PP_SUCCESSOR_4775 4776
+#define RIOT_PP_SUCCESSOR_4776 4777
+#define RIOT_PP_SUCCESSOR_4777 4778
+#define RIOT_PP_SUCCESSOR_4778 4779
+#define RIOT_PP_SUCCESSOR_4779 4780
+#define RIOT_PP_SUCCESSOR_4780 4781
+#define RIOT_PP_SUCCESSOR_4781 4782
+#define RIOT_PP_SUCCESSOR_4782 4783
+#define RIOT_PP_SUCCESSOR_4783 4784
+#define RIOT_PP_SUCCESSOR_4784 4785
+#define RIOT_PP_SUCCESSOR_4785 4786
+#define RIOT_PP_SUCCESSOR_4786 4787
+#define RIOT_PP_SUCCESSOR_4787 4788
+#define RIOT_PP_SUCCESSOR_4788 4789
+#define RIOT_PP_SUCCESSOR_4789 4790
+#define RIOT_PP_SUCCESSOR_4790 4791
+#define RIOT_PP_SUCCESSOR_4791 4792
+#define RIOT_PP_SUCCESSOR_4792 4793
+#define RIOT_PP_SUCCESSOR_4793 4794
+#define RIOT_PP_SUCCESSOR_4794 4795
+#define RIOT_PP_SUCCESSOR_4795 4796
+#define RIOT_PP_SUCCESSOR_4796 4797
+#define RIOT_PP_SUCCESSOR_4797 4798
+#define RIOT_PP_SUCCESSOR_4798 4799
+#define RIOT_PP_SUCCESSOR_4799 4800
+#define RIOT_PP_SUCCESSOR_4800 4801
+#define RIOT_PP_SUCCESSOR_4801 4802
+#define RIOT_PP_SUCCESSOR_4802 4803
+#define RIOT_PP_SUCCESSOR_4803 4804
+#define RIOT_PP_SUCCESSOR_4804 4805
+#define RIOT_PP_SUCCESSOR_4805 4806
+#define RIOT_PP_SUCCESSOR_4806 4807
+#define RIOT_PP_SUCCESSOR_4807 4808
+#define RIOT_PP_SUCCESSOR_4808 4809
+#define RIOT_PP_SUCCESSOR_4809 4810
+#define RIOT_PP_SUCCESSOR_4810 4811
+#define RIOT_PP_SUCCESSOR_4811 4812
+#define RIOT_PP_SUCCESSOR_4812 4813
+#define RIOT_PP_SUCCESSOR_4813 4814
+#define RIOT_PP_SUCCESSOR_4814 4815
+#define RIOT_PP_SUCCESSOR_4815 4816
+#define RIOT_PP_SUCCESSOR_4816 4817
+#define RIOT_PP_SUCCESSOR_4817 4818
+#define RIOT_PP_SUCCESSOR_4818 4819
+#define RIOT_PP_SUCCESSOR_4819 4820
+#define RIOT_PP_SUCCESSOR_4820 4821
+#define RIOT_PP_SUCCESSOR_4821 4822
+#define RIOT_PP_SUCCESSOR_4822 4823
+#define RIOT_PP_SUCCESSOR_4823 4824
+#define RIOT_PP_SUCCESSOR_4824 4825
+#define RIOT_PP_SUCCESSOR_4825 4826
+#define RIOT_PP_SUCCESSOR_4826 4827
+#define RIOT_PP_SUCCESSOR_4827 4828
+#define RIOT_PP_SUCCESSOR_4828 4829
+#define RIOT_PP_SUCCESSOR_4829 4830
+#define RIOT_PP_SUCCESSOR_4830 4831
+#define RIOT_PP_SUCCESSOR_4831 4832
+#define RIOT_PP_SUCCESSOR_4832 4833
+#define RIOT_PP_SUCCESSOR_4833 4834
+#define RIOT_PP_SUCCESSOR_4834 4835
+#define RIOT_PP_SUCCESSOR_4835 4836
+#define RIOT_PP_SUCCESSOR_4836 4837
+#define RIOT_PP_SUCCESSOR_4837 4838
+#define RIOT_PP_SUCCESSOR_4838 4839
+#define RIOT_PP_SUCCESSOR_4839 4840
+#define RIOT_PP_SUCCESSOR_4840 4841
+#define RIOT_PP_SUCCESSOR_4841 4842
+#define RIOT_PP_SUCCESSOR_4842 4843
+#define RIOT_PP_SUCCESSOR_4843 4844
+#define RIOT_PP_SUCCESSOR_4844 4845
+#define RIOT_PP_SUCCESSOR_4845 4846
+#define RIOT_PP_SUCCESSOR_4846 4847
+#define RIOT_PP_SUCCESSOR_4847 4848
+#define RIOT_PP_SUCCESSOR_4848 4849
+#define RIOT_PP_SUCCESSOR_4849 4850
+#define RIOT_PP_SUCCESSOR_4850 4851
+#define RIOT_PP_SUCCESSOR_4851 4852
+#define RIOT_PP_SUCCESSOR_4852 4853
+#define RIOT_PP_SUCCESSOR_4853 4854
+#define RIOT_PP_SUCCESSOR_4854 4855
+#define RIOT_PP_SUCCESSOR_4855 4856
+#define RIOT_PP_SUCCESSOR_4856 4857
+#define RIOT_PP_SUCCESSOR_4857 4858
+#define RIOT_PP_SUCCESSOR_4858 4859
+#define RIOT_PP_SUCCESSOR_4859 4860
+#define RIOT_PP_SUCCESSOR_4860 4861
+#define RIOT_PP_SUCCESSOR_4861 4862
+#define RIOT_PP_SUCCESSOR_4862 4863
+#define RIOT_PP_SUCCESSOR_4863 4864
+#define RIOT_PP_SUCCESSOR_4864 4865
+#define RIOT_PP_SUCCESSOR_4865 4866
+#define RIOT_PP_SUCCESSOR_4866 4867
+#define RIOT_PP_SUCCESSOR_4867 4868
+#define RIOT_PP_SUCCESSOR_4868 4869
+#define RIOT_PP_SUCCESSOR_4869 4870
+#define RIOT_PP_SUCCESSOR_4870 4871
+#define RIOT_PP_SUCCESSOR_4871 4872
+#define RIOT_PP_SUCCESSOR_4872 4873
+#define RIOT_PP_SUCCESSOR_4873 4874
+#define RIOT_PP_SUCCESSOR_4874 4875
+#define RIOT_PP_SUCCESSOR_4875 4876
+#define RIOT_PP_SUCCESSOR_4876 4877
+#define RIOT_PP_SUCCESSOR_4877 4878
+#define RIOT_PP_SUCCESSOR_4878 4879
+#define RIOT_PP_SUCCESSOR_4879 4880
+#define RIOT_PP_SUCCESSOR_4880 4881
+#define RIOT_PP_SUCCESSOR_4881 4882
+#define RIOT_PP_SUCCESSOR_4882 4883
+#define RIOT_PP_SUCCESSOR_4883 4884
+#define RIOT_PP_SUCCESSOR_4884 4885
+#define RIOT_PP_SUCCESSOR_4885 4886
+#define RIOT_PP_SUCCESSOR_4886 4887
+#define RIOT_PP_SUCCESSOR_4887 4888
+#define RIOT_PP_SUCCESSOR_4888 4889
+#define RIOT_PP_SUCCESSOR_4889 4890
+#define RIOT_PP_SUCCESSOR_4890 4891
+#define RIOT_PP_SUCCESSOR_4891 4892
+#define RIOT_PP_SUCCESSOR_4892 4893
+#define RIOT_PP_SUCCESSOR_4893 4894
+#define RIOT_PP_SUCCESSOR_4894 4895
+#define RIOT_PP_SUCCESSOR_4895 4896
+#define RIOT_PP_SUCCESSOR_4896 4897
+#define RIOT_PP_SUCCESSOR_4897 4898
+#define RIOT_PP_SUCCESSOR_4898 4899
+#define RIOT_PP_SUCCESSOR_4899 4900
+#define RIOT_PP_SUCCESSOR_4900 4901
+#define RIOT_PP_SUCCESSOR_4901 4902
+#define RIOT_PP_SUCCESSOR_4902 4903
+#define RIOT_PP_SUCCESSOR_4903 4904
+#define RIOT_PP_SUCCESSOR_4904 4905
+#define RIOT_PP_SUCCESSOR_4905 4906
+#define RIOT_PP_SUCCESSOR_4906 4907
+#define RIOT_PP_SUCCESSOR_4907 4908
+#define RIOT_PP_SUCCESSOR_4908 4909
+#define RIOT_PP_SUCCESSOR_4909 4910
+#define RIOT_PP_SUCCESSOR_4910 4911
+#define RIOT_PP_SUCCESSOR_4911 4912
+#define RIOT_PP_SUCCESSOR_4912 4913
+#define RIOT_PP_SUCCESSOR_4913 4914
+#define RIOT_PP_SUCCESSOR_4914 4915
+#define RIOT_PP_SUCCESSOR_4915 4916
+#define RIOT_PP_SUCCESSOR_4916 4917
+#define RIOT_PP_SUCCESSOR_4917 4918
+#define RIOT_PP_SUCCESSOR_4918 4919
+#define RIOT_PP_SUCCESSOR_4919 4920
+#define RIOT_PP_SUCCESSOR_4920 4921
+#define RIOT_PP_SUCCESSOR_4921 4922
+#define RIOT_PP_SUCCESSOR_4922 4923
+#define RIOT_PP_SUCCESSOR_4923 4924
+#define RIOT_PP_SUCCESSOR_4924 4925
+#define RIOT_PP_SUCCESSOR_4925 4926
+#define RIOT_PP_SUCCESSOR_4926 4927
+#define RIOT_PP_SUCCESSOR_4927 4928
+#define RIOT_PP_SUCCESSOR_4928 4929
+#define RIOT_PP_SUCCESSOR_4929 4930
+#define RIOT_PP_SUCCESSOR_4930 4931
+#define RIOT_PP_SUCCESSOR_4931 4932
+#define RIOT_PP_SUCCESSOR_4932 4933
+#define RIOT_PP_SUCCESSOR_4933 4934
+#define RIOT_PP_SUCCESSOR_4934 4935
+#define RIOT_PP_SUCCESSOR_4935 4936
+#define RIOT_PP_SUCCESSOR_4936 4937
+#define RIOT_PP_SUCCESSOR_4937 4938
+#define RIOT_PP_SUCCESSOR_4938 4939
+#define RIOT_PP_SUCCESSOR_4939 4940
+#define RIOT_PP_SUCCESSOR_4940 4941
+#define RIOT_PP_SUCCESSOR_4941 4942
+#define RIOT_PP_SUCCESSOR_4942 4943
+#define RIOT_PP_SUCCESSOR_4943 4944
+#define RIOT_PP_SUCCESSOR_4944 4945
+#define RIOT_PP_SUCCESSOR_4945 4946
+#define RIOT_PP_SUCCESSOR_4946 4947
+#define RIOT_PP_SUCCESSOR_4947 4948
+#define RIOT_PP_SUCCESSOR_4948 4949
+#define RIOT_PP_SUCCESSOR_4949 4950
+#define RIOT_PP_SUCCESSOR_4950 4951
+#define RIOT_PP_SUCCESSOR_4951 4952
+#define RIOT_PP_SUCCESSOR_4952 4953
+#define RIOT_PP_SUCCESSOR_4953 4954
+#define RIOT_PP_SUCCESSOR_4954 4955
+#define RIOT_PP_SUCCESSOR_4955 4956
+#define RIOT_PP_SUCCESSOR_4956 4957
+#define RIOT_PP_SUCCESSOR_4957 4958
+#define RIOT_PP_SUCCESSOR_4958 4959
+#define RIOT_PP_SUCCESSOR_4959 4960
+#define RIOT_PP_SUCCESSOR_4960 4961
+#define RIOT_PP_SUCCESSOR_4961 4962
+#define RIOT_PP_SUCCESSOR_4962 4963
+#define RIOT_PP_SUCCESSOR_4963 4964
+#define RIOT_PP_SUCCESSOR_4964 4965
+#define RIOT_PP_SUCCESSOR_4965 4966
+#define RIOT_PP_SUCCESSOR_4966 4967
+#define RIOT_PP_SUCCESSOR_4967 4968
+#define RIOT_PP_SUCCESSOR_4968 4969
+#define RIOT_PP_SUCCESSOR_4969 4970
+#define RIOT_PP_SUCCESSOR_4970 4971
+#define RIOT_PP_SUCCESSOR_4971 4972
+#define RIOT_PP_SUCCESSOR_4972 4973
+#define RIOT_PP_SUCCESSOR_4973 4974
+#define RIOT_PP_SUCCESSOR_4974 4975
+#define RIOT_PP_SUCCESSOR_4975 4976
+#define RIOT_PP_SUCCESSOR_4976 4977
+#define RIOT_PP_SUCCESSOR_4977 4978
+#define RIOT_PP_SUCCESSOR_4978 4979
+#define RIOT_PP_SUCCESSOR_4979 4980
+#define RIOT_PP_SUCCESSOR_4980 4981
+#define RIOT_PP_SUCCESSOR_4981 4982
+#define RIOT_PP_SUCCESSOR_4982 4983
+#define RIOT_PP_SUCCESSOR_4983 4984
+#define RIOT_PP_SUCCESSOR_4984 4985
+#define RIOT_PP_SUCCESSOR_4985 4986
+#define RIOT_PP_SUCCESSOR_4986 4987
+#define RIOT_PP_SUCCESSOR_4987 4988
+#define RIOT_PP_SUCCESSOR_4988 4989
+#define RIOT_PP_SUCCESSOR_4989 4990
+#define RIOT_PP_SUCCESSOR_4990 4991
+#define RIOT_PP_SUCCESSOR_4991 4992
+#define RIOT_PP_SUCCESSOR_4992 4993
+#define RIOT_PP_SUCCESSOR_4993 4994
+#define RIOT_PP_SUCCESSOR_4994 4995
+#define RIOT_PP_SUCCESSOR_4995 4996
+#define RIOT_PP_SUCCESSOR_4996 4997
+#define RIOT_PP_SUCCESSOR_4997 4998
+#define RIOT_PP_SUCCESSOR_4998 4999
+#define RIOT_PP_SUCCESSOR_4999 5000
+#define RIOT_PP_SUCCESSOR_5000 5001
+#define RIOT_PP_SUCCESSOR_5001 5002
+#define RIOT_PP_SUCCESSOR_5002 5003
+#define RIOT_PP_SUCCESSOR_5003 5004
+#define RIOT_PP_SUCCESSOR_5004 5005
+#define RIOT_PP_SUCCESSOR_5005 5006
+#define RIOT_PP_SUCCESSOR_5006 5007
+#define RIOT_PP_SUCCESSOR_5007 5008
+#define RIOT_PP_SUCCESSOR_5008 5009
+#define RIOT_PP_SUCCESSOR_5009 5010
+#define RIOT_PP_SUCCESSOR_5010 5011
+#define RIOT_PP_SUCCESSOR_5011 5012
+#define RIOT_PP_SUCCESSOR_5012 5013
+#define RIOT_PP_SUCCESSOR_5013 5014
+#define RIOT_PP_SUCCESSOR_5014 5015
+#define RIOT_PP_SUCCESSOR_5015 5016
+#define RIOT_PP_SUCCESSOR_5016 5017
+#define RIOT_PP_SUCCESSOR_5017 5018
+#define RIOT_PP_SUCCESSOR_5018 5019
+#define RIOT_PP_SUCCESSOR_5019 5020
+#define RIOT_PP_SUCCESSOR_5020 5021
+#define RIOT_PP_SUCCESSOR_5021 5022
+#define RIOT_PP_SUCCESSOR_5022 5023
+#define RIOT_PP_SUCCESSOR_5023 5024
+#define RIOT_PP_SUCCESSOR_5024 5025
+#define RIOT_PP_SUCCESSOR_5025 5026
+#define RIOT_PP_SUCCESSOR_5026 5027
+#define RIOT_PP_SUCCESSOR_5027 5028
+#define RIOT_PP_SUCCESSOR_5028 5029
+#define RIOT_PP_SUCCESSOR_5029 5030
+#define RIOT_PP_SUCCESSOR_5030 5031
+#define RIOT_PP_SUCCESSOR_5031 5032
+#define RIOT_PP_SUCCESSOR_5032 5033
+#define RIOT_PP_SUCCESSOR_5033 5034
+#define RIOT_PP_SUCCESSOR_5034 5035
+#define RIOT_PP_SUCCESSOR_5035 5036
+#define RIOT_PP_SUCCESSOR_5036 5037
+#define RIOT_PP_SUCCESSOR_5037 5038
+#define RIOT_PP_SUCCESSOR_5038 5039
+#define RIOT_PP_SUCCESSOR_5039 5040
+#define RIOT_PP_SUCCESSOR_5040 5041
+#define RIOT_PP_SUCCESSOR_5041 5042
+#define RIOT_PP_SUCCESSOR_5042 5043
+#define RIOT_PP_SUCCESSOR_5043 5044
+#define RIOT_PP_SUCCESSOR_5044 5045
+#define RIOT_PP_SUCCESSOR_5045 5046
+#define RIOT_PP_SUCCESSOR_5046 5047
+#define RIOT_PP_SUCCESSOR_5047 5048
+#define RIOT_PP_SUCCESSOR_5048 5049
+#define RIOT_PP_SUCCESSOR_5049 5050
+#define RIOT_PP_SUCCESSOR_5050 5051
+#define RIOT_PP_SUCCESSOR_5051 5052
+#define RIOT_PP_SUCCESSOR_5052 5053
+#define RIOT_PP_SUCCESSOR_5053 5054
+#define RIOT_PP_SUCCESSOR_5054 5055
+#define RIOT_PP_SUCCESSOR_5055 5056
+#define RIOT_PP_SUCCESSOR_5056 5057
+#define RIOT_PP_SUCCESSOR_5057 5058
+#define RIOT_PP_SUCCESSOR_5058 5059
+#define RIOT_PP_SUCCESSOR_5059 5060
+#define RIOT_PP_SUCCESSOR_5060 5061
+#define RIOT_PP_SUCCESSOR_5061 5062
+#define RIOT_PP_SUCCESSOR_5062 5063
+#define RIOT_PP_SUCCESSOR_5063 5064
+#define RIOT_PP_SUCCESSOR_5064 5065
+#define RIOT_PP_SUCCESSOR_5065 5066
+#define RIOT_PP_SUCCESSOR_5066 5067
+#define RIOT_PP_SUCCESSOR_5067 5068
+#define RIOT_PP_SUCCESSOR_5068 5069
+#define RIOT_PP_SUCCESSOR_5069 5070
+#define RIOT_PP_SUCCESSOR_5070 5071
+#define RIOT_PP_SUCCESSOR_5071 5072
+#define RIOT_PP_SUCCESSOR_5072 5073
+#define RIOT_PP_SUCCESSOR_5073 5074
+#define RIOT_PP_SUCCESSOR_5074 5075
+#define RIOT_PP_SUCCESSOR_5075 5076
+#define RIOT_PP_SUCCESSOR_5076 5077
+#define RIOT_PP_SUCCESSOR_5077 5078
+#define RIOT_PP_SUCCESSOR_5078 5079
+#define RIOT_PP_SUCCESSOR_5079 5080
+#define RIOT_PP_SUCCESSOR_5080 5081
+#define RIOT_PP_SUCCESSOR_5081 5082
+#define RIOT_PP_SUCCESSOR_5082 5083
+#define RIOT_PP_SUCCESSOR_5083 5084
+#define RIOT_PP_SUCCESSOR_5084 5085
+#define RIOT_PP_SUCCESSOR_5085 5086
+#define RIOT_PP_SUCCESSOR_5086 5087
+#define RIOT_PP_SUCCESSOR_5087 5088
+#define RIOT_PP_SUCCESSOR_5088 5089
+#define RIOT_PP_SUCCESSOR_5089 5090
+#define RIOT_PP_SUCCESSOR_5090 5091
+#define RIOT_PP_SUCCESSOR_5091 5092
+#define RIOT_PP_SUCCESSOR_5092 5093
+#define RIOT_PP_SUCCESSOR_5093 5094
+#define RIOT_PP_SUCCESSOR_5094 5095
+#define RIOT_PP_SUCCESSOR_5095 5096
+#define RIOT_PP_SUCCESSOR_5096 5097
+#define RIOT_PP_SUCCESSOR_5097 5098
+#define RIOT_PP_SUCCESSOR_5098 5099
+#define RIOT_PP_SUCCESSOR_5099 5100
+#define RIOT_PP_SUCCESSOR_5100 5101
+#define RIOT_PP_SUCCESSOR_5101 5102
+#define RIOT_PP_SUCCESSOR_5102 5103
+#define RIOT_PP_SUCCESSOR_5103 5104
+#define RIOT_PP_SUCCESSOR_5104 5105
+#define RIOT_PP_SUCCESSOR_5105 5106
+#define RIOT_PP_SUCCESSOR_5106 5107
+#define RIOT_PP_SUCCESSOR_5107 5108
+#define RIOT_PP_SUCCESSOR_5108 5109
+#define RIOT_PP_SUCCESSOR_5109 5110
+#define RIOT_PP_SUCCESSOR_5110 5111
+#define RIOT_PP_SUCCESSOR_5111 5112
+#define RIOT_PP_SUCCESSOR_5112 5113
+#define RIOT_PP_SUCCESSOR_5113 5114
+#define RIOT_PP_SUCCESSOR_5114 5115
+#define RIOT_PP_SUCCESSOR_5115 5116
+#define RIOT_PP_SUCCESSOR_5116 5117
+#define RIOT_PP_SUCCESSOR_5117 5118
+#define RIOT_PP_SUCCESSOR_5118 5119
+#define RIOT_PP_SUCCESSOR_5119 5120
+#define RIOT_PP_SUCCESSOR_5120 5121
+#define RIOT_PP_SUCCESSOR_5121 5122
+#define RIOT_PP_SUCCESSOR_5122 5123
+#define RIOT_PP_SUCCESSOR_5123 5124
+#define RIOT_PP_SUCCESSOR_5124 5125
+#define RIOT_PP_SUCCESSOR_5125 5126
+#define RIOT_PP_SUCCESSOR_5126 5127
+#define RIOT_PP_SUCCESSOR_5127 5128
+#define RIOT_PP_SUCCESSOR_5128 5129
+#define RIOT_PP_SUCCESSOR_5129 5130
+#define RIOT_PP_SUCCESSOR_5130 5131
+#define RIOT_PP_SUCCESSOR_5131 5132
+#define RIOT_PP_SUCCESSOR_5132 5133
+#define RIOT_PP_SUCCESSOR_5133 5134
+#define RIOT_PP_SUCCESSOR_5134 5135
+#define RIOT_PP_SUCCESSOR_5135 5136
+#define RIOT_PP_SUCCESSOR_5136 5137
+#define RIOT_PP_SUCCESSOR_5137 5138
+#define RIOT_PP_SUCCESSOR_5138 5139
+#define RIOT_PP_SUCCESSOR_5139 5140
+#define RIOT_PP_SUCCESSOR_5140 5141
+#define RIOT_PP_SUCCESSOR_5141 5142
+#define RIOT_PP_SUCCESSOR_5142 5143
+#define RIOT_PP_SUCCESSOR_5143 5144
+#define RIOT_PP_SUCCESSOR_5144 5145
+#define RIOT_PP_SUCCESSOR_5145 5146
+#define RIOT_PP_SUCCESSOR_5146 5147
+#define RIOT_PP_SUCCESSOR_5147 5148
+#define RIOT_PP_SUCCESSOR_5148 5149
+#define RIOT_PP_SUCCESSOR_5149 5150
+#define RIOT_PP_SUCCESSOR_5150 5151
+#define RIOT_PP_SUCCESSOR_5151 5152
+#define RIOT_PP_SUCCESSOR_5152 5153
+#define RIOT_PP_SUCCESSOR_5153 5154
+#define RIOT_PP_SUCCESSOR_5154 5155
+#define RIOT_PP_SUCCESSOR_5155 5156
+#define RIOT_PP_SUCCESSOR_5156 5157
+#define RIOT_PP_SUCCESSOR_5157 5158
+#define RIOT_PP_SUCCESSOR_5158 5159
+#define RIOT_PP_SUCCESSOR_5159 5160
+#define RIOT_PP_SUCCESSOR_5160 5161
+#define RIOT_PP_SUCCESSOR_5161 5162
+#define RIOT_PP_SUCCESSOR_5162 5163
+#define RIOT_PP_SUCCESSOR_5163 5164
+#define RIOT_PP_SUCCESSOR_5164 5165
+#define RIOT_PP_SUCCESSOR_5165 5166
+#define RIOT_PP_SUCCESSOR_5166 5167
+#define RIOT_PP_SUCCESSOR_5167 5168
+#define RIOT_PP_SUCCESSOR_5168 5169
+#define RIOT_PP_SUCCESSOR_5169 5170
+#define RIOT_PP_SUCCESSOR_5170 5171
+#define RIOT_PP_SUCCESSOR_5171 5172
+#define RIOT_PP_SUCCESSOR_5172 5173
+#define RIOT_PP_SUCCESSOR_5173 5174
+#define RIOT_PP_SUCCESSOR_5174 5175
+#define RIOT_PP_SUCCESSOR_5175 5176
+#define RIOT_PP_SUCCESSOR_5176 5177
+#define RIOT_PP_SUCCESSOR_5177 5178
+#define RIOT_PP_SUCCESSOR_5178 5179
+#define RIOT_PP_SUCCESSOR_5179 5180
+#define RIOT_PP_SUCCESSOR_5180 5181
+#define RIOT_PP_SUCCESSOR_5181 5182
+#define RIOT_PP_SUCCESSOR_5182 5183
+#define RIOT_PP_SUCCESSOR_5183 5184
+#define RIOT_PP_SUCCESSOR_5184 5185
+#define RIOT_PP_SUCCESSOR_5185 5186
+#define RIOT_PP_SUCCESSOR_5186 5187
+#define RIOT_PP_SUCCESSOR_5187 5188
+#define RIOT_PP_SUCCESSOR_5188 5189
+#define RIOT_PP_SUCCESSOR_5189 5190
+#define RIOT_PP_SUCCESSOR_5190 5191
+#define RIOT_PP_SUCCESSOR_5191 5192
+#define RIOT_PP_SUCCESSOR_5192 5193
+#define RIOT_PP_SUCCESSOR_5193 5194
+#define RIOT_PP_SUCCESSOR_5194 5195
+#define RIOT_PP_SUCCESSOR_5195 5196
+#define RIOT_PP_SUCCESSOR_5196 5197
+#define RIOT_PP_SUCCESSOR_5197 5198
+#define RIOT_PP_SUCCESSOR_5198 5199
+#define RIOT_PP_SUCCESSOR_5199 5200
+#define RIOT_PP_SUCCESSOR_5200 5201
+#define RIOT_PP_SUCCESSOR_5201 5202
+#define RIOT_PP_SUCCESSOR_5202 5203
+#define RIOT_PP_SUCCESSOR_5203 5204
+#define RIOT_PP_SUCCESSOR_5204 5205
+#define RIOT_PP_SUCCESSOR_5205 5206
+#define RIOT_PP_SUCCESSOR_5206 5207
+#define RIOT_PP_SUCCESSOR_5207 5208
+#define RIOT_PP_SUCCESSOR_5208 5209
+#define RIOT_PP_SUCCESSOR_5209 5210
+#define RIOT_PP_SUCCESSOR_5210 5211
+#define RIOT_PP_SUCCESSOR_5211 5212
+#define RIOT_PP_SUCCESSOR_5212 5213
+#define RIOT_PP_SUCCESSOR_5213 5214
+#define RIOT_PP_SUCCESSOR_5214 5215
+#define RIOT_PP_SUCCESSOR_5215 5216
+#define RIOT_PP_SUCCESSOR_5216 5217
+#define RIOT_PP_SUCCESSOR_5217 5218
+#define RIOT_PP_SUCCESSOR_5218 5219
+#define RIOT_PP_SUCCESSOR_5219 5220
+#define RIOT_PP_SUCCESSOR_5220 5221
+#define RIOT_PP_SUCCESSOR_5221 5222
+#define RIOT_PP_SUCCESSOR_5222 5223
+#define RIOT_PP_SUCCESSOR_5223 5224
+#define RIOT_PP_SUCCESSOR_5224 5225
+#define RIOT_PP_SUCCESSOR_5225 5226
+#define RIOT_PP_SUCCESSOR_5226 5227
+#define RIOT_PP_SUCCESSOR_5227 5228
+#define RIOT_PP_SUCCESSOR_5228 5229
+#define RIOT_PP_SUCCESSOR_5229 5230
+#define RIOT_PP_SUCCESSOR_5230 5231
+#define RIOT_PP_SUCCESSOR_5231 5232
+#define RIOT_PP_SUCCESSOR_5232 5233
+#define RIOT_PP_SUCCESSOR_5233 5234
+#define RIOT_PP_SUCCESSOR_5234 5235
+#define RIOT_PP_SUCCESSOR_5235 5236
+#define RIOT_PP_SUCCESSOR_5236 5237
+#define RIOT_PP_SUCCESSOR_5237 5238
+#define RIOT_PP_SUCCESSOR_5238 5239
+#define RIOT_PP_SUCCESSOR_5239 5240
+#define RIOT_PP_SUCCESSOR_5240 5241
+#define RIOT_PP_SUCCESSOR_5241 5242
+#define RIOT_PP_SUCCESSOR_5242 5243
+#define RIOT_PP_SUCCESSOR_5243 5244
+#define RIOT_PP_SUCCESSOR_5244 5245
+#define RIOT_PP_SUCCESSOR_5245 5246
+#define RIOT_PP_SUCCESSOR_5246 5247
+#define RIOT_PP_SUCCESSOR_5247 5248
+#define RIOT_PP_SUCCESSOR_5248 5249
+#define RIOT_PP_SUCCESSOR_5249 5250
+#define RIOT_PP_SUCCESSOR_5250 5251
+#define RIOT_PP_SUCCESSOR_5251 5252
+#define RIOT_PP_SUCCESSOR_5252 5253
+#define RIOT_PP_SUCCESSOR_5253 5254
+#define RIOT_PP_SUCCESSOR_5254 5255
+#define RIOT_PP_SUCCESSOR_5255 5256
+#define RIOT_PP_SUCCESSOR_5256 5257
+#define RIOT_PP_SUCCESSOR_5257 5258
+#define RIOT_PP_SUCCESSOR_5258 5259
+#define RIOT_PP_SUCCESSOR_5259 5260
+#define RIOT_PP_SUCCESSOR_5260 5261
+#define RIOT_PP_SUCCESSOR_5261 5262
+#define RIOT_PP_SUCCESSOR_5262 5263
+#define RIOT_PP_SUCCESSOR_5263 5264
+#define RIOT_PP_SUCCESSOR_5264 5265
+#define RIOT_PP_SUCCESSOR_5265 5266
+#define RIOT_PP_SUCCESSOR_5266 5267
+#define RIOT_PP_SUCCESSOR_5267 5268
+#define RIOT_PP_SUCCESSOR_5268 5269
+#define RIOT_PP_SUCCESSOR_5269 5270
+#define RIOT_PP_SUCCESSOR_5270 5271
+#define RIOT_PP_SUCCESSOR_5271 5272
+#define RIOT_PP_SUCCESSOR_5272 5273
+#define RIOT_PP_SUCCESSOR_5273 5274
+#define RIOT_PP_SUCCESSOR_5274 5275
+#define RIOT_PP_SUCCESSOR_5275 5276
+#define RIOT_PP_SUCCESSOR_5276 5277
+#define RIOT_PP_SUCCESSOR_5277 5278
+#define RIOT_PP_SUCCESSOR_5278 5279
+#define RIOT_PP_SUCCESSOR_5279 5280
+#define RIOT_PP_SUCCESSOR_5280 5281
+#define RIOT_PP_SUCCESSOR_5281 5282
+#define RIOT_PP_SUCCESSOR_5282 5283
+#define RIOT_PP_SUCCESSOR_5283 5284
+#define RIOT_PP_SUCCESSOR_5284 5285
+#define RIOT_PP_SUCCESSOR_5285 5286
+#define RIOT_PP_SUCCESSOR_5286 5287
+#define RIOT_PP_SUCCESSOR_5287 5288
+#define RIOT_PP_SUCCESSOR_5288 5289
+#define RIOT_PP_SUCCESSOR_5289 5290
+#define RIOT_PP_SUCCESSOR_5290 5291
+#define RIOT_PP_SUCCESSOR_5291 5292
+#define RIOT_PP_SUCCESSOR_5292 5293
+#define RIOT_PP_SUCCESSOR_5293 5294
+#define RIOT_PP_SUCCESSOR_5294 5295
+#define RIOT_PP_SUCCESSOR_5295 5296
+#define RIOT_PP_SUCCESSOR_5296 5297
+#define RIOT_PP_SUCCESSOR_5297 5298
+#define RIOT_PP_SUCCESSOR_5298 5299
+#define RIOT_PP_SUCCESSOR_5299 5300
+#define RIOT_PP_SUCCESSOR_5300 5301
+#define RIOT_PP_SUCCESSOR_5301 5302
+#define RIOT_PP_SUCCESSOR_5302 5303
+#define RIOT_PP_SUCCESSOR_5303 5304
+#define RIOT_PP_SUCCESSOR_5304 5305
+#define RIOT_PP_SUCCESSOR_5305 5306
+#define RIOT_PP_SUCCESSOR_5306 5307
+#define RIOT_PP_SUCCESSOR_5307 5308
+#define RIOT_PP_SUCCESSOR_5308 5309
+#define RIOT_PP_SUCCESSOR_5309 5310
+#define RIOT_PP_SUCCESSOR_5310 5311
+#define RIOT_PP_SUCCESSOR_5311 5312
+#define RIOT_PP_SUCCESSOR_5312 5313
+#define RIOT_PP_SUCCESSOR_5313 5314
+#define RIOT_PP_SUCCESSOR_5314 5315
+#define RIOT_PP_SUCCESSOR_5315 5316
+#define RIOT_PP_SUCCESSOR_5316 5317
+#define RIOT_PP_SUCCESSOR_5317 5318
+#define RIOT_PP_SUCCESSOR_5318 5319
+#define RIOT_PP_SUCCESSOR_5319 5320
+#define RIOT_PP_SUCCESSOR_5320 5321
+#define RIOT_PP_SUCCESSOR_5321 5322
+#define RIOT_PP_SUCCESSOR_5322 5323
+#define RIOT_PP_SUCCESSOR_5323 5324
+#define RIOT_PP_SUCCESSOR_5324 5325
+#define RIOT_PP_SUCCESSOR_5325 5326
+#define RIOT_PP_SUCCESSOR_5326 5327
+#define RIOT_PP_SUCCESSOR_5327 5328
+#define RIOT_PP_SUCCESSOR_5328 5329
+#define RIOT_PP_SUCCESSOR_5329 5330
+#define RIOT_PP_SUCCESSOR_5330 5331
+#define RIOT_PP_SUCCESSOR_5331 5332
+#define RIOT_PP_SUCCESSOR_5332 5333
+#define RIOT_PP_SUCCESSOR_5333 5334
+#define RIOT_PP_SUCCESSOR_5334 5335
+#define RIOT_PP_SUCCESSOR_5335 5336
+#define RIOT_PP_SUCCESSOR_5336 5337
+#define RIOT_PP_SUCCESSOR_5337 5338
+#define RIOT_PP_SUCCESSOR_5338 5339
+#define RIOT_PP_SUCCESSOR_5339 5340
+#define RIOT_PP_SUCCESSOR_5340 5341
+#define RIOT_PP_SUCCESSOR_5341 5342
+#define RIOT_PP_SUCCESSOR_5342 5343
+#define RIOT_PP_SUCCESSOR_5343 5344
+#define RIOT_PP_SUCCESSOR_5344 5345
+#define RIOT_PP_SUCCESSOR_5345 5346
+#define RIOT_PP_SUCCESSOR_5346 5347
+#define RIOT_PP_SUCCESSOR_5347 5348
+#define RIOT_PP_SUCCESSOR_5348 5349
+#define RIOT_PP_SUCCESSOR_5349 5350
+#define RIOT_PP_SUCCESSOR_5350 5351
+#define RIOT_PP_SUCCESSOR_5351 5352
+#define RIOT_PP_SUCCESSOR_5352 5353
+#define RIOT_PP_SUCCESSOR_5353 5354
+#define RIOT_PP_SUCCESSOR_5354 5355
+#define RIOT_PP_SUCCESSOR_5355 5356
+#define RIOT_PP_SUCCESSOR_5356 5357
+#define RIOT_PP_SUCCESSOR_5357 5358
+#define RIOT_PP_SUCCESSOR_5358 5359
+#define RIOT_PP_SUCCESSOR_5359 5360
+#define RIOT_PP_SUCCESSOR_5360 5361
+#define RIOT_PP_SUCCESSOR_5361 5362
+#define RIOT_PP_SUCCESSOR_5362 5363
+#define RIOT_PP_SUCCESSOR_5363 5364
+#define RIOT_PP_SUCCESSOR_5364 5365
+#define RIOT_PP_SUCCESSOR_5365 5366
+#define RIOT_PP_SUCCESSOR_5366 5367
+#define RIOT_PP_SUCCESSOR_5367 5368
+#define RIOT_PP_SUCCESSOR_5368 5369
+#define RIOT_PP_SUCCESSOR_5369 5370
+#define RIOT_PP_SUCCESSOR_5370 5371
+#define RIOT_PP_SUCCESSOR_5371 5372
+#define RIOT_PP_SUCCESSOR_5372 5373
+#define RIOT_PP_SUCCESSOR_5373 5374
+#define RIOT_PP_SUCCESSOR_5374 5375
+#define RIOT_PP_SUCCESSOR_5375 5376
+#define RIOT_PP_SUCCESSOR_5376 5377
+#define RIOT_PP_SUCCESSOR_5377 5378
+#define RIOT_PP_SUCCESSOR_5378 5379
+#define RIOT_PP_SUCCESSOR_5379 5380
+#define RIOT_PP_SUCCESSOR_5380 5381
+#define RIOT_PP_SUCCESSOR_5381 5382
+#define RIOT_PP_SUCCESSOR_5382 5383
+#define RIOT_PP_SUCCESSOR_5383 5384
+#define RIOT_PP_SUCCESSOR_5384 5385
+#define RIOT_PP_SUCCESSOR_5385 5386
+#define RIOT_PP_SUCCESSOR_5386 5387
+#define RIOT_PP_SUCCESSOR_5387 5388
+#define RIOT_PP_SUCCESSOR_5388 5389
+#define RIOT_PP_SUCCESSOR_5389 5390
+#define RIOT_PP_SUCCESSOR_5390 5391
+#define RIOT_PP_SUCCESSOR_5391 5392
+#define RIOT_PP_SUCCESSOR_5392 5393
+#define RIOT_PP_SUCCESSOR_5393 5394
+#define RIOT_PP_SUCCESSOR_5394 5395
+#define RIOT_PP_SUCCESSOR_5395 5396
+#define RIOT_PP_SUCCESSOR_5396 5397
+#define RIOT_PP_SUCCESSOR_5397 5398
+#define RIOT_PP_SUCCESSOR_5398 5399
+#define RIOT_PP_SUCCESSOR_5399 5400
+#define RIOT_PP_SUCCESSOR_5400 5401
+#define RIOT_PP_SUCCESSOR_5401 5402
+#define RIOT_PP_SUCCESSOR_5402 5403
+#define RIOT_PP_SUCCESSOR_5403 5404
+#define RIOT_PP_SUCCESSOR_5404 5405
+#define RIOT_PP_SUCCESSOR_5405 5406
+#define RIOT_PP_SUCCESSOR_5406 5407
+#define RIOT_PP_SUCCESSOR_5407 5408
+#define RIOT_PP_SUCCESSOR_5408 5409
+#define RIOT_PP_SUCCESSOR_5409 5410
+#define RIOT_PP_SUCCESSOR_5410 5411
+#define RIOT_PP_SUCCESSOR_5411 5412
+#define RIOT_PP_SUCCESSOR_5412 5413
+#define RIOT_PP_SUCCESSOR_5413 5414
+#define RIOT_PP_SUCCESSOR_5414 5415
+#define RIOT_PP_SUCCESSOR_5415 5416
+#define RIOT_PP_SUCCESSOR_5416 5417
+#define RIOT_PP_SUCCESSOR_5417 5418
+#define RIOT_PP_SUCCESSOR_5418 5419
+#define RIOT_PP_SUCCESSOR_5419 5420
+#define RIOT_PP_SUCCESSOR_5420 5421
+#define RIOT_PP_SUCCESSOR_5421 5422
+#define RIOT_PP_SUCCESSOR_5422 5423
+#define RIOT_PP_SUCCESSOR_5423 5424
+#define RIOT_PP_SUCCESSOR_5424 5425
+#define RIOT_PP_SUCCESSOR_5425 5426
+#define RIOT_PP_SUCCESSOR_5426 5427
+#define RIOT_PP_SUCCESSOR_5427 5428
+#define RIOT_PP_SUCCESSOR_5428 5429
+#define RIOT_PP_SUCCESSOR_5429 5430
+#define RIOT_PP_SUCCESSOR_5430 5431
+#define RIOT_PP_SUCCESSOR_5431 5432
+#define RIOT_PP_SUCCESSOR_5432 5433
+#define RIOT_PP_SUCCESSOR_5433 5434
+#define RIOT_PP_SUCCESSOR_5434 5435
+#define RIOT_PP_SUCCESSOR_5435 5436
+#define RIOT_PP_SUCCESSOR_5436 5437
+#define RIOT_PP_SUCCESSOR_5437 5438
+#define RIOT_PP_SUCCESSOR_5438 5439
+#define RIOT_PP_SUCCESSOR_5439 5440
+#define RIOT_PP_SUCCESSOR_5440 5441
+#define RIOT_PP_SUCCESSOR_5441 5442
+#define RIOT_PP_SUCCESSOR_5442 5443
+#define RIOT_PP_SUCCESSOR_5443 5444
+#define RIOT_PP_SUCCESSOR_5444 5445
+#define RIOT_PP_SUCCESSOR_5445 5446
+#define RIOT_PP_SUCCESSOR_5446 5447
+#define RIOT_PP_SUCCESSOR_5447 5448
+#define RIOT_PP_SUCCESSOR_5448 5449
+#define RIOT_PP_SUCCESSOR_5449 5450
+#define RIOT_PP_SUCCESSOR_5450 5451
+#define RIOT_PP_SUCCESSOR_5451 5452
+#define RIOT_PP_SUCCESSOR_5452 5453
+#define RIOT_PP_SUCCESSOR_5453 5454
+#define RIOT_PP_SUCCESSOR_5454 5455
+#define RIOT_PP_SUCCESSOR_5455 5456
+#define RIOT_PP_SUCCESSOR_5456 5457
+#define RIOT_PP_SUCCESSOR_5457 5458
+#define RIOT_PP_SUCCESSOR_5458 5459
+#define RIOT_PP_SUCCESSOR_5459 5460
+#define RIOT_PP_SUCCESSOR_5460 5461
+#define RIOT_PP_SUCCESSOR_5461 5462
+#define RIOT_PP_SUCCESSOR_5462 5463
+#define RIOT_PP_SUCCESSOR_5463 5464
+#define RIOT_PP_SUCCESSOR_5464 5465
+#define RIOT_PP_SUCCESSOR_5465 5466
+#define RIOT_PP_SUCCESSOR_5466 5467
+#define RIOT_PP_SUCCESSOR_5467 5468
+#define RIOT_PP_SUCCESSOR_5468 5469
+#define RIOT_PP_SUCCESSOR_5469 5470
+#define RIOT_PP_SUCCESSOR_5470 5471
+#define RIOT_PP_SUCCESSOR_5471 5472
+#define RIOT_PP_SUCCESSOR_5472 5473
+#define RIOT_PP_SUCCESSOR_5473 5474
+#define RIOT_PP_SUCCESSOR_5474 5475
+#define RIOT_PP_SUCCESSOR_5475 5476
+#define RIOT_PP_SUCCESSOR_5476 5477
+#define RIOT_PP_SUCCESSOR_5477 5478
+#define RIOT_PP_SUCCESSOR_5478 5479
+#define RIOT_PP_SUCCESSOR_5479 5480
+#define RIOT_PP_SUCCESSOR_5480 5481
+#define RIOT_PP_SUCCESSOR_5481 5482
+#define RIOT_PP_SUCCESSOR_5482 5483
+#define RIOT_PP_SUCCESSOR_5483 5484
+#define RIOT_PP_SUCCESSOR_5484 5485
+#define RIOT_PP_SUCCESSOR_5485 5486
+#define RIOT_PP_SUCCESSOR_5486 5487
+#define RIOT_PP_SUCCESSOR_5487 5488
+#define RIOT_PP_SUCCESSOR_5488 5489
+#define RIOT_PP_SUCCESSOR_5489 5490
+#define RIOT_PP_SUCCESSOR_5490 5491
+#define RIOT_PP_SUCCESSOR_5491 5492
+#define RIOT_PP_SUCCESSOR_5492 5493
+#define RIOT_PP_SUCCESSOR_5493 5494
+#define RIOT_PP_SUCCESSOR_5494 5495
+#define RIOT_PP_SUCCESSOR_5495 5496
+#define RIOT_PP_SUCCESSOR_5496 5497
+#define RIOT_PP_SUCCESSOR_5497 5498
+#define RIOT_PP_SUCCESSOR_5498 5499
+#define RIOT_PP_SUCCESSOR_5499 5500
+#define RIOT_PP_SUCCESSOR_5500 5501
+#define RIOT_PP_SUCCESSOR_5501 5502
+#define RIOT_PP_SUCCESSOR_5502 5503
+#define RIOT_PP_SUCCESSOR_5503 5504
+#define RIOT_PP_SUCCESSOR_5504 5505
+#define RIOT_PP_SUCCESSOR_5505 5506
+#define RIOT_PP_SUCCESSOR_5506 5507
+#define RIOT_PP_SUCCESSOR_5507 5508
+#define RIOT_PP_SUCCESSOR_5508 5509
+#define RIOT_PP_SUCCESSOR_5509 5510
+#define RIOT_PP_SUCCESSOR_5510 5511
+#define RIOT_PP_SUCCESSOR_5511 5512
+#define RIOT_PP_SUCCESSOR_5512 5513
+#define RIOT_PP_SUCCESSOR_5513 5514
+#define RIOT_PP_SUCCESSOR_5514 5515
+#define RIOT_PP_SUCCESSOR_5515 5516
+#define RIOT_PP_SUCCESSOR_5516 5517
+#define RIOT_PP_SUCCESSOR_5517 5518
+#define RIOT_PP_SUCCESSOR_5518 5519
+#define RIOT_PP_SUCCESSOR_5519 5520
+#define RIOT_PP_SUCCESSOR_5520 5521
+#define RIOT_PP_SUCCESSOR_5521 5522
+#define RIOT_PP_SUCCESSOR_5522 5523
+#define RIOT_PP_SUCCESSOR_5523 5524
+#define RIOT_PP_SUCCESSOR_5524 5525
+#define RIOT_PP_SUCCESSOR_5525 5526
+#define RIOT_PP_SUCCESSOR_5526 5527
+#define RIOT_PP_SUCCESSOR_5527 5528
+#define RIOT_PP_SUCCESSOR_5528 5529
+#define RIOT_PP_SUCCESSOR_5529 5530
+#define RIOT_PP_SUCCESSOR_5530 5531
+#define RIOT_PP_SUCCESSOR_5531 5532
+#define RIOT_PP_SUCCESSOR_5532 5533
+#define RIOT_PP_SUCCESSOR_5533 5534
+#define RIOT_PP_SUCCESSOR_5534 5535
+#define RIOT_PP_SUCCESSOR_5535 5536
+#define RIOT_PP_SUCCESSOR_5536 5537
+#define RIOT_PP_SUCCESSOR_5537 5538
+#define RIOT_PP_SUCCESSOR_5538 5539
+#define RIOT_PP_SUCCESSOR_5539 5540
+#define RIOT_PP_SUCCESSOR_5540 5541
+#define RIOT_PP_SUCCESSOR_5541 5542
+#define RIOT_PP_SUCCESSOR_5542 5543
+#define RIOT_PP_SUCCESSOR_5543 5544
+#define RIOT_PP_SUCCESSOR_5544 5545
+#define RIOT_PP_SUCCESSOR_5545 5546
+#define RIOT_PP_SUCCESSOR_5546 5547
+#define RIOT_PP_SUCCESSOR_5547 5548
+#define RIOT_PP_SUCCESSOR_5548 5549
+#define RIOT_PP_SUCCESSOR_5549 5550
+#define RIOT_PP_SUCCESSOR_5550 5551
+#define RIOT_PP_SUCCESSOR_5551 5552
+#define RIOT_PP_SUCCESSOR_5552 5553
+#define RIOT_PP_SUCCESSOR_5553 5554
+#define RIOT_PP_SUCCESSOR_5554 5555
+#define RIOT_PP_SUCCESSOR_5555 5556
+#define RIOT_PP_SUCCESSOR_5556 5557
+#define RIOT_PP_SUCCESSOR_5557 5558
+#define RIOT_PP_SUCCESSOR_5558 5559
+#define RIOT_PP_SUCCESSOR_5559 5560
+#define RIOT_PP_SUCCESSOR_5560 5561
+#define RIOT_PP_SUCCESSOR_5561 5562
+#define RIOT_PP_SUCCESSOR_5562 5563
+#define RIOT_PP_SUCCESSOR_5563 5564
+#define RIOT_PP_SUCCESSOR_5564 5565
+#define RIOT_PP_SUCCESSOR_5565 5566
+#define RIOT_PP_SUCCESSOR_5566 5567
+#define RIOT_PP_SUCCESSOR_5567 5568
+#define RIOT_PP_SUCCESSOR_5568 5569
+#define RIOT_PP_SUCCESSOR_5569 5570
+#define RIOT_PP_SUCCESSOR_5570 5571
+#define RIOT_PP_SUCCESSOR_5571 5572
+#define RIOT_PP_SUCCESSOR_5572 5573
+#define RIOT_PP_SUCCESSOR_5573 5574
+#define RIOT_PP_SUCCESSOR_5574 5575
+#define RIOT_PP_SUCCESSOR_5575 5576
+#define RIOT_PP_SUCCESSOR_5576 5577
+#define RIOT_PP_SUCCESSOR_5577 5578
+#define RIOT_PP_SUCCESSOR_5578 5579
+#define RIOT_PP_SUCCESSOR_5579 5580
+#define RIOT_PP_SUCCESSOR_5580 5581
+#define RIOT_PP_SUCCESSOR_5581 5582
+#define RIOT_PP_SUCCESSOR_5582 5583
+#define RIOT_PP_SUCCESSOR_5583 5584
+#define RIOT_PP_SUCCESSOR_5584 5585
+#define RIOT_PP_SUCCESSOR_5585 5586
+#define RIOT_PP_SUCCESSOR_5586 5587
+#define RIOT_PP_SUCCESSOR_5587 5588
+#define RIOT_PP_SUCCESSOR_5588 5589
+#define RIOT_PP_SUCCESSOR_5589 5590
+#define RIOT_PP_SUCCESSOR_5590 5591
+#define RIOT_PP_SUCCESSOR_5591 5592
+#define RIOT_PP_SUCCESSOR_5592 5593
+#define RIOT_PP_SUCCESSOR_5593 5594
+#define RIOT_PP_SUCCESSOR_5594 5595
+#define RIOT_PP_SUCCESSOR_5595 5596
+#define RIOT_PP_SUCCESSOR_5596 5597
+#define RIOT_PP_SUCCESSOR_5597 5598
+#define RIOT_PP_SUCCESSOR_5598 5599
+#define RIOT_PP_SUCCESSOR_5599 5600
+#define RIOT_PP_SUCCESSOR_5600 5601
+#define RIOT_PP_SUCCESSOR_5601 5602
+#define RIOT_PP_SUCCESSOR_5602 5603
+#define RIOT_PP_SUCCESSOR_5603 5604
+#define RIOT_PP_SUCCESSOR_5604 5605
+#define RIOT_PP_SUCCESSOR_5605 5606
+#define RIOT_PP_SUCCESSOR_5606 5607
+#define RIOT_PP_SUCCESSOR_5607 5608
+#define RIOT_PP_SUCCESSOR_5608 5609
+#define RIOT_PP_SUCCESSOR_5609 5610
+#define RIOT_PP_SUCCESSOR_5610 5611
+#define RIOT_PP_SUCCESSOR_5611 5612
+#define RIOT_PP_SUCCESSOR_5612 5613
+#define RIOT_PP_SUCCESSOR_5613 5614
+#define RIOT_PP_SUCCESSOR_5614 5615
+#define RIOT_PP_SUCCESSOR_5615 5616
+#define RIOT_PP_SUCCESSOR_5616 5617
+#define RIOT_PP_SUCCESSOR_5617 5618
+#define RIOT_PP_SUCCESSOR_5618 5619
+#define RIOT_PP_SUCCESSOR_5619 5620
+#define RIOT_PP_SUCCESSOR_5620 5621
+#define RIOT_PP_SUCCESSOR_5621 5622
+#define RIOT_PP_SUCCESSOR_5622 5623
+#define RIOT_PP_SUCCESSOR_5623 5624
+#define RIOT_PP_SUCCESSOR_5624 5625
+#define RIOT_PP_SUCCESSOR_5625 5626
+#define RIOT_PP_SUCCESSOR_5626 5627
+#define RIOT_PP_SUCCESSOR_5627 5628
+#define RIOT_PP_SUCCESSOR_5628 5629
+#define RIOT_PP_SUCCESSOR_5629 5630
+#define RIOT_PP_SUCCESSOR_5630 5631
+#define RIOT_PP_SUCCESSOR_5631 5632
+#define RIOT_PP_SUCCESSOR_5632 5633
+#define RIOT_PP_SUCCESSOR_5633 5634
+#define RIOT_PP_SUCCESSOR_5634 5635
+#define RIOT_PP_SUCCESSOR_5635 5636
+#define RIOT_PP_SUCCESSOR_5636 5637
+#define RIOT_PP_SUCCESSOR_5637 5638
+#define RIOT_PP_SUCCESSOR_5638 5639
+#define RIOT_PP_SUCCESSOR_5639 5640
+#define RIOT_PP_SUCCESSOR_5640 5641
+#define RIOT_PP_SUCCESSOR_5641 5642
+#define RIOT_PP_SUCCESSOR_5642 5643
+#define RIOT_PP_SUCCESSOR_5643 5644
+#define RIOT_PP_SUCCESSOR_5644 5645
+#define RIOT_PP_SUCCESSOR_5645 5646
+#define RIOT_PP_SUCCESSOR_5646 5647
+#define RIOT_PP_SUCCESSOR_5647 5648
+#define RIOT_PP_SUCCESSOR_5648 5649
+#define RIOT_PP_SUCCESSOR_5649 5650
+#define RIOT_PP_SUCCESSOR_5650 5651
+#define RIOT_PP_SUCCESSOR_5651 5652
+#define RIOT_PP_SUCCESSOR_5652 5653
+#define RIOT_PP_SUCCESSOR_5653 5654
+#define RIOT_PP_SUCCESSOR_5654 5655
+#define RIOT_PP_SUCCESSOR_5655 5656
+#define RIOT_PP_SUCCESSOR_5656 5657
+#define RIOT_PP_SUCCESSOR_5657 5658
+#define RIOT_PP_SUCCESSOR_5658 5659
+#define RIOT_PP_SUCCESSOR_5659 5660
+#define RIOT_PP_SUCCESSOR_5660 5661
+#define RIOT_PP_SUCCESSOR_5661 5662
+#define RIOT_PP_SUCCESSOR_5662 5663
+#define RIOT_PP_SUCCESSOR_5663 5664
+#define RIOT_PP_SUCCESSOR_5664 5665
+#define RIOT_PP_SUCCESSOR_5665 5666
+#define RIOT_PP_SUCCESSOR_5666 5667
+#define RIOT_PP_SUCCESSOR_5667 5668
+#define RIOT_PP_SUCCESSOR_5668 5669
+#define RIOT_PP_SUCCESSOR_5669 5670
+#define RIOT_PP_SUCCESSOR_5670 5671
+#define RIOT_PP_SUCCESSOR_5671 5672
+#define RIOT_PP_SUCCESSOR_5672 5673
+#define RIOT_PP_SUCCESSOR_5673 5674
+#define RIOT_PP_SUCCESSOR_5674 5675
+#define RIOT_PP_SUCCESSOR_5675 5676
+#define RIOT_PP_SUCCESSOR_5676 5677
+#define RIOT_PP_SUCCESSOR_5677 5678
+#define RIOT_PP_SUCCESSOR_5678 5679
+#define RIOT_PP_SUCCESSOR_5679 5680
+#define RIOT_PP_SUCCESSOR_5680 5681
+#define RIOT_PP_SUCCESSOR_5681 5682
+#define RIOT_PP_SUCCESSOR_5682 5683
+#define RIOT_PP_SUCCESSOR_5683 5684
+#define RIOT_PP_SUCCESSOR_5684 5685
+#define RIOT_PP_SUCCESSOR_5685 5686
+#define RIOT_PP_SUCCESSOR_5686 5687
+#define RIOT_PP_SUCCESSOR_5687 5688
+#define RIOT_PP_SUCCESSOR_5688 5689
+#define RIOT_PP_SUCCESSOR_5689 5690
+#define RIOT_PP_SUCCESSOR_5690 5691
+#define RIOT_PP_SUCCESSOR_5691 5692
+#define RIOT_PP_SUCCESSOR_5692 5693
+#define RIOT_PP_SUCCESSOR_5693 5694
+#define RIOT_PP_SUCCESSOR_5694 5695
+#define RIOT_PP_SUCCESSOR_5695 5696
+#define RIOT_PP_SUCCESSOR_5696 5697
+#define RIOT_PP_SUCCESSOR_5697 5698
+#define RIOT_PP_SUCCESSOR_5698 5699
+#define RIOT_PP_SUCCESSOR_5699 5700
+#define RIOT_PP_SUCCESSOR_5700 5701
+#define RIOT_PP_SUCCESSOR_5701 5702
+#define RIOT_PP_SUCCESSOR_5702 5703
+#define RIOT_PP_SUCCESSOR_5703 5704
+#define RIOT_PP_SUCCESSOR_5704 5705
+#define RIOT_PP_SUCCESSOR_5705 5706
+#define RIOT_PP_SUCCESSOR_5706 5707
+#define RIOT_PP_SUCCESSOR_5707 5708
+#define RIOT_PP_SUCCESSOR_5708 5709
+#define RIOT_PP_SUCCESSOR_5709 5710
+#define RIOT_PP_SUCCESSOR_5710 5711
+#define RIOT_PP_SUCCESSOR_5711 5712
+#define RIOT_PP_SUCCESSOR_5712 5713
+#define RIOT_PP_SUCCESSOR_5713 5714
+#define RIOT_PP_SUCCESSOR_5714 5715
+#define RIOT_PP_SUCCESSOR_5715 5716
+#define RIOT_PP_SUCCESSOR_5716 5717
+#define RIOT_PP_SUCCESSOR_5717 5718
+#define RIOT_PP_SUCCESSOR_5718 5719
+#define RIOT_PP_SUCCESSOR_5719 5720
+#define RIOT_PP_SUCCESSOR_5720 5721
+#define RIOT_PP_SUCCESSOR_5721 5722
+#define RIOT_PP_SUCCESSOR_5722 5723
+#define RIOT_PP_SUCCESSOR_5723 5724
+#define RIOT_PP_SUCCESSOR_5724 5725
+#define RIOT_PP_SUCCESSOR_5725 5726
+#define RIOT_PP_SUCCESSOR_5726 5727
+#define RIOT_PP_SUCCESSOR_5727 5728
+#define RIOT_PP_SUCCESSOR_5728 5729
+#define RIOT_PP_SUCCESSOR_5729 5730
+#define RIOT_PP_SUCCESSOR_5730 5731
+#define RIOT_PP_SUCCESSOR_5731 5732
+#define RIOT_PP_SUCCESSOR_5732 5733
+#define RIOT_PP_SUCCESSOR_5733 5734
+#define RIOT_PP_SUCCESSOR_5734 5735
+#define RIOT_PP_SUCCESSOR_5735 5736
+#define RIOT_PP_SUCCESSOR_5736 5737
+#define RIOT_PP_SUCCESSOR_5737 5738
+#define RIOT_PP_SUCCESSOR_5738 5739
+#define RIOT_PP_SUCCESSOR_5739 5740
+#define RIOT_PP_SUCCESSOR_5740 5741
+#define RIOT_PP_SUCCESSOR_5741 5742
+#define RIOT_PP_SUCCESSOR_5742 5743
+#define RIOT_PP_SUCCESSOR_5743 5744
+#define RIOT_PP_SUCCESSOR_5744 5745
+#define RIOT_PP_SUCCESSOR_5745 5746
+#define RIOT_PP_SUCCESSOR_5746 5747
+#define RIOT_PP_SUCCESSOR_5747 5748
+#define RIOT_PP_SUCCESSOR_5748 5749
+#define RIOT_PP_SUCCESSOR_5749 5750
+#define RIOT_PP_SUCCESSOR_5750 5751
+#define RIOT_PP_SUCCESSOR_5751 5752
+#define RIOT_PP_SUCCESSOR_5752 5753
+#define RIOT_PP_SUCCESSOR_5753 5754
+#define RIOT_PP_SUCCESSOR_5754 5755
+#define RIOT_PP_SUCCESSOR_5755 5756
+#define RIOT_PP_SUCCESSOR_5756 5757
+#define RIOT_PP_SUCCESSOR_5757 5758
+#define RIOT_PP_SUCCESSOR_5758 5759
+#define RIOT_PP_SUCCESSOR_5759 5760
+#define RIOT_PP_SUCCESSOR_5760 5761
+#define RIOT_PP_SUCCESSOR_5761 5762
+#define RIOT_PP_SUCCESSOR_5762 5763
+#define RIOT_PP_SUCCESSOR_5763 5764
+#define RIOT_PP_SUCCESSOR_5764 5765
+#define RIOT_PP_SUCCESSOR_5765 5766
+#define RIOT_PP_SUCCESSOR_5766 5767
+#define RIOT_PP_SUCCESSOR_5767 5768
+#define RIOT_PP_SUCCESSOR_5768 5769
+#define RIOT_PP_SUCCESSOR_5769 5770
+#define RIOT_PP_SUCCESSOR_5770 5771
+#define RIOT_PP_SUCCESSOR_5771 5772
+#define RIOT_PP_SUCCESSOR_5772 5773
+#define RIOT_PP_SUCCESSOR_5773 5774
+#define RIOT_PP_SUCCESSOR_5774 5775
+#define RIOT_PP_SUCCESSOR_5775 5776
+#define RIOT_PP_SUCCESSOR_5776 5777
+#define RIOT_PP_SUCCESSOR_5777 5778
+#define RIOT_PP_SUCCESSOR_5778 5779
+#define RIOT_PP_SUCCESSOR_5779 5780
+#define RIOT_PP_SUCCESSOR_5780 5781
+#define RIOT_PP_SUCCESSOR_5781 5782
+#define RIOT_PP_SUCCESSOR_5782 5783
+#define RIOT_PP_SUCCESSOR_5783 5784
+#define RIOT_PP_SUCCESSOR_5784 5785
+#define RIOT_PP_SUCCESSOR_5785 5786
+#define RIOT_PP_SUCCESSOR_5786 5787
+#define RIOT_PP_SUCCESSOR_5787 5788
+#define RIOT_PP_SUCCESSOR_5788 5789
+#define RIOT_PP_SUCCESSOR_5789 5790
+#define RIOT_PP_SUCCESSOR_5790 5791
+#define RIOT_PP_SUCCESSOR_5791 5792
+#define RIOT_PP_SUCCESSOR_5792 5793
+#define RIOT_PP_SUCCESSOR_5793 5794
+#define RIOT_PP_SUCCESSOR_5794 5795
+#define RIOT_PP_SUCCESSOR_5795 5796
+#define RIOT_PP_SUCCESSOR_5796 5797
+#define RIOT_PP_SUCCESSOR_5797 5798
+#define RIOT_PP_SUCCESSOR_5798 5799
+#define RIOT_PP_SUCCESSOR_5799 5800
+#define RIOT_PP_SUCCESSOR_5800 5801
+#define RIOT_PP_SUCCESSOR_5801 5802
+#define RIOT_PP_SUCCESSOR_5802 5803
+#define RIOT_PP_SUCCESSOR_5803 5804
+#define RIOT_PP_SUCCESSOR_5804 5805
+#define RIOT_PP_SUCCESSOR_5805 5806
+#define RIOT_PP_SUCCESSOR_5806 5807
+#define RIOT_PP_SUCCESSOR_5807 5808
+#define RIOT_PP_SUCCESSOR_5808 5809
+#define RIOT_PP_SUCCESSOR_5809 5810
+#define RIOT_PP_SUCCESSOR_5810 5811
+#define RIOT_PP_SUCCESSOR_5811 5812
+#define RIOT_PP_SUCCESSOR_5812 5813
+#define RIOT_PP_SUCCESSOR_5813 5814
+#define RIOT_PP_SUCCESSOR_5814 5815
+#define RIOT_PP_SUCCESSOR_5815 5816
+#define RIOT_PP_SUCCESSOR_5816 5817
+#define RIOT_PP_SUCCESSOR_5817 5818
+#define RIOT_PP_SUCCESSOR_5818 5819
+#define RIOT_PP_SUCCESSOR_5819 5820
+#define RIOT_PP_SUCCESSOR_5820 5821
+#define RIOT_PP_SUCCESSOR_5821 5822
+#define RIOT_PP_SUCCESSOR_5822 5823
+#define RIOT_PP_SUCCESSOR_5823 5824
+#define RIOT_PP_SUCCESSOR_5824 5825
+#define RIOT_PP_SUCCESSOR_5825 5826
+#define RIOT_PP_SUCCESSOR_5826 5827
+#define RIOT_PP_SUCCESSOR_5827 5828
+#define RIOT_PP_SUCCESSOR_5828 5829
+#define RIOT_PP_SUCCESSOR_5829 5830
+#define RIOT_PP_SUCCESSOR_5830 5831
+#define RIOT_PP_SUCCESSOR_5831 5832
+#define RIOT_PP_SUCCESSOR_5832 5833
+#define RIOT_PP_SUCCESSOR_5833 5834
+#define RIOT_PP_SUCCESSOR_5834 5835
+#define RIOT_PP_SUCCESSOR_5835 5836
+#define RIOT_PP_SUCCESSOR_5836 5837
+#define RIOT_PP_SUCCESSOR_5837 5838
+#define RIOT_PP_SUCCESSOR_5838 5839
+#define RIOT_PP_SUCCESSOR_5839 5840
+#define RIOT_PP_SUCCESSOR_5840 5841
+#define RIOT_PP_SUCCESSOR_5841 5842
+#define RIOT_PP_SUCCESSOR_5842 5843
+#define RIOT_PP_SUCCESSOR_5843 5844
+#define RIOT_PP_SUCCESSOR_5844 5845
+#define RIOT_PP_SUCCESSOR_5845 5846
+#define RIOT_PP_SUCCESSOR_5846 5847
+#define RIOT_PP_SUCCESSOR_5847 5848
+#define RIOT_PP_SUCCESSOR_5848 5849
+#define RIOT_PP_SUCCESSOR_5849 5850
+#define RIOT_PP_SUCCESSOR_5850 5851
+#define RIOT_PP_SUCCESSOR_5851 5852
+#define RIOT_PP_SUCCESSOR_5852 5853
+#define RIOT_PP_SUCCESSOR_5853 5854
+#define RIOT_PP_SUCCESSOR_5854 5855
+#define RIOT_PP_SUCCESSOR_5855 5856
+#define RIOT_PP_SUCCESSOR_5856 5857
+#define RIOT_PP_SUCCESSOR_5857 5858
+#define RIOT_PP_SUCCESSOR_5858 5859
+#define RIOT_PP_SUCCESSOR_5859 5860
+#define RIOT_PP_SUCCESSOR_5860 5861
+#define RIOT_PP_SUCCESSOR_5861 5862
+#define RIOT_PP_SUCCESSOR_5862 5863
+#define RIOT_PP_SUCCESSOR_5863 5864
+#define RIOT_PP_SUCCESSOR_5864 5865
+#define RIOT_PP_SUCCESSOR_5865 5866
+#define RIOT_PP_SUCCESSOR_5866 5867
+#define RIOT_PP_SUCCESSOR_5867 5868
+#define RIOT_PP_SUCCESSOR_5868 5869
+#define RIOT_PP_SUCCESSOR_5869 5870
+#define RIOT_PP_SUCCESSOR_5870 5871
+#define RIOT_PP_SUCCESSOR_5871 5872
+#define RIOT_PP_SUCCESSOR_5872 5873
+#define RIOT_PP_SUCCESSOR_5873 5874
+#define RIOT_PP_SUCCESSOR_5874 5875
+#define RIOT_PP_SUCCESSOR_5875 5876
+#define RIOT_PP_SUCCESSOR_5876 5877
+#define RIOT_PP_SUCCESSOR_5877 5878
+#define RIOT_PP_SUCCESSOR_5878 5879
+#define RIOT_PP_SUCCESSOR_5879 5880
+#define RIOT_PP_SUCCESSOR_5880 5881
+#define RIOT_PP_SUCCESSOR_5881 5882
+#define RIOT_PP_SUCCESSOR_5882 5883
+#define RIOT_PP_SUCCESSOR_5883 5884
+#define RIOT_PP_SUCCESSOR_5884 5885
+#define RIOT_PP_SUCCESSOR_5885 5886
+#define RIOT_PP_SUCCESSOR_5886 5887
+#define RIOT_PP_SUCCESSOR_5887 5888
+#define RIOT_PP_SUCCESSOR_5888 5889
+#define RIOT_PP_SUCCESSOR_5889 5890
+#define RIOT_PP_SUCCESSOR_5890 5891
+#define RIOT_PP_SUCCESSOR_5891 5892
+#define RIOT_PP_SUCCESSOR_5892 5893
+#define RIOT_PP_SUCCESSOR_5893 5894
+#define RIOT_PP_SUCCESSOR_5894 5895
+#define RIOT_PP_SUCCESSOR_5895 5896
+#define RIOT_PP_SUCCESSOR_5896 5897
+#define RIOT_PP_SUCCESSOR_5897 5898
+#define RIOT_PP_SUCCESSOR_5898 5899
+#define RIOT_PP_SUCCESSOR_5899 5900
+#define RIOT_PP_SUCCESSOR_5900 5901
+#define RIOT_PP_SUCCESSOR_5901 5902
+#define RIOT_PP_SUCCESSOR_5902 5903
+#define RIOT_PP_SUCCESSOR_5903 5904
+#define RIOT_PP_SUCCESSOR_5904 5905
+#define RIOT_PP_SUCCESSOR_5905 5906
+#define RIOT_PP_SUCCESSOR_5906 5907
+#define RIOT_PP_SUCCESSOR_5907 5908
+#define RIOT_PP_SUCCESSOR_5908 5909
+#define RIOT_PP_SUCCESSOR_5909 5910
+#define RIOT_PP_SUCCESSOR_5910 5911
+#define RIOT_PP_SUCCESSOR_5911 5912
+#define RIOT_PP_SUCCESSOR_5912 5913
+#define RIOT_PP_SUCCESSOR_5913 5914
+#define RIOT_PP_SUCCESSOR_5914 5915
+#define RIOT_PP_SUCCESSOR_5915 5916
+#define RIOT_PP_SUCCESSOR_5916 5917
+#define RIOT_PP_SUCCESSOR_5917 5918
+#define RIOT_PP_SUCCESSOR_5918 5919
+#define RIOT_PP_SUCCESSOR_5919 5920
+#define RIOT_PP_SUCCESSOR_5920 5921
+#define RIOT_PP_SUCCESSOR_5921 5922
+#define RIOT_PP_SUCCESSOR_5922 5923
+#define RIOT_PP_SUCCESSOR_5923 5924
+#define RIOT_PP_SUCCESSOR_5924 5925
+#define RIOT_PP_SUCCESSOR_5925 5926
+#define RIOT_PP_SUCCESSOR_5926 5927
+#define RIOT_PP_SUCCESSOR_5927 5928
+#define RIOT_PP_SUCCESSOR_5928 5929
+#define RIOT_PP_SUCCESSOR_5929 5930
+#define RIOT_PP_SUCCESSOR_5930 5931
+#define RIOT_PP_SUCCESSOR_5931 5932
+#define RIOT_PP_SUCCESSOR_5932 5933
+#define RIOT_PP_SUCCESSOR_5933 5934
+#define RIOT_PP_SUCCESSOR_5934 5935
+#define RIOT_PP_SUCCESSOR_5935 5936
+#define RIOT_PP_SUCCESSOR_5936 5937
+#define RIOT_PP_SUCCESSOR_5937 5938
+#define RIOT_PP_SUCCESSOR_5938 5939
+#define RIOT_PP_SUCCESSOR_5939 5940
+#define RIOT_PP_SUCCESSOR_5940 5941
+#define RIOT_PP_SUCCESSOR_5941 5942
+#define RIOT_PP_SUCCESSOR_5942 5943
+#define RIOT_PP_SUCCESSOR_5943 5944
+#define RIOT_PP_SUCCESSOR_5944 5945
+#define RIOT_PP_SUCCESSOR_5945 5946
+#define RIOT_PP_SUCCESSOR_5946 5947
+#define RIOT_PP_SUCCESSOR_5947 5948
+#define RIOT_PP_SUCCESSOR_5948 5949
+#define RIOT_PP_SUCCESSOR_5949 5950
+#define RIOT_PP_SUCCESSOR_5950 5951
+#define RIOT_PP_SUCCESSOR_5951 5952
+#define RIOT_PP_SUCCESSOR_5952 5953
+#define RIOT_PP_SUCCESSOR_5953 5954
+#define RIOT_PP_SUCCESSOR_5954 5955
+#define RIOT_PP_SUCCESSOR_5955 5956
+#define RIOT_PP_SUCCESSOR_5956 5957
+#define RIOT_PP_SUCCESSOR_5957 5958
+#define RIOT_PP_SUCCESSOR_5958 5959
+#define RIOT_PP_SUCCESSOR_5959 5960
+#define RIOT_PP_SUCCESSOR_5960 5961
+#define RIOT_PP_SUCCESSOR_5961 5962
+#define RIOT_PP_SUCCESSOR_5962 5963
+#define RIOT_PP_SUCCESSOR_5963 5964
+#define RIOT_PP_SUCCESSOR_5964 5965
+#define RIOT_PP_SUCCESSOR_5965 5966
+#define RIOT_PP_SUCCESSOR_5966 5967
+#define RIOT_PP_SUCCESSOR_5967 5968
+#define RIOT_PP_SUCCESSOR_5968 5969
+#define RIOT_PP_SUCCESSOR_5969 5970
+#define RIOT_PP_SUCCESSOR_5970 5971
+#define RIOT_PP_SUCCESSOR_5971 5972
+#define RIOT_PP_SUCCESSOR_5972 5973
+#define RIOT_PP_SUCCESSOR_5973 5974
+#define RIOT_PP_SUCCESSOR_5974 5975
+#define RIOT_PP_SUCCESSOR_5975 5976
+#define RIOT_PP_SUCCESSOR_5976 5977
+#define RIOT_PP_SUCCESSOR_5977 5978
+#define RIOT_PP_SUCCESSOR_5978 5979
+#define RIOT_PP_SUCCESSOR_5979 5980
+#define RIOT_PP_SUCCESSOR_5980 5981
+#define RIOT_PP_SUCCESSOR_5981 5982
+#define RIOT_PP_SUCCESSOR_5982 5983
+#define RIOT_PP_SUCCESSOR_5983 5984
+#define RIOT_PP_SUCCESSOR_5984 5985
+#define RIOT_PP_SUCCESSOR_5985 5986
+#define RIOT_PP_SUCCESSOR_5986 5987
+#define RIOT_PP_SUCCESSOR_5987 5988
+#define RIOT_PP_SUCCESSOR_5988 5989
+#define RIOT_PP_SUCCESSOR_5989 5990
+#define RIOT_PP_SUCCESSOR_5990 5991
+#define RIOT_PP_SUCCESSOR_5991 5992
+#define RIOT_PP_SUCCESSOR_5992 5993
+#define RIOT_PP_SUCCESSOR_5993 5994
+#define RIOT_PP_SUCCESSOR_5994 5995
+#define RIOT_PP_SUCCESSOR_5995 5996
+#define RIOT_PP_SUCCESSOR_5996 5997
+#define RIOT_PP_SUCCESSOR_5997 5998
+#define RIOT_PP_SUCCESSOR_5998 5999
+#define RIOT_PP_SUCCESSOR_5999 6000
+#define RIOT_PP_SUCCESSOR_6000 6001
+#define RIOT_PP_SUCCESSOR_6001 6002
+#define RIOT_PP_SUCCESSOR_6002 6003
+#define RIOT_PP_SUCCESSOR_6003 6004
+#define RIOT_PP_SUCCESSOR_6004 6005
+#define RIOT_PP_SUCCESSOR_6005 6006
+#define RIOT_PP_SUCCESSOR_6006 6007
+#define RIOT_PP_SUCCESSOR_6007 6008
+#define RIOT_PP_SUCCESSOR_6008 6009
+#define RIOT_PP_SUCCESSOR_6009 6010
+#define RIOT_PP_SUCCESSOR_6010 6011
+#define RIOT_PP_SUCCESSOR_6011 6012
+#define RIOT_PP_SUCCESSOR_6012 6013
+#define RIOT_PP_SUCCESSOR_6013 6014
+#define RIOT_PP_SUCCESSOR_6014 6015
+#define RIOT_PP_SUCCESSOR_6015 6016
+#define RIOT_PP_SUCCESSOR_6016 6017
+#define RIOT_PP_SUCCESSOR_6017 6018
+#define RIOT_PP_SUCCESSOR_6018 6019
+#define RIOT_PP_SUCCESSOR_6019 6020
+#define RIOT_PP_SUCCESSOR_6020 6021
+#define RIOT_PP_SUCCESSOR_6021 6022
+#define RIOT_PP_SUCCESSOR_6022 6023
+#define RIOT_PP_SUCCESSOR_6023 6024
+#define RIOT_PP_SUCCESSOR_6024 6025
+#define RIOT_PP_SUCCESSOR_6025 6026
+#define RIOT_PP_SUCCESSOR_6026 6027
+#define RIOT_PP_SUCCESSOR_6027 6028
+#define RIOT_PP_SUCCESSOR_6028 6029
+#define RIOT_PP_SUCCESSOR_6029 6030
+#define RIOT_PP_SUCCESSOR_6030 6031
+#define RIOT_PP_SUCCESSOR_6031 6032
+#define RIOT_PP_SUCCESSOR_6032 6033
+#define RIOT_PP_SUCCESSOR_6033 6034
+#define RIOT_PP_SUCCESSOR_6034 6035
+#define RIOT_PP_SUCCESSOR_6035 6036
+#define RIOT_PP_SUCCESSOR_6036 6037
+#define RIOT_PP_SUCCESSOR_6037 6038
+#define RIOT_PP_SUCCESSOR_6038 6039
+#define RIOT_PP_SUCCESSOR_6039 6040
+#define RIOT_PP_SUCCESSOR_6040 6041
+#define RIOT_PP_SUCCESSOR_6041 6042
+#define RIOT_PP_SUCCESSOR_6042 6043
+#define RIOT_PP_SUCCESSOR_6043 6044
+#define RIOT_PP_SUCCESSOR_6044 6045
+#define RIOT_PP_SUCCESSOR_6045 6046
+#define RIOT_PP_SUCCESSOR_6046 6047
+#define RIOT_PP_SUCCESSOR_6047 6048
+#define RIOT_PP_SUCCESSOR_6048 6049
+#define RIOT_PP_SUCCESSOR_6049 6050
+#define RIOT_PP_SUCCESSOR_6050 6051
+#define RIOT_PP_SUCCESSOR_6051 6052
+#define RIOT_PP_SUCCESSOR_6052 6053
+#define RIOT_PP_SUCCESSOR_6053 6054
+#define RIOT_PP_SUCCESSOR_6054 6055
+#define RIOT_PP_SUCCESSOR_6055 6056
+#define RIOT_PP_SUCCESSOR_6056 6057
+#define RIOT_PP_SUCCESSOR_6057 6058
+#define RIOT_PP_SUCCESSOR_6058 6059
+#define RIOT_PP_SUCCESSOR_6059 6060
+#define RIOT_PP_SUCCESSOR_6060 6061
+#define RIOT_PP_SUCCESSOR_6061 6062
+#define RIOT_PP_SUCCESSOR_6062 6063
+#define RIOT_PP_SUCCESSOR_6063 6064
+#define RIOT_PP_SUCCESSOR_6064 6065
+#define RIOT_PP_SUCCESSOR_6065 6066
+#define RIOT_PP_SUCCESSOR_6066 6067
+#define RIOT_PP_SUCCESSOR_6067 6068
+#define RIOT_PP_SUCCESSOR_6068 6069
+#define RIOT_PP_SUCCESSOR_6069 6070
+#define RIOT_PP_SUCCESSOR_6070 6071
+#define RIOT_PP_SUCCESSOR_6071 6072
+#define RIOT_PP_SUCCESSOR_6072 6073
+#define RIOT_PP_SUCCESSOR_6073 6074
+#define RIOT_PP_SUCCESSOR_6074 6075
+#define RIOT_PP_SUCCESSOR_6075 6076
+#define RIOT_PP_SUCCESSOR_6076 6077
+#define RIOT_PP_SUCCESSOR_6077 6078
+#define RIOT_PP_SUCCESSOR_6078 6079
+#define RIOT_PP_SUCCESSOR_6079 6080
+#define RIOT_PP_SUCCESSOR_6080 6081
+#define RIOT_PP_SUCCESSOR_6081 6082
+#define RIOT_PP_SUCCESSOR_6082 6083
+#define RIOT_PP_SUCCESSOR_6083 6084
+#define RIOT_PP_SUCCESSOR_6084 6085
+#define RIOT_PP_SUCCESSOR_6085 6086
+#define RIOT_PP_SUCCESSOR_6086 6087
+#define RIOT_PP_SUCCESSOR_6087 6088
+#define RIOT_PP_SUCCESSOR_6088 6089
+#define RIOT_PP_SUCCESSOR_6089 6090
+#define RIOT_PP_SUCCESSOR_6090 6091
+#define RIOT_PP_SUCCESSOR_6091 6092
+#define RIOT_PP_SUCCESSOR_6092 6093
+#define RIOT_PP_SUCCESSOR_6093 6094
+#define RIOT_PP_SUCCESSOR_6094 6095
+#define RIOT_PP_SUCCESSOR_6095 6096
+#define RIOT_PP_SUCCESSOR_6096 6097
+#define RIOT_PP_SUCCESSOR_6097 6098
+#define RIOT_PP_SUCCESSOR_6098 6099
+#define RIOT_PP_SUCCESSOR_6099 6100
+#define RIOT_PP_SUCCESSOR_6100 6101
+#define RIOT_PP_SUCCESSOR_6101 6102
+#define RIOT_PP_SUCCESSOR_6102 6103
+#define RIOT_PP_SUCCESSOR_6103 6104
+#define RIOT_PP_SUCCESSOR_6104 6105
+#define RIOT_PP_SUCCESSOR_6105 6106
+#define RIOT_PP_SUCCESSOR_6106 6107
+#define RIOT_PP_SUCCESSOR_6107 6108
+#define RIOT_PP_SUCCESSOR_6108 6109
+#define RIOT_PP_SUCCESSOR_6109 6110
+#define RIOT_PP_SUCCESSOR_6110 6111
+#define RIOT_PP_SUCCESSOR_6111 6112
+#define RIOT_PP_SUCCESSOR_6112 6113
+#define RIOT_PP_SUCCESSOR_6113 6114
+#define RIOT_PP_SUCCESSOR_6114 6115
+#define RIOT_PP_SUCCESSOR_6115 6116
+#define RIOT_PP_SUCCESSOR_6116 6117
+#define RIOT_PP_SUCCESSOR_6117 6118
+#define RIOT_PP_SUCCESSOR_6118 6119
+#define RIOT_PP_SUCCESSOR_6119 6120
+#define RIOT_PP_SUCCESSOR_6120 6121
+#define RIOT_PP_SUCCESSOR_6121 6122
+#define RIOT_PP_SUCCESSOR_6122 6123
+#define RIOT_PP_SUCCESSOR_6123 6124
+#define RIOT_PP_SUCCESSOR_6124 6125
+#define RIOT_PP_SUCCESSOR_6125 6126
+#define RIOT_PP_SUCCESSOR_6126 6127
+#define RIOT_PP_SUCCESSOR_6127 6128
+#define RIOT_PP_SUCCESSOR_6128 6129
+#define RIOT_PP_SUCCESSOR_6129 6130
+#define RIOT_PP_SUCCESSOR_6130 6131
+#define RIOT_PP_SUCCESSOR_6131 6132
+#define RIOT_PP_SUCCESSOR_6132 6133
+#define RIOT_PP_SUCCESSOR_6133 6134
+#define RIOT_PP_SUCCESSOR_6134 6135
+#define RIOT_PP_SUCCESSOR_6135 6136
+#define RIOT_PP_SUCCESSOR_6136 6137
+#define RIOT_PP_SUCCESSOR_6137 6138
+#define RIOT_PP_SUCCESSOR_6138 6139
+#define RIOT_PP_SUCCESSOR_6139 6140
+#define RIOT_PP_SUCCESSOR_6140 6141
+#define RIOT_PP_SUCCESSOR_6141 6142
+#define RIOT_PP_SUCCESSOR_6142 6143
+#define RIOT_PP_SUCCESSOR_6143 6144
+#define RIOT_PP_SUCCESSOR_6144 6145
+#define RIOT_PP_SUCCESSOR_6145 6146
+#define RIOT_PP_SUCCESSOR_6146 6147
+#define RIOT_PP_SUCCESSOR_6147 6148
+#define RIOT_PP_SUCCESSOR_6148 6149
+#define RIOT_PP_SUCCESSOR_6149 6150
+#define RIOT_PP_SUCCESSOR_6150 6151
+#define RIOT_PP_SUCCESSOR_6151 6152
+#define RIOT_PP_SUCCESSOR_6152 6153
+#define RIOT_PP_SUCCESSOR_6153 6154
+#define RIOT_PP_SUCCESSOR_6154 6155
+#define RIOT_PP_SUCCESSOR_6155 6156
+#define RIOT_PP_SUCCESSOR_6156 6157
+#define RIOT_PP_SUCCESSOR_6157 6158
+#define RIOT_PP_SUCCESSOR_6158 6159
+#define RIOT_PP_SUCCESSOR_6159 6160
+#define RIOT_PP_SUCCESSOR_6160 6161
+#define RIOT_PP_SUCCESSOR_6161 6162
+#define RIOT_PP_SUCCESSOR_6162 6163
+#define RIOT_PP_SUCCESSOR_6163 6164
+#define RIOT_PP_SUCCESSOR_6164 6165
+#define RIOT_PP_SUCCESSOR_6165 6166
+#define RIOT_PP_SUCCESSOR_6166 6167
+#define RIOT_PP_SUCCESSOR_6167 6168
+#define RIOT_PP_SUCCESSOR_6168 6169
+#define RIOT_PP_SUCCESSOR_6169 6170
+#define RIOT_PP_SUCCESSOR_6170 6171
+#define RIOT_PP_SUCCESSOR_6171 6172
+#define RIOT_PP_SUCCESSOR_6172 6173
+#define RIOT_PP_SUCCESSOR_6173 6174
+#define RIOT_PP_SUCCESSOR_6174 6175
+#define RIOT_PP_SUCCESSOR_6175 6176
+#define RIOT_PP_SUCCESSOR_6176 6177
+#define RIOT_PP_SUCCESSOR_6177 6178
+#define RIOT_PP_SUCCESSOR_6178 6179
+#define RIOT_PP_SUCCESSOR_6179 6180
+#define RIOT_PP_SUCCESSOR_6180 6181
+#define RIOT_PP_SUCCESSOR_6181 6182
+#define RIOT_PP_SUCCESSOR_6182 6183
+#define RIOT_PP_SUCCESSOR_6183 6184
+#define RIOT_PP_SUCCESSOR_6184 6185
+#define RIOT_PP_SUCCESSOR_6185 6186
+#define RIOT_PP_SUCCESSOR_6186 6187
+#define RIOT_PP_SUCCESSOR_6187 6188
+#define RIOT_PP_SUCCESSOR_6188 6189
+#define RIOT_PP_SUCCESSOR_6189 6190
+#define RIOT_PP_SUCCESSOR_6190 6191
+#define RIOT_PP_SUCCESSOR_6191 6192
+#define RIOT_PP_SUCCESSOR_6192 6193
+#define RIOT_PP_SUCCESSOR_6193 6194
+#define RIOT_PP_SUCCESSOR_6194 6195
+#define RIOT_PP_SUCCESSOR_6195 6196
+#define RIOT_PP_SUCCESSOR_6196 6197
+#define RIOT_PP_SUCCESSOR_6197 6198
+#define RIOT_PP_SUCCESSOR_6198 6199
+#define RIOT_PP_SUCCESSOR_6199 6200
+#define RIOT_PP_SUCCESSOR_6200 6201
+#define RIOT_PP_SUCCESSOR_6201 6202
+#define RIOT_PP_SUCCESSOR_6202 6203
+#define RIOT_PP_SUCCESSOR_6203 6204
+#define RIOT_PP_SUCCESSOR_6204 6205
+#define RIOT_PP_SUCCESSOR_6205 6206
+#define RIOT_PP_SUCCESSOR_6206 6207
+#define RIOT_PP_SUCCESSOR_6207 6208
+#define RIOT_PP_SUCCESSOR_6208 6209
+#define RIOT_PP_SUCCESSOR_6209 6210
+#define RIOT_PP_SUCCESSOR_6210 6211
+#define RIOT_PP_SUCCESSOR_6211 6212
+#define RIOT_PP_SUCCESSOR_6212 6213
+#define RIOT_PP_SUCCESSOR_6213 6214
+#define RIOT_PP_SUCCESSOR_6214 6215
+#define RIOT_PP_SUCCESSOR_6215 6216
+#define RIOT_PP_SUCCESSOR_6216 6217
+#define RIOT_PP_SUCCESSOR_6217 6218
+#define RIOT_PP_SUCCESSOR_6218 6219
+#define RIOT_PP_SUCCESSOR_6219 6220
+#define RIOT_PP_SUCCESSOR_6220 6221
+#define RIOT_PP_SUCCESSOR_6221 6222
+#define RIOT_PP_SUCCESSOR_6222 6223
+#define RIOT_PP_SUCCESSOR_6223 6224
+#define RIOT_PP_SUCCESSOR_6224 6225
+#define RIOT_PP_SUCCESSOR_6225 6226
+#define RIOT_PP_SUCCESSOR_6226 6227
+#define RIOT_PP_SUCCESSOR_6227 6228
+#define RIOT_PP_SUCCESSOR_6228 6229
+#define RIOT_PP_SUCCESSOR_6229 6230
+#define RIOT_PP_SUCCESSOR_6230 6231
+#define RIOT_PP_SUCCESSOR_6231 6232
+#define RIOT_PP_SUCCESSOR_6232 6233
+#define RIOT_PP_SUCCESSOR_6233 6234
+#define RIOT_PP_SUCCESSOR_6234 6235
+#define RIOT_PP_SUCCESSOR_6235 6236
+#define RIOT_PP_SUCCESSOR_6236 6237
+#define RIOT_PP_SUCCESSOR_6237 6238
+#define RIOT_PP_SUCCESSOR_6238 6239
+#define RIOT_PP_SUCCESSOR_6239 6240
+#define RIOT_PP_SUCCESSOR_6240 6241
+#define RIOT_PP_SUCCESSOR_6241 6242
+#define RIOT_PP_SUCCESSOR_6242 6243
+#define RIOT_PP_SUCCESSOR_6243 6244
+#define RIOT_PP_SUCCESSOR_6244 6245
+#define RIOT_PP_SUCCESSOR_6245 6246
+#define RIOT_PP_SUCCESSOR_6246 6247
+#define RIOT_PP_SUCCESSOR_6247 6248
+#define RIOT_PP_SUCCESSOR_6248 6249
+#define RIOT_PP_SUCCESSOR_6249 6250
+#define RIOT_PP_SUCCESSOR_6250 6251
+#define RIOT_PP_SUCCESSOR_6251 6252
+#define RIOT_PP_SUCCESSOR_6252 6253
+#define RIOT_PP_SUCCESSOR_6253 6254
+#define RIOT_PP_SUCCESSOR_6254 6255
+#define RIOT_PP_SUCCESSOR_6255 6256
+#define RIOT_PP_SUCCESSOR_6256 6257
+#define RIOT_PP_SUCCESSOR_6257 6258
+#define RIOT_PP_SUCCESSOR_6258 6259
+#define RIOT_PP_SUCCESSOR_6259 6260
+#define RIOT_PP_SUCCESSOR_6260 6261
+#define RIOT_PP_SUCCESSOR_6261 6262
+#define RIOT_PP_SUCCESSOR_6262 6263
+#define RIOT_PP_SUCCESSOR_6263 6264
+#define RIOT_PP_SUCCESSOR_6264 6265
+#define RIOT_PP_SUCCESSOR_6265 6266
+#define RIOT_PP_SUCCESSOR_6266 6267
+#define RIOT_PP_SUCCESSOR_6267 6268
+#define RIOT_PP_SUCCESSOR_6268 6269
+#define RIOT_PP_SUCCESSOR_6269 6270
+#define RIOT_PP_SUCCESSOR_6270 6271
+#define RIOT_PP_SUCCESSOR_6271 6272
+#define RIOT_PP_SUCCESSOR_6272 6273
+#define RIOT_PP_SUCCESSOR_6273 6274
+#define RIOT_PP_SUCCESSOR_6274 6275
+#define RIOT_PP_SUCCESSOR_6275 6276
+#define RIOT_PP_SUCCESSOR_6276 6277
+#define RIOT_PP_SUCCESSOR_6277 6278
+#define RIOT_PP_SUCCESSOR_6278 6279
+#define RIOT_PP_SUCCESSOR_6279 6280
+#define RIOT_PP_SUCCESSOR_6280 6281
+#define RIOT_PP_SUCCESSOR_6281 6282
+#define RIOT_PP_SUCCESSOR_6282 6283
+#define RIOT_PP_SUCCESSOR_6283 6284
+#define RIOT_PP_SUCCESSOR_6284 6285
+#define RIOT_PP_SUCCESSOR_6285 6286
+#define RIOT_PP_SUCCESSOR_6286 6287
+#define RIOT_PP_SUCCESSOR_6287 6288
+#define RIOT_PP_SUCCESSOR_6288 6289
+#define RIOT_PP_SUCCESSOR_6289 6290
+#define RIOT_PP_SUCCESSOR_6290 6291
+#define RIOT_PP_SUCCESSOR_6291 6292
+#define RIOT_PP_SUCCESSOR_6292 6293
+#define RIOT_PP_SUCCESSOR_6293 6294
+#define RIOT_PP_SUCCESSOR_6294 6295
+#define RIOT_PP_SUCCESSOR_6295 6296
+#define RIOT_PP_SUCCESSOR_6296 6297
+#define RIOT_PP_SUCCESSOR_6297 6298
+#define RIOT_PP_SUCCESSOR_6298 6299
+#define RIOT_PP_SUCCESSOR_6299 6300
+#define RIOT_PP_SUCCESSOR_6300 6301
+#define RIOT_PP_SUCCESSOR_6301 6302
+#define RIOT_PP_SUCCESSOR_6302 6303
+#define RIOT_PP_SUCCESSOR_6303 6304
+#define RIOT_PP_SUCCESSOR_6304 6305
+#define RIOT_PP_SUCCESSOR_6305 6306
+#define RIOT_PP_SUCCESSOR_6306 6307
+#define RIOT_PP_SUCCESSOR_6307 6308
+#define RIOT_PP_SUCCESSOR_6308 6309
+#define RIOT_PP_SUCCESSOR_6309 6310
+#define RIOT_PP_SUCCESSOR_6310 6311
+#define RIOT_PP_SUCCESSOR_6311 6312
+#define RIOT_PP_SUCCESSOR_6312 6313
+#define RIOT_PP_SUCCESSOR_6313 6314
+#define RIOT_PP_SUCCESSOR_6314 6315
+#define RIOT_PP_SUCCESSOR_6315 6316
+#define RIOT_PP_SUCCESSOR_6316 6317
+#define RIOT_PP_SUCCESSOR_6317 6318
+#define RIOT_PP_SUCCESSOR_6318 6319
+#define RIOT_PP_SUCCESSOR_6319 6320
+#define RIOT_PP_SUCCESSOR_6320 6321
+#define RIOT_PP_SUCCESSOR_6321 6322
+#define RIOT_PP_SUCCESSOR_6322 6323
+#define RIOT_PP_SUCCESSOR_6323 6324
+#define RIOT_PP_SUCCESSOR_6324 6325
+#define RIOT_PP_SUCCESSOR_6325 6326
+#define RIOT_PP_SUCCESSOR_6326 6327
+#define RIOT_PP_SUCCESSOR_6327 6328
+#define RIOT_PP_SUCCESSOR_6328 6329
+#define RIOT_PP_SUCCESSOR_6329 6330
+#define RIOT_PP_SUCCESSOR_6330 6331
+#define RIOT_PP_SUCCESSOR_6331 6332
+#define RIOT_PP_SUCCESSOR_6332 6333
+#define RIOT_PP_SUCCESSOR_6333 6334
+#define RIOT_PP_SUCCESSOR_6334 6335
+#define RIOT_PP_SUCCESSOR_6335 6336
+#define RIOT_PP_SUCCESSOR_6336 6337
+#define RIOT_PP_SUCCESSOR_6337 6338
+#define RIOT_PP_SUCCESSOR_6338 6339
+#define RIOT_PP_SUCCESSOR_6339 6340
+#define RIOT_PP_SUCCESSOR_6340 6341
+#define RIOT_PP_SUCCESSOR_6341 6342
+#define RIOT_PP_SUCCESSOR_6342 6343
+#define RIOT_PP_SUCCESSOR_6343 6344
+#define RIOT_PP_SUCCESSOR_6344 6345
+#define RIOT_PP_SUCCESSOR_6345 6346
+#define RIOT_PP_SUCCESSOR_6346 6347
+#define RIOT_PP_SUCCESSOR_6347 6348
+#define RIOT_PP_SUCCESSOR_6348 6349
+#define RIOT_PP_SUCCESSOR_6349 6350
+#define RIOT_PP_SUCCESSOR_6350 6351
+#define RIOT_PP_SUCCESSOR_6351 6352
+#define RIOT_PP_SUCCESSOR_6352 6353
+#define RIOT_PP_SUCCESSOR_6353 6354
+#define RIOT_PP_SUCCESSOR_6354 6355
+#define RIOT_PP_SUCCESSOR_6355 6356
+#define RIOT_PP_SUCCESSOR_6356 6357
+#define RIOT_PP_SUCCESSOR_6357 6358
+#define RIOT_PP_SUCCESSOR_6358 6359
+#define RIOT_PP_SUCCESSOR_6359 6360
+#define RIOT_PP_SUCCESSOR_6360 6361
+#define RIOT_PP_SUCCESSOR_6361 6362
+#define RIOT_PP_SUCCESSOR_6362 6363
+#define RIOT_PP_SUCCESSOR_6363 6364
+#define RIOT_PP_SUCCESSOR_6364 6365
+#define RIOT_PP_SUCCESSOR_6365 6366
+#define RIOT_PP_SUCCESSOR_6366 6367
+#define RIOT_PP_SUCCESSOR_6367 6368
+#define RIOT_PP_SUCCESSOR_6368 6369
+#define RIOT_PP_SUCCESSOR_6369 6370
+#define RIOT_PP_SUCCESSOR_6370 6371
+#define RIOT_PP_SUCCESSOR_6371 6372
+#define RIOT_PP_SUCCESSOR_6372 6373
+#define RIOT_PP_SUCCESSOR_6373 6374
+#define RIOT_PP_SUCCESSOR_6374 6375
+#define RIOT_PP_SUCCESSOR_6375 6376
+#define RIOT_PP_SUCCESSOR_6376 6377
+#define RIOT_PP_SUCCESSOR_6377 6378
+#define RIOT_PP_SUCCESSOR_6378 6379
+#define RIOT_PP_SUCCESSOR_6379 6380
+#define RIOT_PP_SUCCESSOR_6380 6381
+#define RIOT_PP_SUCCESSOR_6381 6382
+#define RIOT_PP_SUCCESSOR_6382 6383
+#define RIOT_PP_SUCCESSOR_6383 6384
+#define RIOT_PP_SUCCESSOR_6384 6385
+#define RIOT_PP_SUCCESSOR_6385 6386
+#define RIOT_PP_SUCCESSOR_6386 6387
+#define RIOT_PP_SUCCESSOR_6387 6388
+#define RIOT_PP_SUCCESSOR_6388 6389
+#define RIOT_PP_SUCCESSOR_6389 6390
+#define RIOT_PP_SUCCESSOR_6390 6391
+#define RIOT_PP_SUCCESSOR_6391 6392
+#define RIOT_PP_SUCCESSOR_6392 6393
+#define RIOT_PP_SUCCESSOR_6393 6394
+#define RIOT_PP_SUCCESSOR_6394 6395
+#define RIOT_PP_SUCCESSOR_6395 6396
+#define RIOT_PP_SUCCESSOR_6396 6397
+#define RIOT_PP_SUCCESSOR_6397 6398
+#define RIOT_PP_SUCCESSOR_6398 6399
+#define RIOT_PP_SUCCESSOR_6399 6400
+#define RIOT_PP_SUCCESSOR_6400 6401
+#define RIOT_PP_SUCCESSOR_6401 6402
+#define RIOT_PP_SUCCESSOR_6402 6403
+#define RIOT_PP_SUCCESSOR_6403 6404
+#define RIOT_PP_SUCCESSOR_6404 6405
+#define RIOT_PP_SUCCESSOR_6405 6406
+#define RIOT_PP_SUCCESSOR_6406 6407
+#define RIOT_PP_SUCCESSOR_6407 6408
+#define RIOT_PP_SUCCESSOR_6408 6409
+#define RIOT_PP_SUCCESSOR_6409 6410
+#define RIOT_PP_SUCCESSOR_6410 6411
+#define RIOT_PP_SUCCESSOR_6411 6412
+#define RIOT_PP_SUCCESSOR_6412 6413
+#define RIOT_PP_SUCCESSOR_6413 6414
+#define RIOT_PP_SUCCESSOR_6414 6415
+#define RIOT_PP_SUCCESSOR_6415 6416
+#define RIOT_PP_SUCCESSOR_6416 6417
+#define RIOT_PP_SUCCESSOR_6417 6418
+#define RIOT_PP_SUCCESSOR_6418 6419
+#define RIOT_PP_SUCCESSOR_6419 6420
+#define RIOT_PP_SUCCESSOR_6420 6421
+#define RIOT_PP_SUCCESSOR_6421 6422
+#define RIOT_PP_SUCCESSOR_6422 6423
+#define RIOT_PP_SUCCESSOR_6423 6424
+#define RIOT_PP_SUCCESSOR_6424 6425
+#define RIOT_PP_SUCCESSOR_6425 6426
+#define RIOT_PP_SUCCESSOR_6426 6427
+#define RIOT_PP_SUCCESSOR_6427 6428
+#define RIOT_PP_SUCCESSOR_6428 6429
+#define RIOT_PP_SUCCESSOR_6429 6430
+#define RIOT_PP_SUCCESSOR_6430 6431
+#define RIOT_PP_SUCCESSOR_6431 6432
+#define RIOT_PP_SUCCESSOR_6432 6433
+#define RIOT_PP_SUCCESSOR_6433 6434
+#define RIOT_PP_SUCCESSOR_6434 6435
+#define RIOT_PP_SUCCESSOR_6435 6436
+#define RIOT_PP_SUCCESSOR_6436 6437
+#define RIOT_PP_SUCCESSOR_6437 6438
+#define RIOT_PP_SUCCESSOR_6438 6439
+#define RIOT_PP_SUCCESSOR_6439 6440
+#define RIOT_PP_SUCCESSOR_6440 6441
+#define RIOT_PP_SUCCESSOR_6441 6442
+#define RIOT_PP_SUCCESSOR_6442 6443
+#define RIOT_PP_SUCCESSOR_6443 6444
+#define RIOT_PP_SUCCESSOR_6444 6445
+#define RIOT_PP_SUCCESSOR_6445 6446
+#define RIOT_PP_SUCCESSOR_6446 6447
+#define RIOT_PP_SUCCESSOR_6447 6448
+#define RIOT_PP_SUCCESSOR_6448 6449
+#define RIOT_PP_SUCCESSOR_6449 6450
+#define RIOT_PP_SUCCESSOR_6450 6451
+#define RIOT_PP_SUCCESSOR_6451 6452
+#define RIOT_PP_SUCCESSOR_6452 6453
+#define RIOT_PP_SUCCESSOR_6453 6454
+#define RIOT_PP_SUCCESSOR_6454 6455
+#define RIOT_PP_SUCCESSOR_6455 6456
+#define RIOT_PP_SUCCESSOR_6456 6457
+#define RIOT_PP_SUCCESSOR_6457 6458
+#define RIOT_PP_SUCCESSOR_6458 6459
+#define RIOT_PP_SUCCESSOR_6459 6460
+#define RIOT_PP_SUCCESSOR_6460 6461
+#define RIOT_PP_SUCCESSOR_6461 6462
+#define RIOT_PP_SUCCESSOR_6462 6463
+#define RIOT_PP_SUCCESSOR_6463 6464
+#define RIOT_PP_SUCCESSOR_6464 6465
+#define RIOT_PP_SUCCESSOR_6465 6466
+#define RIOT_PP_SUCCESSOR_6466 6467
+#define RIOT_PP_SUCCESSOR_6467 6468
+#define RIOT_PP_SUCCESSOR_6468 6469
+#define RIOT_PP_SUCCESSOR_6469 6470
+#define RIOT_PP_SUCCESSOR_6470 6471
+#define RIOT_PP_SUCCESSOR_6471 6472
+#define RIOT_PP_SUCCESSOR_6472 6473
+#define RIOT_PP_SUCCESSOR_6473 6474
+#define RIOT_PP_SUCCESSOR_6474 6475
+#define RIOT_PP_SUCCESSOR_6475 6476
+#define RIOT_PP_SUCCESSOR_6476 6477
+#define RIOT_PP_SUCCESSOR_6477 6478
+#define RIOT_PP_SUCCESSOR_6478 6479
+#define RIOT_PP_SUCCESSOR_6479 6480
+#define RIOT_PP_SUCCESSOR_6480 6481
+#define RIOT_PP_SUCCESSOR_6481 6482
+#define RIOT_PP_SUCCESSOR_6482 6483
+#define RIOT_PP_SUCCESSOR_6483 6484
+#define RIOT_PP_SUCCESSOR_6484 6485
+#define RIOT_PP_SUCCESSOR_6485 6486
+#define RIOT_PP_SUCCESSOR_6486 6487
+#define RIOT_PP_SUCCESSOR_6487 6488
+#define RIOT_PP_SUCCESSOR_6488 6489
+#define RIOT_PP_SUCCESSOR_6489 6490
+#define RIOT_PP_SUCCESSOR_6490 6491
+#define RIOT_PP_SUCCESSOR_6491 6492
+#define RIOT_PP_SUCCESSOR_6492 6493
+#define RIOT_PP_SUCCESSOR_6493 6494
+#define RIOT_PP_SUCCESSOR_6494 6495
+#define RIOT_PP_SUCCESSOR_6495 6496
+#define RIOT_PP_SUCCESSOR_6496 6497
+#define RIOT_PP_SUCCESSOR_6497 6498
+#define RIOT_PP_SUCCESSOR_6498 6499
+#define RIOT_PP_SUCCESSOR_6499 6500
+#define RIOT_PP_SUCCESSOR_6500 6501
+#define RIOT_PP_SUCCESSOR_6501 6502
+#define RIOT_PP_SUCCESSOR_6502 6503
+#define RIOT_PP_SUCCESSOR_6503 6504
+#define RIOT_PP_SUCCESSOR_6504 6505
+#define RIOT_PP_SUCCESSOR_6505 6506
+#define RIOT_PP_SUCCESSOR_6506 6507
+#define RIOT_PP_SUCCESSOR_6507 6508
+#define RIOT_PP_SUCCESSOR_6508 6509
+#define RIOT_PP_SUCCESSOR_6509 6510
+#define RIOT_PP_SUCCESSOR_6510 6511
+#define RIOT_PP_SUCCESSOR_6511 6512
+#define RIOT_PP_SUCCESSOR_6512 6513
+#define RIOT_PP_SUCCESSOR_6513 6514
+#define RIOT_PP_SUCCESSOR_6514 6515
+#define RIOT_PP_SUCCESSOR_6515 6516
+#define RIOT_PP_SUCCESSOR_6516 6517
+#define RIOT_PP_SUCCESSOR_6517 6518
+#define RIOT_PP_SUCCESSOR_6518 6519
+#define RIOT_PP_SUCCESSOR_6519 6520
+#define RIOT_PP_SUCCESSOR_6520 6521
+#define RIOT_PP_SUCCESSOR_6521 6522
+#define RIOT_PP_SUCCESSOR_6522 6523
+#define RIOT_PP_SUCCESSOR_6523 6524
+#define RIOT_PP_SUCCESSOR_6524 6525
+#define RIOT_PP_SUCCESSOR_6525 6526
+#define RIOT_PP_SUCCESSOR_6526 6527
+#define RIOT_PP_SUCCESSOR_6527 6528
+#define RIOT_PP_SUCCESSOR_6528 6529
+#define RIOT_PP_SUCCESSOR_6529 6530
+#define RIOT_PP_SUCCESSOR_6530 6531
+#define RIOT_PP_SUCCESSOR_6531 6532
+#define RIOT_PP_SUCCESSOR_6532 6533
+#define RIOT_PP_SUCCESSOR_6533 6534
+#define RIOT_PP_SUCCESSOR_6534 6535
+#define RIOT_PP_SUCCESSOR_6535 6536
+#define RIOT_PP_SUCCESSOR_6536 6537
+#define RIOT_PP_SUCCESSOR_6537 6538
+#define RIOT_PP_SUCCESSOR_6538 6539
+#define RIOT_PP_SUCCESSOR_6539 6540
+#define RIOT_PP_SUCCESSOR_6540 6541
+#define RIOT_PP_SUCCESSOR_6541 6542
+#define RIOT_PP_SUCCESSOR_6542 6543
+#define RIOT_PP_SUCCESSOR_6543 6544
+#define RIOT_PP_SUCCESSOR_6544 6545
+#define RIOT_PP_SUCCESSOR_6545 6546
+#define RIOT_PP_SUCCESSOR_6546 6547
+#define RIOT_PP_SUCCESSOR_6547 6548
+#define RIOT_PP_SUCCESSOR_6548 6549
+#define RIOT_PP_SUCCESSOR_6549 6550
+#define RIOT_PP_SUCCESSOR_6550 6551
+#define RIOT_PP_SUCCESSOR_6551 6552
+#define RIOT_PP_SUCCESSOR_6552 6553
+#define RIOT_PP_SUCCESSOR_6553 6554
+#define RIOT_PP_SUCCESSOR_6554 6555
+#define RIOT_PP_SUCCESSOR_6555 6556
+#define RIOT_PP_SUCCESSOR_6556 6557
+#define RIOT_PP_SUCCESSOR_6557 6558
+#define RIOT_PP_SUCCESSOR_6558 6559
+#define RIOT_PP_SUCCESSOR_6559 6560
+#define RIOT_PP_SUCCESSOR_6560 6561
+#define RIOT_PP_SUCCESSOR_6561 6562
+#define RIOT_PP_SUCCESSOR_6562 6563
+#define RIOT_PP_SUCCESSOR_6563 6564
+#define RIOT_PP_SUCCESSOR_6564 6565
+#define RIOT_PP_SUCCESSOR_6565 6566
+#define RIOT_PP_SUCCESSOR_6566 6567
+#define RIOT_PP_SUCCESSOR_6567 6568
+#define RIOT_PP_SUCCESSOR_6568 6569
+#define RIOT_PP_SUCCESSOR_6569 6570
+#define RIOT_PP_SUCCESSOR_6570 6571
+#define RIOT_PP_SUCCESSOR_6571 6572
+#define RIOT_PP_SUCCESSOR_6572 6573
+#define RIOT_PP_SUCCESSOR_6573 6574
+#define RIOT_PP_SUCCESSOR_6574 6575
+#define RIOT_PP_SUCCESSOR_6575 6576
+#define RIOT_PP_SUCCESSOR_6576 6577
+#define RIOT_PP_SUCCESSOR_6577 6578
+#define RIOT_PP_SUCCESSOR_6578 6579
+#define RIOT_PP_SUCCESSOR_6579 6580
+#define RIOT_PP_SUCCESSOR_6580 6581
+#define RIOT_PP_SUCCESSOR_6581 6582
+#define RIOT_PP_SUCCESSOR_6582 6583
+#define RIOT_PP_SUCCESSOR_6583 6584
+#define RIOT_PP_SUCCESSOR_6584 6585
+#define RIOT_PP_SUCCESSOR_6585 6586
+#define RIOT_PP_SUCCESSOR_6586 6587
+#define RIOT_PP_SUCCESSOR_6587 6588
+#define RIOT_PP_SUCCESSOR_6588 6589
+#define RIOT_PP_SUCCESSOR_6589 6590
+#define RIOT_PP_SUCCESSOR_6590 6591
+#define RIOT_PP_SUCCESSOR_6591 6592
+#define RIOT_PP_SUCCESSOR_6592 6593
+#define RIOT_PP_SUCCESSOR_6593 6594
+#define RIOT_PP_SUCCESSOR_6594 6595
+#define RIOT_PP_SUCCESSOR_6595 6596
+#define RIOT_PP_SUCCESSOR_6596 6597
+#define RIOT_PP_SUCCESSOR_6597 6598
+#define RIOT_PP_SUCCESSOR_6598 6599
+#define RIOT_PP_SUCCESSOR_6599 6600
+#define RIOT_PP_SUCCESSOR_6600 6601
+#define RIOT_PP_SUCCESSOR_6601 6602
+#define RIOT_PP_SUCCESSOR_6602 6603
+#define RIOT_PP_SUCCESSOR_6603 6604
+#define RIOT_PP_SUCCESSOR_6604 6605
+#define RIOT_PP_SUCCESSOR_6605 6606
+#define RIOT_PP_SUCCESSOR_6606 6607
+#define RIOT_PP_SUCCESSOR_6607 6608
+#define RIOT_PP_SUCCESSOR_6608 6609
+#define RIOT_PP_SUCCESSOR_6609 6610
+#define RIOT_PP_SUCCESSOR_6610 6611
+#define RIOT_PP_SUCCESSOR_6611 6612
+#define RIOT_PP_SUCCESSOR_6612 6613
+#define RIOT_PP_SUCCESSOR_6613 6614
+#define RIOT_PP_SUCCESSOR_6614 6615
+#define RIOT_PP_SUCCESSOR_6615 6616
+#define RIOT_PP_SUCCESSOR_6616 6617
+#define RIOT_PP_SUCCESSOR_6617 6618
+#define RIOT_PP_SUCCESSOR_6618 6619
+#define RIOT_PP_SUCCESSOR_6619 6620
+#define RIOT_PP_SUCCESSOR_6620 6621
+#define RIOT_PP_SUCCESSOR_6621 6622
+#define RIOT_PP_SUCCESSOR_6622 6623
+#define RIOT_PP_SUCCESSOR_6623 6624
+#define RIOT_PP_SUCCESSOR_6624 6625
+#define RIOT_PP_SUCCESSOR_6625 6626
+#define RIOT_PP_SUCCESSOR_6626 6627
+#define RIOT_PP_SUCCESSOR_6627 6628
+#define RIOT_PP_SUCCESSOR_6628 6629
+#define RIOT_PP_SUCCESSOR_6629 6630
+#define RIOT_PP_SUCCESSOR_6630 6631
+#define RIOT_PP_SUCCESSOR_6631 6632
+#define RIOT_PP_SUCCESSOR_6632 6633
+#define RIOT_PP_SUCCESSOR_6633 6634
+#define RIOT_PP_SUCCESSOR_6634 6635
+#define RIOT_PP_SUCCESSOR_6635 6636
+#define RIOT_PP_SUCCESSOR_6636 6637
+#define RIOT_PP_SUCCESSOR_6637 6638
+#define RIOT_PP_SUCCESSOR_6638 6639
+#define RIOT_PP_SUCCESSOR_6639 6640
+#define RIOT_PP_SUCCESSOR_6640 6641
+#define RIOT_PP_SUCCESSOR_6641 6642
+#define RIOT_PP_SUCCESSOR_6642 6643
+#define RIOT_PP_SUCCESSOR_6643 6644
+#define RIOT_PP_SUCCESSOR_6644 6645
+#define RIOT_PP_SUCCESSOR_6645 6646
+#define RIOT_PP_SUCCESSOR_6646 6647
+#define RIOT_PP_SUCCESSOR_6647 6648
+#define RIOT_PP_SUCCESSOR_6648 6649
+#define RIOT_PP_SUCCESSOR_6649 6650
+#define RIOT_PP_SUCCESSOR_6650 6651
+#define RIOT_PP_SUCCESSOR_6651 6652
+#define RIOT_PP_SUCCESSOR_6652 6653
+#define RIOT_PP_SUCCESSOR_6653 6654
+#define RIOT_PP_SUCCESSOR_6654 6655
+#define RIOT_PP_SUCCESSOR_6655 6656
+#define RIOT_PP_SUCCESSOR_6656 6657
+#define RIOT_PP_SUCCESSOR_6657 6658
+#define RIOT_PP_SUCCESSOR_6658 6659
+#define RIOT_PP_SUCCESSOR_6659 6660
+#define RIOT_PP_SUCCESSOR_6660 6661
+#define RIOT_PP_SUCCESSOR_6661 6662
+#define RIOT_PP_SUCCESSOR_6662 6663
+#define RIOT_PP_SUCCESSOR_6663 6664
+#define RIOT_PP_SUCCESSOR_6664 6665
+#define RIOT_PP_SUCCESSOR_6665 6666
+#define RIOT_PP_SUCCESSOR_6666 6667
+#define RIOT_PP_SUCCESSOR_6667 6668
+#define RIOT_PP_SUCCESSOR_6668 6669
+#define RIOT_PP_SUCCESSOR_6669 6670
+#define RIOT_PP_SUCCESSOR_6670 6671
+#define RIOT_PP_SUCCESSOR_6671 6672
+#define RIOT_PP_SUCCESSOR_6672 6673
+#define RIOT_PP_SUCCESSOR_6673 6674
+#define RIOT_PP_SUCCESSOR_6674 6675
+#define RIOT_PP_SUCCESSOR_6675 6676
+#define RIOT_PP_SUCCESSOR_6676 6677
+#define RIOT_PP_SUCCESSOR_6677 6678
+#define RIOT_PP_SUCCESSOR_6678 6679
+#define RIOT_PP_SUCCESSOR_6679 6680
+#define RIOT_PP_SUCCESSOR_6680 6681
+#define RIOT_PP_SUCCESSOR_6681 6682
+#define RIOT_PP_SUCCESSOR_6682 6683
+#define RIOT_PP_SUCCESSOR_6683 6684
+#define RIOT_PP_SUCCESSOR_6684 6685
+#define RIOT_PP_SUCCESSOR_6685 6686
+#define RIOT_PP_SUCCESSOR_6686 6687
+#define RIOT_PP_SUCCESSOR_6687 6688
+#define RIOT_PP_SUCCESSOR_6688 6689
+#define RIOT_PP_SUCCESSOR_6689 6690
+#define RIOT_PP_SUCCESSOR_6690 6691
+#define RIOT_PP_SUCCESSOR_6691 6692
+#define RIOT_PP_SUCCESSOR_6692 6693
+#define RIOT_PP_SUCCESSOR_6693 6694
+#define RIOT_PP_SUCCESSOR_6694 6695
+#define RIOT_PP_SUCCESSOR_6695 6696
+#define RIOT_PP_SUCCESSOR_6696 6697
+#define RIOT_PP_SUCCESSOR_6697 6698
+#define RIOT_PP_SUCCESSOR_6698 6699
+#define RIOT_PP_SUCCESSOR_6699 6700
+#define RIOT_PP_SUCCESSOR_6700 6701
+#define RIOT_PP_SUCCESSOR_6701 6702
+#define RIOT_PP_SUCCESSOR_6702 6703
+#define RIOT_PP_SUCCESSOR_6703 6704
+#define RIOT_PP_SUCCESSOR_6704 6705
+#define RIOT_PP_SUCCESSOR_6705 6706
+#define RIOT_PP_SUCCESSOR_6706 6707
+#define RIOT_PP_SUCCESSOR_6707 6708
+#define RIOT_PP_SUCCESSOR_6708 6709
+#define RIOT_PP_SUCCESSOR_6709 6710
+#define RIOT_PP_SUCCESSOR_6710 6711
+#define RIOT_PP_SUCCESSOR_6711 6712
+#define RIOT_PP_SUCCESSOR_6712 6713
+#define RIOT_PP_SUCCESSOR_6713 6714
+#define RIOT_PP_SUCCESSOR_6714 6715
+#define RIOT_PP_SUCCESSOR_6715 6716
+#define RIOT_PP_SUCCESSOR_6716 6717
+#define RIOT_PP_SUCCESSOR_6717 6718
+#define RIOT_PP_SUCCESSOR_6718 6719
+#define RIOT_PP_SUCCESSOR_6719 6720
+#define RIOT_PP_SUCCESSOR_6720 6721
+#define RIOT_PP_SUCCESSOR_6721 6722
+#define RIOT_PP_SUCCESSOR_6722 6723
+#define RIOT_PP_SUCCESSOR_6723 6724
+#define RIOT_PP_SUCCESSOR_6724 6725
+#define RIOT_PP_SUCCESSOR_6725 6726
+#define RIOT_PP_SUCCESSOR_6726 6727
+#define RIOT_PP_SUCCESSOR_6727 6728
+#define RIOT_PP_SUCCESSOR_6728 6729
+#define RIOT_PP_SUCCESSOR_6729 6730
+#define RIOT_PP_SUCCESSOR_6730 6731
+#define RIOT_PP_SUCCESSOR_6731 6732
+#define RIOT_PP_SUCCESSOR_6732 6733
+#define RIOT_PP_SUCCESSOR_6733 6734
+#define RIOT_PP_SUCCESSOR_6734 6735
+#define RIOT_PP_SUCCESSOR_6735 6736
+#define RIOT_PP_SUCCESSOR_6736 6737
+#define RIOT_PP_SUCCESSOR_6737 6738
+#define RIOT_PP_SUCCESSOR_6738 6739
+#define RIOT_PP_SUCCESSOR_6739 6740
+#define RIOT_PP_SUCCESSOR_6740 6741
+#define RIOT_PP_SUCCESSOR_6741 6742
+#define RIOT_PP_SUCCESSOR_6742 6743
+#define RIOT_PP_SUCCESSOR_6743 6744
+#define RIOT_PP_SUCCESSOR_6744 6745
+#define RIOT_PP_SUCCESSOR_6745 6746
+#define RIOT_PP_SUCCESSOR_6746 6747
+#define RIOT_PP_SUCCESSOR_6747 6748
+#define RIOT_PP_SUCCESSOR_6748 6749
+#define RIOT_PP_SUCCESSOR_6749 6750
+#define RIOT_PP_SUCCESSOR_6750 6751
+#define RIOT_PP_SUCCESSOR_6751 6752
+#define RIOT_PP_SUCCESSOR_6752 6753
+#define RIOT_PP_SUCCESSOR_6753 6754
+#define RIOT_PP_SUCCESSOR_6754 6755
+#define RIOT_PP_SUCCESSOR_6755 6756
+#define RIOT_PP_SUCCESSOR_6756 6757
+#define RIOT_PP_SUCCESSOR_6757 6758
+#define RIOT_PP_SUCCESSOR_6758 6759
+#define RIOT_PP_SUCCESSOR_6759 6760
+#define RIOT_PP_SUCCESSOR_6760 6761
+#define RIOT_PP_SUCCESSOR_6761 6762
+#define RIOT_PP_SUCCESSOR_6762 6763
+#define RIOT_PP_SUCCESSOR_6763 6764
+#define RIOT_PP_SUCCESSOR_6764 6765
+#define RIOT_PP_SUCCESSOR_6765 6766
+#define RIOT_PP_SUCCESSOR_6766 6767
+#define RIOT_PP_SUCCESSOR_6767 6768
+#define RIOT_PP_SUCCESSOR_6768 6769
+#define RIOT_PP_SUCCESSOR_6769 6770
+#define RIOT_PP_SUCCESSOR_6770 6771
+#define RIOT_PP_SUCCESSOR_6771 6772
+#define RIOT_PP_SUCCESSOR_6772 6773
+#define RIOT_PP_SUCCESSOR_6773 6774
+#define RIOT_PP_SUCCESSOR_6774 6775
+#define RIOT_PP_SUCCESSOR_6775 6776
+#define RIOT_PP_SUCCESSOR_6776 6777
+#define RIOT_PP_SUCCESSOR_6777 6778
+#define RIOT_PP_SUCCESSOR_6778 6779
+#define RIOT_PP_SUCCESSOR_6779 6780
+#define RIOT_PP_SUCCESSOR_6780 6781
+#define RIOT_PP_SUCCESSOR_6781 6782
+#define RIOT_PP_SUCCESSOR_6782 6783
+#define RIOT_PP_SUCCESSOR_6783 6784
+#define RIOT_PP_SUCCESSOR_6784 6785
+#define RIOT_PP_SUCCESSOR_6785 6786
+#define RIOT_PP_SUCCESSOR_6786 6787
+#define RIOT_PP_SUCCESSOR_6787 6788
+#define RIOT_PP_SUCCESSOR_6788 6789
+#define RIOT_PP_SUCCESSOR_6789 6790
+#define RIOT_PP_SUCCESSOR_6790 6791
+#define RIOT_PP_SUCCESSOR_6791 6792
+#define RIOT_PP_SUCCESSOR_6792 6793
+#define RIOT_PP_SUCCESSOR_6793 6794
+#define RIOT_PP_SUCCESSOR_6794 6795
+#define RIOT_PP_SUCCESSOR_6795 6796
+#define RIOT_PP_SUCCESSOR_6796 6797
+#define RIOT_PP_SUCCESSOR_6797 6798
+#define RIOT_PP_SUCCESSOR_6798 6799
+#define RIOT_PP_SUCCESSOR_6799 6800
+#define RIOT_PP_SUCCESSOR_6800 6801
+#define RIOT_PP_SUCCESSOR_6801 6802
+#define RIOT_PP_SUCCESSOR_6802 6803
+#define RIOT_PP_SUCCESSOR_6803 6804
+#define RIOT_PP_SUCCESSOR_6804 6805
+#define RIOT_PP_SUCCESSOR_6805 6806
+#define RIOT_PP_SUCCESSOR_6806 6807
+#define RIOT_PP_SUCCESSOR_6807 6808
+#define RIOT_PP_SUCCESSOR_6808 6809
+#define RIOT_PP_SUCCESSOR_6809 6810
+#define RIOT_PP_SUCCESSOR_6810 6811
+#define RIOT_PP_SUCCESSOR_6811 6812
+#define RIOT_PP_SUCCESSOR_6812 6813
+#define RIOT_PP_SUCCESSOR_6813 6814
+#define RIOT_PP_SUCCESSOR_6814 6815
+#define RIOT_PP_SUCCESSOR_6815 6816
+#define RIOT_PP_SUCCESSOR_6816 6817
+#define RIOT_PP_SUCCESSOR_6817 6818
+#define RIOT_PP_SUCCESSOR_6818 6819
+#define RIOT_PP_SUCCESSOR_6819 6820
+#define RIOT_PP_SUCCESSOR_6820 6821
+#define RIOT_PP_SUCCESSOR_6821 6822
+#define RIOT_PP_SUCCESSOR_6822 6823
+#define RIOT_PP_SUCCESSOR_6823 6824
+#define RIOT_PP_SUCCESSOR_6824 6825
+#define RIOT_PP_SUCCESSOR_6825 6826
+#define RIOT_PP_SUCCESSOR_6826 6827
+#define RIOT_PP_SUCCESSOR_6827 6828
+#define RIOT_PP_SUCCESSOR_6828 6829
+#define RIOT_PP_SUCCESSOR_6829 6830
+#define RIOT_PP_SUCCESSOR_6830 6831
+#define RIOT_PP_SUCCESSOR_6831 6832
+#define RIOT_PP_SUCCESSOR_6832 6833
+#define RIOT_PP_SUCCESSOR_6833 6834
+#define RIOT_PP_SUCCESSOR_6834 6835
+#define RIOT_PP_SUCCESSOR_6835 6836
+#define RIOT_PP_SUCCESSOR_6836 6837
+#define RIOT_PP_SUCCESSOR_6837 6838
+#define RIOT_PP_SUCCESSOR_6838 6839
+#define RIOT_PP_SUCCESSOR_6839 6840
+#define RIOT_PP_SUCCESSOR_6840 6841
+#define RIOT_PP_SUCCESSOR_6841 6842
+#define RIOT_PP_SUCCESSOR_6842 6843
+#define RIOT_PP_SUCCESSOR_6843 6844
+#define RIOT_PP_SUCCESSOR_6844 6845
+#define RIOT_PP_SUCCESSOR_6845 6846
+#define RIOT_PP_SUCCESSOR_6846 6847
+#define RIOT_PP_SUCCESSOR_6847 6848
+#define RIOT_PP_SUCCESSOR_6848 6849
+#define RIOT_PP_SUCCESSOR_6849 6850
+#define RIOT_PP_SUCCESSOR_6850 6851
+#define RIOT_PP_SUCCESSOR_6851 6852
+#define RIOT_PP_SUCCESSOR_6852 6853
+#define RIOT_PP_SUCCESSOR_6853 6854
+#define RIOT_PP_SUCCESSOR_6854 6855
+#define RIOT_PP_SUCCESSOR_6855 6856
+#define RIOT_PP_SUCCESSOR_6856 6857
+#define RIOT_PP_SUCCESSOR_6857 6858
+#define RIOT_PP_SUCCESSOR_6858 6859
+#define RIOT_PP_SUCCESSOR_6859 6860
+#define RIOT_PP_SUCCESSOR_6860 6861
+#define RIOT_PP_SUCCESSOR_6861 6862
+#define RIOT_PP_SUCCESSOR_6862 6863
+#define RIOT_PP_SUCCESSOR_6863 6864
+#define RIOT_PP_SUCCESSOR_6864 6865
+#define RIOT_PP_SUCCESSOR_6865 6866
+#define RIOT_PP_SUCCESSOR_6866 6867
+#define RIOT_PP_SUCCESSOR_6867 6868
+#define RIOT_PP_SUCCESSOR_6868 6869
+#define RIOT_PP_SUCCESSOR_6869 6870
+#define RIOT_PP_SUCCESSOR_6870 6871
+#define RIOT_PP_SUCCESSOR_6871 6872
+#define RIOT_PP_SUCCESSOR_6872 6873
+#define RIOT_PP_SUCCESSOR_6873 6874
+#define RIOT_PP_SUCCESSOR_6874 6875
+#define RIOT_PP_SUCCESSOR_6875 6876
+#define RIOT_PP_SUCCESSOR_6876 6877
+#define RIOT_PP_SUCCESSOR_6877 6878
+#define RIOT_PP_SUCCESSOR_6878 6879
+#define RIOT_PP_SUCCESSOR_6879 6880
+#define RIOT_PP_SUCCESSOR_6880 6881
+#define RIOT_PP_SUCCESSOR_6881 6882
+#define RIOT_PP_SUCCESSOR_6882 6883
+#define RIOT_PP_SUCCESSOR_6883 6884
+#define RIOT_PP_SUCCESSOR_6884 6885
+#define RIOT_PP_SUCCESSOR_6885 6886
+#define RIOT_PP_SUCCESSOR_6886 6887
+#define RIOT_PP_SUCCESSOR_6887 6888
+#define RIOT_PP_SUCCESSOR_6888 6889
+#define RIOT_PP_SUCCESSOR_6889 6890
+#define RIOT_PP_SUCCESSOR_6890 6891
+#define RIOT_PP_SUCCESSOR_6891 6892
+#define RIOT_PP_SUCCESSOR_6892 6893
+#define RIOT_PP_SUCCESSOR_6893 6894
+#define RIOT_PP_SUCCESSOR_6894 6895
+#define RIOT_PP_SUCCESSOR_6895 6896
+#define RIOT_PP_SUCCESSOR_6896 6897
+#define RIOT_PP_SUCCESSOR_6897 6898
+#define RIOT_PP_SUCCESSOR_6898 6899
+#define RIOT_PP_SUCCESSOR_6899 6900
+#define RIOT_PP_SUCCESSOR_6900 6901
+#define RIOT_PP_SUCCESSOR_6901 6902
+#define RIOT_PP_SUCCESSOR_6902 6903
+#define RIOT_PP_SUCCESSOR_6903 6904
+#define RIOT_PP_SUCCESSOR_6904 6905
+#define RIOT_PP_SUCCESSOR_6905 6906
+#define RIOT_PP_SUCCESSOR_6906 6907
+#define RIOT_PP_SUCCESSOR_6907 6908
+#define RIOT_PP_SUCCESSOR_6908 6909
+#define RIOT_PP_SUCCESSOR_6909 6910
+#define RIOT_PP_SUCCESSOR_6910 6911
+#define RIOT_PP_SUCCESSOR_6911 6912
+#define RIOT_PP_SUCCESSOR_6912 6913
+#define RIOT_PP_SUCCESSOR_6913 6914
+#define RIOT_PP_SUCCESSOR_6914 6915
+#define RIOT_PP_SUCCESSOR_6915 6916
+#define RIOT_PP_SUCCESSOR_6916 6917
+#define RIOT_PP_SUCCESSOR_6917 6918
+#define RIOT_PP_SUCCESSOR_6918 6919
+#define RIOT_PP_SUCCESSOR_6919 6920
+#define RIOT_PP_SUCCESSOR_6920 6921
+#define RIOT_PP_SUCCESSOR_6921 6922
+#define RIOT_PP_SUCCESSOR_6922 6923
+#define RIOT_PP_SUCCESSOR_6923 6924
+#define RIOT_PP_SUCCESSOR_6924 6925
+#define RIOT_PP_SUCCESSOR_6925 6926
+#define RIOT_PP_SUCCESSOR_6926 6927
+#define RIOT_PP_SUCCESSOR_6927 6928
+#define RIOT_PP_SUCCESSOR_6928 6929
+#define RIOT_PP_SUCCESSOR_6929 6930
+#define RIOT_PP_SUCCESSOR_6930 6931
+#define RIOT_PP_SUCCESSOR_6931 6932
+#define RIOT_PP_SUCCESSOR_6932 6933
+#define RIOT_PP_SUCCESSOR_6933 6934
+#define RIOT_PP_SUCCESSOR_6934 6935
+#define RIOT_PP_SUCCESSOR_6935 6936
+#define RIOT_PP_SUCCESSOR_6936 6937
+#define RIOT_PP_SUCCESSOR_6937 6938
+#define RIOT_PP_SUCCESSOR_6938 6939
+#define RIOT_PP_SUCCESSOR_6939 6940
+#define RIOT_PP_SUCCESSOR_6940 6941
+#define RIOT_PP_SUCCESSOR_6941 6942
+#define RIOT_PP_SUCCESSOR_6942 6943
+#define RIOT_PP_SUCCESSOR_6943 6944
+#define RIOT_PP_SUCCESSOR_6944 6945
+#define RIOT_PP_SUCCESSOR_6945 6946
+#define RIOT_PP_SUCCESSOR_6946 6947
+#define RIOT_PP_SUCCESSOR_6947 6948
+#define RIOT_PP_SUCCESSOR_6948 6949
+#define RIOT_PP_SUCCESSOR_6949 6950
+#define RIOT_PP_SUCCESSOR_6950 6951
+#define RIOT_PP_SUCCESSOR_6951 6952
+#define RIOT_PP_SUCCESSOR_6952 6953
+#define RIOT_PP_SUCCESSOR_6953 6954
+#define RIOT_PP_SUCCESSOR_6954 6955
+#define RIOT_PP_SUCCESSOR_6955 6956
+#define RIOT_PP_SUCCESSOR_6956 6957
+#define RIOT_PP_SUCCESSOR_6957 6958
+#define RIOT_PP_SUCCESSOR_6958 6959
+#define RIOT_PP_SUCCESSOR_6959 6960
+#define RIOT_PP_SUCCESSOR_6960 6961
+#define RIOT_PP_SUCCESSOR_6961 6962
+#define RIOT_PP_SUCCESSOR_6962 6963
+#define RIOT_PP_SUCCESSOR_6963 6964
+#define RIOT_PP_SUCCESSOR_6964 6965
+#define RIOT_PP_SUCCESSOR_6965 6966
+#define RIOT_PP_SUCCESSOR_6966 6967
+#define RIOT_PP_SUCCESSOR_6967 6968
+#define RIOT_PP_SUCCESSOR_6968 6969
+#define RIOT_PP_SUCCESSOR_6969 6970
+#define RIOT_PP_SUCCESSOR_6970 6971
+#define RIOT_PP_SUCCESSOR_6971 6972
+#define RIOT_PP_SUCCESSOR_6972 6973
+#define RIOT_PP_SUCCESSOR_6973 6974
+#define RIOT_PP_SUCCESSOR_6974 6975
+#define RIOT_PP_SUCCESSOR_6975 6976
+#define RIOT_PP_SUCCESSOR_6976 6977
+#define RIOT_PP_SUCCESSOR_6977 6978
+#define RIOT_PP_SUCCESSOR_6978 6979
+#define RIOT_PP_SUCCESSOR_6979 6980
+#define RIOT_PP_SUCCESSOR_6980 6981
+#define RIOT_PP_SUCCESSOR_6981 6982
+#define RIOT_PP_SUCCESSOR_6982 6983
+#define RIOT_PP_SUCCESSOR_6983 6984
+#define RIOT_PP_SUCCESSOR_6984 6985
+#define RIOT_PP_SUCCESSOR_6985 6986
+#define RIOT_PP_SUCCESSOR_6986 6987
+#define RIOT_PP_SUCCESSOR_6987 6988
+#define RIOT_PP_SUCCESSOR_6988 6989
+#define RIOT_PP_SUCCESSOR_6989 6990
+#define RIOT_PP_SUCCESSOR_6990 6991
+#define RIOT_PP_SUCCESSOR_6991 6992
+#define RIOT_PP_SUCCESSOR_6992 6993
+#define RIOT_PP_SUCCESSOR_6993 6994
+#define RIOT_PP_SUCCESSOR_6994 6995
+#define RIOT_PP_SUCCESSOR_6995 6996
+#define RIOT_PP_SUCCESSOR_6996 6997
+#define RIOT_PP_SUCCESSOR_6997 6998
+#define RIOT_PP_SUCCESSOR_6998 6999
+#define RIOT_PP_SUCCESSOR_6999 7000
+#define RIOT_PP_SUCCESSOR_7000 7001
+#define RIOT_PP_SUCCESSOR_7001 7002
+#define RIOT_PP_SUCCESSOR_7002 7003
+#define RIOT_PP_SUCCESSOR_7003 7004
+#define RIOT_PP_SUCCESSOR_7004 7005
+#define RIOT_PP_SUCCESSOR_7005 7006
+#define RIOT_PP_SUCCESSOR_7006 7007
+#define RIOT_PP_SUCCESSOR_7007 7008
+#define RIOT_PP_SUCCESSOR_7008 7009
+#define RIOT_PP_SUCCESSOR_7009 7010
+#define RIOT_PP_SUCCESSOR_7010 7011
+#define RIOT_PP_SUCCESSOR_7011 7012
+#define RIOT_PP_SUCCESSOR_7012 7013
+#define RIOT_PP_SUCCESSOR_7013 7014
+#define RIOT_PP_SUCCESSOR_7014 7015
+#define RIOT_PP_SUCCESSOR_7015 7016
+#define RIOT_PP_SUCCESSOR_7016 7017
+#define RIOT_PP_SUCCESSOR_7017 7018
+#define RIOT_PP_SUCCESSOR_7018 7019
+#define RIOT_PP_SUCCESSOR_7019 7020
+#define RIOT_PP_SUCCESSOR_7020 7021
+#define RIOT_PP_SUCCESSOR_7021 7022
+#define RIOT_PP_SUCCESSOR_7022 7023
+#define RIOT_PP_SUCCESSOR_7023 7024
+#define RIOT_PP_SUCCESSOR_7024 7025
+#define RIOT_PP_SUCCESSOR_7025 7026
+#define RIOT_PP_SUCCESSOR_7026 7027
+#define RIOT_PP_SUCCESSOR_7027 7028
+#define RIOT_PP_SUCCESSOR_7028 7029
+#define RIOT_PP_SUCCESSOR_7029 7030
+#define RIOT_PP_SUCCESSOR_7030 7031
+#define RIOT_PP_SUCCESSOR_7031 7032
+#define RIOT_PP_SUCCESSOR_7032 7033
+#define RIOT_PP_SUCCESSOR_7033 7034
+#define RIOT_PP_SUCCESSOR_7034 7035
+#define RIOT_PP_SUCCESSOR_7035 7036
+#define RIOT_PP_SUCCESSOR_7036 7037
+#define RIOT_PP_SUCCESSOR_7037 7038
+#define RIOT_PP_SUCCESSOR_7038 7039
+#define RIOT_PP_SUCCESSOR_7039 7040
+#define RIOT_PP_SUCCESSOR_7040 7041
+#define RIOT_PP_SUCCESSOR_7041 7042
+#define RIOT_PP_SUCCESSOR_7042 7043
+#define RIOT_PP_SUCCESSOR_7043 7044
+#define RIOT_PP_SUCCESSOR_7044 7045
+#define RIOT_PP_SUCCESSOR_7045 7046
+#define RIOT_PP_SUCCESSOR_7046 7047
+#define RIOT_PP_SUCCESSOR_7047 7048
+#define RIOT_PP_SUCCESSOR_7048 7049
+#define RIOT_PP_SUCCESSOR_7049 7050
+#define RIOT_PP_SUCCESSOR_7050 7051
+#define RIOT_PP_SUCCESSOR_7051 7052
+#define RIOT_PP_SUCCESSOR_7052 7053
+#define RIOT_PP_SUCCESSOR_7053 7054
+#define RIOT_PP_SUCCESSOR_7054 7055
+#define RIOT_PP_SUCCESSOR_7055 7056
+#define RIOT_PP_SUCCESSOR_7056 7057
+#define RIOT_PP_SUCCESSOR_7057 7058
+#define RIOT_PP_SUCCESSOR_7058 7059
+#define RIOT_PP_SUCCESSOR_7059 7060
+#define RIOT_PP_SUCCESSOR_7060 7061
+#define RIOT_PP_SUCCESSOR_7061 7062
+#define RIOT_PP_SUCCESSOR_7062 7063
+#define RIOT_PP_SUCCESSOR_7063 7064
+#define RIOT_PP_SUCCESSOR_7064 7065
+#define RIOT_PP_SUCCESSOR_7065 7066
+#define RIOT_PP_SUCCESSOR_7066 7067
+#define RIOT_PP_SUCCESSOR_7067 7068
+#define RIOT_PP_SUCCESSOR_7068 7069
+#define RIOT_PP_SUCCESSOR_7069 7070
+#define RIOT_PP_SUCCESSOR_7070 7071
+#define RIOT_PP_SUCCESSOR_7071 7072
+#define RIOT_PP_SUCCESSOR_7072 7073
+#define RIOT_PP_SUCCESSOR_7073 7074
+#define RIOT_PP_SUCCESSOR_7074 7075
+#define RIOT_PP_SUCCESSOR_7075 7076
+#define RIOT_PP_SUCCESSOR_7076 7077
+#define RIOT_PP_SUCCESSOR_7077 7078
+#define RIOT_PP_SUCCESSOR_7078 7079
+#define RIOT_PP_SUCCESSOR_7079 7080
+#define RIOT_PP_SUCCESSOR_7080 7081
+#define RIOT_PP_SUCCESSOR_7081 7082
+#define RIOT_PP_SUCCESSOR_7082 7083
+#define RIOT_PP_SUCCESSOR_7083 7084
+#define RIOT_PP_SUCCESSOR_7084 7085
+#define RIOT_PP_SUCCESSOR_7085 7086
+#define RIOT_PP_SUCCESSOR_7086 7087
+#define RIOT_PP_SUCCESSOR_7087 7088
+#define RIOT_PP_SUCCESSOR_7088 7089
+#define RIOT_PP_SUCCESSOR_7089 7090
+#define RIOT_PP_SUCCESSOR_7090 7091
+#define RIOT_PP_SUCCESSOR_7091 7092
+#define RIOT_PP_SUCCESSOR_7092 7093
+#define RIOT_PP_SUCCESSOR_7093 7094
+#define RIOT_PP_SUCCESSOR_7094 7095
+#define RIOT_PP_SUCCESSOR_7095 7096
+#define RIOT_PP_SUCCESSOR_7096 7097
+#define RIOT_PP_SUCCESSOR_7097 7098
+#define RIOT_PP_SUCCESSOR_7098 7099
+#define RIOT_PP_SUCCESSOR_7099 7100
+#define RIOT_PP_SUCCESSOR_7100 7101
+#define RIOT_PP_SUCCESSOR_7101 7102
+#define RIOT_PP_SUCCESSOR_7102 7103
+#define RIOT_PP_SUCCESSOR_7103 7104
+#define RIOT_PP_SUCCESSOR_7104 7105
+#define RIOT_PP_SUCCESSOR_7105 7106
+#define RIOT_PP_SUCCESSOR_7106 7107
+#define RIOT_PP_SUCCESSOR_7107 7108
+#define RIOT_PP_SUCCESSOR_7108 7109
+#define RIOT_PP_SUCCESSOR_7109 7110
+#define RIOT_PP_SUCCESSOR_7110 7111
+#define RIOT_PP_SUCCESSOR_7111 7112
+#define RIOT_PP_SUCCESSOR_7112 7113
+#define RIOT_PP_SUCCESSOR_7113 7114
+#define RIOT_PP_SUCCESSOR_7114 7115
+#define RIOT_PP_SUCCESSOR_7115 7116
+#define RIOT_PP_SUCCESSOR_7116 7117
+#define RIOT_PP_SUCCESSOR_7117 7118
+#define RIOT_PP_SUCCESSOR_7118 7119
+#define RIOT_PP_SUCCESSOR_7119 7120
+#define RIOT_PP_SUCCESSOR_7120 7121
+#define RIOT_PP_SUCCESSOR_7121 7122
+#define RIOT_PP_SUCCESSOR_7122 7123
+#define RIOT_PP_SUCCESSOR_7123 7124
+#define RIOT_PP_SUCCESSOR_7124 7125
+#define RIOT_PP_SUCCESSOR_7125 7126
+#define RIOT_PP_SUCCESSOR_7126 7127
+#define RIOT_PP_SUCCESSOR_7127 7128
+#define RIOT_PP_SUCCESSOR_7128 7129
+#define RIOT_PP_SUCCESSOR_7129 7130
+#define RIOT_PP_SUCCESSOR_7130 7131
+#define RIOT_PP_SUCCESSOR_7131 7132
+#define RIOT_PP_SUCCESSOR_7132 7133
+#define RIOT_PP_SUCCESSOR_7133 7134
+#define RIOT_PP_SUCCESSOR_7134 7135
+#define RIOT_PP_SUCCESSOR_7135 7136
+#define RIOT_PP_SUCCESSOR_7136 7137
+#define RIOT_PP_SUCCESSOR_7137 7138
+#define RIOT_PP_SUCCESSOR_7138 7139
+#define RIOT_PP_SUCCESSOR_7139 7140
+#define RIOT_PP_SUCCESSOR_7140 7141
+#define RIOT_PP_SUCCESSOR_7141 7142
+#define RIOT_PP_SUCCESSOR_7142 7143
+#define RIOT_PP_SUCCESSOR_7143 7144
+#define RIOT_PP_SUCCESSOR_7144 7145
+#define RIOT_PP_SUCCESSOR_7145 7146
+#define RIOT_PP_SUCCESSOR_7146 7147
+#define RIOT_PP_SUCCESSOR_7147 7148
+#define RIOT_PP_SUCCESSOR_7148 7149
+#define RIOT_PP_SUCCESSOR_7149 7150
+#define RIOT_PP_SUCCESSOR_7150 7151
+#define RIOT_PP_SUCCESSOR_7151 7152
+#define RIOT_PP_SUCCESSOR_7152 7153
+#define RIOT_PP_SUCCESSOR_7153 7154
+#define RIOT_PP_SUCCESSOR_7154 7155
+#define RIOT_PP_SUCCESSOR_7155 7156
+#define RIOT_PP_SUCCESSOR_7156 7157
+#define RIOT_PP_SUCCESSOR_7157 7158
+#define RIOT_PP_SUCCESSOR_7158 7159
+#define RIOT_PP_SUCCESSOR_7159 7160
+#define RIOT_PP_SUCCESSOR_7160 7161
+#define RIOT_PP_SUCCESSOR_7161 7162
+#define RIOT_PP_SUCCESSOR_7162 7163
+#define RIOT_PP_SUCCESSOR_7163 7164
+#define RIOT_PP_SUCCESSOR_7164 7165
+#define RIOT_PP_SUCCESSOR_7165 7166
+#define RIOT_PP_SUCCESSOR_7166 7167
+#define RIOT_PP_SUCCESSOR_7167 7168
+#define RIOT_PP_SUCCESSOR_7168 7169
+#define RIOT_PP_SUCCESSOR_7169 7170
+#define RIOT_PP_SUCCESSOR_7170 7171
+#define RIOT_PP_SUCCESSOR_7171 7172
+#define RIOT_PP_SUCCESSOR_7172 7173
+#define RIOT_PP_SUCCESSOR_7173 7174
+#define RIOT_PP_SUCCESSOR_7174 7175
+#define RIOT_PP_SUCCESSOR_7175 7176
+#define RIOT_PP_SUCCESSOR_7176 7177
+#define RIOT_PP_SUCCESSOR_7177 7178
+#define RIOT_PP_SUCCESSOR_7178 7179
+#define RIOT_PP_SUCCESSOR_7179 7180
+#define RIOT_PP_SUCCESSOR_7180 7181
+#define RIOT_PP_SUCCESSOR_7181 7182
+#define RIOT_PP_SUCCESSOR_7182 7183
+#define RIOT_PP_SUCCESSOR_7183 7184
+#define RIOT_PP_SUCCESSOR_7184 7185
+#define RIOT_PP_SUCCESSOR_7185 7186
+#define RIOT_PP_SUCCESSOR_7186 7187
+#define RIOT_PP_SUCCESSOR_7187 7188
+#define RIOT_PP_SUCCESSOR_7188 7189
+#define RIOT_PP_SUCCESSOR_7189 7190
+#define RIOT_PP_SUCCESSOR_7190 7191
+#define RIOT_PP_SUCCESSOR_7191 7192
+#define RIOT_PP_SUCCESSOR_7192 7193
+#define RIOT_PP_SUCCESSOR_7193 7194
+#define RIOT_PP_SUCCESSOR_7194 7195
+#define RIOT_PP_SUCCESSOR_7195 7196
+#define RIOT_PP_SUCCESSOR_7196 7197
+#define RIOT_PP_SUCCESSOR_7197 7198
+#define RIOT_PP_SUCCESSOR_7198 7199
+#define RIOT_PP_SUCCESSOR_7199 7200
+#define RIOT_PP_SUCCESSOR_7200 7201
+#define RIOT_PP_SUCCESSOR_7201 7202
+#define RIOT_PP_SUCCESSOR_7202 7203
+#define RIOT_PP_SUCCESSOR_7203 7204
+#define RIOT_PP_SUCCESSOR_7204 7205
+#define RIOT_PP_SUCCESSOR_7205 7206
+#define RIOT_PP_SUCCESSOR_7206 7207
+#define RIOT_PP_SUCCESSOR_7207 7208
+#define RIOT_PP_SUCCESSOR_7208 7209
+#define RIOT_PP_SUCCESSOR_7209 7210
+#define RIOT_PP_SUCCESSOR_7210 7211
+#define RIOT_PP_SUCCESSOR_7211 7212
+#define RIOT_PP_SUCCESSOR_7212 7213
+#define RIOT_PP_SUCCESSOR_7213 7214
+#define RIOT_PP_SUCCESSOR_7214 7215
+#define RIOT_PP_SUCCESSOR_7215 7216
+#define RIOT_PP_SUCCESSOR_7216 7217
+#define RIOT_PP_SUCCESSOR_7217 7218
+#define RIOT_PP_SUCCESSOR_7218 7219
+#define RIOT_PP_SUCCESSOR_7219 7220
+#define RIOT_PP_SUCCESSOR_7220 7221
+#define RIOT_PP_SUCCESSOR_7221 7222
+#define RIOT_PP_SUCCESSOR_7222 7223
+#define RIOT_PP_SUCCESSOR_7223 7224
+#define RIOT_PP_SUCCESSOR_7224 7225
+#define RIOT_PP_SUCCESSOR_7225 7226
+#define RIOT_PP_SUCCESSOR_7226 7227
+#define RIOT_PP_SUCCESSOR_7227 7228
+#define RIOT_PP_SUCCESSOR_7228 7229
+#define RIOT_PP_SUCCESSOR_7229 7230
+#define RIOT_PP_SUCCESSOR_7230 7231
+#define RIOT_PP_SUCCESSOR_7231 7232
+#define RIOT_PP_SUCCESSOR_7232 7233
+#define RIOT_PP_SUCCESSOR_7233 7234
+#define RIOT_PP_SUCCESSOR_7234 7235
+#define RIOT_PP_SUCCESSOR_7235 7236
+#define RIOT_PP_SUCCESSOR_7236 7237
+#define RIOT_PP_SUCCESSOR_7237 7238
+#define RIOT_PP_SUCCESSOR_7238 7239
+#define RIOT_PP_SUCCESSOR_7239 7240
+#define RIOT_PP_SUCCESSOR_7240 7241
+#define RIOT_PP_SUCCESSOR_7241 7242
+#define RIOT_PP_SUCCESSOR_7242 7243
+#define RIOT_PP_SUCCESSOR_7243 7244
+#define RIOT_PP_SUCCESSOR_7244 7245
+#define RIOT_PP_SUCCESSOR_7245 7246
+#define RIOT_PP_SUCCESSOR_7246 7247
+#define RIOT_PP_SUCCESSOR_7247 7248
+#define RIOT_PP_SUCCESSOR_7248 7249
+#define RIOT_PP_SUCCESSOR_7249 7250
+#define RIOT_PP_SUCCESSOR_7250 7251
+#define RIOT_PP_SUCCESSOR_7251 7252
+#define RIOT_PP_SUCCESSOR_7252 7253
+#define RIOT_PP_SUCCESSOR_7253 7254
+#define RIOT_PP_SUCCESSOR_7254 7255
+#define RIOT_PP_SUCCESSOR_7255 7256
+#define RIOT_PP_SUCCESSOR_7256 7257
+#define RIOT_PP_SUCCESSOR_7257 7258
+#define RIOT_PP_SUCCESSOR_7258 7259
+#define RIOT_PP_SUCCESSOR_7259 7260
+#define RIOT_PP_SUCCESSOR_7260 7261
+#define RIOT_PP_SUCCESSOR_7261 7262
+#define RIOT_PP_SUCCESSOR_7262 7263
+#define RIOT_PP_SUCCESSOR_7263 7264
+#define RIOT_PP_SUCCESSOR_7264 7265
+#define RIOT_PP_SUCCESSOR_7265 7266
+#define RIOT_PP_SUCCESSOR_7266 7267
+#define RIOT_PP_SUCCESSOR_7267 7268
+#define RIOT_PP_SUCCESSOR_7268 7269
+#define RIOT_PP_SUCCESSOR_7269 7270
+#define RIOT_PP_SUCCESSOR_7270 7271
+#define RIOT_PP_SUCCESSOR_7271 7272
+#define RIOT_PP_SUCCESSOR_7272 7273
+#define RIOT_PP_SUCCESSOR_7273 7274
+#define RIOT_PP_SUCCESSOR_7274 7275
+#define RIOT_PP_SUCCESSOR_7275 7276
+#define RIOT_PP_SUCCESSOR_7276 7277
+#define RIOT_PP_SUCCESSOR_7277 7278
+#define RIOT_PP_SUCCESSOR_7278 7279
+#define RIOT_PP_SUCCESSOR_7279 7280
+#define RIOT_PP_SUCCESSOR_7280 7281
+#define RIOT_PP_SUCCESSOR_7281 7282
+#define RIOT_PP_SUCCESSOR_7282 7283
+#define RIOT_PP_SUCCESSOR_7283 7284
+#define RIOT_PP_SUCCESSOR_7284 7285
+#define RIOT_PP_SUCCESSOR_7285 7286
+#define RIOT_PP_SUCCESSOR_7286 7287
+#define RIOT_PP_SUCCESSOR_7287 7288
+#define RIOT_PP_SUCCESSOR_7288 7289
+#define RIOT_PP_SUCCESSOR_7289 7290
+#define RIOT_PP_SUCCESSOR_7290 7291
+#define RIOT_PP_SUCCESSOR_7291 7292
+#define RIOT_PP_SUCCESSOR_7292 7293
+#define RIOT_PP_SUCCESSOR_7293 7294
+#define RIOT_PP_SUCCESSOR_7294 7295
+#define RIOT_PP_SUCCESSOR_7295 7296
+#define RIOT_PP_SUCCESSOR_7296 7297
+#define RIOT_PP_SUCCESSOR_7297 7298
+#define RIOT_PP_SUCCESSOR_7298 7299
+#define RIOT_PP_SUCCESSOR_7299 7300
+#define RIOT_PP_SUCCESSOR_7300 7301
+#define RIOT_PP_SUCCESSOR_7301 7302
+#define RIOT_PP_SUCCESSOR_7302 7303
+#define RIOT_PP_SUCCESSOR_7303 7304
+#define RIOT_PP_SUCCESSOR_7304 7305
+#define RIOT_PP_SUCCESSOR_7305 7306
+#define RIOT_PP_SUCCESSOR_7306 7307
+#define RIOT_PP_SUCCESSOR_7307 7308
+#define RIOT_PP_SUCCESSOR_7308 7309
+#define RIOT_PP_SUCCESSOR_7309 7310
+#define RIOT_PP_SUCCESSOR_7310 7311
+#define RIOT_PP_SUCCESSOR_7311 7312
+#define RIOT_PP_SUCCESSOR_7312 7313
+#define RIOT_PP_SUCCESSOR_7313 7314
+#define RIOT_PP_SUCCESSOR_7314 7315
+#define RIOT_PP_SUCCESSOR_7315 7316
+#define RIOT_PP_SUCCESSOR_7316 7317
+#define RIOT_PP_SUCCESSOR_7317 7318
+#define RIOT_PP_SUCCESSOR_7318 7319
+#define RIOT_PP_SUCCESSOR_7319 7320
+#define RIOT_PP_SUCCESSOR_7320 7321
+#define RIOT_PP_SUCCESSOR_7321 7322
+#define RIOT_PP_SUCCESSOR_7322 7323
+#define RIOT_PP_SUCCESSOR_7323 7324
+#define RIOT_PP_SUCCESSOR_7324 7325
+#define RIOT_PP_SUCCESSOR_7325 7326
+#define RIOT_PP_SUCCESSOR_7326 7327
+#define RIOT_PP_SUCCESSOR_7327 7328
+#define RIOT_PP_SUCCESSOR_7328 7329
+#define RIOT_PP_SUCCESSOR_7329 7330
+#define RIOT_PP_SUCCESSOR_7330 7331
+#define RIOT_PP_SUCCESSOR_7331 7332
+#define RIOT_PP_SUCCESSOR_7332 7333
+#define RIOT_PP_SUCCESSOR_7333 7334
+#define RIOT_PP_SUCCESSOR_7334 7335
+#define RIOT_PP_SUCCESSOR_7335 7336
+#define RIOT_PP_SUCCESSOR_7336 7337
+#define RIOT_PP_SUCCESSOR_7337 7338
+#define RIOT_PP_SUCCESSOR_7338 7339
+#define RIOT_PP_SUCCESSOR_7339 7340
+#define RIOT_PP_SUCCESSOR_7340 7341
+#define RIOT_PP_SUCCESSOR_7341 7342
+#define RIOT_PP_SUCCESSOR_7342 7343
+#define RIOT_PP_SUCCESSOR_7343 7344
+#define RIOT_PP_SUCCESSOR_7344 7345
+#define RIOT_PP_SUCCESSOR_7345 7346
+#define RIOT_PP_SUCCESSOR_7346 7347
+#define RIOT_PP_SUCCESSOR_7347 7348
+#define RIOT_PP_SUCCESSOR_7348 7349
+#define RIOT_PP_SUCCESSOR_7349 7350
+#define RIOT_PP_SUCCESSOR_7350 7351
+#define RIOT_PP_SUCCESSOR_7351 7352
+#define RIOT_PP_SUCCESSOR_7352 7353
+#define RIOT_PP_SUCCESSOR_7353 7354
+#define RIOT_PP_SUCCESSOR_7354 7355
+#define RIOT_PP_SUCCESSOR_7355 7356
+#define RIOT_PP_SUCCESSOR_7356 7357
+#define RIOT_PP_SUCCESSOR_7357 7358
+#define RIOT_PP_SUCCESSOR_7358 7359
+#define RIOT_PP_SUCCESSOR_7359 7360
+#define RIOT_PP_SUCCESSOR_7360 7361
+#define RIOT_PP_SUCCESSOR_7361 7362
+#define RIOT_PP_SUCCESSOR_7362 7363
+#define RIOT_PP_SUCCESSOR_7363 7364
+#define RIOT_PP_SUCCESSOR_7364 7365
+#define RIOT_PP_SUCCESSOR_7365 7366
+#define RIOT_PP_SUCCESSOR_7366 7367
+#define RIOT_PP_SUCCESSOR_7367 7368
+#define RIOT_PP_SUCCESSOR_7368 7369
+#define RIOT_PP_SUCCESSOR_7369 7370
+#define RIOT_PP_SUCCESSOR_7370 7371
+#define RIOT_PP_SUCCESSOR_7371 7372
+#define RIOT_PP_SUCCESSOR_7372 7373
+#define RIOT_PP_SUCCESSOR_7373 7374
+#define RIOT_PP_SUCCESSOR_7374 7375
+#define RIOT_PP_SUCCESSOR_7375 7376
+#define RIOT_PP_SUCCESSOR_7376 7377
+#define RIOT_PP_SUCCESSOR_7377 7378
+#define RIOT_PP_SUCCESSOR_7378 7379
+#define RIOT_PP_SUCCESSOR_7379 7380
+#define RIOT_PP_SUCCESSOR_7380 7381
+#define RIOT_PP_SUCCESSOR_7381 7382
+#define RIOT_PP_SUCCESSOR_7382 7383
+#define RIOT_PP_SUCCESSOR_7383 7384
+#define RIOT_PP_SUCCESSOR_7384 7385
+#define RIOT_PP_SUCCESSOR_7385 7386
+#define RIOT_PP_SUCCESSOR_7386 7387
+#define RIOT_PP_SUCCESSOR_7387 7388
+#define RIOT_PP_SUCCESSOR_7388 7389
+#define RIOT_PP_SUCCESSOR_7389 7390
+#define RIOT_PP_SUCCESSOR_7390 7391
+#define RIOT_PP_SUCCESSOR_7391 7392
+#define RIOT_PP_SUCCESSOR_7392 7393
+#define RIOT_PP_SUCCESSOR_7393 7394
+#define RIOT_PP_SUCCESSOR_7394 7395
+#define RIOT_PP_SUCCESSOR_7395 7396
+#define RIOT_PP_SUCCESSOR_7396 7397
+#define RIOT_PP_SUCCESSOR_7397 7398
+#define RIOT_PP_SUCCESSOR_7398 7399
+#define RIOT_PP_SUCCESSOR_7399 7400
+#define RIOT_PP_SUCCESSOR_7400 7401
+#define RIOT_PP_SUCCESSOR_7401 7402
+#define RIOT_PP_SUCCESSOR_7402 7403
+#define RIOT_PP_SUCCESSOR_7403 7404
+#define RIOT_PP_SUCCESSOR_7404 7405
+#define RIOT_PP_SUCCESSOR_7405 7406
+#define RIOT_PP_SUCCESSOR_7406 7407
+#define RIOT_PP_SUCCESSOR_7407 7408
+#define RIOT_PP_SUCCESSOR_7408 7409
+#define RIOT_PP_SUCCESSOR_7409 7410
+#define RIOT_PP_SUCCESSOR_7410 7411
+#define RIOT_PP_SUCCESSOR_7411 7412
+#define RIOT_PP_SUCCESSOR_7412 7413
+#define RIOT_PP_SUCCESSOR_7413 7414
+#define RIOT_PP_SUCCESSOR_7414 7415
+#define RIOT_PP_SUCCESSOR_7415 7416
+#define RIOT_PP_SUCCESSOR_7416 7417
+#define RIOT_PP_SUCCESSOR_7417 7418
+#define RIOT_PP_SUCCESSOR_7418 7419
+#define RIOT_PP_SUCCESSOR_7419 7420
+#define RIOT_PP_SUCCESSOR_7420 7421
+#define RIOT_PP_SUCCESSOR_7421 7422
+#define RIOT_PP_SUCCESSOR_7422 7423
+#define RIOT_PP_SUCCESSOR_7423 7424
+#define RIOT_PP_SUCCESSOR_7424 7425
+#define RIOT_PP_SUCCESSOR_7425 7426
+#define RIOT_PP_SUCCESSOR_7426 7427
+#define RIOT_PP_SUCCESSOR_7427 7428
+#define RIOT_PP_SUCCESSOR_7428 7429
+#define RIOT_PP_SUCCESSOR_7429 7430
+#define RIOT_PP_SUCCESSOR_7430 7431
+#define RIOT_PP_SUCCESSOR_7431 7432
+#define RIOT_PP_SUCCESSOR_7432 7433
+#define RIOT_PP_SUCCESSOR_7433 7434
+#define RIOT_PP_SUCCESSOR_7434 7435
+#define RIOT_PP_SUCCESSOR_7435 7436
+#define RIOT_PP_SUCCESSOR_7436 7437
+#define RIOT_PP_SUCCESSOR_7437 7438
+#define RIOT_PP_SUCCESSOR_7438 7439
+#define RIOT_PP_SUCCESSOR_7439 7440
+#define RIOT_PP_SUCCESSOR_7440 7441
+#define RIOT_PP_SUCCESSOR_7441 7442
+#define RIOT_PP_SUCCESSOR_7442 7443
+#define RIOT_PP_SUCCESSOR_7443 7444
+#define RIOT_PP_SUCCESSOR_7444 7445
+#define RIOT_PP_SUCCESSOR_7445 7446
+#define RIOT_PP_SUCCESSOR_7446 7447
+#define RIOT_PP_SUCCESSOR_7447 7448
+#define RIOT_PP_SUCCESSOR_7448 7449
+#define RIOT_PP_SUCCESSOR_7449 7450
+#define RIOT_PP_SUCCESSOR_7450 7451
+#define RIOT_PP_SUCCESSOR_7451 7452
+#define RIOT_PP_SUCCESSOR_7452 7453
+#define RIOT_PP_SUCCESSOR_7453 7454
+#define RIOT_PP_SUCCESSOR_7454 7455
+#define RIOT_PP_SUCCESSOR_7455 7456
+#define RIOT_PP_SUCCESSOR_7456 7457
+#define RIOT_PP_SUCCESSOR_7457 7458
+#define RIOT_PP_SUCCESSOR_7458 7459
+#define RIOT_PP_SUCCESSOR_7459 7460
+#define RIOT_PP_SUCCESSOR_7460 7461
+#define RIOT_PP_SUCCESSOR_7461 7462
+#define RIOT_PP_SUCCESSOR_7462 7463
+#define RIOT_PP_SUCCESSOR_7463 7464
+#define RIOT_PP_SUCCESSOR_7464 7465
+#define RIOT_PP_SUCCESSOR_7465 7466
+#define RIOT_PP_SUCCESSOR_7466 7467
+#define RIOT_PP_SUCCESSOR_7467 7468
+#define RIOT_PP_SUCCESSOR_7468 7469
+#define RIOT_PP_SUCCESSOR_7469 7470
+#define RIOT_PP_SUCCESSOR_7470 7471
+#define RIOT_PP_SUCCESSOR_7471 7472
+#define RIOT_PP_SUCCESSOR_7472 7473
+#define RIOT_PP_SUCCESSOR_7473 7474
+#define RIOT_PP_SUCCESSOR_7474 7475
+#define RIOT_PP_SUCCESSOR_7475 7476
+#define RIOT_PP_SUCCESSOR_7476 7477
+#define RIOT_PP_SUCCESSOR_7477 7478
+#define RIOT_PP_SUCCESSOR_7478 7479
+#define RIOT_PP_SUCCESSOR_7479 7480
+#define RIOT_PP_SUCCESSOR_7480 7481
+#define RIOT_PP_SUCCESSOR_7481 7482
+#define RIOT_PP_SUCCESSOR_7482 7483
+#define RIOT_PP_SUCCESSOR_7483 7484
+#define RIOT_PP_SUCCESSOR_7484 7485
+#define RIOT_PP_SUCCESSOR_7485 7486
+#define RIOT_PP_SUCCESSOR_7486 7487
+#define RIOT_PP_SUCCESSOR_7487 7488
+#define RIOT_PP_SUCCESSOR_7488 7489
+#define RIOT_PP_SUCCESSOR_7489 7490
+#define RIOT_PP_SUCCESSOR_7490 7491
+#define RIOT_PP_SUCCESSOR_7491 7492
+#define RIOT_PP_SUCCESSOR_7492 7493
+#define RIOT_PP_SUCCESSOR_7493 7494
+#define RIOT_PP_SUCCESSOR_7494 7495
+#define RIOT_PP_SUCCESSOR_7495 7496
+#define RIOT_PP_SUCCESSOR_7496 7497
+#define RIOT_PP_SUCCESSOR_7497 7498
+#define RIOT_PP_SUCCESSOR_7498 7499
+#define RIOT_PP_SUCCESSOR_7499 7500
+#define RIOT_PP_SUCCESSOR_7500 7501
+#define RIOT_PP_SUCCESSOR_7501 7502
+#define RIOT_PP_SUCCESSOR_7502 7503
+#define RIOT_PP_SUCCESSOR_7503 7504
+#define RIOT_PP_SUCCESSOR_7504 7505
+#define RIOT_PP_SUCCESSOR_7505 7506
+#define RIOT_PP_SUCCESSOR_7506 7507
+#define RIOT_PP_SUCCESSOR_7507 7508
+#define RIOT_PP_SUCCESSOR_7508 7509
+#define RIOT_PP_SUCCESSOR_7509 7510
+#define RIOT_PP_SUCCESSOR_7510 7511
+#define RIOT_PP_SUCCESSOR_7511 7512
+#define RIOT_PP_SUCCESSOR_7512 7513
+#define RIOT_PP_SUCCESSOR_7513 7514
+#define RIOT_PP_SUCCESSOR_7514 7515
+#define RIOT_PP_SUCCESSOR_7515 7516
+#define RIOT_PP_SUCCESSOR_7516 7517
+#define RIOT_PP_SUCCESSOR_7517 7518
+#define RIOT_PP_SUCCESSOR_7518 7519
+#define RIOT_PP_SUCCESSOR_7519 7520
+#define RIOT_PP_SUCCESSOR_7520 7521
+#define RIOT_PP_SUCCESSOR_7521 7522
+#define RIOT_PP_SUCCESSOR_7522 7523
+#define RIOT_PP_SUCCESSOR_7523 7524
+#define RIOT_PP_SUCCESSOR_7524 7525
+#define RIOT_PP_SUCCESSOR_7525 7526
+#define RIOT_PP_SUCCESSOR_7526 7527
+#define RIOT_PP_SUCCESSOR_7527 7528
+#define RIOT_PP_SUCCESSOR_7528 7529
+#define RIOT_PP_SUCCESSOR_7529 7530
+#define RIOT_PP_SUCCESSOR_7530 7531
+#define RIOT_PP_SUCCESSOR_7531 7532
+#define RIOT_PP_SUCCESSOR_7532 7533
+#define RIOT_PP_SUCCESSOR_7533 7534
+#define RIOT_PP_SUCCESSOR_7534 7535
+#define RIOT_PP_SUCCESSOR_7535 7536
+#define RIOT_PP_SUCCESSOR_7536 7537
+#define RIOT_PP_SUCCESSOR_7537 7538
+#define RIOT_PP_SUCCESSOR_7538 7539
+#define RIOT_PP_SUCCESSOR_7539 7540
+#define RIOT_PP_SUCCESSOR_7540 7541
+#define RIOT_PP_SUCCESSOR_7541 7542
+#define RIOT_PP_SUCCESSOR_7542 7543
+#define RIOT_PP_SUCCESSOR_7543 7544
+#define RIOT_PP_SUCCESSOR_7544 7545
+#define RIOT_PP_SUCCESSOR_7545 7546
+#define RIOT_PP_SUCCESSOR_7546 7547
+#define RIOT_PP_SUCCESSOR_7547 7548
+#define RIOT_PP_SUCCESSOR_7548 7549
+#define RIOT_PP_SUCCESSOR_7549 7550
+#define RIOT_PP_SUCCESSOR_7550 7551
+#define RIOT_PP_SUCCESSOR_7551 7552
+#define RIOT_PP_SUCCESSOR_7552 7553
+#define RIOT_PP_SUCCESSOR_7553 7554
+#define RIOT_PP_SUCCESSOR_7554 7555
+#define RIOT_PP_SUCCESSOR_7555 7556
+#define RIOT_PP_SUCCESSOR_7556 7557
+#define RIOT_PP_SUCCESSOR_7557 7558
+#define RIOT_PP_SUCCESSOR_7558 7559
+#define RIOT_PP_SUCCESSOR_7559 7560
+#define RIOT_PP_SUCCESSOR_7560 7561
+#define RIOT_PP_SUCCESSOR_7561 7562
+#define RIOT_PP_SUCCESSOR_7562 7563
+#define RIOT_PP_SUCCESSOR_7563 7564
+#define RIOT_PP_SUCCESSOR_7564 7565
+#define RIOT_PP_SUCCESSOR_7565 7566
+#define RIOT_PP_SUCCESSOR_7566 7567
+#define RIOT_PP_SUCCESSOR_7567 7568
+#define RIOT_PP_SUCCESSOR_7568 7569
+#define RIOT_PP_SUCCESSOR_7569 7570
+#define RIOT_PP_SUCCESSOR_7570 7571
+#define RIOT_PP_SUCCESSOR_7571 7572
+#define RIOT_PP_SUCCESSOR_7572 7573
+#define RIOT_PP_SUCCESSOR_7573 7574
+#define RIOT_PP_SUCCESSOR_7574 7575
+#define RIOT_PP_SUCCESSOR_7575 7576
+#define RIOT_PP_SUCCESSOR_7576 7577
+#define RIOT_PP_SUCCESSOR_7577 7578
+#define RIOT_PP_SUCCESSOR_7578 7579
+#define RIOT_PP_SUCCESSOR_7579 7580
+#define RIOT_PP_SUCCESSOR_7580 7581
+#define RIOT_PP_SUCCESSOR_7581 7582
+#define RIOT_PP_SUCCESSOR_7582 7583
+#define RIOT_PP_SUCCESSOR_7583 7584
+#define RIOT_PP_SUCCESSOR_7584 7585
+#define RIOT_PP_SUCCESSOR_7585 7586
+#define RIOT_PP_SUCCESSOR_7586 7587
+#define RIOT_PP_SUCCESSOR_7587 7588
+#define RIOT_PP_SUCCESSOR_7588 7589
+#define RIOT_PP_SUCCESSOR_7589 7590
+#define RIOT_PP_SUCCESSOR_7590 7591
+#define RIOT_PP_SUCCESSOR_7591 7592
+#define RIOT_PP_SUCCESSOR_7592 7593
+#define RIOT_PP_SUCCESSOR_7593 7594
+#define RIOT_PP_SUCCESSOR_7594 7595
+#define RIOT_PP_SUCCESSOR_7595 7596
+#define RIOT_PP_SUCCESSOR_7596 7597
+#define RIOT_PP_SUCCESSOR_7597 7598
+#define RIOT_PP_SUCCESSOR_7598 7599
+#define RIOT_PP_SUCCESSOR_7599 7600
+#define RIOT_PP_SUCCESSOR_7600 7601
+#define RIOT_PP_SUCCESSOR_7601 7602
+#define RIOT_PP_SUCCESSOR_7602 7603
+#define RIOT_PP_SUCCESSOR_7603 7604
+#define RIOT_PP_SUCCESSOR_7604 7605
+#define RIOT_PP_SUCCESSOR_7605 7606
+#define RIOT_PP_SUCCESSOR_7606 7607
+#define RIOT_PP_SUCCESSOR_7607 7608
+#define RIOT_PP_SUCCESSOR_7608 7609
+#define RIOT_PP_SUCCESSOR_7609 7610
+#define RIOT_PP_SUCCESSOR_7610 7611
+#define RIOT_PP_SUCCESSOR_7611 7612
+#define RIOT_PP_SUCCESSOR_7612 7613
+#define RIOT_PP_SUCCESSOR_7613 7614
+#define RIOT_PP_SUCCESSOR_7614 7615
+#define RIOT_PP_SUCCESSOR_7615 7616
+#define RIOT_PP_SUCCESSOR_7616 7617
+#define RIOT_PP_SUCCESSOR_7617 7618
+#define RIOT_PP_SUCCESSOR_7618 7619
+#define RIOT_PP_SUCCESSOR_7619 7620
+#define RIOT_PP_SUCCESSOR_7620 7621
+#define RIOT_PP_SUCCESSOR_7621 7622
+#define RIOT_PP_SUCCESSOR_7622 7623
+#define RIOT_PP_SUCCESSOR_7623 7624
+#define RIOT_PP_SUCCESSOR_7624 7625
+#define RIOT_PP_SUCCESSOR_7625 7626
+#define RIOT_PP_SUCCESSOR_7626 7627
+#define RIOT_PP_SUCCESSOR_7627 7628
+#define RIOT_PP_SUCCESSOR_7628 7629
+#define RIOT_PP_SUCCESSOR_7629 7630
+#define RIOT_PP_SUCCESSOR_7630 7631
+#define RIOT_PP_SUCCESSOR_7631 7632
+#define RIOT_PP_SUCCESSOR_7632 7633
+#define RIOT_PP_SUCCESSOR_7633 7634
+#define RIOT_PP_SUCCESSOR_7634 7635
+#define RIOT_PP_SUCCESSOR_7635 7636
+#define RIOT_PP_SUCCESSOR_7636 7637
+#define RIOT_PP_SUCCESSOR_7637 7638
+#define RIOT_PP_SUCCESSOR_7638 7639
+#define RIOT_PP_SUCCESSOR_7639 7640
+#define RIOT_PP_SUCCESSOR_7640 7641
+#define RIOT_PP_SUCCESSOR_7641 7642
+#define RIOT_PP_SUCCESSOR_7642 7643
+#define RIOT_PP_SUCCESSOR_7643 7644
+#define RIOT_PP_SUCCESSOR_7644 7645
+#define RIOT_PP_SUCCESSOR_7645 7646
+#define RIOT_PP_SUCCESSOR_7646 7647
+#define RIOT_PP_SUCCESSOR_7647 7648
+#define RIOT_PP_SUCCESSOR_7648 7649
+#define RIOT_PP_SUCCESSOR_7649 7650
+#define RIOT_PP_SUCCESSOR_7650 7651
+#define RIOT_PP_SUCCESSOR_7651 7652
+#define RIOT_PP_SUCCESSOR_7652 7653
+#define RIOT_PP_SUCCESSOR_7653 7654
+#define RIOT_PP_SUCCESSOR_7654 7655
+#define RIOT_PP_SUCCESSOR_7655 7656
+#define RIOT_PP_SUCCESSOR_7656 7657
+#define RIOT_PP_SUCCESSOR_7657 7658
+#define RIOT_PP_SUCCESSOR_7658 7659
+#define RIOT_PP_SUCCESSOR_7659 7660
+#define RIOT_PP_SUCCESSOR_7660 7661
+#define RIOT_PP_SUCCESSOR_7661 7662
+#define RIOT_PP_SUCCESSOR_7662 7663
+#define RIOT_PP_SUCCESSOR_7663 7664
+#define RIOT_PP_SUCCESSOR_7664 7665
+#define RIOT_PP_SUCCESSOR_7665 7666
+#define RIOT_PP_SUCCESSOR_7666 7667
+#define RIOT_PP_SUCCESSOR_7667 7668
+#define RIOT_PP_SUCCESSOR_7668 7669
+#define RIOT_PP_SUCCESSOR_7669 7670
+#define RIOT_PP_SUCCESSOR_7670 7671
+#define RIOT_PP_SUCCESSOR_7671 7672
+#define RIOT_PP_SUCCESSOR_7672 7673
+#define RIOT_PP_SUCCESSOR_7673 7674
+#define RIOT_PP_SUCCESSOR_7674 7675
+#define RIOT_PP_SUCCESSOR_7675 7676
+#define RIOT_PP_SUCCESSOR_7676 7677
+#define RIOT_PP_SUCCESSOR_7677 7678
+#define RIOT_PP_SUCCESSOR_7678 7679
+#define RIOT_PP_SUCCESSOR_7679 7680
+#define RIOT_PP_SUCCESSOR_7680 7681
+#define RIOT_PP_SUCCESSOR_7681 7682
+#define RIOT_PP_SUCCESSOR_7682 7683
+#define RIOT_PP_SUCCESSOR_7683 7684
+#define RIOT_PP_SUCCESSOR_7684 7685
+#define RIOT_PP_SUCCESSOR_7685 7686
+#define RIOT_PP_SUCCESSOR_7686 7687
+#define RIOT_PP_SUCCESSOR_7687 7688
+#define RIOT_PP_SUCCESSOR_7688 7689
+#define RIOT_PP_SUCCESSOR_7689 7690
+#define RIOT_PP_SUCCESSOR_7690 7691
+#define RIOT_PP_SUCCESSOR_7691 7692
+#define RIOT_PP_SUCCESSOR_7692 7693
+#define RIOT_PP_SUCCESSOR_7693 7694
+#define RIOT_PP_SUCCESSOR_7694 7695
+#define RIOT_PP_SUCCESSOR_7695 7696
+#define RIOT_PP_SUCCESSOR_7696 7697
+#define RIOT_PP_SUCCESSOR_7697 7698
+#define RIOT_PP_SUCCESSOR_7698 7699
+#define RIOT_PP_SUCCESSOR_7699 7700
+#define RIOT_PP_SUCCESSOR_7700 7701
+#define RIOT_PP_SUCCESSOR_7701 7702
+#define RIOT_PP_SUCCESSOR_7702 7703
+#define RIOT_PP_SUCCESSOR_7703 7704
+#define RIOT_PP_SUCCESSOR_7704 7705
+#define RIOT_PP_SUCCESSOR_7705 7706
+#define RIOT_PP_SUCCESSOR_7706 7707
+#define RIOT_PP_SUCCESSOR_7707 7708
+#define RIOT_PP_SUCCESSOR_7708 7709
+#define RIOT_PP_SUCCESSOR_7709 7710
+#define RIOT_PP_SUCCESSOR_7710 7711
+#define RIOT_PP_SUCCESSOR_7711 7712
+#define RIOT_PP_SUCCESSOR_7712 7713
+#define RIOT_PP_SUCCESSOR_7713 7714
+#define RIOT_PP_SUCCESSOR_7714 7715
+#define RIOT_PP_SUCCESSOR_7715 7716
+#define RIOT_PP_SUCCESSOR_7716 7717
+#define RIOT_PP_SUCCESSOR_7717 7718
+#define RIOT_PP_SUCCESSOR_7718 7719
+#define RIOT_PP_SUCCESSOR_7719 7720
+#define RIOT_PP_SUCCESSOR_7720 7721
+#define RIOT_PP_SUCCESSOR_7721 7722
+#define RIOT_PP_SUCCESSOR_7722 7723
+#define RIOT_PP_SUCCESSOR_7723 7724
+#define RIOT_PP_SUCCESSOR_7724 7725
+#define RIOT_PP_SUCCESSOR_7725 7726
+#define RIOT_PP_SUCCESSOR_7726 7727
+#define RIOT_PP_SUCCESSOR_7727 7728
+#define RIOT_PP_SUCCESSOR_7728 7729
+#define RIOT_PP_SUCCESSOR_7729 7730
+#define RIOT_PP_SUCCESSOR_7730 7731
+#define RIOT_PP_SUCCESSOR_7731 7732
+#define RIOT_PP_SUCCESSOR_7732 7733
+#define RIOT_PP_SUCCESSOR_7733 7734
+#define RIOT_PP_SUCCESSOR_7734 7735
+#define RIOT_PP_SUCCESSOR_7735 7736
+#define RIOT_PP_SUCCESSOR_7736 7737
+#define RIOT_PP_SUCCESSOR_7737 7738
+#define RIOT_PP_SUCCESSOR_7738 7739
+#define RIOT_PP_SUCCESSOR_7739 7740
+#define RIOT_PP_SUCCESSOR_7740 7741
+#define RIOT_PP_SUCCESSOR_7741 7742
+#define RIOT_PP_SUCCESSOR_7742 7743
+#define RIOT_PP_SUCCESSOR_7743 7744
+#define RIOT_PP_SUCCESSOR_7744 7745
+#define RIOT_PP_SUCCESSOR_7745 7746
+#define RIOT_PP_SUCCESSOR_7746 7747
+#define RIOT_PP_SUCCESSOR_7747 7748
+#define RIOT_PP_SUCCESSOR_7748 7749
+#define RIOT_PP_SUCCESSOR_7749 7750
+#define RIOT_PP_SUCCESSOR_7750 7751
+#define RIOT_PP_SUCCESSOR_7751 7752
+#define RIOT_PP_SUCCESSOR_7752 7753
+#define RIOT_PP_SUCCESSOR_7753 7754
+#define RIOT_PP_SUCCESSOR_7754 7755
+#define RIOT_PP_SUCCESSOR_7755 7756
+#define RIOT_PP_SUCCESSOR_7756 7757
+#define RIOT_PP_SUCCESSOR_7757 7758
+#define RIOT_PP_SUCCESSOR_7758 7759
+#define RIOT_PP_SUCCESSOR_7759 7760
+#define RIOT_PP_SUCCESSOR_7760 7761
+#define RIOT_PP_SUCCESSOR_7761 7762
+#define RIOT_PP_SUCCESSOR_7762 7763
+#define RIOT_PP_SUCCESSOR_7763 7764
+#define RIOT_PP_SUCCESSOR_7764 7765
+#define RIOT_PP_SUCCESSOR_7765 7766
+#define RIOT_PP_SUCCESSOR_7766 7767
+#define RIOT_PP_SUCCESSOR_7767 7768
+#define RIOT_PP_SUCCESSOR_7768 7769
+#define RIOT_PP_SUCCESSOR_7769 7770
+#define RIOT_PP_SUCCESSOR_7770 7771
+#define RIOT_PP_SUCCESSOR_7771 7772
+#define RIOT_PP_SUCCESSOR_7772 7773
+#define RIOT_PP_SUCCESSOR_7773 7774
+#define RIOT_PP_SUCCESSOR_7774 7775
+#define RIOT_PP_SUCCESSOR_7775 7776
+#define RIOT_PP_SUCCESSOR_7776 7777
+#define RIOT_PP_SUCCESSOR_7777 7778
+#define RIOT_PP_SUCCESSOR_7778 7779
+#define RIOT_PP_SUCCESSOR_7779 7780
+#define RIOT_PP_SUCCESSOR_7780 7781
+#define RIOT_PP_SUCCESSOR_7781 7782
+#define RIOT_PP_SUCCESSOR_7782 7783
+#define RIOT_PP_SUCCESSOR_7783 7784
+#define RIOT_PP_SUCCESSOR_7784 7785
+#define RIOT_PP_SUCCESSOR_7785 7786
+#define RIOT_PP_SUCCESSOR_7786 7787
+#define RIOT_PP_SUCCESSOR_7787 7788
+#define RIOT_PP_SUCCESSOR_7788 7789
+#define RIOT_PP_SUCCESSOR_7789 7790
+#define RIOT_PP_SUCCESSOR_7790 7791
+#define RIOT_PP_SUCCESSOR_7791 7792
+#define RIOT_PP_SUCCESSOR_7792 7793
+#define RIOT_PP_SUCCESSOR_7793 7794
+#define RIOT_PP_SUCCESSOR_7794 7795
+#define RIOT_PP_SUCCESSOR_7795 7796
+#define RIOT_PP_SUCCESSOR_7796 7797
+#define RIOT_PP_SUCCESSOR_7797 7798
+#define RIOT_PP_SUCCESSOR_7798 7799
+#define RIOT_PP_SUCCESSOR_7799 7800
+#define RIOT_PP_SUCCESSOR_7800 7801
+#define RIOT_PP_SUCCESSOR_7801 7802
+#define RIOT_PP_SUCCESSOR_7802 7803
+#define RIOT_PP_SUCCESSOR_7803 7804
+#define RIOT_PP_SUCCESSOR_7804 7805
+#define RIOT_PP_SUCCESSOR_7805 7806
+#define RIOT_PP_SUCCESSOR_7806 7807
+#define RIOT_PP_SUCCESSOR_7807 7808
+#define RIOT_PP_SUCCESSOR_7808 7809
+#define RIOT_PP_SUCCESSOR_7809 7810
+#define RIOT_PP_SUCCESSOR_7810 7811
+#define RIOT_PP_SUCCESSOR_7811 7812
+#define RIOT_PP_SUCCESSOR_7812 7813
+#define RIOT_PP_SUCCESSOR_7813 7814
+#define RIOT_PP_SUCCESSOR_7814 7815
+#define RIOT_PP_SUCCESSOR_7815 7816
+#define RIOT_PP_SUCCESSOR_7816 7817
+#define RIOT_PP_SUCCESSOR_7817 7818
+#define RIOT_PP_SUCCESSOR_7818 7819
+#define RIOT_PP_SUCCESSOR_7819 7820
+#define RIOT_PP_SUCCESSOR_7820 7821
+#define RIOT_PP_SUCCESSOR_7821 7822
+#define RIOT_PP_SUCCESSOR_7822 7823
+#define RIOT_PP_SUCCESSOR_7823 7824
+#define RIOT_PP_SUCCESSOR_7824 7825
+#define RIOT_PP_SUCCESSOR_7825 7826
+#define RIOT_PP_SUCCESSOR_7826 7827
+#define RIOT_PP_SUCCESSOR_7827 7828
+#define RIOT_PP_SUCCESSOR_7828 7829
+#define RIOT_PP_SUCCESSOR_7829 7830
+#define RIOT_PP_SUCCESSOR_7830 7831
+#define RIOT_PP_SUCCESSOR_7831 7832
+#define RIOT_PP_SUCCESSOR_7832 7833
+#define RIOT_PP_SUCCESSOR_7833 7834
+#define RIOT_PP_SUCCESSOR_7834 7835
+#define RIOT_PP_SUCCESSOR_7835 7836
+#define RIOT_PP_SUCCESSOR_7836 7837
+#define RIOT_PP_SUCCESSOR_7837 7838
+#define RIOT_PP_SUCCESSOR_7838 7839
+#define RIOT_PP_SUCCESSOR_7839 7840
+#define RIOT_PP_SUCCESSOR_7840 7841
+#define RIOT_PP_SUCCESSOR_7841 7842
+#define RIOT_PP_SUCCESSOR_7842 7843
+#define RIOT_PP_SUCCESSOR_7843 7844
+#define RIOT_PP_SUCCESSOR_7844 7845
+#define RIOT_PP_SUCCESSOR_7845 7846
+#define RIOT_PP_SUCCESSOR_7846 7847
+#define RIOT_PP_SUCCESSOR_7847 7848
+#define RIOT_PP_SUCCESSOR_7848 7849
+#define RIOT_PP_SUCCESSOR_7849 7850
+#define RIOT_PP_SUCCESSOR_7850 7851
+#define RIOT_PP_SUCCESSOR_7851 7852
+#define RIOT_PP_SUCCESSOR_7852 7853
+#define RIOT_PP_SUCCESSOR_7853 7854
+#define RIOT_PP_SUCCESSOR_7854 7855
+#define RIOT_PP_SUCCESSOR_7855 7856
+#define RIOT_PP_SUCCESSOR_7856 7857
+#define RIOT_PP_SUCCESSOR_7857 7858
+#define RIOT_PP_SUCCESSOR_7858 7859
+#define RIOT_PP_SUCCESSOR_7859 7860
+#define RIOT_PP_SUCCESSOR_7860 7861
+#define RIOT_PP_SUCCESSOR_7861 7862
+#define RIOT_PP_SUCCESSOR_7862 7863
+#define RIOT_PP_SUCCESSOR_7863 7864
+#define RIOT_PP_SUCCESSOR_7864 7865
+#define RIOT_PP_SUCCESSOR_7865 7866
+#define RIOT_PP_SUCCESSOR_7866 7867
+#define RIOT_PP_SUCCESSOR_7867 7868
+#define RIOT_PP_SUCCESSOR_7868 7869
+#define RIOT_PP_SUCCESSOR_7869 7870
+#define RIOT_PP_SUCCESSOR_7870 7871
+#define RIOT_PP_SUCCESSOR_7871 7872
+#define RIOT_PP_SUCCESSOR_7872 7873
+#define RIOT_PP_SUCCESSOR_7873 7874
+#define RIOT_PP_SUCCESSOR_7874 7875
+#define RIOT_PP_SUCCESSOR_7875 7876
+#define RIOT_PP_SUCCESSOR_7876 7877
+#define RIOT_PP_SUCCESSOR_7877 7878
+#define RIOT_PP_SUCCESSOR_7878 7879
+#define RIOT_PP_SUCCESSOR_7879 7880
+#define RIOT_PP_SUCCESSOR_7880 7881
+#define RIOT_PP_SUCCESSOR_7881 7882
+#define RIOT_PP_SUCCESSOR_7882 7883
+#define RIOT_PP_SUCCESSOR_7883 7884
+#define RIOT_PP_SUCCESSOR_7884 7885
+#define RIOT_PP_SUCCESSOR_7885 7886
+#define RIOT_PP_SUCCESSOR_7886 7887
+#define RIOT_PP_SUCCESSOR_7887 7888
+#define RIOT_PP_SUCCESSOR_7888 7889
+#define RIOT_PP_SUCCESSOR_7889 7890
+#define RIOT_PP_SUCCESSOR_7890 7891
+#define RIOT_PP_SUCCESSOR_7891 7892
+#define RIOT_PP_SUCCESSOR_7892 7893
+#define RIOT_PP_SUCCESSOR_7893 7894
+#define RIOT_PP_SUCCESSOR_7894 7895
+#define RIOT_PP_SUCCESSOR_7895 7896
+#define RIOT_PP_SUCCESSOR_7896 7897
+#define RIOT_PP_SUCCESSOR_7897 7898
+#define RIOT_PP_SUCCESSOR_7898 7899
+#define RIOT_PP_SUCCESSOR_7899 7900
+#define RIOT_PP_SUCCESSOR_7900 7901
+#define RIOT_PP_SUCCESSOR_7901 7902
+#define RIOT_PP_SUCCESSOR_7902 7903
+#define RIOT_PP_SUCCESSOR_7903 7904
+#define RIOT_PP_SUCCESSOR_7904 7905
+#define RIOT_PP_SUCCESSOR_7905 7906
+#define RIOT_PP_SUCCESSOR_7906 7907
+#define RIOT_PP_SUCCESSOR_7907 7908
+#define RIOT_PP_SUCCESSOR_7908 7909
+#define RIOT_PP_SUCCESSOR_7909 7910
+#define RIOT_PP_SUCCESSOR_7910 7911
+#define RIOT_PP_SUCCESSOR_7911 7912
+#define RIOT_PP_SUCCESSOR_7912 7913
+#define RIOT_PP_SUCCESSOR_7913 7914
+#define RIOT_PP_SUCCESSOR_7914 7915
+#define RIOT_PP_SUCCESSOR_7915 7916
+#define RIOT_PP_SUCCESSOR_7916 7917
+#define RIOT_PP_SUCCESSOR_7917 7918
+#define RIOT_PP_SUCCESSOR_7918 7919
+#define RIOT_PP_SUCCESSOR_7919 7920
+#define RIOT_PP_SUCCESSOR_7920 7921
+#define RIOT_PP_SUCCESSOR_7921 7922
+#define RIOT_PP_SUCCESSOR_7922 7923
+#define RIOT_PP_SUCCESSOR_7923 7924
+#define RIOT_PP_SUCCESSOR_7924 7925
+#define RIOT_PP_SUCCESSOR_7925 7926
+#define RIOT_PP_SUCCESSOR_7926 7927
+#define RIOT_PP_SUCCESSOR_7927 7928
+#define RIOT_PP_SUCCESSOR_7928 7929
+#define RIOT_PP_SUCCESSOR_7929 7930
+#define RIOT_PP_SUCCESSOR_7930 7931
+#define RIOT_PP_SUCCESSOR_7931 7932
+#define RIOT_PP_SUCCESSOR_7932 7933
+#define RIOT_PP_SUCCESSOR_7933 7934
+#define RIOT_PP_SUCCESSOR_7934 7935
+#define RIOT_PP_SUCCESSOR_7935 7936
+#define RIOT_PP_SUCCESSOR_7936 7937
+#define RIOT_PP_SUCCESSOR_7937 7938
+#define RIOT_PP_SUCCESSOR_7938 7939
+#define RIOT_PP_SUCCESSOR_7939 7940
+#define RIOT_PP_SUCCESSOR_7940 7941
+#define RIOT_PP_SUCCESSOR_7941 7942
+#define RIOT_PP_SUCCESSOR_7942 7943
+#define RIOT_PP_SUCCESSOR_7943 7944
+#define RIOT_PP_SUCCESSOR_7944 7945
+#define RIOT_PP_SUCCESSOR_7945 7946
+#define RIOT_PP_SUCCESSOR_7946 7947
+#define RIOT_PP_SUCCESSOR_7947 7948
+#define RIOT_PP_SUCCESSOR_7948 7949
+#define RIOT_PP_SUCCESSOR_7949 7950
+#define RIOT_PP_SUCCESSOR_7950 7951
+#define RIOT_PP_SUCCESSOR_7951 7952
+#define RIOT_PP_SUCCESSOR_7952 7953
+#define RIOT_PP_SUCCESSOR_7953 7954
+#define RIOT_PP_SUCCESSOR_7954 7955
+#define RIOT_PP_SUCCESSOR_7955 7956
+#define RIOT_PP_SUCCESSOR_7956 7957
+#define RIOT_PP_SUCCESSOR_7957 7958
+#define RIOT_PP_SUCCESSOR_7958 7959
+#define RIOT_PP_SUCCESSOR_7959 7960
+#define RIOT_PP_SUCCESSOR_7960 7961
+#define RIOT_PP_SUCCESSOR_7961 7962
+#define RIOT_PP_SUCCESSOR_7962 7963
+#define RIOT_PP_SUCCESSOR_7963 7964
+#define RIOT_PP_SUCCESSOR_7964 7965
+#define RIOT_PP_SUCCESSOR_7965 7966
+#define RIOT_PP_SUCCESSOR_7966 7967
+#define RIOT_PP_SUCCESSOR_7967 7968
+#define RIOT_PP_SUCCESSOR_7968 7969
+#define RIOT_PP_SUCCESSOR_7969 7970
+#define RIOT_PP_SUCCESSOR_7970 7971
+#define RIOT_PP_SUCCESSOR_7971 7972
+#define RIOT_PP_SUCCESSOR_7972 7973
+#define RIOT_PP_SUCCESSOR_7973 7974
+#define RIOT_PP_SUCCESSOR_7974 7975
+#define RIOT_PP_SUCCESSOR_7975 7976
+#define RIOT_PP_SUCCESSOR_7976 7977
+#define RIOT_PP_SUCCESSOR_7977 7978
+#define RIOT_PP_SUCCESSOR_7978 7979
+#define RIOT_PP_SUCCESSOR_7979 7980
+#define RIOT_PP_SUCCESSOR_7980 7981
+#define RIOT_PP_SUCCESSOR_7981 7982
+#define RIOT_PP_SUCCESSOR_7982 7983
+#define RIOT_PP_SUCCESSOR_7983 7984
+#define RIOT_PP_SUCCESSOR_7984 7985
+#define RIOT_PP_SUCCESSOR_7985 7986
+#define RIOT_PP_SUCCESSOR_7986 7987
+#define RIOT_PP_SUCCESSOR_7987 7988
+#define RIOT_PP_SUCCESSOR_7988 7989
+#define RIOT_PP_SUCCESSOR_7989 7990
+#define RIOT_PP_SUCCESSOR_7990 7991
+#define RIOT_PP_SUCCESSOR_7991 7992
+#define RIOT_PP_SUCCESSOR_7992 7993
+#define RIOT_PP_SUCCESSOR_7993 7994
+#define RIOT_PP_SUCCESSOR_7994 7995
+#define RIOT_PP_SUCCESSOR_7995 7996
+#define RIOT_PP_SUCCESSOR_7996 7997
+#define RIOT_PP_SUCCESSOR_7997 7998
+#define RIOT_PP_SUCCESSOR_7998 7999
+#define RIOT_PP_SUCCESSOR_7999 8000
+#define RIOT_PP_SUCCESSOR_8000 8001
+#define RIOT_PP_SUCCESSOR_8001 8002
+#define RIOT_PP_SUCCESSOR_8002 8003
+#define RIOT_PP_SUCCESSOR_8003 8004
+#define RIOT_PP_SUCCESSOR_8004 8005
+#define RIOT_PP_SUCCESSOR_8005 8006
+#define RIOT_PP_SUCCESSOR_8006 8007
+#define RIOT_PP_SUCCESSOR_8007 8008
+#define RIOT_PP_SUCCESSOR_8008 8009
+#define RIOT_PP_SUCCESSOR_8009 8010
+#define RIOT_PP_SUCCESSOR_8010 8011
+#define RIOT_PP_SUCCESSOR_8011 8012
+#define RIOT_PP_SUCCESSOR_8012 8013
+#define RIOT_PP_SUCCESSOR_8013 8014
+#define RIOT_PP_SUCCESSOR_8014 8015
+#define RIOT_PP_SUCCESSOR_8015 8016
+#define RIOT_PP_SUCCESSOR_8016 8017
+#define RIOT_PP_SUCCESSOR_8017 8018
+#define RIOT_PP_SUCCESSOR_8018 8019
+#define RIOT_PP_SUCCESSOR_8019 8020
+#define RIOT_PP_SUCCESSOR_8020 8021
+#define RIOT_PP_SUCCESSOR_8021 8022
+#define RIOT_PP_SUCCESSOR_8022 8023
+#define RIOT_PP_SUCCESSOR_8023 8024
+#define RIOT_PP_SUCCESSOR_8024 8025
+#define RIOT_PP_SUCCESSOR_8025 8026
+#define RIOT_PP_SUCCESSOR_8026 8027
+#define RIOT_PP_SUCCESSOR_8027 8028
+#define RIOT_PP_SUCCESSOR_8028 8029
+#define RIOT_PP_SUCCESSOR_8029 8030
+#define RIOT_PP_SUCCESSOR_8030 8031
+#define RIOT_PP_SUCCESSOR_8031 8032
+#define RIOT_PP_SUCCESSOR_8032 8033
+#define RIOT_PP_SUCCESSOR_8033 8034
+#define RIOT_PP_SUCCESSOR_8034 8035
+#define RIOT_PP_SUCCESSOR_8035 8036
+#define RIOT_PP_SUCCESSOR_8036 8037
+#define RIOT_PP_SUCCESSOR_8037 8038
+#define RIOT_PP_SUCCESSOR_8038 8039
+#define RIOT_PP_SUCCESSOR_8039 8040
+#define RIOT_PP_SUCCESSOR_8040 8041
+#define RIOT_PP_SUCCESSOR_8041 8042
+#define RIOT_PP_SUCCESSOR_8042 8043
+#define RIOT_PP_SUCCESSOR_8043 8044
+#define RIOT_PP_SUCCESSOR_8044 8045
+#define RIOT_PP_SUCCESSOR_8045 8046
+#define RIOT_PP_SUCCESSOR_8046 8047
+#define RIOT_PP_SUCCESSOR_8047 8048
+#define RIOT_PP_SUCCESSOR_8048 8049
+#define RIOT_PP_SUCCESSOR_8049 8050
+#define RIOT_PP_SUCCESSOR_8050 8051
+#define RIOT_PP_SUCCESSOR_8051 8052
+#define RIOT_PP_SUCCESSOR_8052 8053
+#define RIOT_PP_SUCCESSOR_8053 8054
+#define RIOT_PP_SUCCESSOR_8054 8055
+#define RIOT_PP_SUCCESSOR_8055 8056
+#define RIOT_PP_SUCCESSOR_8056 8057
+#define RIOT_PP_SUCCESSOR_8057 8058
+#define RIOT_PP_SUCCESSOR_8058 8059
+#define RIOT_PP_SUCCESSOR_8059 8060
+#define RIOT_PP_SUCCESSOR_8060 8061
+#define RIOT_PP_SUCCESSOR_8061 8062
+#define RIOT_PP_SUCCESSOR_8062 8063
+#define RIOT_PP_SUCCESSOR_8063 8064
+#define RIOT_PP_SUCCESSOR_8064 8065
+#define RIOT_PP_SUCCESSOR_8065 8066
+#define RIOT_PP_SUCCESSOR_8066 8067
+#define RIOT_PP_SUCCESSOR_8067 8068
+#define RIOT_PP_SUCCESSOR_8068 8069
+#define RIOT_PP_SUCCESSOR_8069 8070
+#define RIOT_PP_SUCCESSOR_8070 8071
+#define RIOT_PP_SUCCESSOR_8071 8072
+#define RIOT_PP_SUCCESSOR_8072 8073
+#define RIOT_PP_SUCCESSOR_8073 8074
+#define RIOT_PP_SUCCESSOR_8074 8075
+#define RIOT_PP_SUCCESSOR_8075 8076
+#define RIOT_PP_SUCCESSOR_8076 8077
+#define RIOT_PP_SUCCESSOR_8077 8078
+#define RIOT_PP_SUCCESSOR_8078 8079
+#define RIOT_PP_SUCCESSOR_8079 8080
+#define RIOT_PP_SUCCESSOR_8080 8081
+#define RIOT_PP_SUCCESSOR_8081 8082
+#define RIOT_PP_SUCCESSOR_8082 8083
+#define RIOT_PP_SUCCESSOR_8083 8084
+#define RIOT_PP_SUCCESSOR_8084 8085
+#define RIOT_PP_SUCCESSOR_8085 8086
+#define RIOT_PP_SUCCESSOR_8086 8087
+#define RIOT_PP_SUCCESSOR_8087 8088
+#define RIOT_PP_SUCCESSOR_8088 8089
+#define RIOT_PP_SUCCESSOR_8089 8090
+#define RIOT_PP_SUCCESSOR_8090 8091
+#define RIOT_PP_SUCCESSOR_8091 8092
+#define RIOT_PP_SUCCESSOR_8092 8093
+#define RIOT_PP_SUCCESSOR_8093 8094
+#define RIOT_PP_SUCCESSOR_8094 8095
+#define RIOT_PP_SUCCESSOR_8095 8096
+#define RIOT_PP_SUCCESSOR_8096 8097
+#define RIOT_PP_SUCCESSOR_8097 8098
+#define RIOT_PP_SUCCESSOR_8098 8099
+#define RIOT_PP_SUCCESSOR_8099 8100
+#define RIOT_PP_SUCCESSOR_8100 8101
+#define RIOT_PP_SUCCESSOR_8101 8102
+#define RIOT_PP_SUCCESSOR_8102 8103
+#define RIOT_PP_SUCCESSOR_8103 8104
+#define RIOT_PP_SUCCESSOR_8104 8105
+#define RIOT_PP_SUCCESSOR_8105 8106
+#define RIOT_PP_SUCCESSOR_8106 8107
+#define RIOT_PP_SUCCESSOR_8107 8108
+#define RIOT_PP_SUCCESSOR_8108 8109
+#define RIOT_PP_SUCCESSOR_8109 8110
+#define RIOT_PP_SUCCESSOR_8110 8111
+#define RIOT_PP_SUCCESSOR_8111 8112
+#define RIOT_PP_SUCCESSOR_8112 8113
+#define RIOT_PP_SUCCESSOR_8113 8114
+#define RIOT_PP_SUCCESSOR_8114 8115
+#define RIOT_PP_SUCCESSOR_8115 8116
+#define RIOT_PP_SUCCESSOR_8116 8117
+#define RIOT_PP_SUCCESSOR_8117 8118
+#define RIOT_PP_SUCCESSOR_8118 8119
+#define RIOT_PP_SUCCESSOR_8119 8120
+#define RIOT_PP_SUCCESSOR_8120 8121
+#define RIOT_PP_SUCCESSOR_8121 8122
+#define RIOT_PP_SUCCESSOR_8122 8123
+#define RIOT_PP_SUCCESSOR_8123 8124
+#define RIOT_PP_SUCCESSOR_8124 8125
+#define RIOT_PP_SUCCESSOR_8125 8126
+#define RIOT_PP_SUCCESSOR_8126 8127
+#define RIOT_PP_SUCCESSOR_8127 8128
+#define RIOT_PP_SUCCESSOR_8128 8129
+#define RIOT_PP_SUCCESSOR_8129 8130
+#define RIOT_PP_SUCCESSOR_8130 8131
+#define RIOT_PP_SUCCESSOR_8131 8132
+#define RIOT_PP_SUCCESSOR_8132 8133
+#define RIOT_PP_SUCCESSOR_8133 8134
+#define RIOT_PP_SUCCESSOR_8134 8135
+#define RIOT_PP_SUCCESSOR_8135 8136
+#define RIOT_PP_SUCCESSOR_8136 8137
+#define RIOT_PP_SUCCESSOR_8137 8138
+#define RIOT_PP_SUCCESSOR_8138 8139
+#define RIOT_PP_SUCCESSOR_8139 8140
+#define RIOT_PP_SUCCESSOR_8140 8141
+#define RIOT_PP_SUCCESSOR_8141 8142
+#define RIOT_PP_SUCCESSOR_8142 8143
+#define RIOT_PP_SUCCESSOR_8143 8144
+#define RIOT_PP_SUCCESSOR_8144 8145
+#define RIOT_PP_SUCCESSOR_8145 8146
+#define RIOT_PP_SUCCESSOR_8146 8147
+#define RIOT_PP_SUCCESSOR_8147 8148
+#define RIOT_PP_SUCCESSOR_8148 8149
+#define RIOT_PP_SUCCESSOR_8149 8150
+#define RIOT_PP_SUCCESSOR_8150 8151
+#define RIOT_PP_SUCCESSOR_8151 8152
+#define RIOT_PP_SUCCESSOR_8152 8153
+#define RIOT_PP_SUCCESSOR_8153 8154
+#define RIOT_PP_SUCCESSOR_8154 8155
+#define RIOT_PP_SUCCESSOR_8155 8156
+#define RIOT_PP_SUCCESSOR_8156 8157
+#define RIOT_PP_SUCCESSOR_8157 8158
+#define RIOT_PP_SUCCESSOR_8158 8159
+#define RIOT_PP_SUCCESSOR_8159 8160
+#define RIOT_PP_SUCCESSOR_8160 8161
+#define RIOT_PP_SUCCESSOR_8161 8162
+#define RIOT_PP_SUCCESSOR_8162 8163
+#define RIOT_PP_SUCCESSOR_8163 8164
+#define RIOT_PP_SUCCESSOR_8164 8165
+#define RIOT_PP_SUCCESSOR_8165 8166
+#define RIOT_PP_SUCCESSOR_8166 8167
+#define RIOT_PP_SUCCESSOR_8167 8168
+#define RIOT_PP_SUCCESSOR_8168 8169
+#define RIOT_PP_SUCCESSOR_8169 8170
+#define RIOT_PP_SUCCESSOR_8170 8171
+#define RIOT_PP_SUCCESSOR_8171 8172
+#define RIOT_PP_SUCCESSOR_8172 8173
+#define RIOT_PP_SUCCESSOR_8173 8174
+#define RIOT_PP_SUCCESSOR_8174 8175
+#define RIOT_PP_SUCCESSOR_8175 8176
+#define RIOT_PP_SUCCESSOR_8176 8177
+#define RIOT_PP_SUCCESSOR_8177 8178
+#define RIOT_PP_SUCCESSOR_8178 8179
+#define RIOT_PP_SUCCESSOR_8179 8180
+#define RIOT_PP_SUCCESSOR_8180 8181
+#define RIOT_PP_SUCCESSOR_8181 8182
+#define RIOT_PP_SUCCESSOR_8182 8183
+#define RIOT_PP_SUCCESSOR_8183 8184
+#define RIOT_PP_SUCCESSOR_8184 8185
+#define RIOT_PP_SUCCESSOR_8185 8186
+#define RIOT_PP_SUCCESSOR_8186 8187
+#define RIOT_PP_SUCCESSOR_8187 8188
+#define RIOT_PP_SUCCESSOR_8188 8189
+#define RIOT_PP_SUCCESSOR_8189 8190
+#define RIOT_PP_SUCCESSOR_8190 8191
+#define RIOT_PP_SUCCESSOR_8191 8192
+#define RIOT_PP_SUCCESSOR_8192 8193
+#define RIOT_PP_SUCCESSOR_8193 8194
+#define RIOT_PP_SUCCESSOR_8194 8195
+#define RIOT_PP_SUCCESSOR_8195 8196
+#define RIOT_PP_SUCCESSOR_8196 8197
+#define RIOT_PP_SUCCESSOR_8197 8198
+#define RIOT_PP_SUCCESSOR_8198 8199
+#define RIOT_PP_SUCCESSOR_8199 8200
+#define RIOT_PP_SUCCESSOR_8200 8201
+#define RIOT_PP_SUCCESSOR_8201 8202
+#define RIOT_PP_SUCCESSOR_8202 8203
+#define RIOT_PP_SUCCESSOR_8203 8204
+#define RIOT_PP_SUCCESSOR_8204 8205
+#define RIOT_PP_SUCCESSOR_8205 8206
+#define RIOT_PP_SUCCESSOR_8206 8207
+#define RIOT_PP_SUCCESSOR_8207 8208
+#define RIOT_PP_SUCCESSOR_8208 8209
+#define RIOT_PP_SUCCESSOR_8209 8210
+#define RIOT_PP_SUCCESSOR_8210 8211
+#define RIOT_PP_SUCCESSOR_8211 8212
+#define RIOT_PP_SUCCESSOR_8212 8213
+#define RIOT_PP_SUCCESSOR_8213 8214
+#define RIOT_PP_SUCCESSOR_8214 8215
+#define RIOT_PP_SUCCESSOR_8215 8216
+#define RIOT_PP_SUCCESSOR_8216 8217
+#define RIOT_PP_SUCCESSOR_8217 8218
+#define RIOT_PP_SUCCESSOR_8218 8219
+#define RIOT_PP_SUCCESSOR_8219 8220
+#define RIOT_PP_SUCCESSOR_8220 8221
+#define RIOT_PP_SUCCESSOR_8221 8222
+#define RIOT_PP_SUCCESSOR_8222 8223
+#define RIOT_PP_SUCCESSOR_8223 8224
+#define RIOT_PP_SUCCESSOR_8224 8225
+#define RIOT_PP_SUCCESSOR_8225 8226
+#define RIOT_PP_SUCCESSOR_8226 8227
+#define RIOT_PP_SUCCESSOR_8227 8228
+#define RIOT_PP_SUCCESSOR_8228 8229
+#define RIOT_PP_SUCCESSOR_8229 8230
+#define RIOT_PP_SUCCESSOR_8230 8231
+#define RIOT_PP_SUCCESSOR_8231 8232
+#define RIOT_PP_SUCCESSOR_8232 8233
+#define RIOT_PP_SUCCESSOR_8233 8234
+#define RIOT_PP_SUCCESSOR_8234 8235
+#define RIOT_PP_SUCCESSOR_8235 8236
+#define RIOT_PP_SUCCESSOR_8236 8237
+#define RIOT_PP_SUCCESSOR_8237 8238
+#define RIOT_PP_SUCCESSOR_8238 8239
+#define RIOT_PP_SUCCESSOR_8239 8240
+#define RIOT_PP_SUCCESSOR_8240 8241
+#define RIOT_PP_SUCCESSOR_8241 8242
+#define RIOT_PP_SUCCESSOR_8242 8243
+#define RIOT_PP_SUCCESSOR_8243 8244
+#define RIOT_PP_SUCCESSOR_8244 8245
+#define RIOT_PP_SUCCESSOR_8245 8246
+#define RIOT_PP_SUCCESSOR_8246 8247
+#define RIOT_PP_SUCCESSOR_8247 8248
+#define RIOT_PP_SUCCESSOR_8248 8249
+#define RIOT_PP_SUCCESSOR_8249 8250
+#define RIOT_PP_SUCCESSOR_8250 8251
+#define RIOT_PP_SUCCESSOR_8251 8252
+#define RIOT_PP_SUCCESSOR_8252 8253
+#define RIOT_PP_SUCCESSOR_8253 8254
+#define RIOT_PP_SUCCESSOR_8254 8255
+#define RIOT_PP_SUCCESSOR_8255 8256
+#define RIOT_PP_SUCCESSOR_8256 8257
+#define RIOT_PP_SUCCESSOR_8257 8258
+#define RIOT_PP_SUCCESSOR_8258 8259
+#define RIOT_PP_SUCCESSOR_8259 8260
+#define RIOT_PP_SUCCESSOR_8260 8261
+#define RIOT_PP_SUCCESSOR_8261 8262
+#define RIOT_PP_SUCCESSOR_8262 8263
+#define RIOT_PP_SUCCESSOR_8263 8264
+#define RIOT_PP_SUCCESSOR_8264 8265
+#define RIOT_PP_SUCCESSOR_8265 8266
+#define RIOT_PP_SUCCESSOR_8266 8267
+#define RIOT_PP_SUCCESSOR_8267 8268
+#define RIOT_PP_SUCCESSOR_8268 8269
+#define RIOT_PP_SUCCESSOR_8269 8270
+#define RIOT_PP_SUCCESSOR_8270 8271
+#define RIOT_PP_SUCCESSOR_8271 8272
+#define RIOT_PP_SUCCESSOR_8272 8273
+#define RIOT_PP_SUCCESSOR_8273 8274
+#define RIOT_PP_SUCCESSOR_8274 8275
+#define RIOT_PP_SUCCESSOR_8275 8276
+#define RIOT_PP_SUCCESSOR_8276 8277
+#define RIOT_PP_SUCCESSOR_8277 8278
+#define RIOT_PP_SUCCESSOR_8278 8279
+#define RIOT_PP_SUCCESSOR_8279 8280
+#define RIOT_PP_SUCCESSOR_8280 8281
+#define RIOT_PP_SUCCESSOR_8281 8282
+#define RIOT_PP_SUCCESSOR_8282 8283
+#define RIOT_PP_SUCCESSOR_8283 8284
+#define RIOT_PP_SUCCESSOR_8284 8285
+#define RIOT_PP_SUCCESSOR_8285 8286
+#define RIOT_PP_SUCCESSOR_8286 8287
+#define RIOT_PP_SUCCESSOR_8287 8288
+#define RIOT_PP_SUCCESSOR_8288 8289
+#define RIOT_PP_SUCCESSOR_8289 8290
+#define RIOT_PP_SUCCESSOR_8290 8291
+#define RIOT_PP_SUCCESSOR_8291 8292
+#define RIOT_PP_SUCCESSOR_8292 8293
+#define RIOT_PP_SUCCESSOR_8293 8294
+#define RIOT_PP_SUCCESSOR_8294 8295
+#define RIOT_PP_SUCCESSOR_8295 8296
+#define RIOT_PP_SUCCESSOR_8296 8297
+#define RIOT_PP_SUCCESSOR_8297 8298
+#define RIOT_PP_SUCCESSOR_8298 8299
+#define RIOT_PP_SUCCESSOR_8299 8300
+#define RIOT_PP_SUCCESSOR_8300 8301
+#define RIOT_PP_SUCCESSOR_8301 8302
+#define RIOT_PP_SUCCESSOR_8302 8303
+#define RIOT_PP_SUCCESSOR_8303 8304
+#define RIOT_PP_SUCCESSOR_8304 8305
+#define RIOT_PP_SUCCESSOR_8305 8306
+#define RIOT_PP_SUCCESSOR_8306 8307
+#define RIOT_PP_SUCCESSOR_8307 8308
+#define RIOT_PP_SUCCESSOR_8308 8309
+#define RIOT_PP_SUCCESSOR_8309 8310
+#define RIOT_PP_SUCCESSOR_8310 8311
+#define RIOT_PP_SUCCESSOR_8311 8312
+#define RIOT_PP_SUCCESSOR_8312 8313
+#define RIOT_PP_SUCCESSOR_8313 8314
+#define RIOT_PP_SUCCESSOR_8314 8315
+#define RIOT_PP_SUCCESSOR_8315 8316
+#define RIOT_PP_SUCCESSOR_8316 8317
+#define RIOT_PP_SUCCESSOR_8317 8318
+#define RIOT_PP_SUCCESSOR_8318 8319
+#define RIOT_PP_SUCCESSOR_8319 8320
+#define RIOT_PP_SUCCESSOR_8320 8321
+#define RIOT_PP_SUCCESSOR_8321 8322
+#define RIOT_PP_SUCCESSOR_8322 8323
+#define RIOT_PP_SUCCESSOR_8323 8324
+#define RIOT_PP_SUCCESSOR_8324 8325
+#define RIOT_PP_SUCCESSOR_8325 8326
+#define RIOT_PP_SUCCESSOR_8326 8327
+#define RIOT_PP_SUCCESSOR_8327 8328
+#define RIOT_PP_SUCCESSOR_8328 8329
+#define RIOT_PP_SUCCESSOR_8329 8330
+#define RIOT_PP_SUCCESSOR_8330 8331
+#define RIOT_PP_SUCCESSOR_8331 8332
+#define RIOT_PP_SUCCESSOR_8332 8333
+#define RIOT_PP_SUCCESSOR_8333 8334
+#define RIOT_PP_SUCCESSOR_8334 8335
+#define RIOT_PP_SUCCESSOR_8335 8336
+#define RIOT_PP_SUCCESSOR_8336 8337
+#define RIOT_PP_SUCCESSOR_8337 8338
+#define RIOT_PP_SUCCESSOR_8338 8339
+#define RIOT_PP_SUCCESSOR_8339 8340
+#define RIOT_PP_SUCCESSOR_8340 8341
+#define RIOT_PP_SUCCESSOR_8341 8342
+#define RIOT_PP_SUCCESSOR_8342 8343
+#define RIOT_PP_SUCCESSOR_8343 8344
+#define RIOT_PP_SUCCESSOR_8344 8345
+#define RIOT_PP_SUCCESSOR_8345 8346
+#define RIOT_PP_SUCCESSOR_8346 8347
+#define RIOT_PP_SUCCESSOR_8347 8348
+#define RIOT_PP_SUCCESSOR_8348 8349
+#define RIOT_PP_SUCCESSOR_8349 8350
+#define RIOT_PP_SUCCESSOR_8350 8351
+#define RIOT_PP_SUCCESSOR_8351 8352
+#define RIOT_PP_SUCCESSOR_8352 8353
+#define RIOT_PP_SUCCESSOR_8353 8354
+#define RIOT_PP_SUCCESSOR_8354 8355
+#define RIOT_PP_SUCCESSOR_8355 8356
+#define RIOT_PP_SUCCESSOR_8356 8357
+#define RIOT_PP_SUCCESSOR_8357 8358
+#define RIOT_PP_SUCCESSOR_8358 8359
+#define RIOT_PP_SUCCESSOR_8359 8360
+#define RIOT_PP_SUCCESSOR_8360 8361
+#define RIOT_PP_SUCCESSOR_8361 8362
+#define RIOT_PP_SUCCESSOR_8362 8363
+#define RIOT_PP_SUCCESSOR_8363 8364
+#define RIOT_PP_SUCCESSOR_8364 8365
+#define RIOT_PP_SUCCESSOR_8365 8366
+#define RIOT_PP_SUCCESSOR_8366 8367
+#define RIOT_PP_SUCCESSOR_8367 8368
+#define RIOT_PP_SUCCESSOR_8368 8369
+#define RIOT_PP_SUCCESSOR_8369 8370
+#define RIOT_PP_SUCCESSOR_8370 8371
+#define RIOT_PP_SUCCESSOR_8371 8372
+#define RIOT_PP_SUCCESSOR_8372 8373
+#define RIOT_PP_SUCCESSOR_8373 8374
+#define RIOT_PP_SUCCESSOR_8374 8375
+#define RIOT_PP_SUCCESSOR_8375 8376
+#define RIOT_PP_SUCCESSOR_8376 8377
+#define RIOT_PP_SUCCESSOR_8377 8378
+#define RIOT_PP_SUCCESSOR_8378 8379
+#define RIOT_PP_SUCCESSOR_8379 8380
+#define RIOT_PP_SUCCESSOR_8380 8381
+#define RIOT_PP_SUCCESSOR_8381 8382
+#define RIOT_PP_SUCCESSOR_8382 8383
+#define RIOT_PP_SUCCESSOR_8383 8384
+#define RIOT_PP_SUCCESSOR_8384 8385
+#define RIOT_PP_SUCCESSOR_8385 8386
+#define RIOT_PP_SUCCESSOR_8386 8387
+#define RIOT_PP_SUCCESSOR_8387 8388
+#define RIOT_PP_SUCCESSOR_8388 8389
+#define RIOT_PP_SUCCESSOR_8389 8390
+#define RIOT_PP_SUCCESSOR_8390 8391
+#define RIOT_PP_SUCCESSOR_8391 8392
+#define RIOT_PP_SUCCESSOR_8392 8393
+#define RIOT_PP_SUCCESSOR_8393 8394
+#define RIOT_PP_SUCCESSOR_8394 8395
+#define RIOT_PP_SUCCESSOR_8395 8396
+#define RIOT_PP_SUCCESSOR_8396 8397
+#define RIOT_PP_SUCCESSOR_8397 8398
+#define RIOT_PP_SUCCESSOR_8398 8399
+#define RIOT_PP_SUCCESSOR_8399 8400
+#define RIOT_PP_SUCCESSOR_8400 8401
+#define RIOT_PP_SUCCESSOR_8401 8402
+#define RIOT_PP_SUCCESSOR_8402 8403
+#define RIOT_PP_SUCCESSOR_8403 8404
+#define RIOT_PP_SUCCESSOR_8404 8405
+#define RIOT_PP_SUCCESSOR_8405 8406
+#define RIOT_PP_SUCCESSOR_8406 8407
+#define RIOT_PP_SUCCESSOR_8407 8408
+#define RIOT_PP_SUCCESSOR_8408 8409
+#define RIOT_PP_SUCCESSOR_8409 8410
+#define RIOT_PP_SUCCESSOR_8410 8411
+#define RIOT_PP_SUCCESSOR_8411 8412
+#define RIOT_PP_SUCCESSOR_8412 8413
+#define RIOT_PP_SUCCESSOR_8413 8414
+#define RIOT_PP_SUCCESSOR_8414 8415
+#define RIOT_PP_SUCCESSOR_8415 8416
+#define RIOT_PP_SUCCESSOR_8416 8417
+#define RIOT_PP_SUCCESSOR_8417 8418
+#define RIOT_PP_SUCCESSOR_8418 8419
+#define RIOT_PP_SUCCESSOR_8419 8420
+#define RIOT_PP_SUCCESSOR_8420 8421
+#define RIOT_PP_SUCCESSOR_8421 8422
+#define RIOT_PP_SUCCESSOR_8422 8423
+#define RIOT_PP_SUCCESSOR_8423 8424
+#define RIOT_PP_SUCCESSOR_8424 8425
+#define RIOT_PP_SUCCESSOR_8425 8426
+#define RIOT_PP_SUCCESSOR_8426 8427
+#define RIOT_PP_SUCCESSOR_8427 8428
+#define RIOT_PP_SUCCESSOR_8428 8429
+#define RIOT_PP_SUCCESSOR_8429 8430
+#define RIOT_PP_SUCCESSOR_8430 8431
+#define RIOT_PP_SUCCESSOR_8431 8432
+#define RIOT_PP_SUCCESSOR_8432 8433
+#define RIOT_PP_SUCCESSOR_8433 8434
+#define RIOT_PP_SUCCESSOR_8434 8435
+#define RIOT_PP_SUCCESSOR_8435 8436
+#define RIOT_PP_SUCCESSOR_8436 8437
+#define RIOT_PP_SUCCESSOR_8437 8438
+#define RIOT_PP_SUCCESSOR_8438 8439
+#define RIOT_PP_SUCCESSOR_8439 8440
+#define RIOT_PP_SUCCESSOR_8440 8441
+#define RIOT_PP_SUCCESSOR_8441 8442
+#define RIOT_PP_SUCCESSOR_8442 8443
+#define RIOT_PP_SUCCESSOR_8443 8444
+#define RIOT_PP_SUCCESSOR_8444 8445
+#define RIOT_PP_SUCCESSOR_8445 8446
+#define RIOT_PP_SUCCESSOR_8446 8447
+#define RIOT_PP_SUCCESSOR_8447 8448
+#define RIOT_PP_SUCCESSOR_8448 8449
+#define RIOT_PP_SUCCESSOR_8449 8450
+#define RIOT_PP_SUCCESSOR_8450 8451
+#define RIOT_PP_SUCCESSOR_8451 8452
+#define RIOT_PP_SUCCESSOR_8452 8453
+#define RIOT_PP_SUCCESSOR_8453 8454
+#define RIOT_PP_SUCCESSOR_8454 8455
+#define RIOT_PP_SUCCESSOR_8455 8456
+#define RIOT_PP_SUCCESSOR_8456 8457
+#define RIOT_PP_SUCCESSOR_8457 8458
+#define RIOT_PP_SUCCESSOR_8458 8459
+#define RIOT_PP_SUCCESSOR_8459 8460
+#define RIOT_PP_SUCCESSOR_8460 8461
+#define RIOT_PP_SUCCESSOR_8461 8462
+#define RIOT_PP_SUCCESSOR_8462 8463
+#define RIOT_PP_SUCCESSOR_8463 8464
+#define RIOT_PP_SUCCESSOR_8464 8465
+#define RIOT_PP_SUCCESSOR_8465 8466
+#define RIOT_PP_SUCCESSOR_8466 8467
+#define RIOT_PP_SUCCESSOR_8467 8468
+#define RIOT_PP_SUCCESSOR_8468 8469
+#define RIOT_PP_SUCCESSOR_8469 8470
+#define RIOT_PP_SUCCESSOR_8470 8471
+#define RIOT_PP_SUCCESSOR_8471 8472
+#define RIOT_PP_SUCCESSOR_8472 8473
+#define RIOT_PP_SUCCESSOR_8473 8474
+#define RIOT_PP_SUCCESSOR_8474 8475
+#define RIOT_PP_SUCCESSOR_8475 8476
+#define RIOT_PP_SUCCESSOR_8476 8477
+#define RIOT_PP_SUCCESSOR_8477 8478
+#define RIOT_PP_SUCCESSOR_8478 8479
+#define RIOT_PP_SUCCESSOR_8479 8480
+#define RIOT_PP_SUCCESSOR_8480 8481
+#define RIOT_PP_SUCCESSOR_8481 8482
+#define RIOT_PP_SUCCESSOR_8482 8483
+#define RIOT_PP_SUCCESSOR_8483 8484
+#define RIOT_PP_SUCCESSOR_8484 8485
+#define RIOT_PP_SUCCESSOR_8485 8486
+#define RIOT_PP_SUCCESSOR_8486 8487
+#define RIOT_PP_SUCCESSOR_8487 8488
+#define RIOT_PP_SUCCESSOR_8488 8489
+#define RIOT_PP_SUCCESSOR_8489 8490
+#define RIOT_PP_SUCCESSOR_8490 8491
+#define RIOT_PP_SUCCESSOR_8491 8492
+#define RIOT_PP_SUCCESSOR_8492 8493
+#define RIOT_PP_SUCCESSOR_8493 8494
+#define RIOT_PP_SUCCESSOR_8494 8495
+#define RIOT_PP_SUCCESSOR_8495 8496
+#define RIOT_PP_SUCCESSOR_8496 8497
+#define RIOT_PP_SUCCESSOR_8497 8498
+#define RIOT_PP_SUCCESSOR_8498 8499
+#define RIOT_PP_SUCCESSOR_8499 8500
+#define RIOT_PP_SUCCESSOR_8500 8501
+#define RIOT_PP_SUCCESSOR_8501 8502
+#define RIOT_PP_SUCCESSOR_8502 8503
+#define RIOT_PP_SUCCESSOR_8503 8504
+#define RIOT_PP_SUCCESSOR_8504 8505
+#define RIOT_PP_SUCCESSOR_8505 8506
+#define RIOT_PP_SUCCESSOR_8506 8507
+#define RIOT_PP_SUCCESSOR_8507 8508
+#define RIOT_PP_SUCCESSOR_8508 8509
+#define RIOT_PP_SUCCESSOR_8509 8510
+#define RIOT_PP_SUCCESSOR_8510 8511
+#define RIOT_PP_SUCCESSOR_8511 8512
+#define RIOT_PP_SUCCESSOR_8512 8513
+#define RIOT_PP_SUCCESSOR_8513 8514
+#define RIOT_PP_SUCCESSOR_8514 8515
+#define RIOT_PP_SUCCESSOR_8515 8516
+#define RIOT_PP_SUCCESSOR_8516 8517
+#define RIOT_PP_SUCCESSOR_8517 8518
+#define RIOT_PP_SUCCESSOR_8518 8519
+#define RIOT_PP_SUCCESSOR_8519 8520
+#define RIOT_PP_SUCCESSOR_8520 8521
+#define RIOT_PP_SUCCESSOR_8521 8522
+#define RIOT_PP_SUCCESSOR_8522 8523
+#define RIOT_PP_SUCCESSOR_8523 8524
+#define RIOT_PP_SUCCESSOR_8524 8525
+#define RIOT_PP_SUCCESSOR_8525 8526
+#define RIOT_PP_SUCCESSOR_8526 8527
+#define RIOT_PP_SUCCESSOR_8527 8528
+#define RIOT_PP_SUCCESSOR_8528 8529
+#define RIOT_PP_SUCCESSOR_8529 8530
+#define RIOT_PP_SUCCESSOR_8530 8531
+#define RIOT_PP_SUCCESSOR_8531 8532
+#define RIOT_PP_SUCCESSOR_8532 8533
+#define RIOT_PP_SUCCESSOR_8533 8534
+#define RIOT_PP_SUCCESSOR_8534 8535
+#define RIOT_PP_SUCCESSOR_8535 8536
+#define RIOT_PP_SUCCESSOR_8536 8537
+#define RIOT_PP_SUCCESSOR_8537 8538
+#define RIOT_PP_SUCCESSOR_8538 8539
+#define RIOT_PP_SUCCESSOR_8539 8540
+#define RIOT_PP_SUCCESSOR_8540 8541
+#define RIOT_PP_SUCCESSOR_8541 8542
+#define RIOT_PP_SUCCESSOR_8542 8543
+#define RIOT_PP_SUCCESSOR_8543 8544
+#define RIOT_PP_SUCCESSOR_8544 8545
+#define RIOT_PP_SUCCESSOR_8545 8546
+#define RIOT_PP_SUCCESSOR_8546 8547
+#define RIOT_PP_SUCCESSOR_8547 8548
+#define RIOT_PP_SUCCESSOR_8548 8549
+#define RIOT_PP_SUCCESSOR_8549 8550
+#define RIOT_PP_SUCCESSOR_8550 8551
+#define RIOT_PP_SUCCESSOR_8551 8552
+#define RIOT_PP_SUCCESSOR_8552 8553
+#define RIOT_PP_SUCCESSOR_8553 8554
+#define RIOT_PP_SUCCESSOR_8554 8555
+#define RIOT_PP_SUCCESSOR_8555 8556
+#define RIOT_PP_SUCCESSOR_8556 8557
+#define RIOT_PP_SUCCESSOR_8557 8558
+#define RIOT_PP_SUCCESSOR_8558 8559
+#define RIOT_PP_SUCCESSOR_8559 8560
+#define RIOT_PP_SUCCESSOR_8560 8561
+#define RIOT_PP_SUCCESSOR_8561 8562
+#define RIOT_PP_SUCCESSOR_8562 8563
+#define RIOT_PP_SUCCESSOR_8563 8564
+#define RIOT_PP_SUCCESSOR_8564 8565
+#define RIOT_PP_SUCCESSOR_8565 8566
+#define RIOT_PP_SUCCESSOR_8566 8567
+#define RIOT_PP_SUCCESSOR_8567 8568
+#define RIOT_PP_SUCCESSOR_8568 8569
+#define RIOT_PP_SUCCESSOR_8569 8570
+#define RIOT_PP_SUCCESSOR_8570 8571
+#define RIOT_PP_SUCCESSOR_8571 8572
+#define RIOT_PP_SUCCESSOR_8572 8573
+#define RIOT_PP_SUCCESSOR_8573 8574
+#define RIOT_PP_SUCCESSOR_8574 8575
+#define RIOT_PP_SUCCESSOR_8575 8576
+#define RIOT_PP_SUCCESSOR_8576 8577
+#define RIOT_PP_SUCCESSOR_8577 8578
+#define RIOT_PP_SUCCESSOR_8578 8579
+#define RIOT_PP_SUCCESSOR_8579 8580
+#define RIOT_PP_SUCCESSOR_8580 8581
+#define RIOT_PP_SUCCESSOR_8581 8582
+#define RIOT_PP_SUCCESSOR_8582 8583
+#define RIOT_PP_SUCCESSOR_8583 8584
+#define RIOT_PP_SUCCESSOR_8584 8585
+#define RIOT_PP_SUCCESSOR_8585 8586
+#define RIOT_PP_SUCCESSOR_8586 8587
+#define RIOT_PP_SUCCESSOR_8587 8588
+#define RIOT_PP_SUCCESSOR_8588 8589
+#define RIOT_PP_SUCCESSOR_8589 8590
+#define RIOT_PP_SUCCESSOR_8590 8591
+#define RIOT_PP_SUCCESSOR_8591 8592
+#define RIOT_PP_SUCCESSOR_8592 8593
+#define RIOT_PP_SUCCESSOR_8593 8594
+#define RIOT_PP_SUCCESSOR_8594 8595
+#define RIOT_PP_SUCCESSOR_8595 8596
+#define RIOT_PP_SUCCESSOR_8596 8597
+#define RIOT_PP_SUCCESSOR_8597 8598
+#define RIOT_PP_SUCCESSOR_8598 8599
+#define RIOT_PP_SUCCESSOR_8599 8600
+#define RIOT_PP_SUCCESSOR_8600 8601
+#define RIOT_PP_SUCCESSOR_8601 8602
+#define RIOT_PP_SUCCESSOR_8602 8603
+#define RIOT_PP_SUCCESSOR_8603 8604
+#define RIOT_PP_SUCCESSOR_8604 8605
+#define RIOT_PP_SUCCESSOR_8605 8606
+#define RIOT_PP_SUCCESSOR_8606 8607
+#define RIOT_PP_SUCCESSOR_8607 8608
+#define RIOT_PP_SUCCESSOR_8608 8609
+#define RIOT_PP_SUCCESSOR_8609 8610
+#define RIOT_PP_SUCCESSOR_8610 8611
+#define RIOT_PP_SUCCESSOR_8611 8612
+#define RIOT_PP_SUCCESSOR_8612 8613
+#define RIOT_PP_SUCCESSOR_8613 8614
+#define RIOT_PP_SUCCESSOR_8614 8615
+#define RIOT_PP_SUCCESSOR_8615 8616
+#define RIOT_PP_SUCCESSOR_8616 8617
+#define RIOT_PP_SUCCESSOR_8617 8618
+#define RIOT_PP_SUCCESSOR_8618 8619
+#define RIOT_PP_SUCCESSOR_8619 8620
+#define RIOT_PP_SUCCESSOR_8620 8621
+#define RIOT_PP_SUCCESSOR_8621 8622
+#define RIOT_PP_SUCCESSOR_8622 8623
+#define RIOT_PP_SUCCESSOR_8623 8624
+#define RIOT_PP_SUCCESSOR_8624 8625
+#define RIOT_PP_SUCCESSOR_8625 8626
+#define RIOT_PP_SUCCESSOR_8626 8627
+#define RIOT_PP_SUCCESSOR_8627 8628
+#define RIOT_PP_SUCCESSOR_8628 8629
+#define RIOT_PP_SUCCESSOR_8629 8630
+#define RIOT_PP_SUCCESSOR_8630 8631
+#define RIOT_PP_SUCCESSOR_8631 8632
+#define RIOT_PP_SUCCESSOR_8632 8633
+#define RIOT_PP_SUCCESSOR_8633 8634
+#define RIOT_PP_SUCCESSOR_8634 8635
+#define RIOT_PP_SUCCESSOR_8635 8636
+#define RIOT_PP_SUCCESSOR_8636 8637
+#define RIOT_PP_SUCCESSOR_8637 8638
+#define RIOT_PP_SUCCESSOR_8638 8639
+#define RIOT_PP_SUCCESSOR_8639 8640
+#define RIOT_PP_SUCCESSOR_8640 8641
+#define RIOT_PP_SUCCESSOR_8641 8642
+#define RIOT_PP_SUCCESSOR_8642 8643
+#define RIOT_PP_SUCCESSOR_8643 8644
+#define RIOT_PP_SUCCESSOR_8644 8645
+#define RIOT_PP_SUCCESSOR_8645 8646
+#define RIOT_PP_SUCCESSOR_8646 8647
+#define RIOT_PP_SUCCESSOR_8647 8648
+#define RIOT_PP_SUCCESSOR_8648 8649
+#define RIOT_PP_SUCCESSOR_8649 8650
+#define RIOT_PP_SUCCESSOR_8650 8651
+#define RIOT_PP_SUCCESSOR_8651 8652
+#define RIOT_PP_SUCCESSOR_8652 8653
+#define RIOT_PP_SUCCESSOR_8653 8654
+#define RIOT_PP_SUCCESSOR_8654 8655
+#define RIOT_PP_SUCCESSOR_8655 8656
+#define RIOT_PP_SUCCESSOR_8656 8657
+#define RIOT_PP_SUCCESSOR_8657 8658
+#define RIOT_PP_SUCCESSOR_8658 8659
+#define RIOT_PP_SUCCESSOR_8659 8660
+#define RIOT_PP_SUCCESSOR_8660 8661
+#define RIOT_PP_SUCCESSOR_8661 8662
+#define RIOT_PP_SUCCESSOR_8662 8663
+#define RIOT_PP_SUCCESSOR_8663 8664
+#define RIOT_PP_SUCCESSOR_8664 8665
+#define RIOT_PP_SUCCESSOR_8665 8666
+#define RIOT_PP_SUCCESSOR_8666 8667
+#define RIOT_PP_SUCCESSOR_8667 8668
+#define RIOT_PP_SUCCESSOR_8668 8669
+#define RIOT_PP_SUCCESSOR_8669 8670
+#define RIOT_PP_SUCCESSOR_8670 8671
+#define RIOT_PP_SUCCESSOR_8671 8672
+#define RIOT_PP_SUCCESSOR_8672 8673
+#define RIOT_PP_SUCCESSOR_8673 8674
+#define RIOT_PP_SUCCESSOR_8674 8675
+#define RIOT_PP_SUCCESSOR_8675 8676
+#define RIOT_PP_SUCCESSOR_8676 8677
+#define RIOT_PP_SUCCESSOR_8677 8678
+#define RIOT_PP_SUCCESSOR_8678 8679
+#define RIOT_PP_SUCCESSOR_8679 8680
+#define RIOT_PP_SUCCESSOR_8680 8681
+#define RIOT_PP_SUCCESSOR_8681 8682
+#define RIOT_PP_SUCCESSOR_8682 8683
+#define RIOT_PP_SUCCESSOR_8683 8684
+#define RIOT_PP_SUCCESSOR_8684 8685
+#define RIOT_PP_SUCCESSOR_8685 8686
+#define RIOT_PP_SUCCESSOR_8686 8687
+#define RIOT_PP_SUCCESSOR_8687 8688
+#define RIOT_PP_SUCCESSOR_8688 8689
+#define RIOT_PP_SUCCESSOR_8689 8690
+#define RIOT_PP_SUCCESSOR_8690 8691
+#define RIOT_PP_SUCCESSOR_8691 8692
+#define RIOT_PP_SUCCESSOR_8692 8693
+#define RIOT_PP_SUCCESSOR_8693 8694
+#define RIOT_PP_SUCCESSOR_8694 8695
+#define RIOT_PP_SUCCESSOR_8695 8696
+#define RIOT_PP_SUCCESSOR_8696 8697
+#define RIOT_PP_SUCCESSOR_8697 8698
+#define RIOT_PP_SUCCESSOR_8698 8699
+#define RIOT_PP_SUCCESSOR_8699 8700
+#define RIOT_PP_SUCCESSOR_8700 8701
+#define RIOT_PP_SUCCESSOR_8701 8702
+#define RIOT_PP_SUCCESSOR_8702 8703
+#define RIOT_PP_SUCCESSOR_8703 8704
+#define RIOT_PP_SUCCESSOR_8704 8705
+#define RIOT_PP_SUCCESSOR_8705 8706
+#define RIOT_PP_SUCCESSOR_8706 8707
+#define RIOT_PP_SUCCESSOR_8707 8708
+#define RIOT_PP_SUCCESSOR_8708 8709
+#define RIOT_PP_SUCCESSOR_8709 8710
+#define RIOT_PP_SUCCESSOR_8710 8711
+#define RIOT_PP_SUCCESSOR_8711 8712
+#define RIOT_PP_SUCCESSOR_8712 8713
+#define RIOT_PP_SUCCESSOR_8713 8714
+#define RIOT_PP_SUCCESSOR_8714 8715
+#define RIOT_PP_SUCCESSOR_8715 8716
+#define RIOT_PP_SUCCESSOR_8716 8717
+#define RIOT_PP_SUCCESSOR_8717 8718
+#define RIOT_PP_SUCCESSOR_8718 8719
+#define RIOT_PP_SUCCESSOR_8719 8720
+#define RIOT_PP_SUCCESSOR_8720 8721
+#define RIOT_PP_SUCCESSOR_8721 8722
+#define RIOT_PP_SUCCESSOR_8722 8723
+#define RIOT_PP_SUCCESSOR_8723 8724
+#define RIOT_PP_SUCCESSOR_8724 8725
+#define RIOT_PP_SUCCESSOR_8725 8726
+#define RIOT_PP_SUCCESSOR_8726 8727
+#define RIOT_PP_SUCCESSOR_8727 8728
+#define RIOT_PP_SUCCESSOR_8728 8729
+#define RIOT_PP_SUCCESSOR_8729 8730
+#define RIOT_PP_SUCCESSOR_8730 8731
+#define RIOT_PP_SUCCESSOR_8731 8732
+#define RIOT_PP_SUCCESSOR_8732 8733
+#define RIOT_PP_SUCCESSOR_8733 8734
+#define RIOT_PP_SUCCESSOR_8734 8735
+#define RIOT_PP_SUCCESSOR_8735 8736
+#define RIOT_PP_SUCCESSOR_8736 8737
+#define RIOT_PP_SUCCESSOR_8737 8738
+#define RIOT_PP_SUCCESSOR_8738 8739
+#define RIOT_PP_SUCCESSOR_8739 8740
+#define RIOT_PP_SUCCESSOR_8740 8741
+#define RIOT_PP_SUCCESSOR_8741 8742
+#define RIOT_PP_SUCCESSOR_8742 8743
+#define RIOT_PP_SUCCESSOR_8743 8744
+#define RIOT_PP_SUCCESSOR_8744 8745
+#define RIOT_PP_SUCCESSOR_8745 8746
+#define RIOT_PP_SUCCESSOR_8746 8747
+#define RIOT_PP_SUCCESSOR_8747 8748
+#define RIOT_PP_SUCCESSOR_8748 8749
+#define RIOT_PP_SUCCESSOR_8749 8750
+#define RIOT_PP_SUCCESSOR_8750 8751
+#define RIOT_PP_SUCCESSOR_8751 8752
+#define RIOT_PP_SUCCESSOR_8752 8753
+#define RIOT_PP_SUCCESSOR_8753 8754
+#define RIOT_PP_SUCCESSOR_8754 8755
+#define RIOT_PP_SUCCESSOR_8755 8756
+#define RIOT_PP_SUCCESSOR_8756 8757
+#define RIOT_PP_SUCCESSOR_8757 8758
+#define RIOT_PP_SUCCESSOR_8758 8759
+#define RIOT_PP_SUCCESSOR_8759 8760
+#define RIOT_PP_SUCCESSOR_8760 8761
+#define RIOT_PP_SUCCESSOR_8761 8762
+#define RIOT_PP_SUCCESSOR_8762 8763
+#define RIOT_PP_SUCCESSOR_8763 8764
+#define RIOT_PP_SUCCESSOR_8764 8765
+#define RIOT_PP_SUCCESSOR_8765 8766
+#define RIOT_PP_SUCCESSOR_8766 8767
+#define RIOT_PP_SUCCESSOR_8767 8768
+#define RIOT_PP_SUCCESSOR_8768 8769
+#define RIOT_PP_SUCCESSOR_8769 8770
+#define RIOT_PP_SUCCESSOR_8770 8771
+#define RIOT_PP_SUCCESSOR_8771 8772
+#define RIOT_PP_SUCCESSOR_8772 8773
+#define RIOT_PP_SUCCESSOR_8773 8774
+#define RIOT_PP_SUCCESSOR_8774 8775
+#define RIOT_PP_SUCCESSOR_8775 8776
+#define RIOT_PP_SUCCESSOR_8776 8777
+#define RIOT_PP_SUCCESSOR_8777 8778
+#define RIOT_PP_SUCCESSOR_8778 8779
+#define RIOT_PP_SUCCESSOR_8779 8780
+#define RIOT_PP_SUCCESSOR_8780 8781
+#define RIOT_PP_SUCCESSOR_8781 8782
+#define RIOT_PP_SUCCESSOR_8782 8783
+#define RIOT_PP_SUCCESSOR_8783 8784
+#define RIOT_PP_SUCCESSOR_8784 8785
+#define RIOT_PP_SUCCESSOR_8785 8786
+#define RIOT_PP_SUCCESSOR_8786 8787
+#define RIOT_PP_SUCCESSOR_8787 8788
+#define RIOT_PP_SUCCESSOR_8788 8789
+#define RIOT_PP_SUCCESSOR_8789 8790
+#define RIOT_PP_SUCCESSOR_8790 8791
+#define RIOT_PP_SUCCESSOR_8791 8792
+#define RIOT_PP_SUCCESSOR_8792 8793
+#define RIOT_PP_SUCCESSOR_8793 8794
+#define RIOT_PP_SUCCESSOR_8794 8795
+#define RIOT_PP_SUCCESSOR_8795 8796
+#define RIOT_PP_SUCCESSOR_8796 8797
+#define RIOT_PP_SUCCESSOR_8797 8798
+#define RIOT_PP_SUCCESSOR_8798 8799
+#define RIOT_PP_SUCCESSOR_8799 8800
+#define RIOT_PP_SUCCESSOR_8800 8801
+#define RIOT_PP_SUCCESSOR_8801 8802
+#define RIOT_PP_SUCCESSOR_8802 8803
+#define RIOT_PP_SUCCESSOR_8803 8804
+#define RIOT_PP_SUCCESSOR_8804 8805
+#define RIOT_PP_SUCCESSOR_8805 8806
+#define RIOT_PP_SUCCESSOR_8806 8807
+#define RIOT_PP_SUCCESSOR_8807 8808
+#define RIOT_PP_SUCCESSOR_8808 8809
+#define RIOT_PP_SUCCESSOR_8809 8810
+#define RIOT_PP_SUCCESSOR_8810 8811
+#define RIOT_PP_SUCCESSOR_8811 8812
+#define RIOT_PP_SUCCESSOR_8812 8813
+#define RIOT_PP_SUCCESSOR_8813 8814
+#define RIOT_PP_SUCCESSOR_8814 8815
+#define RIOT_PP_SUCCESSOR_8815 8816
+#define RIOT_PP_SUCCESSOR_8816 8817
+#define RIOT_PP_SUCCESSOR_8817 8818
+#define RIOT_PP_SUCCESSOR_8818 8819
+#define RIOT_PP_SUCCESSOR_8819 8820
+#define RIOT_PP_SUCCESSOR_8820 8821
+#define RIOT_PP_SUCCESSOR_8821 8822
+#define RIOT_PP_SUCCESSOR_8822 8823
+#define RIOT_PP_SUCCESSOR_8823 8824
+#define RIOT_PP_SUCCESSOR_8824 8825
+#define RIOT_PP_SUCCESSOR_8825 8826
+#define RIOT_PP_SUCCESSOR_8826 8827
+#define RIOT_PP_SUCCESSOR_8827 8828
+#define RIOT_PP_SUCCESSOR_8828 8829
+#define RIOT_PP_SUCCESSOR_8829 8830
+#define RIOT_PP_SUCCESSOR_8830 8831
+#define RIOT_PP_SUCCESSOR_8831 8832
+#define RIOT_PP_SUCCESSOR_8832 8833
+#define RIOT_PP_SUCCESSOR_8833 8834
+#define RIOT_PP_SUCCESSOR_8834 8835
+#define RIOT_PP_SUCCESSOR_8835 8836
+#define RIOT_PP_SUCCESSOR_8836 8837
+#define RIOT_PP_SUCCESSOR_8837 8838
+#define RIOT_PP_SUCCESSOR_8838 8839
+#define RIOT_PP_SUCCESSOR_8839 8840
+#define RIOT_PP_SUCCESSOR_8840 8841
+#define RIOT_PP_SUCCESSOR_8841 8842
+#define RIOT_PP_SUCCESSOR_8842 8843
+#define RIOT_PP_SUCCESSOR_8843 8844
+#define RIOT_PP_SUCCESSOR_8844 8845
+#define RIOT_PP_SUCCESSOR_8845 8846
+#define RIOT_PP_SUCCESSOR_8846 8847
+#define RIOT_PP_SUCCESSOR_8847 8848
+#define RIOT_PP_SUCCESSOR_8848 8849
+#define RIOT_PP_SUCCESSOR_8849 8850
+#define RIOT_PP_SUCCESSOR_8850 8851
+#define RIOT_PP_SUCCESSOR_8851 8852
+#define RIOT_PP_SUCCESSOR_8852 8853
+#define RIOT_PP_SUCCESSOR_8853 8854
+#define RIOT_PP_SUCCESSOR_8854 8855
+#define RIOT_PP_SUCCESSOR_8855 8856
+#define RIOT_PP_SUCCESSOR_8856 8857
+#define RIOT_PP_SUCCESSOR_8857 8858
+#define RIOT_PP_SUCCESSOR_8858 8859
+#define RIOT_PP_SUCCESSOR_8859 8860
+#define RIOT_PP_SUCCESSOR_8860 8861
+#define RIOT_PP_SUCCESSOR_8861 8862
+#define RIOT_PP_SUCCESSOR_8862 8863
+#define RIOT_PP_SUCCESSOR_8863 8864
+#define RIOT_PP_SUCCESSOR_8864 8865
+#define RIOT_PP_SUCCESSOR_8865 8866
+#define RIOT_PP_SUCCESSOR_8866 8867
+#define RIOT_PP_SUCCESSOR_8867 8868
+#define RIOT_PP_SUCCESSOR_8868 8869
+#define RIOT_PP_SUCCESSOR_8869 8870
+#define RIOT_PP_SUCCESSOR_8870 8871
+#define RIOT_PP_SUCCESSOR_8871 8872
+#define RIOT_PP_SUCCESSOR_8872 8873
+#define RIOT_PP_SUCCESSOR_8873 8874
+#define RIOT_PP_SUCCESSOR_8874 8875
+#define RIOT_PP_SUCCESSOR_8875 8876
+#define RIOT_PP_SUCCESSOR_8876 8877
+#define RIOT_PP_SUCCESSOR_8877 8878
+#define RIOT_PP_SUCCESSOR_8878 8879
+#define RIOT_PP_SUCCESSOR_8879 8880
+#define RIOT_PP_SUCCESSOR_8880 8881
+#define RIOT_PP_SUCCESSOR_8881 8882
+#define RIOT_PP_SUCCESSOR_8882 8883
+#define RIOT_PP_SUCCESSOR_8883 8884
+#define RIOT_PP_SUCCESSOR_8884 8885
+#define RIOT_PP_SUCCESSOR_8885 8886
+#define RIOT_PP_SUCCESSOR_8886 8887
+#define RIOT_PP_SUCCESSOR_8887 8888
+#define RIOT_PP_SUCCESSOR_8888 8889
+#define RIOT_PP_SUCCESSOR_8889 8890
+#define RIOT_PP_SUCCESSOR_8890 8891
+#define RIOT_PP_SUCCESSOR_8891 8892
+#define RIOT_PP_SUCCESSOR_8892 8893
+#define RIOT_PP_SUCCESSOR_8893 8894
+#define RIOT_PP_SUCCESSOR_8894 8895
+#define RIOT_PP_SUCCESSOR_8895 8896
+#define RIOT_PP_SUCCESSOR_8896 8897
+#define RIOT_PP_SUCCESSOR_8897 8898
+#define RIOT_PP_SUCCESSOR_8898 8899
+#define RIOT_PP_SUCCESSOR_8899 8900
+#define RIOT_PP_SUCCESSOR_8900 8901
+#define RIOT_PP_SUCCESSOR_8901 8902
+#define RIOT_PP_SUCCESSOR_8902 8903
+#define RIOT_PP_SUCCESSOR_8903 8904
+#define RIOT_PP_SUCCESSOR_8904 8905
+#define RIOT_PP_SUCCESSOR_8905 8906
+#define RIOT_PP_SUCCESSOR_8906 8907
+#define RIOT_PP_SUCCESSOR_8907 8908
+#define RIOT_PP_SUCCESSOR_8908 8909
+#define RIOT_PP_SUCCESSOR_8909 8910
+#define RIOT_PP_SUCCESSOR_8910 8911
+#define RIOT_PP_SUCCESSOR_8911 8912
+#define RIOT_PP_SUCCESSOR_8912 8913
+#define RIOT_PP_SUCCESSOR_8913 8914
+#define RIOT_PP_SUCCESSOR_8914 8915
+#define RIOT_PP_SUCCESSOR_8915 8916
+#define RIOT_PP_SUCCESSOR_8916 8917
+#define RIOT_PP_SUCCESSOR_8917 8918
+#define RIOT_PP_SUCCESSOR_8918 8919
+#define RIOT_PP_SUCCESSOR_8919 8920
+#define RIOT_PP_SUCCESSOR_8920 8921
+#define RIOT_PP_SUCCESSOR_8921 8922
+#define RIOT_PP_SUCCESSOR_8922 8923
+#define RIOT_PP_SUCCESSOR_8923 8924
+#define RIOT_PP_SUCCESSOR_8924 8925
+#define RIOT_PP_SUCCESSOR_8925 8926
+#define RIOT_PP_SUCCESSOR_8926 8927
+#define RIOT_PP_SUCCESSOR_8927 8928
+#define RIOT_PP_SUCCESSOR_8928 8929
+#define RIOT_PP_SUCCESSOR_8929 8930
+#define RIOT_PP_SUCCESSOR_8930 8931
+#define RIOT_PP_SUCCESSOR_8931 8932
+#define RIOT_PP_SUCCESSOR_8932 8933
+#define RIOT_PP_SUCCESSOR_8933 8934
+#define RIOT_PP_SUCCESSOR_8934 8935
+#define RIOT_PP_SUCCESSOR_8935 8936
+#define RIOT_PP_SUCCESSOR_8936 8937
+#define RIOT_PP_SUCCESSOR_8937 8938
+#define RIOT_PP_SUCCESSOR_8938 8939
+#define RIOT_PP_SUCCESSOR_8939 8940
+#define RIOT_PP_SUCCESSOR_8940 8941
+#define RIOT_PP_SUCCESSOR_8941 8942
+#define RIOT_PP_SUCCESSOR_8942 8943
+#define RIOT_PP_SUCCESSOR_8943 8944
+#define RIOT_PP_SUCCESSOR_8944 8945
+#define RIOT_PP_SUCCESSOR_8945 8946
+#define RIOT_PP_SUCCESSOR_8946 8947
+#define RIOT_PP_SUCCESSOR_8947 8948
+#define RIOT_PP_SUCCESSOR_8948 8949
+#define RIOT_PP_SUCCESSOR_8949 8950
+#define RIOT_PP_SUCCESSOR_8950 8951
+#define RIOT_PP_SUCCESSOR_8951 8952
+#define RIOT_PP_SUCCESSOR_8952 8953
+#define RIOT_PP_SUCCESSOR_8953 8954
+#define RIOT_PP_SUCCESSOR_8954 8955
+#define RIOT_PP_SUCCESSOR_8955 8956
+#define RIOT_PP_SUCCESSOR_8956 8957
+#define RIOT_PP_SUCCESSOR_8957 8958
+#define RIOT_PP_SUCCESSOR_8958 8959
+#define RIOT_PP_SUCCESSOR_8959 8960
+#define RIOT_PP_SUCCESSOR_8960 8961
+#define RIOT_PP_SUCCESSOR_8961 8962
+#define RIOT_PP_SUCCESSOR_8962 8963
+#define RIOT_PP_SUCCESSOR_8963 8964
+#define RIOT_PP_SUCCESSOR_8964 8965
+#define RIOT_PP_SUCCESSOR_8965 8966
+#define RIOT_PP_SUCCESSOR_8966 8967
+#define RIOT_PP_SUCCESSOR_8967 8968
+#define RIOT_PP_SUCCESSOR_8968 8969
+#define RIOT_PP_SUCCESSOR_8969 8970
+#define RIOT_PP_SUCCESSOR_8970 8971
+#define RIOT_PP_SUCCESSOR_8971 8972
+#define RIOT_PP_SUCCESSOR_8972 8973
+#define RIOT_PP_SUCCESSOR_8973 8974
+#define RIOT_PP_SUCCESSOR_8974 8975
+#define RIOT_PP_SUCCESSOR_8975 8976
+#define RIOT_PP_SUCCESSOR_8976 8977
+#define RIOT_PP_SUCCESSOR_8977 8978
+#define RIOT_PP_SUCCESSOR_8978 8979
+#define RIOT_PP_SUCCESSOR_8979 8980
+#define RIOT_PP_SUCCESSOR_8980 8981
+#define RIOT_PP_SUCCESSOR_8981 8982
+#define RIOT_PP_SUCCESSOR_8982 8983
+#define RIOT_PP_SUCCESSOR_8983 8984
+#define RIOT_PP_SUCCESSOR_8984 8985
+#define RIOT_PP_SUCCESSOR_8985 8986
+#define RIOT_PP_SUCCESSOR_8986 8987
+#define RIOT_PP_SUCCESSOR_8987 8988
+#define RIOT_PP_SUCCESSOR_8988 8989
+#define RIOT_PP_SUCCESSOR_8989 8990
+#define RIOT_PP_SUCCESSOR_8990 8991
+#define RIOT_PP_SUCCESSOR_8991 8992
+#define RIOT_PP_SUCCESSOR_8992 8993
+#define RIOT_PP_SUCCESSOR_8993 8994
+#define RIOT_PP_SUCCESSOR_8994 8995
+#define RIOT_PP_SUCCESSOR_8995 8996
+#define RIOT_PP_SUCCESSOR_8996 8997
+#define RIOT_PP_SUCCESSOR_8997 8998
+#define RIOT_PP_SUCCESSOR_8998 8999
+#define RIOT_PP_SUCCESSOR_8999 9000
+#define RIOT_PP_SUCCESSOR_9000 9001
+#define RIOT_PP_SUCCESSOR_9001 9002
+#define RIOT_PP_SUCCESSOR_9002 9003
+#define RIOT_PP_SUCCESSOR_9003 9004
+#define RIOT_PP_SUCCESSOR_9004 9005
+#define RIOT_PP_SUCCESSOR_9005 9006
+#define RIOT_PP_SUCCESSOR_9006 9007
+#define RIOT_PP_SUCCESSOR_9007 9008
+#define RIOT_PP_SUCCESSOR_9008 9009
+#define RIOT_PP_SUCCESSOR_9009 9010
+#define RIOT_PP_SUCCESSOR_9010 9011
+#define RIOT_PP_SUCCESSOR_9011 9012
+#define RIOT_PP_SUCCESSOR_9012 9013
+#define RIOT_PP_SUCCESSOR_9013 9014
+#define RIOT_PP_SUCCESSOR_9014 9015
+#define RIOT_PP_SUCCESSOR_9015 9016
+#define RIOT_PP_SUCCESSOR_9016 9017
+#define RIOT_PP_SUCCESSOR_9017 9018
+#define RIOT_PP_SUCCESSOR_9018 9019
+#define RIOT_PP_SUCCESSOR_9019 9020
+#define RIOT_PP_SUCCESSOR_9020 9021
+#define RIOT_PP_SUCCESSOR_9021 9022
+#define RIOT_PP_SUCCESSOR_9022 9023
+#define RIOT_PP_SUCCESSOR_9023 9024
+#define RIOT_PP_SUCCESSOR_9024 9025
+#define RIOT_PP_SUCCESSOR_9025 9026
+#define RIOT_PP_SUCCESSOR_9026 9027
+#define RIOT_PP_SUCCESSOR_9027 9028
+#define RIOT_PP_SUCCESSOR_9028 9029
+#define RIOT_PP_SUCCESSOR_9029 9030
+#define RIOT_PP_SUCCESSOR_9030 9031
+#define RIOT_PP_SUCCESSOR_9031 9032
+#define RIOT_PP_SUCCESSOR_9032 9033
+#define RIOT_PP_SUCCESSOR_9033 9034
+#define RIOT_PP_SUCCESSOR_9034 9035
+#define RIOT_PP_SUCCESSOR_9035 9036
+#define RIOT_PP_SUCCESSOR_9036 9037
+#define RIOT_PP_SUCCESSOR_9037 9038
+#define RIOT_PP_SUCCESSOR_9038 9039
+#define RIOT_PP_SUCCESSOR_9039 9040
+#define RIOT_PP_SUCCESSOR_9040 9041
+#define RIOT_PP_SUCCESSOR_9041 9042
+#define RIOT_PP_SUCCESSOR_9042 9043
+#define RIOT_PP_SUCCESSOR_9043 9044
+#define RIOT_PP_SUCCESSOR_9044 9045
+#define RIOT_PP_SUCCESSOR_9045 9046
+#define RIOT_PP_SUCCESSOR_9046 9047
+#define RIOT_PP_SUCCESSOR_9047 9048
+#define RIOT_PP_SUCCESSOR_9048 9049
+#define RIOT_PP_SUCCESSOR_9049 9050
+#define RIOT_PP_SUCCESSOR_9050 9051
+#define RIOT_PP_SUCCESSOR_9051 9052
+#define RIOT_PP_SUCCESSOR_9052 9053
+#define RIOT_PP_SUCCESSOR_9053 9054
+#define RIOT_PP_SUCCESSOR_9054 9055
+#define RIOT_PP_SUCCESSOR_9055 9056
+#define RIOT_PP_SUCCESSOR_9056 9057
+#define RIOT_PP_SUCCESSOR_9057 9058
+#define RIOT_PP_SUCCESSOR_9058 9059
+#define RIOT_PP_SUCCESSOR_9059 9060
+#define RIOT_PP_SUCCESSOR_9060 9061
+#define RIOT_PP_SUCCESSOR_9061 9062
+#define RIOT_PP_SUCCESSOR_9062 9063
+#define RIOT_PP_SUCCESSOR_9063 9064
+#define RIOT_PP_SUCCESSOR_9064 9065
+#define RIOT_PP_SUCCESSOR_9065 9066
+#define RIOT_PP_SUCCESSOR_9066 9067
+#define RIOT_PP_SUCCESSOR_9067 9068
+#define RIOT_PP_SUCCESSOR_9068 9069
+#define RIOT_PP_SUCCESSOR_9069 9070
+#define RIOT_PP_SUCCESSOR_9070 9071
+#define RIOT_PP_SUCCESSOR_9071 9072
+#define RIOT_PP_SUCCESSOR_9072 9073
+#define RIOT_PP_SUCCESSOR_9073 9074
+#define RIOT_PP_SUCCESSOR_9074 9075
+#define RIOT_PP_SUCCESSOR_9075 9076
+#define RIOT_PP_SUCCESSOR_9076 9077
+#define RIOT_PP_SUCCESSOR_9077 9078
+#define RIOT_PP_SUCCESSOR_9078 9079
+#define RIOT_PP_SUCCESSOR_9079 9080
+#define RIOT_PP_SUCCESSOR_9080 9081
+#define RIOT_PP_SUCCESSOR_9081 9082
+#define RIOT_PP_SUCCESSOR_9082 9083
+#define RIOT_PP_SUCCESSOR_9083 9084
+#define RIOT_PP_SUCCESSOR_9084 9085
+#define RIOT_PP_SUCCESSOR_9085 9086
+#define RIOT_PP_SUCCESSOR_9086 9087
+#define RIOT_PP_SUCCESSOR_9087 9088
+#define RIOT_PP_SUCCESSOR_9088 9089
+#define RIOT_PP_SUCCESSOR_9089 9090
+#define RIOT_PP_SUCCESSOR_9090 9091
+#define RIOT_PP_SUCCESSOR_9091 9092
+#define RIOT_PP_SUCCESSOR_9092 9093
+#define RIOT_PP_SUCCESSOR_9093 9094
+#define RIOT_PP_SUCCESSOR_9094 9095
+#define RIOT_PP_SUCCESSOR_9095 9096
+#define RIOT_PP_SUCCESSOR_9096 9097
+#define RIOT_PP_SUCCESSOR_9097 9098
+#define RIOT_PP_SUCCESSOR_9098 9099
+#define RIOT_PP_SUCCESSOR_9099 9100
+#define RIOT_PP_SUCCESSOR_9100 9101
+#define RIOT_PP_SUCCESSOR_9101 9102
+#define RIOT_PP_SUCCESSOR_9102 9103
+#define RIOT_PP_SUCCESSOR_9103 9104
+#define RIOT_PP_SUCCESSOR_9104 9105
+#define RIOT_PP_SUCCESSOR_9105 9106
+#define RIOT_PP_SUCCESSOR_9106 9107
+#define RIOT_PP_SUCCESSOR_9107 9108
+#define RIOT_PP_SUCCESSOR_9108 9109
+#define RIOT_PP_SUCCESSOR_9109 9110
+#define RIOT_PP_SUCCESSOR_9110 9111
+#define RIOT_PP_SUCCESSOR_9111 9112
+#define RIOT_PP_SUCCESSOR_9112 9113
+#define RIOT_PP_SUCCESSOR_9113 9114
+#define RIOT_PP_SUCCESSOR_9114 9115
+#define RIOT_PP_SUCCESSOR_9115 9116
+#define RIOT_PP_SUCCESSOR_9116 9117
+#define RIOT_PP_SUCCESSOR_9117 9118
+#define RIOT_PP_SUCCESSOR_9118 9119
+#define RIOT_PP_SUCCESSOR_9119 9120
+#define RIOT_PP_SUCCESSOR_9120 9121
+#define RIOT_PP_SUCCESSOR_9121 9122
+#define RIOT_PP_SUCCESSOR_9122 9123
+#define RIOT_PP_SUCCESSOR_9123 9124
+#define RIOT_PP_SUCCESSOR_9124 9125
+#define RIOT_PP_SUCCESSOR_9125 9126
+#define RIOT_PP_SUCCESSOR_9126 9127
+#define RIOT_PP_SUCCESSOR_9127 9128
+#define RIOT_PP_SUCCESSOR_9128 9129
+#define RIOT_PP_SUCCESSOR_9129 9130
+#define RIOT_PP_SUCCESSOR_9130 9131
+#define RIOT_PP_SUCCESSOR_9131 9132
+#define RIOT_PP_SUCCESSOR_9132 9133
+#define RIOT_PP_SUCCESSOR_9133 9134
+#define RIOT_PP_SUCCESSOR_9134 9135
+#define RIOT_PP_SUCCESSOR_9135 9136
+#define RIOT_PP_SUCCESSOR_9136 9137
+#define RIOT_PP_SUCCESSOR_9137 9138
+#define RIOT_PP_SUCCESSOR_9138 9139
+#define RIOT_PP_SUCCESSOR_9139 9140
+#define RIOT_PP_SUCCESSOR_9140 9141
+#define RIOT_PP_SUCCESSOR_9141 9142
+#define RIOT_PP_SUCCESSOR_9142 9143
+#define RIOT_PP_SUCCESSOR_9143 9144
+#define RIOT_PP_SUCCESSOR_9144 9145
+#define RIOT_PP_SUCCESSOR_9145 9146
+#define RIOT_PP_SUCCESSOR_9146 9147
+#define RIOT_PP_SUCCESSOR_9147 9148
+#define RIOT_PP_SUCCESSOR_9148 9149
+#define RIOT_PP_SUCCESSOR_9149 9150
+#define RIOT_PP_SUCCESSOR_9150 9151
+#define RIOT_PP_SUCCESSOR_9151 9152
+#define RIOT_PP_SUCCESSOR_9152 9153
+#define RIOT_PP_SUCCESSOR_9153 9154
+#define RIOT_PP_SUCCESSOR_9154 9155
+#define RIOT_PP_SUCCESSOR_9155 9156
+#define RIOT_PP_SUCCESSOR_9156 9157
+#define RIOT_PP_SUCCESSOR_9157 9158
+#define RIOT_PP_SUCCESSOR_9158 9159
+#define RIOT_PP_SUCCESSOR_9159 9160
+#define RIOT_PP_SUCCESSOR_9160 9161
+#define RIOT_PP_SUCCESSOR_9161 9162
+#define RIOT_PP_SUCCESSOR_9162 9163
+#define RIOT_PP_SUCCESSOR_9163 9164
+#define RIOT_PP_SUCCESSOR_9164 9165
+#define RIOT_PP_SUCCESSOR_9165 9166
+#define RIOT_PP_SUCCESSOR_9166 9167
+#define RIOT_PP_SUCCESSOR_9167 9168
+#define RIOT_PP_SUCCESSOR_9168 9169
+#define RIOT_PP_SUCCESSOR_9169 9170
+#define RIOT_PP_SUCCESSOR_9170 9171
+#define RIOT_PP_SUCCESSOR_9171 9172
+#define RIOT_PP_SUCCESSOR_9172 9173
+#define RIOT_PP_SUCCESSOR_9173 9174
+#define RIOT_PP_SUCCESSOR_9174 9175
+#define RIOT_PP_SUCCESSOR_9175 9176
+#define RIOT_PP_SUCCESSOR_9176 9177
+#define RIOT_PP_SUCCESSOR_9177 9178
+#define RIOT_PP_SUCCESSOR_9178 9179
+#define RIOT_PP_SUCCESSOR_9179 9180
+#define RIOT_PP_SUCCESSOR_9180 9181
+#define RIOT_PP_SUCCESSOR_9181 9182
+#define RIOT_PP_SUCCESSOR_9182 9183
+#define RIOT_PP_SUCCESSOR_9183 9184
+#define RIOT_PP_SUCCESSOR_9184 9185
+#define RIOT_PP_SUCCESSOR_9185 9186
+#define RIOT_PP_SUCCESSOR_9186 9187
+#define RIOT_PP_SUCCESSOR_9187 9188
+#define RIOT_PP_SUCCESSOR_9188 9189
+#define RIOT_PP_SUCCESSOR_9189 9190
+#define RIOT_PP_SUCCESSOR_9190 9191
+#define RIOT_PP_SUCCESSOR_9191 9192
+#define RIOT_PP_SUCCESSOR_9192 9193
+#define RIOT_PP_SUCCESSOR_9193 9194
+#define RIOT_PP_SUCCESSOR_9194 9195
+#define RIOT_PP_SUCCESSOR_9195 9196
+#define RIOT_PP_SUCCESSOR_9196 9197
+#define RIOT_PP_SUCCESSOR_9197 9198
+#define RIOT_PP_SUCCESSOR_9198 9199
+#define RIOT_PP_SUCCESSOR_9199 9200
+#define RIOT_PP_SUCCESSOR_9200 9201
+#define RIOT_PP_SUCCESSOR_9201 9202
+#define RIOT_PP_SUCCESSOR_9202 9203
+#define RIOT_PP_SUCCESSOR_9203 9204
+#define RIOT_PP_SUCCESSOR_9204 9205
+#define RIOT_PP_SUCCESSOR_9205 9206
+#define RIOT_PP_SUCCESSOR_9206 9207
+#define RIOT_PP_SUCCESSOR_9207 9208
+#define RIOT_PP_SUCCESSOR_9208 9209
+#define RIOT_PP_SUCCESSOR_9209 9210
+#define RIOT_PP_SUCCESSOR_9210 9211
+#define RIOT_PP_SUCCESSOR_9211 9212
+#define RIOT_PP_SUCCESSOR_9212 9213
+#define RIOT_PP_SUCCESSOR_9213 9214
+#define RIOT_PP_SUCCESSOR_9214 9215
+#define RIOT_PP_SUCCESSOR_9215 9216
+#define RIOT_PP_SUCCESSOR_9216 9217
+#define RIOT_PP_SUCCESSOR_9217 9218
+#define RIOT_PP_SUCCESSOR_9218 9219
+#define RIOT_PP_SUCCESSOR_9219 9220
+#define RIOT_PP_SUCCESSOR_9220 9221
+#define RIOT_PP_SUCCESSOR_9221 9222
+#define RIOT_PP_SUCCESSOR_9222 9223
+#define RIOT_PP_SUCCESSOR_9223 9224
+#define RIOT_PP_SUCCESSOR_9224 9225
+#define RIOT_PP_SUCCESSOR_9225 9226
+#define RIOT_PP_SUCCESSOR_9226 9227
+#define RIOT_PP_SUCCESSOR_9227 9228
+#define RIOT_PP_SUCCESSOR_9228 9229
+#define RIOT_PP_SUCCESSOR_9229 9230
+#define RIOT_PP_SUCCESSOR_9230 9231
+#define RIOT_PP_SUCCESSOR_9231 9232
+#define RIOT_PP_SUCCESSOR_9232 9233
+#define RIOT_PP_SUCCESSOR_9233 9234
+#define RIOT_PP_SUCCESSOR_9234 9235
+#define RIOT_PP_SUCCESSOR_9235 9236
+#define RIOT_PP_SUCCESSOR_9236 9237
+#define RIOT_PP_SUCCESSOR_9237 9238
+#define RIOT_PP_SUCCESSOR_9238 9239
+#define RIOT_PP_SUCCESSOR_9239 9240
+#define RIOT_PP_SUCCESSOR_9240 9241
+#define RIOT_PP_SUCCESSOR_9241 9242
+#define RIOT_PP_SUCCESSOR_9242 9243
+#define RIOT_PP_SUCCESSOR_9243 9244
+#define RIOT_PP_SUCCESSOR_9244 9245
+#define RIOT_PP_SUCCESSOR_9245 9246
+#define RIOT_PP_SUCCESSOR_9246 9247
+#define RIOT_PP_SUCCESSOR_9247 9248
+#define RIOT_PP_SUCCESSOR_9248 9249
+#define RIOT_PP_SUCCESSOR_9249 9250
+#define RIOT_PP_SUCCESSOR_9250 9251
+#define RIOT_PP_SUCCESSOR_9251 9252
+#define RIOT_PP_SUCCESSOR_9252 9253
+#define RIOT_PP_SUCCESSOR_9253 9254
+#define RIOT_PP_SUCCESSOR_9254 9255
+#define RIOT_PP_SUCCESSOR_9255 9256
+#define RIOT_PP_SUCCESSOR_9256 9257
+#define RIOT_PP_SUCCESSOR_9257 9258
+#define RIOT_PP_SUCCESSOR_9258 9259
+#define RIOT_PP_SUCCESSOR_9259 9260
+#define RIOT_PP_SUCCESSOR_9260 9261
+#define RIOT_PP_SUCCESSOR_9261 9262
+#define RIOT_PP_SUCCESSOR_9262 9263
+#define RIOT_PP_SUCCESSOR_9263 9264
+#define RIOT_PP_SUCCESSOR_9264 9265
+#define RIOT_PP_SUCCESSOR_9265 9266
+#define RIOT_PP_SUCCESSOR_9266 9267
+#define RIOT_PP_SUCCESSOR_9267 9268
+#define RIOT_PP_SUCCESSOR_9268 9269
+#define RIOT_PP_SUCCESSOR_9269 9270
+#define RIOT_PP_SUCCESSOR_9270 9271
+#define RIOT_PP_SUCCESSOR_9271 9272
+#define RIOT_PP_SUCCESSOR_9272 9273
+#define RIOT_PP_SUCCESSOR_9273 9274
+#define RIOT_PP_SUCCESSOR_9274 9275
+#define RIOT_PP_SUCCESSOR_9275 9276
+#define RIOT_PP_SUCCESSOR_9276 9277
+#define RIOT_PP_SUCCESSOR_9277 9278
+#define RIOT_PP_SUCCESSOR_9278 9279
+#define RIOT_PP_SUCCESSOR_9279 9280
+#define RIOT_PP_SUCCESSOR_9280 9281
+#define RIOT_PP_SUCCESSOR_9281 9282
+#define RIOT_PP_SUCCESSOR_9282 9283
+#define RIOT_PP_SUCCESSOR_9283 9284
+#define RIOT_PP_SUCCESSOR_9284 9285
+#define RIOT_PP_SUCCESSOR_9285 9286
+#define RIOT_PP_SUCCESSOR_9286 9287
+#define RIOT_PP_SUCCESSOR_9287 9288
+#define RIOT_PP_SUCCESSOR_9288 9289
+#define RIOT_PP_SUCCESSOR_9289 9290
+#define RIOT_PP_SUCCESSOR_9290 9291
+#define RIOT_PP_SUCCESSOR_9291 9292
+#define RIOT_PP_SUCCESSOR_9292 9293
+#define RIOT_PP_SUCCESSOR_9293 9294
+#define RIOT_PP_SUCCESSOR_9294 9295
+#define RIOT_PP_SUCCESSOR_9295 9296
+#define RIOT_PP_SUCCESSOR_9296 9297
+#define RIOT_PP_SUCCESSOR_9297 9298
+#define RIOT_PP_SUCCESSOR_9298 9299
+#define RIOT_PP_SUCCESSOR_9299 9300
+#define RIOT_PP_SUCCESSOR_9300 9301
+#define RIOT_PP_SUCCESSOR_9301 9302
+#define RIOT_PP_SUCCESSOR_9302 9303
+#define RIOT_PP_SUCCESSOR_9303 9304
+#define RIOT_PP_SUCCESSOR_9304 9305
+#define RIOT_PP_SUCCESSOR_9305 9306
+#define RIOT_PP_SUCCESSOR_9306 9307
+#define RIOT_PP_SUCCESSOR_9307 9308
+#define RIOT_PP_SUCCESSOR_9308 9309
+#define RIOT_PP_SUCCESSOR_9309 9310
+#define RIOT_PP_SUCCESSOR_9310 9311
+#define RIOT_PP_SUCCESSOR_9311 9312
+#define RIOT_PP_SUCCESSOR_9312 9313
+#define RIOT_PP_SUCCESSOR_9313 9314
+#define RIOT_PP_SUCCESSOR_9314 9315
+#define RIOT_PP_SUCCESSOR_9315 9316
+#define RIOT_PP_SUCCESSOR_9316 9317
+#define RIOT_PP_SUCCESSOR_9317 9318
+#define RIOT_PP_SUCCESSOR_9318 9319
+#define RIOT_PP_SUCCESSOR_9319 9320
+#define RIOT_PP_SUCCESSOR_9320 9321
+#define RIOT_PP_SUCCESSOR_9321 9322
+#define RIOT_PP_SUCCESSOR_9322 9323
+#define RIOT_PP_SUCCESSOR_9323 9324
+#define RIOT_PP_SUCCESSOR_9324 9325
+#define RIOT_PP_SUCCESSOR_9325 9326
+#define RIOT_PP_SUCCESSOR_9326 9327
+#define RIOT_PP_SUCCESSOR_9327 9328
+#define RIOT_PP_SUCCESSOR_9328 9329
+#define RIOT_PP_SUCCESSOR_9329 9330
+#define RIOT_PP_SUCCESSOR_9330 9331
+#define RIOT_PP_SUCCESSOR_9331 9332
+#define RIOT_PP_SUCCESSOR_9332 9333
+#define RIOT_PP_SUCCESSOR_9333 9334
+#define RIOT_PP_SUCCESSOR_9334 9335
+#define RIOT_PP_SUCCESSOR_9335 9336
+#define RIOT_PP_SUCCESSOR_9336 9337
+#define RIOT_PP_SUCCESSOR_9337 9338
+#define RIOT_PP_SUCCESSOR_9338 9339
+#define RIOT_PP_SUCCESSOR_9339 9340
+#define RIOT_PP_SUCCESSOR_9340 9341
+#define RIOT_PP_SUCCESSOR_9341 9342
+#define RIOT_PP_SUCCESSOR_9342 9343
+#define RIOT_PP_SUCCESSOR_9343 9344
+#define RIOT_PP_SUCCESSOR_9344 9345
+#define RIOT_PP_SUCCESSOR_9345 9346
+#define RIOT_PP_SUCCESSOR_9346 9347
+#define RIOT_PP_SUCCESSOR_9347 9348
+#define RIOT_PP_SUCCESSOR_9348 9349
+#define RIOT_PP_SUCCESSOR_9349 9350
+#define RIOT_PP_SUCCESSOR_9350 9351
+#define RIOT_PP_SUCCESSOR_9351 9352
+#define RIOT_PP_SUCCESSOR_9352 9353
+#define RIOT_PP_SUCCESSOR_9353 9354
+#define RIOT_PP_SUCCESSOR_9354 9355
+#define RIOT_PP_SUCCESSOR_9355 9356
+#define RIOT_PP_SUCCESSOR_9356 9357
+#define RIOT_PP_SUCCESSOR_9357 9358
+#define RIOT_PP_SUCCESSOR_9358 9359
+#define RIOT_PP_SUCCESSOR_9359 9360
+#define RIOT_PP_SUCCESSOR_9360 9361
+#define RIOT_PP_SUCCESSOR_9361 9362
+#define RIOT_PP_SUCCESSOR_9362 9363
+#define RIOT_PP_SUCCESSOR_9363 9364
+#define RIOT_PP_SUCCESSOR_9364 9365
+#define RIOT_PP_SUCCESSOR_9365 9366
+#define RIOT_PP_SUCCESSOR_9366 9367
+#define RIOT_PP_SUCCESSOR_9367 9368
+#define RIOT_PP_SUCCESSOR_9368 9369
+#define RIOT_PP_SUCCESSOR_9369 9370
+#define RIOT_PP_SUCCESSOR_9370 9371
+#define RIOT_PP_SUCCESSOR_9371 9372
+#define RIOT_PP_SUCCESSOR_9372 9373
+#define RIOT_PP_SUCCESSOR_9373 9374
+#define RIOT_PP_SUCCESSOR_9374 9375
+#define RIOT_PP_SUCCESSOR_9375 9376
+#define RIOT_PP_SUCCESSOR_9376 9377
+#define RIOT_PP_SUCCESSOR_9377 9378
+#define RIOT_PP_SUCCESSOR_9378 9379
+#define RIOT_PP_SUCCESSOR_9379 9380
+#define RIOT_PP_SUCCESSOR_9380 9381
+#define RIOT_PP_SUCCESSOR_9381 9382
+#define RIOT_PP_SUCCESSOR_9382 9383
+#define RIOT_PP_SUCCESSOR_9383 9384
+#define RIOT_PP_SUCCESSOR_9384 9385
+#define RIOT_PP_SUCCESSOR_9385 9386
+#define RIOT_PP_SUCCESSOR_9386 9387
+#define RIOT_PP_SUCCESSOR_9387 9388
+#define RIOT_PP_SUCCESSOR_9388 9389
+#define RIOT_PP_SUCCESSOR_9389 9390
+#define RIOT_PP_SUCCESSOR_9390 9391
+#define RIOT_PP_SUCCESSOR_9391 9392
+#define RIOT_PP_SUCCESSOR_9392 9393
+#define RIOT_PP_SUCCESSOR_9393 9394
+#define RIOT_PP_SUCCESSOR_9394 9395
+#define RIOT_PP_SUCCESSOR_9395 9396
+#define RIOT_PP_SUCCESSOR_9396 9397
+#define RIOT_PP_SUCCESSOR_9397 9398
+#define RIOT_PP_SUCCESSOR_9398 9399
+#define RIOT_PP_SUCCESSOR_9399 9400
+#define RIOT_PP_SUCCESSOR_9400 9401
+#define RIOT_PP_SUCCESSOR_9401 9402
+#define RIOT_PP_SUCCESSOR_9402 9403
+#define RIOT_PP_SUCCESSOR_9403 9404
+#define RIOT_PP_SUCCESSOR_9404 9405
+#define RIOT_PP_SUCCESSOR_9405 9406
+#define RIOT_PP_SUCCESSOR_9406 9407
+#define RIOT_PP_SUCCESSOR_9407 9408
+#define RIOT_PP_SUCCESSOR_9408 9409
+#define RIOT_PP_SUCCESSOR_9409 9410
+#define RIOT_PP_SUCCESSOR_9410 9411
+#define RIOT_PP_SUCCESSOR_9411 9412
+#define RIOT_PP_SUCCESSOR_9412 9413
+#define RIOT_PP_SUCCESSOR_9413 9414
+#define RIOT_PP_SUCCESSOR_9414 9415
+#define RIOT_PP_SUCCESSOR_9415 9416
+#define RIOT_PP_SUCCESSOR_9416 9417
+#define RIOT_PP_SUCCESSOR_9417 9418
+#define RIOT_PP_SUCCESSOR_9418 9419
+#define RIOT_PP_SUCCESSOR_9419 9420
+#define RIOT_PP_SUCCESSOR_9420 9421
+#define RIOT_PP_SUCCESSOR_9421 9422
+#define RIOT_PP_SUCCESSOR_9422 9423
+#define RIOT_PP_SUCCESSOR_9423 9424
+#define RIOT_PP_SUCCESSOR_9424 9425
+#define RIOT_PP_SUCCESSOR_9425 9426
+#define RIOT_PP_SUCCESSOR_9426 9427
+#define RIOT_PP_SUCCESSOR_9427 9428
+#define RIOT_PP_SUCCESSOR_9428 9429
+#define RIOT_PP_SUCCESSOR_9429 9430
+#define RIOT_PP_SUCCESSOR_9430 9431
+#define RIOT_PP_SUCCESSOR_9431 9432
+#define RIOT_PP_SUCCESSOR_9432 9433
+#define RIOT_PP_SUCCESSOR_9433 9434
+#define RIOT_PP_SUCCESSOR_9434 9435
+#define RIOT_PP_SUCCESSOR_9435 9436
+#define RIOT_PP_SUCCESSOR_9436 9437
+#define RIOT_PP_SUCCESSOR_9437 9438
+#define RIOT_PP_SUCCESSOR_9438 9439
+#define RIOT_PP_SUCCESSOR_9439 9440
+#define RIOT_PP_SUCCESSOR_9440 9441
+#define RIOT_PP_SUCCESSOR_9441 9442
+#define RIOT_PP_SUCCESSOR_9442 9443
+#define RIOT_PP_SUCCESSOR_9443 9444
+#define RIOT_PP_SUCCESSOR_9444 9445
+#define RIOT_PP_SUCCESSOR_9445 9446
+#define RIOT_PP_SUCCESSOR_9446 9447
+#define RIOT_PP_SUCCESSOR_9447 9448
+#define RIOT_PP_SUCCESSOR_9448 9449
+#define RIOT_PP_SUCCESSOR_9449 9450
+#define RIOT_PP_SUCCESSOR_9450 9451
+#define RIOT_PP_SUCCESSOR_9451 9452
+#define RIOT_PP_SUCCESSOR_9452 9453
+#define RIOT_PP_SUCCESSOR_9453 9454
+#define RIOT_PP_SUCCESSOR_9454 9455
+#define RIOT_PP_SUCCESSOR_9455 9456
+#define RIOT_PP_SUCCESSOR_9456 9457
+#define RIOT_PP_SUCCESSOR_9457 9458
+#define RIOT_PP_SUCCESSOR_9458 9459
+#define RIOT_PP_SUCCESSOR_9459 9460
+#define RIOT_PP_SUCCESSOR_9460 9461
+#define RIOT_PP_SUCCESSOR_9461 9462
+#define RIOT_PP_SUCCESSOR_9462 9463
+#define RIOT_PP_SUCCESSOR_9463 9464
+#define RIOT_PP_SUCCESSOR_9464 9465
+#define RIOT_PP_SUCCESSOR_9465 9466
+#define RIOT_PP_SUCCESSOR_9466 9467
+#define RIOT_PP_SUCCESSOR_9467 9468
+#define RIOT_PP_SUCCESSOR_9468 9469
+#define RIOT_PP_SUCCESSOR_9469 9470
+#define RIOT_PP_SUCCESSOR_9470 9471
+#define RIOT_PP_SUCCESSOR_9471 9472
+#define RIOT_PP_SUCCESSOR_9472 9473
+#define RIOT_PP_SUCCESSOR_9473 9474
+#define RIOT_PP_SUCCESSOR_9474 9475
+#define RIOT_PP_SUCCESSOR_9475 9476
+#define RIOT_PP_SUCCESSOR_9476 9477
+#define RIOT_PP_SUCCESSOR_9477 9478
+#define RIOT_PP_SUCCESSOR_9478 9479
+#define RIOT_PP_SUCCESSOR_9479 9480
+#define RIOT_PP_SUCCESSOR_9480 9481
+#define RIOT_PP_SUCCESSOR_9481 9482
+#define RIOT_PP_SUCCESSOR_9482 9483
+#define RIOT_PP_SUCCESSOR_9483 9484
+#define RIOT_PP_SUCCESSOR_9484 9485
+#define RIOT_PP_SUCCESSOR_9485 9486
+#define RIOT_PP_SUCCESSOR_9486 9487
+#define RIOT_PP_SUCCESSOR_9487 9488
+#define RIOT_PP_SUCCESSOR_9488 9489
+#define RIOT_PP_SUCCESSOR_9489 9490
+#define RIOT_PP_SUCCESSOR_9490 9491
+#define RIOT_PP_SUCCESSOR_9491 9492
+#define RIOT_PP_SUCCESSOR_9492 9493
+#define RIOT_PP_SUCCESSOR_9493 9494
+#define RIOT_PP_SUCCESSOR_9494 9495
+#define RIOT_PP_SUCCESSOR_9495 9496
+#define RIOT_PP_SUCCESSOR_9496 9497
+#define RIOT_PP_SUCCESSOR_9497 9498
+#define RIOT_PP_SUCCESSOR_9498 9499
+#define RIOT_PP_SUCCESSOR_9499 9500
+#define RIOT_PP_SUCCESSOR_9500 9501
+#define RIOT_PP_SUCCESSOR_9501 9502
+#define RIOT_PP_SUCCESSOR_9502 9503
+#define RIOT_PP_SUCCESSOR_9503 9504
+#define RIOT_PP_SUCCESSOR_9504 9505
+#define RIOT_PP_SUCCESSOR_9505 9506
+#define RIOT_PP_SUCCESSOR_9506 9507
+#define RIOT_PP_SUCCESSOR_9507 9508
+#define RIOT_PP_SUCCESSOR_9508 9509
+#define RIOT_PP_SUCCESSOR_9509 9510
+#define RIOT_PP_SUCCESSOR_9510 9511
+#define RIOT_PP_SUCCESSOR_9511 9512
+#define RIOT_PP_SUCCESSOR_9512 9513
+#define RIOT_PP_SUCCESSOR_9513 9514
+#define RIOT_PP_SUCCESSOR_9514 9515
+#define RIOT_PP_SUCCESSOR_9515 9516
+#define RIOT_PP_SUCCESSOR_9516 9517
+#define RIOT_PP_SUCCESSOR_9517 9518
+#define RIOT_PP_SUCCESSOR_9518 9519
+#define RIOT_PP_SUCCESSOR_9519 9520
+#define RIOT_PP_SUCCESSOR_9520 9521
+#define RIOT_PP_SUCCESSOR_9521 9522
+#define RIOT_PP_SUCCESSOR_9522 9523
+#define RIOT_PP_SUCCESSOR_9523 9524
+#define RIOT_PP_SUCCESSOR_9524 9525
+#define RIOT_PP_SUCCESSOR_9525 9526
+#define RIOT_PP_SUCCESSOR_9526 9527
+#define RIOT_PP_SUCCESSOR_9527 9528
+#define RIOT_PP_SUCCESSOR_9528 9529
+#define RIOT_PP_SUCCESSOR_9529 9530
+#define RIOT_PP_SUCCESSOR_9530 9531
+#define RIOT_PP_SUCCESSOR_9531 9532
+#define RIOT_PP_SUCCESSOR_9532 9533
+#define RIOT_PP_SUCCESSOR_9533 9534
+#define RIOT_PP_SUCCESSOR_9534 9535
+#define RIOT_PP_SUCCESSOR_9535 9536
+#define RIOT_PP_SUCCESSOR_9536 9537
+#define RIOT_PP_SUCCESSOR_9537 9538
+#define RIOT_PP_SUCCESSOR_9538 9539
+#define RIOT_PP_SUCCESSOR_9539 9540
+#define RIOT_PP_SUCCESSOR_9540 9541
+#define RIOT_PP_SUCCESSOR_9541 9542
+#define RIOT_PP_SUCCESSOR_9542 9543
+#define RIOT_PP_SUCCESSOR_9543 9544
+#define RIOT_PP_SUCCESSOR_9544 9545
+#define RIOT_PP_SUCCESSOR_9545 9546
+#define RIOT_PP_SUCCESSOR_9546 9547
+#define RIOT_PP_SUCCESSOR_9547 9548
+#define RIOT_PP_SUCCESSOR_9548 9549
+#define RIOT_PP_SUCCESSOR_9549 9550
+#define RIOT_PP_SUCCESSOR_9550 9551
+#define RIOT_PP_SUCCESSOR_9551 9552
+#define RIOT_PP_SUCCESSOR_9552 9553
+#define RIOT_PP_SUCCESSOR_9553 9554
+#define RIOT_PP_SUCCESSOR_9554 9555
+#define RIOT_PP_SUCCESSOR_9555 9556
+#define RIOT_PP_SUCCESSOR_9556 9557
+#define RIOT_PP_SUCCESSOR_9557 9558
+#define RIOT_PP_SUCCESSOR_9558 9559
+#define RIOT_PP_SUCCESSOR_9559 9560
+#define RIOT_PP_SUCCESSOR_9560 9561
+#define RIOT_PP_SUCCESSOR_9561 9562
+#define RIOT_PP_SUCCESSOR_9562 9563
+#define RIOT_PP_SUCCESSOR_9563 9564
+#define RIOT_PP_SUCCESSOR_9564 9565
+#define RIOT_PP_SUCCESSOR_9565 9566
+#define RIOT_PP_SUCCESSOR_9566 9567
+#define RIOT_PP_SUCCESSOR_9567 9568
+#define RIOT_PP_SUCCESSOR_9568 9569
+#define RIOT_PP_SUCCESSOR_9569 9570
+#define RIOT_PP_SUCCESSOR_9570 9571
+#define RIOT_PP_SUCCESSOR_9571 9572
+#define RIOT_PP_SUCCESSOR_9572 9573
+#define RIOT_PP_SUCCESSOR_9573 9574
+#define RIOT_PP_SUCCESSOR_9574 9575
+#define RIOT_PP_SUCCESSOR_9575 9576
+#define RIOT_PP_SUCCESSOR_9576 9577
+#define RIOT_PP_SUCCESSOR_9577 9578
+#define RIOT_PP_SUCCESSOR_9578 9579
+#define RIOT_PP_SUCCESSOR_9579 9580
+#define RIOT_PP_SUCCESSOR_9580 9581
+#define RIOT_PP_SUCCESSOR_9581 9582
+#define RIOT_PP_SUCCESSOR_9582 9583
+#define RIOT_PP_SUCCESSOR_9583 9584
+#define RIOT_PP_SUCCESSOR_9584 9585
+#define RIOT_PP_SUCCESSOR_9585 9586
+#define RIOT_PP_SUCCESSOR_9586 9587
+#define RIOT_PP_SUCCESSOR_9587 9588
+#define RIOT_PP_SUCCESSOR_9588 9589
+#define RIOT_PP_SUCCESSOR_9589 9590
+#define RIOT_PP_SUCCESSOR_9590 9591
+#define RIOT_PP_SUCCESSOR_9591 9592
+#define RIOT_PP_SUCCESSOR_9592 9593
+#define RIOT_PP_SUCCESSOR_9593 9594
+#define RIOT_PP_SUCCESSOR_9594 9595
+#define RIOT_PP_SUCCESSOR_9595 9596
+#define RIOT_PP_SUCCESSOR_9596 9597
+#define RIOT_PP_SUCCESSOR_9597 9598
+#define RIOT_PP_SUCCESSOR_9598 9599
+#define RIOT_PP_SUCCESSOR_9599 9600
+#define RIOT_PP_SUCCESSOR_9600 9601
+#define RIOT_PP_SUCCESSOR_9601 9602
+#define RIOT_PP_SUCCESSOR_9602 9603
+#define RIOT_PP_SUCCESSOR_9603 9604
+#define RIOT_PP_SUCCESSOR_9604 9605
+#define RIOT_PP_SUCCESSOR_9605 9606
+#define RIOT_PP_SUCCESSOR_9606 9607
+#define RIOT_PP_SUCCESSOR_9607 9608
+#define RIOT_PP_SUCCESSOR_9608 9609
+#define RIOT_PP_SUCCESSOR_9609 9610
+#define RIOT_PP_SUCCESSOR_9610 9611
+#define RIOT_PP_SUCCESSOR_9611 9612
+#define RIOT_PP_SUCCESSOR_9612 9613
+#define RIOT_PP_SUCCESSOR_9613 9614
+#define RIOT_PP_SUCCESSOR_9614 9615
+#define RIOT_PP_SUCCESSOR_9615 9616
+#define RIOT_PP_SUCCESSOR_9616 9617
+#define RIOT_PP_SUCCESSOR_9617 9618
+#define RIOT_PP_SUCCESSOR_9618 9619
+#define RIOT_PP_SUCCESSOR_9619 9620
+#define RIOT_PP_SUCCESSOR_9620 9621
+#define RIOT_PP_SUCCESSOR_9621 9622
+#define RIOT_PP_SUCCESSOR_9622 9623
+#define RIOT_PP_SUCCESSOR_9623 9624
+#define RIOT_PP_SUCCESSOR_9624 9625
+#define RIOT_PP_SUCCESSOR_9625 9626
+#define RIOT_PP_SUCCESSOR_9626 9627
+#define RIOT_PP_SUCCESSOR_9627 9628
+#define RIOT_PP_SUCCESSOR_9628 9629
+#define RIOT_PP_SUCCESSOR_9629 9630
+#define RIOT_PP_SUCCESSOR_9630 9631
+#define RIOT_PP_SUCCESSOR_9631 9632
+#define RIOT_PP_SUCCESSOR_9632 9633
+#define RIOT_PP_SUCCESSOR_9633 9634
+#define RIOT_PP_SUCCESSOR_9634 9635
+#define RIOT_PP_SUCCESSOR_9635 9636
+#define RIOT_PP_SUCCESSOR_9636 9637
+#define RIOT_PP_SUCCESSOR_9637 9638
+#define RIOT_PP_SUCCESSOR_9638 9639
+#define RIOT_PP_SUCCESSOR_9639 9640
+#define RIOT_PP_SUCCESSOR_9640 9641
+#define RIOT_PP_SUCCESSOR_9641 9642
+#define RIOT_PP_SUCCESSOR_9642 9643
+#define RIOT_PP_SUCCESSOR_9643 9644
+#define RIOT_PP_SUCCESSOR_9644 9645
+#define RIOT_PP_SUCCESSOR_9645 9646
+#define RIOT_PP_SUCCESSOR_9646 9647
+#define RIOT_PP_SUCCESSOR_9647 9648
+#define RIOT_PP_SUCCESSOR_9648 9649
+#define RIOT_PP_SUCCESSOR_9649 9650
+#define RIOT_PP_SUCCESSOR_9650 9651
+#define RIOT_PP_SUCCESSOR_9651 9652
+#define RIOT_PP_SUCCESSOR_9652 9653
+#define RIOT_PP_SUCCESSOR_9653 9654
+#define RIOT_PP_SUCCESSOR_9654 9655
+#define RIOT_PP_SUCCESSOR_9655 9656
+#define RIOT_PP_SUCCESSOR_9656 9657
+#define RIOT_PP_SUCCESSOR_9657 9658
+#define RIOT_PP_SUCCESSOR_9658 9659
+#define RIOT_PP_SUCCESSOR_9659 9660
+#define RIOT_PP_SUCCESSOR_9660 9661
+#define RIOT_PP_SUCCESSOR_9661 9662
+#define RIOT_PP_SUCCESSOR_9662 9663
+#define RIOT_PP_SUCCESSOR_9663 9664
+#define RIOT_PP_SUCCESSOR_9664 9665
+#define RIOT_PP_SUCCESSOR_9665 9666
+#define RIOT_PP_SUCCESSOR_9666 9667
+#define RIOT_PP_SUCCESSOR_9667 9668
+#define RIOT_PP_SUCCESSOR_9668 9669
+#define RIOT_PP_SUCCESSOR_9669 9670
+#define RIOT_PP_SUCCESSOR_9670 9671
+#define RIOT_PP_SUCCESSOR_9671 9672
+#define RIOT_PP_SUCCESSOR_9672 9673
+#define RIOT_PP_SUCCESSOR_9673 9674
+#define RIOT_PP_SUCCESSOR_9674 9675
+#define RIOT_PP_SUCCESSOR_9675 9676
+#define RIOT_PP_SUCCESSOR_9676 9677
+#define RIOT_PP_SUCCESSOR_9677 9678
+#define RIOT_PP_SUCCESSOR_9678 9679
+#define RIOT_PP_SUCCESSOR_9679 9680
+#define RIOT_PP_SUCCESSOR_9680 9681
+#define RIOT_PP_SUCCESSOR_9681 9682
+#define RIOT_PP_SUCCESSOR_9682 9683
+#define RIOT_PP_SUCCESSOR_9683 9684
+#define RIOT_PP_SUCCESSOR_9684 9685
+#define RIOT_PP_SUCCESSOR_9685 9686
+#define RIOT_PP_SUCCESSOR_9686 9687
+#define RIOT_PP_SUCCESSOR_9687 9688
+#define RIOT_PP_SUCCESSOR_9688 9689
+#define RIOT_PP_SUCCESSOR_9689 9690
+#define RIOT_PP_SUCCESSOR_9690 9691
+#define RIOT_PP_SUCCESSOR_9691 9692
+#define RIOT_PP_SUCCESSOR_9692 9693
+#define RIOT_PP_SUCCESSOR_9693 9694
+#define RIOT_PP_SUCCESSOR_9694 9695
+#define RIOT_PP_SUCCESSOR_9695 9696
+#define RIOT_PP_SUCCESSOR_9696 9697
+#define RIOT_PP_SUCCESSOR_9697 9698
+#define RIOT_PP_SUCCESSOR_9698 9699
+#define RIOT_PP_SUCCESSOR_9699 9700
+#define RIOT_PP_SUCCESSOR_9700 9701
+#define RIOT_PP_SUCCESSOR_9701 9702
+#define RIOT_PP_SUCCESSOR_9702 9703
+#define RIOT_PP_SUCCESSOR_9703 9704
+#define RIOT_PP_SUCCESSOR_9704 9705
+#define RIOT_PP_SUCCESSOR_9705 9706
+#define RIOT_PP_SUCCESSOR_9706 9707
+#define RIOT_PP_SUCCESSOR_9707 9708
+#define RIOT_PP_SUCCESSOR_9708 9709
+#define RIOT_PP_SUCCESSOR_9709 9710
+#define RIOT_PP_SUCCESSOR_9710 9711
+#define RIOT_PP_SUCCESSOR_9711 9712
+#define RIOT_PP_SUCCESSOR_9712 9713
+#define RIOT_PP_SUCCESSOR_9713 9714
+#define RIOT_PP_SUCCESSOR_9714 9715
+#define RIOT_PP_SUCCESSOR_9715 9716
+#define RIOT_PP_SUCCESSOR_9716 9717
+#define RIOT_PP_SUCCESSOR_9717 9718
+#define RIOT_PP_SUCCESSOR_9718 9719
+#define RIOT_PP_SUCCESSOR_9719 9720
+#define RIOT_PP_SUCCESSOR_9720 9721
+#define RIOT_PP_SUCCESSOR_9721 9722
+#define RIOT_PP_SUCCESSOR_9722 9723
+#define RIOT_PP_SUCCESSOR_9723 9724
+#define RIOT_PP_SUCCESSOR_9724 9725
+#define RIOT_PP_SUCCESSOR_9725 9726
+#define RIOT_PP_SUCCESSOR_9726 9727
+#define RIOT_PP_SUCCESSOR_9727 9728
+#define RIOT_PP_SUCCESSOR_9728 9729
+#define RIOT_PP_SUCCESSOR_9729 9730
+#define RIOT_PP_SUCCESSOR_9730 9731
+#define RIOT_PP_SUCCESSOR_9731 9732
+#define RIOT_PP_SUCCESSOR_9732 9733
+#define RIOT_PP_SUCCESSOR_9733 9734
+#define RIOT_PP_SUCCESSOR_9734 9735
+#define RIOT_PP_SUCCESSOR_9735 9736
+#define RIOT_PP_SUCCESSOR_9736 9737
+#define RIOT_PP_SUCCESSOR_9737 9738
+#define RIOT_PP_SUCCESSOR_9738 9739
+#define RIOT_PP_SUCCESSOR_9739 9740
+#define RIOT_PP_SUCCESSOR_9740 9741
+#define RIOT_PP_SUCCESSOR_9741 9742
+#define RIOT_PP_SUCCESSOR_9742 9743
+#define RIOT_PP_SUCCESSOR_9743 9744
+#define RIOT_PP_SUCCESSOR_9744 9745
+#define RIOT_PP_SUCCESSOR_9745 9746
+#define RIOT_PP_SUCCESSOR_9746 9747
+#define RIOT_PP_SUCCESSOR_9747 9748
+#define RIOT_PP_SUCCESSOR_9748 9749
+#define RIOT_PP_SUCCESSOR_9749 9750
+#define RIOT_PP_SUCCESSOR_9750 9751
+#define RIOT_PP_SUCCESSOR_9751 9752
+#define RIOT_PP_SUCCESSOR_9752 9753
+#define RIOT_PP_SUCCESSOR_9753 9754
+#define RIOT_PP_SUCCESSOR_9754 9755
+#define RIOT_PP_SUCCESSOR_9755 9756
+#define RIOT_PP_SUCCESSOR_9756 9757
+#define RIOT_PP_SUCCESSOR_9757 9758
+#define RIOT_PP_SUCCESSOR_9758 9759
+#define RIOT_PP_SUCCESSOR_9759 9760
+#define RIOT_PP_SUCCESSOR_9760 9761
+#define RIOT_PP_SUCCESSOR_9761 9762
+#define RIOT_PP_SUCCESSOR_9762 9763
+#define RIOT_PP_SUCCESSOR_9763 9764
+#define RIOT_PP_SUCCESSOR_9764 9765
+#define RIOT_PP_SUCCESSOR_9765 9766
+#define RIOT_PP_SUCCESSOR_9766 9767
+#define RIOT_PP_SUCCESSOR_9767 9768
+#define RIOT_PP_SUCCESSOR_9768 9769
+#define RIOT_PP_SUCCESSOR_9769 9770
+#define RIOT_PP_SUCCESSOR_9770 9771
+#define RIOT_PP_SUCCESSOR_9771 9772
+#define RIOT_PP_SUCCESSOR_9772 9773
+#define RIOT_PP_SUCCESSOR_9773 9774
+#define RIOT_PP_SUCCESSOR_9774 9775
+#define RIOT_PP_SUCCESSOR_9775 9776
+#define RIOT_PP_SUCCESSOR_9776 9777
+#define RIOT_PP_SUCCESSOR_9777 9778
+#define RIOT_PP_SUCCESSOR_9778 9779
+#define RIOT_PP_SUCCESSOR_9779 9780
+#define RIOT_PP_SUCCESSOR_9780 9781
+#define RIOT_PP_SUCCESSOR_9781 9782
+#define RIOT_PP_SUCCESSOR_9782 9783
+#define RIOT_PP_SUCCESSOR_9783 9784
+#define RIOT_PP_SUCCESSOR_9784 9785
+#define RIOT_PP_SUCCESSOR_9785 9786
+#define RIOT_PP_SUCCESSOR_9786 9787
+#define RIOT_PP_SUCCESSOR_9787 9788
+#define RIOT_PP_SUCCESSOR_9788 9789
+#define RIOT_PP_SUCCESSOR_9789 9790
+#define RIOT_PP_SUCCESSOR_9790 9791
+#define RIOT_PP_SUCCESSOR_9791 9792
+#define RIOT_PP_SUCCESSOR_9792 9793
+#define RIOT_PP_SUCCESSOR_9793 9794
+#define RIOT_PP_SUCCESSOR_9794 9795
+#define RIOT_PP_SUCCESSOR_9795 9796
+#define RIOT_PP_SUCCESSOR_9796 9797
+#define RIOT_PP_SUCCESSOR_9797 9798
+#define RIOT_PP_SUCCESSOR_9798 9799
+#define RIOT_PP_SUCCESSOR_9799 9800
+#define RIOT_PP_SUCCESSOR_9800 9801
+#define RIOT_PP_SUCCESSOR_9801 9802
+#define RIOT_PP_SUCCESSOR_9802 9803
+#define RIOT_PP_SUCCESSOR_9803 9804
+#define RIOT_PP_SUCCESSOR_9804 9805
+#define RIOT_PP_SUCCESSOR_9805 9806
+#define RIOT_PP_SUCCESSOR_9806 9807
+#define RIOT_PP_SUCCESSOR_9807 9808
+#define RIOT_PP_SUCCESSOR_9808 9809
+#define RIOT_PP_SUCCESSOR_9809 9810
+#define RIOT_PP_SUCCESSOR_9810 9811
+#define RIOT_PP_SUCCESSOR_9811 9812
+#define RIOT_PP_SUCCESSOR_9812 9813
+#define RIOT_PP_SUCCESSOR_9813 9814
+#define RIOT_PP_SUCCESSOR_9814 9815
+#define RIOT_PP_SUCCESSOR_9815 9816
+#define RIOT_PP_SUCCESSOR_9816 9817
+#define RIOT_PP_SUCCESSOR_9817 9818
+#define RIOT_PP_SUCCESSOR_9818 9819
+#define RIOT_PP_SUCCESSOR_9819 9820
+#define RIOT_PP_SUCCESSOR_9820 9821
+#define RIOT_PP_SUCCESSOR_9821 9822
+#define RIOT_PP_SUCCESSOR_9822 9823
+#define RIOT_PP_SUCCESSOR_9823 9824
+#define RIOT_PP_SUCCESSOR_9824 9825
+#define RIOT_PP_SUCCESSOR_9825 9826
+#define RIOT_PP_SUCCESSOR_9826 9827
+#define RIOT_PP_SUCCESSOR_9827 9828
+#define RIOT_PP_SUCCESSOR_9828 9829
+#define RIOT_PP_SUCCESSOR_9829 9830
+#define RIOT_PP_SUCCESSOR_9830 9831
+#define RIOT_PP_SUCCESSOR_9831 9832
+#define RIOT_PP_SUCCESSOR_9832 9833
+#define RIOT_PP_SUCCESSOR_9833 9834
+#define RIOT_PP_SUCCESSOR_9834 9835
+#define RIOT_PP_SUCCESSOR_9835 9836
+#define RIOT_PP_SUCCESSOR_9836 9837
+#define RIOT_PP_SUCCESSOR_9837 9838
+#define RIOT_PP_SUCCESSOR_9838 9839
+#define RIOT_PP_SUCCESSOR_9839 9840
+#define RIOT_PP_SUCCESSOR_9840 9841
+#define RIOT_PP_SUCCESSOR_9841 9842
+#define RIOT_PP_SUCCESSOR_9842 9843
+#define RIOT_PP_SUCCESSOR_9843 9844
+#define RIOT_PP_SUCCESSOR_9844 9845
+#define RIOT_PP_SUCCESSOR_9845 9846
+#define RIOT_PP_SUCCESSOR_9846 9847
+#define RIOT_PP_SUCCESSOR_9847 9848
+#define RIOT_PP_SUCCESSOR_9848 9849
+#define RIOT_PP_SUCCESSOR_9849 9850
+#define RIOT_PP_SUCCESSOR_9850 9851
+#define RIOT_PP_SUCCESSOR_9851 9852
+#define RIOT_PP_SUCCESSOR_9852 9853
+#define RIOT_PP_SUCCESSOR_9853 9854
+#define RIOT_PP_SUCCESSOR_9854 9855
+#define RIOT_PP_SUCCESSOR_9855 9856
+#define RIOT_PP_SUCCESSOR_9856 9857
+#define RIOT_PP_SUCCESSOR_9857 9858
+#define RIOT_PP_SUCCESSOR_9858 9859
+#define RIOT_PP_SUCCESSOR_9859 9860
+#define RIOT_PP_SUCCESSOR_9860 9861
+#define RIOT_PP_SUCCESSOR_9861 9862
+#define RIOT_PP_SUCCESSOR_9862 9863
+#define RIOT_PP_SUCCESSOR_9863 9864
+#define RIOT_PP_SUCCESSOR_9864 9865
+#define RIOT_PP_SUCCESSOR_9865 9866
+#define RIOT_PP_SUCCESSOR_9866 9867
+#define RIOT_PP_SUCCESSOR_9867 9868
+#define RIOT_PP_SUCCESSOR_9868 9869
+#define RIOT_PP_SUCCESSOR_9869 9870
+#define RIOT_PP_SUCCESSOR_9870 9871
+#define RIOT_PP_SUCCESSOR_9871 9872
+#define RIOT_PP_SUCCESSOR_9872 9873
+#define RIOT_PP_SUCCESSOR_9873 9874
+#define RIOT_PP_SUCCESSOR_9874 9875
+#define RIOT_PP_SUCCESSOR_9875 9876
+#define RIOT_PP_SUCCESSOR_9876 9877
+#define RIOT_PP_SUCCESSOR_9877 9878
+#define RIOT_PP_SUCCESSOR_9878 9879
+#define RIOT_PP_SUCCESSOR_9879 9880
+#define RIOT_PP_SUCCESSOR_9880 9881
+#define RIOT_PP_SUCCESSOR_9881 9882
+#define RIOT_PP_SUCCESSOR_9882 9883
+#define RIOT_PP_SUCCESSOR_9883 9884
+#define RIOT_PP_SUCCESSOR_9884 9885
+#define RIOT_PP_SUCCESSOR_9885 9886
+#define RIOT_PP_SUCCESSOR_9886 9887
+#define RIOT_PP_SUCCESSOR_9887 9888
+#define RIOT_PP_SUCCESSOR_9888 9889
+#define RIOT_PP_SUCCESSOR_9889 9890
+#define RIOT_PP_SUCCESSOR_9890 9891
+#define RIOT_PP_SUCCESSOR_9891 9892
+#define RIOT_PP_SUCCESSOR_9892 9893
+#define RIOT_PP_SUCCESSOR_9893 9894
+#define RIOT_PP_SUCCESSOR_9894 9895
+#define RIOT_PP_SUCCESSOR_9895 9896
+#define RIOT_PP_SUCCESSOR_9896 9897
+#define RIOT_PP_SUCCESSOR_9897 9898
+#define RIOT_PP_SUCCESSOR_9898 9899
+#define RIOT_PP_SUCCESSOR_9899 9900
+#define RIOT_PP_SUCCESSOR_9900 9901
+#define RIOT_PP_SUCCESSOR_9901 9902
+#define RIOT_PP_SUCCESSOR_9902 9903
+#define RIOT_PP_SUCCESSOR_9903 9904
+#define RIOT_PP_SUCCESSOR_9904 9905
+#define RIOT_PP_SUCCESSOR_9905 9906
+#define RIOT_PP_SUCCESSOR_9906 9907
+#define RIOT_PP_SUCCESSOR_9907 9908
+#define RIOT_PP_SUCCESSOR_9908 9909
+#define RIOT_PP_SUCCESSOR_9909 9910
+#define RIOT_PP_SUCCESSOR_9910 9911
+#define RIOT_PP_SUCCESSOR_9911 9912
+#define RIOT_PP_SUCCESSOR_9912 9913
+#define RIOT_PP_SUCCESSOR_9913 9914
+#define RIOT_PP_SUCCESSOR_9914 9915
+#define RIOT_PP_SUCCESSOR_9915 9916
+#define RIOT_PP_SUCCESSOR_9916 9917
+#define RIOT_PP_SUCCESSOR_9917 9918
+#define RIOT_PP_SUCCESSOR_9918 9919
+#define RIOT_PP_SUCCESSOR_9919 9920
+#define RIOT_PP_SUCCESSOR_9920 9921
+#define RIOT_PP_SUCCESSOR_9921 9922
+#define RIOT_PP_SUCCESSOR_9922 9923
+#define RIOT_PP_SUCCESSOR_9923 9924
+#define RIOT_PP_SUCCESSOR_9924 9925
+#define RIOT_PP_SUCCESSOR_9925 9926
+#define RIOT_PP_SUCCESSOR_9926 9927
+#define RIOT_PP_SUCCESSOR_9927 9928
+#define RIOT_PP_SUCCESSOR_9928 9929
+#define RIOT_PP_SUCCESSOR_9929 9930
+#define RIOT_PP_SUCCESSOR_9930 9931
+#define RIOT_PP_SUCCESSOR_9931 9932
+#define RIOT_PP_SUCCESSOR_9932 9933
+#define RIOT_PP_SUCCESSOR_9933 9934
+#define RIOT_PP_SUCCESSOR_9934 9935
+#define RIOT_PP_SUCCESSOR_9935 9936
+#define RIOT_PP_SUCCESSOR_9936 9937
+#define RIOT_PP_SUCCESSOR_9937 9938
+#define RIOT_PP_SUCCESSOR_9938 9939
+#define RIOT_PP_SUCCESSOR_9939 9940
+#define RIOT_PP_SUCCESSOR_9940 9941
+#define RIOT_PP_SUCCESSOR_9941 9942
+#define RIOT_PP_SUCCESSOR_9942 9943
+#define RIOT_PP_SUCCESSOR_9943 9944
+#define RIOT_PP_SUCCESSOR_9944 9945
+#define RIOT_PP_SUCCESSOR_9945 9946
+#define RIOT_PP_SUCCESSOR_9946 9947
+#define RIOT_PP_SUCCESSOR_9947 9948
+#define RIOT_PP_SUCCESSOR_9948 9949
+#define RIOT_PP_SUCCESSOR_9949 9950
+#define RIOT_PP_SUCCESSOR_9950 9951
+#define RIOT_PP_SUCCESSOR_9951 9952
+#define RIOT_PP_SUCCESSOR_9952 9953
+#define RIOT_PP_SUCCESSOR_9953 9954
+#define RIOT_PP_SUCCESSOR_9954 9955
+#define RIOT_PP_SUCCESSOR_9955 9956
+#define RIOT_PP_SUCCESSOR_9956 9957
+#define RIOT_PP_SUCCESSOR_9957 9958
+#define RIOT_PP_SUCCESSOR_9958 9959
+#define RIOT_PP_SUCCESSOR_9959 9960
+#define RIOT_PP_SUCCESSOR_9960 9961
+#define RIOT_PP_SUCCESSOR_9961 9962
+#define RIOT_PP_SUCCESSOR_9962 9963
+#define RIOT_PP_SUCCESSOR_9963 9964
+#define RIOT_PP_SUCCESSOR_9964 9965
+#define RIOT_PP_SUCCESSOR_9965 9966
+#define RIOT_PP_SUCCESSOR_9966 9967
+#define RIOT_PP_SUCCESSOR_9967 9968
+#define RIOT_PP_SUCCESSOR_9968 9969
+#define RIOT_PP_SUCCESSOR_9969 9970
+#define RIOT_PP_SUCCESSOR_9970 9971
+#define RIOT_PP_SUCCESSOR_9971 9972
+#define RIOT_PP_SUCCESSOR_9972 9973
+#define RIOT_PP_SUCCESSOR_9973 9974
+#define RIOT_PP_SUCCESSOR_9974 9975
+#define RIOT_PP_SUCCESSOR_9975 9976
+#define RIOT_PP_SUCCESSOR_9976 9977
+#define RIOT_PP_SUCCESSOR_9977 9978
+#define RIOT_PP_SUCCESSOR_9978 9979
+#define RIOT_PP_SUCCESSOR_9979 9980
+#define RIOT_PP_SUCCESSOR_9980 9981
+#define RIOT_PP_SUCCESSOR_9981 9982
+#define RIOT_PP_SUCCESSOR_9982 9983
+#define RIOT_PP_SUCCESSOR_9983 9984
+#define RIOT_PP_SUCCESSOR_9984 9985
+#define RIOT_PP_SUCCESSOR_9985 9986
+#define RIOT_PP_SUCCESSOR_9986 9987
+#define RIOT_PP_SUCCESSOR_9987 9988
+#define RIOT_PP_SUCCESSOR_9988 9989
+#define RIOT_PP_SUCCESSOR_9989 9990
+#define RIOT_PP_SUCCESSOR_9990 9991
+#define RIOT_PP_SUCCESSOR_9991 9992
+#define RIOT_PP_SUCCESSOR_9992 9993
+#define RIOT_PP_SUCCESSOR_9993 9994
+#define RIOT_PP_SUCCESSOR_9994 9995
+#define RIOT_PP_SUCCESSOR_9995 9996
+#define RIOT_PP_SUCCESSOR_9996 9997
+#define RIOT_PP_SUCCESSOR_9997 9998
+#define RIOT_PP_SUCCESSOR_9998 9999
+#define RIOT_PP_SUCCESSOR_9999 10000
+
+#define RIOT_PP_SUCCESSOR(n) RIOT_PP_SUCCESSOR_ ## n
+
+#ifdef __cplusplus
+}
+#endif
+#endif
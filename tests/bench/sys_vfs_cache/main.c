@@ -0,0 +1,153 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for small reads through the VFS
+ *
+ * Streams a file from the default file system in small chunks, once
+ * sequentially, once re-opening the file for every block like the nanocoap
+ * fileserver does and once line by line. Build with VFS_CACHE=0 to compare
+ * against uncached reads.
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "test_utils/expect.h"
+#include "timex.h"
+#include "vfs.h"
+#include "vfs_default.h"
+#include "ztimer.h"
+
+#if IS_USED(MODULE_VFS_CACHE)
+#include "vfs_cache.h"
+#endif
+
+#define FILE_NAME           VFS_DEFAULT_DATA "/bench.txt"
+
+/* size of the streamed file */
+#ifndef FILE_SIZE
+#define FILE_SIZE           (16 * 1024U)
+#endif
+
+/* size of a single read, e.g. a CoAP block */
+#ifndef BLOCK_SIZE
+#define BLOCK_SIZE          (64U)
+#endif
+
+#define LINE_LEN            (32U)
+
+static char _buf[BLOCK_SIZE];
+
+static void _create(void)
+{
+    char line[LINE_LEN + 1];
+
+    int fd = vfs_open(FILE_NAME, O_CREAT | O_TRUNC | O_WRONLY, 0644);
+    expect(fd >= 0);
+    for (unsigned i = 0; i < FILE_SIZE / LINE_LEN; i++) {
+        snprintf(line, sizeof(line), "%-*u\n", LINE_LEN - 1, i);
+        expect(vfs_write(fd, line, LINE_LEN) == LINE_LEN);
+    }
+    vfs_close(fd);
+}
+
+static size_t _stream(void)
+{
+    size_t total = 0;
+    ssize_t res;
+
+    int fd = vfs_open(FILE_NAME, O_RDONLY, 0);
+    expect(fd >= 0);
+    while ((res = vfs_read(fd, _buf, sizeof(_buf))) > 0) {
+        total += res;
+    }
+    vfs_close(fd);
+    return total;
+}
+
+static size_t _blockwise(void)
+{
+    size_t total = 0;
+
+    for (unsigned block = 0; ; block++) {
+        int fd = vfs_open(FILE_NAME, O_RDONLY, 0);
+        expect(fd >= 0);
+        vfs_lseek(fd, block * sizeof(_buf), SEEK_SET);
+        ssize_t res = vfs_read(fd, _buf, sizeof(_buf));
+        vfs_close(fd);
+        if (res <= 0) {
+            break;
+        }
+        total += res;
+    }
+    return total;
+}
+
+static size_t _readline(void)
+{
+    char line[LINE_LEN + 1];
+    size_t total = 0;
+    ssize_t res;
+
+    int fd = vfs_open(FILE_NAME, O_RDONLY, 0);
+    expect(fd >= 0);
+    while ((res = vfs_readline(fd, line, sizeof(line))) > 1) {
+        total += res;
+    }
+    vfs_close(fd);
+    return total;
+}
+
+static void _bench(const char *name, size_t (*fn)(void))
+{
+#if IS_USED(MODULE_VFS_CACHE)
+    vfs_cache_stats_t before, after;
+    vfs_cache_drop();
+    vfs_cache_stats(&before);
+#endif
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    size_t total = fn();
+    uint32_t time = ztimer_now(ZTIMER_USEC) - start;
+
+    expect(total == FILE_SIZE);
+    printf("%-8s %8lu us, %6lu KiB/s", name, (unsigned long)time,
+           (unsigned long)((uint64_t)total * US_PER_SEC / 1024 / time));
+#if IS_USED(MODULE_VFS_CACHE)
+    vfs_cache_stats(&after);
+    printf(", %lu hits, %lu misses, %lu read ahead",
+           (unsigned long)(after.hits - before.hits),
+           (unsigned long)(after.misses - before.misses),
+           (unsigned long)(after.readahead - before.readahead));
+#endif
+    puts("");
+}
+
+int main(void)
+{
+    _create();
+
+    _bench("stream", _stream);
+    _bench("block", _blockwise);
+    _bench("readline", _readline);
+
+    vfs_unlink(FILE_NAME);
+    puts("DONE");
+    return 0;
+}
@@ -0,0 +1,179 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for VFS path lookups and fd allocation
+ *
+ * Several worker threads concurrently open, close and stat files on a
+ * number of mount points, yielding after every operation so that the
+ * lookups interleave. The fd table part opens as many files as possible
+ * at once to stress the fd allocator.
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <sys/stat.h>
+
+#include "fs/constfs.h"
+#include "kernel_defines.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "timex.h"
+#include "vfs.h"
+#include "ztimer.h"
+
+#ifndef NUM_THREADS
+#define NUM_THREADS         (4U)
+#endif
+
+/* operations per thread and run */
+#ifndef OPS
+#define OPS                 (10000U)
+#endif
+
+static const uint8_t _data[] = "VFS lookup benchmark";
+
+static const constfs_file_t _files[] = {
+    {
+        .path = "/file",
+        .data = _data,
+        .size = sizeof(_data),
+    },
+};
+
+static const constfs_t _fs_data = {
+    .files = _files,
+    .nfiles = ARRAY_SIZE(_files),
+};
+
+#define MOUNT(_name) { \
+    .mount_point = _name, \
+    .fs = &constfs_file_system, \
+    .private_data = (void *)&_fs_data, \
+}
+
+static vfs_mount_t _mounts[] = {
+    MOUNT("/const"),
+    MOUNT("/const/a"),
+    MOUNT("/const/a/b"),
+    MOUNT("/data"),
+    MOUNT("/nvm0"),
+    MOUNT("/nvm1"),
+    MOUNT("/sd0"),
+    MOUNT("/sd1"),
+};
+
+static const char *_paths[] = {
+    "/const/file",
+    "/const/a/file",
+    "/const/a/b/file",
+    "/data/file",
+    "/nvm0/file",
+    "/nvm1/file",
+    "/sd0/file",
+    "/sd1/file",
+};
+
+static char _stacks[NUM_THREADS][THREAD_STACKSIZE_DEFAULT];
+static thread_t *_main;
+static bool _stat;
+
+static void _run_ops(unsigned offset)
+{
+    for (unsigned i = 0; i < OPS; i++) {
+        const char *path = _paths[(i + offset) % ARRAY_SIZE(_paths)];
+        if (_stat) {
+            struct stat buf;
+            expect(vfs_stat(path, &buf) == 0);
+        }
+        else {
+            int fd = vfs_open(path, O_RDONLY, 0);
+            expect(fd >= 0);
+            vfs_close(fd);
+        }
+        thread_yield();
+    }
+}
+
+static void *_worker(void *arg)
+{
+    _run_ops((uintptr_t)arg);
+    thread_flags_set(_main, 1U << (uintptr_t)arg);
+    return NULL;
+}
+
+static void _bench(const char *name, unsigned threads)
+{
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    for (unsigned i = 0; i < threads; i++) {
+        thread_create(_stacks[i], sizeof(_stacks[i]), THREAD_PRIORITY_MAIN - 1,
+                      THREAD_CREATE_WOUT_YIELD | THREAD_CREATE_STACKTEST,
+                      _worker, (void *)(uintptr_t)i, "worker");
+    }
+    thread_flags_wait_all((1U << threads) - 1);
+
+    uint32_t time = ztimer_now(ZTIMER_USEC) - start;
+    uint64_t ops = (uint64_t)OPS * threads * US_PER_SEC / time;
+    printf("%-10s %u %-7s: %8lu ops/s\n", name, threads,
+           threads == 1 ? "thread" : "threads", (unsigned long)ops);
+}
+
+static void _bench_fds(void)
+{
+    static int fds[VFS_MAX_OPEN_FILES];
+    unsigned num = 0;
+    unsigned ops = 0;
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned round = 0; round < OPS / VFS_MAX_OPEN_FILES; round++) {
+        for (num = 0; num < ARRAY_SIZE(fds); num++) {
+            fds[num] = vfs_open(_paths[0], O_RDONLY, 0);
+            if (fds[num] < 0) {
+                break;
+            }
+        }
+        for (unsigned i = 0; i < num; i++) {
+            vfs_close(fds[i]);
+        }
+        ops += num;
+    }
+    uint32_t time = ztimer_now(ZTIMER_USEC) - start;
+
+    printf("fd table   %u fds   : %8lu ops/s\n", num,
+           (unsigned long)((uint64_t)ops * US_PER_SEC / time));
+}
+
+int main(void)
+{
+    _main = thread_get_active();
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_mounts); i++) {
+        expect(vfs_mount(&_mounts[i]) == 0);
+    }
+
+    _bench("open/close", 1);
+    _bench("open/close", NUM_THREADS);
+    _stat = true;
+    _bench("stat", 1);
+    _bench("stat", NUM_THREADS);
+    _bench_fds();
+
+    puts("DONE");
+    return 0;
+}
@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect(r"open/close\s+1 thread\s*:\s*[0-9]+ ops/s")
+    child.expect(r"open/close\s+[0-9]+ threads:\s*[0-9]+ ops/s")
+    child.expect(r"stat\s+1 thread\s*:\s*[0-9]+ ops/s")
+    child.expect(r"stat\s+[0-9]+ threads:\s*[0-9]+ ops/s")
+    child.expect(r"fd table\s+[0-9]+ fds\s*:\s*[0-9]+ ops/s")
+    child.expect_exact("DONE")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,315 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for USBUS CDC NCM
+ *
+ * The "host" side is emulated on top of the usbdev mock device, in the
+ * callbacks the mock calls from the USBUS thread. It configures the device,
+ * then @ref FRAMES Ethernet frames of @ref FRAME_LEN bytes are sent by the
+ * device ("tx") and by the host, which puts as many frames into an NTB as
+ * fit ("rx"). The main thread takes the role of the network interface thread.
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#define USB_H_USER_IS_RIOT_INTERNAL
+
+#include <stdio.h>
+#include <string.h>
+
+#include "event.h"
+#include "iolist.h"
+#include "periph/usbdev.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "timex.h"
+#include "usb/cdc.h"
+#include "usb/descriptor.h"
+#include "usb/usbus.h"
+#include "usb/usbus/cdc/ncm.h"
+#include "usbdev_mock.h"
+#include "ztimer.h"
+
+#define FLAG_CONFIGURED     (1U << 0)
+#define FLAG_ISR            (1U << 1)
+#define FLAG_TX_DONE        (1U << 2)
+
+#define ALIGN4(x)           (((x) + 3) & ~3U)
+
+extern void cdcncm_netdev_setup(usbus_cdcncm_device_t *cdcncm);
+
+static usbus_t _usbus;
+static usbus_cdcncm_device_t _cdcncm;
+static char _usbus_stack[USBUS_STACKSIZE];
+static thread_t *_main;
+
+static uint8_t _frame[FRAME_LEN];
+static uint8_t _rx_buf[ETHERNET_FRAME_LEN];
+static unsigned _rx_frames;
+
+/* "host" state, only accessed by the USBUS thread */
+static unsigned _ctrl_step;
+static uint8_t _host_in[CONFIG_USBUS_CDC_NCM_NTB_IN_SIZE];
+static size_t _host_in_len;
+static unsigned _host_in_frames;
+static uint8_t _host_out[CONFIG_USBUS_CDC_NCM_NTB_OUT_SIZE];
+static size_t _host_out_len;
+static size_t _host_out_pos;
+static unsigned _host_out_frames;
+static uint16_t _host_out_seq;
+static bool _host_out_armed;
+
+static void _host_kick(event_t *ev);
+static event_t _kick = { .handler = _host_kick };
+
+static usbdev_mock_ep_t *_mock_ep(usbus_endpoint_t *ep)
+{
+    return container_of(ep->ep, usbdev_mock_ep_t, ep);
+}
+
+static void _next_request(usbdev_mock_t *dev)
+{
+    usb_setup_t *setup = (usb_setup_t *)dev->out[0].buf;
+
+    memset(setup, 0, sizeof(*setup));
+    switch (_ctrl_step++) {
+    case 0:
+        setup->type = USB_SETUP_REQUEST_RECIPIENT_DEVICE;
+        setup->request = USB_SETUP_REQ_SET_CONFIGURATION;
+        setup->value = 1;
+        break;
+    case 1:
+        /* enable the data interface */
+        setup->type = USB_SETUP_REQUEST_RECIPIENT_INTERFACE;
+        setup->request = USB_SETUP_REQ_SET_INTERFACE;
+        setup->value = 1;
+        setup->index = _cdcncm.iface_data.idx;
+        break;
+    case 2:
+        thread_flags_set(_main, FLAG_CONFIGURED);
+        return;
+    default:
+        return;
+    }
+    dev->out[0].available = sizeof(*setup);
+    dev->out[0].state = EP_STATE_DATA_AVAILABLE;
+    dev->usbdev.epcb(&dev->out[0].ep, USBDEV_EVENT_ESR);
+}
+
+/* Puts up to _host_out_frames frames into the next OUT NTB */
+static void _host_out_build(void)
+{
+    usb_cdcncm_nth16_t *nth = (usb_cdcncm_nth16_t *)_host_out;
+    usb_cdcncm_ndp16_t *ndp = (usb_cdcncm_ndp16_t *)(nth + 1);
+    usb_cdcncm_dpe16_t *dpe = (usb_cdcncm_dpe16_t *)(ndp + 1);
+    unsigned num = 0;
+    size_t len;
+
+    do {
+        num++;
+        len = ALIGN4(sizeof(*nth) + sizeof(*ndp) + (num + 2) * sizeof(*dpe)) +
+              num * ALIGN4(FRAME_LEN);
+    } while ((num < _host_out_frames) && (len <= sizeof(_host_out)));
+    if (len > sizeof(_host_out)) {
+        num--;
+    }
+
+    len = ALIGN4(sizeof(*nth) + sizeof(*ndp) + (num + 1) * sizeof(*dpe));
+    for (unsigned i = 0; i < num; i++) {
+        dpe[i].index = len;
+        dpe[i].len = FRAME_LEN;
+        memcpy(&_host_out[len], _frame, FRAME_LEN);
+        len += ALIGN4(FRAME_LEN);
+    }
+    dpe[num].index = 0;
+    dpe[num].len = 0;
+    ndp->signature = USB_CDC_NCM_NDP16_SIGNATURE;
+    ndp->len = sizeof(*ndp) + (num + 1) * sizeof(*dpe);
+    ndp->next_index = 0;
+    nth->signature = USB_CDC_NCM_NTH16_SIGNATURE;
+    nth->header_len = sizeof(*nth);
+    nth->sequence = _host_out_seq++;
+    nth->block_len = len;
+    nth->ndp_index = sizeof(*nth);
+
+    _host_out_frames -= num;
+    _host_out_len = len;
+    _host_out_pos = 0;
+}
+
+static void _host_out_packet(usbdev_mock_t *dev)
+{
+    usbdev_mock_ep_t *ep = _mock_ep(_cdcncm.ep_out);
+    size_t len = _host_out_len - _host_out_pos;
+
+    if (!_host_out_armed || (_host_out_len == 0)) {
+        return;
+    }
+    /* a zero length packet follows an NTB of whole packets */
+    if (len > USBUS_CDCNCM_EP_DATA_SIZE) {
+        len = USBUS_CDCNCM_EP_DATA_SIZE;
+    }
+    _host_out_armed = false;
+    memcpy(ep->buf, &_host_out[_host_out_pos], len);
+    ep->available = len;
+    ep->state = EP_STATE_DATA_AVAILABLE;
+    dev->usbdev.epcb(&ep->ep, USBDEV_EVENT_ESR);
+}
+
+static void _host_out_done(usbdev_mock_ep_t *ep)
+{
+    _host_out_pos += ep->available;
+    if ((ep->available < USBUS_CDCNCM_EP_DATA_SIZE) ||
+        (_host_out_pos == sizeof(_host_out))) {
+        /* NTB is transferred */
+        _host_out_len = 0;
+        if (_host_out_frames) {
+            _host_out_build();
+        }
+    }
+}
+
+static void _host_in_done(usbdev_mock_ep_t *ep)
+{
+    memcpy(&_host_in[_host_in_len], ep->buf, ep->available);
+    _host_in_len += ep->available;
+    if ((ep->available == USBUS_CDCNCM_EP_DATA_SIZE) &&
+        (_host_in_len < _cdcncm.ntb_in_size)) {
+        return;
+    }
+
+    /* NTB is transferred */
+    usb_cdcncm_nth16_t *nth = (usb_cdcncm_nth16_t *)_host_in;
+    usb_cdcncm_ndp16_t *ndp = (usb_cdcncm_ndp16_t *)&_host_in[nth->ndp_index];
+    usb_cdcncm_dpe16_t *dpe = (usb_cdcncm_dpe16_t *)(ndp + 1);
+
+    expect(nth->signature == USB_CDC_NCM_NTH16_SIGNATURE);
+    expect(nth->block_len == _host_in_len);
+    expect(ndp->signature == USB_CDC_NCM_NDP16_SIGNATURE);
+    for (; dpe->index; dpe++) {
+        expect(dpe->len == FRAME_LEN);
+        expect(dpe->index + dpe->len <= _host_in_len);
+        _host_in_frames++;
+    }
+    _host_in_len = 0;
+    if (_host_in_frames == FRAMES) {
+        thread_flags_set(_main, FLAG_TX_DONE);
+    }
+}
+
+static void _host_kick(event_t *ev)
+{
+    (void)ev;
+    _host_out_packet((usbdev_mock_t *)_usbus.dev);
+}
+
+static void _esr_cb(usbdev_mock_t *dev)
+{
+    /* first event after init */
+    dev->usbdev.cb(&dev->usbdev, USBDEV_EVENT_RESET);
+}
+
+static void _ep_esr_cb(usbdev_mock_t *dev, usbdev_mock_ep_t *ep)
+{
+    (void)dev;
+    if (&ep->ep == _cdcncm.ep_in->ep) {
+        _host_in_done(ep);
+    }
+    else if (&ep->ep == _cdcncm.ep_out->ep) {
+        _host_out_done(ep);
+    }
+    ep->ep.dev->epcb(&ep->ep, USBDEV_EVENT_TR_COMPLETE);
+}
+
+static void _ready_cb(usbdev_mock_t *dev, usbdev_mock_ep_t *ep, size_t len)
+{
+    (void)len;
+    if (ep->ep.num == 0 && ep->ep.dir == USB_EP_DIR_OUT) {
+        /* the previous control request is done */
+        _next_request(dev);
+    }
+    else if (ep->ep.dir == USB_EP_DIR_IN) {
+        /* read by the host */
+        dev->usbdev.epcb(&ep->ep, USBDEV_EVENT_ESR);
+    }
+    else {
+        _host_out_armed = true;
+        _host_out_packet(dev);
+    }
+}
+
+static void _netdev_cb(netdev_t *netdev, netdev_event_t event)
+{
+    switch (event) {
+    case NETDEV_EVENT_ISR:
+        thread_flags_set(_main, FLAG_ISR);
+        break;
+    case NETDEV_EVENT_RX_COMPLETE:
+        expect(netdev->driver->recv(netdev, NULL, 0, NULL) == FRAME_LEN);
+        expect(netdev->driver->recv(netdev, _rx_buf, sizeof(_rx_buf),
+                                    NULL) == FRAME_LEN);
+        _rx_frames++;
+        break;
+    default:
+        break;
+    }
+}
+
+static void _print(const char *name, uint32_t time)
+{
+    printf("%-10s: %8lu frames/s\n", name,
+           (unsigned long)((uint64_t)FRAMES * US_PER_SEC / time));
+}
+
+int main(void)
+{
+    netdev_t *netdev = &_cdcncm.netdev;
+    iolist_t iol = { .iol_base = _frame, .iol_len = sizeof(_frame) };
+    uint32_t start;
+
+    _main = thread_get_active();
+    memset(_frame, 0xa5, sizeof(_frame));
+
+    usbdev_mock_setup(_esr_cb, _ep_esr_cb, _ready_cb);
+    usbus_init(&_usbus, usbdev_get_ctx(0));
+    usbus_cdcncm_init(&_usbus, &_cdcncm);
+    cdcncm_netdev_setup(&_cdcncm);
+    netdev->event_callback = _netdev_cb;
+    expect(netdev->driver->init(netdev) == 0);
+    usbus_create(_usbus_stack, sizeof(_usbus_stack), USBUS_PRIO, USBUS_TNAME,
+                 &_usbus);
+    thread_flags_wait_all(FLAG_CONFIGURED);
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < FRAMES; i++) {
+        expect(netdev->driver->send(netdev, &iol) == FRAME_LEN);
+    }
+    thread_flags_wait_all(FLAG_TX_DONE);
+    _print("tx", ztimer_now(ZTIMER_USEC) - start);
+
+    start = ztimer_now(ZTIMER_USEC);
+    _host_out_frames = FRAMES;
+    _host_out_build();
+    usbus_event_post(&_usbus, &_kick);
+    while (_rx_frames < FRAMES) {
+        thread_flags_wait_any(FLAG_ISR);
+        netdev->driver->isr(netdev);
+    }
+    _print("rx", ztimer_now(ZTIMER_USEC) - start);
+
+    puts("DONE");
+    return 0;
+}
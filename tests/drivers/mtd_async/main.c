@@ -0,0 +1,298 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       mtd_async module test
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <errno.h>
+#include <string.h>
+
+#include "embUnit.h"
+#include "event.h"
+#include "macros/utils.h"
+#include "mtd.h"
+#include "mtd_async.h"
+#include "mutex.h"
+
+/* Test mock object implementing a RAM-based mtd that logs all accesses */
+#define SECTOR_COUNT        16
+#define PAGE_PER_SECTOR     4
+#define PAGE_SIZE           64
+#define SECTOR_SIZE         (PAGE_PER_SECTOR * PAGE_SIZE)
+#define MEMORY_SIZE         (SECTOR_SIZE * SECTOR_COUNT)
+
+#define LOG_NUMOF           8
+
+typedef struct {
+    char op;
+    uint32_t addr;
+    uint32_t count;
+} access_t;
+
+static uint8_t _dummy_memory[MEMORY_SIZE];
+static uint8_t _buffer[2 * SECTOR_SIZE];
+
+static access_t _log[LOG_NUMOF];
+static unsigned _log_numof;
+
+/* held by the test to keep the worker busy with the first request */
+static mutex_t _gate = MUTEX_INIT;
+
+static void _access(char op, uint32_t addr, uint32_t count)
+{
+    mutex_lock(&_gate);
+    mutex_unlock(&_gate);
+
+    if (_log_numof < LOG_NUMOF) {
+        _log[_log_numof++] = (access_t){ .op = op, .addr = addr, .count = count };
+    }
+}
+
+static int _init(mtd_dev_t *dev)
+{
+    (void)dev;
+
+    return 0;
+}
+
+static int _read_page(mtd_dev_t *dev, void *buff, uint32_t page, uint32_t offset, uint32_t size)
+{
+    uint32_t addr = page * dev->page_size + offset;
+
+    size = MIN(SECTOR_SIZE * 2 - offset, size);
+    _access('r', addr, size);
+    memcpy(buff, _dummy_memory + addr, size);
+
+    return size;
+}
+
+static int _write_page(mtd_dev_t *dev, const void *buff, uint32_t page, uint32_t offset, uint32_t size)
+{
+    uint32_t addr = page * dev->page_size + offset;
+
+    size = MIN(SECTOR_SIZE * 2 - offset, size);
+    _access('w', addr, size);
+    memcpy(_dummy_memory + addr, buff, size);
+
+    return size;
+}
+
+static int _erase_sector(mtd_dev_t *dev, uint32_t sector, uint32_t count)
+{
+    uint32_t addr = sector * dev->page_size * dev->pages_per_sector;
+
+    _access('e', sector, count);
+    memset(_dummy_memory + addr, 0xff,
+           count * dev->page_size * dev->pages_per_sector);
+
+    return 0;
+}
+
+static const mtd_desc_t driver = {
+    .init = _init,
+    .read_page    = _read_page,
+    .write_page   = _write_page,
+    .erase_sector = _erase_sector,
+};
+
+static mtd_dev_t _dev = {
+    .driver = &driver,
+    .sector_count = SECTOR_COUNT,
+    .pages_per_sector = PAGE_PER_SECTOR,
+    .page_size = PAGE_SIZE,
+    .write_size = 1,
+};
+
+static void _assert_access(unsigned idx, char op, uint32_t addr, uint32_t count)
+{
+    TEST_ASSERT(idx < _log_numof);
+    TEST_ASSERT_EQUAL_INT(op, _log[idx].op);
+    TEST_ASSERT_EQUAL_INT(addr, _log[idx].addr);
+    TEST_ASSERT_EQUAL_INT(count, _log[idx].count);
+}
+
+static void test_mtd_async_single(void)
+{
+    mtd_async_req_t req;
+
+    memset(_buffer, 0x42, SECTOR_SIZE);
+    mtd_async_write_page(&req, &_dev, _buffer, 4, 0, SECTOR_SIZE);
+    mtd_async_submit(&req);
+    TEST_ASSERT_EQUAL_INT(0, mtd_async_wait(&req));
+    TEST_ASSERT(mtd_async_done(&req));
+
+    memset(_buffer, 0, SECTOR_SIZE);
+    mtd_async_read_page(&req, &_dev, _buffer, 4, 16, 16);
+    mtd_async_submit(&req);
+    TEST_ASSERT_EQUAL_INT(0, mtd_async_wait(&req));
+    TEST_ASSERT_EQUAL_INT(0x42, _buffer[0]);
+    TEST_ASSERT_EQUAL_INT(0x42, _buffer[15]);
+    TEST_ASSERT_EQUAL_INT(0, _buffer[16]);
+
+    mtd_async_erase_sector(&req, &_dev, 1, 1);
+    mtd_async_submit(&req);
+    TEST_ASSERT_EQUAL_INT(0, mtd_async_wait(&req));
+    TEST_ASSERT_EQUAL_INT(0xff, _dummy_memory[SECTOR_SIZE]);
+
+    mtd_async_erase_sector(&req, &_dev, SECTOR_COUNT, 1);
+    mtd_async_submit(&req);
+    TEST_ASSERT_EQUAL_INT(-EOVERFLOW, mtd_async_wait(&req));
+
+    _assert_access(0, 'w', 4 * PAGE_SIZE, SECTOR_SIZE);
+    _assert_access(1, 'r', 4 * PAGE_SIZE + 16, 16);
+    _assert_access(2, 'e', 1, 1);
+    TEST_ASSERT_EQUAL_INT(3, _log_numof);
+}
+
+static unsigned _events;
+
+static void _event_handler(event_t *event)
+{
+    (void)event;
+    _events++;
+}
+
+static void test_mtd_async_event(void)
+{
+    event_queue_t queue;
+    event_t event = { .handler = _event_handler };
+    mtd_async_req_t req;
+
+    event_queue_init(&queue);
+    mtd_async_erase_sector(&req, &_dev, 0, 1);
+    mtd_async_set_event(&req, &queue, &event);
+    mtd_async_submit(&req);
+
+    event_t *ev = event_wait(&queue);
+    ev->handler(ev);
+    TEST_ASSERT_EQUAL_INT(1, _events);
+    TEST_ASSERT(mtd_async_done(&req));
+    TEST_ASSERT_EQUAL_INT(0, req.res);
+}
+
+static void test_mtd_async_merge_erase(void)
+{
+    mtd_async_req_t req[4];
+
+    mutex_lock(&_gate);
+    for (unsigned i = 0; i < ARRAY_SIZE(req); i++) {
+        mtd_async_erase_sector(&req[i], &_dev, i, 1);
+        mtd_async_submit(&req[i]);
+    }
+    mutex_unlock(&_gate);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(req); i++) {
+        TEST_ASSERT_EQUAL_INT(0, mtd_async_wait(&req[i]));
+    }
+
+    /* the first request was already being processed when the others were
+     * queued, the remaining ones are erased at once */
+    TEST_ASSERT_EQUAL_INT(2, _log_numof);
+    _assert_access(0, 'e', 0, 1);
+    _assert_access(1, 'e', 1, 3);
+}
+
+static void test_mtd_async_merge_write(void)
+{
+    mtd_async_req_t req[4];
+    const uint32_t chunk = sizeof(_buffer) / ARRAY_SIZE(req);
+
+    for (unsigned i = 0; i < sizeof(_buffer); i++) {
+        _buffer[i] = i;
+    }
+
+    mutex_lock(&_gate);
+    mtd_async_erase_sector(&req[0], &_dev, 8, 2);
+    mtd_async_submit(&req[0]);
+    for (unsigned i = 1; i < ARRAY_SIZE(req); i++) {
+        mtd_async_write_page(&req[i], &_dev, &_buffer[i * chunk],
+                             8 * PAGE_PER_SECTOR, i * chunk, chunk);
+        mtd_async_submit(&req[i]);
+    }
+    mutex_unlock(&_gate);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(req); i++) {
+        TEST_ASSERT_EQUAL_INT(0, mtd_async_wait(&req[i]));
+    }
+
+    _assert_access(0, 'e', 8, 2);
+    _assert_access(1, 'w', 8 * SECTOR_SIZE + chunk, 3 * chunk);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(&_dummy_memory[8 * SECTOR_SIZE + chunk],
+                                    &_buffer[chunk], 3 * chunk));
+}
+
+static void test_mtd_async_read_priority(void)
+{
+    mtd_async_req_t erase[2];
+    mtd_async_req_t read[2];
+
+    mutex_lock(&_gate);
+    mtd_async_erase_sector(&erase[0], &_dev, 0, 1);
+    mtd_async_submit(&erase[0]);
+    mtd_async_erase_sector(&erase[1], &_dev, 4, 1);
+    mtd_async_submit(&erase[1]);
+    /* overlaps the pending erase and must wait for it */
+    mtd_async_read_page(&read[0], &_dev, _buffer, 4 * PAGE_PER_SECTOR, 0, 16);
+    mtd_async_submit(&read[0]);
+    /* independent of the pending erase and is served first */
+    mtd_async_read_page(&read[1], &_dev, _buffer + 16, 8 * PAGE_PER_SECTOR, 0, 16);
+    mtd_async_submit(&read[1]);
+    mutex_unlock(&_gate);
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_async_wait(&read[0]));
+    TEST_ASSERT_EQUAL_INT(0, mtd_async_wait(&read[1]));
+    TEST_ASSERT_EQUAL_INT(0, mtd_async_wait(&erase[0]));
+    TEST_ASSERT_EQUAL_INT(0, mtd_async_wait(&erase[1]));
+
+    TEST_ASSERT_EQUAL_INT(4, _log_numof);
+    _assert_access(0, 'e', 0, 1);
+    _assert_access(1, 'r', 8 * SECTOR_SIZE, 16);
+    _assert_access(2, 'e', 4, 1);
+    _assert_access(3, 'r', 4 * SECTOR_SIZE, 16);
+}
+
+static void set_up(void)
+{
+    memset(_dummy_memory, 0, sizeof(_dummy_memory));
+    _log_numof = 0;
+}
+
+Test *tests_mtd_async_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_mtd_async_single),
+        new_TestFixture(test_mtd_async_event),
+        new_TestFixture(test_mtd_async_merge_erase),
+        new_TestFixture(test_mtd_async_merge_write),
+        new_TestFixture(test_mtd_async_read_priority),
+    };
+
+    EMB_UNIT_TESTCALLER(mtd_async_tests, set_up, NULL, fixtures);
+
+    return (Test *)&mtd_async_tests;
+}
+
+int main(void)
+{
+    mtd_init(&_dev);
+
+    TESTS_START();
+    TESTS_RUN(tests_mtd_async_tests());
+    TESTS_END();
+    return 0;
+}
@@ -0,0 +1,270 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       mtd_cache module test
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <errno.h>
+#include <string.h>
+
+#include "embUnit.h"
+#include "macros/utils.h"
+#include "mtd.h"
+#include "mtd_cache.h"
+
+/* Test mock object implementing a simple RAM-based mtd that counts accesses */
+#define SECTOR_COUNT        16
+#define PAGE_PER_SECTOR     4
+#define PAGE_SIZE           64
+#define WRITE_SIZE          4
+
+#define SECTOR_SIZE         (PAGE_PER_SECTOR * PAGE_SIZE)
+#define MEMORY_SIZE         (SECTOR_SIZE * SECTOR_COUNT)
+
+static uint8_t _dummy_memory[MEMORY_SIZE];
+
+static uint8_t _buffer[SECTOR_SIZE];
+
+static unsigned _erases;
+static unsigned _reads;
+
+static int _init(mtd_dev_t *dev)
+{
+    (void)dev;
+
+    return 0;
+}
+
+static int _read_page(mtd_dev_t *dev, void *buff, uint32_t page, uint32_t offset, uint32_t size)
+{
+    uint32_t addr = page * dev->page_size + offset;
+
+    size = MIN(dev->page_size - offset, size);
+    memcpy(buff, _dummy_memory + addr, size);
+    _reads++;
+
+    return size;
+}
+
+static int _write_page(mtd_dev_t *dev, const void *buff, uint32_t page, uint32_t offset, uint32_t size)
+{
+    uint32_t addr = page * dev->page_size + offset;
+
+    size = MIN(dev->page_size - offset, size);
+    for (uint32_t i = 0; i < size; i++) {
+        /* flash semantics: bits can only be cleared */
+        _dummy_memory[addr + i] &= ((const uint8_t *)buff)[i];
+    }
+
+    return size;
+}
+
+static int _erase_sector(mtd_dev_t *dev, uint32_t sector, uint32_t count)
+{
+    uint32_t addr = sector * dev->page_size * dev->pages_per_sector;
+
+    memset(_dummy_memory + addr, 0xff,
+           count * dev->page_size * dev->pages_per_sector);
+    _erases += count;
+
+    return 0;
+}
+
+static const mtd_desc_t driver = {
+    .init = _init,
+    .read_page    = _read_page,
+    .write_page   = _write_page,
+    .erase_sector = _erase_sector,
+};
+
+static mtd_dev_t _backing = {
+    .driver = &driver,
+    .sector_count = SECTOR_COUNT,
+    .pages_per_sector = PAGE_PER_SECTOR,
+    .page_size = PAGE_SIZE,
+    .write_size = WRITE_SIZE,
+};
+
+static uint8_t _cache_buf[MTD_CACHE_BUF_SIZE(SECTOR_SIZE)];
+static mtd_cache_t _cache = MTD_CACHE_INIT(&_backing, _cache_buf);
+
+static mtd_dev_t *_dev = &_cache.mtd;
+
+static void _test_mem(const uint8_t *buffer, size_t len, uint8_t expected)
+{
+    for (size_t i = 0; i < len; i++) {
+        TEST_ASSERT_EQUAL_INT(expected, buffer[i]);
+    }
+}
+
+static void test_mtd_init(void)
+{
+    int ret = mtd_init(_dev);
+
+    TEST_ASSERT_EQUAL_INT(0, ret);
+    TEST_ASSERT_EQUAL_INT(SECTOR_COUNT, _dev->sector_count);
+    TEST_ASSERT_EQUAL_INT(PAGE_PER_SECTOR, _dev->pages_per_sector);
+    TEST_ASSERT_EQUAL_INT(PAGE_SIZE, _dev->page_size);
+    TEST_ASSERT_EQUAL_INT(1, _dev->write_size);
+}
+
+static void test_mtd_write_coalesce(void)
+{
+    /* many small writes to the same sector only modify the cache */
+    for (uint8_t i = 0; i < SECTOR_SIZE / 4; i++) {
+        uint8_t val[4] = { i, i, i, i };
+        TEST_ASSERT_EQUAL_INT(0, mtd_write(_dev, val, SECTOR_SIZE + 4 * i, sizeof(val)));
+    }
+    TEST_ASSERT_EQUAL_INT(0, _erases);
+    _test_mem(&_dummy_memory[SECTOR_SIZE], SECTOR_SIZE, 0xff);
+
+    /* reads are served from the cache */
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(_dev, _buffer, SECTOR_SIZE + 8, 4));
+    _test_mem(_buffer, 4, 2);
+
+    /* a flush results in a single erase */
+    TEST_ASSERT_EQUAL_INT(0, mtd_flush(_dev));
+    TEST_ASSERT_EQUAL_INT(1, _erases);
+    for (unsigned i = 0; i < SECTOR_SIZE / 4; i++) {
+        _test_mem(&_dummy_memory[SECTOR_SIZE + 4 * i], 4, i);
+    }
+    TEST_ASSERT_EQUAL_INT(1, _cache.stats.writebacks);
+
+    /* nothing left to write back */
+    TEST_ASSERT_EQUAL_INT(0, mtd_flush(_dev));
+    TEST_ASSERT_EQUAL_INT(1, _erases);
+}
+
+static void test_mtd_write_across_sectors(void)
+{
+    memset(_buffer, 0xAA, sizeof(_buffer));
+
+    /* unaligned write spanning two sectors */
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page_raw(_dev, _buffer, PAGE_PER_SECTOR - 1,
+                                                PAGE_SIZE / 2, SECTOR_SIZE));
+    TEST_ASSERT_EQUAL_INT(0, _erases);
+
+    memset(_buffer, 0, sizeof(_buffer));
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(_dev, _buffer, SECTOR_SIZE - PAGE_SIZE / 2,
+                                      SECTOR_SIZE));
+    _test_mem(_buffer, SECTOR_SIZE, 0xAA);
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_flush(_dev));
+    TEST_ASSERT_EQUAL_INT(2, _erases);
+    _test_mem(&_dummy_memory[SECTOR_SIZE - PAGE_SIZE / 2], SECTOR_SIZE, 0xAA);
+    _test_mem(_dummy_memory, SECTOR_SIZE - PAGE_SIZE / 2, 0xff);
+}
+
+static void test_mtd_evict_lru(void)
+{
+    memset(_buffer, 0x55, sizeof(_buffer));
+
+    /* fill all cache lines, sector 0 is the least recently used one */
+    for (unsigned i = 0; i < CONFIG_MTD_CACHE_SECTORS; i++) {
+        TEST_ASSERT_EQUAL_INT(0, mtd_write(_dev, _buffer, i * SECTOR_SIZE, 1));
+    }
+    for (unsigned i = 1; i < CONFIG_MTD_CACHE_SECTORS; i++) {
+        TEST_ASSERT_EQUAL_INT(0, mtd_write(_dev, _buffer, i * SECTOR_SIZE + 1, 1));
+    }
+    TEST_ASSERT_EQUAL_INT(0, _erases);
+
+    /* another sector evicts sector 0 */
+    TEST_ASSERT_EQUAL_INT(0, mtd_write(_dev, _buffer,
+                                       CONFIG_MTD_CACHE_SECTORS * SECTOR_SIZE, 1));
+    TEST_ASSERT_EQUAL_INT(1, _erases);
+    TEST_ASSERT_EQUAL_INT(0x55, _dummy_memory[0]);
+    TEST_ASSERT_EQUAL_INT(0xff, _dummy_memory[SECTOR_SIZE]);
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_flush(_dev));
+    TEST_ASSERT_EQUAL_INT(CONFIG_MTD_CACHE_SECTORS + 1, _erases);
+}
+
+static void test_mtd_full_sector_write(void)
+{
+    memset(_buffer, 0x12, sizeof(_buffer));
+    _reads = 0;
+
+    /* overwriting a whole sector does not need to read it first */
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_sector(_dev, _buffer, 3, 1));
+    TEST_ASSERT_EQUAL_INT(0, _reads);
+    TEST_ASSERT_EQUAL_INT(0, _erases);
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_flush(_dev));
+    TEST_ASSERT_EQUAL_INT(1, _erases);
+    _test_mem(&_dummy_memory[3 * SECTOR_SIZE], SECTOR_SIZE, 0x12);
+}
+
+static void test_mtd_erase(void)
+{
+    memset(_buffer, 0x00, sizeof(_buffer));
+
+    /* erasing drops pending writes */
+    TEST_ASSERT_EQUAL_INT(0, mtd_write(_dev, _buffer, 2 * SECTOR_SIZE, 16));
+    TEST_ASSERT_EQUAL_INT(0, mtd_erase_sector(_dev, 2, 1));
+    TEST_ASSERT_EQUAL_INT(1, _erases);
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(_dev, _buffer, 2 * SECTOR_SIZE, 16));
+    _test_mem(_buffer, 16, 0xff);
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_flush(_dev));
+    TEST_ASSERT_EQUAL_INT(1, _erases);
+}
+
+static void test_mtd_power_down(void)
+{
+    memset(_buffer, 0x21, sizeof(_buffer));
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_write(_dev, _buffer, 5 * SECTOR_SIZE, 16));
+    /* backing device does not support power management */
+    TEST_ASSERT_EQUAL_INT(-ENOTSUP, mtd_power(_dev, MTD_POWER_DOWN));
+    /* but the data was written back nevertheless */
+    TEST_ASSERT_EQUAL_INT(1, _erases);
+    _test_mem(&_dummy_memory[5 * SECTOR_SIZE], 16, 0x21);
+}
+
+static void set_up(void)
+{
+    mtd_flush(_dev);
+    memset(_dummy_memory, 0xff, sizeof(_dummy_memory));
+    _erases = 0;
+}
+
+Test *tests_mtd_cache_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_mtd_init),
+        new_TestFixture(test_mtd_write_coalesce),
+        new_TestFixture(test_mtd_write_across_sectors),
+        new_TestFixture(test_mtd_evict_lru),
+        new_TestFixture(test_mtd_full_sector_write),
+        new_TestFixture(test_mtd_erase),
+        new_TestFixture(test_mtd_power_down),
+    };
+
+    EMB_UNIT_TESTCALLER(mtd_cache_tests, set_up, NULL, fixtures);
+
+    return (Test *)&mtd_cache_tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_mtd_cache_tests());
+    TESTS_END();
+    return 0;
+}
@@ -149,6 +149,13 @@ static int _power(mtd_dev_t *dev, enum mtd_power_state power)
     return 0;
 }
 
+static int _mmap(mtd_dev_t *dev, uint32_t page, const void **addr)
+{
+    (void)dev;
+    *addr = &_dummy_memory[page * PAGE_SIZE];
+    return 0;
+}
+
 static const mtd_desc_t driver = {
     .init = _init,
     .read = _read,
@@ -157,6 +164,7 @@ static const mtd_desc_t driver = {
     .read_page    = _read_page,
     .write_page   = _write_page,
     .erase_sector = _erase_sector,
+    .mmap         = _mmap,
 };
 
 static mtd_dev_t dev = {
@@ -347,6 +355,27 @@ static void set_up(void)
     memset(_dummy_memory, 0xff, sizeof(_dummy_memory));
 }
 
+static void test_mtd_mmap(void)
+{
+    const void *addr;
+    int ret;
+
+    ret = mtd_mmap(_dev_a, 1, 3, PAGE_SIZE, &addr);
+    TEST_ASSERT_EQUAL_INT(0, ret);
+    TEST_ASSERT(addr == &_dummy_memory[PAGE_SIZE + 3]);
+
+    ret = mtd_mmap(_dev_b, 1, 3, PAGE_SIZE, &addr);
+    TEST_ASSERT_EQUAL_INT(0, ret);
+    TEST_ASSERT(addr == &_dummy_memory[REGION_FLASH_SIZE + PAGE_SIZE + 3]);
+
+    /* data written through the MTD API is visible through the mapping */
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_dev_b, _buffer, 1, 3, 4));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_buffer, addr, 4));
+
+    ret = mtd_mmap(_dev_b, REGION_PAGE_COUNT - 1, 0, PAGE_SIZE + 1, &addr);
+    TEST_ASSERT_EQUAL_INT(-EOVERFLOW, ret);
+}
+
 Test *tests_mtd_mapper_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -356,6 +385,7 @@ Test *tests_mtd_mapper_tests(void)
         new_TestFixture(test_mtd_read_page),
         new_TestFixture(test_mtd_write),
         new_TestFixture(test_mtd_write_page),
+        new_TestFixture(test_mtd_mmap),
     };
 
     EMB_UNIT_TESTCALLER(mtd_flashpage_tests, set_up, NULL, fixtures);